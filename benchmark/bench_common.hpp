@@ -0,0 +1,104 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#ifndef SKYR_BENCHMARK_BENCH_COMMON_HPP
+#define SKYR_BENCHMARK_BENCH_COMMON_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace bench {
+/// Written after each timing, so that the checksums, and the work that
+/// produces them, can't be optimized away
+inline volatile std::size_t checksum_sink = 0;
+
+/// Calls `operation()`, or `operation(i)` with the iteration number,
+/// `iterations` times, and sums the checksums it returns
+///
+/// \param iterations The number of times to call the operation
+/// \param operations_per_iteration The number of operations each call does
+/// \param operation The operation, which returns a checksum
+/// \returns The average time of one operation, in nanoseconds
+template <class Fn>
+auto time_operations(std::size_t iterations, std::size_t operations_per_iteration, Fn&& operation) -> double {
+  auto checksum = std::size_t{0};
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i) {
+    if constexpr (std::invocable<Fn&, std::size_t>) {
+      checksum += operation(i);
+    } else {
+      checksum += operation();
+    }
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+
+  checksum_sink = checksum;
+
+  auto duration_ns = std::chrono::duration<double, std::nano>(end - start).count();
+  return duration_ns / static_cast<double>(iterations * operations_per_iteration);
+}
+
+/// \param iterations The number of times to call the operation
+/// \param operation The operation, which returns a checksum
+/// \returns The average time of one call, in nanoseconds
+template <class Fn>
+auto time_operations(std::size_t iterations, Fn&& operation) -> double {
+  return time_operations(iterations, 1, std::forward<Fn>(operation));
+}
+
+/// Times `N` variants of an operation in rounds, timing each variant once
+/// per round in turn, so that they all see the same changes in the load on
+/// the machine, and keeps the fastest round of each, which is the one least
+/// disturbed by other work. Use it to compare variants whose times differ
+/// by a few percent
+///
+/// \param rounds The number of rounds
+/// \param time_variant Called as `time_variant(i)` to time variant `i`
+///        once, and returns the time
+/// \returns The fastest time of each variant
+template <std::size_t N, class Fn>
+auto time_interleaved(std::size_t rounds, Fn&& time_variant) -> std::array<double, N> {
+  auto fastest = std::array<double, N>{};
+  fastest.fill(std::numeric_limits<double>::infinity());
+  for (std::size_t round = 0; round < rounds; ++round) {
+    for (std::size_t i = 0; i < N; ++i) {
+      fastest[i] = std::min(fastest[i], time_variant(i));
+    }
+  }
+  return fastest;
+}
+
+/// Reads the number of iterations from the first command line argument
+///
+/// \param argc The number of arguments
+/// \param argv The arguments
+/// \param default_iterations The number of iterations if there's no argument
+/// \param description What an iteration does, for the usage message
+/// \returns The number of iterations, or nothing, after printing the usage,
+///          if the argument isn't a number
+inline auto parse_iterations(int argc, char* argv[], std::size_t default_iterations, std::string_view description)
+    -> std::optional<std::size_t> {
+  if (argc <= 1) {
+    return default_iterations;
+  }
+
+  try {
+    return std::stoull(argv[1]);
+  } catch (...) {
+    std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+    std::cerr << "  iterations: " << description << " (default: " << default_iterations << ")\n";
+    return std::nullopt;
+  }
+}
+}  // namespace bench
+
+#endif  // SKYR_BENCHMARK_BENCH_COMMON_HPP
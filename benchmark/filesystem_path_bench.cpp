@@ -0,0 +1,73 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <filesystem>
+#include <format>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <skyr/filesystem/path.hpp>
+#include <skyr/url.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// Paths as an indexer finds them in a source tree
+auto make_paths(std::size_t count) -> std::vector<std::filesystem::path> {
+  auto paths = std::vector<std::filesystem::path>{};
+  for (auto i = 0UL; i < count; ++i) {
+    paths.emplace_back(std::format("/home/user/src/project_{}/module {}/src/details/file_{}.cpp", i % 7, i % 31, i));
+  }
+  return paths;
+}
+
+// The conversion before `from_path` built the record directly
+auto parse_file_url(const std::filesystem::path& path) -> std::expected<skyr::url, skyr::url_parse_errc> {
+  auto input = std::u8string(u8"file://");
+  auto u8string = path.generic_u8string();
+  input.append(std::cbegin(u8string), std::cend(u8string));
+  return skyr::make_url(input);
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 200'000, "number of paths to convert");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  const auto paths = make_paths(iterations);
+
+  std::cout << "\n=================================================\n";
+  std::cout << "Filesystem Path Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Paths: " << paths.size() << "\n";
+  std::cout << "  Hardware threads: " << std::thread::hardware_concurrency() << "\n\n";
+
+  auto parse_ns =
+      bench::time_operations(paths.size(), [&paths](std::size_t i) { return parse_file_url(paths[i])->size(); });
+
+  auto from_path_ns = bench::time_operations(paths.size(), [&paths](std::size_t i) {
+    return skyr::filesystem::from_path(paths[i])->size();
+  });
+
+  auto from_paths_ns = bench::time_operations(1, [&paths](std::size_t) {
+    return skyr::filesystem::from_paths(paths).size();
+  }) / static_cast<double>(paths.size());
+
+  std::cout << "Performance (ns per path):\n";
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "  Parse \"file://\" + path:  " << std::setw(8) << parse_ns << "\n";
+  std::cout << "  from_path:               " << std::setw(8) << from_path_ns << "\n";
+  std::cout << "  from_paths:              " << std::setw(8) << from_paths_ns << "\n";
+  std::cout << "  Speedup (from_path):     " << std::setw(8) << parse_ns / from_path_ns << "x\n";
+
+  std::cout << "\n=================================================\n";
+
+  return 0;
+}
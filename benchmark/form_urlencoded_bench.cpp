@@ -0,0 +1,107 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <skyr/core/form_urlencoded.hpp>
+#include <skyr/core/parse_query.hpp>
+#include <skyr/url.hpp>
+#include <skyr/url_search_parameters.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// A form of the size that a large POST produces: many short fields, some
+// with spaces and non-ASCII text, and a few long ones
+auto make_parameters(std::size_t size) -> std::vector<std::pair<std::string, std::string>> {
+  auto parameters = std::vector<std::pair<std::string, std::string>>{};
+  auto total = std::size_t{0};
+  for (auto i = 0UL; total < size; ++i) {
+    auto name = "field_" + std::to_string(i);
+    auto value = ((i % 100) == 0)   ? std::string(4096, 'x')
+                 : ((i % 3) == 0)   ? "caf\xc3\xa9 cr\xc3\xa8me #" + std::to_string(i)
+                 : ((i % 3) == 1) ? "plain_value_" + std::to_string(i)
+                                    : "a+b&c=d e/f?g";
+    total += name.size() + value.size();
+    parameters.emplace_back(std::move(name), std::move(value));
+  }
+  return parameters;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 20, "number of times to decode and encode the body");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  constexpr auto chunk_size = std::size_t{64} << 10;
+
+  const auto parameters = make_parameters(std::size_t{4} << 20);
+  auto body = std::string{};
+  skyr::form_encode(parameters, std::back_inserter(body));
+
+  auto encode_ns = bench::time_operations(iterations, [&parameters] {
+    auto output = std::string{};
+    skyr::form_encode(parameters, std::back_inserter(output));
+    return output.size();
+  });
+
+  auto decoder_ns = bench::time_operations(iterations, [&body] {
+    auto checksum = std::size_t{0};
+    auto count = [&checksum](std::string_view name, std::string_view value) { checksum += name.size() + value.size(); };
+
+    auto decoder = skyr::form_decoder{};
+    for (auto first = std::size_t{0}; first < body.size(); first += chunk_size) {
+      (void)decoder.feed(std::string_view(body).substr(first, chunk_size), count);
+    }
+    decoder.finish(count);
+    return checksum;
+  });
+
+  auto parse_query_ns = bench::time_operations(iterations, [&body] {
+    auto checksum = std::size_t{0};
+    auto parsed = skyr::parse_query(body);
+    for (const auto& [name, value] : parsed.value()) {
+      checksum += name.size() + value.value_or("").size();
+    }
+    return checksum;
+  });
+
+  auto parameters_ns = bench::time_operations(iterations, [&body] {
+    auto checksum = std::size_t{0};
+    for (auto [name, value] : skyr::url_search_parameters(body)) {
+      checksum += name.size() + value.value_or("").size();
+    }
+    return checksum;
+  });
+
+  auto throughput = [&body](double ns) { return static_cast<double>(body.size()) * 1000.0 / ns; };
+
+  std::cout << "\n=================================================\n";
+  std::cout << "Form URL Encoded Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Body size:  " << body.size() << " bytes\n";
+  std::cout << "  Parameters: " << parameters.size() << "\n";
+  std::cout << "  Chunk size: " << chunk_size << " bytes\n";
+  std::cout << "  Iterations: " << iterations << "\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  form_encode:             " << throughput(encode_ns) << " MB/s\n";
+  std::cout << "  form_decoder (chunked):  " << throughput(decoder_ns) << " MB/s\n";
+  std::cout << "  parse_query:             " << throughput(parse_query_ns) << " MB/s (undecoded)\n";
+  std::cout << "  url_search_parameters:   " << throughput(parameters_ns) << " MB/s\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
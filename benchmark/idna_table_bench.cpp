@@ -0,0 +1,67 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include <skyr/domain/idna.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// Code points from internationalized domain names, which are mostly valid
+// or mapped
+constexpr auto domain_code_points = std::u32string_view(U"bücher.例え.ÀÉÎ.пример.ﬁ.إختبار.测试.münchen");
+
+constexpr auto table_size = sizeof(skyr::idna::details::code_point_ranges) +
+                            sizeof(skyr::idna::details::mapped_offsets) + sizeof(skyr::idna::details::range_index) +
+                            sizeof(skyr::idna::details::mapped_code_points);
+
+auto lookup_all_code_points() -> std::size_t {
+  auto checksum = std::size_t{0};
+  for (auto code_point = U'\x0000'; code_point <= U'\x10ffff'; ++code_point) {
+    checksum += static_cast<std::size_t>(skyr::idna::code_point_status(code_point)) +
+                skyr::idna::code_point_mapping(code_point).size();
+  }
+  return checksum;
+}
+
+auto lookup_domain_code_points() -> std::size_t {
+  auto checksum = std::size_t{0};
+  for (auto code_point : domain_code_points) {
+    checksum += static_cast<std::size_t>(skyr::idna::code_point_status(code_point)) +
+                skyr::idna::code_point_mapping(code_point).size();
+  }
+  return checksum;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 20, "number of times to look up every code point");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  auto all_ns = bench::time_operations(iterations, 0x110000, lookup_all_code_points);
+  auto domain_ns = bench::time_operations(iterations * 50'000, domain_code_points.size(), lookup_domain_code_points);
+
+  std::cout << "\n=================================================\n";
+  std::cout << "IDNA Table Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Tables:\n";
+  std::cout << "  Ranges:        " << skyr::idna::details::code_point_ranges.size() << "\n";
+  std::cout << "  Mappings:      " << skyr::idna::details::mapped_code_points.size() << " code points\n";
+  std::cout << "  Total size:    " << table_size << " bytes\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << "  All code points:    " << std::fixed << std::setprecision(2) << all_ns << " ns/lookup\n";
+  std::cout << "  Domain code points: " << std::fixed << std::setprecision(2) << domain_ns << " ns/lookup\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
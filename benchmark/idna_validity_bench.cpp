@@ -0,0 +1,96 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skyr/domain/domain.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+struct domain_set {
+  std::string_view name;
+  std::vector<std::string> domains;
+};
+
+// ASCII hosts, which shouldn't pay for either check, and internationalized
+// hosts, left-to-right, right-to-left and with joiners
+const auto domain_sets = std::vector<domain_set>{
+    {"ascii", {"www.example.com", "api.v2.services.internal.example.org", "cdn.example.net", "localhost"}},
+    {"idn", {"b\xc3\xbc" "cher.example", "\xe4\xbe\x8b\xe3\x81\x88.\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88",
+             "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80.\xd1\x80\xd1\x84", "m\xc3\xbcnchen.de"}},
+    {"bidi", {"\xd8\xa5\xd8\xae\xd8\xaa\xd8\xa8\xd8\xa7\xd8\xb1.example",
+              "\xd7\x91\xd7\x93\xd7\x99\xd7\xa7\xd7\x94.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c",
+              "\xd9\x85\xd8\xab\xd8\xa7\xd9\x84.\xd8\xa5\xd8\xae\xd8\xaa\xd8\xa8\xd8\xa7\xd8\xb1", "www.example.com"}},
+    {"rtl", {"\xd8\xa5\xd8\xae\xd8\xaa\xd8\xa8\xd8\xa7\xd8\xb1.example",
+             "\xd7\x91\xd7\x93\xd7\x99\xd7\xa7\xd7\x94.\xd7\x99\xd7\xa9\xd7\xa8\xd7\x90\xd7\x9c",
+             "\xd9\x85\xd8\xab\xd8\xa7\xd9\x84.\xd8\xa5\xd8\xae\xd8\xaa\xd8\xa8\xd8\xa7\xd8\xb1"}},
+    {"joiners", {"\xe0\xa4\x95\xe0\xa5\x8d\xe2\x80\x8d\xe0\xa4\xb7.example",
+                 "\xd9\x85\xdb\x8c\xe2\x80\x8c\xd8\xae\xd9\x88\xd8\xa7\xd9\x87\xd9\x85.example",
+                 "example.\xe0\xa4\xad\xe0\xa4\xbe\xe0\xa4\xb0\xe0\xa4\xa4"}},
+};
+
+struct checks {
+  bool bidi;
+  bool joiners;
+};
+
+// Unchecked, each check on its own, and both checks
+constexpr auto variants = std::array<checks, 4>{{{false, false}, {true, false}, {false, true}, {true, true}}};
+
+auto time_domain_to_ascii(std::size_t iterations, const std::vector<std::string>& domains, checks check) -> double {
+  auto ascii = std::string{};
+  return bench::time_operations(iterations, domains.size(), [&domains, &ascii, check] {
+    auto checksum = std::size_t{0};
+    for (const auto& domain : domains) {
+      ascii.clear();
+      if (skyr::domain_to_ascii(domain, &ascii, false, check.bidi, check.joiners, false, false, false)) {
+        checksum += ascii.size();
+      }
+    }
+    return checksum;
+  });
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 200'000, "number of times to process each set of domains");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  // The checks cost a few percent, which is less than the noise between
+  // runs, so the variants are timed in short interleaved rounds, and the
+  // fastest round of each is reported
+  constexpr auto rounds = std::size_t{400};
+  auto round_iterations = std::max(iterations / rounds, std::size_t{1});
+
+  std::cout << "\n=================================================\n";
+  std::cout << "IDNA Validity Criteria Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Iterations: " << iterations << ", in " << rounds << " interleaved rounds\n\n";
+
+  std::cout << "Performance (ns per domain, fastest round):\n";
+  std::cout << "      domains   unchecked  CheckBidi  CheckJoiners    both  overhead\n";
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (const auto& [name, domains] : domain_sets) {
+    auto ns = bench::time_interleaved<variants.size()>(
+        rounds, [&](std::size_t i) { return time_domain_to_ascii(round_iterations, domains, variants[i]); });
+    std::cout << "  " << std::setw(11) << name << "  " << std::setw(10) << ns[0] << "  " << std::setw(9) << ns[1]
+              << "  " << std::setw(12) << ns[2] << "  " << std::setw(6) << ns[3] << "  " << std::setw(7)
+              << (ns[3] / ns[0] - 1.0) * 100.0 << "%\n";
+  }
+
+  std::cout << "\n=================================================\n";
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <array>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skyr/network/ipv6_address.hpp>
+#include <skyr/url.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// URLs with IPv6 literal hosts, with and without compression and embedded
+// IPv4 addresses
+const std::vector<std::string> test_urls = {
+    "http://[::1]/",
+    "http://[::]/",
+    "http://[2001:db8::1]:8080/path",
+    "https://[2001:db8:85a3::8a2e:370:7334]/index.html",
+    "https://[2001:0db8:85a3:0000:0000:8a2e:0370:7334]/",
+    "http://[fe80::1ff:fe23:4567:890a]/?q=1",
+    "http://[2001:DB8:0:0:8:800:200C:417A]/",
+    "http://[ff02::2]/",
+    "http://[1080:0:0:0:8:800:200c:417a]/a/b",
+    "http://[::ffff:192.0.2.128]/",
+    "http://[::ffff:c000:280]/",
+    "http://[64:ff9b::192.0.2.33]/",
+    "https://[2001:db8:1:2:3:4:5:6]:443/",
+    "http://[abcd:ef01:2345:6789:abcd:ef01:2345:6789]/",
+    "http://[fd00:1234:5678::9abc]/#frag",
+    "http://[1::]/",
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 100'000, "number of times to process all test URLs");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  auto hosts = std::vector<std::string_view>{};
+  auto addresses = std::vector<skyr::ipv6_address>{};
+  for (const auto& url : test_urls) {
+    auto view = std::string_view(url);
+    auto first = view.find('[') + 1;
+    hosts.push_back(view.substr(first, view.find(']') - first));
+
+    bool validation_error = false;
+    addresses.push_back(skyr::parse_ipv6_address(hosts.back(), &validation_error).value());
+  }
+
+  auto parse_ns = bench::time_operations(iterations, hosts.size(), [&hosts] {
+    auto checksum = std::size_t{0};
+    for (auto host : hosts) {
+      bool validation_error = false;
+      checksum += skyr::parse_ipv6_address(host, &validation_error).value().to_bytes()[15];
+    }
+    return checksum;
+  });
+
+  auto serialize_to_ns = bench::time_operations(iterations, addresses.size(), [&addresses] {
+    auto checksum = std::size_t{0};
+    auto buffer = std::array<char, skyr::ipv6_address::max_serialized_size>{};
+    for (const auto& address : addresses) {
+      checksum += static_cast<std::size_t>(address.serialize_to(buffer.data()) - buffer.data());
+    }
+    return checksum;
+  });
+
+  auto serialize_ns = bench::time_operations(iterations, addresses.size(), [&addresses] {
+    auto checksum = std::size_t{0};
+    for (const auto& address : addresses) {
+      checksum += address.serialize().size();
+    }
+    return checksum;
+  });
+
+  auto url_ns = bench::time_operations(iterations / 10, test_urls.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& url : test_urls) {
+      checksum += skyr::make_url(url).value().host().size();
+    }
+    return checksum;
+  });
+
+  std::cout << "\n=================================================\n";
+  std::cout << "IPv6 Address Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Test URLs:  " << test_urls.size() << "\n";
+  std::cout << "  Iterations: " << iterations << "\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  parse_ipv6_address:         " << parse_ns << " ns/address\n";
+  std::cout << "  ipv6_address::serialize_to: " << serialize_to_ns << " ns/address\n";
+  std::cout << "  ipv6_address::serialize:    " << serialize_ns << " ns/address\n";
+  std::cout << "  make_url (IPv6 literals):   " << url_ns << " ns/URL\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <format>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#include <skyr/json/json.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// A query with a few names, each repeated, as filters in search forms
+// produce (`?tag=a&tag=b&...`)
+auto make_query(std::size_t count) -> std::string {
+  auto query = std::string{};
+  for (auto i = 0UL; i < count; ++i) {
+    query += std::format("{}{}={}", (i == 0) ? "" : "&", (i % 4 == 0) ? "id" : "tag", i);
+  }
+  return query;
+}
+
+// A filter object, as an API client sends on every call: flat fields with
+// values that need encoding, and arrays of strings
+auto make_filter(std::size_t count) -> nlohmann::json {
+  auto filter = nlohmann::json::object();
+  for (auto i = 0UL; i < count; ++i) {
+    if ((i % 4) == 0) {
+      filter[std::format("tags_{}", i)] = {"red", "green & blue", "caf\xc3\xa9"};
+    } else {
+      filter[std::format("field_{}", i)] = std::format("value {} / {}", i, i * 7);
+    }
+  }
+  return filter;
+}
+
+// Counts the events, without building anything
+struct counting_handler {
+  auto null() -> bool {
+    return true;
+  }
+  auto start_object(std::size_t) -> bool {
+    return true;
+  }
+  auto key(std::string& key) -> bool {
+    size += key.size();
+    return true;
+  }
+  auto string(std::string& value) -> bool {
+    size += value.size();
+    return true;
+  }
+  auto start_array(std::size_t) -> bool {
+    return true;
+  }
+  auto end_array() -> bool {
+    return true;
+  }
+  auto end_object() -> bool {
+    return true;
+  }
+
+  std::size_t size = 0;
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 100'000, "number of parameters to decode for each query size");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  std::cout << "\n=================================================\n";
+  std::cout << "JSON Query Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Iterations: " << iterations << "\n\n";
+
+  std::cout << "Performance (ns per parameter):\n";
+  std::cout << "  parameters  decode_query  decode_query_sax\n";
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (auto count : {10UL, 100UL, 1000UL, 10000UL}) {
+    const auto query = make_query(count);
+    auto queries = std::max(iterations / count, 1UL);
+
+    auto json_ns = bench::time_operations(queries, [&query] { return skyr::json::decode_query(query).size(); });
+
+    auto sax_ns = bench::time_operations(queries, [&query] {
+      auto handler = counting_handler{};
+      skyr::json::decode_query_sax(query, &handler);
+      return handler.size;
+    });
+
+    std::cout << "  " << std::setw(10) << count << "  " << std::setw(12) << json_ns / static_cast<double>(count)
+              << "  " << std::setw(16) << sax_ns / static_cast<double>(count) << "\n";
+  }
+
+  std::cout << "\nPerformance (ns per field encoded):\n";
+  std::cout << "      fields  encode_query  output iterator\n";
+
+  for (auto count : {10UL, 100UL, 1000UL}) {
+    const auto filter = make_filter(count);
+    auto queries = std::max(iterations / count, 1UL);
+
+    auto string_ns =
+        bench::time_operations(queries, [&filter] { return skyr::json::encode_query(filter).value().size(); });
+
+    auto buffer = std::string{};
+    auto iterator_ns = bench::time_operations(queries, [&filter, &buffer] {
+      buffer.clear();
+      skyr::json::encode_query(filter, std::back_inserter(buffer));
+      return buffer.size();
+    });
+
+    std::cout << "  " << std::setw(10) << count << "  " << std::setw(12) << string_ns / static_cast<double>(count)
+              << "  " << std::setw(15) << iterator_ns / static_cast<double>(count) << "\n";
+  }
+
+  std::cout << "\n=================================================\n";
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <skyr/core/query_filter.hpp>
+#include <skyr/url.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// Queries as they arrive at a link shortener or an analytics pipeline; some
+// have no tracking parameters at all
+const std::vector<std::string> test_queries = {
+    "id=42",
+    "q=url+parser&lang=en&page=2",
+    "utm_source=newsletter&utm_medium=email&utm_campaign=spring_sale&id=1234",
+    "product=shoes&size=42&color=blue&gclid=EAIaIQobChMI8s7n2o2o&fbclid=IwAR2xyz",
+    "ref=home&mc_cid=abc123&mc_eid=def456&_hsenc=p2ANqtz&_hsmi=12345&article=how-to",
+    "s=search+terms&utm_source=twitter&utm_content=banner_3&t=1700000000&si=xyz",
+    "a=1&b=2&c=3&d=4&e=5&f=6&g=7&h=8&i=9&j=10&k=11&l=12&m=13&n=14&o=15&p=16",
+    "token=abcdef0123456789&redirect=%2Fhome%3Ftab%3D1&msclkid=0123456789abcdef",
+};
+
+// A tracking parameter list of the size that browser extensions ship:
+// well-known names, then generated ones
+auto make_names() -> std::vector<std::string> {
+  auto names = std::vector<std::string>{"gclid", "fbclid", "msclkid", "mc_cid",  "mc_eid", "_hsenc",
+                                        "_hsmi", "yclid",  "dclid",   "igshid", "si",     "ttclid"};
+  for (auto i = names.size(); i < 200; ++i) {
+    names.push_back("trk_" + std::to_string(i * 7919 % 10000));
+  }
+  return names;
+}
+
+const std::vector<std::string> prefixes = {"utm_", "pk_", "mtm_", "hsa_", "ga_"};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 100'000, "number of times to filter all test queries");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  const auto names = make_names();
+  const auto filter = skyr::query_filter::compile(names, prefixes);
+
+  auto compile_ns = bench::time_operations(iterations / 100, 1, [&names] {
+    return skyr::query_filter::compile(names, prefixes).empty() ? 0UL : 1UL;
+  });
+
+  auto filter_ns = bench::time_operations(iterations, test_queries.size(), [&filter] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_queries) {
+      auto query = input;
+      filter.apply(&query);
+      checksum += query.size();
+    }
+    return checksum;
+  });
+
+  auto parameters_ns = bench::time_operations(iterations / 10, test_queries.size(), [&names] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_queries) {
+      auto parameters = skyr::url_search_parameters(input);
+      for (const auto& name : names) {
+        parameters.remove(name);
+      }
+      for (const auto& prefix : prefixes) {
+        for (auto it = parameters.begin(); it != parameters.end();) {
+          if (it->name.starts_with(prefix)) {
+            auto name = it->name;
+            parameters.remove(name);
+            it = parameters.begin();
+          } else {
+            ++it;
+          }
+        }
+      }
+      checksum += parameters.to_string().size();
+    }
+    return checksum;
+  });
+
+  auto url_ns = bench::time_operations(iterations / 10, test_queries.size(), [&filter] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_queries) {
+      auto url = skyr::url("https://example.com/path?" + input + "#top");
+      url.remove_query_parameters(filter);
+      checksum += url.href().size();
+    }
+    return checksum;
+  });
+
+  std::cout << "\n=================================================\n";
+  std::cout << "Query Filter Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Test queries: " << test_queries.size() << "\n";
+  std::cout << "  Names:        " << names.size() << "\n";
+  std::cout << "  Prefixes:     " << prefixes.size() << "\n";
+  std::cout << "  Iterations:   " << iterations << "\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  query_filter::compile:          " << compile_ns << " ns/filter\n";
+  std::cout << "  query_filter::apply:            " << filter_ns << " ns/query\n";
+  std::cout << "  url_search_parameters::remove:  " << parameters_ns << " ns/query\n";
+  std::cout << "  url + remove_query_parameters:  " << url_ns << " ns/query\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
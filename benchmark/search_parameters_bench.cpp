@@ -0,0 +1,139 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <skyr/url.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// Times an operation on fresh copies of a set of parameters, so that the
+// index, if there is one, is built once per copy. The copies are made
+// before timing
+template <class Fn>
+auto time_on_copies(std::size_t iterations, const skyr::url_search_parameters& source, Fn&& operation) -> double {
+  constexpr auto batch_size = std::size_t{500};
+
+  auto checksum = std::size_t{0};
+  auto duration_ns = 0.0;
+  for (std::size_t i = 0; i < iterations; i += batch_size) {
+    auto copies = std::vector<skyr::url_search_parameters>(batch_size, source);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (auto& parameters : copies) {
+      checksum += operation(parameters);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    duration_ns += std::chrono::duration<double, std::nano>(end - start).count();
+  }
+
+  // Force use of checksum to prevent dead code elimination
+  bench::checksum_sink = checksum;
+
+  auto batches = (iterations + batch_size - 1) / batch_size;
+  return duration_ns / static_cast<double>(batches * batch_size);
+}
+
+// Parameters of a tracking URL: a handful of well-known names, then
+// generated ones
+auto make_parameters(std::size_t count) -> std::vector<skyr::query_parameter> {
+  const auto names =
+      std::vector<std::string>{"utm_source", "utm_medium", "utm_campaign", "utm_term", "gclid", "fbclid"};
+
+  auto parameters = std::vector<skyr::query_parameter>{};
+  for (auto i = 0UL; i < count; ++i) {
+    auto name = (i < names.size()) ? names[i] : "field_" + std::to_string(i * 7919 % 1000);
+    parameters.emplace_back(std::move(name), "value_" + std::to_string(i));
+  }
+  return parameters;
+}
+
+// Names to look up: half of them are present
+auto make_keys(const std::vector<skyr::query_parameter>& parameters, std::size_t count) -> std::vector<std::string> {
+  auto keys = std::vector<std::string>{};
+  for (auto i = 0UL; i < count; ++i) {
+    if ((i % 2) == 0) {
+      keys.push_back(parameters[(i * 31) % parameters.size()].name);
+    } else {
+      keys.push_back("missing_" + std::to_string(i));
+    }
+  }
+  return keys;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 20'000, "number of times to look up the keys in each set");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  std::cout << "\n=================================================\n";
+  std::cout << "Search Parameters Lookup Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Iterations: " << iterations << "\n\n";
+
+  std::cout << "Performance (ns per set of parameters):\n";
+  std::cout << "  parameters  lookups      linear             get\n";
+  std::cout << std::fixed << std::setprecision(1);
+
+  for (auto count : {4UL, 8UL, 16UL, 32UL, 64UL, 128UL, 256UL}) {
+    const auto source = skyr::url_search_parameters(make_parameters(count));
+
+    for (auto lookups : {1UL, 4UL, 8UL, 16UL, 64UL}) {
+      const auto keys = make_keys(make_parameters(count), lookups);
+
+      auto linear_ns = time_on_copies(iterations, source, [&keys](const auto& parameters) {
+        auto checksum = std::size_t{0};
+        for (const auto& key : keys) {
+          auto it = std::find_if(parameters.begin(), parameters.end(),
+                                 [&key](const auto& parameter) { return parameter.name == key; });
+          auto value = (it != parameters.end()) ? it->value : std::nullopt;
+          checksum += value ? value->size() : 0;
+        }
+        return checksum;
+      });
+
+      auto lookup_ns = time_on_copies(iterations, source, [&keys](const auto& parameters) {
+        auto checksum = std::size_t{0};
+        for (const auto& key : keys) {
+          auto value = parameters.get(key);
+          checksum += value ? value->size() : 0;
+        }
+        return checksum;
+      });
+
+      std::cout << "  " << std::setw(10) << count << "  " << std::setw(7) << lookups << "  " << std::setw(10)
+                << linear_ns << "  " << std::setw(15) << lookup_ns << "\n";
+    }
+  }
+
+  std::cout << "\nPerformance (ns per query, parsed and iterated):\n";
+  std::cout << "  parameters       parse\n";
+
+  for (auto count : {4UL, 16UL, 64UL, 256UL}) {
+    const auto query = skyr::url_search_parameters(make_parameters(count)).to_string() + "&encoded=%E4%BE%8B";
+
+    auto parse_ns = bench::time_operations(iterations / 10, [&query] {
+      auto checksum = std::size_t{0};
+      for (auto [name, value] : skyr::url_search_parameters(query)) {
+        checksum += name.size() + (value ? value->size() : 0);
+      }
+      return checksum;
+    });
+    std::cout << "  " << std::setw(10) << count << "  " << std::setw(10) << parse_ns << "\n";
+  }
+
+  std::cout << "\n=================================================\n";
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <skyr/unicode/ranges/transforms/u8_transform.hpp>
+#include <skyr/unicode/ranges/views/u16_view.hpp>
+#include <skyr/unicode/transcode.hpp>
+#include <skyr/url.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// URLs as UTF-16 strings, as they arrive from Windows APIs and JavaScript
+// bridges; mostly ASCII, with some internationalized hosts and paths
+const std::vector<std::u16string> test_urls = {
+    u"https://www.example.com/",
+    u"https://www.example.com/path/to/resource.html?query=value&other=1#section",
+    u"http://localhost:8080/api/v1/users/12345/profile",
+    u"https://cdn.example.net/assets/scripts/application.bundle.min.js?v=20240315",
+    u"https://example.com/search?q=caf\u00e9+cr\u00e8me+br\u00fbl\u00e9e&lang=fr",
+    u"https://b\u00fccher.example/katalog/\u00fcbersicht",
+    u"https://\u4f8b\u3048.\u30c6\u30b9\u30c8/\u30d1\u30b9/\u30da\u30fc\u30b8",
+    u"https://example.com/emoji/\U0001F363/\U0001F37A?tag=\U0001F600",
+    u"file:///C:/Users/Public/Documents/Report%202024.docx",
+    u"https://api.example.com/v2/orders?status=shipped&limit=50&offset=100&sort=-created_at",
+    u"https://\u043f\u0440\u0438\u043c\u0435\u0440.\u0440\u0444/\u0441\u0442\u0440\u0430\u043d\u0438\u0446\u0430",
+    u"https://example.com/a/very/long/path/with/many/segments/that/is/entirely/ascii/index.html",
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 100'000, "number of times to process all test URLs");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  auto total_units = std::size_t{0};
+  for (const auto& input : test_urls) {
+    total_units += input.size();
+  }
+
+  auto transcode_ns = bench::time_operations(iterations, test_urls.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_urls) {
+      checksum += skyr::unicode::to_utf8(input).value().size();
+    }
+    return checksum;
+  });
+
+  auto pipeline_ns = bench::time_operations(iterations / 10, test_urls.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_urls) {
+      auto bytes = skyr::unicode::as<std::string>(skyr::unicode::views::as_u16(input) |
+                                                  skyr::unicode::transforms::to_u8);
+      checksum += bytes.value().size();
+    }
+    return checksum;
+  });
+
+  auto url_ns = bench::time_operations(iterations / 10, test_urls.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_urls) {
+      checksum += skyr::make_url(input).value().href().size();
+    }
+    return checksum;
+  });
+
+  auto average_units = static_cast<double>(total_units) / static_cast<double>(test_urls.size());
+  auto throughput = [average_units](double ns) { return average_units * 2 * 1000.0 / ns; };
+
+  std::cout << "\n=================================================\n";
+  std::cout << "UTF-16 URL Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Test URLs:  " << test_urls.size() << "\n";
+  std::cout << "  Iterations: " << iterations << "\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  unicode::to_utf8:           " << transcode_ns << " ns/URL (" << throughput(transcode_ns)
+            << " MB/s)\n";
+  std::cout << "  as_u16 | to_u8 pipeline:    " << pipeline_ns << " ns/URL (" << throughput(pipeline_ns)
+            << " MB/s)\n";
+  std::cout << "  make_url (UTF-16 input):    " << url_ns << " ns/URL\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <skyr/domain/domain.hpp>
+#include <skyr/unicode/ranges/transforms/u32_transform.hpp>
+#include <skyr/unicode/ranges/views/u8_view.hpp>
+#include <skyr/unicode/transcode.hpp>
+
+#include "bench_common.hpp"
+
+namespace {
+// Host names as they reach the domain pipeline after percent decoding;
+// mostly ASCII, with some internationalized labels
+const std::vector<std::string> test_domains = {
+    "www.example.com",
+    "cdn.example.net",
+    "api.v2.services.internal.example.org",
+    "localhost",
+    "b\xc3\xbc" "cher.example",
+    "\xe4\xbe\x8b\xe3\x81\x88.\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88",
+    "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80.\xd1\x80\xd1\x84",
+    "a-very-long-subdomain-name-for-testing.static.assets.example.com",
+    "xn--nxasmq6b.example",
+    "m\xc3\xbcnchen.de",
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto parsed = bench::parse_iterations(argc, argv, 100'000, "number of times to process all test domains");
+  if (!parsed) {
+    return 1;
+  }
+  auto iterations = parsed.value();
+
+  auto decode_ns = bench::time_operations(iterations, test_domains.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_domains) {
+      checksum += skyr::unicode::to_utf32(input).value().size();
+    }
+    return checksum;
+  });
+
+  auto pipeline_ns = bench::time_operations(iterations / 10, test_domains.size(), [] {
+    auto checksum = std::size_t{0};
+    for (const auto& input : test_domains) {
+      auto code_points = skyr::unicode::as<std::u32string>(skyr::unicode::views::as_u8(input) |
+                                                           skyr::unicode::transforms::to_u32);
+      checksum += code_points.value().size();
+    }
+    return checksum;
+  });
+
+  auto domain_ns = bench::time_operations(iterations / 10, test_domains.size(), [] {
+    auto checksum = std::size_t{0};
+    auto ascii_domain = std::string{};
+    for (const auto& input : test_domains) {
+      ascii_domain.clear();
+      if (skyr::domain_to_ascii(input, &ascii_domain)) {
+        checksum += ascii_domain.size();
+      }
+    }
+    return checksum;
+  });
+
+  std::cout << "\n=================================================\n";
+  std::cout << "UTF-8 Domain Decoding Benchmark Results\n";
+  std::cout << "=================================================\n\n";
+
+  std::cout << "Configuration:\n";
+  std::cout << "  Test domains: " << test_domains.size() << "\n";
+  std::cout << "  Iterations:   " << iterations << "\n\n";
+
+  std::cout << "Performance:\n";
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "  unicode::to_utf32:          " << decode_ns << " ns/domain\n";
+  std::cout << "  as_u8 | to_u32 pipeline:    " << pipeline_ns << " ns/domain\n";
+  std::cout << "  domain_to_ascii:            " << domain_ns << " ns/domain\n\n";
+
+  std::cout << "=================================================\n";
+
+  return 0;
+}
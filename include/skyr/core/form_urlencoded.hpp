@@ -0,0 +1,318 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_CORE_FORM_URLENCODED_HPP
+#define SKYR_CORE_FORM_URLENCODED_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <skyr/percent_encoding/encode_set.hpp>
+#include <skyr/percent_encoding/errors.hpp>
+#include <skyr/percent_encoding/percent_decode.hpp>
+
+namespace skyr {
+namespace details {
+/// Replaces each invalid UTF-8 sequence in a string with U+FFFD, as the
+/// [UTF-8 decoder](https://encoding.spec.whatwg.org/#utf-8-decoder) does
+/// when it isn't fatal. Valid strings aren't changed
+inline void replace_invalid_utf8(std::string* input) {
+  constexpr auto replacement = std::string_view("\xef\xbf\xbd");
+
+  auto validator = percent_encoding::details::utf8_validator{};
+  auto is_valid = [&validator](char byte) { return validator.next(static_cast<std::uint8_t>(byte)); };
+  if (std::ranges::all_of(*input, is_valid) && validator.complete()) {
+    return;
+  }
+
+  auto output = std::string{};
+  output.reserve(input->size() + replacement.size());
+  validator = {};
+  auto sequence = std::size_t{0};
+  for (auto i = std::size_t{0}; i < input->size();) {
+    auto in_sequence = !validator.complete();
+    if (!in_sequence) {
+      sequence = i;
+    }
+
+    if (!validator.next(static_cast<std::uint8_t>((*input)[i]))) {
+      /// A byte that ends a sequence early is the start of the next one
+      output.append(replacement);
+      validator = {};
+      i += in_sequence ? 0 : 1;
+      continue;
+    }
+
+    ++i;
+    if (validator.complete()) {
+      output.append(*input, sequence, i - sequence);
+    }
+  }
+  if (!validator.complete()) {
+    output.append(replacement);
+  }
+  *input = std::move(output);
+}
+}  // namespace details
+
+/// Decodes an
+/// [application/x-www-form-urlencoded](https://url.spec.whatwg.org/#concept-urlencoded-parser)
+/// body that arrives in chunks, such as a POST body read from a socket.
+///
+/// Each name and value is decoded as its bytes arrive: `+` becomes a space,
+/// percent encoded bytes are decoded, and a `%` that isn't followed by two
+/// hex digits is kept. When a parameter is complete, invalid UTF-8 is
+/// replaced with U+FFFD and the callback is called with the name and value.
+/// Only the parameter being decoded is held, so memory is bounded by
+/// `max_pair_size` however long the body is.
+///
+/// ```
+/// auto decoder = skyr::form_decoder{};
+/// auto print = [](std::string_view name, std::string_view value) { std::cout << name << ": " << value << "\n"; };
+/// while (auto chunk = read_chunk()) {
+///   decoder.feed(chunk.value(), print);
+/// }
+/// decoder.finish(print);
+/// ```
+class form_decoder {
+ public:
+  /// The default limit on the decoded size of a name and value
+  static constexpr auto default_max_pair_size = std::size_t{1} << 20;
+
+  /// Constructor
+  /// \param max_pair_size The limit on the decoded size of a name and value
+  explicit form_decoder(std::size_t max_pair_size = default_max_pair_size) : max_pair_size_(max_pair_size) {
+  }
+
+  /// Decodes a chunk of the body
+  ///
+  /// \param chunk The next chunk
+  /// \param callback Called as `callback(name, value)` for each parameter
+  ///        that is complete; the views are valid until it returns
+  /// \returns An `overflow` error if a name and value are larger than
+  ///          `max_pair_size`, after which the decoder must be `reset()`
+  template <class Callback>
+    requires std::invocable<Callback&, std::string_view, std::string_view>
+  auto feed(std::string_view chunk, Callback&& callback) -> std::expected<void, percent_encoding::percent_encode_errc> {
+    static constexpr auto special = percent_encoding::byte_set::of("&=+%");
+
+    auto first = chunk.data(), last = chunk.data() + chunk.size();
+    if (escape_size_ != 0) {
+      first = decode_escape(first, last);
+    }
+
+    while (first != last) {
+      auto run_last = std::find_if(first, last, [](char byte) { return special.contains(byte); });
+      if (run_last != first) {
+        /// The run is checked before it's appended, so that a large chunk
+        /// without separators doesn't grow the name or value past the limit
+        auto size = name_.size() + value_.size();
+        if ((size > max_pair_size_) || (static_cast<std::size_t>(run_last - first) > (max_pair_size_ - size))) {
+          return std::unexpected(percent_encoding::percent_encode_errc::overflow);
+        }
+        started_ = true;
+        target().append(first, run_last);
+      }
+      first = run_last;
+      if (first == last) {
+        break;
+      }
+
+      switch (*first++) {
+        case '&':
+          emit(callback);
+          break;
+        case '=':
+          started_ = true;
+          if (in_value_) {
+            value_.push_back('=');
+          }
+          in_value_ = true;
+          break;
+        case '+':
+          started_ = true;
+          target().push_back(' ');
+          break;
+        default:
+          started_ = true;
+          escape_[0] = '%';
+          escape_size_ = 1;
+          first = decode_escape(first, last);
+          break;
+      }
+
+      if ((name_.size() + value_.size()) > max_pair_size_) {
+        return std::unexpected(percent_encoding::percent_encode_errc::overflow);
+      }
+    }
+
+    if ((name_.size() + value_.size()) > max_pair_size_) {
+      return std::unexpected(percent_encoding::percent_encode_errc::overflow);
+    }
+    return {};
+  }
+
+  /// Decodes the end of the body, and resets the decoder
+  ///
+  /// \param callback Called as `callback(name, value)` for the last
+  ///        parameter, if there is one
+  template <class Callback>
+    requires std::invocable<Callback&, std::string_view, std::string_view>
+  void finish(Callback&& callback) {
+    target().append(escape_.data(), escape_size_);
+    escape_size_ = 0;
+    emit(callback);
+  }
+
+  /// Discards the parameter being decoded
+  void reset() noexcept {
+    name_.clear();
+    value_.clear();
+    escape_size_ = 0;
+    in_value_ = false;
+    started_ = false;
+  }
+
+ private:
+  auto target() noexcept -> std::string& {
+    return in_value_ ? value_ : name_;
+  }
+
+  /// Completes a percent encoded byte that starts with the bytes in
+  /// `escape_`. If the chunk ends before it is complete, the bytes are kept
+  /// for the next chunk
+  /// \returns A pointer past the bytes that were used
+  auto decode_escape(const char* first, const char* last) -> const char* {
+    using percent_encoding::details::hex_value;
+
+    while ((escape_size_ < escape_.size()) && (first != last) && (hex_value(*first) <= 0xf)) {
+      escape_[escape_size_++] = *first++;
+    }
+
+    if (escape_size_ == escape_.size()) {
+      target().push_back(static_cast<char>((hex_value(escape_[1]) << 4) | hex_value(escape_[2])));
+      escape_size_ = 0;
+    } else if (first != last) {
+      target().append(escape_.data(), escape_size_);
+      escape_size_ = 0;
+    }
+    return first;
+  }
+
+  template <class Callback>
+  void emit(Callback& callback) {
+    if (started_) {
+      details::replace_invalid_utf8(&name_);
+      details::replace_invalid_utf8(&value_);
+      callback(std::string_view(name_), std::string_view(value_));
+    }
+    reset();
+  }
+
+  std::size_t max_pair_size_;
+  std::string name_;
+  std::string value_;
+  std::array<char, 3> escape_{};
+  std::size_t escape_size_ = 0;
+  bool in_value_ = false;
+  bool started_ = false;
+};
+
+/// Encodes name-value pairs as an
+/// [application/x-www-form-urlencoded](https://url.spec.whatwg.org/#concept-urlencoded-serializer)
+/// string, writing them to an output iterator
+///
+/// \tparam OutputIterator An output iterator of `char`
+template <std::output_iterator<char> OutputIterator>
+class form_encoder {
+ public:
+  /// Constructor
+  /// \param out The output iterator
+  explicit form_encoder(OutputIterator out) : out_(std::move(out)) {
+  }
+
+  /// Writes a name-value pair, after an `&` if it isn't the first
+  /// \param name The name
+  /// \param value The value
+  /// \returns A reference to this encoder
+  auto append(std::string_view name, std::string_view value) -> form_encoder& {
+    if (!empty_) {
+      *out_++ = '&';
+    }
+    empty_ = false;
+    encode(name);
+    *out_++ = '=';
+    encode(value);
+    return *this;
+  }
+
+  /// \returns The output iterator, past the bytes written
+  [[nodiscard]] auto out() const -> OutputIterator {
+    return out_;
+  }
+
+ private:
+  /// Copies runs of bytes that don't need encoding in one go
+  void encode(std::string_view input) {
+    constexpr auto hex_digits = std::string_view("0123456789ABCDEF");
+    static constexpr auto encoded = percent_encoding::encode_sets::application_x_www_form_urlencoded;
+
+    auto first = std::cbegin(input), last = std::cend(input);
+    while (first != last) {
+      auto run_last = std::find_if(first, last, [](char byte) { return encoded.contains(byte); });
+      out_ = std::ranges::copy(first, run_last, std::move(out_)).out;
+      for (first = run_last; (first != last) && encoded.contains(*first); ++first) {
+        auto value = static_cast<unsigned char>(*first);
+        if (value == ' ') {
+          *out_++ = '+';
+        } else {
+          *out_++ = '%';
+          *out_++ = hex_digits[value >> 4];
+          *out_++ = hex_digits[value & 0x0fu];
+        }
+      }
+    }
+  }
+
+  OutputIterator out_;
+  bool empty_ = true;
+};
+
+/// Encodes a range of name-value pairs as an
+/// [application/x-www-form-urlencoded](https://url.spec.whatwg.org/#concept-urlencoded-serializer)
+/// string
+///
+/// \param parameters A range of pairs, such as `url_search_parameters` or a
+///        `std::vector<std::pair<std::string, std::string>>`. Values that
+///        are a `std::optional` are encoded as empty if they are empty
+/// \param out An output iterator of `char`
+/// \returns The output iterator, past the bytes written
+template <std::ranges::input_range Parameters, std::output_iterator<char> OutputIterator>
+auto form_encode(Parameters&& parameters, OutputIterator out) -> OutputIterator {
+  constexpr auto as_string_view = [](const auto& value) -> std::string_view {
+    if constexpr (requires { value.has_value(); }) {
+      return value ? std::string_view(value.value()) : std::string_view{};
+    } else {
+      return std::string_view(value);
+    }
+  };
+
+  auto encoder = form_encoder<OutputIterator>(std::move(out));
+  for (auto&& [name, value] : parameters) {
+    encoder.append(as_string_view(name), as_string_view(value));
+  }
+  return encoder.out();
+}
+}  // namespace skyr
+
+#endif  // SKYR_CORE_FORM_URLENCODED_HPP
@@ -7,6 +7,7 @@
 #define SKYR_CORE_HOST_HPP
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <expected>
 #include <ranges>
@@ -18,6 +19,7 @@
 #include <skyr/network/ipv4_address.hpp>
 #include <skyr/network/ipv6_address.hpp>
 #include <skyr/percent_encoding/percent_decode.hpp>
+#include <skyr/percent_encoding/percent_encode.hpp>
 #include <skyr/percent_encoding/percent_encoded_char.hpp>
 
 namespace skyr {
@@ -64,26 +66,52 @@ class host {
   constexpr explicit host(empty_host host) : host_(host) {
   }
 
-  ///
-  /// \return The host as a string
-  [[nodiscard]] auto serialize() const {
-    constexpr static auto serialize = [](auto&& host) -> std::string {
+  /// The size of a buffer for `serialize_view`, which is large enough for
+  /// a bracketed IPv6 address
+  static constexpr auto max_serialized_address_size = ipv6_address::max_serialized_size + 2;
+
+  /// Serializes the host without allocating. IP addresses are serialized to
+  /// a buffer, and domain names and opaque hosts are viewed as they are
+  /// stored
+  /// \param buffer The buffer that IP addresses are serialized to
+  /// \return The serialized host, valid while the host and the buffer are
+  [[nodiscard]] auto serialize_view(std::array<char, max_serialized_address_size>& buffer) const
+      -> std::string_view {
+    auto serialize = [&buffer](auto&& host) -> std::string_view {
       using T = std::decay_t<decltype(host)>;
 
       if constexpr (std::is_same_v<T, ipv4_address>) {
-        return host.serialize();
+        return std::string_view(buffer.data(), host.serialize_to(buffer.data()));
       } else if constexpr (std::is_same_v<T, ipv6_address>) {
-        return std::format("[{}]", host.serialize());
+        buffer[0] = '[';
+        auto last = host.serialize_to(buffer.data() + 1);
+        *last++ = ']';
+        return std::string_view(buffer.data(), last);
       } else if constexpr (std::is_same_v<T, domain_name> || std::is_same_v<T, opaque_host>) {
         return host.name;
       } else {
-        return std::string();
+        return std::string_view();
       }
     };
 
     return std::visit(serialize, host_);
   }
 
+  /// Appends the serialized host to a string, without creating a temporary
+  /// \param output The output string
+  auto serialize_to(std::string* output) const -> void {
+    auto buffer = std::array<char, max_serialized_address_size>{};
+    output->append(serialize_view(buffer));
+  }
+
+  ///
+  /// \return The host as a string
+  [[nodiscard]] auto serialize() const -> std::string {
+    auto output = std::string{};
+    serialize_to(&output);
+    return output;
+  }
+
   ///
   /// \return \c true if the host is a domain, \c false otherwise
   [[nodiscard]] constexpr auto is_domain_name() const noexcept {
@@ -153,10 +181,6 @@ inline auto parse_opaque_host(std::string_view input, bool* validation_error)
     -> std::expected<opaque_host, url_parse_errc> {
   constexpr auto is_forbidden = [](auto byte) -> bool { return (byte != '%') && is_forbidden_host_point(byte); };
 
-  constexpr auto pct_encode = [](auto c) {
-    return percent_encode_byte(std::byte(c), percent_encoding::encode_set::c0_control).to_string();
-  };
-
   auto it = std::ranges::find_if(input, is_forbidden);
   if (it != std::cend(input)) {
     *validation_error |= true;
@@ -164,9 +188,7 @@ inline auto parse_opaque_host(std::string_view input, bool* validation_error)
   }
 
   std::string result;
-  for (auto c : input) {
-    result += pct_encode(c);
-  }
+  percent_encoding::percent_encode_append<percent_encoding::encode_sets::c0_control>(input, &result);
   return opaque_host{std::move(result)};
 }
 }  // namespace details
@@ -0,0 +1,161 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_CORE_HOST_POOL_HPP
+#define SKYR_CORE_HOST_POOL_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <skyr/core/host.hpp>
+
+namespace skyr {
+/// A host name stored in a `host_pool`
+struct interned_host {
+  /// The ID of the host name, unique in its pool
+  std::uint32_t id;
+  /// The host name, which remains valid for the lifetime of the pool
+  std::string_view name;
+
+  /// Host names in the same pool are equal if their IDs are equal
+  constexpr auto operator==(const interned_host& other) const noexcept -> bool {
+    return id == other.id;
+  }
+};
+
+/// An optional, thread-safe table of host names. Each distinct name is
+/// stored once and given a 32-bit ID, so that hosts can be compared by
+/// comparing IDs, and an application that keeps many URLs can keep the ID
+/// of each URL's host in place of a copy of its name. `url_record` still
+/// stores its own `host`.
+///
+/// IDs are allocated contiguously from 0, in the order that names are first
+/// interned. Names are never removed, and the views returned by the pool
+/// remain valid until the pool is destroyed.
+class host_pool {
+ public:
+  /// Constructor
+  host_pool() = default;
+
+  host_pool(const host_pool&) = delete;
+  host_pool& operator=(const host_pool&) = delete;
+
+  /// Interns a host name
+  /// \param name A host name, as serialized by `host::serialize`
+  /// \returns The ID and the stored host name
+  auto intern(std::string_view name) -> interned_host {
+    {
+      auto lock = std::shared_lock(mutex_);
+      if (auto it = ids_.find(name); it != ids_.end()) {
+        return interned_host{it->second, it->first};
+      }
+    }
+
+    auto lock = std::unique_lock(mutex_);
+    /// Another thread may have interned the name between the two locks
+    if (auto it = ids_.find(name); it != ids_.end()) {
+      return interned_host{it->second, it->first};
+    }
+
+    assert(names_.size() < std::numeric_limits<std::uint32_t>::max());
+    auto id = static_cast<std::uint32_t>(names_.size());
+    auto stored = store(name);
+    names_.push_back(stored);
+    ids_.emplace(stored, id);
+    return interned_host{id, stored};
+  }
+
+  /// Interns the serialized form of a host, without creating a temporary
+  /// \param input A host
+  /// \returns The ID and the stored host name
+  auto intern(const host& input) -> interned_host {
+    auto buffer = std::array<char, host::max_serialized_address_size>{};
+    return intern(input.serialize_view(buffer));
+  }
+
+  /// Parses and interns a host, according to
+  /// https://url.spec.whatwg.org/#host-parsing
+  /// \param input An input string
+  /// \param is_not_special \c true to process only non-special hosts, \c false otherwise
+  /// \param validation_error Set to \c true if there was a validation error
+  /// \returns The ID and the stored host name, or an error code
+  auto parse_and_intern(std::string_view input, bool is_not_special, bool* validation_error)
+      -> std::expected<interned_host, url_parse_errc> {
+    return parse_host(input, is_not_special, validation_error).transform([this](const host& parsed) {
+      return intern(parsed);
+    });
+  }
+
+  /// Finds a host name without interning it
+  /// \param name A host name
+  /// \returns The ID and the stored host name, or `std::nullopt` if the name
+  ///          hasn't been interned
+  [[nodiscard]] auto find(std::string_view name) const -> std::optional<interned_host> {
+    auto lock = std::shared_lock(mutex_);
+    if (auto it = ids_.find(name); it != ids_.end()) {
+      return interned_host{it->second, it->first};
+    }
+    return std::nullopt;
+  }
+
+  /// \param id An ID returned by this pool
+  /// \returns The host name with this ID
+  [[nodiscard]] auto name(std::uint32_t id) const -> std::string_view {
+    auto lock = std::shared_lock(mutex_);
+    assert(id < names_.size());
+    return names_[id];
+  }
+
+  /// \returns The number of distinct host names in the pool
+  [[nodiscard]] auto size() const -> std::size_t {
+    auto lock = std::shared_lock(mutex_);
+    return names_.size();
+  }
+
+ private:
+  /// Names are copied into blocks, so that they are never moved. Names that
+  /// are longer than a block get a block of their own
+  static constexpr auto block_size = std::size_t{64 * 1024};
+
+  auto store(std::string_view name) -> std::string_view {
+    if (name.empty()) {
+      return std::string_view();
+    }
+
+    if (name.size() > block_capacity_ - block_used_) {
+      block_capacity_ = std::max(block_size, name.size());
+      blocks_.push_back(std::make_unique<char[]>(block_capacity_));
+      block_used_ = 0;
+    }
+
+    auto first = blocks_.back().get() + block_used_;
+    std::memcpy(first, name.data(), name.size());
+    block_used_ += name.size();
+    return std::string_view(first, name.size());
+  }
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string_view, std::uint32_t> ids_;
+  std::vector<std::string_view> names_;
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  std::size_t block_capacity_ = 0;
+  std::size_t block_used_ = 0;
+};
+}  // namespace skyr
+
+#endif  // SKYR_CORE_HOST_POOL_HPP
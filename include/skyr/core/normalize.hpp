@@ -0,0 +1,280 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_CORE_NORMALIZE_HPP
+#define SKYR_CORE_NORMALIZE_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skyr/core/schemes.hpp>
+#include <skyr/core/url_record.hpp>
+#include <skyr/percent_encoding/encode_set.hpp>
+#include <skyr/percent_encoding/percent_decode.hpp>
+
+namespace skyr {
+/// \enum normalize_flags
+/// Normalizations applied by `normalize`, on top of those already applied
+/// by the WhatWG URL parser. Flags are combined using `|`.
+enum class normalize_flags : unsigned int {
+  /// Serialize the URL as it is
+  none = 0,
+  /// Uppercase the hexadecimal digits in percent encoded bytes, e.g. `%2f`
+  /// becomes `%2F`
+  uppercase_percent_encoding = 1U << 0U,
+  /// Decode percent encoded unreserved characters (`A-Z a-z 0-9 - . _ ~`),
+  /// e.g. `%7Euser` becomes `~user`
+  decode_unreserved = 1U << 1U,
+  /// Remove the port if it is the default port for the scheme
+  remove_default_port = 1U << 2U,
+  /// Stable sort query parameters by name, and remove empty parameters
+  sort_query = 1U << 3U,
+  /// Remove the fragment
+  remove_fragment = 1U << 4U,
+  /// Remove the `?` if the query is empty
+  remove_empty_query = 1U << 5U,
+  /// The normalizations commonly used to build cache keys
+  cache_key = 0b111111U,
+};
+
+/// \returns The union of two sets of flags
+constexpr inline auto operator|(normalize_flags lhs, normalize_flags rhs) noexcept -> normalize_flags {
+  return static_cast<normalize_flags>(static_cast<unsigned int>(lhs) | static_cast<unsigned int>(rhs));
+}
+
+/// \returns The intersection of two sets of flags
+constexpr inline auto operator&(normalize_flags lhs, normalize_flags rhs) noexcept -> normalize_flags {
+  return static_cast<normalize_flags>(static_cast<unsigned int>(lhs) & static_cast<unsigned int>(rhs));
+}
+
+namespace details {
+constexpr inline auto has_flag(normalize_flags flags, normalize_flags flag) noexcept -> bool {
+  return (flags & flag) != normalize_flags::none;
+}
+
+/// Copies `input` to `out`, normalizing percent encoded bytes. A `%` that
+/// isn't followed by two hexadecimal digits is copied as it is. The output
+/// is never longer than the input, so `out` may point to the start of the
+/// input to normalize in place.
+/// \returns A pointer past the last character written
+inline auto normalize_percent_encoded(std::string_view input, char* out, normalize_flags flags) noexcept -> char* {
+  constexpr auto hex_digits = std::string_view("0123456789ABCDEF");
+  constexpr auto unreserved = ~percent_encoding::encode_sets::rfc3986;
+
+  auto uppercase = has_flag(flags, normalize_flags::uppercase_percent_encoding);
+  auto decode = has_flag(flags, normalize_flags::decode_unreserved);
+
+  auto first = input.data(), last = input.data() + input.size();
+  while (first != last) {
+    auto percent = static_cast<const char*>(std::memchr(first, '%', static_cast<std::size_t>(last - first)));
+    auto run_last = (percent != nullptr) ? percent : last;
+    if (out != first) {
+      std::memmove(out, first, static_cast<std::size_t>(run_last - first));
+    }
+    out += run_last - first;
+    first = run_last;
+    if (first == last) {
+      break;
+    }
+
+    auto high = 0x10U, low = 0x10U;
+    if ((last - first) >= 3) {
+      high = percent_encoding::details::hex_value(first[1]);
+      low = percent_encoding::details::hex_value(first[2]);
+    }
+
+    if ((high | low) > 0xfU) {
+      *out++ = *first++;
+    } else if (auto byte = static_cast<unsigned char>((high << 4U) | low); decode && unreserved.contains(byte)) {
+      *out++ = static_cast<char>(byte);
+      first += 3;
+    } else {
+      out[0] = '%';
+      out[1] = uppercase ? hex_digits[high] : first[1];
+      out[2] = uppercase ? hex_digits[low] : first[2];
+      out += 3;
+      first += 3;
+    }
+  }
+  return out;
+}
+
+constexpr inline auto normalizes_percent_encoding(normalize_flags flags) noexcept -> bool {
+  return has_flag(flags, normalize_flags::uppercase_percent_encoding | normalize_flags::decode_unreserved);
+}
+
+/// Appends `input` to `output`, normalizing percent encoded bytes
+inline auto append_normalized(std::string_view input, normalize_flags flags, std::string* output) -> void {
+  if (!normalizes_percent_encoding(flags) || (input.find('%') == std::string_view::npos)) {
+    output->append(input);
+    return;
+  }
+
+  auto offset = output->size();
+  output->resize(offset + input.size());
+  auto last = normalize_percent_encoded(input, output->data() + offset, flags);
+  output->resize(static_cast<std::size_t>(last - output->data()));
+}
+
+/// Normalizes percent encoded bytes in `output`, in place, from `offset`
+inline auto normalize_in_place(std::size_t offset, normalize_flags flags, std::string* output) -> void {
+  if (normalizes_percent_encoding(flags)) {
+    auto input = std::string_view(*output).substr(offset);
+    auto last = normalize_percent_encoded(input, output->data() + offset, flags);
+    output->resize(static_cast<std::size_t>(last - output->data()));
+  }
+}
+
+constexpr inline auto query_parameter_name(std::string_view parameter) noexcept -> std::string_view {
+  return parameter.substr(0, parameter.find('='));
+}
+
+/// Sorts the query parameters that start at `offset` in `output`. The
+/// query is only rewritten if it isn't already sorted, or has empty
+/// parameters.
+inline auto sort_query(std::size_t offset, std::string* output) -> void {
+  auto query = std::string_view(*output).substr(offset);
+
+  auto sorted = true;
+  auto previous = std::string_view{};
+  for (auto first = 0UL; sorted && (first <= query.size());) {
+    auto last = std::min(query.find('&', first), query.size());
+    auto parameter = query.substr(first, last - first);
+    sorted = !parameter.empty() && ((first == 0) || (query_parameter_name(parameter) >= previous));
+    previous = query_parameter_name(parameter);
+    first = last + 1;
+  }
+  if (sorted || query.empty()) {
+    return;
+  }
+
+  auto copy = std::string(query);
+  auto parameters = std::vector<std::string_view>{};
+  for (auto first = 0UL; first <= copy.size();) {
+    auto last = std::min(copy.find('&', first), copy.size());
+    if (last != first) {
+      parameters.emplace_back(std::string_view(copy).substr(first, last - first));
+    }
+    first = last + 1;
+  }
+  std::ranges::stable_sort(parameters, std::less<>{}, query_parameter_name);
+
+  output->resize(offset);
+  for (auto it = std::cbegin(parameters); it != std::cend(parameters); ++it) {
+    if (it != std::cbegin(parameters)) {
+      output->push_back('&');
+    }
+    output->append(*it);
+  }
+}
+
+/// \returns An estimate of the length of the normalized URL, which is an
+///          upper bound unless the host is a long domain name
+inline auto normalized_size(const url_record& url) noexcept -> std::size_t {
+  constexpr auto max_port_size = std::size_t{6};
+  constexpr auto max_address_size = ipv6_address::max_serialized_size + 2;
+
+  auto size = url.scheme.size() + 3 + url.username.size() + url.password.size() + 2 + max_address_size + max_port_size;
+  for (const auto& segment : url.path) {
+    size += segment.size() + 1;
+  }
+  size += url.query ? url.query.value().size() + 1 : 0;
+  size += url.fragment ? url.fragment.value().size() + 1 : 0;
+  return size;
+}
+}  // namespace details
+
+/// Serializes a URL record to `output`, applying the normalizations in
+/// `flags` as each component is written. The contents of `output` are
+/// replaced, but its capacity is kept, so one string can be reused as the
+/// buffer for many URLs.
+///
+/// With `normalize_flags::none`, the output is the same as `serialize(url)`.
+///
+/// \param url A URL record
+/// \param flags The normalizations to apply
+/// \param output The output buffer
+inline auto normalize(const url_record& url, normalize_flags flags, std::string* output) -> void {
+  output->clear();
+  output->reserve(details::normalized_size(url));
+
+  output->append(url.scheme);
+  output->push_back(':');
+
+  if (url.host) {
+    output->append("//");
+    if (url.includes_credentials()) {
+      details::append_normalized(url.username, flags, output);
+      if (!url.password.empty()) {
+        output->push_back(':');
+        details::append_normalized(url.password, flags, output);
+      }
+      output->push_back('@');
+    }
+
+    auto host_offset = output->size();
+    url.host.value().serialize_to(output);
+    if (url.host.value().is_opaque_host()) {
+      details::normalize_in_place(host_offset, flags, output);
+    }
+
+    if (url.port && !(details::has_flag(flags, normalize_flags::remove_default_port) &&
+                      (url.port == default_port(url.scheme)))) {
+      auto buffer = std::array<char, 6>{};
+      buffer[0] = ':';
+      auto [last, ec] = std::to_chars(buffer.data() + 1, buffer.data() + buffer.size(), url.port.value());
+      output->append(buffer.data(), last);
+    }
+  } else if (url.scheme == "file") {
+    output->append("//");
+  }
+
+  if (url.cannot_be_a_base_url) {
+    details::append_normalized(url.path.front(), flags, output);
+  } else {
+    for (const auto& segment : url.path) {
+      output->push_back('/');
+      details::append_normalized(segment, flags, output);
+    }
+  }
+
+  if (url.query && !(details::has_flag(flags, normalize_flags::remove_empty_query) && url.query.value().empty())) {
+    output->push_back('?');
+    auto query_offset = output->size();
+    details::append_normalized(url.query.value(), flags, output);
+    if (details::has_flag(flags, normalize_flags::sort_query)) {
+      details::sort_query(query_offset, output);
+      if ((output->size() == query_offset) && details::has_flag(flags, normalize_flags::remove_empty_query)) {
+        output->pop_back();
+      }
+    }
+  }
+
+  if (url.fragment && !details::has_flag(flags, normalize_flags::remove_fragment)) {
+    output->push_back('#');
+    details::append_normalized(url.fragment.value(), flags, output);
+  }
+}
+
+/// Serializes a URL record, applying the normalizations in `flags`
+///
+/// \param url A URL record
+/// \param flags The normalizations to apply
+/// \returns The normalized URL string
+inline auto normalize(const url_record& url, normalize_flags flags = normalize_flags::cache_key)
+    -> url_record::string_type {
+  auto output = url_record::string_type{};
+  normalize(url, flags, &output);
+  return output;
+}
+}  // namespace skyr
+
+#endif  // SKYR_CORE_NORMALIZE_HPP
@@ -6,8 +6,11 @@
 #ifndef SKYR_CORE_PARSE_HPP
 #define SKYR_CORE_PARSE_HPP
 
+#include <algorithm>
 #include <expected>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <system_error>
 
 #include <skyr/core/check_input.hpp>
@@ -21,19 +24,20 @@ inline auto basic_parse(std::string_view input, bool* validation_error, const ur
                         std::optional<url_parse_state> state_override) -> std::expected<url_record, url_parse_errc> {
   // Remove leading/trailing C0 controls and spaces, and remove all tabs/newlines
   // according to WhatWG spec - this applies to ALL input including setters
-  std::string cleaned_input;
-  std::string_view input_view;
-
   if (!state_override.has_value()) {
     input = remove_leading_c0_control_or_space(input, validation_error);
     input = remove_trailing_c0_control_or_space(input, validation_error);
   }
 
-  // Always remove tabs and newlines from input (even for setters)
-  cleaned_input = remove_tabs_and_newlines(input, validation_error);
-  input_view = cleaned_input;
+  // Always remove tabs and newlines from input (even for setters), but only
+  // copy the input if it contains any
+  auto cleaned_input = std::string{};
+  if (std::ranges::any_of(input, is_tab_or_newline)) {
+    cleaned_input = remove_tabs_and_newlines(input, validation_error);
+    input = cleaned_input;
+  }
 
-  auto context = url_parser_context(input_view, validation_error, base, url, state_override);
+  auto context = url_parser_context(input, validation_error, base, url, state_override);
   while (true) {
     auto action = context.parse_next();
     if (!action) {
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include <skyr/core/parse.hpp>
+#include <skyr/core/query_view.hpp>
 
 namespace skyr {
 ///
@@ -31,6 +32,12 @@ struct query_parameter {
   /// \param value The parameter value
   query_parameter(std::string name, std::string value) : name(std::move(name)), value(std::move(value)) {
   }
+
+  /// Constructor
+  /// \param parameter A view of a parameter, whose name and value are copied
+  explicit query_parameter(const query_parameter_view& parameter)
+      : name(parameter.name), value(parameter.value.transform([](auto value) { return std::string(value); })) {
+  }
 };
 
 ///
@@ -0,0 +1,212 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_CORE_QUERY_FILTER_HPP
+#define SKYR_CORE_QUERY_FILTER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skyr/core/url_record.hpp>
+#include <skyr/percent_encoding/percent_decode.hpp>
+
+namespace skyr {
+/// A set of query parameter names and name prefixes, compiled once and used
+/// to remove parameters, such as tracking parameters, from many queries.
+///
+/// Exact names are kept in a hash table. Prefixes are kept sorted, without
+/// those that start with another prefix, so that the only prefix that can
+/// match a name is the greatest one that isn't greater than it. A filter
+/// has no mutating member functions, so once compiled it can be shared
+/// between threads without synchronization.
+///
+/// Names are matched after percent decoding.
+///
+/// ```
+/// const auto filter = skyr::query_filter::compile({"fbclid", "gclid"}, {"utm_"});
+/// auto url = skyr::url("https://example.com/?id=42&utm_source=mail&gclid=abc");
+/// url.remove_query_parameters(filter);
+/// assert(url.href() == "https://example.com/?id=42");
+/// ```
+class query_filter {
+ public:
+  /// Constructs a filter that matches no names
+  query_filter() = default;
+
+  /// Compiles a filter
+  /// \param names A range of parameter names to match exactly
+  /// \param prefixes A range of parameter name prefixes
+  /// \returns The filter
+  template <class Names, class Prefixes>
+    requires std::ranges::input_range<Names> && std::ranges::input_range<Prefixes>
+  static auto compile(Names&& names, Prefixes&& prefixes) -> query_filter {
+    auto filter = query_filter{};
+
+    for (auto&& prefix : prefixes) {
+      filter.prefixes_.emplace_back(std::string_view(prefix));
+    }
+    /// Once sorted, the prefixes that start with another prefix follow it
+    std::ranges::sort(filter.prefixes_);
+    auto kept = std::begin(filter.prefixes_);
+    for (auto it = kept; it != std::end(filter.prefixes_); ++it) {
+      if ((kept == std::begin(filter.prefixes_)) || !it->starts_with(*std::prev(kept))) {
+        if (kept != it) {
+          *kept = std::move(*it);
+        }
+        ++kept;
+      }
+    }
+    filter.prefixes_.erase(kept, std::end(filter.prefixes_));
+
+    for (auto&& name : names) {
+      auto view = std::string_view(name);
+      if (!filter.matches_prefix(view)) {
+        filter.names_.emplace_back(view);
+      }
+    }
+    std::ranges::sort(filter.names_);
+    auto duplicates = std::ranges::unique(filter.names_);
+    filter.names_.erase(std::begin(duplicates), std::end(duplicates));
+
+    filter.slots_.assign(std::bit_ceil(2 * filter.names_.size()), npos);
+    for (auto i = 0U; i < filter.names_.size(); ++i) {
+      filter.slots_[filter.find_slot(filter.names_[i])] = i;
+    }
+    return filter;
+  }
+
+  /// Compiles a filter
+  /// \param names A list of parameter names to match exactly
+  /// \param prefixes A list of parameter name prefixes
+  /// \returns The filter
+  static auto compile(std::initializer_list<std::string_view> names,
+                      std::initializer_list<std::string_view> prefixes = {}) -> query_filter {
+    return compile(std::span(names), std::span(prefixes));
+  }
+
+  /// \param name A parameter name, percent decoded
+  /// \returns `true` if the name is matched by the filter
+  [[nodiscard]] auto matches(std::string_view name) const noexcept -> bool {
+    return (!slots_.empty() && (slots_[find_slot(name)] != npos)) || matches_prefix(name);
+  }
+
+  /// Removes the parameters that match the filter from a query, in place.
+  /// The query is scanned up to the first parameter to remove, and only
+  /// then compacted, matching each of the remaining parameters once. The
+  /// parameters that are kept, and the separators before them, are
+  /// unchanged. If any parameter is removed, empty parameters are removed
+  /// too.
+  ///
+  /// \param query A query, without a leading `?`
+  /// \returns `true` if any parameter was removed, `false` if the query is
+  ///          unchanged
+  auto apply(std::string* query) const -> bool {
+    constexpr auto is_separator = [](char byte) { return (byte == '&') || (byte == ';'); };
+
+    auto decoded_name = std::string{};
+    auto is_removed = [this, &decoded_name](std::string_view parameter) {
+      auto name = parameter.substr(0, parameter.find('='));
+      if (name.find('%') != std::string_view::npos) {
+        decoded_name.assign(name);
+        if (auto length = percent_decode_in_place(decoded_name); length) {
+          name = std::string_view(decoded_name.data(), length.value());
+        }
+      }
+      return matches(name);
+    };
+
+    auto first = query->data(), last = query->data() + query->size();
+    auto next = [last](char* separator) { return (separator != last) ? std::next(separator) : last; };
+
+    /// Nothing is written unless a parameter is removed
+    auto removed = last;
+    for (auto it = first; it != last;) {
+      auto separator = std::find_if(it, last, is_separator);
+      auto parameter = std::string_view(it, separator);
+      if (!parameter.empty() && is_removed(parameter)) {
+        removed = it;
+        break;
+      }
+      it = next(separator);
+    }
+
+    if (removed == last) {
+      return false;
+    }
+
+    /// Each parameter that is kept is moved down, with the separator before
+    /// it, except for the first. Parameters before the first one that is
+    /// removed are already known to be kept
+    auto out = first;
+    for (auto it = first; it != last;) {
+      auto separator = std::find_if(it, last, is_separator);
+      auto parameter = std::string_view(it, separator);
+      if (!parameter.empty() && ((it < removed) || ((it > removed) && !is_removed(parameter)))) {
+        if (out != first) {
+          *out++ = *std::prev(it);
+        }
+        out = std::ranges::copy(parameter, out).out;
+      }
+      it = next(separator);
+    }
+
+    query->resize(static_cast<std::size_t>(out - first));
+    return true;
+  }
+
+  /// Removes the parameters that match the filter from a URL's query
+  ///
+  /// \param url A URL record
+  /// \returns `true` if any parameter was removed. If they all were, the
+  ///          URL no longer has a query
+  auto apply(url_record* url) const -> bool {
+    if (!url->query || !apply(&url->query.value())) {
+      return false;
+    }
+    if (url->query.value().empty()) {
+      url->query = std::nullopt;
+    }
+    return true;
+  }
+
+  /// \returns `true` if the filter matches no names
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return names_.empty() && prefixes_.empty();
+  }
+
+ private:
+  static constexpr auto npos = ~std::uint32_t{0};
+
+  [[nodiscard]] auto matches_prefix(std::string_view name) const noexcept -> bool {
+    auto it = std::ranges::upper_bound(prefixes_, name, std::less<std::string_view>{});
+    return (it != std::cbegin(prefixes_)) && name.starts_with(*std::prev(it));
+  }
+
+  /// \returns The slot that holds the name, or an empty slot
+  [[nodiscard]] auto find_slot(std::string_view name) const noexcept -> std::size_t {
+    auto mask = slots_.size() - 1;
+    auto slot = std::hash<std::string_view>{}(name) & mask;
+    while ((slots_[slot] != npos) && (names_[slots_[slot]] != name)) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  std::vector<std::string> names_;
+  std::vector<std::string> prefixes_;
+  std::vector<std::uint32_t> slots_;
+};
+}  // namespace skyr
+
+#endif  // SKYR_CORE_QUERY_FILTER_HPP
@@ -0,0 +1,274 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_CORE_QUERY_VIEW_HPP
+#define SKYR_CORE_QUERY_VIEW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include <skyr/percent_encoding/percent_decode.hpp>
+
+namespace skyr {
+/// A query parameter whose name and value refer to a query string
+struct query_parameter_view {
+  /// The parameter name
+  std::string_view name;
+  /// The parameter value, if the parameter has an `=`
+  std::optional<std::string_view> value;
+
+  friend constexpr auto operator==(const query_parameter_view&, const query_parameter_view&) -> bool = default;
+};
+
+/// A range of the parameters in a query string, which splits the query as
+/// it is iterated and doesn't allocate.
+///
+/// The query should already be normalized, for example `url_record::query`.
+/// Parameters are separated by `&` or `;`, and empty parameters are skipped.
+/// Names and values are as they appear in the query, without percent
+/// decoding; use `decoded()` to decode them.
+///
+/// ```
+/// auto url = skyr::url("https://example.com/?utm_source=mail&id=42");
+/// for (auto [name, value] : skyr::query_view(url.record().query.value())) {
+///   ...
+/// }
+/// ```
+class query_view : public std::ranges::view_interface<query_view> {
+ public:
+  /// An iterator through the parameters
+  class iterator {
+   public:
+    ///
+    using iterator_concept = std::forward_iterator_tag;
+    ///
+    using iterator_category = std::input_iterator_tag;
+    ///
+    using value_type = query_parameter_view;
+    ///
+    using reference = value_type;
+    ///
+    using difference_type = std::ptrdiff_t;
+
+    /// Constructs an end iterator
+    constexpr iterator() = default;
+
+    /// \param query The query string
+    constexpr explicit iterator(std::string_view query) : remainder_(query) {
+      next();
+    }
+
+    ///
+    /// \return
+    constexpr auto operator++() noexcept -> iterator& {
+      next();
+      return *this;
+    }
+
+    ///
+    /// \return
+    constexpr auto operator++(int) noexcept -> iterator {
+      auto result = *this;
+      next();
+      return result;
+    }
+
+    /// \returns The current parameter
+    [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+      auto delim = parameter_.find('=');
+      if (delim == std::string_view::npos) {
+        return {parameter_, std::nullopt};
+      }
+      return {parameter_.substr(0, delim), parameter_.substr(delim + 1)};
+    }
+
+    ///
+    /// \param other
+    /// \return
+    [[nodiscard]] constexpr auto operator==(const iterator& other) const noexcept -> bool {
+      return (parameter_.data() == other.parameter_.data()) && (parameter_.size() == other.parameter_.size());
+    }
+
+   private:
+    constexpr void next() noexcept {
+      constexpr auto is_separator = [](char byte) { return (byte == '&') || (byte == ';'); };
+
+      while (!remainder_.empty()) {
+        auto length = static_cast<std::size_t>(std::ranges::find_if(remainder_, is_separator) - remainder_.begin());
+        parameter_ = remainder_.substr(0, length);
+        remainder_.remove_prefix(std::min(length + 1, remainder_.size()));
+        if (!parameter_.empty()) {
+          return;
+        }
+      }
+      parameter_ = std::string_view{};
+    }
+
+    std::string_view remainder_;
+    std::string_view parameter_;
+  };
+
+  class decoded_view;
+
+  /// An alias to `iterator`
+  using const_iterator = iterator;
+
+  /// Constructs an empty query
+  constexpr query_view() = default;
+
+  /// \param query The query string. A leading `?` is ignored
+  constexpr explicit query_view(std::string_view query) : query_(query) {
+    if (!query_.empty() && (query_.front() == '?')) {
+      query_.remove_prefix(1);
+    }
+  }
+
+  /// \returns An iterator to the first parameter
+  [[nodiscard]] constexpr auto begin() const noexcept -> iterator {
+    return iterator(query_);
+  }
+
+  /// \returns An iterator past the last parameter
+  [[nodiscard]] constexpr auto end() const noexcept -> iterator {
+    return iterator();
+  }
+
+  /// \param name The parameter name, as it appears in the query
+  /// \returns The value of the first parameter with the given name, or an
+  ///          empty string if it has no value
+  [[nodiscard]] constexpr auto get(std::string_view name) const noexcept -> std::optional<std::string_view> {
+    auto it = std::ranges::find(*this, name, &query_parameter_view::name);
+    if (it == end()) {
+      return std::nullopt;
+    }
+    return (*it).value.value_or(std::string_view{});
+  }
+
+  /// \param name The parameter name, as it appears in the query
+  /// \returns `true` if there is a parameter with the given name
+  [[nodiscard]] constexpr auto contains(std::string_view name) const noexcept -> bool {
+    return std::ranges::find(*this, name, &query_parameter_view::name) != end();
+  }
+
+  /// \returns A range of the parameters with their names and values
+  ///          percent decoded
+  [[nodiscard]] auto decoded() const -> decoded_view;
+
+  /// \returns The query string, without a leading `?`
+  [[nodiscard]] constexpr auto query() const noexcept -> std::string_view {
+    return query_;
+  }
+
+ private:
+  std::string_view query_;
+};
+
+/// A single pass range of the parameters in a query string, with their names
+/// and values percent decoded.
+///
+/// Names and values that contain no `%` refer to the query string. Others are
+/// decoded into buffers held by the iterator, which are reused for each
+/// parameter, and are valid until the iterator is incremented. Names and
+/// values that can't be decoded are kept as they are.
+class query_view::decoded_view : public std::ranges::view_interface<query_view::decoded_view> {
+ public:
+  /// An iterator through the decoded parameters
+  class iterator {
+   public:
+    ///
+    using iterator_concept = std::input_iterator_tag;
+    ///
+    using value_type = query_parameter_view;
+    ///
+    using reference = value_type;
+    ///
+    using difference_type = std::ptrdiff_t;
+
+    ///
+    iterator() = default;
+
+    /// \param it An iterator through the encoded parameters
+    explicit iterator(query_view::iterator it) : it_(it) {
+    }
+
+    ///
+    /// \return
+    auto operator++() noexcept -> iterator& {
+      ++it_;
+      return *this;
+    }
+
+    ///
+    void operator++(int) noexcept {
+      ++it_;
+    }
+
+    /// \returns The current parameter, decoded
+    [[nodiscard]] auto operator*() const -> reference {
+      auto [name, value] = *it_;
+      return {decode(name, &name_), value ? std::optional(decode(value.value(), &value_)) : std::nullopt};
+    }
+
+    ///
+    /// \return
+    [[nodiscard]] auto operator==(std::default_sentinel_t) const noexcept -> bool {
+      return it_ == query_view::iterator();
+    }
+
+   private:
+    static auto decode(std::string_view input, std::string* buffer) -> std::string_view {
+      if (input.find('%') == std::string_view::npos) {
+        return input;
+      }
+
+      buffer->assign(input);
+      auto length = percent_decode_in_place(std::span<char>(buffer->data(), buffer->size()));
+      if (!length) {
+        return input;
+      }
+      return std::string_view(buffer->data(), length.value());
+    }
+
+    query_view::iterator it_;
+    mutable std::string name_;
+    mutable std::string value_;
+  };
+
+  ///
+  decoded_view() = default;
+
+  /// \param parameters The encoded parameters
+  explicit decoded_view(query_view parameters) : parameters_(parameters) {
+  }
+
+  /// \returns An iterator to the first parameter
+  [[nodiscard]] auto begin() const -> iterator {
+    return iterator(parameters_.begin());
+  }
+
+  /// \returns The end of the range
+  [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t {
+    return std::default_sentinel;
+  }
+
+ private:
+  query_view parameters_;
+};
+
+inline auto query_view::decoded() const -> decoded_view {
+  return decoded_view(*this);
+}
+}  // namespace skyr
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<skyr::query_view> = true;
+
+#endif  // SKYR_CORE_QUERY_VIEW_HPP
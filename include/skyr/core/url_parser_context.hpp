@@ -21,6 +21,7 @@
 #include <skyr/core/url_parse_state.hpp>
 #include <skyr/core/url_record.hpp>
 #include <skyr/domain/domain.hpp>
+#include <skyr/percent_encoding/percent_encode.hpp>
 #include <skyr/percent_encoding/percent_encoded_char.hpp>
 
 namespace skyr {
@@ -418,10 +419,7 @@ class url_parser_context {
         // append to password. Otherwise, parse normally as username:password.
         if (!url.password.empty()) {
           url.password += "%40";
-          for (auto c : buffer) {
-            auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-            url.password += pct_encoded.to_string();
-          }
+          percent_encoding::percent_encode_append<percent_encoding::encode_sets::userinfo>(buffer, &url.password);
           buffer.clear();
         } else {
           buffer.insert(0, "%40");
@@ -724,7 +722,7 @@ class url_parser_context {
         *validation_error |= true;
       }
 
-      auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::path);
+      auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_sets::path);
       buffer += pct_encoded.to_string();
     }
 
@@ -796,19 +794,15 @@ class url_parser_context {
   }
 
   void set_credentials_from_buffer() {
-    auto password_token_seen_flag = false;
-    for (auto c : buffer) {
-      if ((c == ':') && !password_token_seen_flag) {
-        password_token_seen_flag = true;
-        continue;
-      }
-
-      auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-      if (password_token_seen_flag) {
-        url.password += pct_encoded.to_string();
-      } else {
-        url.username += pct_encoded.to_string();
-      }
+    /// The first ':' separates the username from the password, and any
+    /// others are part of the password
+    constexpr auto encode = percent_encoding::percent_encode_append<percent_encoding::encode_sets::userinfo>;
+
+    auto credentials = std::string_view(buffer);
+    auto password_token = credentials.find(':');
+    encode(credentials.substr(0, password_token), &url.username);
+    if (password_token != std::string_view::npos) {
+      encode(credentials.substr(password_token + 1), &url.password);
     }
   }
 
@@ -888,7 +882,7 @@ class url_parser_context {
   }
 
   void append_to_path0(char byte) {
-    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::c0_control);
+    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_sets::c0_control);
     url.path[0] += pct_encoded.to_string();
   }
 
@@ -920,7 +914,7 @@ class url_parser_context {
     if (!url.query) {
       set_empty_query();
     }
-    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::any);
+    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_sets::any);
     url.query.value() += std::move(pct_encoded).to_string();
   }
 
@@ -939,7 +933,7 @@ class url_parser_context {
     if (!url.fragment) {
       set_empty_fragment();
     }
-    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_set::fragment);
+    auto pct_encoded = percent_encode_byte(std::byte(byte), percent_encoding::encode_sets::fragment);
     url.fragment.value() += pct_encoded.to_string();
   }
 };
@@ -7,24 +7,184 @@
 #define SKYR_DOMAIN_DOMAIN_HPP
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <expected>
+#include <initializer_list>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 
 #include <skyr/domain/errors.hpp>
 #include <skyr/domain/idna.hpp>
 #include <skyr/domain/punycode.hpp>
-#include <skyr/unicode/ranges/transforms/u32_transform.hpp>
+#include <skyr/unicode/normalization.hpp>
 #include <skyr/unicode/ranges/transforms/u8_transform.hpp>
-#include <skyr/unicode/ranges/views/u8_view.hpp>
+#include <skyr/unicode/transcode.hpp>
 
 namespace skyr {
+namespace details {
+constexpr auto bidi_class_set(std::initializer_list<idna::bidi_class> classes) -> std::uint32_t {
+  auto set = std::uint32_t{0};
+  for (auto cls : classes) {
+    set |= std::uint32_t{1} << static_cast<std::uint32_t>(cls);
+  }
+  return set;
+}
+
+constexpr auto in_bidi_class_set(std::uint32_t set, idna::bidi_class cls) -> bool {
+  return (set & (std::uint32_t{1} << static_cast<std::uint32_t>(cls))) != 0;
+}
+
+/// The Bidi_Class properties of a label that the Bidi Rule depends on, and
+/// whether it has a joiner that the ContextJ rules apply to, collected in
+/// one pass over the label
+struct bidi_label_classes {
+  /// The class of the first code point
+  idna::bidi_class first = idna::bidi_class::l;
+  /// The class of the last code point that isn't NSM
+  idna::bidi_class last = idna::bidi_class::l;
+  /// The set of classes of the code points
+  std::uint32_t classes = 0;
+  /// `true` if the label may have a ZERO WIDTH JOINER or ZERO WIDTH
+  /// NON-JOINER, which are both BN
+  bool has_joiner = false;
+};
+
+/// \param label A label
+/// \return The Bidi_Class properties of the label
+constexpr auto classify_bidi_label(std::u32string_view label) -> bidi_label_classes {
+  auto result = bidi_label_classes{};
+  if (label.empty()) {
+    return result;
+  }
+
+  result.first = idna::code_point_bidi_class(label.front());
+  for (auto cp : label) {
+    auto cls = idna::code_point_bidi_class(cp);
+    result.classes |= std::uint32_t{1} << static_cast<std::uint32_t>(cls);
+    if (cls != idna::bidi_class::nsm) {
+      result.last = cls;
+    }
+  }
+  result.has_joiner = (result.classes & (std::uint32_t{1} << static_cast<std::uint32_t>(idna::bidi_class::bn))) != 0;
+  return result;
+}
+
+/// \param label The Bidi_Class properties of a label
+/// \return `true` if the label contains a code point with the Bidi_Class R, AL or AN
+constexpr auto is_rtl_label(const bidi_label_classes& label) -> bool {
+  using enum idna::bidi_class;
+  constexpr auto rtl = bidi_class_set({r, al, an});
+
+  return (label.classes & rtl) != 0;
+}
+
+/// \param label A label
+/// \return `true` if the label contains a code point with the Bidi_Class R, AL or AN
+constexpr auto is_rtl_label(std::u32string_view label) -> bool {
+  return is_rtl_label(classify_bidi_label(label));
+}
+
+/// https://www.rfc-editor.org/rfc/rfc5893#section-2
+///
+/// \param label The Bidi_Class properties of a label
+/// \return `true` if the label satisfies the Bidi Rule
+constexpr auto satisfies_bidi_rule(const bidi_label_classes& label) -> bool {
+  using enum idna::bidi_class;
+  constexpr auto ltr_allowed = bidi_class_set({l, en, es, cs, et, on, bn, nsm});
+  constexpr auto ltr_last = bidi_class_set({l, en});
+  constexpr auto rtl_allowed = bidi_class_set({r, al, an, en, es, cs, et, on, bn, nsm});
+  constexpr auto rtl_last = bidi_class_set({r, al, en, an});
+
+  if (label.classes == 0) {
+    return true;
+  }
+
+  /// Rule 1
+  if ((label.first != l) && (label.first != r) && (label.first != al)) {
+    return false;
+  }
+
+  /// Rules 2 and 5
+  auto is_rtl = (label.first != l);
+  if ((label.classes & ~(is_rtl ? rtl_allowed : ltr_allowed)) != 0) {
+    return false;
+  }
+
+  /// Rules 3 and 6
+  if (!in_bidi_class_set(is_rtl ? rtl_last : ltr_last, label.last)) {
+    return false;
+  }
+
+  /// Rule 4
+  return !(is_rtl && in_bidi_class_set(label.classes, en) && in_bidi_class_set(label.classes, an));
+}
+
+/// https://www.rfc-editor.org/rfc/rfc5893#section-2
+///
+/// \param label A label
+/// \return `true` if the label satisfies the Bidi Rule
+constexpr auto satisfies_bidi_rule(std::u32string_view label) -> bool {
+  return satisfies_bidi_rule(classify_bidi_label(label));
+}
+
+/// https://www.rfc-editor.org/rfc/rfc5892#appendix-A.1
+///
+/// \param label A label
+/// \return `true` if every ZERO WIDTH JOINER and ZERO WIDTH NON-JOINER in the label
+///         satisfies the ContextJ rules
+constexpr auto satisfies_contextj_rules(std::u32string_view label) -> bool {
+  constexpr auto zwnj = U'\x200c';
+  constexpr auto zwj = U'\x200d';
+  constexpr auto is_joiner = [](auto cp) { return (cp == zwnj) || (cp == zwj); };
+  constexpr auto is_transparent = [](auto cp) {
+    return idna::code_point_joining_type(cp) == idna::joining_type::t;
+  };
+
+  for (auto it = std::ranges::find_if(label, is_joiner); it != std::cend(label);
+       it = std::find_if(it + 1, std::cend(label), is_joiner)) {
+    if ((it != std::cbegin(label)) && idna::is_virama(*(it - 1))) {
+      continue;
+    }
+
+    if (*it == zwj) {
+      return false;
+    }
+
+    /// (Joining_Type:{L,D})(Joining_Type:T)*\u200C(Joining_Type:T)*(Joining_Type:{R,D})
+    auto before = std::find_if_not(std::make_reverse_iterator(it), std::crend(label), is_transparent);
+    if (before == std::crend(label)) {
+      return false;
+    }
+    auto before_type = idna::code_point_joining_type(*before);
+    if ((before_type != idna::joining_type::l) && (before_type != idna::joining_type::d)) {
+      return false;
+    }
+
+    auto after = std::find_if_not(it + 1, std::cend(label), is_transparent);
+    if (after == std::cend(label)) {
+      return false;
+    }
+    auto after_type = idna::code_point_joining_type(*after);
+    if ((after_type != idna::joining_type::r) && (after_type != idna::joining_type::d)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace details
+
+/// Validates a label against the
+/// [UTS #46 validity criteria](https://www.unicode.org/reports/tr46/#Validity_Criteria).
+///
+/// The Bidi Rule only applies to labels in a Bidi domain name, so `check_bidi`
+/// should only be set when at least one label in the domain is an RTL label.
 constexpr inline auto validate_label(std::u32string_view label, [[maybe_unused]] bool use_std3_ascii_rules,
-                                     bool check_hyphens, [[maybe_unused]] bool check_bidi,
-                                     [[maybe_unused]] bool check_joiners, bool transitional_processing)
-    -> std::expected<void, domain_errc> {
+                                     bool check_hyphens, bool check_bidi, bool check_joiners,
+                                     bool transitional_processing) -> std::expected<void, domain_errc> {
   /// https://www.unicode.org/reports/tr46/#Validity_Criteria;
 
   if (check_hyphens) {
@@ -60,12 +220,25 @@ constexpr inline auto validate_label(std::u32string_view label, [[maybe_unused]]
     }
   }
 
+  /// Criterion 7
+  if (check_joiners && !details::satisfies_contextj_rules(label)) {
+    return std::unexpected(domain_errc::bad_input);
+  }
+
+  /// Criterion 8
+  if (check_bidi && !details::satisfies_bidi_rule(label)) {
+    return std::unexpected(domain_errc::bad_input);
+  }
+
   return {};
 }
 
 ///
 struct domain_to_ascii_context {
-  /// Stores the domain as UTF-32
+  /// The decoded domain, in the caller's buffer
+  std::u32string_view code_points;
+
+  /// Stores the domain as UTF-32, once it's mapped
   std::u32string domain_name;
 
   /// Parameters
@@ -85,6 +258,9 @@ struct domain_to_ascii_context {
 
 ///
 /// \param domain_name
+/// \param buffer The buffer the domain is decoded into, of at least
+///               `domain_name.size()` code points, which must outlive the
+///               context
 /// \param ascii_domain
 /// \param check_hyphens
 /// \param check_bidi
@@ -93,13 +269,15 @@ struct domain_to_ascii_context {
 /// \param transitional_processing
 /// \param verify_dns_length
 /// \return
-inline auto create_domain_to_ascii_context(std::string_view domain_name, std::string* ascii_domain, bool check_hyphens,
-                                           bool check_bidi, bool check_joiners, bool use_std3_ascii_rules,
-                                           bool transitional_processing, bool verify_dns_length)
+inline auto create_domain_to_ascii_context(std::string_view domain_name, std::span<char32_t> buffer,
+                                           std::string* ascii_domain, bool check_hyphens, bool check_bidi,
+                                           bool check_joiners, bool use_std3_ascii_rules, bool transitional_processing,
+                                           bool verify_dns_length)
     -> std::expected<domain_to_ascii_context, domain_errc> {
-  auto u32domain_name = unicode::as<std::u32string>(unicode::views::as_u8(domain_name) | unicode::transforms::to_u32);
-  if (u32domain_name) {
-    return domain_to_ascii_context{u32domain_name.value(),
+  auto length = unicode::to_utf32(domain_name, buffer);
+  if (length) {
+    return domain_to_ascii_context{std::u32string_view(buffer.data(), length.value()),
+                                   {},
                                    ascii_domain,
                                    check_hyphens,
                                    check_bidi,
@@ -121,11 +299,17 @@ inline auto create_domain_to_ascii_context(std::string_view domain_name, std::st
 inline auto domain_to_ascii_impl(domain_to_ascii_context&& context) -> std::expected<void, domain_errc> {
   /// https://www.unicode.org/reports/tr46/#ToASCII
 
+  /// The domain is mapped, then normalized to NFC. The normalization is
+  /// skipped if the mapped domain passes the NFC quick check
   constexpr auto map_domain_name =
       [](domain_to_ascii_context&& ctx) -> std::expected<domain_to_ascii_context, domain_errc> {
-    auto result = idna::map_code_points(ctx.domain_name, ctx.use_std3_ascii_rules, ctx.transitional_processing);
+    auto mapped = std::u32string{};
+    mapped.reserve(ctx.code_points.size());
+    auto result =
+        idna::map_code_points(ctx.code_points, &mapped, ctx.use_std3_ascii_rules, ctx.transitional_processing);
     if (result) {
-      ctx.domain_name.erase(result.value(), std::cend(ctx.domain_name));
+      unicode::normalize_nfc(&mapped);
+      ctx.domain_name = std::move(mapped);
       return std::move(ctx);
     } else {
       return std::unexpected(result.error());
@@ -140,36 +324,72 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context&& context) -> std::expe
       return std::u32string_view(std::addressof(*std::cbegin(label)), size);
     };
 
+    constexpr auto is_ascii = [](std::u32string_view input) noexcept {
+      constexpr auto is_in_ascii_set = [](auto c) { return c <= U'\x7e'; };
+
+      return std::ranges::cend(input) == std::ranges::find_if_not(input, is_in_ascii_set);
+    };
+
+    constexpr auto is_punycode = [](std::u32string_view input) noexcept {
+      return (input.size() >= 4) && (input.substr(0, 4) == U"xn--");
+    };
+
+    /// Each label that can contain right-to-left code points is classified
+    /// once, as it's processed, which tells whether the domain is a Bidi
+    /// domain name, whether the label satisfies the Bidi Rule, and whether it
+    /// has a joiner, so that the ContextJ rules don't need another pass over
+    /// labels without one. ASCII labels are only classified if the domain
+    /// turns out to be a Bidi domain name, from the labels that are already
+    /// split
+    auto is_bidi_domain = false;
+    auto satisfies_bidi_rule = true;
+    const auto check_bidi_label = [&ctx](std::u32string_view input, bool& is_bidi, bool& satisfies) {
+      auto classes = details::classify_bidi_label(input);
+      is_bidi |= details::is_rtl_label(classes);
+      satisfies &= details::satisfies_bidi_rule(classes);
+      return !ctx.check_joiners || !classes.has_joiner || details::satisfies_contextj_rules(input);
+    };
+
     for (auto&& label :
          ctx.domain_name | std::ranges::views::split(U'.') | std::ranges::views::transform(to_string_view)) {
-      if ((label.size() >= 4) && (label.substr(0, 4) == U"xn--")) {
+      auto label_is_ascii = is_ascii(label);
+
+      if (is_punycode(label)) {
         ctx.punycode_decoded.clear();
         auto decoded = punycode_decode(label.substr(4), &ctx.punycode_decoded);
         if (!decoded) {
           return std::unexpected(decoded.error());
         }
 
-        auto validated = validate_label(ctx.punycode_decoded, ctx.use_std3_ascii_rules, ctx.check_hyphens,
-                                        ctx.check_bidi, ctx.check_joiners, false);
+        /// Criterion 1
+        if (!unicode::is_nfc(ctx.punycode_decoded)) {
+          return std::unexpected(domain_errc::bad_input);
+        }
+
+        auto validated = validate_label(ctx.punycode_decoded, ctx.use_std3_ascii_rules, ctx.check_hyphens, false,
+                                        ctx.check_joiners && !ctx.check_bidi, false);
         if (!validated) {
           return std::unexpected(validated.error());
         }
+
+        if (ctx.check_bidi && !check_bidi_label(ctx.punycode_decoded, is_bidi_domain, satisfies_bidi_rule)) {
+          return std::unexpected(domain_errc::bad_input);
+        }
       } else {
-        auto validated = validate_label(label, ctx.use_std3_ascii_rules, ctx.check_hyphens, ctx.check_bidi,
-                                        ctx.check_joiners, ctx.transitional_processing);
+        auto validated = validate_label(label, ctx.use_std3_ascii_rules, ctx.check_hyphens, false,
+                                        ctx.check_joiners && !ctx.check_bidi && !label_is_ascii,
+                                        ctx.transitional_processing);
         if (!validated) {
           return std::unexpected(validated.error());
         }
-      }
-
-      constexpr auto is_ascii = [](std::u32string_view input) noexcept {
-        constexpr auto is_in_ascii_set = [](auto c) { return c <= U'\x7e'; };
 
-        return std::ranges::cend(input) == std::ranges::find_if_not(input, is_in_ascii_set);
-      };
+        if (ctx.check_bidi && !label_is_ascii && !check_bidi_label(label, is_bidi_domain, satisfies_bidi_rule)) {
+          return std::unexpected(domain_errc::bad_input);
+        }
+      }
 
       ctx.labels.emplace_back();
-      if (!is_ascii(label)) {
+      if (!label_is_ascii) {
         ctx.punycode_encoded.clear();
         auto result = punycode_encode(label, &ctx.punycode_encoded);
         if (!result) {
@@ -182,10 +402,24 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context&& context) -> std::expe
       }
     }
 
-    if (ctx.domain_name.back() == U'.') {
+    if (!ctx.domain_name.empty() && (ctx.domain_name.back() == U'.')) {
       ctx.labels.emplace_back();
     }
 
+    if (is_bidi_domain) {
+      if (!satisfies_bidi_rule) {
+        return std::unexpected(domain_errc::bad_input);
+      }
+
+      /// Labels that were encoded start with `xn--`, so those that don't are
+      /// the ASCII labels that haven't been classified
+      for (const auto& label : ctx.labels) {
+        if (!is_punycode(label) && !details::satisfies_bidi_rule(label)) {
+          return std::unexpected(domain_errc::bad_input);
+        }
+      }
+    }
+
     return std::move(ctx);
   };
 
@@ -236,9 +470,21 @@ inline auto domain_to_ascii_impl(domain_to_ascii_context&& context) -> std::expe
 inline auto domain_to_ascii(std::string_view domain_name, std::string* ascii_domain, bool check_hyphens,
                             bool check_bidi, bool check_joiners, bool use_std3_ascii_rules,
                             bool transitional_processing, bool verify_dns_length) -> std::expected<void, domain_errc> {
-  return create_domain_to_ascii_context(domain_name, ascii_domain, check_hyphens, check_bidi, check_joiners,
-                                        use_std3_ascii_rules, transitional_processing, verify_dns_length)
-      .and_then(domain_to_ascii_impl);
+  auto convert = [&](std::span<char32_t> buffer) {
+    return create_domain_to_ascii_context(domain_name, buffer, ascii_domain, check_hyphens, check_bidi, check_joiners,
+                                          use_std3_ascii_rules, transitional_processing, verify_dns_length)
+        .and_then(domain_to_ascii_impl);
+  };
+
+  /// Domains are decoded into a buffer on the stack, unless they're longer
+  /// than a DNS name can be
+  constexpr auto max_stack_size = std::size_t{256};
+  if (domain_name.size() <= max_stack_size) {
+    std::array<char32_t, max_stack_size> buffer;  // NOLINT
+    return convert(buffer);
+  }
+  auto buffer = std::u32string(domain_name.size(), U'\0');
+  return convert(buffer);
 }
 
 /// Converts a UTF-8 encoded domain to ASCII using
@@ -6,102 +6,171 @@
 #ifndef SKYR_DOMAIN_IDNA_HPP
 #define SKYR_DOMAIN_IDNA_HPP
 
+#include <algorithm>
+#include <cstdint>
 #include <expected>
+#include <iterator>
+#include <string>
+#include <string_view>
 
 #include <skyr/domain/errors.hpp>
+#include <skyr/domain/idna_context_tables.hpp>
 #include <skyr/domain/idna_tables.hpp>
-#include <skyr/unicode/traits/range_iterator.hpp>
 
 namespace skyr::idna {
+namespace details {
+/// The unpacked status and mapping of a range of code points
+struct code_point_range {
+  idna_status status;
+  std::uint8_t mapped_length;
+  std::uint16_t mapped_offset;
+};
+
+constexpr auto find_code_point_range(char32_t code_point) -> code_point_range {
+  if (code_point > U'\x10ffff') {
+    return code_point_range{idna_status::disallowed, 0, 0};
+  }
+
+  /// The range index narrows the search to the ranges that overlap the
+  /// code point's block, which is rarely more than a few
+  auto block = code_point >> range_block_shift;
+  auto first = std::cbegin(code_point_ranges) + range_index[block];
+  auto last = std::cbegin(code_point_ranges) + range_index[block + 1] + 1;
+  constexpr auto low_bits = (std::uint32_t{1} << range_first_shift) - 1;
+  auto key = (static_cast<std::uint32_t>(code_point) << range_first_shift) | low_bits;
+  auto it = std::prev(std::upper_bound(first, last, key));
+
+  auto range = *it;
+  return code_point_range{
+      static_cast<idna_status>(range & status_mask),
+      static_cast<std::uint8_t>((range >> mapped_length_shift) & mapped_length_mask),
+      mapped_offsets[static_cast<std::size_t>(std::distance(std::cbegin(code_point_ranges), it))]};
+}
+}  // namespace details
+
 ///
 /// \param code_point A code point value
 /// \return The status of the code point
 constexpr auto code_point_status(char32_t code_point) -> idna_status {
-  constexpr auto less = [](const auto& range, auto code_point) { return range.last < code_point; };
+  return details::find_code_point_range(code_point).status;
+}
 
-  auto first = std::cbegin(details::statuses), last = std::cend(details::statuses);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it == last) || !((code_point >= (*it).first) && (code_point <= (*it).last)) ? idna_status::valid : it->status;
+///
+/// \param code_point A code point value
+/// \return The code points that the code point is mapped to, if its status is
+///          mapped, disallowed_std3_mapped or deviation. This is empty for any
+///          other status
+constexpr auto code_point_mapping(char32_t code_point) -> std::u32string_view {
+  auto range = details::find_code_point_range(code_point);
+  return std::u32string_view(details::mapped_code_points.data() + range.mapped_offset, range.mapped_length);
 }
 
 namespace details {
-constexpr auto map_code_point_16(char16_t code_point) -> char16_t {
-  constexpr auto less = [](const auto& lhs, auto rhs) { return lhs.code_point < rhs; };
-
-  auto first = std::cbegin(mapped_16), last = std::cend(mapped_16);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it != last) ? it->mapped : code_point;
+constexpr auto code_point_properties(char32_t code_point) -> std::uint8_t {
+  if (code_point > U'\x10ffff') {
+    return 0;
+  }
+  constexpr auto block_mask = (char32_t{1} << properties_block_shift) - 1;
+  auto block = static_cast<std::size_t>(properties_index[code_point >> properties_block_shift]);
+  return properties_blocks[(block << properties_block_shift) | (code_point & block_mask)];
 }
 }  // namespace details
 
 ///
 /// \param code_point A code point value
-/// \return The code point or mapped value, depending on the status of the code
-/// point
-constexpr auto map_code_point(char32_t code_point) -> char32_t {
-  constexpr auto less = [](const auto& lhs, auto rhs) { return lhs.code_point < rhs; };
+/// \return The Bidi_Class of the code point
+constexpr auto code_point_bidi_class(char32_t code_point) -> bidi_class {
+  return static_cast<bidi_class>(details::code_point_properties(code_point) & details::bidi_class_mask);
+}
 
-  if (code_point <= U'\xffff') {
-    return static_cast<char32_t>(details::map_code_point_16(static_cast<char16_t>(code_point)));
-  }
+///
+/// \param code_point A code point value
+/// \return The Joining_Type of the code point
+constexpr auto code_point_joining_type(char32_t code_point) -> joining_type {
+  return static_cast<joining_type>(details::code_point_properties(code_point) >> details::joining_type_shift);
+}
 
-  auto first = std::cbegin(details::mapped_32), last = std::cend(details::mapped_32);
-  auto it = std::lower_bound(first, last, code_point, less);
-  return (it != last) ? it->mapped : code_point;
+///
+/// \param code_point A code point value
+/// \return `true` if the Canonical_Combining_Class of the code point is Virama
+constexpr auto is_virama(char32_t code_point) -> bool {
+  return std::binary_search(std::cbegin(details::viramas), std::cend(details::viramas), code_point);
 }
 
 ///
 /// \tparam FwdIter
 /// \param first
 /// \param last
+/// \param mapped The output buffer, which will contain the mapped code points
 /// \param use_std3_ascii_rules
 /// \param transitional_processing
 /// \return
 template <class FwdIter>
-inline auto map_code_points(FwdIter first, FwdIter last, bool use_std3_ascii_rules, bool transitional_processing)
-    -> std::expected<FwdIter, domain_errc> {
+inline auto map_code_points(FwdIter first, FwdIter last, std::u32string* mapped, bool use_std3_ascii_rules,
+                            bool transitional_processing) -> std::expected<void, domain_errc> {
+  constexpr auto is_ascii_valid = [](char32_t cp) {
+    return ((cp >= U'a') && (cp <= U'z')) || ((cp >= U'0') && (cp <= U'9')) || (cp == U'-') || (cp == U'.');
+  };
+
   for (auto it = first; it != last; ++it) {
-    switch (code_point_status(*it)) {
+    auto cp = static_cast<char32_t>(*it);
+
+    /// Most domains are lower case ASCII, so skip the table lookup
+    if (is_ascii_valid(cp)) {
+      mapped->push_back(cp);
+      continue;
+    } else if ((cp >= U'A') && (cp <= U'Z')) {
+      mapped->push_back(cp + (U'a' - U'A'));
+      continue;
+    }
+
+    auto range = details::find_code_point_range(cp);
+    auto mapping = [range]() {
+      return std::u32string_view(details::mapped_code_points.data() + range.mapped_offset, range.mapped_length);
+    };
+
+    switch (range.status) {
       case idna_status::disallowed:
         return std::unexpected(domain_errc::disallowed_code_point);
       case idna_status::disallowed_std3_valid:
         if (use_std3_ascii_rules) {
           return std::unexpected(domain_errc::disallowed_code_point);
         } else {
-          *first++ = *it;
+          mapped->push_back(cp);
         }
         break;
       case idna_status::disallowed_std3_mapped:
         if (use_std3_ascii_rules) {
           return std::unexpected(domain_errc::disallowed_code_point);
         } else {
-          *first++ = map_code_point(*it);
+          mapped->append(mapping());
         }
         break;
       case idna_status::ignored:
         break;
       case idna_status::mapped:
-        *first++ = idna::map_code_point(*it);
+        mapped->append(mapping());
         break;
       case idna_status::deviation:
         if (transitional_processing) {
-          *first++ = idna::map_code_point(*it);
+          mapped->append(mapping());
         } else {
-          *first++ = *it;
+          mapped->push_back(cp);
         }
         break;
       case idna_status::valid:
-        *first++ = *it;
+        mapped->push_back(cp);
         break;
     }
   }
-  return first;
+  return {};
 }
 
 template <class T>
-inline auto map_code_points(T& code_points, bool use_std3_ascii_rules, bool transitional_processing)
-    -> std::expected<typename unicode::traits::range_iterator_t<T>, domain_errc> {
-  return map_code_points(std::begin(code_points), std::end(code_points), use_std3_ascii_rules, transitional_processing);
+inline auto map_code_points(const T& code_points, std::u32string* mapped, bool use_std3_ascii_rules,
+                            bool transitional_processing) -> std::expected<void, domain_errc> {
+  return map_code_points(std::cbegin(code_points), std::cend(code_points), mapped, use_std3_ascii_rules,
+                         transitional_processing);
 }
 }  // namespace skyr::idna
 
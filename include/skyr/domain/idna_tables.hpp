@@ -6,8328 +6,2409 @@
 #ifndef SKYR_DOMAIN_IDNA_TABLES_HPP
 #define SKYR_DOMAIN_IDNA_TABLES_HPP
 
-#include <algorithm>
 #include <array>
-#include <iterator>
+#include <cstdint>
 
 #include <skyr/domain/idna_status.hpp>
 
 namespace skyr::idna::details {
-struct code_point_range {
-  char32_t first;
-  char32_t last;
-  idna_status status;
-};
+/// Every code point belongs to one range of code points with the same
+/// status. Each range is packed as
+///
+///   first code point << range_first_shift | mapped length << mapped_length_shift | status
+///
+/// If the code points are mapped, the mapping is `mapped length` code points
+/// from `mapped_offsets[i]` in `mapped_code_points`
+inline constexpr auto range_first_shift = 11;
+inline constexpr auto mapped_length_shift = 3;
+inline constexpr auto status_mask = std::uint32_t{0x7};
+inline constexpr auto mapped_length_mask = std::uint32_t{0xff};
 
-constexpr static auto statuses = std::array<code_point_range, 6794>{{
-    {U'\x0000', U'\x002c', idna_status::disallowed_std3_valid},
-    {U'\x002f', U'\x002f', idna_status::disallowed_std3_valid},
-    {U'\x003a', U'\x0040', idna_status::disallowed_std3_valid},
-    {U'\x0041', U'\x0041', idna_status::mapped},
-    {U'\x0042', U'\x0042', idna_status::mapped},
-    {U'\x0043', U'\x0043', idna_status::mapped},
-    {U'\x0044', U'\x0044', idna_status::mapped},
-    {U'\x0045', U'\x0045', idna_status::mapped},
-    {U'\x0046', U'\x0046', idna_status::mapped},
-    {U'\x0047', U'\x0047', idna_status::mapped},
-    {U'\x0048', U'\x0048', idna_status::mapped},
-    {U'\x0049', U'\x0049', idna_status::mapped},
-    {U'\x004a', U'\x004a', idna_status::mapped},
-    {U'\x004b', U'\x004b', idna_status::mapped},
-    {U'\x004c', U'\x004c', idna_status::mapped},
-    {U'\x004d', U'\x004d', idna_status::mapped},
-    {U'\x004e', U'\x004e', idna_status::mapped},
-    {U'\x004f', U'\x004f', idna_status::mapped},
-    {U'\x0050', U'\x0050', idna_status::mapped},
-    {U'\x0051', U'\x0051', idna_status::mapped},
-    {U'\x0052', U'\x0052', idna_status::mapped},
-    {U'\x0053', U'\x0053', idna_status::mapped},
-    {U'\x0054', U'\x0054', idna_status::mapped},
-    {U'\x0055', U'\x0055', idna_status::mapped},
-    {U'\x0056', U'\x0056', idna_status::mapped},
-    {U'\x0057', U'\x0057', idna_status::mapped},
-    {U'\x0058', U'\x0058', idna_status::mapped},
-    {U'\x0059', U'\x0059', idna_status::mapped},
-    {U'\x005a', U'\x005a', idna_status::mapped},
-    {U'\x005b', U'\x0060', idna_status::disallowed_std3_valid},
-    {U'\x007b', U'\x007f', idna_status::disallowed_std3_valid},
-    {U'\x0080', U'\x009f', idna_status::disallowed},
-    {U'\x00a0', U'\x00a0', idna_status::disallowed_std3_mapped},
-    {U'\x00a8', U'\x00a8', idna_status::disallowed_std3_mapped},
-    {U'\x00aa', U'\x00aa', idna_status::mapped},
-    {U'\x00ad', U'\x00ad', idna_status::ignored},
-    {U'\x00af', U'\x00af', idna_status::disallowed_std3_mapped},
-    {U'\x00b2', U'\x00b2', idna_status::mapped},
-    {U'\x00b3', U'\x00b3', idna_status::mapped},
-    {U'\x00b4', U'\x00b4', idna_status::disallowed_std3_mapped},
-    {U'\x00b5', U'\x00b5', idna_status::mapped},
-    {U'\x00b8', U'\x00b8', idna_status::disallowed_std3_mapped},
-    {U'\x00b9', U'\x00b9', idna_status::mapped},
-    {U'\x00ba', U'\x00ba', idna_status::mapped},
-    {U'\x00bc', U'\x00bc', idna_status::mapped},
-    {U'\x00bd', U'\x00bd', idna_status::mapped},
-    {U'\x00be', U'\x00be', idna_status::mapped},
-    {U'\x00c0', U'\x00c0', idna_status::mapped},
-    {U'\x00c1', U'\x00c1', idna_status::mapped},
-    {U'\x00c2', U'\x00c2', idna_status::mapped},
-    {U'\x00c3', U'\x00c3', idna_status::mapped},
-    {U'\x00c4', U'\x00c4', idna_status::mapped},
-    {U'\x00c5', U'\x00c5', idna_status::mapped},
-    {U'\x00c6', U'\x00c6', idna_status::mapped},
-    {U'\x00c7', U'\x00c7', idna_status::mapped},
-    {U'\x00c8', U'\x00c8', idna_status::mapped},
-    {U'\x00c9', U'\x00c9', idna_status::mapped},
-    {U'\x00ca', U'\x00ca', idna_status::mapped},
-    {U'\x00cb', U'\x00cb', idna_status::mapped},
-    {U'\x00cc', U'\x00cc', idna_status::mapped},
-    {U'\x00cd', U'\x00cd', idna_status::mapped},
-    {U'\x00ce', U'\x00ce', idna_status::mapped},
-    {U'\x00cf', U'\x00cf', idna_status::mapped},
-    {U'\x00d0', U'\x00d0', idna_status::mapped},
-    {U'\x00d1', U'\x00d1', idna_status::mapped},
-    {U'\x00d2', U'\x00d2', idna_status::mapped},
-    {U'\x00d3', U'\x00d3', idna_status::mapped},
-    {U'\x00d4', U'\x00d4', idna_status::mapped},
-    {U'\x00d5', U'\x00d5', idna_status::mapped},
-    {U'\x00d6', U'\x00d6', idna_status::mapped},
-    {U'\x00d8', U'\x00d8', idna_status::mapped},
-    {U'\x00d9', U'\x00d9', idna_status::mapped},
-    {U'\x00da', U'\x00da', idna_status::mapped},
-    {U'\x00db', U'\x00db', idna_status::mapped},
-    {U'\x00dc', U'\x00dc', idna_status::mapped},
-    {U'\x00dd', U'\x00dd', idna_status::mapped},
-    {U'\x00de', U'\x00de', idna_status::mapped},
-    {U'\x00df', U'\x00df', idna_status::deviation},
-    {U'\x0100', U'\x0100', idna_status::mapped},
-    {U'\x0102', U'\x0102', idna_status::mapped},
-    {U'\x0104', U'\x0104', idna_status::mapped},
-    {U'\x0106', U'\x0106', idna_status::mapped},
-    {U'\x0108', U'\x0108', idna_status::mapped},
-    {U'\x010a', U'\x010a', idna_status::mapped},
-    {U'\x010c', U'\x010c', idna_status::mapped},
-    {U'\x010e', U'\x010e', idna_status::mapped},
-    {U'\x0110', U'\x0110', idna_status::mapped},
-    {U'\x0112', U'\x0112', idna_status::mapped},
-    {U'\x0114', U'\x0114', idna_status::mapped},
-    {U'\x0116', U'\x0116', idna_status::mapped},
-    {U'\x0118', U'\x0118', idna_status::mapped},
-    {U'\x011a', U'\x011a', idna_status::mapped},
-    {U'\x011c', U'\x011c', idna_status::mapped},
-    {U'\x011e', U'\x011e', idna_status::mapped},
-    {U'\x0120', U'\x0120', idna_status::mapped},
-    {U'\x0122', U'\x0122', idna_status::mapped},
-    {U'\x0124', U'\x0124', idna_status::mapped},
-    {U'\x0126', U'\x0126', idna_status::mapped},
-    {U'\x0128', U'\x0128', idna_status::mapped},
-    {U'\x012a', U'\x012a', idna_status::mapped},
-    {U'\x012c', U'\x012c', idna_status::mapped},
-    {U'\x012e', U'\x012e', idna_status::mapped},
-    {U'\x0130', U'\x0130', idna_status::mapped},
-    {U'\x0132', U'\x0133', idna_status::mapped},
-    {U'\x0134', U'\x0134', idna_status::mapped},
-    {U'\x0136', U'\x0136', idna_status::mapped},
-    {U'\x0139', U'\x0139', idna_status::mapped},
-    {U'\x013b', U'\x013b', idna_status::mapped},
-    {U'\x013d', U'\x013d', idna_status::mapped},
-    {U'\x013f', U'\x0140', idna_status::mapped},
-    {U'\x0141', U'\x0141', idna_status::mapped},
-    {U'\x0143', U'\x0143', idna_status::mapped},
-    {U'\x0145', U'\x0145', idna_status::mapped},
-    {U'\x0147', U'\x0147', idna_status::mapped},
-    {U'\x0149', U'\x0149', idna_status::mapped},
-    {U'\x014a', U'\x014a', idna_status::mapped},
-    {U'\x014c', U'\x014c', idna_status::mapped},
-    {U'\x014e', U'\x014e', idna_status::mapped},
-    {U'\x0150', U'\x0150', idna_status::mapped},
-    {U'\x0152', U'\x0152', idna_status::mapped},
-    {U'\x0154', U'\x0154', idna_status::mapped},
-    {U'\x0156', U'\x0156', idna_status::mapped},
-    {U'\x0158', U'\x0158', idna_status::mapped},
-    {U'\x015a', U'\x015a', idna_status::mapped},
-    {U'\x015c', U'\x015c', idna_status::mapped},
-    {U'\x015e', U'\x015e', idna_status::mapped},
-    {U'\x0160', U'\x0160', idna_status::mapped},
-    {U'\x0162', U'\x0162', idna_status::mapped},
-    {U'\x0164', U'\x0164', idna_status::mapped},
-    {U'\x0166', U'\x0166', idna_status::mapped},
-    {U'\x0168', U'\x0168', idna_status::mapped},
-    {U'\x016a', U'\x016a', idna_status::mapped},
-    {U'\x016c', U'\x016c', idna_status::mapped},
-    {U'\x016e', U'\x016e', idna_status::mapped},
-    {U'\x0170', U'\x0170', idna_status::mapped},
-    {U'\x0172', U'\x0172', idna_status::mapped},
-    {U'\x0174', U'\x0174', idna_status::mapped},
-    {U'\x0176', U'\x0176', idna_status::mapped},
-    {U'\x0178', U'\x0178', idna_status::mapped},
-    {U'\x0179', U'\x0179', idna_status::mapped},
-    {U'\x017b', U'\x017b', idna_status::mapped},
-    {U'\x017d', U'\x017d', idna_status::mapped},
-    {U'\x017f', U'\x017f', idna_status::mapped},
-    {U'\x0181', U'\x0181', idna_status::mapped},
-    {U'\x0182', U'\x0182', idna_status::mapped},
-    {U'\x0184', U'\x0184', idna_status::mapped},
-    {U'\x0186', U'\x0186', idna_status::mapped},
-    {U'\x0187', U'\x0187', idna_status::mapped},
-    {U'\x0189', U'\x0189', idna_status::mapped},
-    {U'\x018a', U'\x018a', idna_status::mapped},
-    {U'\x018b', U'\x018b', idna_status::mapped},
-    {U'\x018e', U'\x018e', idna_status::mapped},
-    {U'\x018f', U'\x018f', idna_status::mapped},
-    {U'\x0190', U'\x0190', idna_status::mapped},
-    {U'\x0191', U'\x0191', idna_status::mapped},
-    {U'\x0193', U'\x0193', idna_status::mapped},
-    {U'\x0194', U'\x0194', idna_status::mapped},
-    {U'\x0196', U'\x0196', idna_status::mapped},
-    {U'\x0197', U'\x0197', idna_status::mapped},
-    {U'\x0198', U'\x0198', idna_status::mapped},
-    {U'\x019c', U'\x019c', idna_status::mapped},
-    {U'\x019d', U'\x019d', idna_status::mapped},
-    {U'\x019f', U'\x019f', idna_status::mapped},
-    {U'\x01a0', U'\x01a0', idna_status::mapped},
-    {U'\x01a2', U'\x01a2', idna_status::mapped},
-    {U'\x01a4', U'\x01a4', idna_status::mapped},
-    {U'\x01a6', U'\x01a6', idna_status::mapped},
-    {U'\x01a7', U'\x01a7', idna_status::mapped},
-    {U'\x01a9', U'\x01a9', idna_status::mapped},
-    {U'\x01ac', U'\x01ac', idna_status::mapped},
-    {U'\x01ae', U'\x01ae', idna_status::mapped},
-    {U'\x01af', U'\x01af', idna_status::mapped},
-    {U'\x01b1', U'\x01b1', idna_status::mapped},
-    {U'\x01b2', U'\x01b2', idna_status::mapped},
-    {U'\x01b3', U'\x01b3', idna_status::mapped},
-    {U'\x01b5', U'\x01b5', idna_status::mapped},
-    {U'\x01b7', U'\x01b7', idna_status::mapped},
-    {U'\x01b8', U'\x01b8', idna_status::mapped},
-    {U'\x01bc', U'\x01bc', idna_status::mapped},
-    {U'\x01c4', U'\x01c6', idna_status::mapped},
-    {U'\x01c7', U'\x01c9', idna_status::mapped},
-    {U'\x01ca', U'\x01cc', idna_status::mapped},
-    {U'\x01cd', U'\x01cd', idna_status::mapped},
-    {U'\x01cf', U'\x01cf', idna_status::mapped},
-    {U'\x01d1', U'\x01d1', idna_status::mapped},
-    {U'\x01d3', U'\x01d3', idna_status::mapped},
-    {U'\x01d5', U'\x01d5', idna_status::mapped},
-    {U'\x01d7', U'\x01d7', idna_status::mapped},
-    {U'\x01d9', U'\x01d9', idna_status::mapped},
-    {U'\x01db', U'\x01db', idna_status::mapped},
-    {U'\x01de', U'\x01de', idna_status::mapped},
-    {U'\x01e0', U'\x01e0', idna_status::mapped},
-    {U'\x01e2', U'\x01e2', idna_status::mapped},
-    {U'\x01e4', U'\x01e4', idna_status::mapped},
-    {U'\x01e6', U'\x01e6', idna_status::mapped},
-    {U'\x01e8', U'\x01e8', idna_status::mapped},
-    {U'\x01ea', U'\x01ea', idna_status::mapped},
-    {U'\x01ec', U'\x01ec', idna_status::mapped},
-    {U'\x01ee', U'\x01ee', idna_status::mapped},
-    {U'\x01f1', U'\x01f3', idna_status::mapped},
-    {U'\x01f4', U'\x01f4', idna_status::mapped},
-    {U'\x01f6', U'\x01f6', idna_status::mapped},
-    {U'\x01f7', U'\x01f7', idna_status::mapped},
-    {U'\x01f8', U'\x01f8', idna_status::mapped},
-    {U'\x01fa', U'\x01fa', idna_status::mapped},
-    {U'\x01fc', U'\x01fc', idna_status::mapped},
-    {U'\x01fe', U'\x01fe', idna_status::mapped},
-    {U'\x0200', U'\x0200', idna_status::mapped},
-    {U'\x0202', U'\x0202', idna_status::mapped},
-    {U'\x0204', U'\x0204', idna_status::mapped},
-    {U'\x0206', U'\x0206', idna_status::mapped},
-    {U'\x0208', U'\x0208', idna_status::mapped},
-    {U'\x020a', U'\x020a', idna_status::mapped},
-    {U'\x020c', U'\x020c', idna_status::mapped},
-    {U'\x020e', U'\x020e', idna_status::mapped},
-    {U'\x0210', U'\x0210', idna_status::mapped},
-    {U'\x0212', U'\x0212', idna_status::mapped},
-    {U'\x0214', U'\x0214', idna_status::mapped},
-    {U'\x0216', U'\x0216', idna_status::mapped},
-    {U'\x0218', U'\x0218', idna_status::mapped},
-    {U'\x021a', U'\x021a', idna_status::mapped},
-    {U'\x021c', U'\x021c', idna_status::mapped},
-    {U'\x021e', U'\x021e', idna_status::mapped},
-    {U'\x0220', U'\x0220', idna_status::mapped},
-    {U'\x0222', U'\x0222', idna_status::mapped},
-    {U'\x0224', U'\x0224', idna_status::mapped},
-    {U'\x0226', U'\x0226', idna_status::mapped},
-    {U'\x0228', U'\x0228', idna_status::mapped},
-    {U'\x022a', U'\x022a', idna_status::mapped},
-    {U'\x022c', U'\x022c', idna_status::mapped},
-    {U'\x022e', U'\x022e', idna_status::mapped},
-    {U'\x0230', U'\x0230', idna_status::mapped},
-    {U'\x0232', U'\x0232', idna_status::mapped},
-    {U'\x023a', U'\x023a', idna_status::mapped},
-    {U'\x023b', U'\x023b', idna_status::mapped},
-    {U'\x023d', U'\x023d', idna_status::mapped},
-    {U'\x023e', U'\x023e', idna_status::mapped},
-    {U'\x0241', U'\x0241', idna_status::mapped},
-    {U'\x0243', U'\x0243', idna_status::mapped},
-    {U'\x0244', U'\x0244', idna_status::mapped},
-    {U'\x0245', U'\x0245', idna_status::mapped},
-    {U'\x0246', U'\x0246', idna_status::mapped},
-    {U'\x0248', U'\x0248', idna_status::mapped},
-    {U'\x024a', U'\x024a', idna_status::mapped},
-    {U'\x024c', U'\x024c', idna_status::mapped},
-    {U'\x024e', U'\x024e', idna_status::mapped},
-    {U'\x02b0', U'\x02b0', idna_status::mapped},
-    {U'\x02b1', U'\x02b1', idna_status::mapped},
-    {U'\x02b2', U'\x02b2', idna_status::mapped},
-    {U'\x02b3', U'\x02b3', idna_status::mapped},
-    {U'\x02b4', U'\x02b4', idna_status::mapped},
-    {U'\x02b5', U'\x02b5', idna_status::mapped},
-    {U'\x02b6', U'\x02b6', idna_status::mapped},
-    {U'\x02b7', U'\x02b7', idna_status::mapped},
-    {U'\x02b8', U'\x02b8', idna_status::mapped},
-    {U'\x02d8', U'\x02d8', idna_status::disallowed_std3_mapped},
-    {U'\x02d9', U'\x02d9', idna_status::disallowed_std3_mapped},
-    {U'\x02da', U'\x02da', idna_status::disallowed_std3_mapped},
-    {U'\x02db', U'\x02db', idna_status::disallowed_std3_mapped},
-    {U'\x02dc', U'\x02dc', idna_status::disallowed_std3_mapped},
-    {U'\x02dd', U'\x02dd', idna_status::disallowed_std3_mapped},
-    {U'\x02e0', U'\x02e0', idna_status::mapped},
-    {U'\x02e1', U'\x02e1', idna_status::mapped},
-    {U'\x02e2', U'\x02e2', idna_status::mapped},
-    {U'\x02e3', U'\x02e3', idna_status::mapped},
-    {U'\x02e4', U'\x02e4', idna_status::mapped},
-    {U'\x0340', U'\x0340', idna_status::mapped},
-    {U'\x0341', U'\x0341', idna_status::mapped},
-    {U'\x0343', U'\x0343', idna_status::mapped},
-    {U'\x0344', U'\x0344', idna_status::mapped},
-    {U'\x0345', U'\x0345', idna_status::mapped},
-    {U'\x034f', U'\x034f', idna_status::ignored},
-    {U'\x0370', U'\x0370', idna_status::mapped},
-    {U'\x0372', U'\x0372', idna_status::mapped},
-    {U'\x0374', U'\x0374', idna_status::mapped},
-    {U'\x0376', U'\x0376', idna_status::mapped},
-    {U'\x0378', U'\x0379', idna_status::disallowed},
-    {U'\x037a', U'\x037a', idna_status::disallowed_std3_mapped},
-    {U'\x037e', U'\x037e', idna_status::disallowed_std3_mapped},
-    {U'\x037f', U'\x037f', idna_status::mapped},
-    {U'\x0380', U'\x0383', idna_status::disallowed},
-    {U'\x0384', U'\x0384', idna_status::disallowed_std3_mapped},
-    {U'\x0385', U'\x0385', idna_status::disallowed_std3_mapped},
-    {U'\x0386', U'\x0386', idna_status::mapped},
-    {U'\x0387', U'\x0387', idna_status::mapped},
-    {U'\x0388', U'\x0388', idna_status::mapped},
-    {U'\x0389', U'\x0389', idna_status::mapped},
-    {U'\x038a', U'\x038a', idna_status::mapped},
-    {U'\x038b', U'\x038b', idna_status::disallowed},
-    {U'\x038c', U'\x038c', idna_status::mapped},
-    {U'\x038d', U'\x038d', idna_status::disallowed},
-    {U'\x038e', U'\x038e', idna_status::mapped},
-    {U'\x038f', U'\x038f', idna_status::mapped},
-    {U'\x0391', U'\x0391', idna_status::mapped},
-    {U'\x0392', U'\x0392', idna_status::mapped},
-    {U'\x0393', U'\x0393', idna_status::mapped},
-    {U'\x0394', U'\x0394', idna_status::mapped},
-    {U'\x0395', U'\x0395', idna_status::mapped},
-    {U'\x0396', U'\x0396', idna_status::mapped},
-    {U'\x0397', U'\x0397', idna_status::mapped},
-    {U'\x0398', U'\x0398', idna_status::mapped},
-    {U'\x0399', U'\x0399', idna_status::mapped},
-    {U'\x039a', U'\x039a', idna_status::mapped},
-    {U'\x039b', U'\x039b', idna_status::mapped},
-    {U'\x039c', U'\x039c', idna_status::mapped},
-    {U'\x039d', U'\x039d', idna_status::mapped},
-    {U'\x039e', U'\x039e', idna_status::mapped},
-    {U'\x039f', U'\x039f', idna_status::mapped},
-    {U'\x03a0', U'\x03a0', idna_status::mapped},
-    {U'\x03a1', U'\x03a1', idna_status::mapped},
-    {U'\x03a2', U'\x03a2', idna_status::disallowed},
-    {U'\x03a3', U'\x03a3', idna_status::mapped},
-    {U'\x03a4', U'\x03a4', idna_status::mapped},
-    {U'\x03a5', U'\x03a5', idna_status::mapped},
-    {U'\x03a6', U'\x03a6', idna_status::mapped},
-    {U'\x03a7', U'\x03a7', idna_status::mapped},
-    {U'\x03a8', U'\x03a8', idna_status::mapped},
-    {U'\x03a9', U'\x03a9', idna_status::mapped},
-    {U'\x03aa', U'\x03aa', idna_status::mapped},
-    {U'\x03ab', U'\x03ab', idna_status::mapped},
-    {U'\x03c2', U'\x03c2', idna_status::deviation},
-    {U'\x03cf', U'\x03cf', idna_status::mapped},
-    {U'\x03d0', U'\x03d0', idna_status::mapped},
-    {U'\x03d1', U'\x03d1', idna_status::mapped},
-    {U'\x03d2', U'\x03d2', idna_status::mapped},
-    {U'\x03d3', U'\x03d3', idna_status::mapped},
-    {U'\x03d4', U'\x03d4', idna_status::mapped},
-    {U'\x03d5', U'\x03d5', idna_status::mapped},
-    {U'\x03d6', U'\x03d6', idna_status::mapped},
-    {U'\x03d8', U'\x03d8', idna_status::mapped},
-    {U'\x03da', U'\x03da', idna_status::mapped},
-    {U'\x03dc', U'\x03dc', idna_status::mapped},
-    {U'\x03de', U'\x03de', idna_status::mapped},
-    {U'\x03e0', U'\x03e0', idna_status::mapped},
-    {U'\x03e2', U'\x03e2', idna_status::mapped},
-    {U'\x03e4', U'\x03e4', idna_status::mapped},
-    {U'\x03e6', U'\x03e6', idna_status::mapped},
-    {U'\x03e8', U'\x03e8', idna_status::mapped},
-    {U'\x03ea', U'\x03ea', idna_status::mapped},
-    {U'\x03ec', U'\x03ec', idna_status::mapped},
-    {U'\x03ee', U'\x03ee', idna_status::mapped},
-    {U'\x03f0', U'\x03f0', idna_status::mapped},
-    {U'\x03f1', U'\x03f1', idna_status::mapped},
-    {U'\x03f2', U'\x03f2', idna_status::mapped},
-    {U'\x03f4', U'\x03f4', idna_status::mapped},
-    {U'\x03f5', U'\x03f5', idna_status::mapped},
-    {U'\x03f7', U'\x03f7', idna_status::mapped},
-    {U'\x03f9', U'\x03f9', idna_status::mapped},
-    {U'\x03fa', U'\x03fa', idna_status::mapped},
-    {U'\x03fd', U'\x03fd', idna_status::mapped},
-    {U'\x03fe', U'\x03fe', idna_status::mapped},
-    {U'\x03ff', U'\x03ff', idna_status::mapped},
-    {U'\x0400', U'\x0400', idna_status::mapped},
-    {U'\x0401', U'\x0401', idna_status::mapped},
-    {U'\x0402', U'\x0402', idna_status::mapped},
-    {U'\x0403', U'\x0403', idna_status::mapped},
-    {U'\x0404', U'\x0404', idna_status::mapped},
-    {U'\x0405', U'\x0405', idna_status::mapped},
-    {U'\x0406', U'\x0406', idna_status::mapped},
-    {U'\x0407', U'\x0407', idna_status::mapped},
-    {U'\x0408', U'\x0408', idna_status::mapped},
-    {U'\x0409', U'\x0409', idna_status::mapped},
-    {U'\x040a', U'\x040a', idna_status::mapped},
-    {U'\x040b', U'\x040b', idna_status::mapped},
-    {U'\x040c', U'\x040c', idna_status::mapped},
-    {U'\x040d', U'\x040d', idna_status::mapped},
-    {U'\x040e', U'\x040e', idna_status::mapped},
-    {U'\x040f', U'\x040f', idna_status::mapped},
-    {U'\x0410', U'\x0410', idna_status::mapped},
-    {U'\x0411', U'\x0411', idna_status::mapped},
-    {U'\x0412', U'\x0412', idna_status::mapped},
-    {U'\x0413', U'\x0413', idna_status::mapped},
-    {U'\x0414', U'\x0414', idna_status::mapped},
-    {U'\x0415', U'\x0415', idna_status::mapped},
-    {U'\x0416', U'\x0416', idna_status::mapped},
-    {U'\x0417', U'\x0417', idna_status::mapped},
-    {U'\x0418', U'\x0418', idna_status::mapped},
-    {U'\x0419', U'\x0419', idna_status::mapped},
-    {U'\x041a', U'\x041a', idna_status::mapped},
-    {U'\x041b', U'\x041b', idna_status::mapped},
-    {U'\x041c', U'\x041c', idna_status::mapped},
-    {U'\x041d', U'\x041d', idna_status::mapped},
-    {U'\x041e', U'\x041e', idna_status::mapped},
-    {U'\x041f', U'\x041f', idna_status::mapped},
-    {U'\x0420', U'\x0420', idna_status::mapped},
-    {U'\x0421', U'\x0421', idna_status::mapped},
-    {U'\x0422', U'\x0422', idna_status::mapped},
-    {U'\x0423', U'\x0423', idna_status::mapped},
-    {U'\x0424', U'\x0424', idna_status::mapped},
-    {U'\x0425', U'\x0425', idna_status::mapped},
-    {U'\x0426', U'\x0426', idna_status::mapped},
-    {U'\x0427', U'\x0427', idna_status::mapped},
-    {U'\x0428', U'\x0428', idna_status::mapped},
-    {U'\x0429', U'\x0429', idna_status::mapped},
-    {U'\x042a', U'\x042a', idna_status::mapped},
-    {U'\x042b', U'\x042b', idna_status::mapped},
-    {U'\x042c', U'\x042c', idna_status::mapped},
-    {U'\x042d', U'\x042d', idna_status::mapped},
-    {U'\x042e', U'\x042e', idna_status::mapped},
-    {U'\x042f', U'\x042f', idna_status::mapped},
-    {U'\x0460', U'\x0460', idna_status::mapped},
-    {U'\x0462', U'\x0462', idna_status::mapped},
-    {U'\x0464', U'\x0464', idna_status::mapped},
-    {U'\x0466', U'\x0466', idna_status::mapped},
-    {U'\x0468', U'\x0468', idna_status::mapped},
-    {U'\x046a', U'\x046a', idna_status::mapped},
-    {U'\x046c', U'\x046c', idna_status::mapped},
-    {U'\x046e', U'\x046e', idna_status::mapped},
-    {U'\x0470', U'\x0470', idna_status::mapped},
-    {U'\x0472', U'\x0472', idna_status::mapped},
-    {U'\x0474', U'\x0474', idna_status::mapped},
-    {U'\x0476', U'\x0476', idna_status::mapped},
-    {U'\x0478', U'\x0478', idna_status::mapped},
-    {U'\x047a', U'\x047a', idna_status::mapped},
-    {U'\x047c', U'\x047c', idna_status::mapped},
-    {U'\x047e', U'\x047e', idna_status::mapped},
-    {U'\x0480', U'\x0480', idna_status::mapped},
-    {U'\x048a', U'\x048a', idna_status::mapped},
-    {U'\x048c', U'\x048c', idna_status::mapped},
-    {U'\x048e', U'\x048e', idna_status::mapped},
-    {U'\x0490', U'\x0490', idna_status::mapped},
-    {U'\x0492', U'\x0492', idna_status::mapped},
-    {U'\x0494', U'\x0494', idna_status::mapped},
-    {U'\x0496', U'\x0496', idna_status::mapped},
-    {U'\x0498', U'\x0498', idna_status::mapped},
-    {U'\x049a', U'\x049a', idna_status::mapped},
-    {U'\x049c', U'\x049c', idna_status::mapped},
-    {U'\x049e', U'\x049e', idna_status::mapped},
-    {U'\x04a0', U'\x04a0', idna_status::mapped},
-    {U'\x04a2', U'\x04a2', idna_status::mapped},
-    {U'\x04a4', U'\x04a4', idna_status::mapped},
-    {U'\x04a6', U'\x04a6', idna_status::mapped},
-    {U'\x04a8', U'\x04a8', idna_status::mapped},
-    {U'\x04aa', U'\x04aa', idna_status::mapped},
-    {U'\x04ac', U'\x04ac', idna_status::mapped},
-    {U'\x04ae', U'\x04ae', idna_status::mapped},
-    {U'\x04b0', U'\x04b0', idna_status::mapped},
-    {U'\x04b2', U'\x04b2', idna_status::mapped},
-    {U'\x04b4', U'\x04b4', idna_status::mapped},
-    {U'\x04b6', U'\x04b6', idna_status::mapped},
-    {U'\x04b8', U'\x04b8', idna_status::mapped},
-    {U'\x04ba', U'\x04ba', idna_status::mapped},
-    {U'\x04bc', U'\x04bc', idna_status::mapped},
-    {U'\x04be', U'\x04be', idna_status::mapped},
-    {U'\x04c0', U'\x04c0', idna_status::disallowed},
-    {U'\x04c1', U'\x04c1', idna_status::mapped},
-    {U'\x04c3', U'\x04c3', idna_status::mapped},
-    {U'\x04c5', U'\x04c5', idna_status::mapped},
-    {U'\x04c7', U'\x04c7', idna_status::mapped},
-    {U'\x04c9', U'\x04c9', idna_status::mapped},
-    {U'\x04cb', U'\x04cb', idna_status::mapped},
-    {U'\x04cd', U'\x04cd', idna_status::mapped},
-    {U'\x04d0', U'\x04d0', idna_status::mapped},
-    {U'\x04d2', U'\x04d2', idna_status::mapped},
-    {U'\x04d4', U'\x04d4', idna_status::mapped},
-    {U'\x04d6', U'\x04d6', idna_status::mapped},
-    {U'\x04d8', U'\x04d8', idna_status::mapped},
-    {U'\x04da', U'\x04da', idna_status::mapped},
-    {U'\x04dc', U'\x04dc', idna_status::mapped},
-    {U'\x04de', U'\x04de', idna_status::mapped},
-    {U'\x04e0', U'\x04e0', idna_status::mapped},
-    {U'\x04e2', U'\x04e2', idna_status::mapped},
-    {U'\x04e4', U'\x04e4', idna_status::mapped},
-    {U'\x04e6', U'\x04e6', idna_status::mapped},
-    {U'\x04e8', U'\x04e8', idna_status::mapped},
-    {U'\x04ea', U'\x04ea', idna_status::mapped},
-    {U'\x04ec', U'\x04ec', idna_status::mapped},
-    {U'\x04ee', U'\x04ee', idna_status::mapped},
-    {U'\x04f0', U'\x04f0', idna_status::mapped},
-    {U'\x04f2', U'\x04f2', idna_status::mapped},
-    {U'\x04f4', U'\x04f4', idna_status::mapped},
-    {U'\x04f6', U'\x04f6', idna_status::mapped},
-    {U'\x04f8', U'\x04f8', idna_status::mapped},
-    {U'\x04fa', U'\x04fa', idna_status::mapped},
-    {U'\x04fc', U'\x04fc', idna_status::mapped},
-    {U'\x04fe', U'\x04fe', idna_status::mapped},
-    {U'\x0500', U'\x0500', idna_status::mapped},
-    {U'\x0502', U'\x0502', idna_status::mapped},
-    {U'\x0504', U'\x0504', idna_status::mapped},
-    {U'\x0506', U'\x0506', idna_status::mapped},
-    {U'\x0508', U'\x0508', idna_status::mapped},
-    {U'\x050a', U'\x050a', idna_status::mapped},
-    {U'\x050c', U'\x050c', idna_status::mapped},
-    {U'\x050e', U'\x050e', idna_status::mapped},
-    {U'\x0510', U'\x0510', idna_status::mapped},
-    {U'\x0512', U'\x0512', idna_status::mapped},
-    {U'\x0514', U'\x0514', idna_status::mapped},
-    {U'\x0516', U'\x0516', idna_status::mapped},
-    {U'\x0518', U'\x0518', idna_status::mapped},
-    {U'\x051a', U'\x051a', idna_status::mapped},
-    {U'\x051c', U'\x051c', idna_status::mapped},
-    {U'\x051e', U'\x051e', idna_status::mapped},
-    {U'\x0520', U'\x0520', idna_status::mapped},
-    {U'\x0522', U'\x0522', idna_status::mapped},
-    {U'\x0524', U'\x0524', idna_status::mapped},
-    {U'\x0526', U'\x0526', idna_status::mapped},
-    {U'\x0528', U'\x0528', idna_status::mapped},
-    {U'\x052a', U'\x052a', idna_status::mapped},
-    {U'\x052c', U'\x052c', idna_status::mapped},
-    {U'\x052e', U'\x052e', idna_status::mapped},
-    {U'\x0530', U'\x0530', idna_status::disallowed},
-    {U'\x0531', U'\x0531', idna_status::mapped},
-    {U'\x0532', U'\x0532', idna_status::mapped},
-    {U'\x0533', U'\x0533', idna_status::mapped},
-    {U'\x0534', U'\x0534', idna_status::mapped},
-    {U'\x0535', U'\x0535', idna_status::mapped},
-    {U'\x0536', U'\x0536', idna_status::mapped},
-    {U'\x0537', U'\x0537', idna_status::mapped},
-    {U'\x0538', U'\x0538', idna_status::mapped},
-    {U'\x0539', U'\x0539', idna_status::mapped},
-    {U'\x053a', U'\x053a', idna_status::mapped},
-    {U'\x053b', U'\x053b', idna_status::mapped},
-    {U'\x053c', U'\x053c', idna_status::mapped},
-    {U'\x053d', U'\x053d', idna_status::mapped},
-    {U'\x053e', U'\x053e', idna_status::mapped},
-    {U'\x053f', U'\x053f', idna_status::mapped},
-    {U'\x0540', U'\x0540', idna_status::mapped},
-    {U'\x0541', U'\x0541', idna_status::mapped},
-    {U'\x0542', U'\x0542', idna_status::mapped},
-    {U'\x0543', U'\x0543', idna_status::mapped},
-    {U'\x0544', U'\x0544', idna_status::mapped},
-    {U'\x0545', U'\x0545', idna_status::mapped},
-    {U'\x0546', U'\x0546', idna_status::mapped},
-    {U'\x0547', U'\x0547', idna_status::mapped},
-    {U'\x0548', U'\x0548', idna_status::mapped},
-    {U'\x0549', U'\x0549', idna_status::mapped},
-    {U'\x054a', U'\x054a', idna_status::mapped},
-    {U'\x054b', U'\x054b', idna_status::mapped},
-    {U'\x054c', U'\x054c', idna_status::mapped},
-    {U'\x054d', U'\x054d', idna_status::mapped},
-    {U'\x054e', U'\x054e', idna_status::mapped},
-    {U'\x054f', U'\x054f', idna_status::mapped},
-    {U'\x0550', U'\x0550', idna_status::mapped},
-    {U'\x0551', U'\x0551', idna_status::mapped},
-    {U'\x0552', U'\x0552', idna_status::mapped},
-    {U'\x0553', U'\x0553', idna_status::mapped},
-    {U'\x0554', U'\x0554', idna_status::mapped},
-    {U'\x0555', U'\x0555', idna_status::mapped},
-    {U'\x0556', U'\x0556', idna_status::mapped},
-    {U'\x0557', U'\x0558', idna_status::disallowed},
-    {U'\x0587', U'\x0587', idna_status::mapped},
-    {U'\x058b', U'\x058c', idna_status::disallowed},
-    {U'\x0590', U'\x0590', idna_status::disallowed},
-    {U'\x05c8', U'\x05cf', idna_status::disallowed},
-    {U'\x05eb', U'\x05ee', idna_status::disallowed},
-    {U'\x05f5', U'\x05ff', idna_status::disallowed},
-    {U'\x0600', U'\x0603', idna_status::disallowed},
-    {U'\x0604', U'\x0604', idna_status::disallowed},
-    {U'\x0605', U'\x0605', idna_status::disallowed},
-    {U'\x061c', U'\x061c', idna_status::disallowed},
-    {U'\x0675', U'\x0675', idna_status::mapped},
-    {U'\x0676', U'\x0676', idna_status::mapped},
-    {U'\x0677', U'\x0677', idna_status::mapped},
-    {U'\x0678', U'\x0678', idna_status::mapped},
-    {U'\x06dd', U'\x06dd', idna_status::disallowed},
-    {U'\x070e', U'\x070e', idna_status::disallowed},
-    {U'\x070f', U'\x070f', idna_status::disallowed},
-    {U'\x074b', U'\x074c', idna_status::disallowed},
-    {U'\x07b2', U'\x07bf', idna_status::disallowed},
-    {U'\x07fb', U'\x07fc', idna_status::disallowed},
-    {U'\x082e', U'\x082f', idna_status::disallowed},
-    {U'\x083f', U'\x083f', idna_status::disallowed},
-    {U'\x085c', U'\x085d', idna_status::disallowed},
-    {U'\x085f', U'\x085f', idna_status::disallowed},
-    {U'\x086b', U'\x086f', idna_status::disallowed},
-    {U'\x088f', U'\x088f', idna_status::disallowed},
-    {U'\x0890', U'\x0891', idna_status::disallowed},
-    {U'\x0892', U'\x0897', idna_status::disallowed},
-    {U'\x08e2', U'\x08e2', idna_status::disallowed},
-    {U'\x0958', U'\x0958', idna_status::mapped},
-    {U'\x0959', U'\x0959', idna_status::mapped},
-    {U'\x095a', U'\x095a', idna_status::mapped},
-    {U'\x095b', U'\x095b', idna_status::mapped},
-    {U'\x095c', U'\x095c', idna_status::mapped},
-    {U'\x095d', U'\x095d', idna_status::mapped},
-    {U'\x095e', U'\x095e', idna_status::mapped},
-    {U'\x095f', U'\x095f', idna_status::mapped},
-    {U'\x0984', U'\x0984', idna_status::disallowed},
-    {U'\x098d', U'\x098e', idna_status::disallowed},
-    {U'\x0991', U'\x0992', idna_status::disallowed},
-    {U'\x09a9', U'\x09a9', idna_status::disallowed},
-    {U'\x09b1', U'\x09b1', idna_status::disallowed},
-    {U'\x09b3', U'\x09b5', idna_status::disallowed},
-    {U'\x09ba', U'\x09bb', idna_status::disallowed},
-    {U'\x09c5', U'\x09c6', idna_status::disallowed},
-    {U'\x09c9', U'\x09ca', idna_status::disallowed},
-    {U'\x09cf', U'\x09d6', idna_status::disallowed},
-    {U'\x09d8', U'\x09db', idna_status::disallowed},
-    {U'\x09dc', U'\x09dc', idna_status::mapped},
-    {U'\x09dd', U'\x09dd', idna_status::mapped},
-    {U'\x09de', U'\x09de', idna_status::disallowed},
-    {U'\x09df', U'\x09df', idna_status::mapped},
-    {U'\x09e4', U'\x09e5', idna_status::disallowed},
-    {U'\x09ff', U'\x0a00', idna_status::disallowed},
-    {U'\x0a04', U'\x0a04', idna_status::disallowed},
-    {U'\x0a0b', U'\x0a0e', idna_status::disallowed},
-    {U'\x0a11', U'\x0a12', idna_status::disallowed},
-    {U'\x0a29', U'\x0a29', idna_status::disallowed},
-    {U'\x0a31', U'\x0a31', idna_status::disallowed},
-    {U'\x0a33', U'\x0a33', idna_status::mapped},
-    {U'\x0a34', U'\x0a34', idna_status::disallowed},
-    {U'\x0a36', U'\x0a36', idna_status::mapped},
-    {U'\x0a37', U'\x0a37', idna_status::disallowed},
-    {U'\x0a3a', U'\x0a3b', idna_status::disallowed},
-    {U'\x0a3d', U'\x0a3d', idna_status::disallowed},
-    {U'\x0a43', U'\x0a46', idna_status::disallowed},
-    {U'\x0a49', U'\x0a4a', idna_status::disallowed},
-    {U'\x0a4e', U'\x0a50', idna_status::disallowed},
-    {U'\x0a52', U'\x0a58', idna_status::disallowed},
-    {U'\x0a59', U'\x0a59', idna_status::mapped},
-    {U'\x0a5a', U'\x0a5a', idna_status::mapped},
-    {U'\x0a5b', U'\x0a5b', idna_status::mapped},
-    {U'\x0a5d', U'\x0a5d', idna_status::disallowed},
-    {U'\x0a5e', U'\x0a5e', idna_status::mapped},
-    {U'\x0a5f', U'\x0a65', idna_status::disallowed},
-    {U'\x0a77', U'\x0a80', idna_status::disallowed},
-    {U'\x0a84', U'\x0a84', idna_status::disallowed},
-    {U'\x0a8e', U'\x0a8e', idna_status::disallowed},
-    {U'\x0a92', U'\x0a92', idna_status::disallowed},
-    {U'\x0aa9', U'\x0aa9', idna_status::disallowed},
-    {U'\x0ab1', U'\x0ab1', idna_status::disallowed},
-    {U'\x0ab4', U'\x0ab4', idna_status::disallowed},
-    {U'\x0aba', U'\x0abb', idna_status::disallowed},
-    {U'\x0ac6', U'\x0ac6', idna_status::disallowed},
-    {U'\x0aca', U'\x0aca', idna_status::disallowed},
-    {U'\x0ace', U'\x0acf', idna_status::disallowed},
-    {U'\x0ad1', U'\x0adf', idna_status::disallowed},
-    {U'\x0ae4', U'\x0ae5', idna_status::disallowed},
-    {U'\x0af2', U'\x0af8', idna_status::disallowed},
-    {U'\x0b00', U'\x0b00', idna_status::disallowed},
-    {U'\x0b04', U'\x0b04', idna_status::disallowed},
-    {U'\x0b0d', U'\x0b0e', idna_status::disallowed},
-    {U'\x0b11', U'\x0b12', idna_status::disallowed},
-    {U'\x0b29', U'\x0b29', idna_status::disallowed},
-    {U'\x0b31', U'\x0b31', idna_status::disallowed},
-    {U'\x0b34', U'\x0b34', idna_status::disallowed},
-    {U'\x0b3a', U'\x0b3b', idna_status::disallowed},
-    {U'\x0b45', U'\x0b46', idna_status::disallowed},
-    {U'\x0b49', U'\x0b4a', idna_status::disallowed},
-    {U'\x0b4e', U'\x0b54', idna_status::disallowed},
-    {U'\x0b58', U'\x0b5b', idna_status::disallowed},
-    {U'\x0b5c', U'\x0b5c', idna_status::mapped},
-    {U'\x0b5d', U'\x0b5d', idna_status::mapped},
-    {U'\x0b5e', U'\x0b5e', idna_status::disallowed},
-    {U'\x0b64', U'\x0b65', idna_status::disallowed},
-    {U'\x0b78', U'\x0b81', idna_status::disallowed},
-    {U'\x0b84', U'\x0b84', idna_status::disallowed},
-    {U'\x0b8b', U'\x0b8d', idna_status::disallowed},
-    {U'\x0b91', U'\x0b91', idna_status::disallowed},
-    {U'\x0b96', U'\x0b98', idna_status::disallowed},
-    {U'\x0b9b', U'\x0b9b', idna_status::disallowed},
-    {U'\x0b9d', U'\x0b9d', idna_status::disallowed},
-    {U'\x0ba0', U'\x0ba2', idna_status::disallowed},
-    {U'\x0ba5', U'\x0ba7', idna_status::disallowed},
-    {U'\x0bab', U'\x0bad', idna_status::disallowed},
-    {U'\x0bba', U'\x0bbd', idna_status::disallowed},
-    {U'\x0bc3', U'\x0bc5', idna_status::disallowed},
-    {U'\x0bc9', U'\x0bc9', idna_status::disallowed},
-    {U'\x0bce', U'\x0bcf', idna_status::disallowed},
-    {U'\x0bd1', U'\x0bd6', idna_status::disallowed},
-    {U'\x0bd8', U'\x0be5', idna_status::disallowed},
-    {U'\x0bfb', U'\x0bff', idna_status::disallowed},
-    {U'\x0c0d', U'\x0c0d', idna_status::disallowed},
-    {U'\x0c11', U'\x0c11', idna_status::disallowed},
-    {U'\x0c29', U'\x0c29', idna_status::disallowed},
-    {U'\x0c3a', U'\x0c3b', idna_status::disallowed},
-    {U'\x0c45', U'\x0c45', idna_status::disallowed},
-    {U'\x0c49', U'\x0c49', idna_status::disallowed},
-    {U'\x0c4e', U'\x0c54', idna_status::disallowed},
-    {U'\x0c57', U'\x0c57', idna_status::disallowed},
-    {U'\x0c5b', U'\x0c5c', idna_status::disallowed},
-    {U'\x0c5e', U'\x0c5f', idna_status::disallowed},
-    {U'\x0c64', U'\x0c65', idna_status::disallowed},
-    {U'\x0c70', U'\x0c76', idna_status::disallowed},
-    {U'\x0c8d', U'\x0c8d', idna_status::disallowed},
-    {U'\x0c91', U'\x0c91', idna_status::disallowed},
-    {U'\x0ca9', U'\x0ca9', idna_status::disallowed},
-    {U'\x0cb4', U'\x0cb4', idna_status::disallowed},
-    {U'\x0cba', U'\x0cbb', idna_status::disallowed},
-    {U'\x0cc5', U'\x0cc5', idna_status::disallowed},
-    {U'\x0cc9', U'\x0cc9', idna_status::disallowed},
-    {U'\x0cce', U'\x0cd4', idna_status::disallowed},
-    {U'\x0cd7', U'\x0cdc', idna_status::disallowed},
-    {U'\x0cdf', U'\x0cdf', idna_status::disallowed},
-    {U'\x0ce4', U'\x0ce5', idna_status::disallowed},
-    {U'\x0cf0', U'\x0cf0', idna_status::disallowed},
-    {U'\x0cf4', U'\x0cff', idna_status::disallowed},
-    {U'\x0d0d', U'\x0d0d', idna_status::disallowed},
-    {U'\x0d11', U'\x0d11', idna_status::disallowed},
-    {U'\x0d45', U'\x0d45', idna_status::disallowed},
-    {U'\x0d49', U'\x0d49', idna_status::disallowed},
-    {U'\x0d50', U'\x0d53', idna_status::disallowed},
-    {U'\x0d64', U'\x0d65', idna_status::disallowed},
-    {U'\x0d80', U'\x0d80', idna_status::disallowed},
-    {U'\x0d84', U'\x0d84', idna_status::disallowed},
-    {U'\x0d97', U'\x0d99', idna_status::disallowed},
-    {U'\x0db2', U'\x0db2', idna_status::disallowed},
-    {U'\x0dbc', U'\x0dbc', idna_status::disallowed},
-    {U'\x0dbe', U'\x0dbf', idna_status::disallowed},
-    {U'\x0dc7', U'\x0dc9', idna_status::disallowed},
-    {U'\x0dcb', U'\x0dce', idna_status::disallowed},
-    {U'\x0dd5', U'\x0dd5', idna_status::disallowed},
-    {U'\x0dd7', U'\x0dd7', idna_status::disallowed},
-    {U'\x0de0', U'\x0de5', idna_status::disallowed},
-    {U'\x0df0', U'\x0df1', idna_status::disallowed},
-    {U'\x0df5', U'\x0e00', idna_status::disallowed},
-    {U'\x0e33', U'\x0e33', idna_status::mapped},
-    {U'\x0e3b', U'\x0e3e', idna_status::disallowed},
-    {U'\x0e5c', U'\x0e80', idna_status::disallowed},
-    {U'\x0e83', U'\x0e83', idna_status::disallowed},
-    {U'\x0e85', U'\x0e85', idna_status::disallowed},
-    {U'\x0e8b', U'\x0e8b', idna_status::disallowed},
-    {U'\x0ea4', U'\x0ea4', idna_status::disallowed},
-    {U'\x0ea6', U'\x0ea6', idna_status::disallowed},
-    {U'\x0eb3', U'\x0eb3', idna_status::mapped},
-    {U'\x0ebe', U'\x0ebf', idna_status::disallowed},
-    {U'\x0ec5', U'\x0ec5', idna_status::disallowed},
-    {U'\x0ec7', U'\x0ec7', idna_status::disallowed},
-    {U'\x0ecf', U'\x0ecf', idna_status::disallowed},
-    {U'\x0eda', U'\x0edb', idna_status::disallowed},
-    {U'\x0edc', U'\x0edc', idna_status::mapped},
-    {U'\x0edd', U'\x0edd', idna_status::mapped},
-    {U'\x0ee0', U'\x0eff', idna_status::disallowed},
-    {U'\x0f0c', U'\x0f0c', idna_status::mapped},
-    {U'\x0f43', U'\x0f43', idna_status::mapped},
-    {U'\x0f48', U'\x0f48', idna_status::disallowed},
-    {U'\x0f4d', U'\x0f4d', idna_status::mapped},
-    {U'\x0f52', U'\x0f52', idna_status::mapped},
-    {U'\x0f57', U'\x0f57', idna_status::mapped},
-    {U'\x0f5c', U'\x0f5c', idna_status::mapped},
-    {U'\x0f69', U'\x0f69', idna_status::mapped},
-    {U'\x0f6d', U'\x0f70', idna_status::disallowed},
-    {U'\x0f73', U'\x0f73', idna_status::mapped},
-    {U'\x0f75', U'\x0f75', idna_status::mapped},
-    {U'\x0f76', U'\x0f76', idna_status::mapped},
-    {U'\x0f77', U'\x0f77', idna_status::mapped},
-    {U'\x0f78', U'\x0f78', idna_status::mapped},
-    {U'\x0f79', U'\x0f79', idna_status::mapped},
-    {U'\x0f81', U'\x0f81', idna_status::mapped},
-    {U'\x0f93', U'\x0f93', idna_status::mapped},
-    {U'\x0f98', U'\x0f98', idna_status::disallowed},
-    {U'\x0f9d', U'\x0f9d', idna_status::mapped},
-    {U'\x0fa2', U'\x0fa2', idna_status::mapped},
-    {U'\x0fa7', U'\x0fa7', idna_status::mapped},
-    {U'\x0fac', U'\x0fac', idna_status::mapped},
-    {U'\x0fb9', U'\x0fb9', idna_status::mapped},
-    {U'\x0fbd', U'\x0fbd', idna_status::disallowed},
-    {U'\x0fcd', U'\x0fcd', idna_status::disallowed},
-    {U'\x0fdb', U'\x0fff', idna_status::disallowed},
-    {U'\x10a0', U'\x10c5', idna_status::disallowed},
-    {U'\x10c6', U'\x10c6', idna_status::disallowed},
-    {U'\x10c7', U'\x10c7', idna_status::mapped},
-    {U'\x10c8', U'\x10cc', idna_status::disallowed},
-    {U'\x10cd', U'\x10cd', idna_status::mapped},
-    {U'\x10ce', U'\x10cf', idna_status::disallowed},
-    {U'\x10fc', U'\x10fc', idna_status::mapped},
-    {U'\x115f', U'\x1160', idna_status::disallowed},
-    {U'\x1249', U'\x1249', idna_status::disallowed},
-    {U'\x124e', U'\x124f', idna_status::disallowed},
-    {U'\x1257', U'\x1257', idna_status::disallowed},
-    {U'\x1259', U'\x1259', idna_status::disallowed},
-    {U'\x125e', U'\x125f', idna_status::disallowed},
-    {U'\x1289', U'\x1289', idna_status::disallowed},
-    {U'\x128e', U'\x128f', idna_status::disallowed},
-    {U'\x12b1', U'\x12b1', idna_status::disallowed},
-    {U'\x12b6', U'\x12b7', idna_status::disallowed},
-    {U'\x12bf', U'\x12bf', idna_status::disallowed},
-    {U'\x12c1', U'\x12c1', idna_status::disallowed},
-    {U'\x12c6', U'\x12c7', idna_status::disallowed},
-    {U'\x12d7', U'\x12d7', idna_status::disallowed},
-    {U'\x1311', U'\x1311', idna_status::disallowed},
-    {U'\x1316', U'\x1317', idna_status::disallowed},
-    {U'\x135b', U'\x135c', idna_status::disallowed},
-    {U'\x137d', U'\x137f', idna_status::disallowed},
-    {U'\x139a', U'\x139f', idna_status::disallowed},
-    {U'\x13f6', U'\x13f7', idna_status::disallowed},
-    {U'\x13f8', U'\x13f8', idna_status::mapped},
-    {U'\x13f9', U'\x13f9', idna_status::mapped},
-    {U'\x13fa', U'\x13fa', idna_status::mapped},
-    {U'\x13fb', U'\x13fb', idna_status::mapped},
-    {U'\x13fc', U'\x13fc', idna_status::mapped},
-    {U'\x13fd', U'\x13fd', idna_status::mapped},
-    {U'\x13fe', U'\x13ff', idna_status::disallowed},
-    {U'\x1680', U'\x1680', idna_status::disallowed},
-    {U'\x169d', U'\x169f', idna_status::disallowed},
-    {U'\x16f9', U'\x16ff', idna_status::disallowed},
-    {U'\x1716', U'\x171e', idna_status::disallowed},
-    {U'\x1737', U'\x173f', idna_status::disallowed},
-    {U'\x1754', U'\x175f', idna_status::disallowed},
-    {U'\x176d', U'\x176d', idna_status::disallowed},
-    {U'\x1771', U'\x1771', idna_status::disallowed},
-    {U'\x1774', U'\x177f', idna_status::disallowed},
-    {U'\x17b4', U'\x17b5', idna_status::disallowed},
-    {U'\x17de', U'\x17df', idna_status::disallowed},
-    {U'\x17ea', U'\x17ef', idna_status::disallowed},
-    {U'\x17fa', U'\x17ff', idna_status::disallowed},
-    {U'\x1806', U'\x1806', idna_status::disallowed},
-    {U'\x180b', U'\x180d', idna_status::ignored},
-    {U'\x180e', U'\x180e', idna_status::disallowed},
-    {U'\x180f', U'\x180f', idna_status::ignored},
-    {U'\x181a', U'\x181f', idna_status::disallowed},
-    {U'\x1879', U'\x187f', idna_status::disallowed},
-    {U'\x18ab', U'\x18af', idna_status::disallowed},
-    {U'\x18f6', U'\x18ff', idna_status::disallowed},
-    {U'\x191f', U'\x191f', idna_status::disallowed},
-    {U'\x192c', U'\x192f', idna_status::disallowed},
-    {U'\x193c', U'\x193f', idna_status::disallowed},
-    {U'\x1941', U'\x1943', idna_status::disallowed},
-    {U'\x196e', U'\x196f', idna_status::disallowed},
-    {U'\x1975', U'\x197f', idna_status::disallowed},
-    {U'\x19ac', U'\x19af', idna_status::disallowed},
-    {U'\x19ca', U'\x19cf', idna_status::disallowed},
-    {U'\x19db', U'\x19dd', idna_status::disallowed},
-    {U'\x1a1c', U'\x1a1d', idna_status::disallowed},
-    {U'\x1a5f', U'\x1a5f', idna_status::disallowed},
-    {U'\x1a7d', U'\x1a7e', idna_status::disallowed},
-    {U'\x1a8a', U'\x1a8f', idna_status::disallowed},
-    {U'\x1a9a', U'\x1a9f', idna_status::disallowed},
-    {U'\x1aae', U'\x1aaf', idna_status::disallowed},
-    {U'\x1acf', U'\x1aff', idna_status::disallowed},
-    {U'\x1b4d', U'\x1b4f', idna_status::disallowed},
-    {U'\x1b7f', U'\x1b7f', idna_status::disallowed},
-    {U'\x1bf4', U'\x1bfb', idna_status::disallowed},
-    {U'\x1c38', U'\x1c3a', idna_status::disallowed},
-    {U'\x1c4a', U'\x1c4c', idna_status::disallowed},
-    {U'\x1c80', U'\x1c80', idna_status::mapped},
-    {U'\x1c81', U'\x1c81', idna_status::mapped},
-    {U'\x1c82', U'\x1c82', idna_status::mapped},
-    {U'\x1c83', U'\x1c83', idna_status::mapped},
-    {U'\x1c84', U'\x1c85', idna_status::mapped},
-    {U'\x1c86', U'\x1c86', idna_status::mapped},
-    {U'\x1c87', U'\x1c87', idna_status::mapped},
-    {U'\x1c88', U'\x1c88', idna_status::mapped},
-    {U'\x1c89', U'\x1c8f', idna_status::disallowed},
-    {U'\x1c90', U'\x1c90', idna_status::mapped},
-    {U'\x1c91', U'\x1c91', idna_status::mapped},
-    {U'\x1c92', U'\x1c92', idna_status::mapped},
-    {U'\x1c93', U'\x1c93', idna_status::mapped},
-    {U'\x1c94', U'\x1c94', idna_status::mapped},
-    {U'\x1c95', U'\x1c95', idna_status::mapped},
-    {U'\x1c96', U'\x1c96', idna_status::mapped},
-    {U'\x1c97', U'\x1c97', idna_status::mapped},
-    {U'\x1c98', U'\x1c98', idna_status::mapped},
-    {U'\x1c99', U'\x1c99', idna_status::mapped},
-    {U'\x1c9a', U'\x1c9a', idna_status::mapped},
-    {U'\x1c9b', U'\x1c9b', idna_status::mapped},
-    {U'\x1c9c', U'\x1c9c', idna_status::mapped},
-    {U'\x1c9d', U'\x1c9d', idna_status::mapped},
-    {U'\x1c9e', U'\x1c9e', idna_status::mapped},
-    {U'\x1c9f', U'\x1c9f', idna_status::mapped},
-    {U'\x1ca0', U'\x1ca0', idna_status::mapped},
-    {U'\x1ca1', U'\x1ca1', idna_status::mapped},
-    {U'\x1ca2', U'\x1ca2', idna_status::mapped},
-    {U'\x1ca3', U'\x1ca3', idna_status::mapped},
-    {U'\x1ca4', U'\x1ca4', idna_status::mapped},
-    {U'\x1ca5', U'\x1ca5', idna_status::mapped},
-    {U'\x1ca6', U'\x1ca6', idna_status::mapped},
-    {U'\x1ca7', U'\x1ca7', idna_status::mapped},
-    {U'\x1ca8', U'\x1ca8', idna_status::mapped},
-    {U'\x1ca9', U'\x1ca9', idna_status::mapped},
-    {U'\x1caa', U'\x1caa', idna_status::mapped},
-    {U'\x1cab', U'\x1cab', idna_status::mapped},
-    {U'\x1cac', U'\x1cac', idna_status::mapped},
-    {U'\x1cad', U'\x1cad', idna_status::mapped},
-    {U'\x1cae', U'\x1cae', idna_status::mapped},
-    {U'\x1caf', U'\x1caf', idna_status::mapped},
-    {U'\x1cb0', U'\x1cb0', idna_status::mapped},
-    {U'\x1cb1', U'\x1cb1', idna_status::mapped},
-    {U'\x1cb2', U'\x1cb2', idna_status::mapped},
-    {U'\x1cb3', U'\x1cb3', idna_status::mapped},
-    {U'\x1cb4', U'\x1cb4', idna_status::mapped},
-    {U'\x1cb5', U'\x1cb5', idna_status::mapped},
-    {U'\x1cb6', U'\x1cb6', idna_status::mapped},
-    {U'\x1cb7', U'\x1cb7', idna_status::mapped},
-    {U'\x1cb8', U'\x1cb8', idna_status::mapped},
-    {U'\x1cb9', U'\x1cb9', idna_status::mapped},
-    {U'\x1cba', U'\x1cba', idna_status::mapped},
-    {U'\x1cbb', U'\x1cbc', idna_status::disallowed},
-    {U'\x1cbd', U'\x1cbd', idna_status::mapped},
-    {U'\x1cbe', U'\x1cbe', idna_status::mapped},
-    {U'\x1cbf', U'\x1cbf', idna_status::mapped},
-    {U'\x1cc8', U'\x1ccf', idna_status::disallowed},
-    {U'\x1cfb', U'\x1cff', idna_status::disallowed},
-    {U'\x1d2c', U'\x1d2c', idna_status::mapped},
-    {U'\x1d2d', U'\x1d2d', idna_status::mapped},
-    {U'\x1d2e', U'\x1d2e', idna_status::mapped},
-    {U'\x1d30', U'\x1d30', idna_status::mapped},
-    {U'\x1d31', U'\x1d31', idna_status::mapped},
-    {U'\x1d32', U'\x1d32', idna_status::mapped},
-    {U'\x1d33', U'\x1d33', idna_status::mapped},
-    {U'\x1d34', U'\x1d34', idna_status::mapped},
-    {U'\x1d35', U'\x1d35', idna_status::mapped},
-    {U'\x1d36', U'\x1d36', idna_status::mapped},
-    {U'\x1d37', U'\x1d37', idna_status::mapped},
-    {U'\x1d38', U'\x1d38', idna_status::mapped},
-    {U'\x1d39', U'\x1d39', idna_status::mapped},
-    {U'\x1d3a', U'\x1d3a', idna_status::mapped},
-    {U'\x1d3c', U'\x1d3c', idna_status::mapped},
-    {U'\x1d3d', U'\x1d3d', idna_status::mapped},
-    {U'\x1d3e', U'\x1d3e', idna_status::mapped},
-    {U'\x1d3f', U'\x1d3f', idna_status::mapped},
-    {U'\x1d40', U'\x1d40', idna_status::mapped},
-    {U'\x1d41', U'\x1d41', idna_status::mapped},
-    {U'\x1d42', U'\x1d42', idna_status::mapped},
-    {U'\x1d43', U'\x1d43', idna_status::mapped},
-    {U'\x1d44', U'\x1d44', idna_status::mapped},
-    {U'\x1d45', U'\x1d45', idna_status::mapped},
-    {U'\x1d46', U'\x1d46', idna_status::mapped},
-    {U'\x1d47', U'\x1d47', idna_status::mapped},
-    {U'\x1d48', U'\x1d48', idna_status::mapped},
-    {U'\x1d49', U'\x1d49', idna_status::mapped},
-    {U'\x1d4a', U'\x1d4a', idna_status::mapped},
-    {U'\x1d4b', U'\x1d4b', idna_status::mapped},
-    {U'\x1d4c', U'\x1d4c', idna_status::mapped},
-    {U'\x1d4d', U'\x1d4d', idna_status::mapped},
-    {U'\x1d4f', U'\x1d4f', idna_status::mapped},
-    {U'\x1d50', U'\x1d50', idna_status::mapped},
-    {U'\x1d51', U'\x1d51', idna_status::mapped},
-    {U'\x1d52', U'\x1d52', idna_status::mapped},
-    {U'\x1d53', U'\x1d53', idna_status::mapped},
-    {U'\x1d54', U'\x1d54', idna_status::mapped},
-    {U'\x1d55', U'\x1d55', idna_status::mapped},
-    {U'\x1d56', U'\x1d56', idna_status::mapped},
-    {U'\x1d57', U'\x1d57', idna_status::mapped},
-    {U'\x1d58', U'\x1d58', idna_status::mapped},
-    {U'\x1d59', U'\x1d59', idna_status::mapped},
-    {U'\x1d5a', U'\x1d5a', idna_status::mapped},
-    {U'\x1d5b', U'\x1d5b', idna_status::mapped},
-    {U'\x1d5c', U'\x1d5c', idna_status::mapped},
-    {U'\x1d5d', U'\x1d5d', idna_status::mapped},
-    {U'\x1d5e', U'\x1d5e', idna_status::mapped},
-    {U'\x1d5f', U'\x1d5f', idna_status::mapped},
-    {U'\x1d60', U'\x1d60', idna_status::mapped},
-    {U'\x1d61', U'\x1d61', idna_status::mapped},
-    {U'\x1d62', U'\x1d62', idna_status::mapped},
-    {U'\x1d63', U'\x1d63', idna_status::mapped},
-    {U'\x1d64', U'\x1d64', idna_status::mapped},
-    {U'\x1d65', U'\x1d65', idna_status::mapped},
-    {U'\x1d66', U'\x1d66', idna_status::mapped},
-    {U'\x1d67', U'\x1d67', idna_status::mapped},
-    {U'\x1d68', U'\x1d68', idna_status::mapped},
-    {U'\x1d69', U'\x1d69', idna_status::mapped},
-    {U'\x1d6a', U'\x1d6a', idna_status::mapped},
-    {U'\x1d78', U'\x1d78', idna_status::mapped},
-    {U'\x1d9b', U'\x1d9b', idna_status::mapped},
-    {U'\x1d9c', U'\x1d9c', idna_status::mapped},
-    {U'\x1d9d', U'\x1d9d', idna_status::mapped},
-    {U'\x1d9e', U'\x1d9e', idna_status::mapped},
-    {U'\x1d9f', U'\x1d9f', idna_status::mapped},
-    {U'\x1da0', U'\x1da0', idna_status::mapped},
-    {U'\x1da1', U'\x1da1', idna_status::mapped},
-    {U'\x1da2', U'\x1da2', idna_status::mapped},
-    {U'\x1da3', U'\x1da3', idna_status::mapped},
-    {U'\x1da4', U'\x1da4', idna_status::mapped},
-    {U'\x1da5', U'\x1da5', idna_status::mapped},
-    {U'\x1da6', U'\x1da6', idna_status::mapped},
-    {U'\x1da7', U'\x1da7', idna_status::mapped},
-    {U'\x1da8', U'\x1da8', idna_status::mapped},
-    {U'\x1da9', U'\x1da9', idna_status::mapped},
-    {U'\x1daa', U'\x1daa', idna_status::mapped},
-    {U'\x1dab', U'\x1dab', idna_status::mapped},
-    {U'\x1dac', U'\x1dac', idna_status::mapped},
-    {U'\x1dad', U'\x1dad', idna_status::mapped},
-    {U'\x1dae', U'\x1dae', idna_status::mapped},
-    {U'\x1daf', U'\x1daf', idna_status::mapped},
-    {U'\x1db0', U'\x1db0', idna_status::mapped},
-    {U'\x1db1', U'\x1db1', idna_status::mapped},
-    {U'\x1db2', U'\x1db2', idna_status::mapped},
-    {U'\x1db3', U'\x1db3', idna_status::mapped},
-    {U'\x1db4', U'\x1db4', idna_status::mapped},
-    {U'\x1db5', U'\x1db5', idna_status::mapped},
-    {U'\x1db6', U'\x1db6', idna_status::mapped},
-    {U'\x1db7', U'\x1db7', idna_status::mapped},
-    {U'\x1db8', U'\x1db8', idna_status::mapped},
-    {U'\x1db9', U'\x1db9', idna_status::mapped},
-    {U'\x1dba', U'\x1dba', idna_status::mapped},
-    {U'\x1dbb', U'\x1dbb', idna_status::mapped},
-    {U'\x1dbc', U'\x1dbc', idna_status::mapped},
-    {U'\x1dbd', U'\x1dbd', idna_status::mapped},
-    {U'\x1dbe', U'\x1dbe', idna_status::mapped},
-    {U'\x1dbf', U'\x1dbf', idna_status::mapped},
-    {U'\x1e00', U'\x1e00', idna_status::mapped},
-    {U'\x1e02', U'\x1e02', idna_status::mapped},
-    {U'\x1e04', U'\x1e04', idna_status::mapped},
-    {U'\x1e06', U'\x1e06', idna_status::mapped},
-    {U'\x1e08', U'\x1e08', idna_status::mapped},
-    {U'\x1e0a', U'\x1e0a', idna_status::mapped},
-    {U'\x1e0c', U'\x1e0c', idna_status::mapped},
-    {U'\x1e0e', U'\x1e0e', idna_status::mapped},
-    {U'\x1e10', U'\x1e10', idna_status::mapped},
-    {U'\x1e12', U'\x1e12', idna_status::mapped},
-    {U'\x1e14', U'\x1e14', idna_status::mapped},
-    {U'\x1e16', U'\x1e16', idna_status::mapped},
-    {U'\x1e18', U'\x1e18', idna_status::mapped},
-    {U'\x1e1a', U'\x1e1a', idna_status::mapped},
-    {U'\x1e1c', U'\x1e1c', idna_status::mapped},
-    {U'\x1e1e', U'\x1e1e', idna_status::mapped},
-    {U'\x1e20', U'\x1e20', idna_status::mapped},
-    {U'\x1e22', U'\x1e22', idna_status::mapped},
-    {U'\x1e24', U'\x1e24', idna_status::mapped},
-    {U'\x1e26', U'\x1e26', idna_status::mapped},
-    {U'\x1e28', U'\x1e28', idna_status::mapped},
-    {U'\x1e2a', U'\x1e2a', idna_status::mapped},
-    {U'\x1e2c', U'\x1e2c', idna_status::mapped},
-    {U'\x1e2e', U'\x1e2e', idna_status::mapped},
-    {U'\x1e30', U'\x1e30', idna_status::mapped},
-    {U'\x1e32', U'\x1e32', idna_status::mapped},
-    {U'\x1e34', U'\x1e34', idna_status::mapped},
-    {U'\x1e36', U'\x1e36', idna_status::mapped},
-    {U'\x1e38', U'\x1e38', idna_status::mapped},
-    {U'\x1e3a', U'\x1e3a', idna_status::mapped},
-    {U'\x1e3c', U'\x1e3c', idna_status::mapped},
-    {U'\x1e3e', U'\x1e3e', idna_status::mapped},
-    {U'\x1e40', U'\x1e40', idna_status::mapped},
-    {U'\x1e42', U'\x1e42', idna_status::mapped},
-    {U'\x1e44', U'\x1e44', idna_status::mapped},
-    {U'\x1e46', U'\x1e46', idna_status::mapped},
-    {U'\x1e48', U'\x1e48', idna_status::mapped},
-    {U'\x1e4a', U'\x1e4a', idna_status::mapped},
-    {U'\x1e4c', U'\x1e4c', idna_status::mapped},
-    {U'\x1e4e', U'\x1e4e', idna_status::mapped},
-    {U'\x1e50', U'\x1e50', idna_status::mapped},
-    {U'\x1e52', U'\x1e52', idna_status::mapped},
-    {U'\x1e54', U'\x1e54', idna_status::mapped},
-    {U'\x1e56', U'\x1e56', idna_status::mapped},
-    {U'\x1e58', U'\x1e58', idna_status::mapped},
-    {U'\x1e5a', U'\x1e5a', idna_status::mapped},
-    {U'\x1e5c', U'\x1e5c', idna_status::mapped},
-    {U'\x1e5e', U'\x1e5e', idna_status::mapped},
-    {U'\x1e60', U'\x1e60', idna_status::mapped},
-    {U'\x1e62', U'\x1e62', idna_status::mapped},
-    {U'\x1e64', U'\x1e64', idna_status::mapped},
-    {U'\x1e66', U'\x1e66', idna_status::mapped},
-    {U'\x1e68', U'\x1e68', idna_status::mapped},
-    {U'\x1e6a', U'\x1e6a', idna_status::mapped},
-    {U'\x1e6c', U'\x1e6c', idna_status::mapped},
-    {U'\x1e6e', U'\x1e6e', idna_status::mapped},
-    {U'\x1e70', U'\x1e70', idna_status::mapped},
-    {U'\x1e72', U'\x1e72', idna_status::mapped},
-    {U'\x1e74', U'\x1e74', idna_status::mapped},
-    {U'\x1e76', U'\x1e76', idna_status::mapped},
-    {U'\x1e78', U'\x1e78', idna_status::mapped},
-    {U'\x1e7a', U'\x1e7a', idna_status::mapped},
-    {U'\x1e7c', U'\x1e7c', idna_status::mapped},
-    {U'\x1e7e', U'\x1e7e', idna_status::mapped},
-    {U'\x1e80', U'\x1e80', idna_status::mapped},
-    {U'\x1e82', U'\x1e82', idna_status::mapped},
-    {U'\x1e84', U'\x1e84', idna_status::mapped},
-    {U'\x1e86', U'\x1e86', idna_status::mapped},
-    {U'\x1e88', U'\x1e88', idna_status::mapped},
-    {U'\x1e8a', U'\x1e8a', idna_status::mapped},
-    {U'\x1e8c', U'\x1e8c', idna_status::mapped},
-    {U'\x1e8e', U'\x1e8e', idna_status::mapped},
-    {U'\x1e90', U'\x1e90', idna_status::mapped},
-    {U'\x1e92', U'\x1e92', idna_status::mapped},
-    {U'\x1e94', U'\x1e94', idna_status::mapped},
-    {U'\x1e9a', U'\x1e9a', idna_status::mapped},
-    {U'\x1e9b', U'\x1e9b', idna_status::mapped},
-    {U'\x1e9e', U'\x1e9e', idna_status::mapped},
-    {U'\x1ea0', U'\x1ea0', idna_status::mapped},
-    {U'\x1ea2', U'\x1ea2', idna_status::mapped},
-    {U'\x1ea4', U'\x1ea4', idna_status::mapped},
-    {U'\x1ea6', U'\x1ea6', idna_status::mapped},
-    {U'\x1ea8', U'\x1ea8', idna_status::mapped},
-    {U'\x1eaa', U'\x1eaa', idna_status::mapped},
-    {U'\x1eac', U'\x1eac', idna_status::mapped},
-    {U'\x1eae', U'\x1eae', idna_status::mapped},
-    {U'\x1eb0', U'\x1eb0', idna_status::mapped},
-    {U'\x1eb2', U'\x1eb2', idna_status::mapped},
-    {U'\x1eb4', U'\x1eb4', idna_status::mapped},
-    {U'\x1eb6', U'\x1eb6', idna_status::mapped},
-    {U'\x1eb8', U'\x1eb8', idna_status::mapped},
-    {U'\x1eba', U'\x1eba', idna_status::mapped},
-    {U'\x1ebc', U'\x1ebc', idna_status::mapped},
-    {U'\x1ebe', U'\x1ebe', idna_status::mapped},
-    {U'\x1ec0', U'\x1ec0', idna_status::mapped},
-    {U'\x1ec2', U'\x1ec2', idna_status::mapped},
-    {U'\x1ec4', U'\x1ec4', idna_status::mapped},
-    {U'\x1ec6', U'\x1ec6', idna_status::mapped},
-    {U'\x1ec8', U'\x1ec8', idna_status::mapped},
-    {U'\x1eca', U'\x1eca', idna_status::mapped},
-    {U'\x1ecc', U'\x1ecc', idna_status::mapped},
-    {U'\x1ece', U'\x1ece', idna_status::mapped},
-    {U'\x1ed0', U'\x1ed0', idna_status::mapped},
-    {U'\x1ed2', U'\x1ed2', idna_status::mapped},
-    {U'\x1ed4', U'\x1ed4', idna_status::mapped},
-    {U'\x1ed6', U'\x1ed6', idna_status::mapped},
-    {U'\x1ed8', U'\x1ed8', idna_status::mapped},
-    {U'\x1eda', U'\x1eda', idna_status::mapped},
-    {U'\x1edc', U'\x1edc', idna_status::mapped},
-    {U'\x1ede', U'\x1ede', idna_status::mapped},
-    {U'\x1ee0', U'\x1ee0', idna_status::mapped},
-    {U'\x1ee2', U'\x1ee2', idna_status::mapped},
-    {U'\x1ee4', U'\x1ee4', idna_status::mapped},
-    {U'\x1ee6', U'\x1ee6', idna_status::mapped},
-    {U'\x1ee8', U'\x1ee8', idna_status::mapped},
-    {U'\x1eea', U'\x1eea', idna_status::mapped},
-    {U'\x1eec', U'\x1eec', idna_status::mapped},
-    {U'\x1eee', U'\x1eee', idna_status::mapped},
-    {U'\x1ef0', U'\x1ef0', idna_status::mapped},
-    {U'\x1ef2', U'\x1ef2', idna_status::mapped},
-    {U'\x1ef4', U'\x1ef4', idna_status::mapped},
-    {U'\x1ef6', U'\x1ef6', idna_status::mapped},
-    {U'\x1ef8', U'\x1ef8', idna_status::mapped},
-    {U'\x1efa', U'\x1efa', idna_status::mapped},
-    {U'\x1efc', U'\x1efc', idna_status::mapped},
-    {U'\x1efe', U'\x1efe', idna_status::mapped},
-    {U'\x1f08', U'\x1f08', idna_status::mapped},
-    {U'\x1f09', U'\x1f09', idna_status::mapped},
-    {U'\x1f0a', U'\x1f0a', idna_status::mapped},
-    {U'\x1f0b', U'\x1f0b', idna_status::mapped},
-    {U'\x1f0c', U'\x1f0c', idna_status::mapped},
-    {U'\x1f0d', U'\x1f0d', idna_status::mapped},
-    {U'\x1f0e', U'\x1f0e', idna_status::mapped},
-    {U'\x1f0f', U'\x1f0f', idna_status::mapped},
-    {U'\x1f16', U'\x1f17', idna_status::disallowed},
-    {U'\x1f18', U'\x1f18', idna_status::mapped},
-    {U'\x1f19', U'\x1f19', idna_status::mapped},
-    {U'\x1f1a', U'\x1f1a', idna_status::mapped},
-    {U'\x1f1b', U'\x1f1b', idna_status::mapped},
-    {U'\x1f1c', U'\x1f1c', idna_status::mapped},
-    {U'\x1f1d', U'\x1f1d', idna_status::mapped},
-    {U'\x1f1e', U'\x1f1f', idna_status::disallowed},
-    {U'\x1f28', U'\x1f28', idna_status::mapped},
-    {U'\x1f29', U'\x1f29', idna_status::mapped},
-    {U'\x1f2a', U'\x1f2a', idna_status::mapped},
-    {U'\x1f2b', U'\x1f2b', idna_status::mapped},
-    {U'\x1f2c', U'\x1f2c', idna_status::mapped},
-    {U'\x1f2d', U'\x1f2d', idna_status::mapped},
-    {U'\x1f2e', U'\x1f2e', idna_status::mapped},
-    {U'\x1f2f', U'\x1f2f', idna_status::mapped},
-    {U'\x1f38', U'\x1f38', idna_status::mapped},
-    {U'\x1f39', U'\x1f39', idna_status::mapped},
-    {U'\x1f3a', U'\x1f3a', idna_status::mapped},
-    {U'\x1f3b', U'\x1f3b', idna_status::mapped},
-    {U'\x1f3c', U'\x1f3c', idna_status::mapped},
-    {U'\x1f3d', U'\x1f3d', idna_status::mapped},
-    {U'\x1f3e', U'\x1f3e', idna_status::mapped},
-    {U'\x1f3f', U'\x1f3f', idna_status::mapped},
-    {U'\x1f46', U'\x1f47', idna_status::disallowed},
-    {U'\x1f48', U'\x1f48', idna_status::mapped},
-    {U'\x1f49', U'\x1f49', idna_status::mapped},
-    {U'\x1f4a', U'\x1f4a', idna_status::mapped},
-    {U'\x1f4b', U'\x1f4b', idna_status::mapped},
-    {U'\x1f4c', U'\x1f4c', idna_status::mapped},
-    {U'\x1f4d', U'\x1f4d', idna_status::mapped},
-    {U'\x1f4e', U'\x1f4f', idna_status::disallowed},
-    {U'\x1f58', U'\x1f58', idna_status::disallowed},
-    {U'\x1f59', U'\x1f59', idna_status::mapped},
-    {U'\x1f5a', U'\x1f5a', idna_status::disallowed},
-    {U'\x1f5b', U'\x1f5b', idna_status::mapped},
-    {U'\x1f5c', U'\x1f5c', idna_status::disallowed},
-    {U'\x1f5d', U'\x1f5d', idna_status::mapped},
-    {U'\x1f5e', U'\x1f5e', idna_status::disallowed},
-    {U'\x1f5f', U'\x1f5f', idna_status::mapped},
-    {U'\x1f68', U'\x1f68', idna_status::mapped},
-    {U'\x1f69', U'\x1f69', idna_status::mapped},
-    {U'\x1f6a', U'\x1f6a', idna_status::mapped},
-    {U'\x1f6b', U'\x1f6b', idna_status::mapped},
-    {U'\x1f6c', U'\x1f6c', idna_status::mapped},
-    {U'\x1f6d', U'\x1f6d', idna_status::mapped},
-    {U'\x1f6e', U'\x1f6e', idna_status::mapped},
-    {U'\x1f6f', U'\x1f6f', idna_status::mapped},
-    {U'\x1f71', U'\x1f71', idna_status::mapped},
-    {U'\x1f73', U'\x1f73', idna_status::mapped},
-    {U'\x1f75', U'\x1f75', idna_status::mapped},
-    {U'\x1f77', U'\x1f77', idna_status::mapped},
-    {U'\x1f79', U'\x1f79', idna_status::mapped},
-    {U'\x1f7b', U'\x1f7b', idna_status::mapped},
-    {U'\x1f7d', U'\x1f7d', idna_status::mapped},
-    {U'\x1f7e', U'\x1f7f', idna_status::disallowed},
-    {U'\x1f80', U'\x1f80', idna_status::mapped},
-    {U'\x1f81', U'\x1f81', idna_status::mapped},
-    {U'\x1f82', U'\x1f82', idna_status::mapped},
-    {U'\x1f83', U'\x1f83', idna_status::mapped},
-    {U'\x1f84', U'\x1f84', idna_status::mapped},
-    {U'\x1f85', U'\x1f85', idna_status::mapped},
-    {U'\x1f86', U'\x1f86', idna_status::mapped},
-    {U'\x1f87', U'\x1f87', idna_status::mapped},
-    {U'\x1f88', U'\x1f88', idna_status::mapped},
-    {U'\x1f89', U'\x1f89', idna_status::mapped},
-    {U'\x1f8a', U'\x1f8a', idna_status::mapped},
-    {U'\x1f8b', U'\x1f8b', idna_status::mapped},
-    {U'\x1f8c', U'\x1f8c', idna_status::mapped},
-    {U'\x1f8d', U'\x1f8d', idna_status::mapped},
-    {U'\x1f8e', U'\x1f8e', idna_status::mapped},
-    {U'\x1f8f', U'\x1f8f', idna_status::mapped},
-    {U'\x1f90', U'\x1f90', idna_status::mapped},
-    {U'\x1f91', U'\x1f91', idna_status::mapped},
-    {U'\x1f92', U'\x1f92', idna_status::mapped},
-    {U'\x1f93', U'\x1f93', idna_status::mapped},
-    {U'\x1f94', U'\x1f94', idna_status::mapped},
-    {U'\x1f95', U'\x1f95', idna_status::mapped},
-    {U'\x1f96', U'\x1f96', idna_status::mapped},
-    {U'\x1f97', U'\x1f97', idna_status::mapped},
-    {U'\x1f98', U'\x1f98', idna_status::mapped},
-    {U'\x1f99', U'\x1f99', idna_status::mapped},
-    {U'\x1f9a', U'\x1f9a', idna_status::mapped},
-    {U'\x1f9b', U'\x1f9b', idna_status::mapped},
-    {U'\x1f9c', U'\x1f9c', idna_status::mapped},
-    {U'\x1f9d', U'\x1f9d', idna_status::mapped},
-    {U'\x1f9e', U'\x1f9e', idna_status::mapped},
-    {U'\x1f9f', U'\x1f9f', idna_status::mapped},
-    {U'\x1fa0', U'\x1fa0', idna_status::mapped},
-    {U'\x1fa1', U'\x1fa1', idna_status::mapped},
-    {U'\x1fa2', U'\x1fa2', idna_status::mapped},
-    {U'\x1fa3', U'\x1fa3', idna_status::mapped},
-    {U'\x1fa4', U'\x1fa4', idna_status::mapped},
-    {U'\x1fa5', U'\x1fa5', idna_status::mapped},
-    {U'\x1fa6', U'\x1fa6', idna_status::mapped},
-    {U'\x1fa7', U'\x1fa7', idna_status::mapped},
-    {U'\x1fa8', U'\x1fa8', idna_status::mapped},
-    {U'\x1fa9', U'\x1fa9', idna_status::mapped},
-    {U'\x1faa', U'\x1faa', idna_status::mapped},
-    {U'\x1fab', U'\x1fab', idna_status::mapped},
-    {U'\x1fac', U'\x1fac', idna_status::mapped},
-    {U'\x1fad', U'\x1fad', idna_status::mapped},
-    {U'\x1fae', U'\x1fae', idna_status::mapped},
-    {U'\x1faf', U'\x1faf', idna_status::mapped},
-    {U'\x1fb2', U'\x1fb2', idna_status::mapped},
-    {U'\x1fb3', U'\x1fb3', idna_status::mapped},
-    {U'\x1fb4', U'\x1fb4', idna_status::mapped},
-    {U'\x1fb5', U'\x1fb5', idna_status::disallowed},
-    {U'\x1fb7', U'\x1fb7', idna_status::mapped},
-    {U'\x1fb8', U'\x1fb8', idna_status::mapped},
-    {U'\x1fb9', U'\x1fb9', idna_status::mapped},
-    {U'\x1fba', U'\x1fba', idna_status::mapped},
-    {U'\x1fbb', U'\x1fbb', idna_status::mapped},
-    {U'\x1fbc', U'\x1fbc', idna_status::mapped},
-    {U'\x1fbd', U'\x1fbd', idna_status::disallowed_std3_mapped},
-    {U'\x1fbe', U'\x1fbe', idna_status::mapped},
-    {U'\x1fbf', U'\x1fbf', idna_status::disallowed_std3_mapped},
-    {U'\x1fc0', U'\x1fc0', idna_status::disallowed_std3_mapped},
-    {U'\x1fc1', U'\x1fc1', idna_status::disallowed_std3_mapped},
-    {U'\x1fc2', U'\x1fc2', idna_status::mapped},
-    {U'\x1fc3', U'\x1fc3', idna_status::mapped},
-    {U'\x1fc4', U'\x1fc4', idna_status::mapped},
-    {U'\x1fc5', U'\x1fc5', idna_status::disallowed},
-    {U'\x1fc7', U'\x1fc7', idna_status::mapped},
-    {U'\x1fc8', U'\x1fc8', idna_status::mapped},
-    {U'\x1fc9', U'\x1fc9', idna_status::mapped},
-    {U'\x1fca', U'\x1fca', idna_status::mapped},
-    {U'\x1fcb', U'\x1fcb', idna_status::mapped},
-    {U'\x1fcc', U'\x1fcc', idna_status::mapped},
-    {U'\x1fcd', U'\x1fcd', idna_status::disallowed_std3_mapped},
-    {U'\x1fce', U'\x1fce', idna_status::disallowed_std3_mapped},
-    {U'\x1fcf', U'\x1fcf', idna_status::disallowed_std3_mapped},
-    {U'\x1fd3', U'\x1fd3', idna_status::mapped},
-    {U'\x1fd4', U'\x1fd5', idna_status::disallowed},
-    {U'\x1fd8', U'\x1fd8', idna_status::mapped},
-    {U'\x1fd9', U'\x1fd9', idna_status::mapped},
-    {U'\x1fda', U'\x1fda', idna_status::mapped},
-    {U'\x1fdb', U'\x1fdb', idna_status::mapped},
-    {U'\x1fdc', U'\x1fdc', idna_status::disallowed},
-    {U'\x1fdd', U'\x1fdd', idna_status::disallowed_std3_mapped},
-    {U'\x1fde', U'\x1fde', idna_status::disallowed_std3_mapped},
-    {U'\x1fdf', U'\x1fdf', idna_status::disallowed_std3_mapped},
-    {U'\x1fe3', U'\x1fe3', idna_status::mapped},
-    {U'\x1fe8', U'\x1fe8', idna_status::mapped},
-    {U'\x1fe9', U'\x1fe9', idna_status::mapped},
-    {U'\x1fea', U'\x1fea', idna_status::mapped},
-    {U'\x1feb', U'\x1feb', idna_status::mapped},
-    {U'\x1fec', U'\x1fec', idna_status::mapped},
-    {U'\x1fed', U'\x1fed', idna_status::disallowed_std3_mapped},
-    {U'\x1fee', U'\x1fee', idna_status::disallowed_std3_mapped},
-    {U'\x1fef', U'\x1fef', idna_status::disallowed_std3_mapped},
-    {U'\x1ff0', U'\x1ff1', idna_status::disallowed},
-    {U'\x1ff2', U'\x1ff2', idna_status::mapped},
-    {U'\x1ff3', U'\x1ff3', idna_status::mapped},
-    {U'\x1ff4', U'\x1ff4', idna_status::mapped},
-    {U'\x1ff5', U'\x1ff5', idna_status::disallowed},
-    {U'\x1ff7', U'\x1ff7', idna_status::mapped},
-    {U'\x1ff8', U'\x1ff8', idna_status::mapped},
-    {U'\x1ff9', U'\x1ff9', idna_status::mapped},
-    {U'\x1ffa', U'\x1ffa', idna_status::mapped},
-    {U'\x1ffb', U'\x1ffb', idna_status::mapped},
-    {U'\x1ffc', U'\x1ffc', idna_status::mapped},
-    {U'\x1ffd', U'\x1ffd', idna_status::disallowed_std3_mapped},
-    {U'\x1ffe', U'\x1ffe', idna_status::disallowed_std3_mapped},
-    {U'\x1fff', U'\x1fff', idna_status::disallowed},
-    {U'\x2000', U'\x200a', idna_status::disallowed_std3_mapped},
-    {U'\x200b', U'\x200b', idna_status::ignored},
-    {U'\x200c', U'\x200d', idna_status::deviation},
-    {U'\x200e', U'\x200f', idna_status::disallowed},
-    {U'\x2011', U'\x2011', idna_status::mapped},
-    {U'\x2017', U'\x2017', idna_status::disallowed_std3_mapped},
-    {U'\x2024', U'\x2026', idna_status::disallowed},
-    {U'\x2028', U'\x202e', idna_status::disallowed},
-    {U'\x202f', U'\x202f', idna_status::disallowed_std3_mapped},
-    {U'\x2033', U'\x2033', idna_status::mapped},
-    {U'\x2034', U'\x2034', idna_status::mapped},
-    {U'\x2036', U'\x2036', idna_status::mapped},
-    {U'\x2037', U'\x2037', idna_status::mapped},
-    {U'\x203c', U'\x203c', idna_status::disallowed_std3_mapped},
-    {U'\x203e', U'\x203e', idna_status::disallowed_std3_mapped},
-    {U'\x2047', U'\x2047', idna_status::disallowed_std3_mapped},
-    {U'\x2048', U'\x2048', idna_status::disallowed_std3_mapped},
-    {U'\x2049', U'\x2049', idna_status::disallowed_std3_mapped},
-    {U'\x2057', U'\x2057', idna_status::mapped},
-    {U'\x205f', U'\x205f', idna_status::disallowed_std3_mapped},
-    {U'\x2060', U'\x2060', idna_status::ignored},
-    {U'\x2061', U'\x2063', idna_status::disallowed},
-    {U'\x2064', U'\x2064', idna_status::ignored},
-    {U'\x2065', U'\x2065', idna_status::disallowed},
-    {U'\x2066', U'\x2069', idna_status::disallowed},
-    {U'\x206a', U'\x206f', idna_status::disallowed},
-    {U'\x2070', U'\x2070', idna_status::mapped},
-    {U'\x2071', U'\x2071', idna_status::mapped},
-    {U'\x2072', U'\x2073', idna_status::disallowed},
-    {U'\x2074', U'\x2074', idna_status::mapped},
-    {U'\x2075', U'\x2075', idna_status::mapped},
-    {U'\x2076', U'\x2076', idna_status::mapped},
-    {U'\x2077', U'\x2077', idna_status::mapped},
-    {U'\x2078', U'\x2078', idna_status::mapped},
-    {U'\x2079', U'\x2079', idna_status::mapped},
-    {U'\x207a', U'\x207a', idna_status::disallowed_std3_mapped},
-    {U'\x207b', U'\x207b', idna_status::mapped},
-    {U'\x207c', U'\x207c', idna_status::disallowed_std3_mapped},
-    {U'\x207d', U'\x207d', idna_status::disallowed_std3_mapped},
-    {U'\x207e', U'\x207e', idna_status::disallowed_std3_mapped},
-    {U'\x207f', U'\x207f', idna_status::mapped},
-    {U'\x2080', U'\x2080', idna_status::mapped},
-    {U'\x2081', U'\x2081', idna_status::mapped},
-    {U'\x2082', U'\x2082', idna_status::mapped},
-    {U'\x2083', U'\x2083', idna_status::mapped},
-    {U'\x2084', U'\x2084', idna_status::mapped},
-    {U'\x2085', U'\x2085', idna_status::mapped},
-    {U'\x2086', U'\x2086', idna_status::mapped},
-    {U'\x2087', U'\x2087', idna_status::mapped},
-    {U'\x2088', U'\x2088', idna_status::mapped},
-    {U'\x2089', U'\x2089', idna_status::mapped},
-    {U'\x208a', U'\x208a', idna_status::disallowed_std3_mapped},
-    {U'\x208b', U'\x208b', idna_status::mapped},
-    {U'\x208c', U'\x208c', idna_status::disallowed_std3_mapped},
-    {U'\x208d', U'\x208d', idna_status::disallowed_std3_mapped},
-    {U'\x208e', U'\x208e', idna_status::disallowed_std3_mapped},
-    {U'\x208f', U'\x208f', idna_status::disallowed},
-    {U'\x2090', U'\x2090', idna_status::mapped},
-    {U'\x2091', U'\x2091', idna_status::mapped},
-    {U'\x2092', U'\x2092', idna_status::mapped},
-    {U'\x2093', U'\x2093', idna_status::mapped},
-    {U'\x2094', U'\x2094', idna_status::mapped},
-    {U'\x2095', U'\x2095', idna_status::mapped},
-    {U'\x2096', U'\x2096', idna_status::mapped},
-    {U'\x2097', U'\x2097', idna_status::mapped},
-    {U'\x2098', U'\x2098', idna_status::mapped},
-    {U'\x2099', U'\x2099', idna_status::mapped},
-    {U'\x209a', U'\x209a', idna_status::mapped},
-    {U'\x209b', U'\x209b', idna_status::mapped},
-    {U'\x209c', U'\x209c', idna_status::mapped},
-    {U'\x209d', U'\x209f', idna_status::disallowed},
-    {U'\x20a8', U'\x20a8', idna_status::mapped},
-    {U'\x20c1', U'\x20cf', idna_status::disallowed},
-    {U'\x20f1', U'\x20ff', idna_status::disallowed},
-    {U'\x2100', U'\x2100', idna_status::disallowed_std3_mapped},
-    {U'\x2101', U'\x2101', idna_status::disallowed_std3_mapped},
-    {U'\x2102', U'\x2102', idna_status::mapped},
-    {U'\x2103', U'\x2103', idna_status::mapped},
-    {U'\x2105', U'\x2105', idna_status::disallowed_std3_mapped},
-    {U'\x2106', U'\x2106', idna_status::disallowed_std3_mapped},
-    {U'\x2107', U'\x2107', idna_status::mapped},
-    {U'\x2109', U'\x2109', idna_status::mapped},
-    {U'\x210a', U'\x210a', idna_status::mapped},
-    {U'\x210b', U'\x210e', idna_status::mapped},
-    {U'\x210f', U'\x210f', idna_status::mapped},
-    {U'\x2110', U'\x2111', idna_status::mapped},
-    {U'\x2112', U'\x2113', idna_status::mapped},
-    {U'\x2115', U'\x2115', idna_status::mapped},
-    {U'\x2116', U'\x2116', idna_status::mapped},
-    {U'\x2119', U'\x2119', idna_status::mapped},
-    {U'\x211a', U'\x211a', idna_status::mapped},
-    {U'\x211b', U'\x211d', idna_status::mapped},
-    {U'\x2120', U'\x2120', idna_status::mapped},
-    {U'\x2121', U'\x2121', idna_status::mapped},
-    {U'\x2122', U'\x2122', idna_status::mapped},
-    {U'\x2124', U'\x2124', idna_status::mapped},
-    {U'\x2126', U'\x2126', idna_status::mapped},
-    {U'\x2128', U'\x2128', idna_status::mapped},
-    {U'\x212a', U'\x212a', idna_status::mapped},
-    {U'\x212b', U'\x212b', idna_status::mapped},
-    {U'\x212c', U'\x212c', idna_status::mapped},
-    {U'\x212d', U'\x212d', idna_status::mapped},
-    {U'\x212f', U'\x2130', idna_status::mapped},
-    {U'\x2131', U'\x2131', idna_status::mapped},
-    {U'\x2132', U'\x2132', idna_status::disallowed},
-    {U'\x2133', U'\x2133', idna_status::mapped},
-    {U'\x2134', U'\x2134', idna_status::mapped},
-    {U'\x2135', U'\x2135', idna_status::mapped},
-    {U'\x2136', U'\x2136', idna_status::mapped},
-    {U'\x2137', U'\x2137', idna_status::mapped},
-    {U'\x2138', U'\x2138', idna_status::mapped},
-    {U'\x2139', U'\x2139', idna_status::mapped},
-    {U'\x213b', U'\x213b', idna_status::mapped},
-    {U'\x213c', U'\x213c', idna_status::mapped},
-    {U'\x213d', U'\x213e', idna_status::mapped},
-    {U'\x213f', U'\x213f', idna_status::mapped},
-    {U'\x2140', U'\x2140', idna_status::mapped},
-    {U'\x2145', U'\x2146', idna_status::mapped},
-    {U'\x2147', U'\x2147', idna_status::mapped},
-    {U'\x2148', U'\x2148', idna_status::mapped},
-    {U'\x2149', U'\x2149', idna_status::mapped},
-    {U'\x2150', U'\x2150', idna_status::mapped},
-    {U'\x2151', U'\x2151', idna_status::mapped},
-    {U'\x2152', U'\x2152', idna_status::mapped},
-    {U'\x2153', U'\x2153', idna_status::mapped},
-    {U'\x2154', U'\x2154', idna_status::mapped},
-    {U'\x2155', U'\x2155', idna_status::mapped},
-    {U'\x2156', U'\x2156', idna_status::mapped},
-    {U'\x2157', U'\x2157', idna_status::mapped},
-    {U'\x2158', U'\x2158', idna_status::mapped},
-    {U'\x2159', U'\x2159', idna_status::mapped},
-    {U'\x215a', U'\x215a', idna_status::mapped},
-    {U'\x215b', U'\x215b', idna_status::mapped},
-    {U'\x215c', U'\x215c', idna_status::mapped},
-    {U'\x215d', U'\x215d', idna_status::mapped},
-    {U'\x215e', U'\x215e', idna_status::mapped},
-    {U'\x215f', U'\x215f', idna_status::mapped},
-    {U'\x2160', U'\x2160', idna_status::mapped},
-    {U'\x2161', U'\x2161', idna_status::mapped},
-    {U'\x2162', U'\x2162', idna_status::mapped},
-    {U'\x2163', U'\x2163', idna_status::mapped},
-    {U'\x2164', U'\x2164', idna_status::mapped},
-    {U'\x2165', U'\x2165', idna_status::mapped},
-    {U'\x2166', U'\x2166', idna_status::mapped},
-    {U'\x2167', U'\x2167', idna_status::mapped},
-    {U'\x2168', U'\x2168', idna_status::mapped},
-    {U'\x2169', U'\x2169', idna_status::mapped},
-    {U'\x216a', U'\x216a', idna_status::mapped},
-    {U'\x216b', U'\x216b', idna_status::mapped},
-    {U'\x216c', U'\x216c', idna_status::mapped},
-    {U'\x216d', U'\x216d', idna_status::mapped},
-    {U'\x216e', U'\x216e', idna_status::mapped},
-    {U'\x216f', U'\x216f', idna_status::mapped},
-    {U'\x2170', U'\x2170', idna_status::mapped},
-    {U'\x2171', U'\x2171', idna_status::mapped},
-    {U'\x2172', U'\x2172', idna_status::mapped},
-    {U'\x2173', U'\x2173', idna_status::mapped},
-    {U'\x2174', U'\x2174', idna_status::mapped},
-    {U'\x2175', U'\x2175', idna_status::mapped},
-    {U'\x2176', U'\x2176', idna_status::mapped},
-    {U'\x2177', U'\x2177', idna_status::mapped},
-    {U'\x2178', U'\x2178', idna_status::mapped},
-    {U'\x2179', U'\x2179', idna_status::mapped},
-    {U'\x217a', U'\x217a', idna_status::mapped},
-    {U'\x217b', U'\x217b', idna_status::mapped},
-    {U'\x217c', U'\x217c', idna_status::mapped},
-    {U'\x217d', U'\x217d', idna_status::mapped},
-    {U'\x217e', U'\x217e', idna_status::mapped},
-    {U'\x217f', U'\x217f', idna_status::mapped},
-    {U'\x2183', U'\x2183', idna_status::disallowed},
-    {U'\x2189', U'\x2189', idna_status::mapped},
-    {U'\x218c', U'\x218f', idna_status::disallowed},
-    {U'\x222c', U'\x222c', idna_status::mapped},
-    {U'\x222d', U'\x222d', idna_status::mapped},
-    {U'\x222f', U'\x222f', idna_status::mapped},
-    {U'\x2230', U'\x2230', idna_status::mapped},
-    {U'\x2329', U'\x2329', idna_status::mapped},
-    {U'\x232a', U'\x232a', idna_status::mapped},
-    {U'\x2427', U'\x243f', idna_status::disallowed},
-    {U'\x244b', U'\x245f', idna_status::disallowed},
-    {U'\x2460', U'\x2460', idna_status::mapped},
-    {U'\x2461', U'\x2461', idna_status::mapped},
-    {U'\x2462', U'\x2462', idna_status::mapped},
-    {U'\x2463', U'\x2463', idna_status::mapped},
-    {U'\x2464', U'\x2464', idna_status::mapped},
-    {U'\x2465', U'\x2465', idna_status::mapped},
-    {U'\x2466', U'\x2466', idna_status::mapped},
-    {U'\x2467', U'\x2467', idna_status::mapped},
-    {U'\x2468', U'\x2468', idna_status::mapped},
-    {U'\x2469', U'\x2469', idna_status::mapped},
-    {U'\x246a', U'\x246a', idna_status::mapped},
-    {U'\x246b', U'\x246b', idna_status::mapped},
-    {U'\x246c', U'\x246c', idna_status::mapped},
-    {U'\x246d', U'\x246d', idna_status::mapped},
-    {U'\x246e', U'\x246e', idna_status::mapped},
-    {U'\x246f', U'\x246f', idna_status::mapped},
-    {U'\x2470', U'\x2470', idna_status::mapped},
-    {U'\x2471', U'\x2471', idna_status::mapped},
-    {U'\x2472', U'\x2472', idna_status::mapped},
-    {U'\x2473', U'\x2473', idna_status::mapped},
-    {U'\x2474', U'\x2474', idna_status::disallowed_std3_mapped},
-    {U'\x2475', U'\x2475', idna_status::disallowed_std3_mapped},
-    {U'\x2476', U'\x2476', idna_status::disallowed_std3_mapped},
-    {U'\x2477', U'\x2477', idna_status::disallowed_std3_mapped},
-    {U'\x2478', U'\x2478', idna_status::disallowed_std3_mapped},
-    {U'\x2479', U'\x2479', idna_status::disallowed_std3_mapped},
-    {U'\x247a', U'\x247a', idna_status::disallowed_std3_mapped},
-    {U'\x247b', U'\x247b', idna_status::disallowed_std3_mapped},
-    {U'\x247c', U'\x247c', idna_status::disallowed_std3_mapped},
-    {U'\x247d', U'\x247d', idna_status::disallowed_std3_mapped},
-    {U'\x247e', U'\x247e', idna_status::disallowed_std3_mapped},
-    {U'\x247f', U'\x247f', idna_status::disallowed_std3_mapped},
-    {U'\x2480', U'\x2480', idna_status::disallowed_std3_mapped},
-    {U'\x2481', U'\x2481', idna_status::disallowed_std3_mapped},
-    {U'\x2482', U'\x2482', idna_status::disallowed_std3_mapped},
-    {U'\x2483', U'\x2483', idna_status::disallowed_std3_mapped},
-    {U'\x2484', U'\x2484', idna_status::disallowed_std3_mapped},
-    {U'\x2485', U'\x2485', idna_status::disallowed_std3_mapped},
-    {U'\x2486', U'\x2486', idna_status::disallowed_std3_mapped},
-    {U'\x2487', U'\x2487', idna_status::disallowed_std3_mapped},
-    {U'\x2488', U'\x249b', idna_status::disallowed},
-    {U'\x249c', U'\x249c', idna_status::disallowed_std3_mapped},
-    {U'\x249d', U'\x249d', idna_status::disallowed_std3_mapped},
-    {U'\x249e', U'\x249e', idna_status::disallowed_std3_mapped},
-    {U'\x249f', U'\x249f', idna_status::disallowed_std3_mapped},
-    {U'\x24a0', U'\x24a0', idna_status::disallowed_std3_mapped},
-    {U'\x24a1', U'\x24a1', idna_status::disallowed_std3_mapped},
-    {U'\x24a2', U'\x24a2', idna_status::disallowed_std3_mapped},
-    {U'\x24a3', U'\x24a3', idna_status::disallowed_std3_mapped},
-    {U'\x24a4', U'\x24a4', idna_status::disallowed_std3_mapped},
-    {U'\x24a5', U'\x24a5', idna_status::disallowed_std3_mapped},
-    {U'\x24a6', U'\x24a6', idna_status::disallowed_std3_mapped},
-    {U'\x24a7', U'\x24a7', idna_status::disallowed_std3_mapped},
-    {U'\x24a8', U'\x24a8', idna_status::disallowed_std3_mapped},
-    {U'\x24a9', U'\x24a9', idna_status::disallowed_std3_mapped},
-    {U'\x24aa', U'\x24aa', idna_status::disallowed_std3_mapped},
-    {U'\x24ab', U'\x24ab', idna_status::disallowed_std3_mapped},
-    {U'\x24ac', U'\x24ac', idna_status::disallowed_std3_mapped},
-    {U'\x24ad', U'\x24ad', idna_status::disallowed_std3_mapped},
-    {U'\x24ae', U'\x24ae', idna_status::disallowed_std3_mapped},
-    {U'\x24af', U'\x24af', idna_status::disallowed_std3_mapped},
-    {U'\x24b0', U'\x24b0', idna_status::disallowed_std3_mapped},
-    {U'\x24b1', U'\x24b1', idna_status::disallowed_std3_mapped},
-    {U'\x24b2', U'\x24b2', idna_status::disallowed_std3_mapped},
-    {U'\x24b3', U'\x24b3', idna_status::disallowed_std3_mapped},
-    {U'\x24b4', U'\x24b4', idna_status::disallowed_std3_mapped},
-    {U'\x24b5', U'\x24b5', idna_status::disallowed_std3_mapped},
-    {U'\x24b6', U'\x24b6', idna_status::mapped},
-    {U'\x24b7', U'\x24b7', idna_status::mapped},
-    {U'\x24b8', U'\x24b8', idna_status::mapped},
-    {U'\x24b9', U'\x24b9', idna_status::mapped},
-    {U'\x24ba', U'\x24ba', idna_status::mapped},
-    {U'\x24bb', U'\x24bb', idna_status::mapped},
-    {U'\x24bc', U'\x24bc', idna_status::mapped},
-    {U'\x24bd', U'\x24bd', idna_status::mapped},
-    {U'\x24be', U'\x24be', idna_status::mapped},
-    {U'\x24bf', U'\x24bf', idna_status::mapped},
-    {U'\x24c0', U'\x24c0', idna_status::mapped},
-    {U'\x24c1', U'\x24c1', idna_status::mapped},
-    {U'\x24c2', U'\x24c2', idna_status::mapped},
-    {U'\x24c3', U'\x24c3', idna_status::mapped},
-    {U'\x24c4', U'\x24c4', idna_status::mapped},
-    {U'\x24c5', U'\x24c5', idna_status::mapped},
-    {U'\x24c6', U'\x24c6', idna_status::mapped},
-    {U'\x24c7', U'\x24c7', idna_status::mapped},
-    {U'\x24c8', U'\x24c8', idna_status::mapped},
-    {U'\x24c9', U'\x24c9', idna_status::mapped},
-    {U'\x24ca', U'\x24ca', idna_status::mapped},
-    {U'\x24cb', U'\x24cb', idna_status::mapped},
-    {U'\x24cc', U'\x24cc', idna_status::mapped},
-    {U'\x24cd', U'\x24cd', idna_status::mapped},
-    {U'\x24ce', U'\x24ce', idna_status::mapped},
-    {U'\x24cf', U'\x24cf', idna_status::mapped},
-    {U'\x24d0', U'\x24d0', idna_status::mapped},
-    {U'\x24d1', U'\x24d1', idna_status::mapped},
-    {U'\x24d2', U'\x24d2', idna_status::mapped},
-    {U'\x24d3', U'\x24d3', idna_status::mapped},
-    {U'\x24d4', U'\x24d4', idna_status::mapped},
-    {U'\x24d5', U'\x24d5', idna_status::mapped},
-    {U'\x24d6', U'\x24d6', idna_status::mapped},
-    {U'\x24d7', U'\x24d7', idna_status::mapped},
-    {U'\x24d8', U'\x24d8', idna_status::mapped},
-    {U'\x24d9', U'\x24d9', idna_status::mapped},
-    {U'\x24da', U'\x24da', idna_status::mapped},
-    {U'\x24db', U'\x24db', idna_status::mapped},
-    {U'\x24dc', U'\x24dc', idna_status::mapped},
-    {U'\x24dd', U'\x24dd', idna_status::mapped},
-    {U'\x24de', U'\x24de', idna_status::mapped},
-    {U'\x24df', U'\x24df', idna_status::mapped},
-    {U'\x24e0', U'\x24e0', idna_status::mapped},
-    {U'\x24e1', U'\x24e1', idna_status::mapped},
-    {U'\x24e2', U'\x24e2', idna_status::mapped},
-    {U'\x24e3', U'\x24e3', idna_status::mapped},
-    {U'\x24e4', U'\x24e4', idna_status::mapped},
-    {U'\x24e5', U'\x24e5', idna_status::mapped},
-    {U'\x24e6', U'\x24e6', idna_status::mapped},
-    {U'\x24e7', U'\x24e7', idna_status::mapped},
-    {U'\x24e8', U'\x24e8', idna_status::mapped},
-    {U'\x24e9', U'\x24e9', idna_status::mapped},
-    {U'\x24ea', U'\x24ea', idna_status::mapped},
-    {U'\x2a0c', U'\x2a0c', idna_status::mapped},
-    {U'\x2a74', U'\x2a74', idna_status::disallowed_std3_mapped},
-    {U'\x2a75', U'\x2a75', idna_status::disallowed_std3_mapped},
-    {U'\x2a76', U'\x2a76', idna_status::disallowed_std3_mapped},
-    {U'\x2adc', U'\x2adc', idna_status::mapped},
-    {U'\x2b74', U'\x2b75', idna_status::disallowed},
-    {U'\x2b96', U'\x2b96', idna_status::disallowed},
-    {U'\x2c00', U'\x2c00', idna_status::mapped},
-    {U'\x2c01', U'\x2c01', idna_status::mapped},
-    {U'\x2c02', U'\x2c02', idna_status::mapped},
-    {U'\x2c03', U'\x2c03', idna_status::mapped},
-    {U'\x2c04', U'\x2c04', idna_status::mapped},
-    {U'\x2c05', U'\x2c05', idna_status::mapped},
-    {U'\x2c06', U'\x2c06', idna_status::mapped},
-    {U'\x2c07', U'\x2c07', idna_status::mapped},
-    {U'\x2c08', U'\x2c08', idna_status::mapped},
-    {U'\x2c09', U'\x2c09', idna_status::mapped},
-    {U'\x2c0a', U'\x2c0a', idna_status::mapped},
-    {U'\x2c0b', U'\x2c0b', idna_status::mapped},
-    {U'\x2c0c', U'\x2c0c', idna_status::mapped},
-    {U'\x2c0d', U'\x2c0d', idna_status::mapped},
-    {U'\x2c0e', U'\x2c0e', idna_status::mapped},
-    {U'\x2c0f', U'\x2c0f', idna_status::mapped},
-    {U'\x2c10', U'\x2c10', idna_status::mapped},
-    {U'\x2c11', U'\x2c11', idna_status::mapped},
-    {U'\x2c12', U'\x2c12', idna_status::mapped},
-    {U'\x2c13', U'\x2c13', idna_status::mapped},
-    {U'\x2c14', U'\x2c14', idna_status::mapped},
-    {U'\x2c15', U'\x2c15', idna_status::mapped},
-    {U'\x2c16', U'\x2c16', idna_status::mapped},
-    {U'\x2c17', U'\x2c17', idna_status::mapped},
-    {U'\x2c18', U'\x2c18', idna_status::mapped},
-    {U'\x2c19', U'\x2c19', idna_status::mapped},
-    {U'\x2c1a', U'\x2c1a', idna_status::mapped},
-    {U'\x2c1b', U'\x2c1b', idna_status::mapped},
-    {U'\x2c1c', U'\x2c1c', idna_status::mapped},
-    {U'\x2c1d', U'\x2c1d', idna_status::mapped},
-    {U'\x2c1e', U'\x2c1e', idna_status::mapped},
-    {U'\x2c1f', U'\x2c1f', idna_status::mapped},
-    {U'\x2c20', U'\x2c20', idna_status::mapped},
-    {U'\x2c21', U'\x2c21', idna_status::mapped},
-    {U'\x2c22', U'\x2c22', idna_status::mapped},
-    {U'\x2c23', U'\x2c23', idna_status::mapped},
-    {U'\x2c24', U'\x2c24', idna_status::mapped},
-    {U'\x2c25', U'\x2c25', idna_status::mapped},
-    {U'\x2c26', U'\x2c26', idna_status::mapped},
-    {U'\x2c27', U'\x2c27', idna_status::mapped},
-    {U'\x2c28', U'\x2c28', idna_status::mapped},
-    {U'\x2c29', U'\x2c29', idna_status::mapped},
-    {U'\x2c2a', U'\x2c2a', idna_status::mapped},
-    {U'\x2c2b', U'\x2c2b', idna_status::mapped},
-    {U'\x2c2c', U'\x2c2c', idna_status::mapped},
-    {U'\x2c2d', U'\x2c2d', idna_status::mapped},
-    {U'\x2c2e', U'\x2c2e', idna_status::mapped},
-    {U'\x2c2f', U'\x2c2f', idna_status::mapped},
-    {U'\x2c60', U'\x2c60', idna_status::mapped},
-    {U'\x2c62', U'\x2c62', idna_status::mapped},
-    {U'\x2c63', U'\x2c63', idna_status::mapped},
-    {U'\x2c64', U'\x2c64', idna_status::mapped},
-    {U'\x2c67', U'\x2c67', idna_status::mapped},
-    {U'\x2c69', U'\x2c69', idna_status::mapped},
-    {U'\x2c6b', U'\x2c6b', idna_status::mapped},
-    {U'\x2c6d', U'\x2c6d', idna_status::mapped},
-    {U'\x2c6e', U'\x2c6e', idna_status::mapped},
-    {U'\x2c6f', U'\x2c6f', idna_status::mapped},
-    {U'\x2c70', U'\x2c70', idna_status::mapped},
-    {U'\x2c72', U'\x2c72', idna_status::mapped},
-    {U'\x2c75', U'\x2c75', idna_status::mapped},
-    {U'\x2c7c', U'\x2c7c', idna_status::mapped},
-    {U'\x2c7d', U'\x2c7d', idna_status::mapped},
-    {U'\x2c7e', U'\x2c7e', idna_status::mapped},
-    {U'\x2c7f', U'\x2c7f', idna_status::mapped},
-    {U'\x2c80', U'\x2c80', idna_status::mapped},
-    {U'\x2c82', U'\x2c82', idna_status::mapped},
-    {U'\x2c84', U'\x2c84', idna_status::mapped},
-    {U'\x2c86', U'\x2c86', idna_status::mapped},
-    {U'\x2c88', U'\x2c88', idna_status::mapped},
-    {U'\x2c8a', U'\x2c8a', idna_status::mapped},
-    {U'\x2c8c', U'\x2c8c', idna_status::mapped},
-    {U'\x2c8e', U'\x2c8e', idna_status::mapped},
-    {U'\x2c90', U'\x2c90', idna_status::mapped},
-    {U'\x2c92', U'\x2c92', idna_status::mapped},
-    {U'\x2c94', U'\x2c94', idna_status::mapped},
-    {U'\x2c96', U'\x2c96', idna_status::mapped},
-    {U'\x2c98', U'\x2c98', idna_status::mapped},
-    {U'\x2c9a', U'\x2c9a', idna_status::mapped},
-    {U'\x2c9c', U'\x2c9c', idna_status::mapped},
-    {U'\x2c9e', U'\x2c9e', idna_status::mapped},
-    {U'\x2ca0', U'\x2ca0', idna_status::mapped},
-    {U'\x2ca2', U'\x2ca2', idna_status::mapped},
-    {U'\x2ca4', U'\x2ca4', idna_status::mapped},
-    {U'\x2ca6', U'\x2ca6', idna_status::mapped},
-    {U'\x2ca8', U'\x2ca8', idna_status::mapped},
-    {U'\x2caa', U'\x2caa', idna_status::mapped},
-    {U'\x2cac', U'\x2cac', idna_status::mapped},
-    {U'\x2cae', U'\x2cae', idna_status::mapped},
-    {U'\x2cb0', U'\x2cb0', idna_status::mapped},
-    {U'\x2cb2', U'\x2cb2', idna_status::mapped},
-    {U'\x2cb4', U'\x2cb4', idna_status::mapped},
-    {U'\x2cb6', U'\x2cb6', idna_status::mapped},
-    {U'\x2cb8', U'\x2cb8', idna_status::mapped},
-    {U'\x2cba', U'\x2cba', idna_status::mapped},
-    {U'\x2cbc', U'\x2cbc', idna_status::mapped},
-    {U'\x2cbe', U'\x2cbe', idna_status::mapped},
-    {U'\x2cc0', U'\x2cc0', idna_status::mapped},
-    {U'\x2cc2', U'\x2cc2', idna_status::mapped},
-    {U'\x2cc4', U'\x2cc4', idna_status::mapped},
-    {U'\x2cc6', U'\x2cc6', idna_status::mapped},
-    {U'\x2cc8', U'\x2cc8', idna_status::mapped},
-    {U'\x2cca', U'\x2cca', idna_status::mapped},
-    {U'\x2ccc', U'\x2ccc', idna_status::mapped},
-    {U'\x2cce', U'\x2cce', idna_status::mapped},
-    {U'\x2cd0', U'\x2cd0', idna_status::mapped},
-    {U'\x2cd2', U'\x2cd2', idna_status::mapped},
-    {U'\x2cd4', U'\x2cd4', idna_status::mapped},
-    {U'\x2cd6', U'\x2cd6', idna_status::mapped},
-    {U'\x2cd8', U'\x2cd8', idna_status::mapped},
-    {U'\x2cda', U'\x2cda', idna_status::mapped},
-    {U'\x2cdc', U'\x2cdc', idna_status::mapped},
-    {U'\x2cde', U'\x2cde', idna_status::mapped},
-    {U'\x2ce0', U'\x2ce0', idna_status::mapped},
-    {U'\x2ce2', U'\x2ce2', idna_status::mapped},
-    {U'\x2ceb', U'\x2ceb', idna_status::mapped},
-    {U'\x2ced', U'\x2ced', idna_status::mapped},
-    {U'\x2cf2', U'\x2cf2', idna_status::mapped},
-    {U'\x2cf4', U'\x2cf8', idna_status::disallowed},
-    {U'\x2d26', U'\x2d26', idna_status::disallowed},
-    {U'\x2d28', U'\x2d2c', idna_status::disallowed},
-    {U'\x2d2e', U'\x2d2f', idna_status::disallowed},
-    {U'\x2d68', U'\x2d6e', idna_status::disallowed},
-    {U'\x2d6f', U'\x2d6f', idna_status::mapped},
-    {U'\x2d71', U'\x2d7e', idna_status::disallowed},
-    {U'\x2d97', U'\x2d9f', idna_status::disallowed},
-    {U'\x2da7', U'\x2da7', idna_status::disallowed},
-    {U'\x2daf', U'\x2daf', idna_status::disallowed},
-    {U'\x2db7', U'\x2db7', idna_status::disallowed},
-    {U'\x2dbf', U'\x2dbf', idna_status::disallowed},
-    {U'\x2dc7', U'\x2dc7', idna_status::disallowed},
-    {U'\x2dcf', U'\x2dcf', idna_status::disallowed},
-    {U'\x2dd7', U'\x2dd7', idna_status::disallowed},
-    {U'\x2ddf', U'\x2ddf', idna_status::disallowed},
-    {U'\x2e5e', U'\x2e7f', idna_status::disallowed},
-    {U'\x2e9a', U'\x2e9a', idna_status::disallowed},
-    {U'\x2e9f', U'\x2e9f', idna_status::mapped},
-    {U'\x2ef3', U'\x2ef3', idna_status::mapped},
-    {U'\x2ef4', U'\x2eff', idna_status::disallowed},
-    {U'\x2f00', U'\x2f00', idna_status::mapped},
-    {U'\x2f01', U'\x2f01', idna_status::mapped},
-    {U'\x2f02', U'\x2f02', idna_status::mapped},
-    {U'\x2f03', U'\x2f03', idna_status::mapped},
-    {U'\x2f04', U'\x2f04', idna_status::mapped},
-    {U'\x2f05', U'\x2f05', idna_status::mapped},
-    {U'\x2f06', U'\x2f06', idna_status::mapped},
-    {U'\x2f07', U'\x2f07', idna_status::mapped},
-    {U'\x2f08', U'\x2f08', idna_status::mapped},
-    {U'\x2f09', U'\x2f09', idna_status::mapped},
-    {U'\x2f0a', U'\x2f0a', idna_status::mapped},
-    {U'\x2f0b', U'\x2f0b', idna_status::mapped},
-    {U'\x2f0c', U'\x2f0c', idna_status::mapped},
-    {U'\x2f0d', U'\x2f0d', idna_status::mapped},
-    {U'\x2f0e', U'\x2f0e', idna_status::mapped},
-    {U'\x2f0f', U'\x2f0f', idna_status::mapped},
-    {U'\x2f10', U'\x2f10', idna_status::mapped},
-    {U'\x2f11', U'\x2f11', idna_status::mapped},
-    {U'\x2f12', U'\x2f12', idna_status::mapped},
-    {U'\x2f13', U'\x2f13', idna_status::mapped},
-    {U'\x2f14', U'\x2f14', idna_status::mapped},
-    {U'\x2f15', U'\x2f15', idna_status::mapped},
-    {U'\x2f16', U'\x2f16', idna_status::mapped},
-    {U'\x2f17', U'\x2f17', idna_status::mapped},
-    {U'\x2f18', U'\x2f18', idna_status::mapped},
-    {U'\x2f19', U'\x2f19', idna_status::mapped},
-    {U'\x2f1a', U'\x2f1a', idna_status::mapped},
-    {U'\x2f1b', U'\x2f1b', idna_status::mapped},
-    {U'\x2f1c', U'\x2f1c', idna_status::mapped},
-    {U'\x2f1d', U'\x2f1d', idna_status::mapped},
-    {U'\x2f1e', U'\x2f1e', idna_status::mapped},
-    {U'\x2f1f', U'\x2f1f', idna_status::mapped},
-    {U'\x2f20', U'\x2f20', idna_status::mapped},
-    {U'\x2f21', U'\x2f21', idna_status::mapped},
-    {U'\x2f22', U'\x2f22', idna_status::mapped},
-    {U'\x2f23', U'\x2f23', idna_status::mapped},
-    {U'\x2f24', U'\x2f24', idna_status::mapped},
-    {U'\x2f25', U'\x2f25', idna_status::mapped},
-    {U'\x2f26', U'\x2f26', idna_status::mapped},
-    {U'\x2f27', U'\x2f27', idna_status::mapped},
-    {U'\x2f28', U'\x2f28', idna_status::mapped},
-    {U'\x2f29', U'\x2f29', idna_status::mapped},
-    {U'\x2f2a', U'\x2f2a', idna_status::mapped},
-    {U'\x2f2b', U'\x2f2b', idna_status::mapped},
-    {U'\x2f2c', U'\x2f2c', idna_status::mapped},
-    {U'\x2f2d', U'\x2f2d', idna_status::mapped},
-    {U'\x2f2e', U'\x2f2e', idna_status::mapped},
-    {U'\x2f2f', U'\x2f2f', idna_status::mapped},
-    {U'\x2f30', U'\x2f30', idna_status::mapped},
-    {U'\x2f31', U'\x2f31', idna_status::mapped},
-    {U'\x2f32', U'\x2f32', idna_status::mapped},
-    {U'\x2f33', U'\x2f33', idna_status::mapped},
-    {U'\x2f34', U'\x2f34', idna_status::mapped},
-    {U'\x2f35', U'\x2f35', idna_status::mapped},
-    {U'\x2f36', U'\x2f36', idna_status::mapped},
-    {U'\x2f37', U'\x2f37', idna_status::mapped},
-    {U'\x2f38', U'\x2f38', idna_status::mapped},
-    {U'\x2f39', U'\x2f39', idna_status::mapped},
-    {U'\x2f3a', U'\x2f3a', idna_status::mapped},
-    {U'\x2f3b', U'\x2f3b', idna_status::mapped},
-    {U'\x2f3c', U'\x2f3c', idna_status::mapped},
-    {U'\x2f3d', U'\x2f3d', idna_status::mapped},
-    {U'\x2f3e', U'\x2f3e', idna_status::mapped},
-    {U'\x2f3f', U'\x2f3f', idna_status::mapped},
-    {U'\x2f40', U'\x2f40', idna_status::mapped},
-    {U'\x2f41', U'\x2f41', idna_status::mapped},
-    {U'\x2f42', U'\x2f42', idna_status::mapped},
-    {U'\x2f43', U'\x2f43', idna_status::mapped},
-    {U'\x2f44', U'\x2f44', idna_status::mapped},
-    {U'\x2f45', U'\x2f45', idna_status::mapped},
-    {U'\x2f46', U'\x2f46', idna_status::mapped},
-    {U'\x2f47', U'\x2f47', idna_status::mapped},
-    {U'\x2f48', U'\x2f48', idna_status::mapped},
-    {U'\x2f49', U'\x2f49', idna_status::mapped},
-    {U'\x2f4a', U'\x2f4a', idna_status::mapped},
-    {U'\x2f4b', U'\x2f4b', idna_status::mapped},
-    {U'\x2f4c', U'\x2f4c', idna_status::mapped},
-    {U'\x2f4d', U'\x2f4d', idna_status::mapped},
-    {U'\x2f4e', U'\x2f4e', idna_status::mapped},
-    {U'\x2f4f', U'\x2f4f', idna_status::mapped},
-    {U'\x2f50', U'\x2f50', idna_status::mapped},
-    {U'\x2f51', U'\x2f51', idna_status::mapped},
-    {U'\x2f52', U'\x2f52', idna_status::mapped},
-    {U'\x2f53', U'\x2f53', idna_status::mapped},
-    {U'\x2f54', U'\x2f54', idna_status::mapped},
-    {U'\x2f55', U'\x2f55', idna_status::mapped},
-    {U'\x2f56', U'\x2f56', idna_status::mapped},
-    {U'\x2f57', U'\x2f57', idna_status::mapped},
-    {U'\x2f58', U'\x2f58', idna_status::mapped},
-    {U'\x2f59', U'\x2f59', idna_status::mapped},
-    {U'\x2f5a', U'\x2f5a', idna_status::mapped},
-    {U'\x2f5b', U'\x2f5b', idna_status::mapped},
-    {U'\x2f5c', U'\x2f5c', idna_status::mapped},
-    {U'\x2f5d', U'\x2f5d', idna_status::mapped},
-    {U'\x2f5e', U'\x2f5e', idna_status::mapped},
-    {U'\x2f5f', U'\x2f5f', idna_status::mapped},
-    {U'\x2f60', U'\x2f60', idna_status::mapped},
-    {U'\x2f61', U'\x2f61', idna_status::mapped},
-    {U'\x2f62', U'\x2f62', idna_status::mapped},
-    {U'\x2f63', U'\x2f63', idna_status::mapped},
-    {U'\x2f64', U'\x2f64', idna_status::mapped},
-    {U'\x2f65', U'\x2f65', idna_status::mapped},
-    {U'\x2f66', U'\x2f66', idna_status::mapped},
-    {U'\x2f67', U'\x2f67', idna_status::mapped},
-    {U'\x2f68', U'\x2f68', idna_status::mapped},
-    {U'\x2f69', U'\x2f69', idna_status::mapped},
-    {U'\x2f6a', U'\x2f6a', idna_status::mapped},
-    {U'\x2f6b', U'\x2f6b', idna_status::mapped},
-    {U'\x2f6c', U'\x2f6c', idna_status::mapped},
-    {U'\x2f6d', U'\x2f6d', idna_status::mapped},
-    {U'\x2f6e', U'\x2f6e', idna_status::mapped},
-    {U'\x2f6f', U'\x2f6f', idna_status::mapped},
-    {U'\x2f70', U'\x2f70', idna_status::mapped},
-    {U'\x2f71', U'\x2f71', idna_status::mapped},
-    {U'\x2f72', U'\x2f72', idna_status::mapped},
-    {U'\x2f73', U'\x2f73', idna_status::mapped},
-    {U'\x2f74', U'\x2f74', idna_status::mapped},
-    {U'\x2f75', U'\x2f75', idna_status::mapped},
-    {U'\x2f76', U'\x2f76', idna_status::mapped},
-    {U'\x2f77', U'\x2f77', idna_status::mapped},
-    {U'\x2f78', U'\x2f78', idna_status::mapped},
-    {U'\x2f79', U'\x2f79', idna_status::mapped},
-    {U'\x2f7a', U'\x2f7a', idna_status::mapped},
-    {U'\x2f7b', U'\x2f7b', idna_status::mapped},
-    {U'\x2f7c', U'\x2f7c', idna_status::mapped},
-    {U'\x2f7d', U'\x2f7d', idna_status::mapped},
-    {U'\x2f7e', U'\x2f7e', idna_status::mapped},
-    {U'\x2f7f', U'\x2f7f', idna_status::mapped},
-    {U'\x2f80', U'\x2f80', idna_status::mapped},
-    {U'\x2f81', U'\x2f81', idna_status::mapped},
-    {U'\x2f82', U'\x2f82', idna_status::mapped},
-    {U'\x2f83', U'\x2f83', idna_status::mapped},
-    {U'\x2f84', U'\x2f84', idna_status::mapped},
-    {U'\x2f85', U'\x2f85', idna_status::mapped},
-    {U'\x2f86', U'\x2f86', idna_status::mapped},
-    {U'\x2f87', U'\x2f87', idna_status::mapped},
-    {U'\x2f88', U'\x2f88', idna_status::mapped},
-    {U'\x2f89', U'\x2f89', idna_status::mapped},
-    {U'\x2f8a', U'\x2f8a', idna_status::mapped},
-    {U'\x2f8b', U'\x2f8b', idna_status::mapped},
-    {U'\x2f8c', U'\x2f8c', idna_status::mapped},
-    {U'\x2f8d', U'\x2f8d', idna_status::mapped},
-    {U'\x2f8e', U'\x2f8e', idna_status::mapped},
-    {U'\x2f8f', U'\x2f8f', idna_status::mapped},
-    {U'\x2f90', U'\x2f90', idna_status::mapped},
-    {U'\x2f91', U'\x2f91', idna_status::mapped},
-    {U'\x2f92', U'\x2f92', idna_status::mapped},
-    {U'\x2f93', U'\x2f93', idna_status::mapped},
-    {U'\x2f94', U'\x2f94', idna_status::mapped},
-    {U'\x2f95', U'\x2f95', idna_status::mapped},
-    {U'\x2f96', U'\x2f96', idna_status::mapped},
-    {U'\x2f97', U'\x2f97', idna_status::mapped},
-    {U'\x2f98', U'\x2f98', idna_status::mapped},
-    {U'\x2f99', U'\x2f99', idna_status::mapped},
-    {U'\x2f9a', U'\x2f9a', idna_status::mapped},
-    {U'\x2f9b', U'\x2f9b', idna_status::mapped},
-    {U'\x2f9c', U'\x2f9c', idna_status::mapped},
-    {U'\x2f9d', U'\x2f9d', idna_status::mapped},
-    {U'\x2f9e', U'\x2f9e', idna_status::mapped},
-    {U'\x2f9f', U'\x2f9f', idna_status::mapped},
-    {U'\x2fa0', U'\x2fa0', idna_status::mapped},
-    {U'\x2fa1', U'\x2fa1', idna_status::mapped},
-    {U'\x2fa2', U'\x2fa2', idna_status::mapped},
-    {U'\x2fa3', U'\x2fa3', idna_status::mapped},
-    {U'\x2fa4', U'\x2fa4', idna_status::mapped},
-    {U'\x2fa5', U'\x2fa5', idna_status::mapped},
-    {U'\x2fa6', U'\x2fa6', idna_status::mapped},
-    {U'\x2fa7', U'\x2fa7', idna_status::mapped},
-    {U'\x2fa8', U'\x2fa8', idna_status::mapped},
-    {U'\x2fa9', U'\x2fa9', idna_status::mapped},
-    {U'\x2faa', U'\x2faa', idna_status::mapped},
-    {U'\x2fab', U'\x2fab', idna_status::mapped},
-    {U'\x2fac', U'\x2fac', idna_status::mapped},
-    {U'\x2fad', U'\x2fad', idna_status::mapped},
-    {U'\x2fae', U'\x2fae', idna_status::mapped},
-    {U'\x2faf', U'\x2faf', idna_status::mapped},
-    {U'\x2fb0', U'\x2fb0', idna_status::mapped},
-    {U'\x2fb1', U'\x2fb1', idna_status::mapped},
-    {U'\x2fb2', U'\x2fb2', idna_status::mapped},
-    {U'\x2fb3', U'\x2fb3', idna_status::mapped},
-    {U'\x2fb4', U'\x2fb4', idna_status::mapped},
-    {U'\x2fb5', U'\x2fb5', idna_status::mapped},
-    {U'\x2fb6', U'\x2fb6', idna_status::mapped},
-    {U'\x2fb7', U'\x2fb7', idna_status::mapped},
-    {U'\x2fb8', U'\x2fb8', idna_status::mapped},
-    {U'\x2fb9', U'\x2fb9', idna_status::mapped},
-    {U'\x2fba', U'\x2fba', idna_status::mapped},
-    {U'\x2fbb', U'\x2fbb', idna_status::mapped},
-    {U'\x2fbc', U'\x2fbc', idna_status::mapped},
-    {U'\x2fbd', U'\x2fbd', idna_status::mapped},
-    {U'\x2fbe', U'\x2fbe', idna_status::mapped},
-    {U'\x2fbf', U'\x2fbf', idna_status::mapped},
-    {U'\x2fc0', U'\x2fc0', idna_status::mapped},
-    {U'\x2fc1', U'\x2fc1', idna_status::mapped},
-    {U'\x2fc2', U'\x2fc2', idna_status::mapped},
-    {U'\x2fc3', U'\x2fc3', idna_status::mapped},
-    {U'\x2fc4', U'\x2fc4', idna_status::mapped},
-    {U'\x2fc5', U'\x2fc5', idna_status::mapped},
-    {U'\x2fc6', U'\x2fc6', idna_status::mapped},
-    {U'\x2fc7', U'\x2fc7', idna_status::mapped},
-    {U'\x2fc8', U'\x2fc8', idna_status::mapped},
-    {U'\x2fc9', U'\x2fc9', idna_status::mapped},
-    {U'\x2fca', U'\x2fca', idna_status::mapped},
-    {U'\x2fcb', U'\x2fcb', idna_status::mapped},
-    {U'\x2fcc', U'\x2fcc', idna_status::mapped},
-    {U'\x2fcd', U'\x2fcd', idna_status::mapped},
-    {U'\x2fce', U'\x2fce', idna_status::mapped},
-    {U'\x2fcf', U'\x2fcf', idna_status::mapped},
-    {U'\x2fd0', U'\x2fd0', idna_status::mapped},
-    {U'\x2fd1', U'\x2fd1', idna_status::mapped},
-    {U'\x2fd2', U'\x2fd2', idna_status::mapped},
-    {U'\x2fd3', U'\x2fd3', idna_status::mapped},
-    {U'\x2fd4', U'\x2fd4', idna_status::mapped},
-    {U'\x2fd5', U'\x2fd5', idna_status::mapped},
-    {U'\x2fd6', U'\x2fef', idna_status::disallowed},
-    {U'\x2ff0', U'\x2ffb', idna_status::disallowed},
-    {U'\x2ffc', U'\x2fff', idna_status::disallowed},
-    {U'\x3000', U'\x3000', idna_status::disallowed_std3_mapped},
-    {U'\x3002', U'\x3002', idna_status::mapped},
-    {U'\x3036', U'\x3036', idna_status::mapped},
-    {U'\x3038', U'\x3038', idna_status::mapped},
-    {U'\x3039', U'\x3039', idna_status::mapped},
-    {U'\x303a', U'\x303a', idna_status::mapped},
-    {U'\x3040', U'\x3040', idna_status::disallowed},
-    {U'\x3097', U'\x3098', idna_status::disallowed},
-    {U'\x309b', U'\x309b', idna_status::disallowed_std3_mapped},
-    {U'\x309c', U'\x309c', idna_status::disallowed_std3_mapped},
-    {U'\x309f', U'\x309f', idna_status::mapped},
-    {U'\x30ff', U'\x30ff', idna_status::mapped},
-    {U'\x3100', U'\x3104', idna_status::disallowed},
-    {U'\x3130', U'\x3130', idna_status::disallowed},
-    {U'\x3131', U'\x3131', idna_status::mapped},
-    {U'\x3132', U'\x3132', idna_status::mapped},
-    {U'\x3133', U'\x3133', idna_status::mapped},
-    {U'\x3134', U'\x3134', idna_status::mapped},
-    {U'\x3135', U'\x3135', idna_status::mapped},
-    {U'\x3136', U'\x3136', idna_status::mapped},
-    {U'\x3137', U'\x3137', idna_status::mapped},
-    {U'\x3138', U'\x3138', idna_status::mapped},
-    {U'\x3139', U'\x3139', idna_status::mapped},
-    {U'\x313a', U'\x313a', idna_status::mapped},
-    {U'\x313b', U'\x313b', idna_status::mapped},
-    {U'\x313c', U'\x313c', idna_status::mapped},
-    {U'\x313d', U'\x313d', idna_status::mapped},
-    {U'\x313e', U'\x313e', idna_status::mapped},
-    {U'\x313f', U'\x313f', idna_status::mapped},
-    {U'\x3140', U'\x3140', idna_status::mapped},
-    {U'\x3141', U'\x3141', idna_status::mapped},
-    {U'\x3142', U'\x3142', idna_status::mapped},
-    {U'\x3143', U'\x3143', idna_status::mapped},
-    {U'\x3144', U'\x3144', idna_status::mapped},
-    {U'\x3145', U'\x3145', idna_status::mapped},
-    {U'\x3146', U'\x3146', idna_status::mapped},
-    {U'\x3147', U'\x3147', idna_status::mapped},
-    {U'\x3148', U'\x3148', idna_status::mapped},
-    {U'\x3149', U'\x3149', idna_status::mapped},
-    {U'\x314a', U'\x314a', idna_status::mapped},
-    {U'\x314b', U'\x314b', idna_status::mapped},
-    {U'\x314c', U'\x314c', idna_status::mapped},
-    {U'\x314d', U'\x314d', idna_status::mapped},
-    {U'\x314e', U'\x314e', idna_status::mapped},
-    {U'\x314f', U'\x314f', idna_status::mapped},
-    {U'\x3150', U'\x3150', idna_status::mapped},
-    {U'\x3151', U'\x3151', idna_status::mapped},
-    {U'\x3152', U'\x3152', idna_status::mapped},
-    {U'\x3153', U'\x3153', idna_status::mapped},
-    {U'\x3154', U'\x3154', idna_status::mapped},
-    {U'\x3155', U'\x3155', idna_status::mapped},
-    {U'\x3156', U'\x3156', idna_status::mapped},
-    {U'\x3157', U'\x3157', idna_status::mapped},
-    {U'\x3158', U'\x3158', idna_status::mapped},
-    {U'\x3159', U'\x3159', idna_status::mapped},
-    {U'\x315a', U'\x315a', idna_status::mapped},
-    {U'\x315b', U'\x315b', idna_status::mapped},
-    {U'\x315c', U'\x315c', idna_status::mapped},
-    {U'\x315d', U'\x315d', idna_status::mapped},
-    {U'\x315e', U'\x315e', idna_status::mapped},
-    {U'\x315f', U'\x315f', idna_status::mapped},
-    {U'\x3160', U'\x3160', idna_status::mapped},
-    {U'\x3161', U'\x3161', idna_status::mapped},
-    {U'\x3162', U'\x3162', idna_status::mapped},
-    {U'\x3163', U'\x3163', idna_status::mapped},
-    {U'\x3164', U'\x3164', idna_status::disallowed},
-    {U'\x3165', U'\x3165', idna_status::mapped},
-    {U'\x3166', U'\x3166', idna_status::mapped},
-    {U'\x3167', U'\x3167', idna_status::mapped},
-    {U'\x3168', U'\x3168', idna_status::mapped},
-    {U'\x3169', U'\x3169', idna_status::mapped},
-    {U'\x316a', U'\x316a', idna_status::mapped},
-    {U'\x316b', U'\x316b', idna_status::mapped},
-    {U'\x316c', U'\x316c', idna_status::mapped},
-    {U'\x316d', U'\x316d', idna_status::mapped},
-    {U'\x316e', U'\x316e', idna_status::mapped},
-    {U'\x316f', U'\x316f', idna_status::mapped},
-    {U'\x3170', U'\x3170', idna_status::mapped},
-    {U'\x3171', U'\x3171', idna_status::mapped},
-    {U'\x3172', U'\x3172', idna_status::mapped},
-    {U'\x3173', U'\x3173', idna_status::mapped},
-    {U'\x3174', U'\x3174', idna_status::mapped},
-    {U'\x3175', U'\x3175', idna_status::mapped},
-    {U'\x3176', U'\x3176', idna_status::mapped},
-    {U'\x3177', U'\x3177', idna_status::mapped},
-    {U'\x3178', U'\x3178', idna_status::mapped},
-    {U'\x3179', U'\x3179', idna_status::mapped},
-    {U'\x317a', U'\x317a', idna_status::mapped},
-    {U'\x317b', U'\x317b', idna_status::mapped},
-    {U'\x317c', U'\x317c', idna_status::mapped},
-    {U'\x317d', U'\x317d', idna_status::mapped},
-    {U'\x317e', U'\x317e', idna_status::mapped},
-    {U'\x317f', U'\x317f', idna_status::mapped},
-    {U'\x3180', U'\x3180', idna_status::mapped},
-    {U'\x3181', U'\x3181', idna_status::mapped},
-    {U'\x3182', U'\x3182', idna_status::mapped},
-    {U'\x3183', U'\x3183', idna_status::mapped},
-    {U'\x3184', U'\x3184', idna_status::mapped},
-    {U'\x3185', U'\x3185', idna_status::mapped},
-    {U'\x3186', U'\x3186', idna_status::mapped},
-    {U'\x3187', U'\x3187', idna_status::mapped},
-    {U'\x3188', U'\x3188', idna_status::mapped},
-    {U'\x3189', U'\x3189', idna_status::mapped},
-    {U'\x318a', U'\x318a', idna_status::mapped},
-    {U'\x318b', U'\x318b', idna_status::mapped},
-    {U'\x318c', U'\x318c', idna_status::mapped},
-    {U'\x318d', U'\x318d', idna_status::mapped},
-    {U'\x318e', U'\x318e', idna_status::mapped},
-    {U'\x318f', U'\x318f', idna_status::disallowed},
-    {U'\x3192', U'\x3192', idna_status::mapped},
-    {U'\x3193', U'\x3193', idna_status::mapped},
-    {U'\x3194', U'\x3194', idna_status::mapped},
-    {U'\x3195', U'\x3195', idna_status::mapped},
-    {U'\x3196', U'\x3196', idna_status::mapped},
-    {U'\x3197', U'\x3197', idna_status::mapped},
-    {U'\x3198', U'\x3198', idna_status::mapped},
-    {U'\x3199', U'\x3199', idna_status::mapped},
-    {U'\x319a', U'\x319a', idna_status::mapped},
-    {U'\x319b', U'\x319b', idna_status::mapped},
-    {U'\x319c', U'\x319c', idna_status::mapped},
-    {U'\x319d', U'\x319d', idna_status::mapped},
-    {U'\x319e', U'\x319e', idna_status::mapped},
-    {U'\x319f', U'\x319f', idna_status::mapped},
-    {U'\x31e4', U'\x31ee', idna_status::disallowed},
-    {U'\x31ef', U'\x31ef', idna_status::disallowed},
-    {U'\x3200', U'\x3200', idna_status::disallowed_std3_mapped},
-    {U'\x3201', U'\x3201', idna_status::disallowed_std3_mapped},
-    {U'\x3202', U'\x3202', idna_status::disallowed_std3_mapped},
-    {U'\x3203', U'\x3203', idna_status::disallowed_std3_mapped},
-    {U'\x3204', U'\x3204', idna_status::disallowed_std3_mapped},
-    {U'\x3205', U'\x3205', idna_status::disallowed_std3_mapped},
-    {U'\x3206', U'\x3206', idna_status::disallowed_std3_mapped},
-    {U'\x3207', U'\x3207', idna_status::disallowed_std3_mapped},
-    {U'\x3208', U'\x3208', idna_status::disallowed_std3_mapped},
-    {U'\x3209', U'\x3209', idna_status::disallowed_std3_mapped},
-    {U'\x320a', U'\x320a', idna_status::disallowed_std3_mapped},
-    {U'\x320b', U'\x320b', idna_status::disallowed_std3_mapped},
-    {U'\x320c', U'\x320c', idna_status::disallowed_std3_mapped},
-    {U'\x320d', U'\x320d', idna_status::disallowed_std3_mapped},
-    {U'\x320e', U'\x320e', idna_status::disallowed_std3_mapped},
-    {U'\x320f', U'\x320f', idna_status::disallowed_std3_mapped},
-    {U'\x3210', U'\x3210', idna_status::disallowed_std3_mapped},
-    {U'\x3211', U'\x3211', idna_status::disallowed_std3_mapped},
-    {U'\x3212', U'\x3212', idna_status::disallowed_std3_mapped},
-    {U'\x3213', U'\x3213', idna_status::disallowed_std3_mapped},
-    {U'\x3214', U'\x3214', idna_status::disallowed_std3_mapped},
-    {U'\x3215', U'\x3215', idna_status::disallowed_std3_mapped},
-    {U'\x3216', U'\x3216', idna_status::disallowed_std3_mapped},
-    {U'\x3217', U'\x3217', idna_status::disallowed_std3_mapped},
-    {U'\x3218', U'\x3218', idna_status::disallowed_std3_mapped},
-    {U'\x3219', U'\x3219', idna_status::disallowed_std3_mapped},
-    {U'\x321a', U'\x321a', idna_status::disallowed_std3_mapped},
-    {U'\x321b', U'\x321b', idna_status::disallowed_std3_mapped},
-    {U'\x321c', U'\x321c', idna_status::disallowed_std3_mapped},
-    {U'\x321d', U'\x321d', idna_status::disallowed_std3_mapped},
-    {U'\x321e', U'\x321e', idna_status::disallowed_std3_mapped},
-    {U'\x321f', U'\x321f', idna_status::disallowed},
-    {U'\x3220', U'\x3220', idna_status::disallowed_std3_mapped},
-    {U'\x3221', U'\x3221', idna_status::disallowed_std3_mapped},
-    {U'\x3222', U'\x3222', idna_status::disallowed_std3_mapped},
-    {U'\x3223', U'\x3223', idna_status::disallowed_std3_mapped},
-    {U'\x3224', U'\x3224', idna_status::disallowed_std3_mapped},
-    {U'\x3225', U'\x3225', idna_status::disallowed_std3_mapped},
-    {U'\x3226', U'\x3226', idna_status::disallowed_std3_mapped},
-    {U'\x3227', U'\x3227', idna_status::disallowed_std3_mapped},
-    {U'\x3228', U'\x3228', idna_status::disallowed_std3_mapped},
-    {U'\x3229', U'\x3229', idna_status::disallowed_std3_mapped},
-    {U'\x322a', U'\x322a', idna_status::disallowed_std3_mapped},
-    {U'\x322b', U'\x322b', idna_status::disallowed_std3_mapped},
-    {U'\x322c', U'\x322c', idna_status::disallowed_std3_mapped},
-    {U'\x322d', U'\x322d', idna_status::disallowed_std3_mapped},
-    {U'\x322e', U'\x322e', idna_status::disallowed_std3_mapped},
-    {U'\x322f', U'\x322f', idna_status::disallowed_std3_mapped},
-    {U'\x3230', U'\x3230', idna_status::disallowed_std3_mapped},
-    {U'\x3231', U'\x3231', idna_status::disallowed_std3_mapped},
-    {U'\x3232', U'\x3232', idna_status::disallowed_std3_mapped},
-    {U'\x3233', U'\x3233', idna_status::disallowed_std3_mapped},
-    {U'\x3234', U'\x3234', idna_status::disallowed_std3_mapped},
-    {U'\x3235', U'\x3235', idna_status::disallowed_std3_mapped},
-    {U'\x3236', U'\x3236', idna_status::disallowed_std3_mapped},
-    {U'\x3237', U'\x3237', idna_status::disallowed_std3_mapped},
-    {U'\x3238', U'\x3238', idna_status::disallowed_std3_mapped},
-    {U'\x3239', U'\x3239', idna_status::disallowed_std3_mapped},
-    {U'\x323a', U'\x323a', idna_status::disallowed_std3_mapped},
-    {U'\x323b', U'\x323b', idna_status::disallowed_std3_mapped},
-    {U'\x323c', U'\x323c', idna_status::disallowed_std3_mapped},
-    {U'\x323d', U'\x323d', idna_status::disallowed_std3_mapped},
-    {U'\x323e', U'\x323e', idna_status::disallowed_std3_mapped},
-    {U'\x323f', U'\x323f', idna_status::disallowed_std3_mapped},
-    {U'\x3240', U'\x3240', idna_status::disallowed_std3_mapped},
-    {U'\x3241', U'\x3241', idna_status::disallowed_std3_mapped},
-    {U'\x3242', U'\x3242', idna_status::disallowed_std3_mapped},
-    {U'\x3243', U'\x3243', idna_status::disallowed_std3_mapped},
-    {U'\x3244', U'\x3244', idna_status::mapped},
-    {U'\x3245', U'\x3245', idna_status::mapped},
-    {U'\x3246', U'\x3246', idna_status::mapped},
-    {U'\x3247', U'\x3247', idna_status::mapped},
-    {U'\x3250', U'\x3250', idna_status::mapped},
-    {U'\x3251', U'\x3251', idna_status::mapped},
-    {U'\x3252', U'\x3252', idna_status::mapped},
-    {U'\x3253', U'\x3253', idna_status::mapped},
-    {U'\x3254', U'\x3254', idna_status::mapped},
-    {U'\x3255', U'\x3255', idna_status::mapped},
-    {U'\x3256', U'\x3256', idna_status::mapped},
-    {U'\x3257', U'\x3257', idna_status::mapped},
-    {U'\x3258', U'\x3258', idna_status::mapped},
-    {U'\x3259', U'\x3259', idna_status::mapped},
-    {U'\x325a', U'\x325a', idna_status::mapped},
-    {U'\x325b', U'\x325b', idna_status::mapped},
-    {U'\x325c', U'\x325c', idna_status::mapped},
-    {U'\x325d', U'\x325d', idna_status::mapped},
-    {U'\x325e', U'\x325e', idna_status::mapped},
-    {U'\x325f', U'\x325f', idna_status::mapped},
-    {U'\x3260', U'\x3260', idna_status::mapped},
-    {U'\x3261', U'\x3261', idna_status::mapped},
-    {U'\x3262', U'\x3262', idna_status::mapped},
-    {U'\x3263', U'\x3263', idna_status::mapped},
-    {U'\x3264', U'\x3264', idna_status::mapped},
-    {U'\x3265', U'\x3265', idna_status::mapped},
-    {U'\x3266', U'\x3266', idna_status::mapped},
-    {U'\x3267', U'\x3267', idna_status::mapped},
-    {U'\x3268', U'\x3268', idna_status::mapped},
-    {U'\x3269', U'\x3269', idna_status::mapped},
-    {U'\x326a', U'\x326a', idna_status::mapped},
-    {U'\x326b', U'\x326b', idna_status::mapped},
-    {U'\x326c', U'\x326c', idna_status::mapped},
-    {U'\x326d', U'\x326d', idna_status::mapped},
-    {U'\x326e', U'\x326e', idna_status::mapped},
-    {U'\x326f', U'\x326f', idna_status::mapped},
-    {U'\x3270', U'\x3270', idna_status::mapped},
-    {U'\x3271', U'\x3271', idna_status::mapped},
-    {U'\x3272', U'\x3272', idna_status::mapped},
-    {U'\x3273', U'\x3273', idna_status::mapped},
-    {U'\x3274', U'\x3274', idna_status::mapped},
-    {U'\x3275', U'\x3275', idna_status::mapped},
-    {U'\x3276', U'\x3276', idna_status::mapped},
-    {U'\x3277', U'\x3277', idna_status::mapped},
-    {U'\x3278', U'\x3278', idna_status::mapped},
-    {U'\x3279', U'\x3279', idna_status::mapped},
-    {U'\x327a', U'\x327a', idna_status::mapped},
-    {U'\x327b', U'\x327b', idna_status::mapped},
-    {U'\x327c', U'\x327c', idna_status::mapped},
-    {U'\x327d', U'\x327d', idna_status::mapped},
-    {U'\x327e', U'\x327e', idna_status::mapped},
-    {U'\x3280', U'\x3280', idna_status::mapped},
-    {U'\x3281', U'\x3281', idna_status::mapped},
-    {U'\x3282', U'\x3282', idna_status::mapped},
-    {U'\x3283', U'\x3283', idna_status::mapped},
-    {U'\x3284', U'\x3284', idna_status::mapped},
-    {U'\x3285', U'\x3285', idna_status::mapped},
-    {U'\x3286', U'\x3286', idna_status::mapped},
-    {U'\x3287', U'\x3287', idna_status::mapped},
-    {U'\x3288', U'\x3288', idna_status::mapped},
-    {U'\x3289', U'\x3289', idna_status::mapped},
-    {U'\x328a', U'\x328a', idna_status::mapped},
-    {U'\x328b', U'\x328b', idna_status::mapped},
-    {U'\x328c', U'\x328c', idna_status::mapped},
-    {U'\x328d', U'\x328d', idna_status::mapped},
-    {U'\x328e', U'\x328e', idna_status::mapped},
-    {U'\x328f', U'\x328f', idna_status::mapped},
-    {U'\x3290', U'\x3290', idna_status::mapped},
-    {U'\x3291', U'\x3291', idna_status::mapped},
-    {U'\x3292', U'\x3292', idna_status::mapped},
-    {U'\x3293', U'\x3293', idna_status::mapped},
-    {U'\x3294', U'\x3294', idna_status::mapped},
-    {U'\x3295', U'\x3295', idna_status::mapped},
-    {U'\x3296', U'\x3296', idna_status::mapped},
-    {U'\x3297', U'\x3297', idna_status::mapped},
-    {U'\x3298', U'\x3298', idna_status::mapped},
-    {U'\x3299', U'\x3299', idna_status::mapped},
-    {U'\x329a', U'\x329a', idna_status::mapped},
-    {U'\x329b', U'\x329b', idna_status::mapped},
-    {U'\x329c', U'\x329c', idna_status::mapped},
-    {U'\x329d', U'\x329d', idna_status::mapped},
-    {U'\x329e', U'\x329e', idna_status::mapped},
-    {U'\x329f', U'\x329f', idna_status::mapped},
-    {U'\x32a0', U'\x32a0', idna_status::mapped},
-    {U'\x32a1', U'\x32a1', idna_status::mapped},
-    {U'\x32a2', U'\x32a2', idna_status::mapped},
-    {U'\x32a3', U'\x32a3', idna_status::mapped},
-    {U'\x32a4', U'\x32a4', idna_status::mapped},
-    {U'\x32a5', U'\x32a5', idna_status::mapped},
-    {U'\x32a6', U'\x32a6', idna_status::mapped},
-    {U'\x32a7', U'\x32a7', idna_status::mapped},
-    {U'\x32a8', U'\x32a8', idna_status::mapped},
-    {U'\x32a9', U'\x32a9', idna_status::mapped},
-    {U'\x32aa', U'\x32aa', idna_status::mapped},
-    {U'\x32ab', U'\x32ab', idna_status::mapped},
-    {U'\x32ac', U'\x32ac', idna_status::mapped},
-    {U'\x32ad', U'\x32ad', idna_status::mapped},
-    {U'\x32ae', U'\x32ae', idna_status::mapped},
-    {U'\x32af', U'\x32af', idna_status::mapped},
-    {U'\x32b0', U'\x32b0', idna_status::mapped},
-    {U'\x32b1', U'\x32b1', idna_status::mapped},
-    {U'\x32b2', U'\x32b2', idna_status::mapped},
-    {U'\x32b3', U'\x32b3', idna_status::mapped},
-    {U'\x32b4', U'\x32b4', idna_status::mapped},
-    {U'\x32b5', U'\x32b5', idna_status::mapped},
-    {U'\x32b6', U'\x32b6', idna_status::mapped},
-    {U'\x32b7', U'\x32b7', idna_status::mapped},
-    {U'\x32b8', U'\x32b8', idna_status::mapped},
-    {U'\x32b9', U'\x32b9', idna_status::mapped},
-    {U'\x32ba', U'\x32ba', idna_status::mapped},
-    {U'\x32bb', U'\x32bb', idna_status::mapped},
-    {U'\x32bc', U'\x32bc', idna_status::mapped},
-    {U'\x32bd', U'\x32bd', idna_status::mapped},
-    {U'\x32be', U'\x32be', idna_status::mapped},
-    {U'\x32bf', U'\x32bf', idna_status::mapped},
-    {U'\x32c0', U'\x32c0', idna_status::mapped},
-    {U'\x32c1', U'\x32c1', idna_status::mapped},
-    {U'\x32c2', U'\x32c2', idna_status::mapped},
-    {U'\x32c3', U'\x32c3', idna_status::mapped},
-    {U'\x32c4', U'\x32c4', idna_status::mapped},
-    {U'\x32c5', U'\x32c5', idna_status::mapped},
-    {U'\x32c6', U'\x32c6', idna_status::mapped},
-    {U'\x32c7', U'\x32c7', idna_status::mapped},
-    {U'\x32c8', U'\x32c8', idna_status::mapped},
-    {U'\x32c9', U'\x32c9', idna_status::mapped},
-    {U'\x32ca', U'\x32ca', idna_status::mapped},
-    {U'\x32cb', U'\x32cb', idna_status::mapped},
-    {U'\x32cc', U'\x32cc', idna_status::mapped},
-    {U'\x32cd', U'\x32cd', idna_status::mapped},
-    {U'\x32ce', U'\x32ce', idna_status::mapped},
-    {U'\x32cf', U'\x32cf', idna_status::mapped},
-    {U'\x32d0', U'\x32d0', idna_status::mapped},
-    {U'\x32d1', U'\x32d1', idna_status::mapped},
-    {U'\x32d2', U'\x32d2', idna_status::mapped},
-    {U'\x32d3', U'\x32d3', idna_status::mapped},
-    {U'\x32d4', U'\x32d4', idna_status::mapped},
-    {U'\x32d5', U'\x32d5', idna_status::mapped},
-    {U'\x32d6', U'\x32d6', idna_status::mapped},
-    {U'\x32d7', U'\x32d7', idna_status::mapped},
-    {U'\x32d8', U'\x32d8', idna_status::mapped},
-    {U'\x32d9', U'\x32d9', idna_status::mapped},
-    {U'\x32da', U'\x32da', idna_status::mapped},
-    {U'\x32db', U'\x32db', idna_status::mapped},
-    {U'\x32dc', U'\x32dc', idna_status::mapped},
-    {U'\x32dd', U'\x32dd', idna_status::mapped},
-    {U'\x32de', U'\x32de', idna_status::mapped},
-    {U'\x32df', U'\x32df', idna_status::mapped},
-    {U'\x32e0', U'\x32e0', idna_status::mapped},
-    {U'\x32e1', U'\x32e1', idna_status::mapped},
-    {U'\x32e2', U'\x32e2', idna_status::mapped},
-    {U'\x32e3', U'\x32e3', idna_status::mapped},
-    {U'\x32e4', U'\x32e4', idna_status::mapped},
-    {U'\x32e5', U'\x32e5', idna_status::mapped},
-    {U'\x32e6', U'\x32e6', idna_status::mapped},
-    {U'\x32e7', U'\x32e7', idna_status::mapped},
-    {U'\x32e8', U'\x32e8', idna_status::mapped},
-    {U'\x32e9', U'\x32e9', idna_status::mapped},
-    {U'\x32ea', U'\x32ea', idna_status::mapped},
-    {U'\x32eb', U'\x32eb', idna_status::mapped},
-    {U'\x32ec', U'\x32ec', idna_status::mapped},
-    {U'\x32ed', U'\x32ed', idna_status::mapped},
-    {U'\x32ee', U'\x32ee', idna_status::mapped},
-    {U'\x32ef', U'\x32ef', idna_status::mapped},
-    {U'\x32f0', U'\x32f0', idna_status::mapped},
-    {U'\x32f1', U'\x32f1', idna_status::mapped},
-    {U'\x32f2', U'\x32f2', idna_status::mapped},
-    {U'\x32f3', U'\x32f3', idna_status::mapped},
-    {U'\x32f4', U'\x32f4', idna_status::mapped},
-    {U'\x32f5', U'\x32f5', idna_status::mapped},
-    {U'\x32f6', U'\x32f6', idna_status::mapped},
-    {U'\x32f7', U'\x32f7', idna_status::mapped},
-    {U'\x32f8', U'\x32f8', idna_status::mapped},
-    {U'\x32f9', U'\x32f9', idna_status::mapped},
-    {U'\x32fa', U'\x32fa', idna_status::mapped},
-    {U'\x32fb', U'\x32fb', idna_status::mapped},
-    {U'\x32fc', U'\x32fc', idna_status::mapped},
-    {U'\x32fd', U'\x32fd', idna_status::mapped},
-    {U'\x32fe', U'\x32fe', idna_status::mapped},
-    {U'\x32ff', U'\x32ff', idna_status::mapped},
-    {U'\x3300', U'\x3300', idna_status::mapped},
-    {U'\x3301', U'\x3301', idna_status::mapped},
-    {U'\x3302', U'\x3302', idna_status::mapped},
-    {U'\x3303', U'\x3303', idna_status::mapped},
-    {U'\x3304', U'\x3304', idna_status::mapped},
-    {U'\x3305', U'\x3305', idna_status::mapped},
-    {U'\x3306', U'\x3306', idna_status::mapped},
-    {U'\x3307', U'\x3307', idna_status::mapped},
-    {U'\x3308', U'\x3308', idna_status::mapped},
-    {U'\x3309', U'\x3309', idna_status::mapped},
-    {U'\x330a', U'\x330a', idna_status::mapped},
-    {U'\x330b', U'\x330b', idna_status::mapped},
-    {U'\x330c', U'\x330c', idna_status::mapped},
-    {U'\x330d', U'\x330d', idna_status::mapped},
-    {U'\x330e', U'\x330e', idna_status::mapped},
-    {U'\x330f', U'\x330f', idna_status::mapped},
-    {U'\x3310', U'\x3310', idna_status::mapped},
-    {U'\x3311', U'\x3311', idna_status::mapped},
-    {U'\x3312', U'\x3312', idna_status::mapped},
-    {U'\x3313', U'\x3313', idna_status::mapped},
-    {U'\x3314', U'\x3314', idna_status::mapped},
-    {U'\x3315', U'\x3315', idna_status::mapped},
-    {U'\x3316', U'\x3316', idna_status::mapped},
-    {U'\x3317', U'\x3317', idna_status::mapped},
-    {U'\x3318', U'\x3318', idna_status::mapped},
-    {U'\x3319', U'\x3319', idna_status::mapped},
-    {U'\x331a', U'\x331a', idna_status::mapped},
-    {U'\x331b', U'\x331b', idna_status::mapped},
-    {U'\x331c', U'\x331c', idna_status::mapped},
-    {U'\x331d', U'\x331d', idna_status::mapped},
-    {U'\x331e', U'\x331e', idna_status::mapped},
-    {U'\x331f', U'\x331f', idna_status::mapped},
-    {U'\x3320', U'\x3320', idna_status::mapped},
-    {U'\x3321', U'\x3321', idna_status::mapped},
-    {U'\x3322', U'\x3322', idna_status::mapped},
-    {U'\x3323', U'\x3323', idna_status::mapped},
-    {U'\x3324', U'\x3324', idna_status::mapped},
-    {U'\x3325', U'\x3325', idna_status::mapped},
-    {U'\x3326', U'\x3326', idna_status::mapped},
-    {U'\x3327', U'\x3327', idna_status::mapped},
-    {U'\x3328', U'\x3328', idna_status::mapped},
-    {U'\x3329', U'\x3329', idna_status::mapped},
-    {U'\x332a', U'\x332a', idna_status::mapped},
-    {U'\x332b', U'\x332b', idna_status::mapped},
-    {U'\x332c', U'\x332c', idna_status::mapped},
-    {U'\x332d', U'\x332d', idna_status::mapped},
-    {U'\x332e', U'\x332e', idna_status::mapped},
-    {U'\x332f', U'\x332f', idna_status::mapped},
-    {U'\x3330', U'\x3330', idna_status::mapped},
-    {U'\x3331', U'\x3331', idna_status::mapped},
-    {U'\x3332', U'\x3332', idna_status::mapped},
-    {U'\x3333', U'\x3333', idna_status::mapped},
-    {U'\x3334', U'\x3334', idna_status::mapped},
-    {U'\x3335', U'\x3335', idna_status::mapped},
-    {U'\x3336', U'\x3336', idna_status::mapped},
-    {U'\x3337', U'\x3337', idna_status::mapped},
-    {U'\x3338', U'\x3338', idna_status::mapped},
-    {U'\x3339', U'\x3339', idna_status::mapped},
-    {U'\x333a', U'\x333a', idna_status::mapped},
-    {U'\x333b', U'\x333b', idna_status::mapped},
-    {U'\x333c', U'\x333c', idna_status::mapped},
-    {U'\x333d', U'\x333d', idna_status::mapped},
-    {U'\x333e', U'\x333e', idna_status::mapped},
-    {U'\x333f', U'\x333f', idna_status::mapped},
-    {U'\x3340', U'\x3340', idna_status::mapped},
-    {U'\x3341', U'\x3341', idna_status::mapped},
-    {U'\x3342', U'\x3342', idna_status::mapped},
-    {U'\x3343', U'\x3343', idna_status::mapped},
-    {U'\x3344', U'\x3344', idna_status::mapped},
-    {U'\x3345', U'\x3345', idna_status::mapped},
-    {U'\x3346', U'\x3346', idna_status::mapped},
-    {U'\x3347', U'\x3347', idna_status::mapped},
-    {U'\x3348', U'\x3348', idna_status::mapped},
-    {U'\x3349', U'\x3349', idna_status::mapped},
-    {U'\x334a', U'\x334a', idna_status::mapped},
-    {U'\x334b', U'\x334b', idna_status::mapped},
-    {U'\x334c', U'\x334c', idna_status::mapped},
-    {U'\x334d', U'\x334d', idna_status::mapped},
-    {U'\x334e', U'\x334e', idna_status::mapped},
-    {U'\x334f', U'\x334f', idna_status::mapped},
-    {U'\x3350', U'\x3350', idna_status::mapped},
-    {U'\x3351', U'\x3351', idna_status::mapped},
-    {U'\x3352', U'\x3352', idna_status::mapped},
-    {U'\x3353', U'\x3353', idna_status::mapped},
-    {U'\x3354', U'\x3354', idna_status::mapped},
-    {U'\x3355', U'\x3355', idna_status::mapped},
-    {U'\x3356', U'\x3356', idna_status::mapped},
-    {U'\x3357', U'\x3357', idna_status::mapped},
-    {U'\x3358', U'\x3358', idna_status::mapped},
-    {U'\x3359', U'\x3359', idna_status::mapped},
-    {U'\x335a', U'\x335a', idna_status::mapped},
-    {U'\x335b', U'\x335b', idna_status::mapped},
-    {U'\x335c', U'\x335c', idna_status::mapped},
-    {U'\x335d', U'\x335d', idna_status::mapped},
-    {U'\x335e', U'\x335e', idna_status::mapped},
-    {U'\x335f', U'\x335f', idna_status::mapped},
-    {U'\x3360', U'\x3360', idna_status::mapped},
-    {U'\x3361', U'\x3361', idna_status::mapped},
-    {U'\x3362', U'\x3362', idna_status::mapped},
-    {U'\x3363', U'\x3363', idna_status::mapped},
-    {U'\x3364', U'\x3364', idna_status::mapped},
-    {U'\x3365', U'\x3365', idna_status::mapped},
-    {U'\x3366', U'\x3366', idna_status::mapped},
-    {U'\x3367', U'\x3367', idna_status::mapped},
-    {U'\x3368', U'\x3368', idna_status::mapped},
-    {U'\x3369', U'\x3369', idna_status::mapped},
-    {U'\x336a', U'\x336a', idna_status::mapped},
-    {U'\x336b', U'\x336b', idna_status::mapped},
-    {U'\x336c', U'\x336c', idna_status::mapped},
-    {U'\x336d', U'\x336d', idna_status::mapped},
-    {U'\x336e', U'\x336e', idna_status::mapped},
-    {U'\x336f', U'\x336f', idna_status::mapped},
-    {U'\x3370', U'\x3370', idna_status::mapped},
-    {U'\x3371', U'\x3371', idna_status::mapped},
-    {U'\x3372', U'\x3372', idna_status::mapped},
-    {U'\x3373', U'\x3373', idna_status::mapped},
-    {U'\x3374', U'\x3374', idna_status::mapped},
-    {U'\x3375', U'\x3375', idna_status::mapped},
-    {U'\x3376', U'\x3376', idna_status::mapped},
-    {U'\x3377', U'\x3377', idna_status::mapped},
-    {U'\x3378', U'\x3378', idna_status::mapped},
-    {U'\x3379', U'\x3379', idna_status::mapped},
-    {U'\x337a', U'\x337a', idna_status::mapped},
-    {U'\x337b', U'\x337b', idna_status::mapped},
-    {U'\x337c', U'\x337c', idna_status::mapped},
-    {U'\x337d', U'\x337d', idna_status::mapped},
-    {U'\x337e', U'\x337e', idna_status::mapped},
-    {U'\x337f', U'\x337f', idna_status::mapped},
-    {U'\x3380', U'\x3380', idna_status::mapped},
-    {U'\x3381', U'\x3381', idna_status::mapped},
-    {U'\x3382', U'\x3382', idna_status::mapped},
-    {U'\x3383', U'\x3383', idna_status::mapped},
-    {U'\x3384', U'\x3384', idna_status::mapped},
-    {U'\x3385', U'\x3385', idna_status::mapped},
-    {U'\x3386', U'\x3386', idna_status::mapped},
-    {U'\x3387', U'\x3387', idna_status::mapped},
-    {U'\x3388', U'\x3388', idna_status::mapped},
-    {U'\x3389', U'\x3389', idna_status::mapped},
-    {U'\x338a', U'\x338a', idna_status::mapped},
-    {U'\x338b', U'\x338b', idna_status::mapped},
-    {U'\x338c', U'\x338c', idna_status::mapped},
-    {U'\x338d', U'\x338d', idna_status::mapped},
-    {U'\x338e', U'\x338e', idna_status::mapped},
-    {U'\x338f', U'\x338f', idna_status::mapped},
-    {U'\x3390', U'\x3390', idna_status::mapped},
-    {U'\x3391', U'\x3391', idna_status::mapped},
-    {U'\x3392', U'\x3392', idna_status::mapped},
-    {U'\x3393', U'\x3393', idna_status::mapped},
-    {U'\x3394', U'\x3394', idna_status::mapped},
-    {U'\x3395', U'\x3395', idna_status::mapped},
-    {U'\x3396', U'\x3396', idna_status::mapped},
-    {U'\x3397', U'\x3397', idna_status::mapped},
-    {U'\x3398', U'\x3398', idna_status::mapped},
-    {U'\x3399', U'\x3399', idna_status::mapped},
-    {U'\x339a', U'\x339a', idna_status::mapped},
-    {U'\x339b', U'\x339b', idna_status::mapped},
-    {U'\x339c', U'\x339c', idna_status::mapped},
-    {U'\x339d', U'\x339d', idna_status::mapped},
-    {U'\x339e', U'\x339e', idna_status::mapped},
-    {U'\x339f', U'\x339f', idna_status::mapped},
-    {U'\x33a0', U'\x33a0', idna_status::mapped},
-    {U'\x33a1', U'\x33a1', idna_status::mapped},
-    {U'\x33a2', U'\x33a2', idna_status::mapped},
-    {U'\x33a3', U'\x33a3', idna_status::mapped},
-    {U'\x33a4', U'\x33a4', idna_status::mapped},
-    {U'\x33a5', U'\x33a5', idna_status::mapped},
-    {U'\x33a6', U'\x33a6', idna_status::mapped},
-    {U'\x33a7', U'\x33a7', idna_status::mapped},
-    {U'\x33a8', U'\x33a8', idna_status::mapped},
-    {U'\x33a9', U'\x33a9', idna_status::mapped},
-    {U'\x33aa', U'\x33aa', idna_status::mapped},
-    {U'\x33ab', U'\x33ab', idna_status::mapped},
-    {U'\x33ac', U'\x33ac', idna_status::mapped},
-    {U'\x33ad', U'\x33ad', idna_status::mapped},
-    {U'\x33ae', U'\x33ae', idna_status::mapped},
-    {U'\x33af', U'\x33af', idna_status::mapped},
-    {U'\x33b0', U'\x33b0', idna_status::mapped},
-    {U'\x33b1', U'\x33b1', idna_status::mapped},
-    {U'\x33b2', U'\x33b2', idna_status::mapped},
-    {U'\x33b3', U'\x33b3', idna_status::mapped},
-    {U'\x33b4', U'\x33b4', idna_status::mapped},
-    {U'\x33b5', U'\x33b5', idna_status::mapped},
-    {U'\x33b6', U'\x33b6', idna_status::mapped},
-    {U'\x33b7', U'\x33b7', idna_status::mapped},
-    {U'\x33b8', U'\x33b8', idna_status::mapped},
-    {U'\x33b9', U'\x33b9', idna_status::mapped},
-    {U'\x33ba', U'\x33ba', idna_status::mapped},
-    {U'\x33bb', U'\x33bb', idna_status::mapped},
-    {U'\x33bc', U'\x33bc', idna_status::mapped},
-    {U'\x33bd', U'\x33bd', idna_status::mapped},
-    {U'\x33be', U'\x33be', idna_status::mapped},
-    {U'\x33bf', U'\x33bf', idna_status::mapped},
-    {U'\x33c0', U'\x33c0', idna_status::mapped},
-    {U'\x33c1', U'\x33c1', idna_status::mapped},
-    {U'\x33c2', U'\x33c2', idna_status::disallowed},
-    {U'\x33c3', U'\x33c3', idna_status::mapped},
-    {U'\x33c4', U'\x33c4', idna_status::mapped},
-    {U'\x33c5', U'\x33c5', idna_status::mapped},
-    {U'\x33c6', U'\x33c6', idna_status::mapped},
-    {U'\x33c7', U'\x33c7', idna_status::disallowed},
-    {U'\x33c8', U'\x33c8', idna_status::mapped},
-    {U'\x33c9', U'\x33c9', idna_status::mapped},
-    {U'\x33ca', U'\x33ca', idna_status::mapped},
-    {U'\x33cb', U'\x33cb', idna_status::mapped},
-    {U'\x33cc', U'\x33cc', idna_status::mapped},
-    {U'\x33cd', U'\x33cd', idna_status::mapped},
-    {U'\x33ce', U'\x33ce', idna_status::mapped},
-    {U'\x33cf', U'\x33cf', idna_status::mapped},
-    {U'\x33d0', U'\x33d0', idna_status::mapped},
-    {U'\x33d1', U'\x33d1', idna_status::mapped},
-    {U'\x33d2', U'\x33d2', idna_status::mapped},
-    {U'\x33d3', U'\x33d3', idna_status::mapped},
-    {U'\x33d4', U'\x33d4', idna_status::mapped},
-    {U'\x33d5', U'\x33d5', idna_status::mapped},
-    {U'\x33d6', U'\x33d6', idna_status::mapped},
-    {U'\x33d7', U'\x33d7', idna_status::mapped},
-    {U'\x33d8', U'\x33d8', idna_status::disallowed},
-    {U'\x33d9', U'\x33d9', idna_status::mapped},
-    {U'\x33da', U'\x33da', idna_status::mapped},
-    {U'\x33db', U'\x33db', idna_status::mapped},
-    {U'\x33dc', U'\x33dc', idna_status::mapped},
-    {U'\x33dd', U'\x33dd', idna_status::mapped},
-    {U'\x33de', U'\x33de', idna_status::mapped},
-    {U'\x33df', U'\x33df', idna_status::mapped},
-    {U'\x33e0', U'\x33e0', idna_status::mapped},
-    {U'\x33e1', U'\x33e1', idna_status::mapped},
-    {U'\x33e2', U'\x33e2', idna_status::mapped},
-    {U'\x33e3', U'\x33e3', idna_status::mapped},
-    {U'\x33e4', U'\x33e4', idna_status::mapped},
-    {U'\x33e5', U'\x33e5', idna_status::mapped},
-    {U'\x33e6', U'\x33e6', idna_status::mapped},
-    {U'\x33e7', U'\x33e7', idna_status::mapped},
-    {U'\x33e8', U'\x33e8', idna_status::mapped},
-    {U'\x33e9', U'\x33e9', idna_status::mapped},
-    {U'\x33ea', U'\x33ea', idna_status::mapped},
-    {U'\x33eb', U'\x33eb', idna_status::mapped},
-    {U'\x33ec', U'\x33ec', idna_status::mapped},
-    {U'\x33ed', U'\x33ed', idna_status::mapped},
-    {U'\x33ee', U'\x33ee', idna_status::mapped},
-    {U'\x33ef', U'\x33ef', idna_status::mapped},
-    {U'\x33f0', U'\x33f0', idna_status::mapped},
-    {U'\x33f1', U'\x33f1', idna_status::mapped},
-    {U'\x33f2', U'\x33f2', idna_status::mapped},
-    {U'\x33f3', U'\x33f3', idna_status::mapped},
-    {U'\x33f4', U'\x33f4', idna_status::mapped},
-    {U'\x33f5', U'\x33f5', idna_status::mapped},
-    {U'\x33f6', U'\x33f6', idna_status::mapped},
-    {U'\x33f7', U'\x33f7', idna_status::mapped},
-    {U'\x33f8', U'\x33f8', idna_status::mapped},
-    {U'\x33f9', U'\x33f9', idna_status::mapped},
-    {U'\x33fa', U'\x33fa', idna_status::mapped},
-    {U'\x33fb', U'\x33fb', idna_status::mapped},
-    {U'\x33fc', U'\x33fc', idna_status::mapped},
-    {U'\x33fd', U'\x33fd', idna_status::mapped},
-    {U'\x33fe', U'\x33fe', idna_status::mapped},
-    {U'\x33ff', U'\x33ff', idna_status::mapped},
-    {U'\xa48d', U'\xa48f', idna_status::disallowed},
-    {U'\xa4c7', U'\xa4cf', idna_status::disallowed},
-    {U'\xa62c', U'\xa63f', idna_status::disallowed},
-    {U'\xa640', U'\xa640', idna_status::mapped},
-    {U'\xa642', U'\xa642', idna_status::mapped},
-    {U'\xa644', U'\xa644', idna_status::mapped},
-    {U'\xa646', U'\xa646', idna_status::mapped},
-    {U'\xa648', U'\xa648', idna_status::mapped},
-    {U'\xa64a', U'\xa64a', idna_status::mapped},
-    {U'\xa64c', U'\xa64c', idna_status::mapped},
-    {U'\xa64e', U'\xa64e', idna_status::mapped},
-    {U'\xa650', U'\xa650', idna_status::mapped},
-    {U'\xa652', U'\xa652', idna_status::mapped},
-    {U'\xa654', U'\xa654', idna_status::mapped},
-    {U'\xa656', U'\xa656', idna_status::mapped},
-    {U'\xa658', U'\xa658', idna_status::mapped},
-    {U'\xa65a', U'\xa65a', idna_status::mapped},
-    {U'\xa65c', U'\xa65c', idna_status::mapped},
-    {U'\xa65e', U'\xa65e', idna_status::mapped},
-    {U'\xa660', U'\xa660', idna_status::mapped},
-    {U'\xa662', U'\xa662', idna_status::mapped},
-    {U'\xa664', U'\xa664', idna_status::mapped},
-    {U'\xa666', U'\xa666', idna_status::mapped},
-    {U'\xa668', U'\xa668', idna_status::mapped},
-    {U'\xa66a', U'\xa66a', idna_status::mapped},
-    {U'\xa66c', U'\xa66c', idna_status::mapped},
-    {U'\xa680', U'\xa680', idna_status::mapped},
-    {U'\xa682', U'\xa682', idna_status::mapped},
-    {U'\xa684', U'\xa684', idna_status::mapped},
-    {U'\xa686', U'\xa686', idna_status::mapped},
-    {U'\xa688', U'\xa688', idna_status::mapped},
-    {U'\xa68a', U'\xa68a', idna_status::mapped},
-    {U'\xa68c', U'\xa68c', idna_status::mapped},
-    {U'\xa68e', U'\xa68e', idna_status::mapped},
-    {U'\xa690', U'\xa690', idna_status::mapped},
-    {U'\xa692', U'\xa692', idna_status::mapped},
-    {U'\xa694', U'\xa694', idna_status::mapped},
-    {U'\xa696', U'\xa696', idna_status::mapped},
-    {U'\xa698', U'\xa698', idna_status::mapped},
-    {U'\xa69a', U'\xa69a', idna_status::mapped},
-    {U'\xa69c', U'\xa69c', idna_status::mapped},
-    {U'\xa69d', U'\xa69d', idna_status::mapped},
-    {U'\xa6f8', U'\xa6ff', idna_status::disallowed},
-    {U'\xa722', U'\xa722', idna_status::mapped},
-    {U'\xa724', U'\xa724', idna_status::mapped},
-    {U'\xa726', U'\xa726', idna_status::mapped},
-    {U'\xa728', U'\xa728', idna_status::mapped},
-    {U'\xa72a', U'\xa72a', idna_status::mapped},
-    {U'\xa72c', U'\xa72c', idna_status::mapped},
-    {U'\xa72e', U'\xa72e', idna_status::mapped},
-    {U'\xa732', U'\xa732', idna_status::mapped},
-    {U'\xa734', U'\xa734', idna_status::mapped},
-    {U'\xa736', U'\xa736', idna_status::mapped},
-    {U'\xa738', U'\xa738', idna_status::mapped},
-    {U'\xa73a', U'\xa73a', idna_status::mapped},
-    {U'\xa73c', U'\xa73c', idna_status::mapped},
-    {U'\xa73e', U'\xa73e', idna_status::mapped},
-    {U'\xa740', U'\xa740', idna_status::mapped},
-    {U'\xa742', U'\xa742', idna_status::mapped},
-    {U'\xa744', U'\xa744', idna_status::mapped},
-    {U'\xa746', U'\xa746', idna_status::mapped},
-    {U'\xa748', U'\xa748', idna_status::mapped},
-    {U'\xa74a', U'\xa74a', idna_status::mapped},
-    {U'\xa74c', U'\xa74c', idna_status::mapped},
-    {U'\xa74e', U'\xa74e', idna_status::mapped},
-    {U'\xa750', U'\xa750', idna_status::mapped},
-    {U'\xa752', U'\xa752', idna_status::mapped},
-    {U'\xa754', U'\xa754', idna_status::mapped},
-    {U'\xa756', U'\xa756', idna_status::mapped},
-    {U'\xa758', U'\xa758', idna_status::mapped},
-    {U'\xa75a', U'\xa75a', idna_status::mapped},
-    {U'\xa75c', U'\xa75c', idna_status::mapped},
-    {U'\xa75e', U'\xa75e', idna_status::mapped},
-    {U'\xa760', U'\xa760', idna_status::mapped},
-    {U'\xa762', U'\xa762', idna_status::mapped},
-    {U'\xa764', U'\xa764', idna_status::mapped},
-    {U'\xa766', U'\xa766', idna_status::mapped},
-    {U'\xa768', U'\xa768', idna_status::mapped},
-    {U'\xa76a', U'\xa76a', idna_status::mapped},
-    {U'\xa76c', U'\xa76c', idna_status::mapped},
-    {U'\xa76e', U'\xa76e', idna_status::mapped},
-    {U'\xa770', U'\xa770', idna_status::mapped},
-    {U'\xa779', U'\xa779', idna_status::mapped},
-    {U'\xa77b', U'\xa77b', idna_status::mapped},
-    {U'\xa77d', U'\xa77d', idna_status::mapped},
-    {U'\xa77e', U'\xa77e', idna_status::mapped},
-    {U'\xa780', U'\xa780', idna_status::mapped},
-    {U'\xa782', U'\xa782', idna_status::mapped},
-    {U'\xa784', U'\xa784', idna_status::mapped},
-    {U'\xa786', U'\xa786', idna_status::mapped},
-    {U'\xa78b', U'\xa78b', idna_status::mapped},
-    {U'\xa78d', U'\xa78d', idna_status::mapped},
-    {U'\xa790', U'\xa790', idna_status::mapped},
-    {U'\xa792', U'\xa792', idna_status::mapped},
-    {U'\xa796', U'\xa796', idna_status::mapped},
-    {U'\xa798', U'\xa798', idna_status::mapped},
-    {U'\xa79a', U'\xa79a', idna_status::mapped},
-    {U'\xa79c', U'\xa79c', idna_status::mapped},
-    {U'\xa79e', U'\xa79e', idna_status::mapped},
-    {U'\xa7a0', U'\xa7a0', idna_status::mapped},
-    {U'\xa7a2', U'\xa7a2', idna_status::mapped},
-    {U'\xa7a4', U'\xa7a4', idna_status::mapped},
-    {U'\xa7a6', U'\xa7a6', idna_status::mapped},
-    {U'\xa7a8', U'\xa7a8', idna_status::mapped},
-    {U'\xa7aa', U'\xa7aa', idna_status::mapped},
-    {U'\xa7ab', U'\xa7ab', idna_status::mapped},
-    {U'\xa7ac', U'\xa7ac', idna_status::mapped},
-    {U'\xa7ad', U'\xa7ad', idna_status::mapped},
-    {U'\xa7ae', U'\xa7ae', idna_status::mapped},
-    {U'\xa7b0', U'\xa7b0', idna_status::mapped},
-    {U'\xa7b1', U'\xa7b1', idna_status::mapped},
-    {U'\xa7b2', U'\xa7b2', idna_status::mapped},
-    {U'\xa7b3', U'\xa7b3', idna_status::mapped},
-    {U'\xa7b4', U'\xa7b4', idna_status::mapped},
-    {U'\xa7b6', U'\xa7b6', idna_status::mapped},
-    {U'\xa7b8', U'\xa7b8', idna_status::mapped},
-    {U'\xa7ba', U'\xa7ba', idna_status::mapped},
-    {U'\xa7bc', U'\xa7bc', idna_status::mapped},
-    {U'\xa7be', U'\xa7be', idna_status::mapped},
-    {U'\xa7c0', U'\xa7c0', idna_status::mapped},
-    {U'\xa7c2', U'\xa7c2', idna_status::mapped},
-    {U'\xa7c4', U'\xa7c4', idna_status::mapped},
-    {U'\xa7c5', U'\xa7c5', idna_status::mapped},
-    {U'\xa7c6', U'\xa7c6', idna_status::mapped},
-    {U'\xa7c7', U'\xa7c7', idna_status::mapped},
-    {U'\xa7c9', U'\xa7c9', idna_status::mapped},
-    {U'\xa7cb', U'\xa7cf', idna_status::disallowed},
-    {U'\xa7d0', U'\xa7d0', idna_status::mapped},
-    {U'\xa7d2', U'\xa7d2', idna_status::disallowed},
-    {U'\xa7d4', U'\xa7d4', idna_status::disallowed},
-    {U'\xa7d6', U'\xa7d6', idna_status::mapped},
-    {U'\xa7d8', U'\xa7d8', idna_status::mapped},
-    {U'\xa7da', U'\xa7f1', idna_status::disallowed},
-    {U'\xa7f2', U'\xa7f2', idna_status::mapped},
-    {U'\xa7f3', U'\xa7f3', idna_status::mapped},
-    {U'\xa7f4', U'\xa7f4', idna_status::mapped},
-    {U'\xa7f5', U'\xa7f5', idna_status::mapped},
-    {U'\xa7f8', U'\xa7f8', idna_status::mapped},
-    {U'\xa7f9', U'\xa7f9', idna_status::mapped},
-    {U'\xa82d', U'\xa82f', idna_status::disallowed},
-    {U'\xa83a', U'\xa83f', idna_status::disallowed},
-    {U'\xa878', U'\xa87f', idna_status::disallowed},
-    {U'\xa8c6', U'\xa8cd', idna_status::disallowed},
-    {U'\xa8da', U'\xa8df', idna_status::disallowed},
-    {U'\xa954', U'\xa95e', idna_status::disallowed},
-    {U'\xa97d', U'\xa97f', idna_status::disallowed},
-    {U'\xa9ce', U'\xa9ce', idna_status::disallowed},
-    {U'\xa9da', U'\xa9dd', idna_status::disallowed},
-    {U'\xa9ff', U'\xa9ff', idna_status::disallowed},
-    {U'\xaa37', U'\xaa3f', idna_status::disallowed},
-    {U'\xaa4e', U'\xaa4f', idna_status::disallowed},
-    {U'\xaa5a', U'\xaa5b', idna_status::disallowed},
-    {U'\xaac3', U'\xaada', idna_status::disallowed},
-    {U'\xaaf7', U'\xab00', idna_status::disallowed},
-    {U'\xab07', U'\xab08', idna_status::disallowed},
-    {U'\xab0f', U'\xab10', idna_status::disallowed},
-    {U'\xab17', U'\xab1f', idna_status::disallowed},
-    {U'\xab27', U'\xab27', idna_status::disallowed},
-    {U'\xab2f', U'\xab2f', idna_status::disallowed},
-    {U'\xab5c', U'\xab5c', idna_status::mapped},
-    {U'\xab5d', U'\xab5d', idna_status::mapped},
-    {U'\xab5e', U'\xab5e', idna_status::mapped},
-    {U'\xab5f', U'\xab5f', idna_status::mapped},
-    {U'\xab69', U'\xab69', idna_status::mapped},
-    {U'\xab6c', U'\xab6f', idna_status::disallowed},
-    {U'\xab70', U'\xab70', idna_status::mapped},
-    {U'\xab71', U'\xab71', idna_status::mapped},
-    {U'\xab72', U'\xab72', idna_status::mapped},
-    {U'\xab73', U'\xab73', idna_status::mapped},
-    {U'\xab74', U'\xab74', idna_status::mapped},
-    {U'\xab75', U'\xab75', idna_status::mapped},
-    {U'\xab76', U'\xab76', idna_status::mapped},
-    {U'\xab77', U'\xab77', idna_status::mapped},
-    {U'\xab78', U'\xab78', idna_status::mapped},
-    {U'\xab79', U'\xab79', idna_status::mapped},
-    {U'\xab7a', U'\xab7a', idna_status::mapped},
-    {U'\xab7b', U'\xab7b', idna_status::mapped},
-    {U'\xab7c', U'\xab7c', idna_status::mapped},
-    {U'\xab7d', U'\xab7d', idna_status::mapped},
-    {U'\xab7e', U'\xab7e', idna_status::mapped},
-    {U'\xab7f', U'\xab7f', idna_status::mapped},
-    {U'\xab80', U'\xab80', idna_status::mapped},
-    {U'\xab81', U'\xab81', idna_status::mapped},
-    {U'\xab82', U'\xab82', idna_status::mapped},
-    {U'\xab83', U'\xab83', idna_status::mapped},
-    {U'\xab84', U'\xab84', idna_status::mapped},
-    {U'\xab85', U'\xab85', idna_status::mapped},
-    {U'\xab86', U'\xab86', idna_status::mapped},
-    {U'\xab87', U'\xab87', idna_status::mapped},
-    {U'\xab88', U'\xab88', idna_status::mapped},
-    {U'\xab89', U'\xab89', idna_status::mapped},
-    {U'\xab8a', U'\xab8a', idna_status::mapped},
-    {U'\xab8b', U'\xab8b', idna_status::mapped},
-    {U'\xab8c', U'\xab8c', idna_status::mapped},
-    {U'\xab8d', U'\xab8d', idna_status::mapped},
-    {U'\xab8e', U'\xab8e', idna_status::mapped},
-    {U'\xab8f', U'\xab8f', idna_status::mapped},
-    {U'\xab90', U'\xab90', idna_status::mapped},
-    {U'\xab91', U'\xab91', idna_status::mapped},
-    {U'\xab92', U'\xab92', idna_status::mapped},
-    {U'\xab93', U'\xab93', idna_status::mapped},
-    {U'\xab94', U'\xab94', idna_status::mapped},
-    {U'\xab95', U'\xab95', idna_status::mapped},
-    {U'\xab96', U'\xab96', idna_status::mapped},
-    {U'\xab97', U'\xab97', idna_status::mapped},
-    {U'\xab98', U'\xab98', idna_status::mapped},
-    {U'\xab99', U'\xab99', idna_status::mapped},
-    {U'\xab9a', U'\xab9a', idna_status::mapped},
-    {U'\xab9b', U'\xab9b', idna_status::mapped},
-    {U'\xab9c', U'\xab9c', idna_status::mapped},
-    {U'\xab9d', U'\xab9d', idna_status::mapped},
-    {U'\xab9e', U'\xab9e', idna_status::mapped},
-    {U'\xab9f', U'\xab9f', idna_status::mapped},
-    {U'\xaba0', U'\xaba0', idna_status::mapped},
-    {U'\xaba1', U'\xaba1', idna_status::mapped},
-    {U'\xaba2', U'\xaba2', idna_status::mapped},
-    {U'\xaba3', U'\xaba3', idna_status::mapped},
-    {U'\xaba4', U'\xaba4', idna_status::mapped},
-    {U'\xaba5', U'\xaba5', idna_status::mapped},
-    {U'\xaba6', U'\xaba6', idna_status::mapped},
-    {U'\xaba7', U'\xaba7', idna_status::mapped},
-    {U'\xaba8', U'\xaba8', idna_status::mapped},
-    {U'\xaba9', U'\xaba9', idna_status::mapped},
-    {U'\xabaa', U'\xabaa', idna_status::mapped},
-    {U'\xabab', U'\xabab', idna_status::mapped},
-    {U'\xabac', U'\xabac', idna_status::mapped},
-    {U'\xabad', U'\xabad', idna_status::mapped},
-    {U'\xabae', U'\xabae', idna_status::mapped},
-    {U'\xabaf', U'\xabaf', idna_status::mapped},
-    {U'\xabb0', U'\xabb0', idna_status::mapped},
-    {U'\xabb1', U'\xabb1', idna_status::mapped},
-    {U'\xabb2', U'\xabb2', idna_status::mapped},
-    {U'\xabb3', U'\xabb3', idna_status::mapped},
-    {U'\xabb4', U'\xabb4', idna_status::mapped},
-    {U'\xabb5', U'\xabb5', idna_status::mapped},
-    {U'\xabb6', U'\xabb6', idna_status::mapped},
-    {U'\xabb7', U'\xabb7', idna_status::mapped},
-    {U'\xabb8', U'\xabb8', idna_status::mapped},
-    {U'\xabb9', U'\xabb9', idna_status::mapped},
-    {U'\xabba', U'\xabba', idna_status::mapped},
-    {U'\xabbb', U'\xabbb', idna_status::mapped},
-    {U'\xabbc', U'\xabbc', idna_status::mapped},
-    {U'\xabbd', U'\xabbd', idna_status::mapped},
-    {U'\xabbe', U'\xabbe', idna_status::mapped},
-    {U'\xabbf', U'\xabbf', idna_status::mapped},
-    {U'\xabee', U'\xabef', idna_status::disallowed},
-    {U'\xabfa', U'\xabff', idna_status::disallowed},
-    {U'\xd7a4', U'\xd7af', idna_status::disallowed},
-    {U'\xd7c7', U'\xd7ca', idna_status::disallowed},
-    {U'\xd7fc', U'\xd7ff', idna_status::disallowed},
-    {U'\xd800', U'\xdfff', idna_status::disallowed},
-    {U'\xe000', U'\xf8ff', idna_status::disallowed},
-    {U'\xf900', U'\xf900', idna_status::mapped},
-    {U'\xf901', U'\xf901', idna_status::mapped},
-    {U'\xf902', U'\xf902', idna_status::mapped},
-    {U'\xf903', U'\xf903', idna_status::mapped},
-    {U'\xf904', U'\xf904', idna_status::mapped},
-    {U'\xf905', U'\xf905', idna_status::mapped},
-    {U'\xf906', U'\xf906', idna_status::mapped},
-    {U'\xf907', U'\xf908', idna_status::mapped},
-    {U'\xf909', U'\xf909', idna_status::mapped},
-    {U'\xf90a', U'\xf90a', idna_status::mapped},
-    {U'\xf90b', U'\xf90b', idna_status::mapped},
-    {U'\xf90c', U'\xf90c', idna_status::mapped},
-    {U'\xf90d', U'\xf90d', idna_status::mapped},
-    {U'\xf90e', U'\xf90e', idna_status::mapped},
-    {U'\xf90f', U'\xf90f', idna_status::mapped},
-    {U'\xf910', U'\xf910', idna_status::mapped},
-    {U'\xf911', U'\xf911', idna_status::mapped},
-    {U'\xf912', U'\xf912', idna_status::mapped},
-    {U'\xf913', U'\xf913', idna_status::mapped},
-    {U'\xf914', U'\xf914', idna_status::mapped},
-    {U'\xf915', U'\xf915', idna_status::mapped},
-    {U'\xf916', U'\xf916', idna_status::mapped},
-    {U'\xf917', U'\xf917', idna_status::mapped},
-    {U'\xf918', U'\xf918', idna_status::mapped},
-    {U'\xf919', U'\xf919', idna_status::mapped},
-    {U'\xf91a', U'\xf91a', idna_status::mapped},
-    {U'\xf91b', U'\xf91b', idna_status::mapped},
-    {U'\xf91c', U'\xf91c', idna_status::mapped},
-    {U'\xf91d', U'\xf91d', idna_status::mapped},
-    {U'\xf91e', U'\xf91e', idna_status::mapped},
-    {U'\xf91f', U'\xf91f', idna_status::mapped},
-    {U'\xf920', U'\xf920', idna_status::mapped},
-    {U'\xf921', U'\xf921', idna_status::mapped},
-    {U'\xf922', U'\xf922', idna_status::mapped},
-    {U'\xf923', U'\xf923', idna_status::mapped},
-    {U'\xf924', U'\xf924', idna_status::mapped},
-    {U'\xf925', U'\xf925', idna_status::mapped},
-    {U'\xf926', U'\xf926', idna_status::mapped},
-    {U'\xf927', U'\xf927', idna_status::mapped},
-    {U'\xf928', U'\xf928', idna_status::mapped},
-    {U'\xf929', U'\xf929', idna_status::mapped},
-    {U'\xf92a', U'\xf92a', idna_status::mapped},
-    {U'\xf92b', U'\xf92b', idna_status::mapped},
-    {U'\xf92c', U'\xf92c', idna_status::mapped},
-    {U'\xf92d', U'\xf92d', idna_status::mapped},
-    {U'\xf92e', U'\xf92e', idna_status::mapped},
-    {U'\xf92f', U'\xf92f', idna_status::mapped},
-    {U'\xf930', U'\xf930', idna_status::mapped},
-    {U'\xf931', U'\xf931', idna_status::mapped},
-    {U'\xf932', U'\xf932', idna_status::mapped},
-    {U'\xf933', U'\xf933', idna_status::mapped},
-    {U'\xf934', U'\xf934', idna_status::mapped},
-    {U'\xf935', U'\xf935', idna_status::mapped},
-    {U'\xf936', U'\xf936', idna_status::mapped},
-    {U'\xf937', U'\xf937', idna_status::mapped},
-    {U'\xf938', U'\xf938', idna_status::mapped},
-    {U'\xf939', U'\xf939', idna_status::mapped},
-    {U'\xf93a', U'\xf93a', idna_status::mapped},
-    {U'\xf93b', U'\xf93b', idna_status::mapped},
-    {U'\xf93c', U'\xf93c', idna_status::mapped},
-    {U'\xf93d', U'\xf93d', idna_status::mapped},
-    {U'\xf93e', U'\xf93e', idna_status::mapped},
-    {U'\xf93f', U'\xf93f', idna_status::mapped},
-    {U'\xf940', U'\xf940', idna_status::mapped},
-    {U'\xf941', U'\xf941', idna_status::mapped},
-    {U'\xf942', U'\xf942', idna_status::mapped},
-    {U'\xf943', U'\xf943', idna_status::mapped},
-    {U'\xf944', U'\xf944', idna_status::mapped},
-    {U'\xf945', U'\xf945', idna_status::mapped},
-    {U'\xf946', U'\xf946', idna_status::mapped},
-    {U'\xf947', U'\xf947', idna_status::mapped},
-    {U'\xf948', U'\xf948', idna_status::mapped},
-    {U'\xf949', U'\xf949', idna_status::mapped},
-    {U'\xf94a', U'\xf94a', idna_status::mapped},
-    {U'\xf94b', U'\xf94b', idna_status::mapped},
-    {U'\xf94c', U'\xf94c', idna_status::mapped},
-    {U'\xf94d', U'\xf94d', idna_status::mapped},
-    {U'\xf94e', U'\xf94e', idna_status::mapped},
-    {U'\xf94f', U'\xf94f', idna_status::mapped},
-    {U'\xf950', U'\xf950', idna_status::mapped},
-    {U'\xf951', U'\xf951', idna_status::mapped},
-    {U'\xf952', U'\xf952', idna_status::mapped},
-    {U'\xf953', U'\xf953', idna_status::mapped},
-    {U'\xf954', U'\xf954', idna_status::mapped},
-    {U'\xf955', U'\xf955', idna_status::mapped},
-    {U'\xf956', U'\xf956', idna_status::mapped},
-    {U'\xf957', U'\xf957', idna_status::mapped},
-    {U'\xf958', U'\xf958', idna_status::mapped},
-    {U'\xf959', U'\xf959', idna_status::mapped},
-    {U'\xf95a', U'\xf95a', idna_status::mapped},
-    {U'\xf95b', U'\xf95b', idna_status::mapped},
-    {U'\xf95c', U'\xf95c', idna_status::mapped},
-    {U'\xf95d', U'\xf95d', idna_status::mapped},
-    {U'\xf95e', U'\xf95e', idna_status::mapped},
-    {U'\xf95f', U'\xf95f', idna_status::mapped},
-    {U'\xf960', U'\xf960', idna_status::mapped},
-    {U'\xf961', U'\xf961', idna_status::mapped},
-    {U'\xf962', U'\xf962', idna_status::mapped},
-    {U'\xf963', U'\xf963', idna_status::mapped},
-    {U'\xf964', U'\xf964', idna_status::mapped},
-    {U'\xf965', U'\xf965', idna_status::mapped},
-    {U'\xf966', U'\xf966', idna_status::mapped},
-    {U'\xf967', U'\xf967', idna_status::mapped},
-    {U'\xf968', U'\xf968', idna_status::mapped},
-    {U'\xf969', U'\xf969', idna_status::mapped},
-    {U'\xf96a', U'\xf96a', idna_status::mapped},
-    {U'\xf96b', U'\xf96b', idna_status::mapped},
-    {U'\xf96c', U'\xf96c', idna_status::mapped},
-    {U'\xf96d', U'\xf96d', idna_status::mapped},
-    {U'\xf96e', U'\xf96e', idna_status::mapped},
-    {U'\xf96f', U'\xf96f', idna_status::mapped},
-    {U'\xf970', U'\xf970', idna_status::mapped},
-    {U'\xf971', U'\xf971', idna_status::mapped},
-    {U'\xf972', U'\xf972', idna_status::mapped},
-    {U'\xf973', U'\xf973', idna_status::mapped},
-    {U'\xf974', U'\xf974', idna_status::mapped},
-    {U'\xf975', U'\xf975', idna_status::mapped},
-    {U'\xf976', U'\xf976', idna_status::mapped},
-    {U'\xf977', U'\xf977', idna_status::mapped},
-    {U'\xf978', U'\xf978', idna_status::mapped},
-    {U'\xf979', U'\xf979', idna_status::mapped},
-    {U'\xf97a', U'\xf97a', idna_status::mapped},
-    {U'\xf97b', U'\xf97b', idna_status::mapped},
-    {U'\xf97c', U'\xf97c', idna_status::mapped},
-    {U'\xf97d', U'\xf97d', idna_status::mapped},
-    {U'\xf97e', U'\xf97e', idna_status::mapped},
-    {U'\xf97f', U'\xf97f', idna_status::mapped},
-    {U'\xf980', U'\xf980', idna_status::mapped},
-    {U'\xf981', U'\xf981', idna_status::mapped},
-    {U'\xf982', U'\xf982', idna_status::mapped},
-    {U'\xf983', U'\xf983', idna_status::mapped},
-    {U'\xf984', U'\xf984', idna_status::mapped},
-    {U'\xf985', U'\xf985', idna_status::mapped},
-    {U'\xf986', U'\xf986', idna_status::mapped},
-    {U'\xf987', U'\xf987', idna_status::mapped},
-    {U'\xf988', U'\xf988', idna_status::mapped},
-    {U'\xf989', U'\xf989', idna_status::mapped},
-    {U'\xf98a', U'\xf98a', idna_status::mapped},
-    {U'\xf98b', U'\xf98b', idna_status::mapped},
-    {U'\xf98c', U'\xf98c', idna_status::mapped},
-    {U'\xf98d', U'\xf98d', idna_status::mapped},
-    {U'\xf98e', U'\xf98e', idna_status::mapped},
-    {U'\xf98f', U'\xf98f', idna_status::mapped},
-    {U'\xf990', U'\xf990', idna_status::mapped},
-    {U'\xf991', U'\xf991', idna_status::mapped},
-    {U'\xf992', U'\xf992', idna_status::mapped},
-    {U'\xf993', U'\xf993', idna_status::mapped},
-    {U'\xf994', U'\xf994', idna_status::mapped},
-    {U'\xf995', U'\xf995', idna_status::mapped},
-    {U'\xf996', U'\xf996', idna_status::mapped},
-    {U'\xf997', U'\xf997', idna_status::mapped},
-    {U'\xf998', U'\xf998', idna_status::mapped},
-    {U'\xf999', U'\xf999', idna_status::mapped},
-    {U'\xf99a', U'\xf99a', idna_status::mapped},
-    {U'\xf99b', U'\xf99b', idna_status::mapped},
-    {U'\xf99c', U'\xf99c', idna_status::mapped},
-    {U'\xf99d', U'\xf99d', idna_status::mapped},
-    {U'\xf99e', U'\xf99e', idna_status::mapped},
-    {U'\xf99f', U'\xf99f', idna_status::mapped},
-    {U'\xf9a0', U'\xf9a0', idna_status::mapped},
-    {U'\xf9a1', U'\xf9a1', idna_status::mapped},
-    {U'\xf9a2', U'\xf9a2', idna_status::mapped},
-    {U'\xf9a3', U'\xf9a3', idna_status::mapped},
-    {U'\xf9a4', U'\xf9a4', idna_status::mapped},
-    {U'\xf9a5', U'\xf9a5', idna_status::mapped},
-    {U'\xf9a6', U'\xf9a6', idna_status::mapped},
-    {U'\xf9a7', U'\xf9a7', idna_status::mapped},
-    {U'\xf9a8', U'\xf9a8', idna_status::mapped},
-    {U'\xf9a9', U'\xf9a9', idna_status::mapped},
-    {U'\xf9aa', U'\xf9aa', idna_status::mapped},
-    {U'\xf9ab', U'\xf9ab', idna_status::mapped},
-    {U'\xf9ac', U'\xf9ac', idna_status::mapped},
-    {U'\xf9ad', U'\xf9ad', idna_status::mapped},
-    {U'\xf9ae', U'\xf9ae', idna_status::mapped},
-    {U'\xf9af', U'\xf9af', idna_status::mapped},
-    {U'\xf9b0', U'\xf9b0', idna_status::mapped},
-    {U'\xf9b1', U'\xf9b1', idna_status::mapped},
-    {U'\xf9b2', U'\xf9b2', idna_status::mapped},
-    {U'\xf9b3', U'\xf9b3', idna_status::mapped},
-    {U'\xf9b4', U'\xf9b4', idna_status::mapped},
-    {U'\xf9b5', U'\xf9b5', idna_status::mapped},
-    {U'\xf9b6', U'\xf9b6', idna_status::mapped},
-    {U'\xf9b7', U'\xf9b7', idna_status::mapped},
-    {U'\xf9b8', U'\xf9b8', idna_status::mapped},
-    {U'\xf9b9', U'\xf9b9', idna_status::mapped},
-    {U'\xf9ba', U'\xf9ba', idna_status::mapped},
-    {U'\xf9bb', U'\xf9bb', idna_status::mapped},
-    {U'\xf9bc', U'\xf9bc', idna_status::mapped},
-    {U'\xf9bd', U'\xf9bd', idna_status::mapped},
-    {U'\xf9be', U'\xf9be', idna_status::mapped},
-    {U'\xf9bf', U'\xf9bf', idna_status::mapped},
-    {U'\xf9c0', U'\xf9c0', idna_status::mapped},
-    {U'\xf9c1', U'\xf9c1', idna_status::mapped},
-    {U'\xf9c2', U'\xf9c2', idna_status::mapped},
-    {U'\xf9c3', U'\xf9c3', idna_status::mapped},
-    {U'\xf9c4', U'\xf9c4', idna_status::mapped},
-    {U'\xf9c5', U'\xf9c5', idna_status::mapped},
-    {U'\xf9c6', U'\xf9c6', idna_status::mapped},
-    {U'\xf9c7', U'\xf9c7', idna_status::mapped},
-    {U'\xf9c8', U'\xf9c8', idna_status::mapped},
-    {U'\xf9c9', U'\xf9c9', idna_status::mapped},
-    {U'\xf9ca', U'\xf9ca', idna_status::mapped},
-    {U'\xf9cb', U'\xf9cb', idna_status::mapped},
-    {U'\xf9cc', U'\xf9cc', idna_status::mapped},
-    {U'\xf9cd', U'\xf9cd', idna_status::mapped},
-    {U'\xf9ce', U'\xf9ce', idna_status::mapped},
-    {U'\xf9cf', U'\xf9cf', idna_status::mapped},
-    {U'\xf9d0', U'\xf9d0', idna_status::mapped},
-    {U'\xf9d1', U'\xf9d1', idna_status::mapped},
-    {U'\xf9d2', U'\xf9d2', idna_status::mapped},
-    {U'\xf9d3', U'\xf9d3', idna_status::mapped},
-    {U'\xf9d4', U'\xf9d4', idna_status::mapped},
-    {U'\xf9d5', U'\xf9d5', idna_status::mapped},
-    {U'\xf9d6', U'\xf9d6', idna_status::mapped},
-    {U'\xf9d7', U'\xf9d7', idna_status::mapped},
-    {U'\xf9d8', U'\xf9d8', idna_status::mapped},
-    {U'\xf9d9', U'\xf9d9', idna_status::mapped},
-    {U'\xf9da', U'\xf9da', idna_status::mapped},
-    {U'\xf9db', U'\xf9db', idna_status::mapped},
-    {U'\xf9dc', U'\xf9dc', idna_status::mapped},
-    {U'\xf9dd', U'\xf9dd', idna_status::mapped},
-    {U'\xf9de', U'\xf9de', idna_status::mapped},
-    {U'\xf9df', U'\xf9df', idna_status::mapped},
-    {U'\xf9e0', U'\xf9e0', idna_status::mapped},
-    {U'\xf9e1', U'\xf9e1', idna_status::mapped},
-    {U'\xf9e2', U'\xf9e2', idna_status::mapped},
-    {U'\xf9e3', U'\xf9e3', idna_status::mapped},
-    {U'\xf9e4', U'\xf9e4', idna_status::mapped},
-    {U'\xf9e5', U'\xf9e5', idna_status::mapped},
-    {U'\xf9e6', U'\xf9e6', idna_status::mapped},
-    {U'\xf9e7', U'\xf9e7', idna_status::mapped},
-    {U'\xf9e8', U'\xf9e8', idna_status::mapped},
-    {U'\xf9e9', U'\xf9e9', idna_status::mapped},
-    {U'\xf9ea', U'\xf9ea', idna_status::mapped},
-    {U'\xf9eb', U'\xf9eb', idna_status::mapped},
-    {U'\xf9ec', U'\xf9ec', idna_status::mapped},
-    {U'\xf9ed', U'\xf9ed', idna_status::mapped},
-    {U'\xf9ee', U'\xf9ee', idna_status::mapped},
-    {U'\xf9ef', U'\xf9ef', idna_status::mapped},
-    {U'\xf9f0', U'\xf9f0', idna_status::mapped},
-    {U'\xf9f1', U'\xf9f1', idna_status::mapped},
-    {U'\xf9f2', U'\xf9f2', idna_status::mapped},
-    {U'\xf9f3', U'\xf9f3', idna_status::mapped},
-    {U'\xf9f4', U'\xf9f4', idna_status::mapped},
-    {U'\xf9f5', U'\xf9f5', idna_status::mapped},
-    {U'\xf9f6', U'\xf9f6', idna_status::mapped},
-    {U'\xf9f7', U'\xf9f7', idna_status::mapped},
-    {U'\xf9f8', U'\xf9f8', idna_status::mapped},
-    {U'\xf9f9', U'\xf9f9', idna_status::mapped},
-    {U'\xf9fa', U'\xf9fa', idna_status::mapped},
-    {U'\xf9fb', U'\xf9fb', idna_status::mapped},
-    {U'\xf9fc', U'\xf9fc', idna_status::mapped},
-    {U'\xf9fd', U'\xf9fd', idna_status::mapped},
-    {U'\xf9fe', U'\xf9fe', idna_status::mapped},
-    {U'\xf9ff', U'\xf9ff', idna_status::mapped},
-    {U'\xfa00', U'\xfa00', idna_status::mapped},
-    {U'\xfa01', U'\xfa01', idna_status::mapped},
-    {U'\xfa02', U'\xfa02', idna_status::mapped},
-    {U'\xfa03', U'\xfa03', idna_status::mapped},
-    {U'\xfa04', U'\xfa04', idna_status::mapped},
-    {U'\xfa05', U'\xfa05', idna_status::mapped},
-    {U'\xfa06', U'\xfa06', idna_status::mapped},
-    {U'\xfa07', U'\xfa07', idna_status::mapped},
-    {U'\xfa08', U'\xfa08', idna_status::mapped},
-    {U'\xfa09', U'\xfa09', idna_status::mapped},
-    {U'\xfa0a', U'\xfa0a', idna_status::mapped},
-    {U'\xfa0b', U'\xfa0b', idna_status::mapped},
-    {U'\xfa0c', U'\xfa0c', idna_status::mapped},
-    {U'\xfa0d', U'\xfa0d', idna_status::mapped},
-    {U'\xfa10', U'\xfa10', idna_status::mapped},
-    {U'\xfa12', U'\xfa12', idna_status::mapped},
-    {U'\xfa15', U'\xfa15', idna_status::mapped},
-    {U'\xfa16', U'\xfa16', idna_status::mapped},
-    {U'\xfa17', U'\xfa17', idna_status::mapped},
-    {U'\xfa18', U'\xfa18', idna_status::mapped},
-    {U'\xfa19', U'\xfa19', idna_status::mapped},
-    {U'\xfa1a', U'\xfa1a', idna_status::mapped},
-    {U'\xfa1b', U'\xfa1b', idna_status::mapped},
-    {U'\xfa1c', U'\xfa1c', idna_status::mapped},
-    {U'\xfa1d', U'\xfa1d', idna_status::mapped},
-    {U'\xfa1e', U'\xfa1e', idna_status::mapped},
-    {U'\xfa20', U'\xfa20', idna_status::mapped},
-    {U'\xfa22', U'\xfa22', idna_status::mapped},
-    {U'\xfa25', U'\xfa25', idna_status::mapped},
-    {U'\xfa26', U'\xfa26', idna_status::mapped},
-    {U'\xfa2a', U'\xfa2a', idna_status::mapped},
-    {U'\xfa2b', U'\xfa2b', idna_status::mapped},
-    {U'\xfa2c', U'\xfa2c', idna_status::mapped},
-    {U'\xfa2d', U'\xfa2d', idna_status::mapped},
-    {U'\xfa2e', U'\xfa2e', idna_status::mapped},
-    {U'\xfa2f', U'\xfa2f', idna_status::mapped},
-    {U'\xfa30', U'\xfa30', idna_status::mapped},
-    {U'\xfa31', U'\xfa31', idna_status::mapped},
-    {U'\xfa32', U'\xfa32', idna_status::mapped},
-    {U'\xfa33', U'\xfa33', idna_status::mapped},
-    {U'\xfa34', U'\xfa34', idna_status::mapped},
-    {U'\xfa35', U'\xfa35', idna_status::mapped},
-    {U'\xfa36', U'\xfa36', idna_status::mapped},
-    {U'\xfa37', U'\xfa37', idna_status::mapped},
-    {U'\xfa38', U'\xfa38', idna_status::mapped},
-    {U'\xfa39', U'\xfa39', idna_status::mapped},
-    {U'\xfa3a', U'\xfa3a', idna_status::mapped},
-    {U'\xfa3b', U'\xfa3b', idna_status::mapped},
-    {U'\xfa3c', U'\xfa3c', idna_status::mapped},
-    {U'\xfa3d', U'\xfa3d', idna_status::mapped},
-    {U'\xfa3e', U'\xfa3e', idna_status::mapped},
-    {U'\xfa3f', U'\xfa3f', idna_status::mapped},
-    {U'\xfa40', U'\xfa40', idna_status::mapped},
-    {U'\xfa41', U'\xfa41', idna_status::mapped},
-    {U'\xfa42', U'\xfa42', idna_status::mapped},
-    {U'\xfa43', U'\xfa43', idna_status::mapped},
-    {U'\xfa44', U'\xfa44', idna_status::mapped},
-    {U'\xfa45', U'\xfa45', idna_status::mapped},
-    {U'\xfa46', U'\xfa46', idna_status::mapped},
-    {U'\xfa47', U'\xfa47', idna_status::mapped},
-    {U'\xfa48', U'\xfa48', idna_status::mapped},
-    {U'\xfa49', U'\xfa49', idna_status::mapped},
-    {U'\xfa4a', U'\xfa4a', idna_status::mapped},
-    {U'\xfa4b', U'\xfa4b', idna_status::mapped},
-    {U'\xfa4c', U'\xfa4c', idna_status::mapped},
-    {U'\xfa4d', U'\xfa4d', idna_status::mapped},
-    {U'\xfa4e', U'\xfa4e', idna_status::mapped},
-    {U'\xfa4f', U'\xfa4f', idna_status::mapped},
-    {U'\xfa50', U'\xfa50', idna_status::mapped},
-    {U'\xfa51', U'\xfa51', idna_status::mapped},
-    {U'\xfa52', U'\xfa52', idna_status::mapped},
-    {U'\xfa53', U'\xfa53', idna_status::mapped},
-    {U'\xfa54', U'\xfa54', idna_status::mapped},
-    {U'\xfa55', U'\xfa55', idna_status::mapped},
-    {U'\xfa56', U'\xfa56', idna_status::mapped},
-    {U'\xfa57', U'\xfa57', idna_status::mapped},
-    {U'\xfa58', U'\xfa58', idna_status::mapped},
-    {U'\xfa59', U'\xfa59', idna_status::mapped},
-    {U'\xfa5a', U'\xfa5a', idna_status::mapped},
-    {U'\xfa5b', U'\xfa5b', idna_status::mapped},
-    {U'\xfa5c', U'\xfa5c', idna_status::mapped},
-    {U'\xfa5d', U'\xfa5e', idna_status::mapped},
-    {U'\xfa5f', U'\xfa5f', idna_status::mapped},
-    {U'\xfa60', U'\xfa60', idna_status::mapped},
-    {U'\xfa61', U'\xfa61', idna_status::mapped},
-    {U'\xfa62', U'\xfa62', idna_status::mapped},
-    {U'\xfa63', U'\xfa63', idna_status::mapped},
-    {U'\xfa64', U'\xfa64', idna_status::mapped},
-    {U'\xfa65', U'\xfa65', idna_status::mapped},
-    {U'\xfa66', U'\xfa66', idna_status::mapped},
-    {U'\xfa67', U'\xfa67', idna_status::mapped},
-    {U'\xfa68', U'\xfa68', idna_status::mapped},
-    {U'\xfa69', U'\xfa69', idna_status::mapped},
-    {U'\xfa6a', U'\xfa6a', idna_status::mapped},
-    {U'\xfa6b', U'\xfa6b', idna_status::mapped},
-    {U'\xfa6c', U'\xfa6c', idna_status::mapped},
-    {U'\xfa6d', U'\xfa6d', idna_status::mapped},
-    {U'\xfa6e', U'\xfa6f', idna_status::disallowed},
-    {U'\xfa70', U'\xfa70', idna_status::mapped},
-    {U'\xfa71', U'\xfa71', idna_status::mapped},
-    {U'\xfa72', U'\xfa72', idna_status::mapped},
-    {U'\xfa73', U'\xfa73', idna_status::mapped},
-    {U'\xfa74', U'\xfa74', idna_status::mapped},
-    {U'\xfa75', U'\xfa75', idna_status::mapped},
-    {U'\xfa76', U'\xfa76', idna_status::mapped},
-    {U'\xfa77', U'\xfa77', idna_status::mapped},
-    {U'\xfa78', U'\xfa78', idna_status::mapped},
-    {U'\xfa79', U'\xfa79', idna_status::mapped},
-    {U'\xfa7a', U'\xfa7a', idna_status::mapped},
-    {U'\xfa7b', U'\xfa7b', idna_status::mapped},
-    {U'\xfa7c', U'\xfa7c', idna_status::mapped},
-    {U'\xfa7d', U'\xfa7d', idna_status::mapped},
-    {U'\xfa7e', U'\xfa7e', idna_status::mapped},
-    {U'\xfa7f', U'\xfa7f', idna_status::mapped},
-    {U'\xfa80', U'\xfa80', idna_status::mapped},
-    {U'\xfa81', U'\xfa81', idna_status::mapped},
-    {U'\xfa82', U'\xfa82', idna_status::mapped},
-    {U'\xfa83', U'\xfa83', idna_status::mapped},
-    {U'\xfa84', U'\xfa84', idna_status::mapped},
-    {U'\xfa85', U'\xfa85', idna_status::mapped},
-    {U'\xfa86', U'\xfa86', idna_status::mapped},
-    {U'\xfa87', U'\xfa87', idna_status::mapped},
-    {U'\xfa88', U'\xfa88', idna_status::mapped},
-    {U'\xfa89', U'\xfa89', idna_status::mapped},
-    {U'\xfa8a', U'\xfa8a', idna_status::mapped},
-    {U'\xfa8b', U'\xfa8b', idna_status::mapped},
-    {U'\xfa8c', U'\xfa8c', idna_status::mapped},
-    {U'\xfa8d', U'\xfa8d', idna_status::mapped},
-    {U'\xfa8e', U'\xfa8e', idna_status::mapped},
-    {U'\xfa8f', U'\xfa8f', idna_status::mapped},
-    {U'\xfa90', U'\xfa90', idna_status::mapped},
-    {U'\xfa91', U'\xfa91', idna_status::mapped},
-    {U'\xfa92', U'\xfa92', idna_status::mapped},
-    {U'\xfa93', U'\xfa93', idna_status::mapped},
-    {U'\xfa94', U'\xfa94', idna_status::mapped},
-    {U'\xfa95', U'\xfa95', idna_status::mapped},
-    {U'\xfa96', U'\xfa96', idna_status::mapped},
-    {U'\xfa97', U'\xfa97', idna_status::mapped},
-    {U'\xfa98', U'\xfa98', idna_status::mapped},
-    {U'\xfa99', U'\xfa99', idna_status::mapped},
-    {U'\xfa9a', U'\xfa9a', idna_status::mapped},
-    {U'\xfa9b', U'\xfa9b', idna_status::mapped},
-    {U'\xfa9c', U'\xfa9c', idna_status::mapped},
-    {U'\xfa9d', U'\xfa9d', idna_status::mapped},
-    {U'\xfa9e', U'\xfa9e', idna_status::mapped},
-    {U'\xfa9f', U'\xfa9f', idna_status::mapped},
-    {U'\xfaa0', U'\xfaa0', idna_status::mapped},
-    {U'\xfaa1', U'\xfaa1', idna_status::mapped},
-    {U'\xfaa2', U'\xfaa2', idna_status::mapped},
-    {U'\xfaa3', U'\xfaa3', idna_status::mapped},
-    {U'\xfaa4', U'\xfaa4', idna_status::mapped},
-    {U'\xfaa5', U'\xfaa5', idna_status::mapped},
-    {U'\xfaa6', U'\xfaa6', idna_status::mapped},
-    {U'\xfaa7', U'\xfaa7', idna_status::mapped},
-    {U'\xfaa8', U'\xfaa8', idna_status::mapped},
-    {U'\xfaa9', U'\xfaa9', idna_status::mapped},
-    {U'\xfaaa', U'\xfaaa', idna_status::mapped},
-    {U'\xfaab', U'\xfaab', idna_status::mapped},
-    {U'\xfaac', U'\xfaac', idna_status::mapped},
-    {U'\xfaad', U'\xfaad', idna_status::mapped},
-    {U'\xfaae', U'\xfaae', idna_status::mapped},
-    {U'\xfaaf', U'\xfaaf', idna_status::mapped},
-    {U'\xfab0', U'\xfab0', idna_status::mapped},
-    {U'\xfab1', U'\xfab1', idna_status::mapped},
-    {U'\xfab2', U'\xfab2', idna_status::mapped},
-    {U'\xfab3', U'\xfab3', idna_status::mapped},
-    {U'\xfab4', U'\xfab4', idna_status::mapped},
-    {U'\xfab5', U'\xfab5', idna_status::mapped},
-    {U'\xfab6', U'\xfab6', idna_status::mapped},
-    {U'\xfab7', U'\xfab7', idna_status::mapped},
-    {U'\xfab8', U'\xfab8', idna_status::mapped},
-    {U'\xfab9', U'\xfab9', idna_status::mapped},
-    {U'\xfaba', U'\xfaba', idna_status::mapped},
-    {U'\xfabb', U'\xfabb', idna_status::mapped},
-    {U'\xfabc', U'\xfabc', idna_status::mapped},
-    {U'\xfabd', U'\xfabd', idna_status::mapped},
-    {U'\xfabe', U'\xfabe', idna_status::mapped},
-    {U'\xfabf', U'\xfabf', idna_status::mapped},
-    {U'\xfac0', U'\xfac0', idna_status::mapped},
-    {U'\xfac1', U'\xfac1', idna_status::mapped},
-    {U'\xfac2', U'\xfac2', idna_status::mapped},
-    {U'\xfac3', U'\xfac3', idna_status::mapped},
-    {U'\xfac4', U'\xfac4', idna_status::mapped},
-    {U'\xfac5', U'\xfac5', idna_status::mapped},
-    {U'\xfac6', U'\xfac6', idna_status::mapped},
-    {U'\xfac7', U'\xfac7', idna_status::mapped},
-    {U'\xfac8', U'\xfac8', idna_status::mapped},
-    {U'\xfac9', U'\xfac9', idna_status::mapped},
-    {U'\xfaca', U'\xfaca', idna_status::mapped},
-    {U'\xfacb', U'\xfacb', idna_status::mapped},
-    {U'\xfacc', U'\xfacc', idna_status::mapped},
-    {U'\xfacd', U'\xfacd', idna_status::mapped},
-    {U'\xface', U'\xface', idna_status::mapped},
-    {U'\xfacf', U'\xfacf', idna_status::mapped},
-    {U'\xfad0', U'\xfad0', idna_status::mapped},
-    {U'\xfad1', U'\xfad1', idna_status::mapped},
-    {U'\xfad2', U'\xfad2', idna_status::mapped},
-    {U'\xfad3', U'\xfad3', idna_status::mapped},
-    {U'\xfad4', U'\xfad4', idna_status::mapped},
-    {U'\xfad5', U'\xfad5', idna_status::mapped},
-    {U'\xfad6', U'\xfad6', idna_status::mapped},
-    {U'\xfad7', U'\xfad7', idna_status::mapped},
-    {U'\xfad8', U'\xfad8', idna_status::mapped},
-    {U'\xfad9', U'\xfad9', idna_status::mapped},
-    {U'\xfada', U'\xfaff', idna_status::disallowed},
-    {U'\xfb00', U'\xfb00', idna_status::mapped},
-    {U'\xfb01', U'\xfb01', idna_status::mapped},
-    {U'\xfb02', U'\xfb02', idna_status::mapped},
-    {U'\xfb03', U'\xfb03', idna_status::mapped},
-    {U'\xfb04', U'\xfb04', idna_status::mapped},
-    {U'\xfb05', U'\xfb06', idna_status::mapped},
-    {U'\xfb07', U'\xfb12', idna_status::disallowed},
-    {U'\xfb13', U'\xfb13', idna_status::mapped},
-    {U'\xfb14', U'\xfb14', idna_status::mapped},
-    {U'\xfb15', U'\xfb15', idna_status::mapped},
-    {U'\xfb16', U'\xfb16', idna_status::mapped},
-    {U'\xfb17', U'\xfb17', idna_status::mapped},
-    {U'\xfb18', U'\xfb1c', idna_status::disallowed},
-    {U'\xfb1d', U'\xfb1d', idna_status::mapped},
-    {U'\xfb1f', U'\xfb1f', idna_status::mapped},
-    {U'\xfb20', U'\xfb20', idna_status::mapped},
-    {U'\xfb21', U'\xfb21', idna_status::mapped},
-    {U'\xfb22', U'\xfb22', idna_status::mapped},
-    {U'\xfb23', U'\xfb23', idna_status::mapped},
-    {U'\xfb24', U'\xfb24', idna_status::mapped},
-    {U'\xfb25', U'\xfb25', idna_status::mapped},
-    {U'\xfb26', U'\xfb26', idna_status::mapped},
-    {U'\xfb27', U'\xfb27', idna_status::mapped},
-    {U'\xfb28', U'\xfb28', idna_status::mapped},
-    {U'\xfb29', U'\xfb29', idna_status::disallowed_std3_mapped},
-    {U'\xfb2a', U'\xfb2a', idna_status::mapped},
-    {U'\xfb2b', U'\xfb2b', idna_status::mapped},
-    {U'\xfb2c', U'\xfb2c', idna_status::mapped},
-    {U'\xfb2d', U'\xfb2d', idna_status::mapped},
-    {U'\xfb2e', U'\xfb2e', idna_status::mapped},
-    {U'\xfb2f', U'\xfb2f', idna_status::mapped},
-    {U'\xfb30', U'\xfb30', idna_status::mapped},
-    {U'\xfb31', U'\xfb31', idna_status::mapped},
-    {U'\xfb32', U'\xfb32', idna_status::mapped},
-    {U'\xfb33', U'\xfb33', idna_status::mapped},
-    {U'\xfb34', U'\xfb34', idna_status::mapped},
-    {U'\xfb35', U'\xfb35', idna_status::mapped},
-    {U'\xfb36', U'\xfb36', idna_status::mapped},
-    {U'\xfb37', U'\xfb37', idna_status::disallowed},
-    {U'\xfb38', U'\xfb38', idna_status::mapped},
-    {U'\xfb39', U'\xfb39', idna_status::mapped},
-    {U'\xfb3a', U'\xfb3a', idna_status::mapped},
-    {U'\xfb3b', U'\xfb3b', idna_status::mapped},
-    {U'\xfb3c', U'\xfb3c', idna_status::mapped},
-    {U'\xfb3d', U'\xfb3d', idna_status::disallowed},
-    {U'\xfb3e', U'\xfb3e', idna_status::mapped},
-    {U'\xfb3f', U'\xfb3f', idna_status::disallowed},
-    {U'\xfb40', U'\xfb40', idna_status::mapped},
-    {U'\xfb41', U'\xfb41', idna_status::mapped},
-    {U'\xfb42', U'\xfb42', idna_status::disallowed},
-    {U'\xfb43', U'\xfb43', idna_status::mapped},
-    {U'\xfb44', U'\xfb44', idna_status::mapped},
-    {U'\xfb45', U'\xfb45', idna_status::disallowed},
-    {U'\xfb46', U'\xfb46', idna_status::mapped},
-    {U'\xfb47', U'\xfb47', idna_status::mapped},
-    {U'\xfb48', U'\xfb48', idna_status::mapped},
-    {U'\xfb49', U'\xfb49', idna_status::mapped},
-    {U'\xfb4a', U'\xfb4a', idna_status::mapped},
-    {U'\xfb4b', U'\xfb4b', idna_status::mapped},
-    {U'\xfb4c', U'\xfb4c', idna_status::mapped},
-    {U'\xfb4d', U'\xfb4d', idna_status::mapped},
-    {U'\xfb4e', U'\xfb4e', idna_status::mapped},
-    {U'\xfb4f', U'\xfb4f', idna_status::mapped},
-    {U'\xfb50', U'\xfb51', idna_status::mapped},
-    {U'\xfb52', U'\xfb55', idna_status::mapped},
-    {U'\xfb56', U'\xfb59', idna_status::mapped},
-    {U'\xfb5a', U'\xfb5d', idna_status::mapped},
-    {U'\xfb5e', U'\xfb61', idna_status::mapped},
-    {U'\xfb62', U'\xfb65', idna_status::mapped},
-    {U'\xfb66', U'\xfb69', idna_status::mapped},
-    {U'\xfb6a', U'\xfb6d', idna_status::mapped},
-    {U'\xfb6e', U'\xfb71', idna_status::mapped},
-    {U'\xfb72', U'\xfb75', idna_status::mapped},
-    {U'\xfb76', U'\xfb79', idna_status::mapped},
-    {U'\xfb7a', U'\xfb7d', idna_status::mapped},
-    {U'\xfb7e', U'\xfb81', idna_status::mapped},
-    {U'\xfb82', U'\xfb83', idna_status::mapped},
-    {U'\xfb84', U'\xfb85', idna_status::mapped},
-    {U'\xfb86', U'\xfb87', idna_status::mapped},
-    {U'\xfb88', U'\xfb89', idna_status::mapped},
-    {U'\xfb8a', U'\xfb8b', idna_status::mapped},
-    {U'\xfb8c', U'\xfb8d', idna_status::mapped},
-    {U'\xfb8e', U'\xfb91', idna_status::mapped},
-    {U'\xfb92', U'\xfb95', idna_status::mapped},
-    {U'\xfb96', U'\xfb99', idna_status::mapped},
-    {U'\xfb9a', U'\xfb9d', idna_status::mapped},
-    {U'\xfb9e', U'\xfb9f', idna_status::mapped},
-    {U'\xfba0', U'\xfba3', idna_status::mapped},
-    {U'\xfba4', U'\xfba5', idna_status::mapped},
-    {U'\xfba6', U'\xfba9', idna_status::mapped},
-    {U'\xfbaa', U'\xfbad', idna_status::mapped},
-    {U'\xfbae', U'\xfbaf', idna_status::mapped},
-    {U'\xfbb0', U'\xfbb1', idna_status::mapped},
-    {U'\xfbc3', U'\xfbd2', idna_status::disallowed},
-    {U'\xfbd3', U'\xfbd6', idna_status::mapped},
-    {U'\xfbd7', U'\xfbd8', idna_status::mapped},
-    {U'\xfbd9', U'\xfbda', idna_status::mapped},
-    {U'\xfbdb', U'\xfbdc', idna_status::mapped},
-    {U'\xfbdd', U'\xfbdd', idna_status::mapped},
-    {U'\xfbde', U'\xfbdf', idna_status::mapped},
-    {U'\xfbe0', U'\xfbe1', idna_status::mapped},
-    {U'\xfbe2', U'\xfbe3', idna_status::mapped},
-    {U'\xfbe4', U'\xfbe7', idna_status::mapped},
-    {U'\xfbe8', U'\xfbe9', idna_status::mapped},
-    {U'\xfbea', U'\xfbeb', idna_status::mapped},
-    {U'\xfbec', U'\xfbed', idna_status::mapped},
-    {U'\xfbee', U'\xfbef', idna_status::mapped},
-    {U'\xfbf0', U'\xfbf1', idna_status::mapped},
-    {U'\xfbf2', U'\xfbf3', idna_status::mapped},
-    {U'\xfbf4', U'\xfbf5', idna_status::mapped},
-    {U'\xfbf6', U'\xfbf8', idna_status::mapped},
-    {U'\xfbf9', U'\xfbfb', idna_status::mapped},
-    {U'\xfbfc', U'\xfbff', idna_status::mapped},
-    {U'\xfc00', U'\xfc00', idna_status::mapped},
-    {U'\xfc01', U'\xfc01', idna_status::mapped},
-    {U'\xfc02', U'\xfc02', idna_status::mapped},
-    {U'\xfc03', U'\xfc03', idna_status::mapped},
-    {U'\xfc04', U'\xfc04', idna_status::mapped},
-    {U'\xfc05', U'\xfc05', idna_status::mapped},
-    {U'\xfc06', U'\xfc06', idna_status::mapped},
-    {U'\xfc07', U'\xfc07', idna_status::mapped},
-    {U'\xfc08', U'\xfc08', idna_status::mapped},
-    {U'\xfc09', U'\xfc09', idna_status::mapped},
-    {U'\xfc0a', U'\xfc0a', idna_status::mapped},
-    {U'\xfc0b', U'\xfc0b', idna_status::mapped},
-    {U'\xfc0c', U'\xfc0c', idna_status::mapped},
-    {U'\xfc0d', U'\xfc0d', idna_status::mapped},
-    {U'\xfc0e', U'\xfc0e', idna_status::mapped},
-    {U'\xfc0f', U'\xfc0f', idna_status::mapped},
-    {U'\xfc10', U'\xfc10', idna_status::mapped},
-    {U'\xfc11', U'\xfc11', idna_status::mapped},
-    {U'\xfc12', U'\xfc12', idna_status::mapped},
-    {U'\xfc13', U'\xfc13', idna_status::mapped},
-    {U'\xfc14', U'\xfc14', idna_status::mapped},
-    {U'\xfc15', U'\xfc15', idna_status::mapped},
-    {U'\xfc16', U'\xfc16', idna_status::mapped},
-    {U'\xfc17', U'\xfc17', idna_status::mapped},
-    {U'\xfc18', U'\xfc18', idna_status::mapped},
-    {U'\xfc19', U'\xfc19', idna_status::mapped},
-    {U'\xfc1a', U'\xfc1a', idna_status::mapped},
-    {U'\xfc1b', U'\xfc1b', idna_status::mapped},
-    {U'\xfc1c', U'\xfc1c', idna_status::mapped},
-    {U'\xfc1d', U'\xfc1d', idna_status::mapped},
-    {U'\xfc1e', U'\xfc1e', idna_status::mapped},
-    {U'\xfc1f', U'\xfc1f', idna_status::mapped},
-    {U'\xfc20', U'\xfc20', idna_status::mapped},
-    {U'\xfc21', U'\xfc21', idna_status::mapped},
-    {U'\xfc22', U'\xfc22', idna_status::mapped},
-    {U'\xfc23', U'\xfc23', idna_status::mapped},
-    {U'\xfc24', U'\xfc24', idna_status::mapped},
-    {U'\xfc25', U'\xfc25', idna_status::mapped},
-    {U'\xfc26', U'\xfc26', idna_status::mapped},
-    {U'\xfc27', U'\xfc27', idna_status::mapped},
-    {U'\xfc28', U'\xfc28', idna_status::mapped},
-    {U'\xfc29', U'\xfc29', idna_status::mapped},
-    {U'\xfc2a', U'\xfc2a', idna_status::mapped},
-    {U'\xfc2b', U'\xfc2b', idna_status::mapped},
-    {U'\xfc2c', U'\xfc2c', idna_status::mapped},
-    {U'\xfc2d', U'\xfc2d', idna_status::mapped},
-    {U'\xfc2e', U'\xfc2e', idna_status::mapped},
-    {U'\xfc2f', U'\xfc2f', idna_status::mapped},
-    {U'\xfc30', U'\xfc30', idna_status::mapped},
-    {U'\xfc31', U'\xfc31', idna_status::mapped},
-    {U'\xfc32', U'\xfc32', idna_status::mapped},
-    {U'\xfc33', U'\xfc33', idna_status::mapped},
-    {U'\xfc34', U'\xfc34', idna_status::mapped},
-    {U'\xfc35', U'\xfc35', idna_status::mapped},
-    {U'\xfc36', U'\xfc36', idna_status::mapped},
-    {U'\xfc37', U'\xfc37', idna_status::mapped},
-    {U'\xfc38', U'\xfc38', idna_status::mapped},
-    {U'\xfc39', U'\xfc39', idna_status::mapped},
-    {U'\xfc3a', U'\xfc3a', idna_status::mapped},
-    {U'\xfc3b', U'\xfc3b', idna_status::mapped},
-    {U'\xfc3c', U'\xfc3c', idna_status::mapped},
-    {U'\xfc3d', U'\xfc3d', idna_status::mapped},
-    {U'\xfc3e', U'\xfc3e', idna_status::mapped},
-    {U'\xfc3f', U'\xfc3f', idna_status::mapped},
-    {U'\xfc40', U'\xfc40', idna_status::mapped},
-    {U'\xfc41', U'\xfc41', idna_status::mapped},
-    {U'\xfc42', U'\xfc42', idna_status::mapped},
-    {U'\xfc43', U'\xfc43', idna_status::mapped},
-    {U'\xfc44', U'\xfc44', idna_status::mapped},
-    {U'\xfc45', U'\xfc45', idna_status::mapped},
-    {U'\xfc46', U'\xfc46', idna_status::mapped},
-    {U'\xfc47', U'\xfc47', idna_status::mapped},
-    {U'\xfc48', U'\xfc48', idna_status::mapped},
-    {U'\xfc49', U'\xfc49', idna_status::mapped},
-    {U'\xfc4a', U'\xfc4a', idna_status::mapped},
-    {U'\xfc4b', U'\xfc4b', idna_status::mapped},
-    {U'\xfc4c', U'\xfc4c', idna_status::mapped},
-    {U'\xfc4d', U'\xfc4d', idna_status::mapped},
-    {U'\xfc4e', U'\xfc4e', idna_status::mapped},
-    {U'\xfc4f', U'\xfc4f', idna_status::mapped},
-    {U'\xfc50', U'\xfc50', idna_status::mapped},
-    {U'\xfc51', U'\xfc51', idna_status::mapped},
-    {U'\xfc52', U'\xfc52', idna_status::mapped},
-    {U'\xfc53', U'\xfc53', idna_status::mapped},
-    {U'\xfc54', U'\xfc54', idna_status::mapped},
-    {U'\xfc55', U'\xfc55', idna_status::mapped},
-    {U'\xfc56', U'\xfc56', idna_status::mapped},
-    {U'\xfc57', U'\xfc57', idna_status::mapped},
-    {U'\xfc58', U'\xfc58', idna_status::mapped},
-    {U'\xfc59', U'\xfc59', idna_status::mapped},
-    {U'\xfc5a', U'\xfc5a', idna_status::mapped},
-    {U'\xfc5b', U'\xfc5b', idna_status::mapped},
-    {U'\xfc5c', U'\xfc5c', idna_status::mapped},
-    {U'\xfc5d', U'\xfc5d', idna_status::mapped},
-    {U'\xfc5e', U'\xfc5e', idna_status::disallowed_std3_mapped},
-    {U'\xfc5f', U'\xfc5f', idna_status::disallowed_std3_mapped},
-    {U'\xfc60', U'\xfc60', idna_status::disallowed_std3_mapped},
-    {U'\xfc61', U'\xfc61', idna_status::disallowed_std3_mapped},
-    {U'\xfc62', U'\xfc62', idna_status::disallowed_std3_mapped},
-    {U'\xfc63', U'\xfc63', idna_status::disallowed_std3_mapped},
-    {U'\xfc64', U'\xfc64', idna_status::mapped},
-    {U'\xfc65', U'\xfc65', idna_status::mapped},
-    {U'\xfc66', U'\xfc66', idna_status::mapped},
-    {U'\xfc67', U'\xfc67', idna_status::mapped},
-    {U'\xfc68', U'\xfc68', idna_status::mapped},
-    {U'\xfc69', U'\xfc69', idna_status::mapped},
-    {U'\xfc6a', U'\xfc6a', idna_status::mapped},
-    {U'\xfc6b', U'\xfc6b', idna_status::mapped},
-    {U'\xfc6c', U'\xfc6c', idna_status::mapped},
-    {U'\xfc6d', U'\xfc6d', idna_status::mapped},
-    {U'\xfc6e', U'\xfc6e', idna_status::mapped},
-    {U'\xfc6f', U'\xfc6f', idna_status::mapped},
-    {U'\xfc70', U'\xfc70', idna_status::mapped},
-    {U'\xfc71', U'\xfc71', idna_status::mapped},
-    {U'\xfc72', U'\xfc72', idna_status::mapped},
-    {U'\xfc73', U'\xfc73', idna_status::mapped},
-    {U'\xfc74', U'\xfc74', idna_status::mapped},
-    {U'\xfc75', U'\xfc75', idna_status::mapped},
-    {U'\xfc76', U'\xfc76', idna_status::mapped},
-    {U'\xfc77', U'\xfc77', idna_status::mapped},
-    {U'\xfc78', U'\xfc78', idna_status::mapped},
-    {U'\xfc79', U'\xfc79', idna_status::mapped},
-    {U'\xfc7a', U'\xfc7a', idna_status::mapped},
-    {U'\xfc7b', U'\xfc7b', idna_status::mapped},
-    {U'\xfc7c', U'\xfc7c', idna_status::mapped},
-    {U'\xfc7d', U'\xfc7d', idna_status::mapped},
-    {U'\xfc7e', U'\xfc7e', idna_status::mapped},
-    {U'\xfc7f', U'\xfc7f', idna_status::mapped},
-    {U'\xfc80', U'\xfc80', idna_status::mapped},
-    {U'\xfc81', U'\xfc81', idna_status::mapped},
-    {U'\xfc82', U'\xfc82', idna_status::mapped},
-    {U'\xfc83', U'\xfc83', idna_status::mapped},
-    {U'\xfc84', U'\xfc84', idna_status::mapped},
-    {U'\xfc85', U'\xfc85', idna_status::mapped},
-    {U'\xfc86', U'\xfc86', idna_status::mapped},
-    {U'\xfc87', U'\xfc87', idna_status::mapped},
-    {U'\xfc88', U'\xfc88', idna_status::mapped},
-    {U'\xfc89', U'\xfc89', idna_status::mapped},
-    {U'\xfc8a', U'\xfc8a', idna_status::mapped},
-    {U'\xfc8b', U'\xfc8b', idna_status::mapped},
-    {U'\xfc8c', U'\xfc8c', idna_status::mapped},
-    {U'\xfc8d', U'\xfc8d', idna_status::mapped},
-    {U'\xfc8e', U'\xfc8e', idna_status::mapped},
-    {U'\xfc8f', U'\xfc8f', idna_status::mapped},
-    {U'\xfc90', U'\xfc90', idna_status::mapped},
-    {U'\xfc91', U'\xfc91', idna_status::mapped},
-    {U'\xfc92', U'\xfc92', idna_status::mapped},
-    {U'\xfc93', U'\xfc93', idna_status::mapped},
-    {U'\xfc94', U'\xfc94', idna_status::mapped},
-    {U'\xfc95', U'\xfc95', idna_status::mapped},
-    {U'\xfc96', U'\xfc96', idna_status::mapped},
-    {U'\xfc97', U'\xfc97', idna_status::mapped},
-    {U'\xfc98', U'\xfc98', idna_status::mapped},
-    {U'\xfc99', U'\xfc99', idna_status::mapped},
-    {U'\xfc9a', U'\xfc9a', idna_status::mapped},
-    {U'\xfc9b', U'\xfc9b', idna_status::mapped},
-    {U'\xfc9c', U'\xfc9c', idna_status::mapped},
-    {U'\xfc9d', U'\xfc9d', idna_status::mapped},
-    {U'\xfc9e', U'\xfc9e', idna_status::mapped},
-    {U'\xfc9f', U'\xfc9f', idna_status::mapped},
-    {U'\xfca0', U'\xfca0', idna_status::mapped},
-    {U'\xfca1', U'\xfca1', idna_status::mapped},
-    {U'\xfca2', U'\xfca2', idna_status::mapped},
-    {U'\xfca3', U'\xfca3', idna_status::mapped},
-    {U'\xfca4', U'\xfca4', idna_status::mapped},
-    {U'\xfca5', U'\xfca5', idna_status::mapped},
-    {U'\xfca6', U'\xfca6', idna_status::mapped},
-    {U'\xfca7', U'\xfca7', idna_status::mapped},
-    {U'\xfca8', U'\xfca8', idna_status::mapped},
-    {U'\xfca9', U'\xfca9', idna_status::mapped},
-    {U'\xfcaa', U'\xfcaa', idna_status::mapped},
-    {U'\xfcab', U'\xfcab', idna_status::mapped},
-    {U'\xfcac', U'\xfcac', idna_status::mapped},
-    {U'\xfcad', U'\xfcad', idna_status::mapped},
-    {U'\xfcae', U'\xfcae', idna_status::mapped},
-    {U'\xfcaf', U'\xfcaf', idna_status::mapped},
-    {U'\xfcb0', U'\xfcb0', idna_status::mapped},
-    {U'\xfcb1', U'\xfcb1', idna_status::mapped},
-    {U'\xfcb2', U'\xfcb2', idna_status::mapped},
-    {U'\xfcb3', U'\xfcb3', idna_status::mapped},
-    {U'\xfcb4', U'\xfcb4', idna_status::mapped},
-    {U'\xfcb5', U'\xfcb5', idna_status::mapped},
-    {U'\xfcb6', U'\xfcb6', idna_status::mapped},
-    {U'\xfcb7', U'\xfcb7', idna_status::mapped},
-    {U'\xfcb8', U'\xfcb8', idna_status::mapped},
-    {U'\xfcb9', U'\xfcb9', idna_status::mapped},
-    {U'\xfcba', U'\xfcba', idna_status::mapped},
-    {U'\xfcbb', U'\xfcbb', idna_status::mapped},
-    {U'\xfcbc', U'\xfcbc', idna_status::mapped},
-    {U'\xfcbd', U'\xfcbd', idna_status::mapped},
-    {U'\xfcbe', U'\xfcbe', idna_status::mapped},
-    {U'\xfcbf', U'\xfcbf', idna_status::mapped},
-    {U'\xfcc0', U'\xfcc0', idna_status::mapped},
-    {U'\xfcc1', U'\xfcc1', idna_status::mapped},
-    {U'\xfcc2', U'\xfcc2', idna_status::mapped},
-    {U'\xfcc3', U'\xfcc3', idna_status::mapped},
-    {U'\xfcc4', U'\xfcc4', idna_status::mapped},
-    {U'\xfcc5', U'\xfcc5', idna_status::mapped},
-    {U'\xfcc6', U'\xfcc6', idna_status::mapped},
-    {U'\xfcc7', U'\xfcc7', idna_status::mapped},
-    {U'\xfcc8', U'\xfcc8', idna_status::mapped},
-    {U'\xfcc9', U'\xfcc9', idna_status::mapped},
-    {U'\xfcca', U'\xfcca', idna_status::mapped},
-    {U'\xfccb', U'\xfccb', idna_status::mapped},
-    {U'\xfccc', U'\xfccc', idna_status::mapped},
-    {U'\xfccd', U'\xfccd', idna_status::mapped},
-    {U'\xfcce', U'\xfcce', idna_status::mapped},
-    {U'\xfccf', U'\xfccf', idna_status::mapped},
-    {U'\xfcd0', U'\xfcd0', idna_status::mapped},
-    {U'\xfcd1', U'\xfcd1', idna_status::mapped},
-    {U'\xfcd2', U'\xfcd2', idna_status::mapped},
-    {U'\xfcd3', U'\xfcd3', idna_status::mapped},
-    {U'\xfcd4', U'\xfcd4', idna_status::mapped},
-    {U'\xfcd5', U'\xfcd5', idna_status::mapped},
-    {U'\xfcd6', U'\xfcd6', idna_status::mapped},
-    {U'\xfcd7', U'\xfcd7', idna_status::mapped},
-    {U'\xfcd8', U'\xfcd8', idna_status::mapped},
-    {U'\xfcd9', U'\xfcd9', idna_status::mapped},
-    {U'\xfcda', U'\xfcda', idna_status::mapped},
-    {U'\xfcdb', U'\xfcdb', idna_status::mapped},
-    {U'\xfcdc', U'\xfcdc', idna_status::mapped},
-    {U'\xfcdd', U'\xfcdd', idna_status::mapped},
-    {U'\xfcde', U'\xfcde', idna_status::mapped},
-    {U'\xfcdf', U'\xfcdf', idna_status::mapped},
-    {U'\xfce0', U'\xfce0', idna_status::mapped},
-    {U'\xfce1', U'\xfce1', idna_status::mapped},
-    {U'\xfce2', U'\xfce2', idna_status::mapped},
-    {U'\xfce3', U'\xfce3', idna_status::mapped},
-    {U'\xfce4', U'\xfce4', idna_status::mapped},
-    {U'\xfce5', U'\xfce5', idna_status::mapped},
-    {U'\xfce6', U'\xfce6', idna_status::mapped},
-    {U'\xfce7', U'\xfce7', idna_status::mapped},
-    {U'\xfce8', U'\xfce8', idna_status::mapped},
-    {U'\xfce9', U'\xfce9', idna_status::mapped},
-    {U'\xfcea', U'\xfcea', idna_status::mapped},
-    {U'\xfceb', U'\xfceb', idna_status::mapped},
-    {U'\xfcec', U'\xfcec', idna_status::mapped},
-    {U'\xfced', U'\xfced', idna_status::mapped},
-    {U'\xfcee', U'\xfcee', idna_status::mapped},
-    {U'\xfcef', U'\xfcef', idna_status::mapped},
-    {U'\xfcf0', U'\xfcf0', idna_status::mapped},
-    {U'\xfcf1', U'\xfcf1', idna_status::mapped},
-    {U'\xfcf2', U'\xfcf2', idna_status::mapped},
-    {U'\xfcf3', U'\xfcf3', idna_status::mapped},
-    {U'\xfcf4', U'\xfcf4', idna_status::mapped},
-    {U'\xfcf5', U'\xfcf5', idna_status::mapped},
-    {U'\xfcf6', U'\xfcf6', idna_status::mapped},
-    {U'\xfcf7', U'\xfcf7', idna_status::mapped},
-    {U'\xfcf8', U'\xfcf8', idna_status::mapped},
-    {U'\xfcf9', U'\xfcf9', idna_status::mapped},
-    {U'\xfcfa', U'\xfcfa', idna_status::mapped},
-    {U'\xfcfb', U'\xfcfb', idna_status::mapped},
-    {U'\xfcfc', U'\xfcfc', idna_status::mapped},
-    {U'\xfcfd', U'\xfcfd', idna_status::mapped},
-    {U'\xfcfe', U'\xfcfe', idna_status::mapped},
-    {U'\xfcff', U'\xfcff', idna_status::mapped},
-    {U'\xfd00', U'\xfd00', idna_status::mapped},
-    {U'\xfd01', U'\xfd01', idna_status::mapped},
-    {U'\xfd02', U'\xfd02', idna_status::mapped},
-    {U'\xfd03', U'\xfd03', idna_status::mapped},
-    {U'\xfd04', U'\xfd04', idna_status::mapped},
-    {U'\xfd05', U'\xfd05', idna_status::mapped},
-    {U'\xfd06', U'\xfd06', idna_status::mapped},
-    {U'\xfd07', U'\xfd07', idna_status::mapped},
-    {U'\xfd08', U'\xfd08', idna_status::mapped},
-    {U'\xfd09', U'\xfd09', idna_status::mapped},
-    {U'\xfd0a', U'\xfd0a', idna_status::mapped},
-    {U'\xfd0b', U'\xfd0b', idna_status::mapped},
-    {U'\xfd0c', U'\xfd0c', idna_status::mapped},
-    {U'\xfd0d', U'\xfd0d', idna_status::mapped},
-    {U'\xfd0e', U'\xfd0e', idna_status::mapped},
-    {U'\xfd0f', U'\xfd0f', idna_status::mapped},
-    {U'\xfd10', U'\xfd10', idna_status::mapped},
-    {U'\xfd11', U'\xfd11', idna_status::mapped},
-    {U'\xfd12', U'\xfd12', idna_status::mapped},
-    {U'\xfd13', U'\xfd13', idna_status::mapped},
-    {U'\xfd14', U'\xfd14', idna_status::mapped},
-    {U'\xfd15', U'\xfd15', idna_status::mapped},
-    {U'\xfd16', U'\xfd16', idna_status::mapped},
-    {U'\xfd17', U'\xfd17', idna_status::mapped},
-    {U'\xfd18', U'\xfd18', idna_status::mapped},
-    {U'\xfd19', U'\xfd19', idna_status::mapped},
-    {U'\xfd1a', U'\xfd1a', idna_status::mapped},
-    {U'\xfd1b', U'\xfd1b', idna_status::mapped},
-    {U'\xfd1c', U'\xfd1c', idna_status::mapped},
-    {U'\xfd1d', U'\xfd1d', idna_status::mapped},
-    {U'\xfd1e', U'\xfd1e', idna_status::mapped},
-    {U'\xfd1f', U'\xfd1f', idna_status::mapped},
-    {U'\xfd20', U'\xfd20', idna_status::mapped},
-    {U'\xfd21', U'\xfd21', idna_status::mapped},
-    {U'\xfd22', U'\xfd22', idna_status::mapped},
-    {U'\xfd23', U'\xfd23', idna_status::mapped},
-    {U'\xfd24', U'\xfd24', idna_status::mapped},
-    {U'\xfd25', U'\xfd25', idna_status::mapped},
-    {U'\xfd26', U'\xfd26', idna_status::mapped},
-    {U'\xfd27', U'\xfd27', idna_status::mapped},
-    {U'\xfd28', U'\xfd28', idna_status::mapped},
-    {U'\xfd29', U'\xfd29', idna_status::mapped},
-    {U'\xfd2a', U'\xfd2a', idna_status::mapped},
-    {U'\xfd2b', U'\xfd2b', idna_status::mapped},
-    {U'\xfd2c', U'\xfd2c', idna_status::mapped},
-    {U'\xfd2d', U'\xfd2d', idna_status::mapped},
-    {U'\xfd2e', U'\xfd2e', idna_status::mapped},
-    {U'\xfd2f', U'\xfd2f', idna_status::mapped},
-    {U'\xfd30', U'\xfd30', idna_status::mapped},
-    {U'\xfd31', U'\xfd31', idna_status::mapped},
-    {U'\xfd32', U'\xfd32', idna_status::mapped},
-    {U'\xfd33', U'\xfd33', idna_status::mapped},
-    {U'\xfd34', U'\xfd34', idna_status::mapped},
-    {U'\xfd35', U'\xfd35', idna_status::mapped},
-    {U'\xfd36', U'\xfd36', idna_status::mapped},
-    {U'\xfd37', U'\xfd37', idna_status::mapped},
-    {U'\xfd38', U'\xfd38', idna_status::mapped},
-    {U'\xfd39', U'\xfd39', idna_status::mapped},
-    {U'\xfd3a', U'\xfd3a', idna_status::mapped},
-    {U'\xfd3b', U'\xfd3b', idna_status::mapped},
-    {U'\xfd3c', U'\xfd3d', idna_status::mapped},
-    {U'\xfd50', U'\xfd50', idna_status::mapped},
-    {U'\xfd51', U'\xfd52', idna_status::mapped},
-    {U'\xfd53', U'\xfd53', idna_status::mapped},
-    {U'\xfd54', U'\xfd54', idna_status::mapped},
-    {U'\xfd55', U'\xfd55', idna_status::mapped},
-    {U'\xfd56', U'\xfd56', idna_status::mapped},
-    {U'\xfd57', U'\xfd57', idna_status::mapped},
-    {U'\xfd58', U'\xfd59', idna_status::mapped},
-    {U'\xfd5a', U'\xfd5a', idna_status::mapped},
-    {U'\xfd5b', U'\xfd5b', idna_status::mapped},
-    {U'\xfd5c', U'\xfd5c', idna_status::mapped},
-    {U'\xfd5d', U'\xfd5d', idna_status::mapped},
-    {U'\xfd5e', U'\xfd5e', idna_status::mapped},
-    {U'\xfd5f', U'\xfd60', idna_status::mapped},
-    {U'\xfd61', U'\xfd61', idna_status::mapped},
-    {U'\xfd62', U'\xfd63', idna_status::mapped},
-    {U'\xfd64', U'\xfd65', idna_status::mapped},
-    {U'\xfd66', U'\xfd66', idna_status::mapped},
-    {U'\xfd67', U'\xfd68', idna_status::mapped},
-    {U'\xfd69', U'\xfd69', idna_status::mapped},
-    {U'\xfd6a', U'\xfd6b', idna_status::mapped},
-    {U'\xfd6c', U'\xfd6d', idna_status::mapped},
-    {U'\xfd6e', U'\xfd6e', idna_status::mapped},
-    {U'\xfd6f', U'\xfd70', idna_status::mapped},
-    {U'\xfd71', U'\xfd72', idna_status::mapped},
-    {U'\xfd73', U'\xfd73', idna_status::mapped},
-    {U'\xfd74', U'\xfd74', idna_status::mapped},
-    {U'\xfd75', U'\xfd75', idna_status::mapped},
-    {U'\xfd76', U'\xfd77', idna_status::mapped},
-    {U'\xfd78', U'\xfd78', idna_status::mapped},
-    {U'\xfd79', U'\xfd79', idna_status::mapped},
-    {U'\xfd7a', U'\xfd7a', idna_status::mapped},
-    {U'\xfd7b', U'\xfd7b', idna_status::mapped},
-    {U'\xfd7c', U'\xfd7d', idna_status::mapped},
-    {U'\xfd7e', U'\xfd7e', idna_status::mapped},
-    {U'\xfd7f', U'\xfd7f', idna_status::mapped},
-    {U'\xfd80', U'\xfd80', idna_status::mapped},
-    {U'\xfd81', U'\xfd81', idna_status::mapped},
-    {U'\xfd82', U'\xfd82', idna_status::mapped},
-    {U'\xfd83', U'\xfd84', idna_status::mapped},
-    {U'\xfd85', U'\xfd86', idna_status::mapped},
-    {U'\xfd87', U'\xfd88', idna_status::mapped},
-    {U'\xfd89', U'\xfd89', idna_status::mapped},
-    {U'\xfd8a', U'\xfd8a', idna_status::mapped},
-    {U'\xfd8b', U'\xfd8b', idna_status::mapped},
-    {U'\xfd8c', U'\xfd8c', idna_status::mapped},
-    {U'\xfd8d', U'\xfd8d', idna_status::mapped},
-    {U'\xfd8e', U'\xfd8e', idna_status::mapped},
-    {U'\xfd8f', U'\xfd8f', idna_status::mapped},
-    {U'\xfd90', U'\xfd91', idna_status::disallowed},
-    {U'\xfd92', U'\xfd92', idna_status::mapped},
-    {U'\xfd93', U'\xfd93', idna_status::mapped},
-    {U'\xfd94', U'\xfd94', idna_status::mapped},
-    {U'\xfd95', U'\xfd95', idna_status::mapped},
-    {U'\xfd96', U'\xfd96', idna_status::mapped},
-    {U'\xfd97', U'\xfd98', idna_status::mapped},
-    {U'\xfd99', U'\xfd99', idna_status::mapped},
-    {U'\xfd9a', U'\xfd9a', idna_status::mapped},
-    {U'\xfd9b', U'\xfd9b', idna_status::mapped},
-    {U'\xfd9c', U'\xfd9d', idna_status::mapped},
-    {U'\xfd9e', U'\xfd9e', idna_status::mapped},
-    {U'\xfd9f', U'\xfd9f', idna_status::mapped},
-    {U'\xfda0', U'\xfda0', idna_status::mapped},
-    {U'\xfda1', U'\xfda1', idna_status::mapped},
-    {U'\xfda2', U'\xfda2', idna_status::mapped},
-    {U'\xfda3', U'\xfda3', idna_status::mapped},
-    {U'\xfda4', U'\xfda4', idna_status::mapped},
-    {U'\xfda5', U'\xfda5', idna_status::mapped},
-    {U'\xfda6', U'\xfda6', idna_status::mapped},
-    {U'\xfda7', U'\xfda7', idna_status::mapped},
-    {U'\xfda8', U'\xfda8', idna_status::mapped},
-    {U'\xfda9', U'\xfda9', idna_status::mapped},
-    {U'\xfdaa', U'\xfdaa', idna_status::mapped},
-    {U'\xfdab', U'\xfdab', idna_status::mapped},
-    {U'\xfdac', U'\xfdac', idna_status::mapped},
-    {U'\xfdad', U'\xfdad', idna_status::mapped},
-    {U'\xfdae', U'\xfdae', idna_status::mapped},
-    {U'\xfdaf', U'\xfdaf', idna_status::mapped},
-    {U'\xfdb0', U'\xfdb0', idna_status::mapped},
-    {U'\xfdb1', U'\xfdb1', idna_status::mapped},
-    {U'\xfdb2', U'\xfdb2', idna_status::mapped},
-    {U'\xfdb3', U'\xfdb3', idna_status::mapped},
-    {U'\xfdb4', U'\xfdb4', idna_status::mapped},
-    {U'\xfdb5', U'\xfdb5', idna_status::mapped},
-    {U'\xfdb6', U'\xfdb6', idna_status::mapped},
-    {U'\xfdb7', U'\xfdb7', idna_status::mapped},
-    {U'\xfdb8', U'\xfdb8', idna_status::mapped},
-    {U'\xfdb9', U'\xfdb9', idna_status::mapped},
-    {U'\xfdba', U'\xfdba', idna_status::mapped},
-    {U'\xfdbb', U'\xfdbb', idna_status::mapped},
-    {U'\xfdbc', U'\xfdbc', idna_status::mapped},
-    {U'\xfdbd', U'\xfdbd', idna_status::mapped},
-    {U'\xfdbe', U'\xfdbe', idna_status::mapped},
-    {U'\xfdbf', U'\xfdbf', idna_status::mapped},
-    {U'\xfdc0', U'\xfdc0', idna_status::mapped},
-    {U'\xfdc1', U'\xfdc1', idna_status::mapped},
-    {U'\xfdc2', U'\xfdc2', idna_status::mapped},
-    {U'\xfdc3', U'\xfdc3', idna_status::mapped},
-    {U'\xfdc4', U'\xfdc4', idna_status::mapped},
-    {U'\xfdc5', U'\xfdc5', idna_status::mapped},
-    {U'\xfdc6', U'\xfdc6', idna_status::mapped},
-    {U'\xfdc7', U'\xfdc7', idna_status::mapped},
-    {U'\xfdc8', U'\xfdce', idna_status::disallowed},
-    {U'\xfdd0', U'\xfdef', idna_status::disallowed},
-    {U'\xfdf0', U'\xfdf0', idna_status::mapped},
-    {U'\xfdf1', U'\xfdf1', idna_status::mapped},
-    {U'\xfdf2', U'\xfdf2', idna_status::mapped},
-    {U'\xfdf3', U'\xfdf3', idna_status::mapped},
-    {U'\xfdf4', U'\xfdf4', idna_status::mapped},
-    {U'\xfdf5', U'\xfdf5', idna_status::mapped},
-    {U'\xfdf6', U'\xfdf6', idna_status::mapped},
-    {U'\xfdf7', U'\xfdf7', idna_status::mapped},
-    {U'\xfdf8', U'\xfdf8', idna_status::mapped},
-    {U'\xfdf9', U'\xfdf9', idna_status::mapped},
-    {U'\xfdfa', U'\xfdfa', idna_status::disallowed_std3_mapped},
-    {U'\xfdfb', U'\xfdfb', idna_status::disallowed_std3_mapped},
-    {U'\xfdfc', U'\xfdfc', idna_status::mapped},
-    {U'\xfe00', U'\xfe0f', idna_status::ignored},
-    {U'\xfe10', U'\xfe10', idna_status::disallowed_std3_mapped},
-    {U'\xfe11', U'\xfe11', idna_status::mapped},
-    {U'\xfe12', U'\xfe12', idna_status::disallowed},
-    {U'\xfe13', U'\xfe13', idna_status::disallowed_std3_mapped},
-    {U'\xfe14', U'\xfe14', idna_status::disallowed_std3_mapped},
-    {U'\xfe15', U'\xfe15', idna_status::disallowed_std3_mapped},
-    {U'\xfe16', U'\xfe16', idna_status::disallowed_std3_mapped},
-    {U'\xfe17', U'\xfe17', idna_status::mapped},
-    {U'\xfe18', U'\xfe18', idna_status::mapped},
-    {U'\xfe19', U'\xfe19', idna_status::disallowed},
-    {U'\xfe1a', U'\xfe1f', idna_status::disallowed},
-    {U'\xfe30', U'\xfe30', idna_status::disallowed},
-    {U'\xfe31', U'\xfe31', idna_status::mapped},
-    {U'\xfe32', U'\xfe32', idna_status::mapped},
-    {U'\xfe33', U'\xfe34', idna_status::disallowed_std3_mapped},
-    {U'\xfe35', U'\xfe35', idna_status::disallowed_std3_mapped},
-    {U'\xfe36', U'\xfe36', idna_status::disallowed_std3_mapped},
-    {U'\xfe37', U'\xfe37', idna_status::disallowed_std3_mapped},
-    {U'\xfe38', U'\xfe38', idna_status::disallowed_std3_mapped},
-    {U'\xfe39', U'\xfe39', idna_status::mapped},
-    {U'\xfe3a', U'\xfe3a', idna_status::mapped},
-    {U'\xfe3b', U'\xfe3b', idna_status::mapped},
-    {U'\xfe3c', U'\xfe3c', idna_status::mapped},
-    {U'\xfe3d', U'\xfe3d', idna_status::mapped},
-    {U'\xfe3e', U'\xfe3e', idna_status::mapped},
-    {U'\xfe3f', U'\xfe3f', idna_status::mapped},
-    {U'\xfe40', U'\xfe40', idna_status::mapped},
-    {U'\xfe41', U'\xfe41', idna_status::mapped},
-    {U'\xfe42', U'\xfe42', idna_status::mapped},
-    {U'\xfe43', U'\xfe43', idna_status::mapped},
-    {U'\xfe44', U'\xfe44', idna_status::mapped},
-    {U'\xfe47', U'\xfe47', idna_status::disallowed_std3_mapped},
-    {U'\xfe48', U'\xfe48', idna_status::disallowed_std3_mapped},
-    {U'\xfe49', U'\xfe4c', idna_status::disallowed_std3_mapped},
-    {U'\xfe4d', U'\xfe4f', idna_status::disallowed_std3_mapped},
-    {U'\xfe50', U'\xfe50', idna_status::disallowed_std3_mapped},
-    {U'\xfe51', U'\xfe51', idna_status::mapped},
-    {U'\xfe52', U'\xfe52', idna_status::disallowed},
-    {U'\xfe53', U'\xfe53', idna_status::disallowed},
-    {U'\xfe54', U'\xfe54', idna_status::disallowed_std3_mapped},
-    {U'\xfe55', U'\xfe55', idna_status::disallowed_std3_mapped},
-    {U'\xfe56', U'\xfe56', idna_status::disallowed_std3_mapped},
-    {U'\xfe57', U'\xfe57', idna_status::disallowed_std3_mapped},
-    {U'\xfe58', U'\xfe58', idna_status::mapped},
-    {U'\xfe59', U'\xfe59', idna_status::disallowed_std3_mapped},
-    {U'\xfe5a', U'\xfe5a', idna_status::disallowed_std3_mapped},
-    {U'\xfe5b', U'\xfe5b', idna_status::disallowed_std3_mapped},
-    {U'\xfe5c', U'\xfe5c', idna_status::disallowed_std3_mapped},
-    {U'\xfe5d', U'\xfe5d', idna_status::mapped},
-    {U'\xfe5e', U'\xfe5e', idna_status::mapped},
-    {U'\xfe5f', U'\xfe5f', idna_status::disallowed_std3_mapped},
-    {U'\xfe60', U'\xfe60', idna_status::disallowed_std3_mapped},
-    {U'\xfe61', U'\xfe61', idna_status::disallowed_std3_mapped},
-    {U'\xfe62', U'\xfe62', idna_status::disallowed_std3_mapped},
-    {U'\xfe63', U'\xfe63', idna_status::mapped},
-    {U'\xfe64', U'\xfe64', idna_status::disallowed_std3_mapped},
-    {U'\xfe65', U'\xfe65', idna_status::disallowed_std3_mapped},
-    {U'\xfe66', U'\xfe66', idna_status::disallowed_std3_mapped},
-    {U'\xfe67', U'\xfe67', idna_status::disallowed},
-    {U'\xfe68', U'\xfe68', idna_status::disallowed_std3_mapped},
-    {U'\xfe69', U'\xfe69', idna_status::disallowed_std3_mapped},
-    {U'\xfe6a', U'\xfe6a', idna_status::disallowed_std3_mapped},
-    {U'\xfe6b', U'\xfe6b', idna_status::disallowed_std3_mapped},
-    {U'\xfe6c', U'\xfe6f', idna_status::disallowed},
-    {U'\xfe70', U'\xfe70', idna_status::disallowed_std3_mapped},
-    {U'\xfe71', U'\xfe71', idna_status::mapped},
-    {U'\xfe72', U'\xfe72', idna_status::disallowed_std3_mapped},
-    {U'\xfe74', U'\xfe74', idna_status::disallowed_std3_mapped},
-    {U'\xfe75', U'\xfe75', idna_status::disallowed},
-    {U'\xfe76', U'\xfe76', idna_status::disallowed_std3_mapped},
-    {U'\xfe77', U'\xfe77', idna_status::mapped},
-    {U'\xfe78', U'\xfe78', idna_status::disallowed_std3_mapped},
-    {U'\xfe79', U'\xfe79', idna_status::mapped},
-    {U'\xfe7a', U'\xfe7a', idna_status::disallowed_std3_mapped},
-    {U'\xfe7b', U'\xfe7b', idna_status::mapped},
-    {U'\xfe7c', U'\xfe7c', idna_status::disallowed_std3_mapped},
-    {U'\xfe7d', U'\xfe7d', idna_status::mapped},
-    {U'\xfe7e', U'\xfe7e', idna_status::disallowed_std3_mapped},
-    {U'\xfe7f', U'\xfe7f', idna_status::mapped},
-    {U'\xfe80', U'\xfe80', idna_status::mapped},
-    {U'\xfe81', U'\xfe82', idna_status::mapped},
-    {U'\xfe83', U'\xfe84', idna_status::mapped},
-    {U'\xfe85', U'\xfe86', idna_status::mapped},
-    {U'\xfe87', U'\xfe88', idna_status::mapped},
-    {U'\xfe89', U'\xfe8c', idna_status::mapped},
-    {U'\xfe8d', U'\xfe8e', idna_status::mapped},
-    {U'\xfe8f', U'\xfe92', idna_status::mapped},
-    {U'\xfe93', U'\xfe94', idna_status::mapped},
-    {U'\xfe95', U'\xfe98', idna_status::mapped},
-    {U'\xfe99', U'\xfe9c', idna_status::mapped},
-    {U'\xfe9d', U'\xfea0', idna_status::mapped},
-    {U'\xfea1', U'\xfea4', idna_status::mapped},
-    {U'\xfea5', U'\xfea8', idna_status::mapped},
-    {U'\xfea9', U'\xfeaa', idna_status::mapped},
-    {U'\xfeab', U'\xfeac', idna_status::mapped},
-    {U'\xfead', U'\xfeae', idna_status::mapped},
-    {U'\xfeaf', U'\xfeb0', idna_status::mapped},
-    {U'\xfeb1', U'\xfeb4', idna_status::mapped},
-    {U'\xfeb5', U'\xfeb8', idna_status::mapped},
-    {U'\xfeb9', U'\xfebc', idna_status::mapped},
-    {U'\xfebd', U'\xfec0', idna_status::mapped},
-    {U'\xfec1', U'\xfec4', idna_status::mapped},
-    {U'\xfec5', U'\xfec8', idna_status::mapped},
-    {U'\xfec9', U'\xfecc', idna_status::mapped},
-    {U'\xfecd', U'\xfed0', idna_status::mapped},
-    {U'\xfed1', U'\xfed4', idna_status::mapped},
-    {U'\xfed5', U'\xfed8', idna_status::mapped},
-    {U'\xfed9', U'\xfedc', idna_status::mapped},
-    {U'\xfedd', U'\xfee0', idna_status::mapped},
-    {U'\xfee1', U'\xfee4', idna_status::mapped},
-    {U'\xfee5', U'\xfee8', idna_status::mapped},
-    {U'\xfee9', U'\xfeec', idna_status::mapped},
-    {U'\xfeed', U'\xfeee', idna_status::mapped},
-    {U'\xfeef', U'\xfef0', idna_status::mapped},
-    {U'\xfef1', U'\xfef4', idna_status::mapped},
-    {U'\xfef5', U'\xfef6', idna_status::mapped},
-    {U'\xfef7', U'\xfef8', idna_status::mapped},
-    {U'\xfef9', U'\xfefa', idna_status::mapped},
-    {U'\xfefb', U'\xfefc', idna_status::mapped},
-    {U'\xfefd', U'\xfefe', idna_status::disallowed},
-    {U'\xfeff', U'\xfeff', idna_status::ignored},
-    {U'\xff00', U'\xff00', idna_status::disallowed},
-    {U'\xff01', U'\xff01', idna_status::disallowed_std3_mapped},
-    {U'\xff02', U'\xff02', idna_status::disallowed_std3_mapped},
-    {U'\xff03', U'\xff03', idna_status::disallowed_std3_mapped},
-    {U'\xff04', U'\xff04', idna_status::disallowed_std3_mapped},
-    {U'\xff05', U'\xff05', idna_status::disallowed_std3_mapped},
-    {U'\xff06', U'\xff06', idna_status::disallowed_std3_mapped},
-    {U'\xff07', U'\xff07', idna_status::disallowed_std3_mapped},
-    {U'\xff08', U'\xff08', idna_status::disallowed_std3_mapped},
-    {U'\xff09', U'\xff09', idna_status::disallowed_std3_mapped},
-    {U'\xff0a', U'\xff0a', idna_status::disallowed_std3_mapped},
-    {U'\xff0b', U'\xff0b', idna_status::disallowed_std3_mapped},
-    {U'\xff0c', U'\xff0c', idna_status::disallowed_std3_mapped},
-    {U'\xff0d', U'\xff0d', idna_status::mapped},
-    {U'\xff0e', U'\xff0e', idna_status::mapped},
-    {U'\xff0f', U'\xff0f', idna_status::disallowed_std3_mapped},
-    {U'\xff10', U'\xff10', idna_status::mapped},
-    {U'\xff11', U'\xff11', idna_status::mapped},
-    {U'\xff12', U'\xff12', idna_status::mapped},
-    {U'\xff13', U'\xff13', idna_status::mapped},
-    {U'\xff14', U'\xff14', idna_status::mapped},
-    {U'\xff15', U'\xff15', idna_status::mapped},
-    {U'\xff16', U'\xff16', idna_status::mapped},
-    {U'\xff17', U'\xff17', idna_status::mapped},
-    {U'\xff18', U'\xff18', idna_status::mapped},
-    {U'\xff19', U'\xff19', idna_status::mapped},
-    {U'\xff1a', U'\xff1a', idna_status::disallowed_std3_mapped},
-    {U'\xff1b', U'\xff1b', idna_status::disallowed_std3_mapped},
-    {U'\xff1c', U'\xff1c', idna_status::disallowed_std3_mapped},
-    {U'\xff1d', U'\xff1d', idna_status::disallowed_std3_mapped},
-    {U'\xff1e', U'\xff1e', idna_status::disallowed_std3_mapped},
-    {U'\xff1f', U'\xff1f', idna_status::disallowed_std3_mapped},
-    {U'\xff20', U'\xff20', idna_status::disallowed_std3_mapped},
-    {U'\xff21', U'\xff21', idna_status::mapped},
-    {U'\xff22', U'\xff22', idna_status::mapped},
-    {U'\xff23', U'\xff23', idna_status::mapped},
-    {U'\xff24', U'\xff24', idna_status::mapped},
-    {U'\xff25', U'\xff25', idna_status::mapped},
-    {U'\xff26', U'\xff26', idna_status::mapped},
-    {U'\xff27', U'\xff27', idna_status::mapped},
-    {U'\xff28', U'\xff28', idna_status::mapped},
-    {U'\xff29', U'\xff29', idna_status::mapped},
-    {U'\xff2a', U'\xff2a', idna_status::mapped},
-    {U'\xff2b', U'\xff2b', idna_status::mapped},
-    {U'\xff2c', U'\xff2c', idna_status::mapped},
-    {U'\xff2d', U'\xff2d', idna_status::mapped},
-    {U'\xff2e', U'\xff2e', idna_status::mapped},
-    {U'\xff2f', U'\xff2f', idna_status::mapped},
-    {U'\xff30', U'\xff30', idna_status::mapped},
-    {U'\xff31', U'\xff31', idna_status::mapped},
-    {U'\xff32', U'\xff32', idna_status::mapped},
-    {U'\xff33', U'\xff33', idna_status::mapped},
-    {U'\xff34', U'\xff34', idna_status::mapped},
-    {U'\xff35', U'\xff35', idna_status::mapped},
-    {U'\xff36', U'\xff36', idna_status::mapped},
-    {U'\xff37', U'\xff37', idna_status::mapped},
-    {U'\xff38', U'\xff38', idna_status::mapped},
-    {U'\xff39', U'\xff39', idna_status::mapped},
-    {U'\xff3a', U'\xff3a', idna_status::mapped},
-    {U'\xff3b', U'\xff3b', idna_status::disallowed_std3_mapped},
-    {U'\xff3c', U'\xff3c', idna_status::disallowed_std3_mapped},
-    {U'\xff3d', U'\xff3d', idna_status::disallowed_std3_mapped},
-    {U'\xff3e', U'\xff3e', idna_status::disallowed_std3_mapped},
-    {U'\xff3f', U'\xff3f', idna_status::disallowed_std3_mapped},
-    {U'\xff40', U'\xff40', idna_status::disallowed_std3_mapped},
-    {U'\xff41', U'\xff41', idna_status::mapped},
-    {U'\xff42', U'\xff42', idna_status::mapped},
-    {U'\xff43', U'\xff43', idna_status::mapped},
-    {U'\xff44', U'\xff44', idna_status::mapped},
-    {U'\xff45', U'\xff45', idna_status::mapped},
-    {U'\xff46', U'\xff46', idna_status::mapped},
-    {U'\xff47', U'\xff47', idna_status::mapped},
-    {U'\xff48', U'\xff48', idna_status::mapped},
-    {U'\xff49', U'\xff49', idna_status::mapped},
-    {U'\xff4a', U'\xff4a', idna_status::mapped},
-    {U'\xff4b', U'\xff4b', idna_status::mapped},
-    {U'\xff4c', U'\xff4c', idna_status::mapped},
-    {U'\xff4d', U'\xff4d', idna_status::mapped},
-    {U'\xff4e', U'\xff4e', idna_status::mapped},
-    {U'\xff4f', U'\xff4f', idna_status::mapped},
-    {U'\xff50', U'\xff50', idna_status::mapped},
-    {U'\xff51', U'\xff51', idna_status::mapped},
-    {U'\xff52', U'\xff52', idna_status::mapped},
-    {U'\xff53', U'\xff53', idna_status::mapped},
-    {U'\xff54', U'\xff54', idna_status::mapped},
-    {U'\xff55', U'\xff55', idna_status::mapped},
-    {U'\xff56', U'\xff56', idna_status::mapped},
-    {U'\xff57', U'\xff57', idna_status::mapped},
-    {U'\xff58', U'\xff58', idna_status::mapped},
-    {U'\xff59', U'\xff59', idna_status::mapped},
-    {U'\xff5a', U'\xff5a', idna_status::mapped},
-    {U'\xff5b', U'\xff5b', idna_status::disallowed_std3_mapped},
-    {U'\xff5c', U'\xff5c', idna_status::disallowed_std3_mapped},
-    {U'\xff5d', U'\xff5d', idna_status::disallowed_std3_mapped},
-    {U'\xff5e', U'\xff5e', idna_status::disallowed_std3_mapped},
-    {U'\xff5f', U'\xff5f', idna_status::mapped},
-    {U'\xff60', U'\xff60', idna_status::mapped},
-    {U'\xff61', U'\xff61', idna_status::mapped},
-    {U'\xff62', U'\xff62', idna_status::mapped},
-    {U'\xff63', U'\xff63', idna_status::mapped},
-    {U'\xff64', U'\xff64', idna_status::mapped},
-    {U'\xff65', U'\xff65', idna_status::mapped},
-    {U'\xff66', U'\xff66', idna_status::mapped},
-    {U'\xff67', U'\xff67', idna_status::mapped},
-    {U'\xff68', U'\xff68', idna_status::mapped},
-    {U'\xff69', U'\xff69', idna_status::mapped},
-    {U'\xff6a', U'\xff6a', idna_status::mapped},
-    {U'\xff6b', U'\xff6b', idna_status::mapped},
-    {U'\xff6c', U'\xff6c', idna_status::mapped},
-    {U'\xff6d', U'\xff6d', idna_status::mapped},
-    {U'\xff6e', U'\xff6e', idna_status::mapped},
-    {U'\xff6f', U'\xff6f', idna_status::mapped},
-    {U'\xff70', U'\xff70', idna_status::mapped},
-    {U'\xff71', U'\xff71', idna_status::mapped},
-    {U'\xff72', U'\xff72', idna_status::mapped},
-    {U'\xff73', U'\xff73', idna_status::mapped},
-    {U'\xff74', U'\xff74', idna_status::mapped},
-    {U'\xff75', U'\xff75', idna_status::mapped},
-    {U'\xff76', U'\xff76', idna_status::mapped},
-    {U'\xff77', U'\xff77', idna_status::mapped},
-    {U'\xff78', U'\xff78', idna_status::mapped},
-    {U'\xff79', U'\xff79', idna_status::mapped},
-    {U'\xff7a', U'\xff7a', idna_status::mapped},
-    {U'\xff7b', U'\xff7b', idna_status::mapped},
-    {U'\xff7c', U'\xff7c', idna_status::mapped},
-    {U'\xff7d', U'\xff7d', idna_status::mapped},
-    {U'\xff7e', U'\xff7e', idna_status::mapped},
-    {U'\xff7f', U'\xff7f', idna_status::mapped},
-    {U'\xff80', U'\xff80', idna_status::mapped},
-    {U'\xff81', U'\xff81', idna_status::mapped},
-    {U'\xff82', U'\xff82', idna_status::mapped},
-    {U'\xff83', U'\xff83', idna_status::mapped},
-    {U'\xff84', U'\xff84', idna_status::mapped},
-    {U'\xff85', U'\xff85', idna_status::mapped},
-    {U'\xff86', U'\xff86', idna_status::mapped},
-    {U'\xff87', U'\xff87', idna_status::mapped},
-    {U'\xff88', U'\xff88', idna_status::mapped},
-    {U'\xff89', U'\xff89', idna_status::mapped},
-    {U'\xff8a', U'\xff8a', idna_status::mapped},
-    {U'\xff8b', U'\xff8b', idna_status::mapped},
-    {U'\xff8c', U'\xff8c', idna_status::mapped},
-    {U'\xff8d', U'\xff8d', idna_status::mapped},
-    {U'\xff8e', U'\xff8e', idna_status::mapped},
-    {U'\xff8f', U'\xff8f', idna_status::mapped},
-    {U'\xff90', U'\xff90', idna_status::mapped},
-    {U'\xff91', U'\xff91', idna_status::mapped},
-    {U'\xff92', U'\xff92', idna_status::mapped},
-    {U'\xff93', U'\xff93', idna_status::mapped},
-    {U'\xff94', U'\xff94', idna_status::mapped},
-    {U'\xff95', U'\xff95', idna_status::mapped},
-    {U'\xff96', U'\xff96', idna_status::mapped},
-    {U'\xff97', U'\xff97', idna_status::mapped},
-    {U'\xff98', U'\xff98', idna_status::mapped},
-    {U'\xff99', U'\xff99', idna_status::mapped},
-    {U'\xff9a', U'\xff9a', idna_status::mapped},
-    {U'\xff9b', U'\xff9b', idna_status::mapped},
-    {U'\xff9c', U'\xff9c', idna_status::mapped},
-    {U'\xff9d', U'\xff9d', idna_status::mapped},
-    {U'\xff9e', U'\xff9e', idna_status::mapped},
-    {U'\xff9f', U'\xff9f', idna_status::mapped},
-    {U'\xffa0', U'\xffa0', idna_status::disallowed},
-    {U'\xffa1', U'\xffa1', idna_status::mapped},
-    {U'\xffa2', U'\xffa2', idna_status::mapped},
-    {U'\xffa3', U'\xffa3', idna_status::mapped},
-    {U'\xffa4', U'\xffa4', idna_status::mapped},
-    {U'\xffa5', U'\xffa5', idna_status::mapped},
-    {U'\xffa6', U'\xffa6', idna_status::mapped},
-    {U'\xffa7', U'\xffa7', idna_status::mapped},
-    {U'\xffa8', U'\xffa8', idna_status::mapped},
-    {U'\xffa9', U'\xffa9', idna_status::mapped},
-    {U'\xffaa', U'\xffaa', idna_status::mapped},
-    {U'\xffab', U'\xffab', idna_status::mapped},
-    {U'\xffac', U'\xffac', idna_status::mapped},
-    {U'\xffad', U'\xffad', idna_status::mapped},
-    {U'\xffae', U'\xffae', idna_status::mapped},
-    {U'\xffaf', U'\xffaf', idna_status::mapped},
-    {U'\xffb0', U'\xffb0', idna_status::mapped},
-    {U'\xffb1', U'\xffb1', idna_status::mapped},
-    {U'\xffb2', U'\xffb2', idna_status::mapped},
-    {U'\xffb3', U'\xffb3', idna_status::mapped},
-    {U'\xffb4', U'\xffb4', idna_status::mapped},
-    {U'\xffb5', U'\xffb5', idna_status::mapped},
-    {U'\xffb6', U'\xffb6', idna_status::mapped},
-    {U'\xffb7', U'\xffb7', idna_status::mapped},
-    {U'\xffb8', U'\xffb8', idna_status::mapped},
-    {U'\xffb9', U'\xffb9', idna_status::mapped},
-    {U'\xffba', U'\xffba', idna_status::mapped},
-    {U'\xffbb', U'\xffbb', idna_status::mapped},
-    {U'\xffbc', U'\xffbc', idna_status::mapped},
-    {U'\xffbd', U'\xffbd', idna_status::mapped},
-    {U'\xffbe', U'\xffbe', idna_status::mapped},
-    {U'\xffbf', U'\xffc1', idna_status::disallowed},
-    {U'\xffc2', U'\xffc2', idna_status::mapped},
-    {U'\xffc3', U'\xffc3', idna_status::mapped},
-    {U'\xffc4', U'\xffc4', idna_status::mapped},
-    {U'\xffc5', U'\xffc5', idna_status::mapped},
-    {U'\xffc6', U'\xffc6', idna_status::mapped},
-    {U'\xffc7', U'\xffc7', idna_status::mapped},
-    {U'\xffc8', U'\xffc9', idna_status::disallowed},
-    {U'\xffca', U'\xffca', idna_status::mapped},
-    {U'\xffcb', U'\xffcb', idna_status::mapped},
-    {U'\xffcc', U'\xffcc', idna_status::mapped},
-    {U'\xffcd', U'\xffcd', idna_status::mapped},
-    {U'\xffce', U'\xffce', idna_status::mapped},
-    {U'\xffcf', U'\xffcf', idna_status::mapped},
-    {U'\xffd0', U'\xffd1', idna_status::disallowed},
-    {U'\xffd2', U'\xffd2', idna_status::mapped},
-    {U'\xffd3', U'\xffd3', idna_status::mapped},
-    {U'\xffd4', U'\xffd4', idna_status::mapped},
-    {U'\xffd5', U'\xffd5', idna_status::mapped},
-    {U'\xffd6', U'\xffd6', idna_status::mapped},
-    {U'\xffd7', U'\xffd7', idna_status::mapped},
-    {U'\xffd8', U'\xffd9', idna_status::disallowed},
-    {U'\xffda', U'\xffda', idna_status::mapped},
-    {U'\xffdb', U'\xffdb', idna_status::mapped},
-    {U'\xffdc', U'\xffdc', idna_status::mapped},
-    {U'\xffdd', U'\xffdf', idna_status::disallowed},
-    {U'\xffe0', U'\xffe0', idna_status::mapped},
-    {U'\xffe1', U'\xffe1', idna_status::mapped},
-    {U'\xffe2', U'\xffe2', idna_status::mapped},
-    {U'\xffe3', U'\xffe3', idna_status::disallowed_std3_mapped},
-    {U'\xffe4', U'\xffe4', idna_status::mapped},
-    {U'\xffe5', U'\xffe5', idna_status::mapped},
-    {U'\xffe6', U'\xffe6', idna_status::mapped},
-    {U'\xffe7', U'\xffe7', idna_status::disallowed},
-    {U'\xffe8', U'\xffe8', idna_status::mapped},
-    {U'\xffe9', U'\xffe9', idna_status::mapped},
-    {U'\xffea', U'\xffea', idna_status::mapped},
-    {U'\xffeb', U'\xffeb', idna_status::mapped},
-    {U'\xffec', U'\xffec', idna_status::mapped},
-    {U'\xffed', U'\xffed', idna_status::mapped},
-    {U'\xffee', U'\xffee', idna_status::mapped},
-    {U'\xffef', U'\xfff8', idna_status::disallowed},
-    {U'\xfff9', U'\xfffb', idna_status::disallowed},
-    {U'\xfffc', U'\xfffc', idna_status::disallowed},
-    {U'\xfffd', U'\xfffd', idna_status::disallowed},
-    {U'\xfffe', U'\xffff', idna_status::disallowed},
-    {U'\x1000c', U'\x1000c', idna_status::disallowed},
-    {U'\x10027', U'\x10027', idna_status::disallowed},
-    {U'\x1003b', U'\x1003b', idna_status::disallowed},
-    {U'\x1003e', U'\x1003e', idna_status::disallowed},
-    {U'\x1004e', U'\x1004f', idna_status::disallowed},
-    {U'\x1005e', U'\x1007f', idna_status::disallowed},
-    {U'\x100fb', U'\x100ff', idna_status::disallowed},
-    {U'\x10103', U'\x10106', idna_status::disallowed},
-    {U'\x10134', U'\x10136', idna_status::disallowed},
-    {U'\x1018f', U'\x1018f', idna_status::disallowed},
-    {U'\x1019d', U'\x1019f', idna_status::disallowed},
-    {U'\x101a1', U'\x101cf', idna_status::disallowed},
-    {U'\x101fe', U'\x1027f', idna_status::disallowed},
-    {U'\x1029d', U'\x1029f', idna_status::disallowed},
-    {U'\x102d1', U'\x102df', idna_status::disallowed},
-    {U'\x102fc', U'\x102ff', idna_status::disallowed},
-    {U'\x10324', U'\x1032c', idna_status::disallowed},
-    {U'\x1034b', U'\x1034f', idna_status::disallowed},
-    {U'\x1037b', U'\x1037f', idna_status::disallowed},
-    {U'\x1039e', U'\x1039e', idna_status::disallowed},
-    {U'\x103c4', U'\x103c7', idna_status::disallowed},
-    {U'\x103d6', U'\x103ff', idna_status::disallowed},
-    {U'\x10400', U'\x10400', idna_status::mapped},
-    {U'\x10401', U'\x10401', idna_status::mapped},
-    {U'\x10402', U'\x10402', idna_status::mapped},
-    {U'\x10403', U'\x10403', idna_status::mapped},
-    {U'\x10404', U'\x10404', idna_status::mapped},
-    {U'\x10405', U'\x10405', idna_status::mapped},
-    {U'\x10406', U'\x10406', idna_status::mapped},
-    {U'\x10407', U'\x10407', idna_status::mapped},
-    {U'\x10408', U'\x10408', idna_status::mapped},
-    {U'\x10409', U'\x10409', idna_status::mapped},
-    {U'\x1040a', U'\x1040a', idna_status::mapped},
-    {U'\x1040b', U'\x1040b', idna_status::mapped},
-    {U'\x1040c', U'\x1040c', idna_status::mapped},
-    {U'\x1040d', U'\x1040d', idna_status::mapped},
-    {U'\x1040e', U'\x1040e', idna_status::mapped},
-    {U'\x1040f', U'\x1040f', idna_status::mapped},
-    {U'\x10410', U'\x10410', idna_status::mapped},
-    {U'\x10411', U'\x10411', idna_status::mapped},
-    {U'\x10412', U'\x10412', idna_status::mapped},
-    {U'\x10413', U'\x10413', idna_status::mapped},
-    {U'\x10414', U'\x10414', idna_status::mapped},
-    {U'\x10415', U'\x10415', idna_status::mapped},
-    {U'\x10416', U'\x10416', idna_status::mapped},
-    {U'\x10417', U'\x10417', idna_status::mapped},
-    {U'\x10418', U'\x10418', idna_status::mapped},
-    {U'\x10419', U'\x10419', idna_status::mapped},
-    {U'\x1041a', U'\x1041a', idna_status::mapped},
-    {U'\x1041b', U'\x1041b', idna_status::mapped},
-    {U'\x1041c', U'\x1041c', idna_status::mapped},
-    {U'\x1041d', U'\x1041d', idna_status::mapped},
-    {U'\x1041e', U'\x1041e', idna_status::mapped},
-    {U'\x1041f', U'\x1041f', idna_status::mapped},
-    {U'\x10420', U'\x10420', idna_status::mapped},
-    {U'\x10421', U'\x10421', idna_status::mapped},
-    {U'\x10422', U'\x10422', idna_status::mapped},
-    {U'\x10423', U'\x10423', idna_status::mapped},
-    {U'\x10424', U'\x10424', idna_status::mapped},
-    {U'\x10425', U'\x10425', idna_status::mapped},
-    {U'\x10426', U'\x10426', idna_status::mapped},
-    {U'\x10427', U'\x10427', idna_status::mapped},
-    {U'\x1049e', U'\x1049f', idna_status::disallowed},
-    {U'\x104aa', U'\x104af', idna_status::disallowed},
-    {U'\x104b0', U'\x104b0', idna_status::mapped},
-    {U'\x104b1', U'\x104b1', idna_status::mapped},
-    {U'\x104b2', U'\x104b2', idna_status::mapped},
-    {U'\x104b3', U'\x104b3', idna_status::mapped},
-    {U'\x104b4', U'\x104b4', idna_status::mapped},
-    {U'\x104b5', U'\x104b5', idna_status::mapped},
-    {U'\x104b6', U'\x104b6', idna_status::mapped},
-    {U'\x104b7', U'\x104b7', idna_status::mapped},
-    {U'\x104b8', U'\x104b8', idna_status::mapped},
-    {U'\x104b9', U'\x104b9', idna_status::mapped},
-    {U'\x104ba', U'\x104ba', idna_status::mapped},
-    {U'\x104bb', U'\x104bb', idna_status::mapped},
-    {U'\x104bc', U'\x104bc', idna_status::mapped},
-    {U'\x104bd', U'\x104bd', idna_status::mapped},
-    {U'\x104be', U'\x104be', idna_status::mapped},
-    {U'\x104bf', U'\x104bf', idna_status::mapped},
-    {U'\x104c0', U'\x104c0', idna_status::mapped},
-    {U'\x104c1', U'\x104c1', idna_status::mapped},
-    {U'\x104c2', U'\x104c2', idna_status::mapped},
-    {U'\x104c3', U'\x104c3', idna_status::mapped},
-    {U'\x104c4', U'\x104c4', idna_status::mapped},
-    {U'\x104c5', U'\x104c5', idna_status::mapped},
-    {U'\x104c6', U'\x104c6', idna_status::mapped},
-    {U'\x104c7', U'\x104c7', idna_status::mapped},
-    {U'\x104c8', U'\x104c8', idna_status::mapped},
-    {U'\x104c9', U'\x104c9', idna_status::mapped},
-    {U'\x104ca', U'\x104ca', idna_status::mapped},
-    {U'\x104cb', U'\x104cb', idna_status::mapped},
-    {U'\x104cc', U'\x104cc', idna_status::mapped},
-    {U'\x104cd', U'\x104cd', idna_status::mapped},
-    {U'\x104ce', U'\x104ce', idna_status::mapped},
-    {U'\x104cf', U'\x104cf', idna_status::mapped},
-    {U'\x104d0', U'\x104d0', idna_status::mapped},
-    {U'\x104d1', U'\x104d1', idna_status::mapped},
-    {U'\x104d2', U'\x104d2', idna_status::mapped},
-    {U'\x104d3', U'\x104d3', idna_status::mapped},
-    {U'\x104d4', U'\x104d7', idna_status::disallowed},
-    {U'\x104fc', U'\x104ff', idna_status::disallowed},
-    {U'\x10528', U'\x1052f', idna_status::disallowed},
-    {U'\x10564', U'\x1056e', idna_status::disallowed},
-    {U'\x10570', U'\x10570', idna_status::mapped},
-    {U'\x10571', U'\x10571', idna_status::mapped},
-    {U'\x10572', U'\x10572', idna_status::mapped},
-    {U'\x10573', U'\x10573', idna_status::mapped},
-    {U'\x10574', U'\x10574', idna_status::mapped},
-    {U'\x10575', U'\x10575', idna_status::mapped},
-    {U'\x10576', U'\x10576', idna_status::mapped},
-    {U'\x10577', U'\x10577', idna_status::mapped},
-    {U'\x10578', U'\x10578', idna_status::mapped},
-    {U'\x10579', U'\x10579', idna_status::mapped},
-    {U'\x1057a', U'\x1057a', idna_status::mapped},
-    {U'\x1057b', U'\x1057b', idna_status::disallowed},
-    {U'\x1057c', U'\x1057c', idna_status::mapped},
-    {U'\x1057d', U'\x1057d', idna_status::mapped},
-    {U'\x1057e', U'\x1057e', idna_status::mapped},
-    {U'\x1057f', U'\x1057f', idna_status::mapped},
-    {U'\x10580', U'\x10580', idna_status::mapped},
-    {U'\x10581', U'\x10581', idna_status::mapped},
-    {U'\x10582', U'\x10582', idna_status::mapped},
-    {U'\x10583', U'\x10583', idna_status::mapped},
-    {U'\x10584', U'\x10584', idna_status::mapped},
-    {U'\x10585', U'\x10585', idna_status::mapped},
-    {U'\x10586', U'\x10586', idna_status::mapped},
-    {U'\x10587', U'\x10587', idna_status::mapped},
-    {U'\x10588', U'\x10588', idna_status::mapped},
-    {U'\x10589', U'\x10589', idna_status::mapped},
-    {U'\x1058a', U'\x1058a', idna_status::mapped},
-    {U'\x1058b', U'\x1058b', idna_status::disallowed},
-    {U'\x1058c', U'\x1058c', idna_status::mapped},
-    {U'\x1058d', U'\x1058d', idna_status::mapped},
-    {U'\x1058e', U'\x1058e', idna_status::mapped},
-    {U'\x1058f', U'\x1058f', idna_status::mapped},
-    {U'\x10590', U'\x10590', idna_status::mapped},
-    {U'\x10591', U'\x10591', idna_status::mapped},
-    {U'\x10592', U'\x10592', idna_status::mapped},
-    {U'\x10593', U'\x10593', idna_status::disallowed},
-    {U'\x10594', U'\x10594', idna_status::mapped},
-    {U'\x10595', U'\x10595', idna_status::mapped},
-    {U'\x10596', U'\x10596', idna_status::disallowed},
-    {U'\x105a2', U'\x105a2', idna_status::disallowed},
-    {U'\x105b2', U'\x105b2', idna_status::disallowed},
-    {U'\x105ba', U'\x105ba', idna_status::disallowed},
-    {U'\x105bd', U'\x105ff', idna_status::disallowed},
-    {U'\x10737', U'\x1073f', idna_status::disallowed},
-    {U'\x10756', U'\x1075f', idna_status::disallowed},
-    {U'\x10768', U'\x1077f', idna_status::disallowed},
-    {U'\x10781', U'\x10781', idna_status::mapped},
-    {U'\x10782', U'\x10782', idna_status::mapped},
-    {U'\x10783', U'\x10783', idna_status::mapped},
-    {U'\x10784', U'\x10784', idna_status::mapped},
-    {U'\x10785', U'\x10785', idna_status::mapped},
-    {U'\x10786', U'\x10786', idna_status::disallowed},
-    {U'\x10787', U'\x10787', idna_status::mapped},
-    {U'\x10788', U'\x10788', idna_status::mapped},
-    {U'\x10789', U'\x10789', idna_status::mapped},
-    {U'\x1078a', U'\x1078a', idna_status::mapped},
-    {U'\x1078b', U'\x1078b', idna_status::mapped},
-    {U'\x1078c', U'\x1078c', idna_status::mapped},
-    {U'\x1078d', U'\x1078d', idna_status::mapped},
-    {U'\x1078e', U'\x1078e', idna_status::mapped},
-    {U'\x1078f', U'\x1078f', idna_status::mapped},
-    {U'\x10790', U'\x10790', idna_status::mapped},
-    {U'\x10791', U'\x10791', idna_status::mapped},
-    {U'\x10792', U'\x10792', idna_status::mapped},
-    {U'\x10793', U'\x10793', idna_status::mapped},
-    {U'\x10794', U'\x10794', idna_status::mapped},
-    {U'\x10795', U'\x10795', idna_status::mapped},
-    {U'\x10796', U'\x10796', idna_status::mapped},
-    {U'\x10797', U'\x10797', idna_status::mapped},
-    {U'\x10798', U'\x10798', idna_status::mapped},
-    {U'\x10799', U'\x10799', idna_status::mapped},
-    {U'\x1079a', U'\x1079a', idna_status::mapped},
-    {U'\x1079b', U'\x1079b', idna_status::mapped},
-    {U'\x1079c', U'\x1079c', idna_status::mapped},
-    {U'\x1079d', U'\x1079d', idna_status::mapped},
-    {U'\x1079e', U'\x1079e', idna_status::mapped},
-    {U'\x1079f', U'\x1079f', idna_status::mapped},
-    {U'\x107a0', U'\x107a0', idna_status::mapped},
-    {U'\x107a1', U'\x107a1', idna_status::mapped},
-    {U'\x107a2', U'\x107a2', idna_status::mapped},
-    {U'\x107a3', U'\x107a3', idna_status::mapped},
-    {U'\x107a4', U'\x107a4', idna_status::mapped},
-    {U'\x107a5', U'\x107a5', idna_status::mapped},
-    {U'\x107a6', U'\x107a6', idna_status::mapped},
-    {U'\x107a7', U'\x107a7', idna_status::mapped},
-    {U'\x107a8', U'\x107a8', idna_status::mapped},
-    {U'\x107a9', U'\x107a9', idna_status::mapped},
-    {U'\x107aa', U'\x107aa', idna_status::mapped},
-    {U'\x107ab', U'\x107ab', idna_status::mapped},
-    {U'\x107ac', U'\x107ac', idna_status::mapped},
-    {U'\x107ad', U'\x107ad', idna_status::mapped},
-    {U'\x107ae', U'\x107ae', idna_status::mapped},
-    {U'\x107af', U'\x107af', idna_status::mapped},
-    {U'\x107b0', U'\x107b0', idna_status::mapped},
-    {U'\x107b1', U'\x107b1', idna_status::disallowed},
-    {U'\x107b2', U'\x107b2', idna_status::mapped},
-    {U'\x107b3', U'\x107b3', idna_status::mapped},
-    {U'\x107b4', U'\x107b4', idna_status::mapped},
-    {U'\x107b5', U'\x107b5', idna_status::mapped},
-    {U'\x107b6', U'\x107b6', idna_status::mapped},
-    {U'\x107b7', U'\x107b7', idna_status::mapped},
-    {U'\x107b8', U'\x107b8', idna_status::mapped},
-    {U'\x107b9', U'\x107b9', idna_status::mapped},
-    {U'\x107ba', U'\x107ba', idna_status::mapped},
-    {U'\x107bb', U'\x107ff', idna_status::disallowed},
-    {U'\x10806', U'\x10807', idna_status::disallowed},
-    {U'\x10809', U'\x10809', idna_status::disallowed},
-    {U'\x10836', U'\x10836', idna_status::disallowed},
-    {U'\x10839', U'\x1083b', idna_status::disallowed},
-    {U'\x1083d', U'\x1083e', idna_status::disallowed},
-    {U'\x10856', U'\x10856', idna_status::disallowed},
-    {U'\x1089f', U'\x108a6', idna_status::disallowed},
-    {U'\x108b0', U'\x108df', idna_status::disallowed},
-    {U'\x108f3', U'\x108f3', idna_status::disallowed},
-    {U'\x108f6', U'\x108fa', idna_status::disallowed},
-    {U'\x1091c', U'\x1091e', idna_status::disallowed},
-    {U'\x1093a', U'\x1093e', idna_status::disallowed},
-    {U'\x10940', U'\x1097f', idna_status::disallowed},
-    {U'\x109b8', U'\x109bb', idna_status::disallowed},
-    {U'\x109d0', U'\x109d1', idna_status::disallowed},
-    {U'\x10a04', U'\x10a04', idna_status::disallowed},
-    {U'\x10a07', U'\x10a0b', idna_status::disallowed},
-    {U'\x10a14', U'\x10a14', idna_status::disallowed},
-    {U'\x10a18', U'\x10a18', idna_status::disallowed},
-    {U'\x10a36', U'\x10a37', idna_status::disallowed},
-    {U'\x10a3b', U'\x10a3e', idna_status::disallowed},
-    {U'\x10a49', U'\x10a4f', idna_status::disallowed},
-    {U'\x10a59', U'\x10a5f', idna_status::disallowed},
-    {U'\x10aa0', U'\x10abf', idna_status::disallowed},
-    {U'\x10ae7', U'\x10aea', idna_status::disallowed},
-    {U'\x10af7', U'\x10aff', idna_status::disallowed},
-    {U'\x10b36', U'\x10b38', idna_status::disallowed},
-    {U'\x10b56', U'\x10b57', idna_status::disallowed},
-    {U'\x10b73', U'\x10b77', idna_status::disallowed},
-    {U'\x10b92', U'\x10b98', idna_status::disallowed},
-    {U'\x10b9d', U'\x10ba8', idna_status::disallowed},
-    {U'\x10bb0', U'\x10bff', idna_status::disallowed},
-    {U'\x10c49', U'\x10c7f', idna_status::disallowed},
-    {U'\x10c80', U'\x10c80', idna_status::mapped},
-    {U'\x10c81', U'\x10c81', idna_status::mapped},
-    {U'\x10c82', U'\x10c82', idna_status::mapped},
-    {U'\x10c83', U'\x10c83', idna_status::mapped},
-    {U'\x10c84', U'\x10c84', idna_status::mapped},
-    {U'\x10c85', U'\x10c85', idna_status::mapped},
-    {U'\x10c86', U'\x10c86', idna_status::mapped},
-    {U'\x10c87', U'\x10c87', idna_status::mapped},
-    {U'\x10c88', U'\x10c88', idna_status::mapped},
-    {U'\x10c89', U'\x10c89', idna_status::mapped},
-    {U'\x10c8a', U'\x10c8a', idna_status::mapped},
-    {U'\x10c8b', U'\x10c8b', idna_status::mapped},
-    {U'\x10c8c', U'\x10c8c', idna_status::mapped},
-    {U'\x10c8d', U'\x10c8d', idna_status::mapped},
-    {U'\x10c8e', U'\x10c8e', idna_status::mapped},
-    {U'\x10c8f', U'\x10c8f', idna_status::mapped},
-    {U'\x10c90', U'\x10c90', idna_status::mapped},
-    {U'\x10c91', U'\x10c91', idna_status::mapped},
-    {U'\x10c92', U'\x10c92', idna_status::mapped},
-    {U'\x10c93', U'\x10c93', idna_status::mapped},
-    {U'\x10c94', U'\x10c94', idna_status::mapped},
-    {U'\x10c95', U'\x10c95', idna_status::mapped},
-    {U'\x10c96', U'\x10c96', idna_status::mapped},
-    {U'\x10c97', U'\x10c97', idna_status::mapped},
-    {U'\x10c98', U'\x10c98', idna_status::mapped},
-    {U'\x10c99', U'\x10c99', idna_status::mapped},
-    {U'\x10c9a', U'\x10c9a', idna_status::mapped},
-    {U'\x10c9b', U'\x10c9b', idna_status::mapped},
-    {U'\x10c9c', U'\x10c9c', idna_status::mapped},
-    {U'\x10c9d', U'\x10c9d', idna_status::mapped},
-    {U'\x10c9e', U'\x10c9e', idna_status::mapped},
-    {U'\x10c9f', U'\x10c9f', idna_status::mapped},
-    {U'\x10ca0', U'\x10ca0', idna_status::mapped},
-    {U'\x10ca1', U'\x10ca1', idna_status::mapped},
-    {U'\x10ca2', U'\x10ca2', idna_status::mapped},
-    {U'\x10ca3', U'\x10ca3', idna_status::mapped},
-    {U'\x10ca4', U'\x10ca4', idna_status::mapped},
-    {U'\x10ca5', U'\x10ca5', idna_status::mapped},
-    {U'\x10ca6', U'\x10ca6', idna_status::mapped},
-    {U'\x10ca7', U'\x10ca7', idna_status::mapped},
-    {U'\x10ca8', U'\x10ca8', idna_status::mapped},
-    {U'\x10ca9', U'\x10ca9', idna_status::mapped},
-    {U'\x10caa', U'\x10caa', idna_status::mapped},
-    {U'\x10cab', U'\x10cab', idna_status::mapped},
-    {U'\x10cac', U'\x10cac', idna_status::mapped},
-    {U'\x10cad', U'\x10cad', idna_status::mapped},
-    {U'\x10cae', U'\x10cae', idna_status::mapped},
-    {U'\x10caf', U'\x10caf', idna_status::mapped},
-    {U'\x10cb0', U'\x10cb0', idna_status::mapped},
-    {U'\x10cb1', U'\x10cb1', idna_status::mapped},
-    {U'\x10cb2', U'\x10cb2', idna_status::mapped},
-    {U'\x10cb3', U'\x10cbf', idna_status::disallowed},
-    {U'\x10cf3', U'\x10cf9', idna_status::disallowed},
-    {U'\x10d28', U'\x10d2f', idna_status::disallowed},
-    {U'\x10d3a', U'\x10e5f', idna_status::disallowed},
-    {U'\x10e7f', U'\x10e7f', idna_status::disallowed},
-    {U'\x10eaa', U'\x10eaa', idna_status::disallowed},
-    {U'\x10eae', U'\x10eaf', idna_status::disallowed},
-    {U'\x10eb2', U'\x10efc', idna_status::disallowed},
-    {U'\x10f28', U'\x10f2f', idna_status::disallowed},
-    {U'\x10f5a', U'\x10f6f', idna_status::disallowed},
-    {U'\x10f8a', U'\x10faf', idna_status::disallowed},
-    {U'\x10fcc', U'\x10fdf', idna_status::disallowed},
-    {U'\x10ff7', U'\x10fff', idna_status::disallowed},
-    {U'\x1104e', U'\x11051', idna_status::disallowed},
-    {U'\x11076', U'\x1107e', idna_status::disallowed},
-    {U'\x110bd', U'\x110bd', idna_status::disallowed},
-    {U'\x110c3', U'\x110cc', idna_status::disallowed},
-    {U'\x110cd', U'\x110cd', idna_status::disallowed},
-    {U'\x110ce', U'\x110cf', idna_status::disallowed},
-    {U'\x110e9', U'\x110ef', idna_status::disallowed},
-    {U'\x110fa', U'\x110ff', idna_status::disallowed},
-    {U'\x11135', U'\x11135', idna_status::disallowed},
-    {U'\x11148', U'\x1114f', idna_status::disallowed},
-    {U'\x11177', U'\x1117f', idna_status::disallowed},
-    {U'\x111e0', U'\x111e0', idna_status::disallowed},
-    {U'\x111f5', U'\x111ff', idna_status::disallowed},
-    {U'\x11212', U'\x11212', idna_status::disallowed},
-    {U'\x11242', U'\x1127f', idna_status::disallowed},
-    {U'\x11287', U'\x11287', idna_status::disallowed},
-    {U'\x11289', U'\x11289', idna_status::disallowed},
-    {U'\x1128e', U'\x1128e', idna_status::disallowed},
-    {U'\x1129e', U'\x1129e', idna_status::disallowed},
-    {U'\x112aa', U'\x112af', idna_status::disallowed},
-    {U'\x112eb', U'\x112ef', idna_status::disallowed},
-    {U'\x112fa', U'\x112ff', idna_status::disallowed},
-    {U'\x11304', U'\x11304', idna_status::disallowed},
-    {U'\x1130d', U'\x1130e', idna_status::disallowed},
-    {U'\x11311', U'\x11312', idna_status::disallowed},
-    {U'\x11329', U'\x11329', idna_status::disallowed},
-    {U'\x11331', U'\x11331', idna_status::disallowed},
-    {U'\x11334', U'\x11334', idna_status::disallowed},
-    {U'\x1133a', U'\x1133a', idna_status::disallowed},
-    {U'\x11345', U'\x11346', idna_status::disallowed},
-    {U'\x11349', U'\x1134a', idna_status::disallowed},
-    {U'\x1134e', U'\x1134f', idna_status::disallowed},
-    {U'\x11351', U'\x11356', idna_status::disallowed},
-    {U'\x11358', U'\x1135c', idna_status::disallowed},
-    {U'\x11364', U'\x11365', idna_status::disallowed},
-    {U'\x1136d', U'\x1136f', idna_status::disallowed},
-    {U'\x11375', U'\x113ff', idna_status::disallowed},
-    {U'\x1145c', U'\x1145c', idna_status::disallowed},
-    {U'\x11462', U'\x1147f', idna_status::disallowed},
-    {U'\x114c8', U'\x114cf', idna_status::disallowed},
-    {U'\x114da', U'\x1157f', idna_status::disallowed},
-    {U'\x115b6', U'\x115b7', idna_status::disallowed},
-    {U'\x115de', U'\x115ff', idna_status::disallowed},
-    {U'\x11645', U'\x1164f', idna_status::disallowed},
-    {U'\x1165a', U'\x1165f', idna_status::disallowed},
-    {U'\x1166d', U'\x1167f', idna_status::disallowed},
-    {U'\x116ba', U'\x116bf', idna_status::disallowed},
-    {U'\x116ca', U'\x116ff', idna_status::disallowed},
-    {U'\x1171b', U'\x1171c', idna_status::disallowed},
-    {U'\x1172c', U'\x1172f', idna_status::disallowed},
-    {U'\x11747', U'\x117ff', idna_status::disallowed},
-    {U'\x1183c', U'\x1189f', idna_status::disallowed},
-    {U'\x118a0', U'\x118a0', idna_status::mapped},
-    {U'\x118a1', U'\x118a1', idna_status::mapped},
-    {U'\x118a2', U'\x118a2', idna_status::mapped},
-    {U'\x118a3', U'\x118a3', idna_status::mapped},
-    {U'\x118a4', U'\x118a4', idna_status::mapped},
-    {U'\x118a5', U'\x118a5', idna_status::mapped},
-    {U'\x118a6', U'\x118a6', idna_status::mapped},
-    {U'\x118a7', U'\x118a7', idna_status::mapped},
-    {U'\x118a8', U'\x118a8', idna_status::mapped},
-    {U'\x118a9', U'\x118a9', idna_status::mapped},
-    {U'\x118aa', U'\x118aa', idna_status::mapped},
-    {U'\x118ab', U'\x118ab', idna_status::mapped},
-    {U'\x118ac', U'\x118ac', idna_status::mapped},
-    {U'\x118ad', U'\x118ad', idna_status::mapped},
-    {U'\x118ae', U'\x118ae', idna_status::mapped},
-    {U'\x118af', U'\x118af', idna_status::mapped},
-    {U'\x118b0', U'\x118b0', idna_status::mapped},
-    {U'\x118b1', U'\x118b1', idna_status::mapped},
-    {U'\x118b2', U'\x118b2', idna_status::mapped},
-    {U'\x118b3', U'\x118b3', idna_status::mapped},
-    {U'\x118b4', U'\x118b4', idna_status::mapped},
-    {U'\x118b5', U'\x118b5', idna_status::mapped},
-    {U'\x118b6', U'\x118b6', idna_status::mapped},
-    {U'\x118b7', U'\x118b7', idna_status::mapped},
-    {U'\x118b8', U'\x118b8', idna_status::mapped},
-    {U'\x118b9', U'\x118b9', idna_status::mapped},
-    {U'\x118ba', U'\x118ba', idna_status::mapped},
-    {U'\x118bb', U'\x118bb', idna_status::mapped},
-    {U'\x118bc', U'\x118bc', idna_status::mapped},
-    {U'\x118bd', U'\x118bd', idna_status::mapped},
-    {U'\x118be', U'\x118be', idna_status::mapped},
-    {U'\x118bf', U'\x118bf', idna_status::mapped},
-    {U'\x118f3', U'\x118fe', idna_status::disallowed},
-    {U'\x11907', U'\x11908', idna_status::disallowed},
-    {U'\x1190a', U'\x1190b', idna_status::disallowed},
-    {U'\x11914', U'\x11914', idna_status::disallowed},
-    {U'\x11917', U'\x11917', idna_status::disallowed},
-    {U'\x11936', U'\x11936', idna_status::disallowed},
-    {U'\x11939', U'\x1193a', idna_status::disallowed},
-    {U'\x11947', U'\x1194f', idna_status::disallowed},
-    {U'\x1195a', U'\x1199f', idna_status::disallowed},
-    {U'\x119a8', U'\x119a9', idna_status::disallowed},
-    {U'\x119d8', U'\x119d9', idna_status::disallowed},
-    {U'\x119e5', U'\x119ff', idna_status::disallowed},
-    {U'\x11a48', U'\x11a4f', idna_status::disallowed},
-    {U'\x11aa3', U'\x11aaf', idna_status::disallowed},
-    {U'\x11af9', U'\x11aff', idna_status::disallowed},
-    {U'\x11b0a', U'\x11bff', idna_status::disallowed},
-    {U'\x11c09', U'\x11c09', idna_status::disallowed},
-    {U'\x11c37', U'\x11c37', idna_status::disallowed},
-    {U'\x11c46', U'\x11c4f', idna_status::disallowed},
-    {U'\x11c6d', U'\x11c6f', idna_status::disallowed},
-    {U'\x11c90', U'\x11c91', idna_status::disallowed},
-    {U'\x11ca8', U'\x11ca8', idna_status::disallowed},
-    {U'\x11cb7', U'\x11cff', idna_status::disallowed},
-    {U'\x11d07', U'\x11d07', idna_status::disallowed},
-    {U'\x11d0a', U'\x11d0a', idna_status::disallowed},
-    {U'\x11d37', U'\x11d39', idna_status::disallowed},
-    {U'\x11d3b', U'\x11d3b', idna_status::disallowed},
-    {U'\x11d3e', U'\x11d3e', idna_status::disallowed},
-    {U'\x11d48', U'\x11d4f', idna_status::disallowed},
-    {U'\x11d5a', U'\x11d5f', idna_status::disallowed},
-    {U'\x11d66', U'\x11d66', idna_status::disallowed},
-    {U'\x11d69', U'\x11d69', idna_status::disallowed},
-    {U'\x11d8f', U'\x11d8f', idna_status::disallowed},
-    {U'\x11d92', U'\x11d92', idna_status::disallowed},
-    {U'\x11d99', U'\x11d9f', idna_status::disallowed},
-    {U'\x11daa', U'\x11edf', idna_status::disallowed},
-    {U'\x11ef9', U'\x11eff', idna_status::disallowed},
-    {U'\x11f11', U'\x11f11', idna_status::disallowed},
-    {U'\x11f3b', U'\x11f3d', idna_status::disallowed},
-    {U'\x11f5a', U'\x11faf', idna_status::disallowed},
-    {U'\x11fb1', U'\x11fbf', idna_status::disallowed},
-    {U'\x11ff2', U'\x11ffe', idna_status::disallowed},
-    {U'\x1239a', U'\x123ff', idna_status::disallowed},
-    {U'\x1246f', U'\x1246f', idna_status::disallowed},
-    {U'\x12475', U'\x1247f', idna_status::disallowed},
-    {U'\x12544', U'\x12f8f', idna_status::disallowed},
-    {U'\x12ff3', U'\x12fff', idna_status::disallowed},
-    {U'\x13430', U'\x13438', idna_status::disallowed},
-    {U'\x13439', U'\x1343f', idna_status::disallowed},
-    {U'\x13456', U'\x143ff', idna_status::disallowed},
-    {U'\x14647', U'\x167ff', idna_status::disallowed},
-    {U'\x16a39', U'\x16a3f', idna_status::disallowed},
-    {U'\x16a5f', U'\x16a5f', idna_status::disallowed},
-    {U'\x16a6a', U'\x16a6d', idna_status::disallowed},
-    {U'\x16abf', U'\x16abf', idna_status::disallowed},
-    {U'\x16aca', U'\x16acf', idna_status::disallowed},
-    {U'\x16aee', U'\x16aef', idna_status::disallowed},
-    {U'\x16af6', U'\x16aff', idna_status::disallowed},
-    {U'\x16b46', U'\x16b4f', idna_status::disallowed},
-    {U'\x16b5a', U'\x16b5a', idna_status::disallowed},
-    {U'\x16b62', U'\x16b62', idna_status::disallowed},
-    {U'\x16b78', U'\x16b7c', idna_status::disallowed},
-    {U'\x16b90', U'\x16e3f', idna_status::disallowed},
-    {U'\x16e40', U'\x16e40', idna_status::mapped},
-    {U'\x16e41', U'\x16e41', idna_status::mapped},
-    {U'\x16e42', U'\x16e42', idna_status::mapped},
-    {U'\x16e43', U'\x16e43', idna_status::mapped},
-    {U'\x16e44', U'\x16e44', idna_status::mapped},
-    {U'\x16e45', U'\x16e45', idna_status::mapped},
-    {U'\x16e46', U'\x16e46', idna_status::mapped},
-    {U'\x16e47', U'\x16e47', idna_status::mapped},
-    {U'\x16e48', U'\x16e48', idna_status::mapped},
-    {U'\x16e49', U'\x16e49', idna_status::mapped},
-    {U'\x16e4a', U'\x16e4a', idna_status::mapped},
-    {U'\x16e4b', U'\x16e4b', idna_status::mapped},
-    {U'\x16e4c', U'\x16e4c', idna_status::mapped},
-    {U'\x16e4d', U'\x16e4d', idna_status::mapped},
-    {U'\x16e4e', U'\x16e4e', idna_status::mapped},
-    {U'\x16e4f', U'\x16e4f', idna_status::mapped},
-    {U'\x16e50', U'\x16e50', idna_status::mapped},
-    {U'\x16e51', U'\x16e51', idna_status::mapped},
-    {U'\x16e52', U'\x16e52', idna_status::mapped},
-    {U'\x16e53', U'\x16e53', idna_status::mapped},
-    {U'\x16e54', U'\x16e54', idna_status::mapped},
-    {U'\x16e55', U'\x16e55', idna_status::mapped},
-    {U'\x16e56', U'\x16e56', idna_status::mapped},
-    {U'\x16e57', U'\x16e57', idna_status::mapped},
-    {U'\x16e58', U'\x16e58', idna_status::mapped},
-    {U'\x16e59', U'\x16e59', idna_status::mapped},
-    {U'\x16e5a', U'\x16e5a', idna_status::mapped},
-    {U'\x16e5b', U'\x16e5b', idna_status::mapped},
-    {U'\x16e5c', U'\x16e5c', idna_status::mapped},
-    {U'\x16e5d', U'\x16e5d', idna_status::mapped},
-    {U'\x16e5e', U'\x16e5e', idna_status::mapped},
-    {U'\x16e5f', U'\x16e5f', idna_status::mapped},
-    {U'\x16e9b', U'\x16eff', idna_status::disallowed},
-    {U'\x16f4b', U'\x16f4e', idna_status::disallowed},
-    {U'\x16f88', U'\x16f8e', idna_status::disallowed},
-    {U'\x16fa0', U'\x16fdf', idna_status::disallowed},
-    {U'\x16fe5', U'\x16fef', idna_status::disallowed},
-    {U'\x16ff2', U'\x16fff', idna_status::disallowed},
-    {U'\x187f8', U'\x187ff', idna_status::disallowed},
-    {U'\x18cd6', U'\x18cff', idna_status::disallowed},
-    {U'\x18d09', U'\x1afef', idna_status::disallowed},
-    {U'\x1aff4', U'\x1aff4', idna_status::disallowed},
-    {U'\x1affc', U'\x1affc', idna_status::disallowed},
-    {U'\x1afff', U'\x1afff', idna_status::disallowed},
-    {U'\x1b123', U'\x1b131', idna_status::disallowed},
-    {U'\x1b133', U'\x1b14f', idna_status::disallowed},
-    {U'\x1b153', U'\x1b154', idna_status::disallowed},
-    {U'\x1b156', U'\x1b163', idna_status::disallowed},
-    {U'\x1b168', U'\x1b16f', idna_status::disallowed},
-    {U'\x1b2fc', U'\x1bbff', idna_status::disallowed},
-    {U'\x1bc6b', U'\x1bc6f', idna_status::disallowed},
-    {U'\x1bc7d', U'\x1bc7f', idna_status::disallowed},
-    {U'\x1bc89', U'\x1bc8f', idna_status::disallowed},
-    {U'\x1bc9a', U'\x1bc9b', idna_status::disallowed},
-    {U'\x1bca0', U'\x1bca3', idna_status::ignored},
-    {U'\x1bca4', U'\x1ceff', idna_status::disallowed},
-    {U'\x1cf2e', U'\x1cf2f', idna_status::disallowed},
-    {U'\x1cf47', U'\x1cf4f', idna_status::disallowed},
-    {U'\x1cfc4', U'\x1cfff', idna_status::disallowed},
-    {U'\x1d0f6', U'\x1d0ff', idna_status::disallowed},
-    {U'\x1d127', U'\x1d128', idna_status::disallowed},
-    {U'\x1d15e', U'\x1d15e', idna_status::mapped},
-    {U'\x1d15f', U'\x1d15f', idna_status::mapped},
-    {U'\x1d160', U'\x1d160', idna_status::mapped},
-    {U'\x1d161', U'\x1d161', idna_status::mapped},
-    {U'\x1d162', U'\x1d162', idna_status::mapped},
-    {U'\x1d163', U'\x1d163', idna_status::mapped},
-    {U'\x1d164', U'\x1d164', idna_status::mapped},
-    {U'\x1d173', U'\x1d17a', idna_status::disallowed},
-    {U'\x1d1bb', U'\x1d1bb', idna_status::mapped},
-    {U'\x1d1bc', U'\x1d1bc', idna_status::mapped},
-    {U'\x1d1bd', U'\x1d1bd', idna_status::mapped},
-    {U'\x1d1be', U'\x1d1be', idna_status::mapped},
-    {U'\x1d1bf', U'\x1d1bf', idna_status::mapped},
-    {U'\x1d1c0', U'\x1d1c0', idna_status::mapped},
-    {U'\x1d1eb', U'\x1d1ff', idna_status::disallowed},
-    {U'\x1d246', U'\x1d2bf', idna_status::disallowed},
-    {U'\x1d2d4', U'\x1d2df', idna_status::disallowed},
-    {U'\x1d2f4', U'\x1d2ff', idna_status::disallowed},
-    {U'\x1d357', U'\x1d35f', idna_status::disallowed},
-    {U'\x1d379', U'\x1d3ff', idna_status::disallowed},
-    {U'\x1d400', U'\x1d400', idna_status::mapped},
-    {U'\x1d401', U'\x1d401', idna_status::mapped},
-    {U'\x1d402', U'\x1d402', idna_status::mapped},
-    {U'\x1d403', U'\x1d403', idna_status::mapped},
-    {U'\x1d404', U'\x1d404', idna_status::mapped},
-    {U'\x1d405', U'\x1d405', idna_status::mapped},
-    {U'\x1d406', U'\x1d406', idna_status::mapped},
-    {U'\x1d407', U'\x1d407', idna_status::mapped},
-    {U'\x1d408', U'\x1d408', idna_status::mapped},
-    {U'\x1d409', U'\x1d409', idna_status::mapped},
-    {U'\x1d40a', U'\x1d40a', idna_status::mapped},
-    {U'\x1d40b', U'\x1d40b', idna_status::mapped},
-    {U'\x1d40c', U'\x1d40c', idna_status::mapped},
-    {U'\x1d40d', U'\x1d40d', idna_status::mapped},
-    {U'\x1d40e', U'\x1d40e', idna_status::mapped},
-    {U'\x1d40f', U'\x1d40f', idna_status::mapped},
-    {U'\x1d410', U'\x1d410', idna_status::mapped},
-    {U'\x1d411', U'\x1d411', idna_status::mapped},
-    {U'\x1d412', U'\x1d412', idna_status::mapped},
-    {U'\x1d413', U'\x1d413', idna_status::mapped},
-    {U'\x1d414', U'\x1d414', idna_status::mapped},
-    {U'\x1d415', U'\x1d415', idna_status::mapped},
-    {U'\x1d416', U'\x1d416', idna_status::mapped},
-    {U'\x1d417', U'\x1d417', idna_status::mapped},
-    {U'\x1d418', U'\x1d418', idna_status::mapped},
-    {U'\x1d419', U'\x1d419', idna_status::mapped},
-    {U'\x1d41a', U'\x1d41a', idna_status::mapped},
-    {U'\x1d41b', U'\x1d41b', idna_status::mapped},
-    {U'\x1d41c', U'\x1d41c', idna_status::mapped},
-    {U'\x1d41d', U'\x1d41d', idna_status::mapped},
-    {U'\x1d41e', U'\x1d41e', idna_status::mapped},
-    {U'\x1d41f', U'\x1d41f', idna_status::mapped},
-    {U'\x1d420', U'\x1d420', idna_status::mapped},
-    {U'\x1d421', U'\x1d421', idna_status::mapped},
-    {U'\x1d422', U'\x1d422', idna_status::mapped},
-    {U'\x1d423', U'\x1d423', idna_status::mapped},
-    {U'\x1d424', U'\x1d424', idna_status::mapped},
-    {U'\x1d425', U'\x1d425', idna_status::mapped},
-    {U'\x1d426', U'\x1d426', idna_status::mapped},
-    {U'\x1d427', U'\x1d427', idna_status::mapped},
-    {U'\x1d428', U'\x1d428', idna_status::mapped},
-    {U'\x1d429', U'\x1d429', idna_status::mapped},
-    {U'\x1d42a', U'\x1d42a', idna_status::mapped},
-    {U'\x1d42b', U'\x1d42b', idna_status::mapped},
-    {U'\x1d42c', U'\x1d42c', idna_status::mapped},
-    {U'\x1d42d', U'\x1d42d', idna_status::mapped},
-    {U'\x1d42e', U'\x1d42e', idna_status::mapped},
-    {U'\x1d42f', U'\x1d42f', idna_status::mapped},
-    {U'\x1d430', U'\x1d430', idna_status::mapped},
-    {U'\x1d431', U'\x1d431', idna_status::mapped},
-    {U'\x1d432', U'\x1d432', idna_status::mapped},
-    {U'\x1d433', U'\x1d433', idna_status::mapped},
-    {U'\x1d434', U'\x1d434', idna_status::mapped},
-    {U'\x1d435', U'\x1d435', idna_status::mapped},
-    {U'\x1d436', U'\x1d436', idna_status::mapped},
-    {U'\x1d437', U'\x1d437', idna_status::mapped},
-    {U'\x1d438', U'\x1d438', idna_status::mapped},
-    {U'\x1d439', U'\x1d439', idna_status::mapped},
-    {U'\x1d43a', U'\x1d43a', idna_status::mapped},
-    {U'\x1d43b', U'\x1d43b', idna_status::mapped},
-    {U'\x1d43c', U'\x1d43c', idna_status::mapped},
-    {U'\x1d43d', U'\x1d43d', idna_status::mapped},
-    {U'\x1d43e', U'\x1d43e', idna_status::mapped},
-    {U'\x1d43f', U'\x1d43f', idna_status::mapped},
-    {U'\x1d440', U'\x1d440', idna_status::mapped},
-    {U'\x1d441', U'\x1d441', idna_status::mapped},
-    {U'\x1d442', U'\x1d442', idna_status::mapped},
-    {U'\x1d443', U'\x1d443', idna_status::mapped},
-    {U'\x1d444', U'\x1d444', idna_status::mapped},
-    {U'\x1d445', U'\x1d445', idna_status::mapped},
-    {U'\x1d446', U'\x1d446', idna_status::mapped},
-    {U'\x1d447', U'\x1d447', idna_status::mapped},
-    {U'\x1d448', U'\x1d448', idna_status::mapped},
-    {U'\x1d449', U'\x1d449', idna_status::mapped},
-    {U'\x1d44a', U'\x1d44a', idna_status::mapped},
-    {U'\x1d44b', U'\x1d44b', idna_status::mapped},
-    {U'\x1d44c', U'\x1d44c', idna_status::mapped},
-    {U'\x1d44d', U'\x1d44d', idna_status::mapped},
-    {U'\x1d44e', U'\x1d44e', idna_status::mapped},
-    {U'\x1d44f', U'\x1d44f', idna_status::mapped},
-    {U'\x1d450', U'\x1d450', idna_status::mapped},
-    {U'\x1d451', U'\x1d451', idna_status::mapped},
-    {U'\x1d452', U'\x1d452', idna_status::mapped},
-    {U'\x1d453', U'\x1d453', idna_status::mapped},
-    {U'\x1d454', U'\x1d454', idna_status::mapped},
-    {U'\x1d455', U'\x1d455', idna_status::disallowed},
-    {U'\x1d456', U'\x1d456', idna_status::mapped},
-    {U'\x1d457', U'\x1d457', idna_status::mapped},
-    {U'\x1d458', U'\x1d458', idna_status::mapped},
-    {U'\x1d459', U'\x1d459', idna_status::mapped},
-    {U'\x1d45a', U'\x1d45a', idna_status::mapped},
-    {U'\x1d45b', U'\x1d45b', idna_status::mapped},
-    {U'\x1d45c', U'\x1d45c', idna_status::mapped},
-    {U'\x1d45d', U'\x1d45d', idna_status::mapped},
-    {U'\x1d45e', U'\x1d45e', idna_status::mapped},
-    {U'\x1d45f', U'\x1d45f', idna_status::mapped},
-    {U'\x1d460', U'\x1d460', idna_status::mapped},
-    {U'\x1d461', U'\x1d461', idna_status::mapped},
-    {U'\x1d462', U'\x1d462', idna_status::mapped},
-    {U'\x1d463', U'\x1d463', idna_status::mapped},
-    {U'\x1d464', U'\x1d464', idna_status::mapped},
-    {U'\x1d465', U'\x1d465', idna_status::mapped},
-    {U'\x1d466', U'\x1d466', idna_status::mapped},
-    {U'\x1d467', U'\x1d467', idna_status::mapped},
-    {U'\x1d468', U'\x1d468', idna_status::mapped},
-    {U'\x1d469', U'\x1d469', idna_status::mapped},
-    {U'\x1d46a', U'\x1d46a', idna_status::mapped},
-    {U'\x1d46b', U'\x1d46b', idna_status::mapped},
-    {U'\x1d46c', U'\x1d46c', idna_status::mapped},
-    {U'\x1d46d', U'\x1d46d', idna_status::mapped},
-    {U'\x1d46e', U'\x1d46e', idna_status::mapped},
-    {U'\x1d46f', U'\x1d46f', idna_status::mapped},
-    {U'\x1d470', U'\x1d470', idna_status::mapped},
-    {U'\x1d471', U'\x1d471', idna_status::mapped},
-    {U'\x1d472', U'\x1d472', idna_status::mapped},
-    {U'\x1d473', U'\x1d473', idna_status::mapped},
-    {U'\x1d474', U'\x1d474', idna_status::mapped},
-    {U'\x1d475', U'\x1d475', idna_status::mapped},
-    {U'\x1d476', U'\x1d476', idna_status::mapped},
-    {U'\x1d477', U'\x1d477', idna_status::mapped},
-    {U'\x1d478', U'\x1d478', idna_status::mapped},
-    {U'\x1d479', U'\x1d479', idna_status::mapped},
-    {U'\x1d47a', U'\x1d47a', idna_status::mapped},
-    {U'\x1d47b', U'\x1d47b', idna_status::mapped},
-    {U'\x1d47c', U'\x1d47c', idna_status::mapped},
-    {U'\x1d47d', U'\x1d47d', idna_status::mapped},
-    {U'\x1d47e', U'\x1d47e', idna_status::mapped},
-    {U'\x1d47f', U'\x1d47f', idna_status::mapped},
-    {U'\x1d480', U'\x1d480', idna_status::mapped},
-    {U'\x1d481', U'\x1d481', idna_status::mapped},
-    {U'\x1d482', U'\x1d482', idna_status::mapped},
-    {U'\x1d483', U'\x1d483', idna_status::mapped},
-    {U'\x1d484', U'\x1d484', idna_status::mapped},
-    {U'\x1d485', U'\x1d485', idna_status::mapped},
-    {U'\x1d486', U'\x1d486', idna_status::mapped},
-    {U'\x1d487', U'\x1d487', idna_status::mapped},
-    {U'\x1d488', U'\x1d488', idna_status::mapped},
-    {U'\x1d489', U'\x1d489', idna_status::mapped},
-    {U'\x1d48a', U'\x1d48a', idna_status::mapped},
-    {U'\x1d48b', U'\x1d48b', idna_status::mapped},
-    {U'\x1d48c', U'\x1d48c', idna_status::mapped},
-    {U'\x1d48d', U'\x1d48d', idna_status::mapped},
-    {U'\x1d48e', U'\x1d48e', idna_status::mapped},
-    {U'\x1d48f', U'\x1d48f', idna_status::mapped},
-    {U'\x1d490', U'\x1d490', idna_status::mapped},
-    {U'\x1d491', U'\x1d491', idna_status::mapped},
-    {U'\x1d492', U'\x1d492', idna_status::mapped},
-    {U'\x1d493', U'\x1d493', idna_status::mapped},
-    {U'\x1d494', U'\x1d494', idna_status::mapped},
-    {U'\x1d495', U'\x1d495', idna_status::mapped},
-    {U'\x1d496', U'\x1d496', idna_status::mapped},
-    {U'\x1d497', U'\x1d497', idna_status::mapped},
-    {U'\x1d498', U'\x1d498', idna_status::mapped},
-    {U'\x1d499', U'\x1d499', idna_status::mapped},
-    {U'\x1d49a', U'\x1d49a', idna_status::mapped},
-    {U'\x1d49b', U'\x1d49b', idna_status::mapped},
-    {U'\x1d49c', U'\x1d49c', idna_status::mapped},
-    {U'\x1d49d', U'\x1d49d', idna_status::disallowed},
-    {U'\x1d49e', U'\x1d49e', idna_status::mapped},
-    {U'\x1d49f', U'\x1d49f', idna_status::mapped},
-    {U'\x1d4a0', U'\x1d4a1', idna_status::disallowed},
-    {U'\x1d4a2', U'\x1d4a2', idna_status::mapped},
-    {U'\x1d4a3', U'\x1d4a4', idna_status::disallowed},
-    {U'\x1d4a5', U'\x1d4a5', idna_status::mapped},
-    {U'\x1d4a6', U'\x1d4a6', idna_status::mapped},
-    {U'\x1d4a7', U'\x1d4a8', idna_status::disallowed},
-    {U'\x1d4a9', U'\x1d4a9', idna_status::mapped},
-    {U'\x1d4aa', U'\x1d4aa', idna_status::mapped},
-    {U'\x1d4ab', U'\x1d4ab', idna_status::mapped},
-    {U'\x1d4ac', U'\x1d4ac', idna_status::mapped},
-    {U'\x1d4ad', U'\x1d4ad', idna_status::disallowed},
-    {U'\x1d4ae', U'\x1d4ae', idna_status::mapped},
-    {U'\x1d4af', U'\x1d4af', idna_status::mapped},
-    {U'\x1d4b0', U'\x1d4b0', idna_status::mapped},
-    {U'\x1d4b1', U'\x1d4b1', idna_status::mapped},
-    {U'\x1d4b2', U'\x1d4b2', idna_status::mapped},
-    {U'\x1d4b3', U'\x1d4b3', idna_status::mapped},
-    {U'\x1d4b4', U'\x1d4b4', idna_status::mapped},
-    {U'\x1d4b5', U'\x1d4b5', idna_status::mapped},
-    {U'\x1d4b6', U'\x1d4b6', idna_status::mapped},
-    {U'\x1d4b7', U'\x1d4b7', idna_status::mapped},
-    {U'\x1d4b8', U'\x1d4b8', idna_status::mapped},
-    {U'\x1d4b9', U'\x1d4b9', idna_status::mapped},
-    {U'\x1d4ba', U'\x1d4ba', idna_status::disallowed},
-    {U'\x1d4bb', U'\x1d4bb', idna_status::mapped},
-    {U'\x1d4bc', U'\x1d4bc', idna_status::disallowed},
-    {U'\x1d4bd', U'\x1d4bd', idna_status::mapped},
-    {U'\x1d4be', U'\x1d4be', idna_status::mapped},
-    {U'\x1d4bf', U'\x1d4bf', idna_status::mapped},
-    {U'\x1d4c0', U'\x1d4c0', idna_status::mapped},
-    {U'\x1d4c1', U'\x1d4c1', idna_status::mapped},
-    {U'\x1d4c2', U'\x1d4c2', idna_status::mapped},
-    {U'\x1d4c3', U'\x1d4c3', idna_status::mapped},
-    {U'\x1d4c4', U'\x1d4c4', idna_status::disallowed},
-    {U'\x1d4c5', U'\x1d4c5', idna_status::mapped},
-    {U'\x1d4c6', U'\x1d4c6', idna_status::mapped},
-    {U'\x1d4c7', U'\x1d4c7', idna_status::mapped},
-    {U'\x1d4c8', U'\x1d4c8', idna_status::mapped},
-    {U'\x1d4c9', U'\x1d4c9', idna_status::mapped},
-    {U'\x1d4ca', U'\x1d4ca', idna_status::mapped},
-    {U'\x1d4cb', U'\x1d4cb', idna_status::mapped},
-    {U'\x1d4cc', U'\x1d4cc', idna_status::mapped},
-    {U'\x1d4cd', U'\x1d4cd', idna_status::mapped},
-    {U'\x1d4ce', U'\x1d4ce', idna_status::mapped},
-    {U'\x1d4cf', U'\x1d4cf', idna_status::mapped},
-    {U'\x1d4d0', U'\x1d4d0', idna_status::mapped},
-    {U'\x1d4d1', U'\x1d4d1', idna_status::mapped},
-    {U'\x1d4d2', U'\x1d4d2', idna_status::mapped},
-    {U'\x1d4d3', U'\x1d4d3', idna_status::mapped},
-    {U'\x1d4d4', U'\x1d4d4', idna_status::mapped},
-    {U'\x1d4d5', U'\x1d4d5', idna_status::mapped},
-    {U'\x1d4d6', U'\x1d4d6', idna_status::mapped},
-    {U'\x1d4d7', U'\x1d4d7', idna_status::mapped},
-    {U'\x1d4d8', U'\x1d4d8', idna_status::mapped},
-    {U'\x1d4d9', U'\x1d4d9', idna_status::mapped},
-    {U'\x1d4da', U'\x1d4da', idna_status::mapped},
-    {U'\x1d4db', U'\x1d4db', idna_status::mapped},
-    {U'\x1d4dc', U'\x1d4dc', idna_status::mapped},
-    {U'\x1d4dd', U'\x1d4dd', idna_status::mapped},
-    {U'\x1d4de', U'\x1d4de', idna_status::mapped},
-    {U'\x1d4df', U'\x1d4df', idna_status::mapped},
-    {U'\x1d4e0', U'\x1d4e0', idna_status::mapped},
-    {U'\x1d4e1', U'\x1d4e1', idna_status::mapped},
-    {U'\x1d4e2', U'\x1d4e2', idna_status::mapped},
-    {U'\x1d4e3', U'\x1d4e3', idna_status::mapped},
-    {U'\x1d4e4', U'\x1d4e4', idna_status::mapped},
-    {U'\x1d4e5', U'\x1d4e5', idna_status::mapped},
-    {U'\x1d4e6', U'\x1d4e6', idna_status::mapped},
-    {U'\x1d4e7', U'\x1d4e7', idna_status::mapped},
-    {U'\x1d4e8', U'\x1d4e8', idna_status::mapped},
-    {U'\x1d4e9', U'\x1d4e9', idna_status::mapped},
-    {U'\x1d4ea', U'\x1d4ea', idna_status::mapped},
-    {U'\x1d4eb', U'\x1d4eb', idna_status::mapped},
-    {U'\x1d4ec', U'\x1d4ec', idna_status::mapped},
-    {U'\x1d4ed', U'\x1d4ed', idna_status::mapped},
-    {U'\x1d4ee', U'\x1d4ee', idna_status::mapped},
-    {U'\x1d4ef', U'\x1d4ef', idna_status::mapped},
-    {U'\x1d4f0', U'\x1d4f0', idna_status::mapped},
-    {U'\x1d4f1', U'\x1d4f1', idna_status::mapped},
-    {U'\x1d4f2', U'\x1d4f2', idna_status::mapped},
-    {U'\x1d4f3', U'\x1d4f3', idna_status::mapped},
-    {U'\x1d4f4', U'\x1d4f4', idna_status::mapped},
-    {U'\x1d4f5', U'\x1d4f5', idna_status::mapped},
-    {U'\x1d4f6', U'\x1d4f6', idna_status::mapped},
-    {U'\x1d4f7', U'\x1d4f7', idna_status::mapped},
-    {U'\x1d4f8', U'\x1d4f8', idna_status::mapped},
-    {U'\x1d4f9', U'\x1d4f9', idna_status::mapped},
-    {U'\x1d4fa', U'\x1d4fa', idna_status::mapped},
-    {U'\x1d4fb', U'\x1d4fb', idna_status::mapped},
-    {U'\x1d4fc', U'\x1d4fc', idna_status::mapped},
-    {U'\x1d4fd', U'\x1d4fd', idna_status::mapped},
-    {U'\x1d4fe', U'\x1d4fe', idna_status::mapped},
-    {U'\x1d4ff', U'\x1d4ff', idna_status::mapped},
-    {U'\x1d500', U'\x1d500', idna_status::mapped},
-    {U'\x1d501', U'\x1d501', idna_status::mapped},
-    {U'\x1d502', U'\x1d502', idna_status::mapped},
-    {U'\x1d503', U'\x1d503', idna_status::mapped},
-    {U'\x1d504', U'\x1d504', idna_status::mapped},
-    {U'\x1d505', U'\x1d505', idna_status::mapped},
-    {U'\x1d506', U'\x1d506', idna_status::disallowed},
-    {U'\x1d507', U'\x1d507', idna_status::mapped},
-    {U'\x1d508', U'\x1d508', idna_status::mapped},
-    {U'\x1d509', U'\x1d509', idna_status::mapped},
-    {U'\x1d50a', U'\x1d50a', idna_status::mapped},
-    {U'\x1d50b', U'\x1d50c', idna_status::disallowed},
-    {U'\x1d50d', U'\x1d50d', idna_status::mapped},
-    {U'\x1d50e', U'\x1d50e', idna_status::mapped},
-    {U'\x1d50f', U'\x1d50f', idna_status::mapped},
-    {U'\x1d510', U'\x1d510', idna_status::mapped},
-    {U'\x1d511', U'\x1d511', idna_status::mapped},
-    {U'\x1d512', U'\x1d512', idna_status::mapped},
-    {U'\x1d513', U'\x1d513', idna_status::mapped},
-    {U'\x1d514', U'\x1d514', idna_status::mapped},
-    {U'\x1d515', U'\x1d515', idna_status::disallowed},
-    {U'\x1d516', U'\x1d516', idna_status::mapped},
-    {U'\x1d517', U'\x1d517', idna_status::mapped},
-    {U'\x1d518', U'\x1d518', idna_status::mapped},
-    {U'\x1d519', U'\x1d519', idna_status::mapped},
-    {U'\x1d51a', U'\x1d51a', idna_status::mapped},
-    {U'\x1d51b', U'\x1d51b', idna_status::mapped},
-    {U'\x1d51c', U'\x1d51c', idna_status::mapped},
-    {U'\x1d51d', U'\x1d51d', idna_status::disallowed},
-    {U'\x1d51e', U'\x1d51e', idna_status::mapped},
-    {U'\x1d51f', U'\x1d51f', idna_status::mapped},
-    {U'\x1d520', U'\x1d520', idna_status::mapped},
-    {U'\x1d521', U'\x1d521', idna_status::mapped},
-    {U'\x1d522', U'\x1d522', idna_status::mapped},
-    {U'\x1d523', U'\x1d523', idna_status::mapped},
-    {U'\x1d524', U'\x1d524', idna_status::mapped},
-    {U'\x1d525', U'\x1d525', idna_status::mapped},
-    {U'\x1d526', U'\x1d526', idna_status::mapped},
-    {U'\x1d527', U'\x1d527', idna_status::mapped},
-    {U'\x1d528', U'\x1d528', idna_status::mapped},
-    {U'\x1d529', U'\x1d529', idna_status::mapped},
-    {U'\x1d52a', U'\x1d52a', idna_status::mapped},
-    {U'\x1d52b', U'\x1d52b', idna_status::mapped},
-    {U'\x1d52c', U'\x1d52c', idna_status::mapped},
-    {U'\x1d52d', U'\x1d52d', idna_status::mapped},
-    {U'\x1d52e', U'\x1d52e', idna_status::mapped},
-    {U'\x1d52f', U'\x1d52f', idna_status::mapped},
-    {U'\x1d530', U'\x1d530', idna_status::mapped},
-    {U'\x1d531', U'\x1d531', idna_status::mapped},
-    {U'\x1d532', U'\x1d532', idna_status::mapped},
-    {U'\x1d533', U'\x1d533', idna_status::mapped},
-    {U'\x1d534', U'\x1d534', idna_status::mapped},
-    {U'\x1d535', U'\x1d535', idna_status::mapped},
-    {U'\x1d536', U'\x1d536', idna_status::mapped},
-    {U'\x1d537', U'\x1d537', idna_status::mapped},
-    {U'\x1d538', U'\x1d538', idna_status::mapped},
-    {U'\x1d539', U'\x1d539', idna_status::mapped},
-    {U'\x1d53a', U'\x1d53a', idna_status::disallowed},
-    {U'\x1d53b', U'\x1d53b', idna_status::mapped},
-    {U'\x1d53c', U'\x1d53c', idna_status::mapped},
-    {U'\x1d53d', U'\x1d53d', idna_status::mapped},
-    {U'\x1d53e', U'\x1d53e', idna_status::mapped},
-    {U'\x1d53f', U'\x1d53f', idna_status::disallowed},
-    {U'\x1d540', U'\x1d540', idna_status::mapped},
-    {U'\x1d541', U'\x1d541', idna_status::mapped},
-    {U'\x1d542', U'\x1d542', idna_status::mapped},
-    {U'\x1d543', U'\x1d543', idna_status::mapped},
-    {U'\x1d544', U'\x1d544', idna_status::mapped},
-    {U'\x1d545', U'\x1d545', idna_status::disallowed},
-    {U'\x1d546', U'\x1d546', idna_status::mapped},
-    {U'\x1d547', U'\x1d549', idna_status::disallowed},
-    {U'\x1d54a', U'\x1d54a', idna_status::mapped},
-    {U'\x1d54b', U'\x1d54b', idna_status::mapped},
-    {U'\x1d54c', U'\x1d54c', idna_status::mapped},
-    {U'\x1d54d', U'\x1d54d', idna_status::mapped},
-    {U'\x1d54e', U'\x1d54e', idna_status::mapped},
-    {U'\x1d54f', U'\x1d54f', idna_status::mapped},
-    {U'\x1d550', U'\x1d550', idna_status::mapped},
-    {U'\x1d551', U'\x1d551', idna_status::disallowed},
-    {U'\x1d552', U'\x1d552', idna_status::mapped},
-    {U'\x1d553', U'\x1d553', idna_status::mapped},
-    {U'\x1d554', U'\x1d554', idna_status::mapped},
-    {U'\x1d555', U'\x1d555', idna_status::mapped},
-    {U'\x1d556', U'\x1d556', idna_status::mapped},
-    {U'\x1d557', U'\x1d557', idna_status::mapped},
-    {U'\x1d558', U'\x1d558', idna_status::mapped},
-    {U'\x1d559', U'\x1d559', idna_status::mapped},
-    {U'\x1d55a', U'\x1d55a', idna_status::mapped},
-    {U'\x1d55b', U'\x1d55b', idna_status::mapped},
-    {U'\x1d55c', U'\x1d55c', idna_status::mapped},
-    {U'\x1d55d', U'\x1d55d', idna_status::mapped},
-    {U'\x1d55e', U'\x1d55e', idna_status::mapped},
-    {U'\x1d55f', U'\x1d55f', idna_status::mapped},
-    {U'\x1d560', U'\x1d560', idna_status::mapped},
-    {U'\x1d561', U'\x1d561', idna_status::mapped},
-    {U'\x1d562', U'\x1d562', idna_status::mapped},
-    {U'\x1d563', U'\x1d563', idna_status::mapped},
-    {U'\x1d564', U'\x1d564', idna_status::mapped},
-    {U'\x1d565', U'\x1d565', idna_status::mapped},
-    {U'\x1d566', U'\x1d566', idna_status::mapped},
-    {U'\x1d567', U'\x1d567', idna_status::mapped},
-    {U'\x1d568', U'\x1d568', idna_status::mapped},
-    {U'\x1d569', U'\x1d569', idna_status::mapped},
-    {U'\x1d56a', U'\x1d56a', idna_status::mapped},
-    {U'\x1d56b', U'\x1d56b', idna_status::mapped},
-    {U'\x1d56c', U'\x1d56c', idna_status::mapped},
-    {U'\x1d56d', U'\x1d56d', idna_status::mapped},
-    {U'\x1d56e', U'\x1d56e', idna_status::mapped},
-    {U'\x1d56f', U'\x1d56f', idna_status::mapped},
-    {U'\x1d570', U'\x1d570', idna_status::mapped},
-    {U'\x1d571', U'\x1d571', idna_status::mapped},
-    {U'\x1d572', U'\x1d572', idna_status::mapped},
-    {U'\x1d573', U'\x1d573', idna_status::mapped},
-    {U'\x1d574', U'\x1d574', idna_status::mapped},
-    {U'\x1d575', U'\x1d575', idna_status::mapped},
-    {U'\x1d576', U'\x1d576', idna_status::mapped},
-    {U'\x1d577', U'\x1d577', idna_status::mapped},
-    {U'\x1d578', U'\x1d578', idna_status::mapped},
-    {U'\x1d579', U'\x1d579', idna_status::mapped},
-    {U'\x1d57a', U'\x1d57a', idna_status::mapped},
-    {U'\x1d57b', U'\x1d57b', idna_status::mapped},
-    {U'\x1d57c', U'\x1d57c', idna_status::mapped},
-    {U'\x1d57d', U'\x1d57d', idna_status::mapped},
-    {U'\x1d57e', U'\x1d57e', idna_status::mapped},
-    {U'\x1d57f', U'\x1d57f', idna_status::mapped},
-    {U'\x1d580', U'\x1d580', idna_status::mapped},
-    {U'\x1d581', U'\x1d581', idna_status::mapped},
-    {U'\x1d582', U'\x1d582', idna_status::mapped},
-    {U'\x1d583', U'\x1d583', idna_status::mapped},
-    {U'\x1d584', U'\x1d584', idna_status::mapped},
-    {U'\x1d585', U'\x1d585', idna_status::mapped},
-    {U'\x1d586', U'\x1d586', idna_status::mapped},
-    {U'\x1d587', U'\x1d587', idna_status::mapped},
-    {U'\x1d588', U'\x1d588', idna_status::mapped},
-    {U'\x1d589', U'\x1d589', idna_status::mapped},
-    {U'\x1d58a', U'\x1d58a', idna_status::mapped},
-    {U'\x1d58b', U'\x1d58b', idna_status::mapped},
-    {U'\x1d58c', U'\x1d58c', idna_status::mapped},
-    {U'\x1d58d', U'\x1d58d', idna_status::mapped},
-    {U'\x1d58e', U'\x1d58e', idna_status::mapped},
-    {U'\x1d58f', U'\x1d58f', idna_status::mapped},
-    {U'\x1d590', U'\x1d590', idna_status::mapped},
-    {U'\x1d591', U'\x1d591', idna_status::mapped},
-    {U'\x1d592', U'\x1d592', idna_status::mapped},
-    {U'\x1d593', U'\x1d593', idna_status::mapped},
-    {U'\x1d594', U'\x1d594', idna_status::mapped},
-    {U'\x1d595', U'\x1d595', idna_status::mapped},
-    {U'\x1d596', U'\x1d596', idna_status::mapped},
-    {U'\x1d597', U'\x1d597', idna_status::mapped},
-    {U'\x1d598', U'\x1d598', idna_status::mapped},
-    {U'\x1d599', U'\x1d599', idna_status::mapped},
-    {U'\x1d59a', U'\x1d59a', idna_status::mapped},
-    {U'\x1d59b', U'\x1d59b', idna_status::mapped},
-    {U'\x1d59c', U'\x1d59c', idna_status::mapped},
-    {U'\x1d59d', U'\x1d59d', idna_status::mapped},
-    {U'\x1d59e', U'\x1d59e', idna_status::mapped},
-    {U'\x1d59f', U'\x1d59f', idna_status::mapped},
-    {U'\x1d5a0', U'\x1d5a0', idna_status::mapped},
-    {U'\x1d5a1', U'\x1d5a1', idna_status::mapped},
-    {U'\x1d5a2', U'\x1d5a2', idna_status::mapped},
-    {U'\x1d5a3', U'\x1d5a3', idna_status::mapped},
-    {U'\x1d5a4', U'\x1d5a4', idna_status::mapped},
-    {U'\x1d5a5', U'\x1d5a5', idna_status::mapped},
-    {U'\x1d5a6', U'\x1d5a6', idna_status::mapped},
-    {U'\x1d5a7', U'\x1d5a7', idna_status::mapped},
-    {U'\x1d5a8', U'\x1d5a8', idna_status::mapped},
-    {U'\x1d5a9', U'\x1d5a9', idna_status::mapped},
-    {U'\x1d5aa', U'\x1d5aa', idna_status::mapped},
-    {U'\x1d5ab', U'\x1d5ab', idna_status::mapped},
-    {U'\x1d5ac', U'\x1d5ac', idna_status::mapped},
-    {U'\x1d5ad', U'\x1d5ad', idna_status::mapped},
-    {U'\x1d5ae', U'\x1d5ae', idna_status::mapped},
-    {U'\x1d5af', U'\x1d5af', idna_status::mapped},
-    {U'\x1d5b0', U'\x1d5b0', idna_status::mapped},
-    {U'\x1d5b1', U'\x1d5b1', idna_status::mapped},
-    {U'\x1d5b2', U'\x1d5b2', idna_status::mapped},
-    {U'\x1d5b3', U'\x1d5b3', idna_status::mapped},
-    {U'\x1d5b4', U'\x1d5b4', idna_status::mapped},
-    {U'\x1d5b5', U'\x1d5b5', idna_status::mapped},
-    {U'\x1d5b6', U'\x1d5b6', idna_status::mapped},
-    {U'\x1d5b7', U'\x1d5b7', idna_status::mapped},
-    {U'\x1d5b8', U'\x1d5b8', idna_status::mapped},
-    {U'\x1d5b9', U'\x1d5b9', idna_status::mapped},
-    {U'\x1d5ba', U'\x1d5ba', idna_status::mapped},
-    {U'\x1d5bb', U'\x1d5bb', idna_status::mapped},
-    {U'\x1d5bc', U'\x1d5bc', idna_status::mapped},
-    {U'\x1d5bd', U'\x1d5bd', idna_status::mapped},
-    {U'\x1d5be', U'\x1d5be', idna_status::mapped},
-    {U'\x1d5bf', U'\x1d5bf', idna_status::mapped},
-    {U'\x1d5c0', U'\x1d5c0', idna_status::mapped},
-    {U'\x1d5c1', U'\x1d5c1', idna_status::mapped},
-    {U'\x1d5c2', U'\x1d5c2', idna_status::mapped},
-    {U'\x1d5c3', U'\x1d5c3', idna_status::mapped},
-    {U'\x1d5c4', U'\x1d5c4', idna_status::mapped},
-    {U'\x1d5c5', U'\x1d5c5', idna_status::mapped},
-    {U'\x1d5c6', U'\x1d5c6', idna_status::mapped},
-    {U'\x1d5c7', U'\x1d5c7', idna_status::mapped},
-    {U'\x1d5c8', U'\x1d5c8', idna_status::mapped},
-    {U'\x1d5c9', U'\x1d5c9', idna_status::mapped},
-    {U'\x1d5ca', U'\x1d5ca', idna_status::mapped},
-    {U'\x1d5cb', U'\x1d5cb', idna_status::mapped},
-    {U'\x1d5cc', U'\x1d5cc', idna_status::mapped},
-    {U'\x1d5cd', U'\x1d5cd', idna_status::mapped},
-    {U'\x1d5ce', U'\x1d5ce', idna_status::mapped},
-    {U'\x1d5cf', U'\x1d5cf', idna_status::mapped},
-    {U'\x1d5d0', U'\x1d5d0', idna_status::mapped},
-    {U'\x1d5d1', U'\x1d5d1', idna_status::mapped},
-    {U'\x1d5d2', U'\x1d5d2', idna_status::mapped},
-    {U'\x1d5d3', U'\x1d5d3', idna_status::mapped},
-    {U'\x1d5d4', U'\x1d5d4', idna_status::mapped},
-    {U'\x1d5d5', U'\x1d5d5', idna_status::mapped},
-    {U'\x1d5d6', U'\x1d5d6', idna_status::mapped},
-    {U'\x1d5d7', U'\x1d5d7', idna_status::mapped},
-    {U'\x1d5d8', U'\x1d5d8', idna_status::mapped},
-    {U'\x1d5d9', U'\x1d5d9', idna_status::mapped},
-    {U'\x1d5da', U'\x1d5da', idna_status::mapped},
-    {U'\x1d5db', U'\x1d5db', idna_status::mapped},
-    {U'\x1d5dc', U'\x1d5dc', idna_status::mapped},
-    {U'\x1d5dd', U'\x1d5dd', idna_status::mapped},
-    {U'\x1d5de', U'\x1d5de', idna_status::mapped},
-    {U'\x1d5df', U'\x1d5df', idna_status::mapped},
-    {U'\x1d5e0', U'\x1d5e0', idna_status::mapped},
-    {U'\x1d5e1', U'\x1d5e1', idna_status::mapped},
-    {U'\x1d5e2', U'\x1d5e2', idna_status::mapped},
-    {U'\x1d5e3', U'\x1d5e3', idna_status::mapped},
-    {U'\x1d5e4', U'\x1d5e4', idna_status::mapped},
-    {U'\x1d5e5', U'\x1d5e5', idna_status::mapped},
-    {U'\x1d5e6', U'\x1d5e6', idna_status::mapped},
-    {U'\x1d5e7', U'\x1d5e7', idna_status::mapped},
-    {U'\x1d5e8', U'\x1d5e8', idna_status::mapped},
-    {U'\x1d5e9', U'\x1d5e9', idna_status::mapped},
-    {U'\x1d5ea', U'\x1d5ea', idna_status::mapped},
-    {U'\x1d5eb', U'\x1d5eb', idna_status::mapped},
-    {U'\x1d5ec', U'\x1d5ec', idna_status::mapped},
-    {U'\x1d5ed', U'\x1d5ed', idna_status::mapped},
-    {U'\x1d5ee', U'\x1d5ee', idna_status::mapped},
-    {U'\x1d5ef', U'\x1d5ef', idna_status::mapped},
-    {U'\x1d5f0', U'\x1d5f0', idna_status::mapped},
-    {U'\x1d5f1', U'\x1d5f1', idna_status::mapped},
-    {U'\x1d5f2', U'\x1d5f2', idna_status::mapped},
-    {U'\x1d5f3', U'\x1d5f3', idna_status::mapped},
-    {U'\x1d5f4', U'\x1d5f4', idna_status::mapped},
-    {U'\x1d5f5', U'\x1d5f5', idna_status::mapped},
-    {U'\x1d5f6', U'\x1d5f6', idna_status::mapped},
-    {U'\x1d5f7', U'\x1d5f7', idna_status::mapped},
-    {U'\x1d5f8', U'\x1d5f8', idna_status::mapped},
-    {U'\x1d5f9', U'\x1d5f9', idna_status::mapped},
-    {U'\x1d5fa', U'\x1d5fa', idna_status::mapped},
-    {U'\x1d5fb', U'\x1d5fb', idna_status::mapped},
-    {U'\x1d5fc', U'\x1d5fc', idna_status::mapped},
-    {U'\x1d5fd', U'\x1d5fd', idna_status::mapped},
-    {U'\x1d5fe', U'\x1d5fe', idna_status::mapped},
-    {U'\x1d5ff', U'\x1d5ff', idna_status::mapped},
-    {U'\x1d600', U'\x1d600', idna_status::mapped},
-    {U'\x1d601', U'\x1d601', idna_status::mapped},
-    {U'\x1d602', U'\x1d602', idna_status::mapped},
-    {U'\x1d603', U'\x1d603', idna_status::mapped},
-    {U'\x1d604', U'\x1d604', idna_status::mapped},
-    {U'\x1d605', U'\x1d605', idna_status::mapped},
-    {U'\x1d606', U'\x1d606', idna_status::mapped},
-    {U'\x1d607', U'\x1d607', idna_status::mapped},
-    {U'\x1d608', U'\x1d608', idna_status::mapped},
-    {U'\x1d609', U'\x1d609', idna_status::mapped},
-    {U'\x1d60a', U'\x1d60a', idna_status::mapped},
-    {U'\x1d60b', U'\x1d60b', idna_status::mapped},
-    {U'\x1d60c', U'\x1d60c', idna_status::mapped},
-    {U'\x1d60d', U'\x1d60d', idna_status::mapped},
-    {U'\x1d60e', U'\x1d60e', idna_status::mapped},
-    {U'\x1d60f', U'\x1d60f', idna_status::mapped},
-    {U'\x1d610', U'\x1d610', idna_status::mapped},
-    {U'\x1d611', U'\x1d611', idna_status::mapped},
-    {U'\x1d612', U'\x1d612', idna_status::mapped},
-    {U'\x1d613', U'\x1d613', idna_status::mapped},
-    {U'\x1d614', U'\x1d614', idna_status::mapped},
-    {U'\x1d615', U'\x1d615', idna_status::mapped},
-    {U'\x1d616', U'\x1d616', idna_status::mapped},
-    {U'\x1d617', U'\x1d617', idna_status::mapped},
-    {U'\x1d618', U'\x1d618', idna_status::mapped},
-    {U'\x1d619', U'\x1d619', idna_status::mapped},
-    {U'\x1d61a', U'\x1d61a', idna_status::mapped},
-    {U'\x1d61b', U'\x1d61b', idna_status::mapped},
-    {U'\x1d61c', U'\x1d61c', idna_status::mapped},
-    {U'\x1d61d', U'\x1d61d', idna_status::mapped},
-    {U'\x1d61e', U'\x1d61e', idna_status::mapped},
-    {U'\x1d61f', U'\x1d61f', idna_status::mapped},
-    {U'\x1d620', U'\x1d620', idna_status::mapped},
-    {U'\x1d621', U'\x1d621', idna_status::mapped},
-    {U'\x1d622', U'\x1d622', idna_status::mapped},
-    {U'\x1d623', U'\x1d623', idna_status::mapped},
-    {U'\x1d624', U'\x1d624', idna_status::mapped},
-    {U'\x1d625', U'\x1d625', idna_status::mapped},
-    {U'\x1d626', U'\x1d626', idna_status::mapped},
-    {U'\x1d627', U'\x1d627', idna_status::mapped},
-    {U'\x1d628', U'\x1d628', idna_status::mapped},
-    {U'\x1d629', U'\x1d629', idna_status::mapped},
-    {U'\x1d62a', U'\x1d62a', idna_status::mapped},
-    {U'\x1d62b', U'\x1d62b', idna_status::mapped},
-    {U'\x1d62c', U'\x1d62c', idna_status::mapped},
-    {U'\x1d62d', U'\x1d62d', idna_status::mapped},
-    {U'\x1d62e', U'\x1d62e', idna_status::mapped},
-    {U'\x1d62f', U'\x1d62f', idna_status::mapped},
-    {U'\x1d630', U'\x1d630', idna_status::mapped},
-    {U'\x1d631', U'\x1d631', idna_status::mapped},
-    {U'\x1d632', U'\x1d632', idna_status::mapped},
-    {U'\x1d633', U'\x1d633', idna_status::mapped},
-    {U'\x1d634', U'\x1d634', idna_status::mapped},
-    {U'\x1d635', U'\x1d635', idna_status::mapped},
-    {U'\x1d636', U'\x1d636', idna_status::mapped},
-    {U'\x1d637', U'\x1d637', idna_status::mapped},
-    {U'\x1d638', U'\x1d638', idna_status::mapped},
-    {U'\x1d639', U'\x1d639', idna_status::mapped},
-    {U'\x1d63a', U'\x1d63a', idna_status::mapped},
-    {U'\x1d63b', U'\x1d63b', idna_status::mapped},
-    {U'\x1d63c', U'\x1d63c', idna_status::mapped},
-    {U'\x1d63d', U'\x1d63d', idna_status::mapped},
-    {U'\x1d63e', U'\x1d63e', idna_status::mapped},
-    {U'\x1d63f', U'\x1d63f', idna_status::mapped},
-    {U'\x1d640', U'\x1d640', idna_status::mapped},
-    {U'\x1d641', U'\x1d641', idna_status::mapped},
-    {U'\x1d642', U'\x1d642', idna_status::mapped},
-    {U'\x1d643', U'\x1d643', idna_status::mapped},
-    {U'\x1d644', U'\x1d644', idna_status::mapped},
-    {U'\x1d645', U'\x1d645', idna_status::mapped},
-    {U'\x1d646', U'\x1d646', idna_status::mapped},
-    {U'\x1d647', U'\x1d647', idna_status::mapped},
-    {U'\x1d648', U'\x1d648', idna_status::mapped},
-    {U'\x1d649', U'\x1d649', idna_status::mapped},
-    {U'\x1d64a', U'\x1d64a', idna_status::mapped},
-    {U'\x1d64b', U'\x1d64b', idna_status::mapped},
-    {U'\x1d64c', U'\x1d64c', idna_status::mapped},
-    {U'\x1d64d', U'\x1d64d', idna_status::mapped},
-    {U'\x1d64e', U'\x1d64e', idna_status::mapped},
-    {U'\x1d64f', U'\x1d64f', idna_status::mapped},
-    {U'\x1d650', U'\x1d650', idna_status::mapped},
-    {U'\x1d651', U'\x1d651', idna_status::mapped},
-    {U'\x1d652', U'\x1d652', idna_status::mapped},
-    {U'\x1d653', U'\x1d653', idna_status::mapped},
-    {U'\x1d654', U'\x1d654', idna_status::mapped},
-    {U'\x1d655', U'\x1d655', idna_status::mapped},
-    {U'\x1d656', U'\x1d656', idna_status::mapped},
-    {U'\x1d657', U'\x1d657', idna_status::mapped},
-    {U'\x1d658', U'\x1d658', idna_status::mapped},
-    {U'\x1d659', U'\x1d659', idna_status::mapped},
-    {U'\x1d65a', U'\x1d65a', idna_status::mapped},
-    {U'\x1d65b', U'\x1d65b', idna_status::mapped},
-    {U'\x1d65c', U'\x1d65c', idna_status::mapped},
-    {U'\x1d65d', U'\x1d65d', idna_status::mapped},
-    {U'\x1d65e', U'\x1d65e', idna_status::mapped},
-    {U'\x1d65f', U'\x1d65f', idna_status::mapped},
-    {U'\x1d660', U'\x1d660', idna_status::mapped},
-    {U'\x1d661', U'\x1d661', idna_status::mapped},
-    {U'\x1d662', U'\x1d662', idna_status::mapped},
-    {U'\x1d663', U'\x1d663', idna_status::mapped},
-    {U'\x1d664', U'\x1d664', idna_status::mapped},
-    {U'\x1d665', U'\x1d665', idna_status::mapped},
-    {U'\x1d666', U'\x1d666', idna_status::mapped},
-    {U'\x1d667', U'\x1d667', idna_status::mapped},
-    {U'\x1d668', U'\x1d668', idna_status::mapped},
-    {U'\x1d669', U'\x1d669', idna_status::mapped},
-    {U'\x1d66a', U'\x1d66a', idna_status::mapped},
-    {U'\x1d66b', U'\x1d66b', idna_status::mapped},
-    {U'\x1d66c', U'\x1d66c', idna_status::mapped},
-    {U'\x1d66d', U'\x1d66d', idna_status::mapped},
-    {U'\x1d66e', U'\x1d66e', idna_status::mapped},
-    {U'\x1d66f', U'\x1d66f', idna_status::mapped},
-    {U'\x1d670', U'\x1d670', idna_status::mapped},
-    {U'\x1d671', U'\x1d671', idna_status::mapped},
-    {U'\x1d672', U'\x1d672', idna_status::mapped},
-    {U'\x1d673', U'\x1d673', idna_status::mapped},
-    {U'\x1d674', U'\x1d674', idna_status::mapped},
-    {U'\x1d675', U'\x1d675', idna_status::mapped},
-    {U'\x1d676', U'\x1d676', idna_status::mapped},
-    {U'\x1d677', U'\x1d677', idna_status::mapped},
-    {U'\x1d678', U'\x1d678', idna_status::mapped},
-    {U'\x1d679', U'\x1d679', idna_status::mapped},
-    {U'\x1d67a', U'\x1d67a', idna_status::mapped},
-    {U'\x1d67b', U'\x1d67b', idna_status::mapped},
-    {U'\x1d67c', U'\x1d67c', idna_status::mapped},
-    {U'\x1d67d', U'\x1d67d', idna_status::mapped},
-    {U'\x1d67e', U'\x1d67e', idna_status::mapped},
-    {U'\x1d67f', U'\x1d67f', idna_status::mapped},
-    {U'\x1d680', U'\x1d680', idna_status::mapped},
-    {U'\x1d681', U'\x1d681', idna_status::mapped},
-    {U'\x1d682', U'\x1d682', idna_status::mapped},
-    {U'\x1d683', U'\x1d683', idna_status::mapped},
-    {U'\x1d684', U'\x1d684', idna_status::mapped},
-    {U'\x1d685', U'\x1d685', idna_status::mapped},
-    {U'\x1d686', U'\x1d686', idna_status::mapped},
-    {U'\x1d687', U'\x1d687', idna_status::mapped},
-    {U'\x1d688', U'\x1d688', idna_status::mapped},
-    {U'\x1d689', U'\x1d689', idna_status::mapped},
-    {U'\x1d68a', U'\x1d68a', idna_status::mapped},
-    {U'\x1d68b', U'\x1d68b', idna_status::mapped},
-    {U'\x1d68c', U'\x1d68c', idna_status::mapped},
-    {U'\x1d68d', U'\x1d68d', idna_status::mapped},
-    {U'\x1d68e', U'\x1d68e', idna_status::mapped},
-    {U'\x1d68f', U'\x1d68f', idna_status::mapped},
-    {U'\x1d690', U'\x1d690', idna_status::mapped},
-    {U'\x1d691', U'\x1d691', idna_status::mapped},
-    {U'\x1d692', U'\x1d692', idna_status::mapped},
-    {U'\x1d693', U'\x1d693', idna_status::mapped},
-    {U'\x1d694', U'\x1d694', idna_status::mapped},
-    {U'\x1d695', U'\x1d695', idna_status::mapped},
-    {U'\x1d696', U'\x1d696', idna_status::mapped},
-    {U'\x1d697', U'\x1d697', idna_status::mapped},
-    {U'\x1d698', U'\x1d698', idna_status::mapped},
-    {U'\x1d699', U'\x1d699', idna_status::mapped},
-    {U'\x1d69a', U'\x1d69a', idna_status::mapped},
-    {U'\x1d69b', U'\x1d69b', idna_status::mapped},
-    {U'\x1d69c', U'\x1d69c', idna_status::mapped},
-    {U'\x1d69d', U'\x1d69d', idna_status::mapped},
-    {U'\x1d69e', U'\x1d69e', idna_status::mapped},
-    {U'\x1d69f', U'\x1d69f', idna_status::mapped},
-    {U'\x1d6a0', U'\x1d6a0', idna_status::mapped},
-    {U'\x1d6a1', U'\x1d6a1', idna_status::mapped},
-    {U'\x1d6a2', U'\x1d6a2', idna_status::mapped},
-    {U'\x1d6a3', U'\x1d6a3', idna_status::mapped},
-    {U'\x1d6a4', U'\x1d6a4', idna_status::mapped},
-    {U'\x1d6a5', U'\x1d6a5', idna_status::mapped},
-    {U'\x1d6a6', U'\x1d6a7', idna_status::disallowed},
-    {U'\x1d6a8', U'\x1d6a8', idna_status::mapped},
-    {U'\x1d6a9', U'\x1d6a9', idna_status::mapped},
-    {U'\x1d6aa', U'\x1d6aa', idna_status::mapped},
-    {U'\x1d6ab', U'\x1d6ab', idna_status::mapped},
-    {U'\x1d6ac', U'\x1d6ac', idna_status::mapped},
-    {U'\x1d6ad', U'\x1d6ad', idna_status::mapped},
-    {U'\x1d6ae', U'\x1d6ae', idna_status::mapped},
-    {U'\x1d6af', U'\x1d6af', idna_status::mapped},
-    {U'\x1d6b0', U'\x1d6b0', idna_status::mapped},
-    {U'\x1d6b1', U'\x1d6b1', idna_status::mapped},
-    {U'\x1d6b2', U'\x1d6b2', idna_status::mapped},
-    {U'\x1d6b3', U'\x1d6b3', idna_status::mapped},
-    {U'\x1d6b4', U'\x1d6b4', idna_status::mapped},
-    {U'\x1d6b5', U'\x1d6b5', idna_status::mapped},
-    {U'\x1d6b6', U'\x1d6b6', idna_status::mapped},
-    {U'\x1d6b7', U'\x1d6b7', idna_status::mapped},
-    {U'\x1d6b8', U'\x1d6b8', idna_status::mapped},
-    {U'\x1d6b9', U'\x1d6b9', idna_status::mapped},
-    {U'\x1d6ba', U'\x1d6ba', idna_status::mapped},
-    {U'\x1d6bb', U'\x1d6bb', idna_status::mapped},
-    {U'\x1d6bc', U'\x1d6bc', idna_status::mapped},
-    {U'\x1d6bd', U'\x1d6bd', idna_status::mapped},
-    {U'\x1d6be', U'\x1d6be', idna_status::mapped},
-    {U'\x1d6bf', U'\x1d6bf', idna_status::mapped},
-    {U'\x1d6c0', U'\x1d6c0', idna_status::mapped},
-    {U'\x1d6c1', U'\x1d6c1', idna_status::mapped},
-    {U'\x1d6c2', U'\x1d6c2', idna_status::mapped},
-    {U'\x1d6c3', U'\x1d6c3', idna_status::mapped},
-    {U'\x1d6c4', U'\x1d6c4', idna_status::mapped},
-    {U'\x1d6c5', U'\x1d6c5', idna_status::mapped},
-    {U'\x1d6c6', U'\x1d6c6', idna_status::mapped},
-    {U'\x1d6c7', U'\x1d6c7', idna_status::mapped},
-    {U'\x1d6c8', U'\x1d6c8', idna_status::mapped},
-    {U'\x1d6c9', U'\x1d6c9', idna_status::mapped},
-    {U'\x1d6ca', U'\x1d6ca', idna_status::mapped},
-    {U'\x1d6cb', U'\x1d6cb', idna_status::mapped},
-    {U'\x1d6cc', U'\x1d6cc', idna_status::mapped},
-    {U'\x1d6cd', U'\x1d6cd', idna_status::mapped},
-    {U'\x1d6ce', U'\x1d6ce', idna_status::mapped},
-    {U'\x1d6cf', U'\x1d6cf', idna_status::mapped},
-    {U'\x1d6d0', U'\x1d6d0', idna_status::mapped},
-    {U'\x1d6d1', U'\x1d6d1', idna_status::mapped},
-    {U'\x1d6d2', U'\x1d6d2', idna_status::mapped},
-    {U'\x1d6d3', U'\x1d6d4', idna_status::mapped},
-    {U'\x1d6d5', U'\x1d6d5', idna_status::mapped},
-    {U'\x1d6d6', U'\x1d6d6', idna_status::mapped},
-    {U'\x1d6d7', U'\x1d6d7', idna_status::mapped},
-    {U'\x1d6d8', U'\x1d6d8', idna_status::mapped},
-    {U'\x1d6d9', U'\x1d6d9', idna_status::mapped},
-    {U'\x1d6da', U'\x1d6da', idna_status::mapped},
-    {U'\x1d6db', U'\x1d6db', idna_status::mapped},
-    {U'\x1d6dc', U'\x1d6dc', idna_status::mapped},
-    {U'\x1d6dd', U'\x1d6dd', idna_status::mapped},
-    {U'\x1d6de', U'\x1d6de', idna_status::mapped},
-    {U'\x1d6df', U'\x1d6df', idna_status::mapped},
-    {U'\x1d6e0', U'\x1d6e0', idna_status::mapped},
-    {U'\x1d6e1', U'\x1d6e1', idna_status::mapped},
-    {U'\x1d6e2', U'\x1d6e2', idna_status::mapped},
-    {U'\x1d6e3', U'\x1d6e3', idna_status::mapped},
-    {U'\x1d6e4', U'\x1d6e4', idna_status::mapped},
-    {U'\x1d6e5', U'\x1d6e5', idna_status::mapped},
-    {U'\x1d6e6', U'\x1d6e6', idna_status::mapped},
-    {U'\x1d6e7', U'\x1d6e7', idna_status::mapped},
-    {U'\x1d6e8', U'\x1d6e8', idna_status::mapped},
-    {U'\x1d6e9', U'\x1d6e9', idna_status::mapped},
-    {U'\x1d6ea', U'\x1d6ea', idna_status::mapped},
-    {U'\x1d6eb', U'\x1d6eb', idna_status::mapped},
-    {U'\x1d6ec', U'\x1d6ec', idna_status::mapped},
-    {U'\x1d6ed', U'\x1d6ed', idna_status::mapped},
-    {U'\x1d6ee', U'\x1d6ee', idna_status::mapped},
-    {U'\x1d6ef', U'\x1d6ef', idna_status::mapped},
-    {U'\x1d6f0', U'\x1d6f0', idna_status::mapped},
-    {U'\x1d6f1', U'\x1d6f1', idna_status::mapped},
-    {U'\x1d6f2', U'\x1d6f2', idna_status::mapped},
-    {U'\x1d6f3', U'\x1d6f3', idna_status::mapped},
-    {U'\x1d6f4', U'\x1d6f4', idna_status::mapped},
-    {U'\x1d6f5', U'\x1d6f5', idna_status::mapped},
-    {U'\x1d6f6', U'\x1d6f6', idna_status::mapped},
-    {U'\x1d6f7', U'\x1d6f7', idna_status::mapped},
-    {U'\x1d6f8', U'\x1d6f8', idna_status::mapped},
-    {U'\x1d6f9', U'\x1d6f9', idna_status::mapped},
-    {U'\x1d6fa', U'\x1d6fa', idna_status::mapped},
-    {U'\x1d6fb', U'\x1d6fb', idna_status::mapped},
-    {U'\x1d6fc', U'\x1d6fc', idna_status::mapped},
-    {U'\x1d6fd', U'\x1d6fd', idna_status::mapped},
-    {U'\x1d6fe', U'\x1d6fe', idna_status::mapped},
-    {U'\x1d6ff', U'\x1d6ff', idna_status::mapped},
-    {U'\x1d700', U'\x1d700', idna_status::mapped},
-    {U'\x1d701', U'\x1d701', idna_status::mapped},
-    {U'\x1d702', U'\x1d702', idna_status::mapped},
-    {U'\x1d703', U'\x1d703', idna_status::mapped},
-    {U'\x1d704', U'\x1d704', idna_status::mapped},
-    {U'\x1d705', U'\x1d705', idna_status::mapped},
-    {U'\x1d706', U'\x1d706', idna_status::mapped},
-    {U'\x1d707', U'\x1d707', idna_status::mapped},
-    {U'\x1d708', U'\x1d708', idna_status::mapped},
-    {U'\x1d709', U'\x1d709', idna_status::mapped},
-    {U'\x1d70a', U'\x1d70a', idna_status::mapped},
-    {U'\x1d70b', U'\x1d70b', idna_status::mapped},
-    {U'\x1d70c', U'\x1d70c', idna_status::mapped},
-    {U'\x1d70d', U'\x1d70e', idna_status::mapped},
-    {U'\x1d70f', U'\x1d70f', idna_status::mapped},
-    {U'\x1d710', U'\x1d710', idna_status::mapped},
-    {U'\x1d711', U'\x1d711', idna_status::mapped},
-    {U'\x1d712', U'\x1d712', idna_status::mapped},
-    {U'\x1d713', U'\x1d713', idna_status::mapped},
-    {U'\x1d714', U'\x1d714', idna_status::mapped},
-    {U'\x1d715', U'\x1d715', idna_status::mapped},
-    {U'\x1d716', U'\x1d716', idna_status::mapped},
-    {U'\x1d717', U'\x1d717', idna_status::mapped},
-    {U'\x1d718', U'\x1d718', idna_status::mapped},
-    {U'\x1d719', U'\x1d719', idna_status::mapped},
-    {U'\x1d71a', U'\x1d71a', idna_status::mapped},
-    {U'\x1d71b', U'\x1d71b', idna_status::mapped},
-    {U'\x1d71c', U'\x1d71c', idna_status::mapped},
-    {U'\x1d71d', U'\x1d71d', idna_status::mapped},
-    {U'\x1d71e', U'\x1d71e', idna_status::mapped},
-    {U'\x1d71f', U'\x1d71f', idna_status::mapped},
-    {U'\x1d720', U'\x1d720', idna_status::mapped},
-    {U'\x1d721', U'\x1d721', idna_status::mapped},
-    {U'\x1d722', U'\x1d722', idna_status::mapped},
-    {U'\x1d723', U'\x1d723', idna_status::mapped},
-    {U'\x1d724', U'\x1d724', idna_status::mapped},
-    {U'\x1d725', U'\x1d725', idna_status::mapped},
-    {U'\x1d726', U'\x1d726', idna_status::mapped},
-    {U'\x1d727', U'\x1d727', idna_status::mapped},
-    {U'\x1d728', U'\x1d728', idna_status::mapped},
-    {U'\x1d729', U'\x1d729', idna_status::mapped},
-    {U'\x1d72a', U'\x1d72a', idna_status::mapped},
-    {U'\x1d72b', U'\x1d72b', idna_status::mapped},
-    {U'\x1d72c', U'\x1d72c', idna_status::mapped},
-    {U'\x1d72d', U'\x1d72d', idna_status::mapped},
-    {U'\x1d72e', U'\x1d72e', idna_status::mapped},
-    {U'\x1d72f', U'\x1d72f', idna_status::mapped},
-    {U'\x1d730', U'\x1d730', idna_status::mapped},
-    {U'\x1d731', U'\x1d731', idna_status::mapped},
-    {U'\x1d732', U'\x1d732', idna_status::mapped},
-    {U'\x1d733', U'\x1d733', idna_status::mapped},
-    {U'\x1d734', U'\x1d734', idna_status::mapped},
-    {U'\x1d735', U'\x1d735', idna_status::mapped},
-    {U'\x1d736', U'\x1d736', idna_status::mapped},
-    {U'\x1d737', U'\x1d737', idna_status::mapped},
-    {U'\x1d738', U'\x1d738', idna_status::mapped},
-    {U'\x1d739', U'\x1d739', idna_status::mapped},
-    {U'\x1d73a', U'\x1d73a', idna_status::mapped},
-    {U'\x1d73b', U'\x1d73b', idna_status::mapped},
-    {U'\x1d73c', U'\x1d73c', idna_status::mapped},
-    {U'\x1d73d', U'\x1d73d', idna_status::mapped},
-    {U'\x1d73e', U'\x1d73e', idna_status::mapped},
-    {U'\x1d73f', U'\x1d73f', idna_status::mapped},
-    {U'\x1d740', U'\x1d740', idna_status::mapped},
-    {U'\x1d741', U'\x1d741', idna_status::mapped},
-    {U'\x1d742', U'\x1d742', idna_status::mapped},
-    {U'\x1d743', U'\x1d743', idna_status::mapped},
-    {U'\x1d744', U'\x1d744', idna_status::mapped},
-    {U'\x1d745', U'\x1d745', idna_status::mapped},
-    {U'\x1d746', U'\x1d746', idna_status::mapped},
-    {U'\x1d747', U'\x1d748', idna_status::mapped},
-    {U'\x1d749', U'\x1d749', idna_status::mapped},
-    {U'\x1d74a', U'\x1d74a', idna_status::mapped},
-    {U'\x1d74b', U'\x1d74b', idna_status::mapped},
-    {U'\x1d74c', U'\x1d74c', idna_status::mapped},
-    {U'\x1d74d', U'\x1d74d', idna_status::mapped},
-    {U'\x1d74e', U'\x1d74e', idna_status::mapped},
-    {U'\x1d74f', U'\x1d74f', idna_status::mapped},
-    {U'\x1d750', U'\x1d750', idna_status::mapped},
-    {U'\x1d751', U'\x1d751', idna_status::mapped},
-    {U'\x1d752', U'\x1d752', idna_status::mapped},
-    {U'\x1d753', U'\x1d753', idna_status::mapped},
-    {U'\x1d754', U'\x1d754', idna_status::mapped},
-    {U'\x1d755', U'\x1d755', idna_status::mapped},
-    {U'\x1d756', U'\x1d756', idna_status::mapped},
-    {U'\x1d757', U'\x1d757', idna_status::mapped},
-    {U'\x1d758', U'\x1d758', idna_status::mapped},
-    {U'\x1d759', U'\x1d759', idna_status::mapped},
-    {U'\x1d75a', U'\x1d75a', idna_status::mapped},
-    {U'\x1d75b', U'\x1d75b', idna_status::mapped},
-    {U'\x1d75c', U'\x1d75c', idna_status::mapped},
-    {U'\x1d75d', U'\x1d75d', idna_status::mapped},
-    {U'\x1d75e', U'\x1d75e', idna_status::mapped},
-    {U'\x1d75f', U'\x1d75f', idna_status::mapped},
-    {U'\x1d760', U'\x1d760', idna_status::mapped},
-    {U'\x1d761', U'\x1d761', idna_status::mapped},
-    {U'\x1d762', U'\x1d762', idna_status::mapped},
-    {U'\x1d763', U'\x1d763', idna_status::mapped},
-    {U'\x1d764', U'\x1d764', idna_status::mapped},
-    {U'\x1d765', U'\x1d765', idna_status::mapped},
-    {U'\x1d766', U'\x1d766', idna_status::mapped},
-    {U'\x1d767', U'\x1d767', idna_status::mapped},
-    {U'\x1d768', U'\x1d768', idna_status::mapped},
-    {U'\x1d769', U'\x1d769', idna_status::mapped},
-    {U'\x1d76a', U'\x1d76a', idna_status::mapped},
-    {U'\x1d76b', U'\x1d76b', idna_status::mapped},
-    {U'\x1d76c', U'\x1d76c', idna_status::mapped},
-    {U'\x1d76d', U'\x1d76d', idna_status::mapped},
-    {U'\x1d76e', U'\x1d76e', idna_status::mapped},
-    {U'\x1d76f', U'\x1d76f', idna_status::mapped},
-    {U'\x1d770', U'\x1d770', idna_status::mapped},
-    {U'\x1d771', U'\x1d771', idna_status::mapped},
-    {U'\x1d772', U'\x1d772', idna_status::mapped},
-    {U'\x1d773', U'\x1d773', idna_status::mapped},
-    {U'\x1d774', U'\x1d774', idna_status::mapped},
-    {U'\x1d775', U'\x1d775', idna_status::mapped},
-    {U'\x1d776', U'\x1d776', idna_status::mapped},
-    {U'\x1d777', U'\x1d777', idna_status::mapped},
-    {U'\x1d778', U'\x1d778', idna_status::mapped},
-    {U'\x1d779', U'\x1d779', idna_status::mapped},
-    {U'\x1d77a', U'\x1d77a', idna_status::mapped},
-    {U'\x1d77b', U'\x1d77b', idna_status::mapped},
-    {U'\x1d77c', U'\x1d77c', idna_status::mapped},
-    {U'\x1d77d', U'\x1d77d', idna_status::mapped},
-    {U'\x1d77e', U'\x1d77e', idna_status::mapped},
-    {U'\x1d77f', U'\x1d77f', idna_status::mapped},
-    {U'\x1d780', U'\x1d780', idna_status::mapped},
-    {U'\x1d781', U'\x1d782', idna_status::mapped},
-    {U'\x1d783', U'\x1d783', idna_status::mapped},
-    {U'\x1d784', U'\x1d784', idna_status::mapped},
-    {U'\x1d785', U'\x1d785', idna_status::mapped},
-    {U'\x1d786', U'\x1d786', idna_status::mapped},
-    {U'\x1d787', U'\x1d787', idna_status::mapped},
-    {U'\x1d788', U'\x1d788', idna_status::mapped},
-    {U'\x1d789', U'\x1d789', idna_status::mapped},
-    {U'\x1d78a', U'\x1d78a', idna_status::mapped},
-    {U'\x1d78b', U'\x1d78b', idna_status::mapped},
-    {U'\x1d78c', U'\x1d78c', idna_status::mapped},
-    {U'\x1d78d', U'\x1d78d', idna_status::mapped},
-    {U'\x1d78e', U'\x1d78e', idna_status::mapped},
-    {U'\x1d78f', U'\x1d78f', idna_status::mapped},
-    {U'\x1d790', U'\x1d790', idna_status::mapped},
-    {U'\x1d791', U'\x1d791', idna_status::mapped},
-    {U'\x1d792', U'\x1d792', idna_status::mapped},
-    {U'\x1d793', U'\x1d793', idna_status::mapped},
-    {U'\x1d794', U'\x1d794', idna_status::mapped},
-    {U'\x1d795', U'\x1d795', idna_status::mapped},
-    {U'\x1d796', U'\x1d796', idna_status::mapped},
-    {U'\x1d797', U'\x1d797', idna_status::mapped},
-    {U'\x1d798', U'\x1d798', idna_status::mapped},
-    {U'\x1d799', U'\x1d799', idna_status::mapped},
-    {U'\x1d79a', U'\x1d79a', idna_status::mapped},
-    {U'\x1d79b', U'\x1d79b', idna_status::mapped},
-    {U'\x1d79c', U'\x1d79c', idna_status::mapped},
-    {U'\x1d79d', U'\x1d79d', idna_status::mapped},
-    {U'\x1d79e', U'\x1d79e', idna_status::mapped},
-    {U'\x1d79f', U'\x1d79f', idna_status::mapped},
-    {U'\x1d7a0', U'\x1d7a0', idna_status::mapped},
-    {U'\x1d7a1', U'\x1d7a1', idna_status::mapped},
-    {U'\x1d7a2', U'\x1d7a2', idna_status::mapped},
-    {U'\x1d7a3', U'\x1d7a3', idna_status::mapped},
-    {U'\x1d7a4', U'\x1d7a4', idna_status::mapped},
-    {U'\x1d7a5', U'\x1d7a5', idna_status::mapped},
-    {U'\x1d7a6', U'\x1d7a6', idna_status::mapped},
-    {U'\x1d7a7', U'\x1d7a7', idna_status::mapped},
-    {U'\x1d7a8', U'\x1d7a8', idna_status::mapped},
-    {U'\x1d7a9', U'\x1d7a9', idna_status::mapped},
-    {U'\x1d7aa', U'\x1d7aa', idna_status::mapped},
-    {U'\x1d7ab', U'\x1d7ab', idna_status::mapped},
-    {U'\x1d7ac', U'\x1d7ac', idna_status::mapped},
-    {U'\x1d7ad', U'\x1d7ad', idna_status::mapped},
-    {U'\x1d7ae', U'\x1d7ae', idna_status::mapped},
-    {U'\x1d7af', U'\x1d7af', idna_status::mapped},
-    {U'\x1d7b0', U'\x1d7b0', idna_status::mapped},
-    {U'\x1d7b1', U'\x1d7b1', idna_status::mapped},
-    {U'\x1d7b2', U'\x1d7b2', idna_status::mapped},
-    {U'\x1d7b3', U'\x1d7b3', idna_status::mapped},
-    {U'\x1d7b4', U'\x1d7b4', idna_status::mapped},
-    {U'\x1d7b5', U'\x1d7b5', idna_status::mapped},
-    {U'\x1d7b6', U'\x1d7b6', idna_status::mapped},
-    {U'\x1d7b7', U'\x1d7b7', idna_status::mapped},
-    {U'\x1d7b8', U'\x1d7b8', idna_status::mapped},
-    {U'\x1d7b9', U'\x1d7b9', idna_status::mapped},
-    {U'\x1d7ba', U'\x1d7ba', idna_status::mapped},
-    {U'\x1d7bb', U'\x1d7bc', idna_status::mapped},
-    {U'\x1d7bd', U'\x1d7bd', idna_status::mapped},
-    {U'\x1d7be', U'\x1d7be', idna_status::mapped},
-    {U'\x1d7bf', U'\x1d7bf', idna_status::mapped},
-    {U'\x1d7c0', U'\x1d7c0', idna_status::mapped},
-    {U'\x1d7c1', U'\x1d7c1', idna_status::mapped},
-    {U'\x1d7c2', U'\x1d7c2', idna_status::mapped},
-    {U'\x1d7c3', U'\x1d7c3', idna_status::mapped},
-    {U'\x1d7c4', U'\x1d7c4', idna_status::mapped},
-    {U'\x1d7c5', U'\x1d7c5', idna_status::mapped},
-    {U'\x1d7c6', U'\x1d7c6', idna_status::mapped},
-    {U'\x1d7c7', U'\x1d7c7', idna_status::mapped},
-    {U'\x1d7c8', U'\x1d7c8', idna_status::mapped},
-    {U'\x1d7c9', U'\x1d7c9', idna_status::mapped},
-    {U'\x1d7ca', U'\x1d7cb', idna_status::mapped},
-    {U'\x1d7cc', U'\x1d7cd', idna_status::disallowed},
-    {U'\x1d7ce', U'\x1d7ce', idna_status::mapped},
-    {U'\x1d7cf', U'\x1d7cf', idna_status::mapped},
-    {U'\x1d7d0', U'\x1d7d0', idna_status::mapped},
-    {U'\x1d7d1', U'\x1d7d1', idna_status::mapped},
-    {U'\x1d7d2', U'\x1d7d2', idna_status::mapped},
-    {U'\x1d7d3', U'\x1d7d3', idna_status::mapped},
-    {U'\x1d7d4', U'\x1d7d4', idna_status::mapped},
-    {U'\x1d7d5', U'\x1d7d5', idna_status::mapped},
-    {U'\x1d7d6', U'\x1d7d6', idna_status::mapped},
-    {U'\x1d7d7', U'\x1d7d7', idna_status::mapped},
-    {U'\x1d7d8', U'\x1d7d8', idna_status::mapped},
-    {U'\x1d7d9', U'\x1d7d9', idna_status::mapped},
-    {U'\x1d7da', U'\x1d7da', idna_status::mapped},
-    {U'\x1d7db', U'\x1d7db', idna_status::mapped},
-    {U'\x1d7dc', U'\x1d7dc', idna_status::mapped},
-    {U'\x1d7dd', U'\x1d7dd', idna_status::mapped},
-    {U'\x1d7de', U'\x1d7de', idna_status::mapped},
-    {U'\x1d7df', U'\x1d7df', idna_status::mapped},
-    {U'\x1d7e0', U'\x1d7e0', idna_status::mapped},
-    {U'\x1d7e1', U'\x1d7e1', idna_status::mapped},
-    {U'\x1d7e2', U'\x1d7e2', idna_status::mapped},
-    {U'\x1d7e3', U'\x1d7e3', idna_status::mapped},
-    {U'\x1d7e4', U'\x1d7e4', idna_status::mapped},
-    {U'\x1d7e5', U'\x1d7e5', idna_status::mapped},
-    {U'\x1d7e6', U'\x1d7e6', idna_status::mapped},
-    {U'\x1d7e7', U'\x1d7e7', idna_status::mapped},
-    {U'\x1d7e8', U'\x1d7e8', idna_status::mapped},
-    {U'\x1d7e9', U'\x1d7e9', idna_status::mapped},
-    {U'\x1d7ea', U'\x1d7ea', idna_status::mapped},
-    {U'\x1d7eb', U'\x1d7eb', idna_status::mapped},
-    {U'\x1d7ec', U'\x1d7ec', idna_status::mapped},
-    {U'\x1d7ed', U'\x1d7ed', idna_status::mapped},
-    {U'\x1d7ee', U'\x1d7ee', idna_status::mapped},
-    {U'\x1d7ef', U'\x1d7ef', idna_status::mapped},
-    {U'\x1d7f0', U'\x1d7f0', idna_status::mapped},
-    {U'\x1d7f1', U'\x1d7f1', idna_status::mapped},
-    {U'\x1d7f2', U'\x1d7f2', idna_status::mapped},
-    {U'\x1d7f3', U'\x1d7f3', idna_status::mapped},
-    {U'\x1d7f4', U'\x1d7f4', idna_status::mapped},
-    {U'\x1d7f5', U'\x1d7f5', idna_status::mapped},
-    {U'\x1d7f6', U'\x1d7f6', idna_status::mapped},
-    {U'\x1d7f7', U'\x1d7f7', idna_status::mapped},
-    {U'\x1d7f8', U'\x1d7f8', idna_status::mapped},
-    {U'\x1d7f9', U'\x1d7f9', idna_status::mapped},
-    {U'\x1d7fa', U'\x1d7fa', idna_status::mapped},
-    {U'\x1d7fb', U'\x1d7fb', idna_status::mapped},
-    {U'\x1d7fc', U'\x1d7fc', idna_status::mapped},
-    {U'\x1d7fd', U'\x1d7fd', idna_status::mapped},
-    {U'\x1d7fe', U'\x1d7fe', idna_status::mapped},
-    {U'\x1d7ff', U'\x1d7ff', idna_status::mapped},
-    {U'\x1da8c', U'\x1da9a', idna_status::disallowed},
-    {U'\x1daa0', U'\x1daa0', idna_status::disallowed},
-    {U'\x1dab0', U'\x1deff', idna_status::disallowed},
-    {U'\x1df1f', U'\x1df24', idna_status::disallowed},
-    {U'\x1df2b', U'\x1dfff', idna_status::disallowed},
-    {U'\x1e007', U'\x1e007', idna_status::disallowed},
-    {U'\x1e019', U'\x1e01a', idna_status::disallowed},
-    {U'\x1e022', U'\x1e022', idna_status::disallowed},
-    {U'\x1e025', U'\x1e025', idna_status::disallowed},
-    {U'\x1e02b', U'\x1e02f', idna_status::disallowed},
-    {U'\x1e030', U'\x1e030', idna_status::mapped},
-    {U'\x1e031', U'\x1e031', idna_status::mapped},
-    {U'\x1e032', U'\x1e032', idna_status::mapped},
-    {U'\x1e033', U'\x1e033', idna_status::mapped},
-    {U'\x1e034', U'\x1e034', idna_status::mapped},
-    {U'\x1e035', U'\x1e035', idna_status::mapped},
-    {U'\x1e036', U'\x1e036', idna_status::mapped},
-    {U'\x1e037', U'\x1e037', idna_status::mapped},
-    {U'\x1e038', U'\x1e038', idna_status::mapped},
-    {U'\x1e039', U'\x1e039', idna_status::mapped},
-    {U'\x1e03a', U'\x1e03a', idna_status::mapped},
-    {U'\x1e03b', U'\x1e03b', idna_status::mapped},
-    {U'\x1e03c', U'\x1e03c', idna_status::mapped},
-    {U'\x1e03d', U'\x1e03d', idna_status::mapped},
-    {U'\x1e03e', U'\x1e03e', idna_status::mapped},
-    {U'\x1e03f', U'\x1e03f', idna_status::mapped},
-    {U'\x1e040', U'\x1e040', idna_status::mapped},
-    {U'\x1e041', U'\x1e041', idna_status::mapped},
-    {U'\x1e042', U'\x1e042', idna_status::mapped},
-    {U'\x1e043', U'\x1e043', idna_status::mapped},
-    {U'\x1e044', U'\x1e044', idna_status::mapped},
-    {U'\x1e045', U'\x1e045', idna_status::mapped},
-    {U'\x1e046', U'\x1e046', idna_status::mapped},
-    {U'\x1e047', U'\x1e047', idna_status::mapped},
-    {U'\x1e048', U'\x1e048', idna_status::mapped},
-    {U'\x1e049', U'\x1e049', idna_status::mapped},
-    {U'\x1e04a', U'\x1e04a', idna_status::mapped},
-    {U'\x1e04b', U'\x1e04b', idna_status::mapped},
-    {U'\x1e04c', U'\x1e04c', idna_status::mapped},
-    {U'\x1e04d', U'\x1e04d', idna_status::mapped},
-    {U'\x1e04e', U'\x1e04e', idna_status::mapped},
-    {U'\x1e04f', U'\x1e04f', idna_status::mapped},
-    {U'\x1e050', U'\x1e050', idna_status::mapped},
-    {U'\x1e051', U'\x1e051', idna_status::mapped},
-    {U'\x1e052', U'\x1e052', idna_status::mapped},
-    {U'\x1e053', U'\x1e053', idna_status::mapped},
-    {U'\x1e054', U'\x1e054', idna_status::mapped},
-    {U'\x1e055', U'\x1e055', idna_status::mapped},
-    {U'\x1e056', U'\x1e056', idna_status::mapped},
-    {U'\x1e057', U'\x1e057', idna_status::mapped},
-    {U'\x1e058', U'\x1e058', idna_status::mapped},
-    {U'\x1e059', U'\x1e059', idna_status::mapped},
-    {U'\x1e05a', U'\x1e05a', idna_status::mapped},
-    {U'\x1e05b', U'\x1e05b', idna_status::mapped},
-    {U'\x1e05c', U'\x1e05c', idna_status::mapped},
-    {U'\x1e05d', U'\x1e05d', idna_status::mapped},
-    {U'\x1e05e', U'\x1e05e', idna_status::mapped},
-    {U'\x1e05f', U'\x1e05f', idna_status::mapped},
-    {U'\x1e060', U'\x1e060', idna_status::mapped},
-    {U'\x1e061', U'\x1e061', idna_status::mapped},
-    {U'\x1e062', U'\x1e062', idna_status::mapped},
-    {U'\x1e063', U'\x1e063', idna_status::mapped},
-    {U'\x1e064', U'\x1e064', idna_status::mapped},
-    {U'\x1e065', U'\x1e065', idna_status::mapped},
-    {U'\x1e066', U'\x1e066', idna_status::mapped},
-    {U'\x1e067', U'\x1e067', idna_status::mapped},
-    {U'\x1e068', U'\x1e068', idna_status::mapped},
-    {U'\x1e069', U'\x1e069', idna_status::mapped},
-    {U'\x1e06a', U'\x1e06a', idna_status::mapped},
-    {U'\x1e06b', U'\x1e06b', idna_status::mapped},
-    {U'\x1e06c', U'\x1e06c', idna_status::mapped},
-    {U'\x1e06d', U'\x1e06d', idna_status::mapped},
-    {U'\x1e06e', U'\x1e08e', idna_status::disallowed},
-    {U'\x1e090', U'\x1e0ff', idna_status::disallowed},
-    {U'\x1e12d', U'\x1e12f', idna_status::disallowed},
-    {U'\x1e13e', U'\x1e13f', idna_status::disallowed},
-    {U'\x1e14a', U'\x1e14d', idna_status::disallowed},
-    {U'\x1e150', U'\x1e28f', idna_status::disallowed},
-    {U'\x1e2af', U'\x1e2bf', idna_status::disallowed},
-    {U'\x1e2fa', U'\x1e2fe', idna_status::disallowed},
-    {U'\x1e300', U'\x1e4cf', idna_status::disallowed},
-    {U'\x1e4fa', U'\x1e7df', idna_status::disallowed},
-    {U'\x1e7e7', U'\x1e7e7', idna_status::disallowed},
-    {U'\x1e7ec', U'\x1e7ec', idna_status::disallowed},
-    {U'\x1e7ef', U'\x1e7ef', idna_status::disallowed},
-    {U'\x1e7ff', U'\x1e7ff', idna_status::disallowed},
-    {U'\x1e8c5', U'\x1e8c6', idna_status::disallowed},
-    {U'\x1e8d7', U'\x1e8ff', idna_status::disallowed},
-    {U'\x1e900', U'\x1e900', idna_status::mapped},
-    {U'\x1e901', U'\x1e901', idna_status::mapped},
-    {U'\x1e902', U'\x1e902', idna_status::mapped},
-    {U'\x1e903', U'\x1e903', idna_status::mapped},
-    {U'\x1e904', U'\x1e904', idna_status::mapped},
-    {U'\x1e905', U'\x1e905', idna_status::mapped},
-    {U'\x1e906', U'\x1e906', idna_status::mapped},
-    {U'\x1e907', U'\x1e907', idna_status::mapped},
-    {U'\x1e908', U'\x1e908', idna_status::mapped},
-    {U'\x1e909', U'\x1e909', idna_status::mapped},
-    {U'\x1e90a', U'\x1e90a', idna_status::mapped},
-    {U'\x1e90b', U'\x1e90b', idna_status::mapped},
-    {U'\x1e90c', U'\x1e90c', idna_status::mapped},
-    {U'\x1e90d', U'\x1e90d', idna_status::mapped},
-    {U'\x1e90e', U'\x1e90e', idna_status::mapped},
-    {U'\x1e90f', U'\x1e90f', idna_status::mapped},
-    {U'\x1e910', U'\x1e910', idna_status::mapped},
-    {U'\x1e911', U'\x1e911', idna_status::mapped},
-    {U'\x1e912', U'\x1e912', idna_status::mapped},
-    {U'\x1e913', U'\x1e913', idna_status::mapped},
-    {U'\x1e914', U'\x1e914', idna_status::mapped},
-    {U'\x1e915', U'\x1e915', idna_status::mapped},
-    {U'\x1e916', U'\x1e916', idna_status::mapped},
-    {U'\x1e917', U'\x1e917', idna_status::mapped},
-    {U'\x1e918', U'\x1e918', idna_status::mapped},
-    {U'\x1e919', U'\x1e919', idna_status::mapped},
-    {U'\x1e91a', U'\x1e91a', idna_status::mapped},
-    {U'\x1e91b', U'\x1e91b', idna_status::mapped},
-    {U'\x1e91c', U'\x1e91c', idna_status::mapped},
-    {U'\x1e91d', U'\x1e91d', idna_status::mapped},
-    {U'\x1e91e', U'\x1e91e', idna_status::mapped},
-    {U'\x1e91f', U'\x1e91f', idna_status::mapped},
-    {U'\x1e920', U'\x1e920', idna_status::mapped},
-    {U'\x1e921', U'\x1e921', idna_status::mapped},
-    {U'\x1e94c', U'\x1e94f', idna_status::disallowed},
-    {U'\x1e95a', U'\x1e95d', idna_status::disallowed},
-    {U'\x1e960', U'\x1ec70', idna_status::disallowed},
-    {U'\x1ecb5', U'\x1ed00', idna_status::disallowed},
-    {U'\x1ed3e', U'\x1edff', idna_status::disallowed},
-    {U'\x1ee00', U'\x1ee00', idna_status::mapped},
-    {U'\x1ee01', U'\x1ee01', idna_status::mapped},
-    {U'\x1ee02', U'\x1ee02', idna_status::mapped},
-    {U'\x1ee03', U'\x1ee03', idna_status::mapped},
-    {U'\x1ee04', U'\x1ee04', idna_status::disallowed},
-    {U'\x1ee05', U'\x1ee05', idna_status::mapped},
-    {U'\x1ee06', U'\x1ee06', idna_status::mapped},
-    {U'\x1ee07', U'\x1ee07', idna_status::mapped},
-    {U'\x1ee08', U'\x1ee08', idna_status::mapped},
-    {U'\x1ee09', U'\x1ee09', idna_status::mapped},
-    {U'\x1ee0a', U'\x1ee0a', idna_status::mapped},
-    {U'\x1ee0b', U'\x1ee0b', idna_status::mapped},
-    {U'\x1ee0c', U'\x1ee0c', idna_status::mapped},
-    {U'\x1ee0d', U'\x1ee0d', idna_status::mapped},
-    {U'\x1ee0e', U'\x1ee0e', idna_status::mapped},
-    {U'\x1ee0f', U'\x1ee0f', idna_status::mapped},
-    {U'\x1ee10', U'\x1ee10', idna_status::mapped},
-    {U'\x1ee11', U'\x1ee11', idna_status::mapped},
-    {U'\x1ee12', U'\x1ee12', idna_status::mapped},
-    {U'\x1ee13', U'\x1ee13', idna_status::mapped},
-    {U'\x1ee14', U'\x1ee14', idna_status::mapped},
-    {U'\x1ee15', U'\x1ee15', idna_status::mapped},
-    {U'\x1ee16', U'\x1ee16', idna_status::mapped},
-    {U'\x1ee17', U'\x1ee17', idna_status::mapped},
-    {U'\x1ee18', U'\x1ee18', idna_status::mapped},
-    {U'\x1ee19', U'\x1ee19', idna_status::mapped},
-    {U'\x1ee1a', U'\x1ee1a', idna_status::mapped},
-    {U'\x1ee1b', U'\x1ee1b', idna_status::mapped},
-    {U'\x1ee1c', U'\x1ee1c', idna_status::mapped},
-    {U'\x1ee1d', U'\x1ee1d', idna_status::mapped},
-    {U'\x1ee1e', U'\x1ee1e', idna_status::mapped},
-    {U'\x1ee1f', U'\x1ee1f', idna_status::mapped},
-    {U'\x1ee20', U'\x1ee20', idna_status::disallowed},
-    {U'\x1ee21', U'\x1ee21', idna_status::mapped},
-    {U'\x1ee22', U'\x1ee22', idna_status::mapped},
-    {U'\x1ee23', U'\x1ee23', idna_status::disallowed},
-    {U'\x1ee24', U'\x1ee24', idna_status::mapped},
-    {U'\x1ee25', U'\x1ee26', idna_status::disallowed},
-    {U'\x1ee27', U'\x1ee27', idna_status::mapped},
-    {U'\x1ee28', U'\x1ee28', idna_status::disallowed},
-    {U'\x1ee29', U'\x1ee29', idna_status::mapped},
-    {U'\x1ee2a', U'\x1ee2a', idna_status::mapped},
-    {U'\x1ee2b', U'\x1ee2b', idna_status::mapped},
-    {U'\x1ee2c', U'\x1ee2c', idna_status::mapped},
-    {U'\x1ee2d', U'\x1ee2d', idna_status::mapped},
-    {U'\x1ee2e', U'\x1ee2e', idna_status::mapped},
-    {U'\x1ee2f', U'\x1ee2f', idna_status::mapped},
-    {U'\x1ee30', U'\x1ee30', idna_status::mapped},
-    {U'\x1ee31', U'\x1ee31', idna_status::mapped},
-    {U'\x1ee32', U'\x1ee32', idna_status::mapped},
-    {U'\x1ee33', U'\x1ee33', idna_status::disallowed},
-    {U'\x1ee34', U'\x1ee34', idna_status::mapped},
-    {U'\x1ee35', U'\x1ee35', idna_status::mapped},
-    {U'\x1ee36', U'\x1ee36', idna_status::mapped},
-    {U'\x1ee37', U'\x1ee37', idna_status::mapped},
-    {U'\x1ee38', U'\x1ee38', idna_status::disallowed},
-    {U'\x1ee39', U'\x1ee39', idna_status::mapped},
-    {U'\x1ee3a', U'\x1ee3a', idna_status::disallowed},
-    {U'\x1ee3b', U'\x1ee3b', idna_status::mapped},
-    {U'\x1ee3c', U'\x1ee41', idna_status::disallowed},
-    {U'\x1ee42', U'\x1ee42', idna_status::mapped},
-    {U'\x1ee43', U'\x1ee46', idna_status::disallowed},
-    {U'\x1ee47', U'\x1ee47', idna_status::mapped},
-    {U'\x1ee48', U'\x1ee48', idna_status::disallowed},
-    {U'\x1ee49', U'\x1ee49', idna_status::mapped},
-    {U'\x1ee4a', U'\x1ee4a', idna_status::disallowed},
-    {U'\x1ee4b', U'\x1ee4b', idna_status::mapped},
-    {U'\x1ee4c', U'\x1ee4c', idna_status::disallowed},
-    {U'\x1ee4d', U'\x1ee4d', idna_status::mapped},
-    {U'\x1ee4e', U'\x1ee4e', idna_status::mapped},
-    {U'\x1ee4f', U'\x1ee4f', idna_status::mapped},
-    {U'\x1ee50', U'\x1ee50', idna_status::disallowed},
-    {U'\x1ee51', U'\x1ee51', idna_status::mapped},
-    {U'\x1ee52', U'\x1ee52', idna_status::mapped},
-    {U'\x1ee53', U'\x1ee53', idna_status::disallowed},
-    {U'\x1ee54', U'\x1ee54', idna_status::mapped},
-    {U'\x1ee55', U'\x1ee56', idna_status::disallowed},
-    {U'\x1ee57', U'\x1ee57', idna_status::mapped},
-    {U'\x1ee58', U'\x1ee58', idna_status::disallowed},
-    {U'\x1ee59', U'\x1ee59', idna_status::mapped},
-    {U'\x1ee5a', U'\x1ee5a', idna_status::disallowed},
-    {U'\x1ee5b', U'\x1ee5b', idna_status::mapped},
-    {U'\x1ee5c', U'\x1ee5c', idna_status::disallowed},
-    {U'\x1ee5d', U'\x1ee5d', idna_status::mapped},
-    {U'\x1ee5e', U'\x1ee5e', idna_status::disallowed},
-    {U'\x1ee5f', U'\x1ee5f', idna_status::mapped},
-    {U'\x1ee60', U'\x1ee60', idna_status::disallowed},
-    {U'\x1ee61', U'\x1ee61', idna_status::mapped},
-    {U'\x1ee62', U'\x1ee62', idna_status::mapped},
-    {U'\x1ee63', U'\x1ee63', idna_status::disallowed},
-    {U'\x1ee64', U'\x1ee64', idna_status::mapped},
-    {U'\x1ee65', U'\x1ee66', idna_status::disallowed},
-    {U'\x1ee67', U'\x1ee67', idna_status::mapped},
-    {U'\x1ee68', U'\x1ee68', idna_status::mapped},
-    {U'\x1ee69', U'\x1ee69', idna_status::mapped},
-    {U'\x1ee6a', U'\x1ee6a', idna_status::mapped},
-    {U'\x1ee6b', U'\x1ee6b', idna_status::disallowed},
-    {U'\x1ee6c', U'\x1ee6c', idna_status::mapped},
-    {U'\x1ee6d', U'\x1ee6d', idna_status::mapped},
-    {U'\x1ee6e', U'\x1ee6e', idna_status::mapped},
-    {U'\x1ee6f', U'\x1ee6f', idna_status::mapped},
-    {U'\x1ee70', U'\x1ee70', idna_status::mapped},
-    {U'\x1ee71', U'\x1ee71', idna_status::mapped},
-    {U'\x1ee72', U'\x1ee72', idna_status::mapped},
-    {U'\x1ee73', U'\x1ee73', idna_status::disallowed},
-    {U'\x1ee74', U'\x1ee74', idna_status::mapped},
-    {U'\x1ee75', U'\x1ee75', idna_status::mapped},
-    {U'\x1ee76', U'\x1ee76', idna_status::mapped},
-    {U'\x1ee77', U'\x1ee77', idna_status::mapped},
-    {U'\x1ee78', U'\x1ee78', idna_status::disallowed},
-    {U'\x1ee79', U'\x1ee79', idna_status::mapped},
-    {U'\x1ee7a', U'\x1ee7a', idna_status::mapped},
-    {U'\x1ee7b', U'\x1ee7b', idna_status::mapped},
-    {U'\x1ee7c', U'\x1ee7c', idna_status::mapped},
-    {U'\x1ee7d', U'\x1ee7d', idna_status::disallowed},
-    {U'\x1ee7e', U'\x1ee7e', idna_status::mapped},
-    {U'\x1ee7f', U'\x1ee7f', idna_status::disallowed},
-    {U'\x1ee80', U'\x1ee80', idna_status::mapped},
-    {U'\x1ee81', U'\x1ee81', idna_status::mapped},
-    {U'\x1ee82', U'\x1ee82', idna_status::mapped},
-    {U'\x1ee83', U'\x1ee83', idna_status::mapped},
-    {U'\x1ee84', U'\x1ee84', idna_status::mapped},
-    {U'\x1ee85', U'\x1ee85', idna_status::mapped},
-    {U'\x1ee86', U'\x1ee86', idna_status::mapped},
-    {U'\x1ee87', U'\x1ee87', idna_status::mapped},
-    {U'\x1ee88', U'\x1ee88', idna_status::mapped},
-    {U'\x1ee89', U'\x1ee89', idna_status::mapped},
-    {U'\x1ee8a', U'\x1ee8a', idna_status::disallowed},
-    {U'\x1ee8b', U'\x1ee8b', idna_status::mapped},
-    {U'\x1ee8c', U'\x1ee8c', idna_status::mapped},
-    {U'\x1ee8d', U'\x1ee8d', idna_status::mapped},
-    {U'\x1ee8e', U'\x1ee8e', idna_status::mapped},
-    {U'\x1ee8f', U'\x1ee8f', idna_status::mapped},
-    {U'\x1ee90', U'\x1ee90', idna_status::mapped},
-    {U'\x1ee91', U'\x1ee91', idna_status::mapped},
-    {U'\x1ee92', U'\x1ee92', idna_status::mapped},
-    {U'\x1ee93', U'\x1ee93', idna_status::mapped},
-    {U'\x1ee94', U'\x1ee94', idna_status::mapped},
-    {U'\x1ee95', U'\x1ee95', idna_status::mapped},
-    {U'\x1ee96', U'\x1ee96', idna_status::mapped},
-    {U'\x1ee97', U'\x1ee97', idna_status::mapped},
-    {U'\x1ee98', U'\x1ee98', idna_status::mapped},
-    {U'\x1ee99', U'\x1ee99', idna_status::mapped},
-    {U'\x1ee9a', U'\x1ee9a', idna_status::mapped},
-    {U'\x1ee9b', U'\x1ee9b', idna_status::mapped},
-    {U'\x1ee9c', U'\x1eea0', idna_status::disallowed},
-    {U'\x1eea1', U'\x1eea1', idna_status::mapped},
-    {U'\x1eea2', U'\x1eea2', idna_status::mapped},
-    {U'\x1eea3', U'\x1eea3', idna_status::mapped},
-    {U'\x1eea4', U'\x1eea4', idna_status::disallowed},
-    {U'\x1eea5', U'\x1eea5', idna_status::mapped},
-    {U'\x1eea6', U'\x1eea6', idna_status::mapped},
-    {U'\x1eea7', U'\x1eea7', idna_status::mapped},
-    {U'\x1eea8', U'\x1eea8', idna_status::mapped},
-    {U'\x1eea9', U'\x1eea9', idna_status::mapped},
-    {U'\x1eeaa', U'\x1eeaa', idna_status::disallowed},
-    {U'\x1eeab', U'\x1eeab', idna_status::mapped},
-    {U'\x1eeac', U'\x1eeac', idna_status::mapped},
-    {U'\x1eead', U'\x1eead', idna_status::mapped},
-    {U'\x1eeae', U'\x1eeae', idna_status::mapped},
-    {U'\x1eeaf', U'\x1eeaf', idna_status::mapped},
-    {U'\x1eeb0', U'\x1eeb0', idna_status::mapped},
-    {U'\x1eeb1', U'\x1eeb1', idna_status::mapped},
-    {U'\x1eeb2', U'\x1eeb2', idna_status::mapped},
-    {U'\x1eeb3', U'\x1eeb3', idna_status::mapped},
-    {U'\x1eeb4', U'\x1eeb4', idna_status::mapped},
-    {U'\x1eeb5', U'\x1eeb5', idna_status::mapped},
-    {U'\x1eeb6', U'\x1eeb6', idna_status::mapped},
-    {U'\x1eeb7', U'\x1eeb7', idna_status::mapped},
-    {U'\x1eeb8', U'\x1eeb8', idna_status::mapped},
-    {U'\x1eeb9', U'\x1eeb9', idna_status::mapped},
-    {U'\x1eeba', U'\x1eeba', idna_status::mapped},
-    {U'\x1eebb', U'\x1eebb', idna_status::mapped},
-    {U'\x1eebc', U'\x1eeef', idna_status::disallowed},
-    {U'\x1eef2', U'\x1efff', idna_status::disallowed},
-    {U'\x1f02c', U'\x1f02f', idna_status::disallowed},
-    {U'\x1f094', U'\x1f09f', idna_status::disallowed},
-    {U'\x1f0af', U'\x1f0b0', idna_status::disallowed},
-    {U'\x1f0c0', U'\x1f0c0', idna_status::disallowed},
-    {U'\x1f0d0', U'\x1f0d0', idna_status::disallowed},
-    {U'\x1f0f6', U'\x1f0ff', idna_status::disallowed},
-    {U'\x1f100', U'\x1f100', idna_status::disallowed},
-    {U'\x1f101', U'\x1f101', idna_status::disallowed_std3_mapped},
-    {U'\x1f102', U'\x1f102', idna_status::disallowed_std3_mapped},
-    {U'\x1f103', U'\x1f103', idna_status::disallowed_std3_mapped},
-    {U'\x1f104', U'\x1f104', idna_status::disallowed_std3_mapped},
-    {U'\x1f105', U'\x1f105', idna_status::disallowed_std3_mapped},
-    {U'\x1f106', U'\x1f106', idna_status::disallowed_std3_mapped},
-    {U'\x1f107', U'\x1f107', idna_status::disallowed_std3_mapped},
-    {U'\x1f108', U'\x1f108', idna_status::disallowed_std3_mapped},
-    {U'\x1f109', U'\x1f109', idna_status::disallowed_std3_mapped},
-    {U'\x1f10a', U'\x1f10a', idna_status::disallowed_std3_mapped},
-    {U'\x1f110', U'\x1f110', idna_status::disallowed_std3_mapped},
-    {U'\x1f111', U'\x1f111', idna_status::disallowed_std3_mapped},
-    {U'\x1f112', U'\x1f112', idna_status::disallowed_std3_mapped},
-    {U'\x1f113', U'\x1f113', idna_status::disallowed_std3_mapped},
-    {U'\x1f114', U'\x1f114', idna_status::disallowed_std3_mapped},
-    {U'\x1f115', U'\x1f115', idna_status::disallowed_std3_mapped},
-    {U'\x1f116', U'\x1f116', idna_status::disallowed_std3_mapped},
-    {U'\x1f117', U'\x1f117', idna_status::disallowed_std3_mapped},
-    {U'\x1f118', U'\x1f118', idna_status::disallowed_std3_mapped},
-    {U'\x1f119', U'\x1f119', idna_status::disallowed_std3_mapped},
-    {U'\x1f11a', U'\x1f11a', idna_status::disallowed_std3_mapped},
-    {U'\x1f11b', U'\x1f11b', idna_status::disallowed_std3_mapped},
-    {U'\x1f11c', U'\x1f11c', idna_status::disallowed_std3_mapped},
-    {U'\x1f11d', U'\x1f11d', idna_status::disallowed_std3_mapped},
-    {U'\x1f11e', U'\x1f11e', idna_status::disallowed_std3_mapped},
-    {U'\x1f11f', U'\x1f11f', idna_status::disallowed_std3_mapped},
-    {U'\x1f120', U'\x1f120', idna_status::disallowed_std3_mapped},
-    {U'\x1f121', U'\x1f121', idna_status::disallowed_std3_mapped},
-    {U'\x1f122', U'\x1f122', idna_status::disallowed_std3_mapped},
-    {U'\x1f123', U'\x1f123', idna_status::disallowed_std3_mapped},
-    {U'\x1f124', U'\x1f124', idna_status::disallowed_std3_mapped},
-    {U'\x1f125', U'\x1f125', idna_status::disallowed_std3_mapped},
-    {U'\x1f126', U'\x1f126', idna_status::disallowed_std3_mapped},
-    {U'\x1f127', U'\x1f127', idna_status::disallowed_std3_mapped},
-    {U'\x1f128', U'\x1f128', idna_status::disallowed_std3_mapped},
-    {U'\x1f129', U'\x1f129', idna_status::disallowed_std3_mapped},
-    {U'\x1f12a', U'\x1f12a', idna_status::mapped},
-    {U'\x1f12b', U'\x1f12b', idna_status::mapped},
-    {U'\x1f12c', U'\x1f12c', idna_status::mapped},
-    {U'\x1f12d', U'\x1f12d', idna_status::mapped},
-    {U'\x1f12e', U'\x1f12e', idna_status::mapped},
-    {U'\x1f130', U'\x1f130', idna_status::mapped},
-    {U'\x1f131', U'\x1f131', idna_status::mapped},
-    {U'\x1f132', U'\x1f132', idna_status::mapped},
-    {U'\x1f133', U'\x1f133', idna_status::mapped},
-    {U'\x1f134', U'\x1f134', idna_status::mapped},
-    {U'\x1f135', U'\x1f135', idna_status::mapped},
-    {U'\x1f136', U'\x1f136', idna_status::mapped},
-    {U'\x1f137', U'\x1f137', idna_status::mapped},
-    {U'\x1f138', U'\x1f138', idna_status::mapped},
-    {U'\x1f139', U'\x1f139', idna_status::mapped},
-    {U'\x1f13a', U'\x1f13a', idna_status::mapped},
-    {U'\x1f13b', U'\x1f13b', idna_status::mapped},
-    {U'\x1f13c', U'\x1f13c', idna_status::mapped},
-    {U'\x1f13d', U'\x1f13d', idna_status::mapped},
-    {U'\x1f13e', U'\x1f13e', idna_status::mapped},
-    {U'\x1f13f', U'\x1f13f', idna_status::mapped},
-    {U'\x1f140', U'\x1f140', idna_status::mapped},
-    {U'\x1f141', U'\x1f141', idna_status::mapped},
-    {U'\x1f142', U'\x1f142', idna_status::mapped},
-    {U'\x1f143', U'\x1f143', idna_status::mapped},
-    {U'\x1f144', U'\x1f144', idna_status::mapped},
-    {U'\x1f145', U'\x1f145', idna_status::mapped},
-    {U'\x1f146', U'\x1f146', idna_status::mapped},
-    {U'\x1f147', U'\x1f147', idna_status::mapped},
-    {U'\x1f148', U'\x1f148', idna_status::mapped},
-    {U'\x1f149', U'\x1f149', idna_status::mapped},
-    {U'\x1f14a', U'\x1f14a', idna_status::mapped},
-    {U'\x1f14b', U'\x1f14b', idna_status::mapped},
-    {U'\x1f14c', U'\x1f14c', idna_status::mapped},
-    {U'\x1f14d', U'\x1f14d', idna_status::mapped},
-    {U'\x1f14e', U'\x1f14e', idna_status::mapped},
-    {U'\x1f14f', U'\x1f14f', idna_status::mapped},
-    {U'\x1f16a', U'\x1f16a', idna_status::mapped},
-    {U'\x1f16b', U'\x1f16b', idna_status::mapped},
-    {U'\x1f16c', U'\x1f16c', idna_status::mapped},
-    {U'\x1f190', U'\x1f190', idna_status::mapped},
-    {U'\x1f1ae', U'\x1f1e5', idna_status::disallowed},
-    {U'\x1f200', U'\x1f200', idna_status::mapped},
-    {U'\x1f201', U'\x1f201', idna_status::mapped},
-    {U'\x1f202', U'\x1f202', idna_status::mapped},
-    {U'\x1f203', U'\x1f20f', idna_status::disallowed},
-    {U'\x1f210', U'\x1f210', idna_status::mapped},
-    {U'\x1f211', U'\x1f211', idna_status::mapped},
-    {U'\x1f212', U'\x1f212', idna_status::mapped},
-    {U'\x1f213', U'\x1f213', idna_status::mapped},
-    {U'\x1f214', U'\x1f214', idna_status::mapped},
-    {U'\x1f215', U'\x1f215', idna_status::mapped},
-    {U'\x1f216', U'\x1f216', idna_status::mapped},
-    {U'\x1f217', U'\x1f217', idna_status::mapped},
-    {U'\x1f218', U'\x1f218', idna_status::mapped},
-    {U'\x1f219', U'\x1f219', idna_status::mapped},
-    {U'\x1f21a', U'\x1f21a', idna_status::mapped},
-    {U'\x1f21b', U'\x1f21b', idna_status::mapped},
-    {U'\x1f21c', U'\x1f21c', idna_status::mapped},
-    {U'\x1f21d', U'\x1f21d', idna_status::mapped},
-    {U'\x1f21e', U'\x1f21e', idna_status::mapped},
-    {U'\x1f21f', U'\x1f21f', idna_status::mapped},
-    {U'\x1f220', U'\x1f220', idna_status::mapped},
-    {U'\x1f221', U'\x1f221', idna_status::mapped},
-    {U'\x1f222', U'\x1f222', idna_status::mapped},
-    {U'\x1f223', U'\x1f223', idna_status::mapped},
-    {U'\x1f224', U'\x1f224', idna_status::mapped},
-    {U'\x1f225', U'\x1f225', idna_status::mapped},
-    {U'\x1f226', U'\x1f226', idna_status::mapped},
-    {U'\x1f227', U'\x1f227', idna_status::mapped},
-    {U'\x1f228', U'\x1f228', idna_status::mapped},
-    {U'\x1f229', U'\x1f229', idna_status::mapped},
-    {U'\x1f22a', U'\x1f22a', idna_status::mapped},
-    {U'\x1f22b', U'\x1f22b', idna_status::mapped},
-    {U'\x1f22c', U'\x1f22c', idna_status::mapped},
-    {U'\x1f22d', U'\x1f22d', idna_status::mapped},
-    {U'\x1f22e', U'\x1f22e', idna_status::mapped},
-    {U'\x1f22f', U'\x1f22f', idna_status::mapped},
-    {U'\x1f230', U'\x1f230', idna_status::mapped},
-    {U'\x1f231', U'\x1f231', idna_status::mapped},
-    {U'\x1f232', U'\x1f232', idna_status::mapped},
-    {U'\x1f233', U'\x1f233', idna_status::mapped},
-    {U'\x1f234', U'\x1f234', idna_status::mapped},
-    {U'\x1f235', U'\x1f235', idna_status::mapped},
-    {U'\x1f236', U'\x1f236', idna_status::mapped},
-    {U'\x1f237', U'\x1f237', idna_status::mapped},
-    {U'\x1f238', U'\x1f238', idna_status::mapped},
-    {U'\x1f239', U'\x1f239', idna_status::mapped},
-    {U'\x1f23a', U'\x1f23a', idna_status::mapped},
-    {U'\x1f23b', U'\x1f23b', idna_status::mapped},
-    {U'\x1f23c', U'\x1f23f', idna_status::disallowed},
-    {U'\x1f240', U'\x1f240', idna_status::mapped},
-    {U'\x1f241', U'\x1f241', idna_status::mapped},
-    {U'\x1f242', U'\x1f242', idna_status::mapped},
-    {U'\x1f243', U'\x1f243', idna_status::mapped},
-    {U'\x1f244', U'\x1f244', idna_status::mapped},
-    {U'\x1f245', U'\x1f245', idna_status::mapped},
-    {U'\x1f246', U'\x1f246', idna_status::mapped},
-    {U'\x1f247', U'\x1f247', idna_status::mapped},
-    {U'\x1f248', U'\x1f248', idna_status::mapped},
-    {U'\x1f249', U'\x1f24f', idna_status::disallowed},
-    {U'\x1f250', U'\x1f250', idna_status::mapped},
-    {U'\x1f251', U'\x1f251', idna_status::mapped},
-    {U'\x1f252', U'\x1f25f', idna_status::disallowed},
-    {U'\x1f266', U'\x1f2ff', idna_status::disallowed},
-    {U'\x1f6d8', U'\x1f6db', idna_status::disallowed},
-    {U'\x1f6ed', U'\x1f6ef', idna_status::disallowed},
-    {U'\x1f6fd', U'\x1f6ff', idna_status::disallowed},
-    {U'\x1f777', U'\x1f77a', idna_status::disallowed},
-    {U'\x1f7da', U'\x1f7df', idna_status::disallowed},
-    {U'\x1f7ec', U'\x1f7ef', idna_status::disallowed},
-    {U'\x1f7f1', U'\x1f7ff', idna_status::disallowed},
-    {U'\x1f80c', U'\x1f80f', idna_status::disallowed},
-    {U'\x1f848', U'\x1f84f', idna_status::disallowed},
-    {U'\x1f85a', U'\x1f85f', idna_status::disallowed},
-    {U'\x1f888', U'\x1f88f', idna_status::disallowed},
-    {U'\x1f8ae', U'\x1f8af', idna_status::disallowed},
-    {U'\x1f8b2', U'\x1f8ff', idna_status::disallowed},
-    {U'\x1fa54', U'\x1fa5f', idna_status::disallowed},
-    {U'\x1fa6e', U'\x1fa6f', idna_status::disallowed},
-    {U'\x1fa7d', U'\x1fa7f', idna_status::disallowed},
-    {U'\x1fa89', U'\x1fa8f', idna_status::disallowed},
-    {U'\x1fabe', U'\x1fabe', idna_status::disallowed},
-    {U'\x1fac6', U'\x1facd', idna_status::disallowed},
-    {U'\x1fadc', U'\x1fadf', idna_status::disallowed},
-    {U'\x1fae9', U'\x1faef', idna_status::disallowed},
-    {U'\x1faf9', U'\x1faff', idna_status::disallowed},
-    {U'\x1fb93', U'\x1fb93', idna_status::disallowed},
-    {U'\x1fbcb', U'\x1fbef', idna_status::disallowed},
-    {U'\x1fbf0', U'\x1fbf0', idna_status::mapped},
-    {U'\x1fbf1', U'\x1fbf1', idna_status::mapped},
-    {U'\x1fbf2', U'\x1fbf2', idna_status::mapped},
-    {U'\x1fbf3', U'\x1fbf3', idna_status::mapped},
-    {U'\x1fbf4', U'\x1fbf4', idna_status::mapped},
-    {U'\x1fbf5', U'\x1fbf5', idna_status::mapped},
-    {U'\x1fbf6', U'\x1fbf6', idna_status::mapped},
-    {U'\x1fbf7', U'\x1fbf7', idna_status::mapped},
-    {U'\x1fbf8', U'\x1fbf8', idna_status::mapped},
-    {U'\x1fbf9', U'\x1fbf9', idna_status::mapped},
-    {U'\x1fbfa', U'\x1fffd', idna_status::disallowed},
-    {U'\x1fffe', U'\x1ffff', idna_status::disallowed},
-    {U'\x2a6e0', U'\x2a6ff', idna_status::disallowed},
-    {U'\x2b73a', U'\x2b73f', idna_status::disallowed},
-    {U'\x2b81e', U'\x2b81f', idna_status::disallowed},
-    {U'\x2cea2', U'\x2ceaf', idna_status::disallowed},
-    {U'\x2ebe1', U'\x2ebef', idna_status::disallowed},
-    {U'\x2ee5e', U'\x2f7ff', idna_status::disallowed},
-    {U'\x2f800', U'\x2f800', idna_status::mapped},
-    {U'\x2f801', U'\x2f801', idna_status::mapped},
-    {U'\x2f802', U'\x2f802', idna_status::mapped},
-    {U'\x2f803', U'\x2f803', idna_status::mapped},
-    {U'\x2f804', U'\x2f804', idna_status::mapped},
-    {U'\x2f805', U'\x2f805', idna_status::mapped},
-    {U'\x2f806', U'\x2f806', idna_status::mapped},
-    {U'\x2f807', U'\x2f807', idna_status::mapped},
-    {U'\x2f808', U'\x2f808', idna_status::mapped},
-    {U'\x2f809', U'\x2f809', idna_status::mapped},
-    {U'\x2f80a', U'\x2f80a', idna_status::mapped},
-    {U'\x2f80b', U'\x2f80b', idna_status::mapped},
-    {U'\x2f80c', U'\x2f80c', idna_status::mapped},
-    {U'\x2f80d', U'\x2f80d', idna_status::mapped},
-    {U'\x2f80e', U'\x2f80e', idna_status::mapped},
-    {U'\x2f80f', U'\x2f80f', idna_status::mapped},
-    {U'\x2f810', U'\x2f810', idna_status::mapped},
-    {U'\x2f811', U'\x2f811', idna_status::mapped},
-    {U'\x2f812', U'\x2f812', idna_status::mapped},
-    {U'\x2f813', U'\x2f813', idna_status::mapped},
-    {U'\x2f814', U'\x2f814', idna_status::mapped},
-    {U'\x2f815', U'\x2f815', idna_status::mapped},
-    {U'\x2f816', U'\x2f816', idna_status::mapped},
-    {U'\x2f817', U'\x2f817', idna_status::mapped},
-    {U'\x2f818', U'\x2f818', idna_status::mapped},
-    {U'\x2f819', U'\x2f819', idna_status::mapped},
-    {U'\x2f81a', U'\x2f81a', idna_status::mapped},
-    {U'\x2f81b', U'\x2f81b', idna_status::mapped},
-    {U'\x2f81c', U'\x2f81c', idna_status::mapped},
-    {U'\x2f81d', U'\x2f81d', idna_status::mapped},
-    {U'\x2f81e', U'\x2f81e', idna_status::mapped},
-    {U'\x2f81f', U'\x2f81f', idna_status::mapped},
-    {U'\x2f820', U'\x2f820', idna_status::mapped},
-    {U'\x2f821', U'\x2f821', idna_status::mapped},
-    {U'\x2f822', U'\x2f822', idna_status::mapped},
-    {U'\x2f823', U'\x2f823', idna_status::mapped},
-    {U'\x2f824', U'\x2f824', idna_status::mapped},
-    {U'\x2f825', U'\x2f825', idna_status::mapped},
-    {U'\x2f826', U'\x2f826', idna_status::mapped},
-    {U'\x2f827', U'\x2f827', idna_status::mapped},
-    {U'\x2f828', U'\x2f828', idna_status::mapped},
-    {U'\x2f829', U'\x2f829', idna_status::mapped},
-    {U'\x2f82a', U'\x2f82a', idna_status::mapped},
-    {U'\x2f82b', U'\x2f82b', idna_status::mapped},
-    {U'\x2f82c', U'\x2f82c', idna_status::mapped},
-    {U'\x2f82d', U'\x2f82d', idna_status::mapped},
-    {U'\x2f82e', U'\x2f82e', idna_status::mapped},
-    {U'\x2f82f', U'\x2f82f', idna_status::mapped},
-    {U'\x2f830', U'\x2f830', idna_status::mapped},
-    {U'\x2f831', U'\x2f833', idna_status::mapped},
-    {U'\x2f834', U'\x2f834', idna_status::mapped},
-    {U'\x2f835', U'\x2f835', idna_status::mapped},
-    {U'\x2f836', U'\x2f836', idna_status::mapped},
-    {U'\x2f837', U'\x2f837', idna_status::mapped},
-    {U'\x2f838', U'\x2f838', idna_status::mapped},
-    {U'\x2f839', U'\x2f839', idna_status::mapped},
-    {U'\x2f83a', U'\x2f83a', idna_status::mapped},
-    {U'\x2f83b', U'\x2f83b', idna_status::mapped},
-    {U'\x2f83c', U'\x2f83c', idna_status::mapped},
-    {U'\x2f83d', U'\x2f83d', idna_status::mapped},
-    {U'\x2f83e', U'\x2f83e', idna_status::mapped},
-    {U'\x2f83f', U'\x2f83f', idna_status::mapped},
-    {U'\x2f840', U'\x2f840', idna_status::mapped},
-    {U'\x2f841', U'\x2f841', idna_status::mapped},
-    {U'\x2f842', U'\x2f842', idna_status::mapped},
-    {U'\x2f843', U'\x2f843', idna_status::mapped},
-    {U'\x2f844', U'\x2f844', idna_status::mapped},
-    {U'\x2f845', U'\x2f846', idna_status::mapped},
-    {U'\x2f847', U'\x2f847', idna_status::mapped},
-    {U'\x2f848', U'\x2f848', idna_status::mapped},
-    {U'\x2f849', U'\x2f849', idna_status::mapped},
-    {U'\x2f84a', U'\x2f84a', idna_status::mapped},
-    {U'\x2f84b', U'\x2f84b', idna_status::mapped},
-    {U'\x2f84c', U'\x2f84c', idna_status::mapped},
-    {U'\x2f84d', U'\x2f84d', idna_status::mapped},
-    {U'\x2f84e', U'\x2f84e', idna_status::mapped},
-    {U'\x2f84f', U'\x2f84f', idna_status::mapped},
-    {U'\x2f850', U'\x2f850', idna_status::mapped},
-    {U'\x2f851', U'\x2f851', idna_status::mapped},
-    {U'\x2f852', U'\x2f852', idna_status::mapped},
-    {U'\x2f853', U'\x2f853', idna_status::mapped},
-    {U'\x2f854', U'\x2f854', idna_status::mapped},
-    {U'\x2f855', U'\x2f855', idna_status::mapped},
-    {U'\x2f856', U'\x2f856', idna_status::mapped},
-    {U'\x2f857', U'\x2f857', idna_status::mapped},
-    {U'\x2f858', U'\x2f858', idna_status::mapped},
-    {U'\x2f859', U'\x2f859', idna_status::mapped},
-    {U'\x2f85a', U'\x2f85a', idna_status::mapped},
-    {U'\x2f85b', U'\x2f85b', idna_status::mapped},
-    {U'\x2f85c', U'\x2f85c', idna_status::mapped},
-    {U'\x2f85d', U'\x2f85d', idna_status::mapped},
-    {U'\x2f85e', U'\x2f85e', idna_status::mapped},
-    {U'\x2f85f', U'\x2f85f', idna_status::mapped},
-    {U'\x2f860', U'\x2f860', idna_status::mapped},
-    {U'\x2f861', U'\x2f861', idna_status::mapped},
-    {U'\x2f862', U'\x2f862', idna_status::mapped},
-    {U'\x2f863', U'\x2f863', idna_status::mapped},
-    {U'\x2f864', U'\x2f864', idna_status::mapped},
-    {U'\x2f865', U'\x2f865', idna_status::mapped},
-    {U'\x2f866', U'\x2f866', idna_status::mapped},
-    {U'\x2f867', U'\x2f867', idna_status::mapped},
-    {U'\x2f868', U'\x2f868', idna_status::disallowed},
-    {U'\x2f869', U'\x2f869', idna_status::mapped},
-    {U'\x2f86a', U'\x2f86b', idna_status::mapped},
-    {U'\x2f86c', U'\x2f86c', idna_status::mapped},
-    {U'\x2f86d', U'\x2f86d', idna_status::mapped},
-    {U'\x2f86e', U'\x2f86e', idna_status::mapped},
-    {U'\x2f86f', U'\x2f86f', idna_status::mapped},
-    {U'\x2f870', U'\x2f870', idna_status::mapped},
-    {U'\x2f871', U'\x2f871', idna_status::mapped},
-    {U'\x2f872', U'\x2f872', idna_status::mapped},
-    {U'\x2f873', U'\x2f873', idna_status::mapped},
-    {U'\x2f874', U'\x2f874', idna_status::disallowed},
-    {U'\x2f875', U'\x2f875', idna_status::mapped},
-    {U'\x2f876', U'\x2f876', idna_status::mapped},
-    {U'\x2f877', U'\x2f877', idna_status::mapped},
-    {U'\x2f878', U'\x2f878', idna_status::mapped},
-    {U'\x2f879', U'\x2f879', idna_status::mapped},
-    {U'\x2f87a', U'\x2f87a', idna_status::mapped},
-    {U'\x2f87b', U'\x2f87b', idna_status::mapped},
-    {U'\x2f87c', U'\x2f87c', idna_status::mapped},
-    {U'\x2f87d', U'\x2f87d', idna_status::mapped},
-    {U'\x2f87e', U'\x2f87e', idna_status::mapped},
-    {U'\x2f87f', U'\x2f87f', idna_status::mapped},
-    {U'\x2f880', U'\x2f880', idna_status::mapped},
-    {U'\x2f881', U'\x2f881', idna_status::mapped},
-    {U'\x2f882', U'\x2f882', idna_status::mapped},
-    {U'\x2f883', U'\x2f883', idna_status::mapped},
-    {U'\x2f884', U'\x2f884', idna_status::mapped},
-    {U'\x2f885', U'\x2f885', idna_status::mapped},
-    {U'\x2f886', U'\x2f886', idna_status::mapped},
-    {U'\x2f887', U'\x2f887', idna_status::mapped},
-    {U'\x2f888', U'\x2f888', idna_status::mapped},
-    {U'\x2f889', U'\x2f889', idna_status::mapped},
-    {U'\x2f88a', U'\x2f88a', idna_status::mapped},
-    {U'\x2f88b', U'\x2f88b', idna_status::mapped},
-    {U'\x2f88c', U'\x2f88c', idna_status::mapped},
-    {U'\x2f88d', U'\x2f88d', idna_status::mapped},
-    {U'\x2f88e', U'\x2f88e', idna_status::mapped},
-    {U'\x2f88f', U'\x2f88f', idna_status::mapped},
-    {U'\x2f890', U'\x2f890', idna_status::mapped},
-    {U'\x2f891', U'\x2f892', idna_status::mapped},
-    {U'\x2f893', U'\x2f893', idna_status::mapped},
-    {U'\x2f894', U'\x2f895', idna_status::mapped},
-    {U'\x2f896', U'\x2f896', idna_status::mapped},
-    {U'\x2f897', U'\x2f897', idna_status::mapped},
-    {U'\x2f898', U'\x2f898', idna_status::mapped},
-    {U'\x2f899', U'\x2f899', idna_status::mapped},
-    {U'\x2f89a', U'\x2f89a', idna_status::mapped},
-    {U'\x2f89b', U'\x2f89b', idna_status::mapped},
-    {U'\x2f89c', U'\x2f89c', idna_status::mapped},
-    {U'\x2f89d', U'\x2f89d', idna_status::mapped},
-    {U'\x2f89e', U'\x2f89e', idna_status::mapped},
-    {U'\x2f89f', U'\x2f89f', idna_status::mapped},
-    {U'\x2f8a0', U'\x2f8a0', idna_status::mapped},
-    {U'\x2f8a1', U'\x2f8a1', idna_status::mapped},
-    {U'\x2f8a2', U'\x2f8a2', idna_status::mapped},
-    {U'\x2f8a3', U'\x2f8a3', idna_status::mapped},
-    {U'\x2f8a4', U'\x2f8a4', idna_status::mapped},
-    {U'\x2f8a5', U'\x2f8a5', idna_status::mapped},
-    {U'\x2f8a6', U'\x2f8a6', idna_status::mapped},
-    {U'\x2f8a7', U'\x2f8a7', idna_status::mapped},
-    {U'\x2f8a8', U'\x2f8a8', idna_status::mapped},
-    {U'\x2f8a9', U'\x2f8a9', idna_status::mapped},
-    {U'\x2f8aa', U'\x2f8aa', idna_status::mapped},
-    {U'\x2f8ab', U'\x2f8ab', idna_status::mapped},
-    {U'\x2f8ac', U'\x2f8ac', idna_status::mapped},
-    {U'\x2f8ad', U'\x2f8ad', idna_status::mapped},
-    {U'\x2f8ae', U'\x2f8ae', idna_status::mapped},
-    {U'\x2f8af', U'\x2f8af', idna_status::mapped},
-    {U'\x2f8b0', U'\x2f8b0', idna_status::mapped},
-    {U'\x2f8b1', U'\x2f8b1', idna_status::mapped},
-    {U'\x2f8b2', U'\x2f8b2', idna_status::mapped},
-    {U'\x2f8b3', U'\x2f8b3', idna_status::mapped},
-    {U'\x2f8b4', U'\x2f8b4', idna_status::mapped},
-    {U'\x2f8b5', U'\x2f8b5', idna_status::mapped},
-    {U'\x2f8b6', U'\x2f8b6', idna_status::mapped},
-    {U'\x2f8b7', U'\x2f8b7', idna_status::mapped},
-    {U'\x2f8b8', U'\x2f8b8', idna_status::mapped},
-    {U'\x2f8b9', U'\x2f8b9', idna_status::mapped},
-    {U'\x2f8ba', U'\x2f8ba', idna_status::mapped},
-    {U'\x2f8bb', U'\x2f8bb', idna_status::mapped},
-    {U'\x2f8bc', U'\x2f8bc', idna_status::mapped},
-    {U'\x2f8bd', U'\x2f8bd', idna_status::mapped},
-    {U'\x2f8be', U'\x2f8be', idna_status::mapped},
-    {U'\x2f8bf', U'\x2f8bf', idna_status::mapped},
-    {U'\x2f8c0', U'\x2f8c0', idna_status::mapped},
-    {U'\x2f8c1', U'\x2f8c1', idna_status::mapped},
-    {U'\x2f8c2', U'\x2f8c2', idna_status::mapped},
-    {U'\x2f8c3', U'\x2f8c3', idna_status::mapped},
-    {U'\x2f8c4', U'\x2f8c4', idna_status::mapped},
-    {U'\x2f8c5', U'\x2f8c5', idna_status::mapped},
-    {U'\x2f8c6', U'\x2f8c6', idna_status::mapped},
-    {U'\x2f8c7', U'\x2f8c7', idna_status::mapped},
-    {U'\x2f8c8', U'\x2f8c8', idna_status::mapped},
-    {U'\x2f8c9', U'\x2f8c9', idna_status::mapped},
-    {U'\x2f8ca', U'\x2f8ca', idna_status::mapped},
-    {U'\x2f8cb', U'\x2f8cb', idna_status::mapped},
-    {U'\x2f8cc', U'\x2f8cc', idna_status::mapped},
-    {U'\x2f8cd', U'\x2f8cd', idna_status::mapped},
-    {U'\x2f8ce', U'\x2f8ce', idna_status::mapped},
-    {U'\x2f8cf', U'\x2f8cf', idna_status::mapped},
-    {U'\x2f8d0', U'\x2f8d0', idna_status::mapped},
-    {U'\x2f8d1', U'\x2f8d1', idna_status::mapped},
-    {U'\x2f8d2', U'\x2f8d2', idna_status::mapped},
-    {U'\x2f8d3', U'\x2f8d3', idna_status::mapped},
-    {U'\x2f8d4', U'\x2f8d4', idna_status::mapped},
-    {U'\x2f8d5', U'\x2f8d5', idna_status::mapped},
-    {U'\x2f8d6', U'\x2f8d6', idna_status::mapped},
-    {U'\x2f8d7', U'\x2f8d7', idna_status::mapped},
-    {U'\x2f8d8', U'\x2f8d8', idna_status::mapped},
-    {U'\x2f8d9', U'\x2f8d9', idna_status::mapped},
-    {U'\x2f8da', U'\x2f8da', idna_status::mapped},
-    {U'\x2f8db', U'\x2f8db', idna_status::mapped},
-    {U'\x2f8dc', U'\x2f8dc', idna_status::mapped},
-    {U'\x2f8dd', U'\x2f8dd', idna_status::mapped},
-    {U'\x2f8de', U'\x2f8de', idna_status::mapped},
-    {U'\x2f8df', U'\x2f8df', idna_status::mapped},
-    {U'\x2f8e0', U'\x2f8e0', idna_status::mapped},
-    {U'\x2f8e1', U'\x2f8e1', idna_status::mapped},
-    {U'\x2f8e2', U'\x2f8e2', idna_status::mapped},
-    {U'\x2f8e3', U'\x2f8e3', idna_status::mapped},
-    {U'\x2f8e4', U'\x2f8e4', idna_status::mapped},
-    {U'\x2f8e5', U'\x2f8e5', idna_status::mapped},
-    {U'\x2f8e6', U'\x2f8e6', idna_status::mapped},
-    {U'\x2f8e7', U'\x2f8e7', idna_status::mapped},
-    {U'\x2f8e8', U'\x2f8e8', idna_status::mapped},
-    {U'\x2f8e9', U'\x2f8e9', idna_status::mapped},
-    {U'\x2f8ea', U'\x2f8ea', idna_status::mapped},
-    {U'\x2f8eb', U'\x2f8eb', idna_status::mapped},
-    {U'\x2f8ec', U'\x2f8ec', idna_status::mapped},
-    {U'\x2f8ed', U'\x2f8ed', idna_status::mapped},
-    {U'\x2f8ee', U'\x2f8ee', idna_status::mapped},
-    {U'\x2f8ef', U'\x2f8ef', idna_status::mapped},
-    {U'\x2f8f0', U'\x2f8f0', idna_status::mapped},
-    {U'\x2f8f1', U'\x2f8f1', idna_status::mapped},
-    {U'\x2f8f2', U'\x2f8f2', idna_status::mapped},
-    {U'\x2f8f3', U'\x2f8f3', idna_status::mapped},
-    {U'\x2f8f4', U'\x2f8f4', idna_status::mapped},
-    {U'\x2f8f5', U'\x2f8f5', idna_status::mapped},
-    {U'\x2f8f6', U'\x2f8f6', idna_status::mapped},
-    {U'\x2f8f7', U'\x2f8f7', idna_status::mapped},
-    {U'\x2f8f8', U'\x2f8f8', idna_status::mapped},
-    {U'\x2f8f9', U'\x2f8f9', idna_status::mapped},
-    {U'\x2f8fa', U'\x2f8fa', idna_status::mapped},
-    {U'\x2f8fb', U'\x2f8fb', idna_status::mapped},
-    {U'\x2f8fc', U'\x2f8fc', idna_status::mapped},
-    {U'\x2f8fd', U'\x2f8fd', idna_status::mapped},
-    {U'\x2f8fe', U'\x2f8fe', idna_status::mapped},
-    {U'\x2f8ff', U'\x2f8ff', idna_status::mapped},
-    {U'\x2f900', U'\x2f900', idna_status::mapped},
-    {U'\x2f901', U'\x2f901', idna_status::mapped},
-    {U'\x2f902', U'\x2f902', idna_status::mapped},
-    {U'\x2f903', U'\x2f903', idna_status::mapped},
-    {U'\x2f904', U'\x2f904', idna_status::mapped},
-    {U'\x2f905', U'\x2f905', idna_status::mapped},
-    {U'\x2f906', U'\x2f906', idna_status::mapped},
-    {U'\x2f907', U'\x2f907', idna_status::mapped},
-    {U'\x2f908', U'\x2f908', idna_status::mapped},
-    {U'\x2f909', U'\x2f909', idna_status::mapped},
-    {U'\x2f90a', U'\x2f90a', idna_status::mapped},
-    {U'\x2f90b', U'\x2f90b', idna_status::mapped},
-    {U'\x2f90c', U'\x2f90c', idna_status::mapped},
-    {U'\x2f90d', U'\x2f90d', idna_status::mapped},
-    {U'\x2f90e', U'\x2f90e', idna_status::mapped},
-    {U'\x2f90f', U'\x2f90f', idna_status::mapped},
-    {U'\x2f910', U'\x2f910', idna_status::mapped},
-    {U'\x2f911', U'\x2f911', idna_status::mapped},
-    {U'\x2f912', U'\x2f912', idna_status::mapped},
-    {U'\x2f913', U'\x2f913', idna_status::mapped},
-    {U'\x2f914', U'\x2f914', idna_status::mapped},
-    {U'\x2f915', U'\x2f915', idna_status::mapped},
-    {U'\x2f916', U'\x2f916', idna_status::mapped},
-    {U'\x2f917', U'\x2f917', idna_status::mapped},
-    {U'\x2f918', U'\x2f918', idna_status::mapped},
-    {U'\x2f919', U'\x2f919', idna_status::mapped},
-    {U'\x2f91a', U'\x2f91a', idna_status::mapped},
-    {U'\x2f91b', U'\x2f91b', idna_status::mapped},
-    {U'\x2f91c', U'\x2f91c', idna_status::mapped},
-    {U'\x2f91d', U'\x2f91d', idna_status::mapped},
-    {U'\x2f91e', U'\x2f91e', idna_status::mapped},
-    {U'\x2f91f', U'\x2f91f', idna_status::disallowed},
-    {U'\x2f920', U'\x2f920', idna_status::mapped},
-    {U'\x2f921', U'\x2f921', idna_status::mapped},
-    {U'\x2f922', U'\x2f922', idna_status::mapped},
-    {U'\x2f923', U'\x2f923', idna_status::mapped},
-    {U'\x2f924', U'\x2f924', idna_status::mapped},
-    {U'\x2f925', U'\x2f925', idna_status::mapped},
-    {U'\x2f926', U'\x2f926', idna_status::mapped},
-    {U'\x2f927', U'\x2f927', idna_status::mapped},
-    {U'\x2f928', U'\x2f928', idna_status::mapped},
-    {U'\x2f929', U'\x2f929', idna_status::mapped},
-    {U'\x2f92a', U'\x2f92a', idna_status::mapped},
-    {U'\x2f92b', U'\x2f92b', idna_status::mapped},
-    {U'\x2f92c', U'\x2f92d', idna_status::mapped},
-    {U'\x2f92e', U'\x2f92e', idna_status::mapped},
-    {U'\x2f92f', U'\x2f92f', idna_status::mapped},
-    {U'\x2f930', U'\x2f930', idna_status::mapped},
-    {U'\x2f931', U'\x2f931', idna_status::mapped},
-    {U'\x2f932', U'\x2f932', idna_status::mapped},
-    {U'\x2f933', U'\x2f933', idna_status::mapped},
-    {U'\x2f934', U'\x2f934', idna_status::mapped},
-    {U'\x2f935', U'\x2f935', idna_status::mapped},
-    {U'\x2f936', U'\x2f936', idna_status::mapped},
-    {U'\x2f937', U'\x2f937', idna_status::mapped},
-    {U'\x2f938', U'\x2f938', idna_status::mapped},
-    {U'\x2f939', U'\x2f939', idna_status::mapped},
-    {U'\x2f93a', U'\x2f93a', idna_status::mapped},
-    {U'\x2f93b', U'\x2f93b', idna_status::mapped},
-    {U'\x2f93c', U'\x2f93c', idna_status::mapped},
-    {U'\x2f93d', U'\x2f93d', idna_status::mapped},
-    {U'\x2f93e', U'\x2f93e', idna_status::mapped},
-    {U'\x2f93f', U'\x2f93f', idna_status::mapped},
-    {U'\x2f940', U'\x2f940', idna_status::mapped},
-    {U'\x2f941', U'\x2f941', idna_status::mapped},
-    {U'\x2f942', U'\x2f942', idna_status::mapped},
-    {U'\x2f943', U'\x2f943', idna_status::mapped},
-    {U'\x2f944', U'\x2f944', idna_status::mapped},
-    {U'\x2f945', U'\x2f945', idna_status::mapped},
-    {U'\x2f946', U'\x2f947', idna_status::mapped},
-    {U'\x2f948', U'\x2f948', idna_status::mapped},
-    {U'\x2f949', U'\x2f949', idna_status::mapped},
-    {U'\x2f94a', U'\x2f94a', idna_status::mapped},
-    {U'\x2f94b', U'\x2f94b', idna_status::mapped},
-    {U'\x2f94c', U'\x2f94c', idna_status::mapped},
-    {U'\x2f94d', U'\x2f94d', idna_status::mapped},
-    {U'\x2f94e', U'\x2f94e', idna_status::mapped},
-    {U'\x2f94f', U'\x2f94f', idna_status::mapped},
-    {U'\x2f950', U'\x2f950', idna_status::mapped},
-    {U'\x2f951', U'\x2f951', idna_status::mapped},
-    {U'\x2f952', U'\x2f952', idna_status::mapped},
-    {U'\x2f953', U'\x2f953', idna_status::mapped},
-    {U'\x2f954', U'\x2f954', idna_status::mapped},
-    {U'\x2f955', U'\x2f955', idna_status::mapped},
-    {U'\x2f956', U'\x2f956', idna_status::mapped},
-    {U'\x2f957', U'\x2f957', idna_status::mapped},
-    {U'\x2f958', U'\x2f958', idna_status::mapped},
-    {U'\x2f959', U'\x2f959', idna_status::mapped},
-    {U'\x2f95a', U'\x2f95a', idna_status::mapped},
-    {U'\x2f95b', U'\x2f95b', idna_status::mapped},
-    {U'\x2f95c', U'\x2f95c', idna_status::mapped},
-    {U'\x2f95d', U'\x2f95e', idna_status::mapped},
-    {U'\x2f95f', U'\x2f95f', idna_status::disallowed},
-    {U'\x2f960', U'\x2f960', idna_status::mapped},
-    {U'\x2f961', U'\x2f961', idna_status::mapped},
-    {U'\x2f962', U'\x2f962', idna_status::mapped},
-    {U'\x2f963', U'\x2f963', idna_status::mapped},
-    {U'\x2f964', U'\x2f964', idna_status::mapped},
-    {U'\x2f965', U'\x2f965', idna_status::mapped},
-    {U'\x2f966', U'\x2f966', idna_status::mapped},
-    {U'\x2f967', U'\x2f967', idna_status::mapped},
-    {U'\x2f968', U'\x2f968', idna_status::mapped},
-    {U'\x2f969', U'\x2f969', idna_status::mapped},
-    {U'\x2f96a', U'\x2f96a', idna_status::mapped},
-    {U'\x2f96b', U'\x2f96b', idna_status::mapped},
-    {U'\x2f96c', U'\x2f96c', idna_status::mapped},
-    {U'\x2f96d', U'\x2f96d', idna_status::mapped},
-    {U'\x2f96e', U'\x2f96e', idna_status::mapped},
-    {U'\x2f96f', U'\x2f96f', idna_status::mapped},
-    {U'\x2f970', U'\x2f970', idna_status::mapped},
-    {U'\x2f971', U'\x2f971', idna_status::mapped},
-    {U'\x2f972', U'\x2f972', idna_status::mapped},
-    {U'\x2f973', U'\x2f973', idna_status::mapped},
-    {U'\x2f974', U'\x2f974', idna_status::mapped},
-    {U'\x2f975', U'\x2f975', idna_status::mapped},
-    {U'\x2f976', U'\x2f976', idna_status::mapped},
-    {U'\x2f977', U'\x2f977', idna_status::mapped},
-    {U'\x2f978', U'\x2f978', idna_status::mapped},
-    {U'\x2f979', U'\x2f979', idna_status::mapped},
-    {U'\x2f97a', U'\x2f97a', idna_status::mapped},
-    {U'\x2f97b', U'\x2f97b', idna_status::mapped},
-    {U'\x2f97c', U'\x2f97c', idna_status::mapped},
-    {U'\x2f97d', U'\x2f97d', idna_status::mapped},
-    {U'\x2f97e', U'\x2f97e', idna_status::mapped},
-    {U'\x2f97f', U'\x2f97f', idna_status::mapped},
-    {U'\x2f980', U'\x2f980', idna_status::mapped},
-    {U'\x2f981', U'\x2f981', idna_status::mapped},
-    {U'\x2f982', U'\x2f982', idna_status::mapped},
-    {U'\x2f983', U'\x2f983', idna_status::mapped},
-    {U'\x2f984', U'\x2f984', idna_status::mapped},
-    {U'\x2f985', U'\x2f985', idna_status::mapped},
-    {U'\x2f986', U'\x2f986', idna_status::mapped},
-    {U'\x2f987', U'\x2f987', idna_status::mapped},
-    {U'\x2f988', U'\x2f988', idna_status::mapped},
-    {U'\x2f989', U'\x2f989', idna_status::mapped},
-    {U'\x2f98a', U'\x2f98a', idna_status::mapped},
-    {U'\x2f98b', U'\x2f98b', idna_status::mapped},
-    {U'\x2f98c', U'\x2f98c', idna_status::mapped},
-    {U'\x2f98d', U'\x2f98d', idna_status::mapped},
-    {U'\x2f98e', U'\x2f98e', idna_status::mapped},
-    {U'\x2f98f', U'\x2f98f', idna_status::mapped},
-    {U'\x2f990', U'\x2f990', idna_status::mapped},
-    {U'\x2f991', U'\x2f991', idna_status::mapped},
-    {U'\x2f992', U'\x2f992', idna_status::mapped},
-    {U'\x2f993', U'\x2f993', idna_status::mapped},
-    {U'\x2f994', U'\x2f994', idna_status::mapped},
-    {U'\x2f995', U'\x2f995', idna_status::mapped},
-    {U'\x2f996', U'\x2f996', idna_status::mapped},
-    {U'\x2f997', U'\x2f997', idna_status::mapped},
-    {U'\x2f998', U'\x2f998', idna_status::mapped},
-    {U'\x2f999', U'\x2f999', idna_status::mapped},
-    {U'\x2f99a', U'\x2f99a', idna_status::mapped},
-    {U'\x2f99b', U'\x2f99b', idna_status::mapped},
-    {U'\x2f99c', U'\x2f99c', idna_status::mapped},
-    {U'\x2f99d', U'\x2f99d', idna_status::mapped},
-    {U'\x2f99e', U'\x2f99e', idna_status::mapped},
-    {U'\x2f99f', U'\x2f99f', idna_status::mapped},
-    {U'\x2f9a0', U'\x2f9a0', idna_status::mapped},
-    {U'\x2f9a1', U'\x2f9a1', idna_status::mapped},
-    {U'\x2f9a2', U'\x2f9a2', idna_status::mapped},
-    {U'\x2f9a3', U'\x2f9a3', idna_status::mapped},
-    {U'\x2f9a4', U'\x2f9a4', idna_status::mapped},
-    {U'\x2f9a5', U'\x2f9a5', idna_status::mapped},
-    {U'\x2f9a6', U'\x2f9a6', idna_status::mapped},
-    {U'\x2f9a7', U'\x2f9a7', idna_status::mapped},
-    {U'\x2f9a8', U'\x2f9a8', idna_status::mapped},
-    {U'\x2f9a9', U'\x2f9a9', idna_status::mapped},
-    {U'\x2f9aa', U'\x2f9aa', idna_status::mapped},
-    {U'\x2f9ab', U'\x2f9ab', idna_status::mapped},
-    {U'\x2f9ac', U'\x2f9ac', idna_status::mapped},
-    {U'\x2f9ad', U'\x2f9ad', idna_status::mapped},
-    {U'\x2f9ae', U'\x2f9ae', idna_status::mapped},
-    {U'\x2f9af', U'\x2f9af', idna_status::mapped},
-    {U'\x2f9b0', U'\x2f9b0', idna_status::mapped},
-    {U'\x2f9b1', U'\x2f9b1', idna_status::mapped},
-    {U'\x2f9b2', U'\x2f9b2', idna_status::mapped},
-    {U'\x2f9b3', U'\x2f9b3', idna_status::mapped},
-    {U'\x2f9b4', U'\x2f9b4', idna_status::mapped},
-    {U'\x2f9b5', U'\x2f9b5', idna_status::mapped},
-    {U'\x2f9b6', U'\x2f9b6', idna_status::mapped},
-    {U'\x2f9b7', U'\x2f9b7', idna_status::mapped},
-    {U'\x2f9b8', U'\x2f9b8', idna_status::mapped},
-    {U'\x2f9b9', U'\x2f9b9', idna_status::mapped},
-    {U'\x2f9ba', U'\x2f9ba', idna_status::mapped},
-    {U'\x2f9bb', U'\x2f9bb', idna_status::mapped},
-    {U'\x2f9bc', U'\x2f9bc', idna_status::mapped},
-    {U'\x2f9bd', U'\x2f9bd', idna_status::mapped},
-    {U'\x2f9be', U'\x2f9be', idna_status::mapped},
-    {U'\x2f9bf', U'\x2f9bf', idna_status::disallowed},
-    {U'\x2f9c0', U'\x2f9c0', idna_status::mapped},
-    {U'\x2f9c1', U'\x2f9c1', idna_status::mapped},
-    {U'\x2f9c2', U'\x2f9c2', idna_status::mapped},
-    {U'\x2f9c3', U'\x2f9c3', idna_status::mapped},
-    {U'\x2f9c4', U'\x2f9c4', idna_status::mapped},
-    {U'\x2f9c5', U'\x2f9c5', idna_status::mapped},
-    {U'\x2f9c6', U'\x2f9c6', idna_status::mapped},
-    {U'\x2f9c7', U'\x2f9c7', idna_status::mapped},
-    {U'\x2f9c8', U'\x2f9c8', idna_status::mapped},
-    {U'\x2f9c9', U'\x2f9c9', idna_status::mapped},
-    {U'\x2f9ca', U'\x2f9ca', idna_status::mapped},
-    {U'\x2f9cb', U'\x2f9cb', idna_status::mapped},
-    {U'\x2f9cc', U'\x2f9cc', idna_status::mapped},
-    {U'\x2f9cd', U'\x2f9cd', idna_status::mapped},
-    {U'\x2f9ce', U'\x2f9ce', idna_status::mapped},
-    {U'\x2f9cf', U'\x2f9cf', idna_status::mapped},
-    {U'\x2f9d0', U'\x2f9d0', idna_status::mapped},
-    {U'\x2f9d1', U'\x2f9d1', idna_status::mapped},
-    {U'\x2f9d2', U'\x2f9d2', idna_status::mapped},
-    {U'\x2f9d3', U'\x2f9d3', idna_status::mapped},
-    {U'\x2f9d4', U'\x2f9d4', idna_status::mapped},
-    {U'\x2f9d5', U'\x2f9d5', idna_status::mapped},
-    {U'\x2f9d6', U'\x2f9d6', idna_status::mapped},
-    {U'\x2f9d7', U'\x2f9d7', idna_status::mapped},
-    {U'\x2f9d8', U'\x2f9d8', idna_status::mapped},
-    {U'\x2f9d9', U'\x2f9d9', idna_status::mapped},
-    {U'\x2f9da', U'\x2f9da', idna_status::mapped},
-    {U'\x2f9db', U'\x2f9db', idna_status::mapped},
-    {U'\x2f9dc', U'\x2f9dc', idna_status::mapped},
-    {U'\x2f9dd', U'\x2f9dd', idna_status::mapped},
-    {U'\x2f9de', U'\x2f9de', idna_status::mapped},
-    {U'\x2f9df', U'\x2f9df', idna_status::mapped},
-    {U'\x2f9e0', U'\x2f9e0', idna_status::mapped},
-    {U'\x2f9e1', U'\x2f9e1', idna_status::mapped},
-    {U'\x2f9e2', U'\x2f9e2', idna_status::mapped},
-    {U'\x2f9e3', U'\x2f9e3', idna_status::mapped},
-    {U'\x2f9e4', U'\x2f9e4', idna_status::mapped},
-    {U'\x2f9e5', U'\x2f9e5', idna_status::mapped},
-    {U'\x2f9e6', U'\x2f9e6', idna_status::mapped},
-    {U'\x2f9e7', U'\x2f9e7', idna_status::mapped},
-    {U'\x2f9e8', U'\x2f9e8', idna_status::mapped},
-    {U'\x2f9e9', U'\x2f9e9', idna_status::mapped},
-    {U'\x2f9ea', U'\x2f9ea', idna_status::mapped},
-    {U'\x2f9eb', U'\x2f9eb', idna_status::mapped},
-    {U'\x2f9ec', U'\x2f9ec', idna_status::mapped},
-    {U'\x2f9ed', U'\x2f9ed', idna_status::mapped},
-    {U'\x2f9ee', U'\x2f9ee', idna_status::mapped},
-    {U'\x2f9ef', U'\x2f9ef', idna_status::mapped},
-    {U'\x2f9f0', U'\x2f9f0', idna_status::mapped},
-    {U'\x2f9f1', U'\x2f9f1', idna_status::mapped},
-    {U'\x2f9f2', U'\x2f9f2', idna_status::mapped},
-    {U'\x2f9f3', U'\x2f9f3', idna_status::mapped},
-    {U'\x2f9f4', U'\x2f9f4', idna_status::mapped},
-    {U'\x2f9f5', U'\x2f9f5', idna_status::mapped},
-    {U'\x2f9f6', U'\x2f9f6', idna_status::mapped},
-    {U'\x2f9f7', U'\x2f9f7', idna_status::mapped},
-    {U'\x2f9f8', U'\x2f9f8', idna_status::mapped},
-    {U'\x2f9f9', U'\x2f9f9', idna_status::mapped},
-    {U'\x2f9fa', U'\x2f9fa', idna_status::mapped},
-    {U'\x2f9fb', U'\x2f9fb', idna_status::mapped},
-    {U'\x2f9fc', U'\x2f9fc', idna_status::mapped},
-    {U'\x2f9fd', U'\x2f9fd', idna_status::mapped},
-    {U'\x2f9fe', U'\x2f9ff', idna_status::mapped},
-    {U'\x2fa00', U'\x2fa00', idna_status::mapped},
-    {U'\x2fa01', U'\x2fa01', idna_status::mapped},
-    {U'\x2fa02', U'\x2fa02', idna_status::mapped},
-    {U'\x2fa03', U'\x2fa03', idna_status::mapped},
-    {U'\x2fa04', U'\x2fa04', idna_status::mapped},
-    {U'\x2fa05', U'\x2fa05', idna_status::mapped},
-    {U'\x2fa06', U'\x2fa06', idna_status::mapped},
-    {U'\x2fa07', U'\x2fa07', idna_status::mapped},
-    {U'\x2fa08', U'\x2fa08', idna_status::mapped},
-    {U'\x2fa09', U'\x2fa09', idna_status::mapped},
-    {U'\x2fa0a', U'\x2fa0a', idna_status::mapped},
-    {U'\x2fa0b', U'\x2fa0b', idna_status::mapped},
-    {U'\x2fa0c', U'\x2fa0c', idna_status::mapped},
-    {U'\x2fa0d', U'\x2fa0d', idna_status::mapped},
-    {U'\x2fa0e', U'\x2fa0e', idna_status::mapped},
-    {U'\x2fa0f', U'\x2fa0f', idna_status::mapped},
-    {U'\x2fa10', U'\x2fa10', idna_status::mapped},
-    {U'\x2fa11', U'\x2fa11', idna_status::mapped},
-    {U'\x2fa12', U'\x2fa12', idna_status::mapped},
-    {U'\x2fa13', U'\x2fa13', idna_status::mapped},
-    {U'\x2fa14', U'\x2fa14', idna_status::mapped},
-    {U'\x2fa15', U'\x2fa15', idna_status::mapped},
-    {U'\x2fa16', U'\x2fa16', idna_status::mapped},
-    {U'\x2fa17', U'\x2fa17', idna_status::mapped},
-    {U'\x2fa18', U'\x2fa18', idna_status::mapped},
-    {U'\x2fa19', U'\x2fa19', idna_status::mapped},
-    {U'\x2fa1a', U'\x2fa1a', idna_status::mapped},
-    {U'\x2fa1b', U'\x2fa1b', idna_status::mapped},
-    {U'\x2fa1c', U'\x2fa1c', idna_status::mapped},
-    {U'\x2fa1d', U'\x2fa1d', idna_status::mapped},
-    {U'\x2fa1e', U'\x2fffd', idna_status::disallowed},
-    {U'\x2fffe', U'\x2ffff', idna_status::disallowed},
-    {U'\x3134b', U'\x3134f', idna_status::disallowed},
-    {U'\x323b0', U'\x3fffd', idna_status::disallowed},
-    {U'\x3fffe', U'\x3ffff', idna_status::disallowed},
-    {U'\x40000', U'\x4fffd', idna_status::disallowed},
-    {U'\x4fffe', U'\x4ffff', idna_status::disallowed},
-    {U'\x50000', U'\x5fffd', idna_status::disallowed},
-    {U'\x5fffe', U'\x5ffff', idna_status::disallowed},
-    {U'\x60000', U'\x6fffd', idna_status::disallowed},
-    {U'\x6fffe', U'\x6ffff', idna_status::disallowed},
-    {U'\x70000', U'\x7fffd', idna_status::disallowed},
-    {U'\x7fffe', U'\x7ffff', idna_status::disallowed},
-    {U'\x80000', U'\x8fffd', idna_status::disallowed},
-    {U'\x8fffe', U'\x8ffff', idna_status::disallowed},
-    {U'\x90000', U'\x9fffd', idna_status::disallowed},
-    {U'\x9fffe', U'\x9ffff', idna_status::disallowed},
-    {U'\xa0000', U'\xafffd', idna_status::disallowed},
-    {U'\xafffe', U'\xaffff', idna_status::disallowed},
-    {U'\xb0000', U'\xbfffd', idna_status::disallowed},
-    {U'\xbfffe', U'\xbffff', idna_status::disallowed},
-    {U'\xc0000', U'\xcfffd', idna_status::disallowed},
-    {U'\xcfffe', U'\xcffff', idna_status::disallowed},
-    {U'\xd0000', U'\xdfffd', idna_status::disallowed},
-    {U'\xdfffe', U'\xdffff', idna_status::disallowed},
-    {U'\xe0000', U'\xe0000', idna_status::disallowed},
-    {U'\xe0001', U'\xe0001', idna_status::disallowed},
-    {U'\xe0002', U'\xe001f', idna_status::disallowed},
-    {U'\xe0020', U'\xe007f', idna_status::disallowed},
-    {U'\xe0080', U'\xe00ff', idna_status::disallowed},
-    {U'\xe0100', U'\xe01ef', idna_status::ignored},
-    {U'\xe01f0', U'\xefffd', idna_status::disallowed},
-    {U'\xefffe', U'\xeffff', idna_status::disallowed},
-    {U'\xf0000', U'\xffffd', idna_status::disallowed},
-    {U'\xffffe', U'\xfffff', idna_status::disallowed},
-    {U'\x100000', U'\x10fffd', idna_status::disallowed},
-    {U'\x10fffe', U'\x10ffff', idna_status::disallowed},
+inline constexpr auto code_point_ranges = std::array<std::uint32_t, 8011>{{
+    0x00000002, 0x00016807, 0x00017802, 0x00018007, 0x0001d002, 0x0002080d, 0x0002100d, 0x0002180d,
+    0x0002200d, 0x0002280d, 0x0002300d, 0x0002380d, 0x0002400d, 0x0002480d, 0x0002500d, 0x0002580d,
+    0x0002600d, 0x0002680d, 0x0002700d, 0x0002780d, 0x0002800d, 0x0002880d, 0x0002900d, 0x0002980d,
+    0x0002a00d, 0x0002a80d, 0x0002b00d, 0x0002b80d, 0x0002c00d, 0x0002c80d, 0x0002d00d, 0x0002d802,
+    0x00030807, 0x0003d802, 0x00040001, 0x0005000b, 0x00050807, 0x00054013, 0x00054807, 0x0005500d,
+    0x00055807, 0x00056804, 0x00057007, 0x00057813, 0x00058007, 0x0005900d, 0x0005980d, 0x0005a013,
+    0x0005a80d, 0x0005b007, 0x0005c013, 0x0005c80d, 0x0005d00d, 0x0005d807, 0x0005e01d, 0x0005e81d,
+    0x0005f01d, 0x0005f807, 0x0006000d, 0x0006080d, 0x0006100d, 0x0006180d, 0x0006200d, 0x0006280d,
+    0x0006300d, 0x0006380d, 0x0006400d, 0x0006480d, 0x0006500d, 0x0006580d, 0x0006600d, 0x0006680d,
+    0x0006700d, 0x0006780d, 0x0006800d, 0x0006880d, 0x0006900d, 0x0006980d, 0x0006a00d, 0x0006a80d,
+    0x0006b00d, 0x0006b807, 0x0006c00d, 0x0006c80d, 0x0006d00d, 0x0006d80d, 0x0006e00d, 0x0006e80d,
+    0x0006f00d, 0x0006f816, 0x00070007, 0x0008000d, 0x00080807, 0x0008100d, 0x00081807, 0x0008200d,
+    0x00082807, 0x0008300d, 0x00083807, 0x0008400d, 0x00084807, 0x0008500d, 0x00085807, 0x0008600d,
+    0x00086807, 0x0008700d, 0x00087807, 0x0008800d, 0x00088807, 0x0008900d, 0x00089807, 0x0008a00d,
+    0x0008a807, 0x0008b00d, 0x0008b807, 0x0008c00d, 0x0008c807, 0x0008d00d, 0x0008d807, 0x0008e00d,
+    0x0008e807, 0x0008f00d, 0x0008f807, 0x0009000d, 0x00090807, 0x0009100d, 0x00091807, 0x0009200d,
+    0x00092807, 0x0009300d, 0x00093807, 0x0009400d, 0x00094807, 0x0009500d, 0x00095807, 0x0009600d,
+    0x00096807, 0x0009700d, 0x00097807, 0x00098015, 0x00098807, 0x00099015, 0x0009a00d, 0x0009a807,
+    0x0009b00d, 0x0009b807, 0x0009c80d, 0x0009d007, 0x0009d80d, 0x0009e007, 0x0009e80d, 0x0009f007,
+    0x0009f815, 0x000a080d, 0x000a1007, 0x000a180d, 0x000a2007, 0x000a280d, 0x000a3007, 0x000a380d,
+    0x000a4007, 0x000a4815, 0x000a500d, 0x000a5807, 0x000a600d, 0x000a6807, 0x000a700d, 0x000a7807,
+    0x000a800d, 0x000a8807, 0x000a900d, 0x000a9807, 0x000aa00d, 0x000aa807, 0x000ab00d, 0x000ab807,
+    0x000ac00d, 0x000ac807, 0x000ad00d, 0x000ad807, 0x000ae00d, 0x000ae807, 0x000af00d, 0x000af807,
+    0x000b000d, 0x000b0807, 0x000b100d, 0x000b1807, 0x000b200d, 0x000b2807, 0x000b300d, 0x000b3807,
+    0x000b400d, 0x000b4807, 0x000b500d, 0x000b5807, 0x000b600d, 0x000b6807, 0x000b700d, 0x000b7807,
+    0x000b800d, 0x000b8807, 0x000b900d, 0x000b9807, 0x000ba00d, 0x000ba807, 0x000bb00d, 0x000bb807,
+    0x000bc00d, 0x000bc80d, 0x000bd007, 0x000bd80d, 0x000be007, 0x000be80d, 0x000bf007, 0x000bf80d,
+    0x000c0007, 0x000c080d, 0x000c100d, 0x000c1807, 0x000c200d, 0x000c2807, 0x000c300d, 0x000c380d,
+    0x000c4007, 0x000c480d, 0x000c500d, 0x000c580d, 0x000c6007, 0x000c700d, 0x000c780d, 0x000c800d,
+    0x000c880d, 0x000c9007, 0x000c980d, 0x000ca00d, 0x000ca807, 0x000cb00d, 0x000cb80d, 0x000cc00d,
+    0x000cc807, 0x000ce00d, 0x000ce80d, 0x000cf007, 0x000cf80d, 0x000d000d, 0x000d0807, 0x000d100d,
+    0x000d1807, 0x000d200d, 0x000d2807, 0x000d300d, 0x000d380d, 0x000d4007, 0x000d480d, 0x000d5007,
+    0x000d600d, 0x000d6807, 0x000d700d, 0x000d780d, 0x000d8007, 0x000d880d, 0x000d900d, 0x000d980d,
+    0x000da007, 0x000da80d, 0x000db007, 0x000db80d, 0x000dc00d, 0x000dc807, 0x000de00d, 0x000de807,
+    0x000e2015, 0x000e3815, 0x000e5015, 0x000e680d, 0x000e7007, 0x000e780d, 0x000e8007, 0x000e880d,
+    0x000e9007, 0x000e980d, 0x000ea007, 0x000ea80d, 0x000eb007, 0x000eb80d, 0x000ec007, 0x000ec80d,
+    0x000ed007, 0x000ed80d, 0x000ee007, 0x000ef00d, 0x000ef807, 0x000f000d, 0x000f0807, 0x000f100d,
+    0x000f1807, 0x000f200d, 0x000f2807, 0x000f300d, 0x000f3807, 0x000f400d, 0x000f4807, 0x000f500d,
+    0x000f5807, 0x000f600d, 0x000f6807, 0x000f700d, 0x000f7807, 0x000f8815, 0x000fa00d, 0x000fa807,
+    0x000fb00d, 0x000fb80d, 0x000fc00d, 0x000fc807, 0x000fd00d, 0x000fd807, 0x000fe00d, 0x000fe807,
+    0x000ff00d, 0x000ff807, 0x0010000d, 0x00100807, 0x0010100d, 0x00101807, 0x0010200d, 0x00102807,
+    0x0010300d, 0x00103807, 0x0010400d, 0x00104807, 0x0010500d, 0x00105807, 0x0010600d, 0x00106807,
+    0x0010700d, 0x00107807, 0x0010800d, 0x00108807, 0x0010900d, 0x00109807, 0x0010a00d, 0x0010a807,
+    0x0010b00d, 0x0010b807, 0x0010c00d, 0x0010c807, 0x0010d00d, 0x0010d807, 0x0010e00d, 0x0010e807,
+    0x0010f00d, 0x0010f807, 0x0011000d, 0x00110807, 0x0011100d, 0x00111807, 0x0011200d, 0x00112807,
+    0x0011300d, 0x00113807, 0x0011400d, 0x00114807, 0x0011500d, 0x00115807, 0x0011600d, 0x00116807,
+    0x0011700d, 0x00117807, 0x0011800d, 0x00118807, 0x0011900d, 0x00119807, 0x0011d00d, 0x0011d80d,
+    0x0011e007, 0x0011e80d, 0x0011f00d, 0x0011f807, 0x0012080d, 0x00121007, 0x0012180d, 0x0012200d,
+    0x0012280d, 0x0012300d, 0x00123807, 0x0012400d, 0x00124807, 0x0012500d, 0x00125807, 0x0012600d,
+    0x00126807, 0x0012700d, 0x00127807, 0x0015800d, 0x0015880d, 0x0015900d, 0x0015980d, 0x0015a00d,
+    0x0015a80d, 0x0015b00d, 0x0015b80d, 0x0015c00d, 0x0015c807, 0x0016c013, 0x0016c813, 0x0016d013,
+    0x0016d813, 0x0016e013, 0x0016e813, 0x0016f007, 0x0017000d, 0x0017080d, 0x0017100d, 0x0017180d,
+    0x0017200d, 0x00172807, 0x001a000d, 0x001a080d, 0x001a1007, 0x001a180d, 0x001a2015, 0x001a280d,
+    0x001a3007, 0x001a7804, 0x001a8007, 0x001b800d, 0x001b8807, 0x001b900d, 0x001b9807, 0x001ba00d,
+    0x001ba807, 0x001bb00d, 0x001bb807, 0x001bc001, 0x001bd013, 0x001bd807, 0x001bf00b, 0x001bf80d,
+    0x001c0001, 0x001c2013, 0x001c281b, 0x001c300d, 0x001c380d, 0x001c400d, 0x001c480d, 0x001c500d,
+    0x001c5801, 0x001c600d, 0x001c6801, 0x001c700d, 0x001c780d, 0x001c8007, 0x001c880d, 0x001c900d,
+    0x001c980d, 0x001ca00d, 0x001ca80d, 0x001cb00d, 0x001cb80d, 0x001cc00d, 0x001cc80d, 0x001cd00d,
+    0x001cd80d, 0x001ce00d, 0x001ce80d, 0x001cf00d, 0x001cf80d, 0x001d000d, 0x001d080d, 0x001d1001,
+    0x001d180d, 0x001d200d, 0x001d280d, 0x001d300d, 0x001d380d, 0x001d400d, 0x001d480d, 0x001d500d,
+    0x001d580d, 0x001d6007, 0x001e100e, 0x001e1807, 0x001e780d, 0x001e800d, 0x001e880d, 0x001e900d,
+    0x001e980d, 0x001ea00d, 0x001ea80d, 0x001eb00d, 0x001eb807, 0x001ec00d, 0x001ec807, 0x001ed00d,
+    0x001ed807, 0x001ee00d, 0x001ee807, 0x001ef00d, 0x001ef807, 0x001f000d, 0x001f0807, 0x001f100d,
+    0x001f1807, 0x001f200d, 0x001f2807, 0x001f300d, 0x001f3807, 0x001f400d, 0x001f4807, 0x001f500d,
+    0x001f5807, 0x001f600d, 0x001f6807, 0x001f700d, 0x001f7807, 0x001f800d, 0x001f880d, 0x001f900d,
+    0x001f9807, 0x001fa00d, 0x001fa80d, 0x001fb007, 0x001fb80d, 0x001fc007, 0x001fc80d, 0x001fd00d,
+    0x001fd807, 0x001fe80d, 0x001ff00d, 0x001ff80d, 0x0020000d, 0x0020080d, 0x0020100d, 0x0020180d,
+    0x0020200d, 0x0020280d, 0x0020300d, 0x0020380d, 0x0020400d, 0x0020480d, 0x0020500d, 0x0020580d,
+    0x0020600d, 0x0020680d, 0x0020700d, 0x0020780d, 0x0020800d, 0x0020880d, 0x0020900d, 0x0020980d,
+    0x0020a00d, 0x0020a80d, 0x0020b00d, 0x0020b80d, 0x0020c00d, 0x0020c80d, 0x0020d00d, 0x0020d80d,
+    0x0020e00d, 0x0020e80d, 0x0020f00d, 0x0020f80d, 0x0021000d, 0x0021080d, 0x0021100d, 0x0021180d,
+    0x0021200d, 0x0021280d, 0x0021300d, 0x0021380d, 0x0021400d, 0x0021480d, 0x0021500d, 0x0021580d,
+    0x0021600d, 0x0021680d, 0x0021700d, 0x0021780d, 0x00218007, 0x0023000d, 0x00230807, 0x0023100d,
+    0x00231807, 0x0023200d, 0x00232807, 0x0023300d, 0x00233807, 0x0023400d, 0x00234807, 0x0023500d,
+    0x00235807, 0x0023600d, 0x00236807, 0x0023700d, 0x00237807, 0x0023800d, 0x00238807, 0x0023900d,
+    0x00239807, 0x0023a00d, 0x0023a807, 0x0023b00d, 0x0023b807, 0x0023c00d, 0x0023c807, 0x0023d00d,
+    0x0023d807, 0x0023e00d, 0x0023e807, 0x0023f00d, 0x0023f807, 0x0024000d, 0x00240807, 0x0024500d,
+    0x00245807, 0x0024600d, 0x00246807, 0x0024700d, 0x00247807, 0x0024800d, 0x00248807, 0x0024900d,
+    0x00249807, 0x0024a00d, 0x0024a807, 0x0024b00d, 0x0024b807, 0x0024c00d, 0x0024c807, 0x0024d00d,
+    0x0024d807, 0x0024e00d, 0x0024e807, 0x0024f00d, 0x0024f807, 0x0025000d, 0x00250807, 0x0025100d,
+    0x00251807, 0x0025200d, 0x00252807, 0x0025300d, 0x00253807, 0x0025400d, 0x00254807, 0x0025500d,
+    0x00255807, 0x0025600d, 0x00256807, 0x0025700d, 0x00257807, 0x0025800d, 0x00258807, 0x0025900d,
+    0x00259807, 0x0025a00d, 0x0025a807, 0x0025b00d, 0x0025b807, 0x0025c00d, 0x0025c807, 0x0025d00d,
+    0x0025d807, 0x0025e00d, 0x0025e807, 0x0025f00d, 0x0025f807, 0x00260001, 0x0026080d, 0x00261007,
+    0x0026180d, 0x00262007, 0x0026280d, 0x00263007, 0x0026380d, 0x00264007, 0x0026480d, 0x00265007,
+    0x0026580d, 0x00266007, 0x0026680d, 0x00267007, 0x0026800d, 0x00268807, 0x0026900d, 0x00269807,
+    0x0026a00d, 0x0026a807, 0x0026b00d, 0x0026b807, 0x0026c00d, 0x0026c807, 0x0026d00d, 0x0026d807,
+    0x0026e00d, 0x0026e807, 0x0026f00d, 0x0026f807, 0x0027000d, 0x00270807, 0x0027100d, 0x00271807,
+    0x0027200d, 0x00272807, 0x0027300d, 0x00273807, 0x0027400d, 0x00274807, 0x0027500d, 0x00275807,
+    0x0027600d, 0x00276807, 0x0027700d, 0x00277807, 0x0027800d, 0x00278807, 0x0027900d, 0x00279807,
+    0x0027a00d, 0x0027a807, 0x0027b00d, 0x0027b807, 0x0027c00d, 0x0027c807, 0x0027d00d, 0x0027d807,
+    0x0027e00d, 0x0027e807, 0x0027f00d, 0x0027f807, 0x0028000d, 0x00280807, 0x0028100d, 0x00281807,
+    0x0028200d, 0x00282807, 0x0028300d, 0x00283807, 0x0028400d, 0x00284807, 0x0028500d, 0x00285807,
+    0x0028600d, 0x00286807, 0x0028700d, 0x00287807, 0x0028800d, 0x00288807, 0x0028900d, 0x00289807,
+    0x0028a00d, 0x0028a807, 0x0028b00d, 0x0028b807, 0x0028c00d, 0x0028c807, 0x0028d00d, 0x0028d807,
+    0x0028e00d, 0x0028e807, 0x0028f00d, 0x0028f807, 0x0029000d, 0x00290807, 0x0029100d, 0x00291807,
+    0x0029200d, 0x00292807, 0x0029300d, 0x00293807, 0x0029400d, 0x00294807, 0x0029500d, 0x00295807,
+    0x0029600d, 0x00296807, 0x0029700d, 0x00297807, 0x00298001, 0x0029880d, 0x0029900d, 0x0029980d,
+    0x0029a00d, 0x0029a80d, 0x0029b00d, 0x0029b80d, 0x0029c00d, 0x0029c80d, 0x0029d00d, 0x0029d80d,
+    0x0029e00d, 0x0029e80d, 0x0029f00d, 0x0029f80d, 0x002a000d, 0x002a080d, 0x002a100d, 0x002a180d,
+    0x002a200d, 0x002a280d, 0x002a300d, 0x002a380d, 0x002a400d, 0x002a480d, 0x002a500d, 0x002a580d,
+    0x002a600d, 0x002a680d, 0x002a700d, 0x002a780d, 0x002a800d, 0x002a880d, 0x002a900d, 0x002a980d,
+    0x002aa00d, 0x002aa80d, 0x002ab00d, 0x002ab801, 0x002ac807, 0x002c3815, 0x002c4007, 0x002c5801,
+    0x002c6807, 0x002c8001, 0x002c8807, 0x002e4001, 0x002e8007, 0x002f5801, 0x002f7807, 0x002fa801,
+    0x00303007, 0x0030e001, 0x0030e807, 0x0033a815, 0x0033b015, 0x0033b815, 0x0033c015, 0x0033c807,
+    0x0036e801, 0x0036f007, 0x00387001, 0x00388007, 0x003a5801, 0x003a6807, 0x003d9001, 0x003e0007,
+    0x003fd801, 0x003fe807, 0x00417001, 0x00418007, 0x0041f801, 0x00420007, 0x0042e001, 0x0042f007,
+    0x0042f801, 0x00430007, 0x00435801, 0x00438007, 0x00447801, 0x0044c007, 0x00471001, 0x00471807,
+    0x004ac015, 0x004ac815, 0x004ad015, 0x004ad815, 0x004ae015, 0x004ae815, 0x004af015, 0x004af815,
+    0x004b0007, 0x004c2001, 0x004c2807, 0x004c6801, 0x004c7807, 0x004c8801, 0x004c9807, 0x004d4801,
+    0x004d5007, 0x004d8801, 0x004d9007, 0x004d9801, 0x004db007, 0x004dd001, 0x004de007, 0x004e2801,
+    0x004e3807, 0x004e4801, 0x004e5807, 0x004e7801, 0x004eb807, 0x004ec001, 0x004ee015, 0x004ee815,
+    0x004ef001, 0x004ef815, 0x004f0007, 0x004f2001, 0x004f3007, 0x004ff801, 0x00500807, 0x00502001,
+    0x00502807, 0x00505801, 0x00507807, 0x00508801, 0x00509807, 0x00514801, 0x00515007, 0x00518801,
+    0x00519007, 0x00519815, 0x0051a001, 0x0051a807, 0x0051b015, 0x0051b801, 0x0051c007, 0x0051d001,
+    0x0051e007, 0x0051e801, 0x0051f007, 0x00521801, 0x00523807, 0x00524801, 0x00525807, 0x00527001,
+    0x00528807, 0x00529001, 0x0052c815, 0x0052d015, 0x0052d815, 0x0052e007, 0x0052e801, 0x0052f015,
+    0x0052f801, 0x00533007, 0x0053b801, 0x00540807, 0x00542001, 0x00542807, 0x00547001, 0x00547807,
+    0x00549001, 0x00549807, 0x00554801, 0x00555007, 0x00558801, 0x00559007, 0x0055a001, 0x0055a807,
+    0x0055d001, 0x0055e007, 0x00563001, 0x00563807, 0x00565001, 0x00565807, 0x00567001, 0x00568007,
+    0x00568801, 0x00570007, 0x00572001, 0x00573007, 0x00579001, 0x0057c807, 0x00580001, 0x00580807,
+    0x00582001, 0x00582807, 0x00586801, 0x00587807, 0x00588801, 0x00589807, 0x00594801, 0x00595007,
+    0x00598801, 0x00599007, 0x0059a001, 0x0059a807, 0x0059d001, 0x0059e007, 0x005a2801, 0x005a3807,
+    0x005a4801, 0x005a5807, 0x005a7001, 0x005aa807, 0x005ac001, 0x005ae015, 0x005ae815, 0x005af001,
+    0x005af807, 0x005b2001, 0x005b3007, 0x005bc001, 0x005c1007, 0x005c2001, 0x005c2807, 0x005c5801,
+    0x005c7007, 0x005c8801, 0x005c9007, 0x005cb001, 0x005cc807, 0x005cd801, 0x005ce007, 0x005ce801,
+    0x005cf007, 0x005d0001, 0x005d1807, 0x005d2801, 0x005d4007, 0x005d5801, 0x005d7007, 0x005dd001,
+    0x005df007, 0x005e1801, 0x005e3007, 0x005e4801, 0x005e5007, 0x005e7001, 0x005e8007, 0x005e8801,
+    0x005eb807, 0x005ec001, 0x005f3007, 0x005fd801, 0x00600007, 0x00606801, 0x00607007, 0x00608801,
+    0x00609007, 0x00614801, 0x00615007, 0x0061d001, 0x0061e007, 0x00622801, 0x00623007, 0x00624801,
+    0x00625007, 0x00627001, 0x0062a807, 0x0062b801, 0x0062c007, 0x0062d801, 0x0062e807, 0x0062f001,
+    0x00630007, 0x00632001, 0x00633007, 0x00638001, 0x0063b807, 0x00646801, 0x00647007, 0x00648801,
+    0x00649007, 0x00654801, 0x00655007, 0x0065a001, 0x0065a807, 0x0065d001, 0x0065e007, 0x00662801,
+    0x00663007, 0x00664801, 0x00665007, 0x00667001, 0x0066a807, 0x0066b801, 0x0066e807, 0x0066f801,
+    0x00670007, 0x00672001, 0x00673007, 0x00678001, 0x00678807, 0x0067a001, 0x00680007, 0x00686801,
+    0x00687007, 0x00688801, 0x00689007, 0x006a2801, 0x006a3007, 0x006a4801, 0x006a5007, 0x006a8001,
+    0x006aa007, 0x006b2001, 0x006b3007, 0x006c0001, 0x006c0807, 0x006c2001, 0x006c2807, 0x006cb801,
+    0x006cd007, 0x006d9001, 0x006d9807, 0x006de001, 0x006de807, 0x006df001, 0x006e0007, 0x006e3801,
+    0x006e5007, 0x006e5801, 0x006e7807, 0x006ea801, 0x006eb007, 0x006eb801, 0x006ec007, 0x006f0001,
+    0x006f3007, 0x006f8001, 0x006f9007, 0x006fa801, 0x00700807, 0x00719815, 0x0071a007, 0x0071d801,
+    0x0071f807, 0x0072e001, 0x00740807, 0x00741801, 0x00742007, 0x00742801, 0x00743007, 0x00745801,
+    0x00746007, 0x00752001, 0x00752807, 0x00753001, 0x00753807, 0x00759815, 0x0075a007, 0x0075f001,
+    0x00760007, 0x00762801, 0x00763007, 0x00763801, 0x00764007, 0x00767801, 0x00768007, 0x0076d001,
+    0x0076e015, 0x0076e815, 0x0076f007, 0x00770001, 0x00780007, 0x0078600d, 0x00786807, 0x007a1815,
+    0x007a2007, 0x007a4001, 0x007a4807, 0x007a6815, 0x007a7007, 0x007a9015, 0x007a9807, 0x007ab815,
+    0x007ac007, 0x007ae015, 0x007ae807, 0x007b4815, 0x007b5007, 0x007b6801, 0x007b8807, 0x007b9815,
+    0x007ba007, 0x007ba815, 0x007bb015, 0x007bb81d, 0x007bc015, 0x007bc81d, 0x007bd007, 0x007c0815,
+    0x007c1007, 0x007c9815, 0x007ca007, 0x007cc001, 0x007cc807, 0x007ce815, 0x007cf007, 0x007d1015,
+    0x007d1807, 0x007d3815, 0x007d4007, 0x007d6015, 0x007d6807, 0x007dc815, 0x007dd007, 0x007de801,
+    0x007df007, 0x007e6801, 0x007e7007, 0x007ed801, 0x00800007, 0x00850001, 0x0086380d, 0x00864001,
+    0x0086680d, 0x00867001, 0x00868007, 0x0087e00d, 0x0087e807, 0x008af801, 0x008b0807, 0x00924801,
+    0x00925007, 0x00927001, 0x00928007, 0x0092b801, 0x0092c007, 0x0092c801, 0x0092d007, 0x0092f001,
+    0x00930007, 0x00944801, 0x00945007, 0x00947001, 0x00948007, 0x00958801, 0x00959007, 0x0095b001,
+    0x0095c007, 0x0095f801, 0x00960007, 0x00960801, 0x00961007, 0x00963001, 0x00964007, 0x0096b801,
+    0x0096c007, 0x00988801, 0x00989007, 0x0098b001, 0x0098c007, 0x009ad801, 0x009ae807, 0x009be801,
+    0x009c0007, 0x009cd001, 0x009d0007, 0x009fb001, 0x009fc00d, 0x009fc80d, 0x009fd00d, 0x009fd80d,
+    0x009fe00d, 0x009fe80d, 0x009ff001, 0x00a00007, 0x00b40001, 0x00b40807, 0x00b4e801, 0x00b50007,
+    0x00b7c801, 0x00b80007, 0x00b8b001, 0x00b8f807, 0x00b9b801, 0x00ba0007, 0x00baa001, 0x00bb0007,
+    0x00bb6801, 0x00bb7007, 0x00bb8801, 0x00bb9007, 0x00bba001, 0x00bc0007, 0x00bda001, 0x00bdb007,
+    0x00bef001, 0x00bf0007, 0x00bf5001, 0x00bf8007, 0x00bfd001, 0x00c00007, 0x00c03001, 0x00c03807,
+    0x00c05804, 0x00c07001, 0x00c07804, 0x00c08007, 0x00c0d001, 0x00c10007, 0x00c3c801, 0x00c40007,
+    0x00c55801, 0x00c58007, 0x00c7b001, 0x00c80007, 0x00c8f801, 0x00c90007, 0x00c96001, 0x00c98007,
+    0x00c9e001, 0x00ca0007, 0x00ca0801, 0x00ca2007, 0x00cb7001, 0x00cb8007, 0x00cba801, 0x00cc0007,
+    0x00cd6001, 0x00cd8007, 0x00ce5001, 0x00ce8007, 0x00ced801, 0x00cef007, 0x00d0e001, 0x00d0f007,
+    0x00d2f801, 0x00d30007, 0x00d3e801, 0x00d3f807, 0x00d45001, 0x00d48007, 0x00d4d001, 0x00d50007,
+    0x00d57001, 0x00d58007, 0x00d67801, 0x00d80007, 0x00da6801, 0x00da8007, 0x00dbf801, 0x00dc0007,
+    0x00dfa001, 0x00dfe007, 0x00e1c001, 0x00e1d807, 0x00e25001, 0x00e26807, 0x00e4000d, 0x00e4080d,
+    0x00e4100d, 0x00e4180d, 0x00e4200d, 0x00e4300d, 0x00e4380d, 0x00e4400d, 0x00e44801, 0x00e4800d,
+    0x00e4880d, 0x00e4900d, 0x00e4980d, 0x00e4a00d, 0x00e4a80d, 0x00e4b00d, 0x00e4b80d, 0x00e4c00d,
+    0x00e4c80d, 0x00e4d00d, 0x00e4d80d, 0x00e4e00d, 0x00e4e80d, 0x00e4f00d, 0x00e4f80d, 0x00e5000d,
+    0x00e5080d, 0x00e5100d, 0x00e5180d, 0x00e5200d, 0x00e5280d, 0x00e5300d, 0x00e5380d, 0x00e5400d,
+    0x00e5480d, 0x00e5500d, 0x00e5580d, 0x00e5600d, 0x00e5680d, 0x00e5700d, 0x00e5780d, 0x00e5800d,
+    0x00e5880d, 0x00e5900d, 0x00e5980d, 0x00e5a00d, 0x00e5a80d, 0x00e5b00d, 0x00e5b80d, 0x00e5c00d,
+    0x00e5c80d, 0x00e5d00d, 0x00e5d801, 0x00e5e80d, 0x00e5f00d, 0x00e5f80d, 0x00e60007, 0x00e64001,
+    0x00e68007, 0x00e7d801, 0x00e80007, 0x00e9600d, 0x00e9680d, 0x00e9700d, 0x00e97807, 0x00e9800d,
+    0x00e9880d, 0x00e9900d, 0x00e9980d, 0x00e9a00d, 0x00e9a80d, 0x00e9b00d, 0x00e9b80d, 0x00e9c00d,
+    0x00e9c80d, 0x00e9d00d, 0x00e9d807, 0x00e9e00d, 0x00e9e80d, 0x00e9f00d, 0x00e9f80d, 0x00ea000d,
+    0x00ea080d, 0x00ea100d, 0x00ea180d, 0x00ea200d, 0x00ea280d, 0x00ea300d, 0x00ea380d, 0x00ea400d,
+    0x00ea480d, 0x00ea500d, 0x00ea580d, 0x00ea600d, 0x00ea680d, 0x00ea7007, 0x00ea780d, 0x00ea800d,
+    0x00ea880d, 0x00ea900d, 0x00ea980d, 0x00eaa00d, 0x00eaa80d, 0x00eab00d, 0x00eab80d, 0x00eac00d,
+    0x00eac80d, 0x00ead00d, 0x00ead80d, 0x00eae00d, 0x00eae80d, 0x00eaf00d, 0x00eaf80d, 0x00eb000d,
+    0x00eb080d, 0x00eb100d, 0x00eb180d, 0x00eb200d, 0x00eb280d, 0x00eb300d, 0x00eb380d, 0x00eb400d,
+    0x00eb480d, 0x00eb500d, 0x00eb5807, 0x00ebc00d, 0x00ebc807, 0x00ecd80d, 0x00ece00d, 0x00ece80d,
+    0x00ecf00d, 0x00ecf80d, 0x00ed000d, 0x00ed080d, 0x00ed100d, 0x00ed180d, 0x00ed200d, 0x00ed280d,
+    0x00ed300d, 0x00ed380d, 0x00ed400d, 0x00ed480d, 0x00ed500d, 0x00ed580d, 0x00ed600d, 0x00ed680d,
+    0x00ed700d, 0x00ed780d, 0x00ed800d, 0x00ed880d, 0x00ed900d, 0x00ed980d, 0x00eda00d, 0x00eda80d,
+    0x00edb00d, 0x00edb80d, 0x00edc00d, 0x00edc80d, 0x00edd00d, 0x00edd80d, 0x00ede00d, 0x00ede80d,
+    0x00edf00d, 0x00edf80d, 0x00ee0007, 0x00f0000d, 0x00f00807, 0x00f0100d, 0x00f01807, 0x00f0200d,
+    0x00f02807, 0x00f0300d, 0x00f03807, 0x00f0400d, 0x00f04807, 0x00f0500d, 0x00f05807, 0x00f0600d,
+    0x00f06807, 0x00f0700d, 0x00f07807, 0x00f0800d, 0x00f08807, 0x00f0900d, 0x00f09807, 0x00f0a00d,
+    0x00f0a807, 0x00f0b00d, 0x00f0b807, 0x00f0c00d, 0x00f0c807, 0x00f0d00d, 0x00f0d807, 0x00f0e00d,
+    0x00f0e807, 0x00f0f00d, 0x00f0f807, 0x00f1000d, 0x00f10807, 0x00f1100d, 0x00f11807, 0x00f1200d,
+    0x00f12807, 0x00f1300d, 0x00f13807, 0x00f1400d, 0x00f14807, 0x00f1500d, 0x00f15807, 0x00f1600d,
+    0x00f16807, 0x00f1700d, 0x00f17807, 0x00f1800d, 0x00f18807, 0x00f1900d, 0x00f19807, 0x00f1a00d,
+    0x00f1a807, 0x00f1b00d, 0x00f1b807, 0x00f1c00d, 0x00f1c807, 0x00f1d00d, 0x00f1d807, 0x00f1e00d,
+    0x00f1e807, 0x00f1f00d, 0x00f1f807, 0x00f2000d, 0x00f20807, 0x00f2100d, 0x00f21807, 0x00f2200d,
+    0x00f22807, 0x00f2300d, 0x00f23807, 0x00f2400d, 0x00f24807, 0x00f2500d, 0x00f25807, 0x00f2600d,
+    0x00f26807, 0x00f2700d, 0x00f27807, 0x00f2800d, 0x00f28807, 0x00f2900d, 0x00f29807, 0x00f2a00d,
+    0x00f2a807, 0x00f2b00d, 0x00f2b807, 0x00f2c00d, 0x00f2c807, 0x00f2d00d, 0x00f2d807, 0x00f2e00d,
+    0x00f2e807, 0x00f2f00d, 0x00f2f807, 0x00f3000d, 0x00f30807, 0x00f3100d, 0x00f31807, 0x00f3200d,
+    0x00f32807, 0x00f3300d, 0x00f33807, 0x00f3400d, 0x00f34807, 0x00f3500d, 0x00f35807, 0x00f3600d,
+    0x00f36807, 0x00f3700d, 0x00f37807, 0x00f3800d, 0x00f38807, 0x00f3900d, 0x00f39807, 0x00f3a00d,
+    0x00f3a807, 0x00f3b00d, 0x00f3b807, 0x00f3c00d, 0x00f3c807, 0x00f3d00d, 0x00f3d807, 0x00f3e00d,
+    0x00f3e807, 0x00f3f00d, 0x00f3f807, 0x00f4000d, 0x00f40807, 0x00f4100d, 0x00f41807, 0x00f4200d,
+    0x00f42807, 0x00f4300d, 0x00f43807, 0x00f4400d, 0x00f44807, 0x00f4500d, 0x00f45807, 0x00f4600d,
+    0x00f46807, 0x00f4700d, 0x00f47807, 0x00f4800d, 0x00f48807, 0x00f4900d, 0x00f49807, 0x00f4a00d,
+    0x00f4a807, 0x00f4d015, 0x00f4d80d, 0x00f4e007, 0x00f4f00d, 0x00f4f807, 0x00f5000d, 0x00f50807,
+    0x00f5100d, 0x00f51807, 0x00f5200d, 0x00f52807, 0x00f5300d, 0x00f53807, 0x00f5400d, 0x00f54807,
+    0x00f5500d, 0x00f55807, 0x00f5600d, 0x00f56807, 0x00f5700d, 0x00f57807, 0x00f5800d, 0x00f58807,
+    0x00f5900d, 0x00f59807, 0x00f5a00d, 0x00f5a807, 0x00f5b00d, 0x00f5b807, 0x00f5c00d, 0x00f5c807,
+    0x00f5d00d, 0x00f5d807, 0x00f5e00d, 0x00f5e807, 0x00f5f00d, 0x00f5f807, 0x00f6000d, 0x00f60807,
+    0x00f6100d, 0x00f61807, 0x00f6200d, 0x00f62807, 0x00f6300d, 0x00f63807, 0x00f6400d, 0x00f64807,
+    0x00f6500d, 0x00f65807, 0x00f6600d, 0x00f66807, 0x00f6700d, 0x00f67807, 0x00f6800d, 0x00f68807,
+    0x00f6900d, 0x00f69807, 0x00f6a00d, 0x00f6a807, 0x00f6b00d, 0x00f6b807, 0x00f6c00d, 0x00f6c807,
+    0x00f6d00d, 0x00f6d807, 0x00f6e00d, 0x00f6e807, 0x00f6f00d, 0x00f6f807, 0x00f7000d, 0x00f70807,
+    0x00f7100d, 0x00f71807, 0x00f7200d, 0x00f72807, 0x00f7300d, 0x00f73807, 0x00f7400d, 0x00f74807,
+    0x00f7500d, 0x00f75807, 0x00f7600d, 0x00f76807, 0x00f7700d, 0x00f77807, 0x00f7800d, 0x00f78807,
+    0x00f7900d, 0x00f79807, 0x00f7a00d, 0x00f7a807, 0x00f7b00d, 0x00f7b807, 0x00f7c00d, 0x00f7c807,
+    0x00f7d00d, 0x00f7d807, 0x00f7e00d, 0x00f7e807, 0x00f7f00d, 0x00f7f807, 0x00f8400d, 0x00f8480d,
+    0x00f8500d, 0x00f8580d, 0x00f8600d, 0x00f8680d, 0x00f8700d, 0x00f8780d, 0x00f88007, 0x00f8b001,
+    0x00f8c00d, 0x00f8c80d, 0x00f8d00d, 0x00f8d80d, 0x00f8e00d, 0x00f8e80d, 0x00f8f001, 0x00f90007,
+    0x00f9400d, 0x00f9480d, 0x00f9500d, 0x00f9580d, 0x00f9600d, 0x00f9680d, 0x00f9700d, 0x00f9780d,
+    0x00f98007, 0x00f9c00d, 0x00f9c80d, 0x00f9d00d, 0x00f9d80d, 0x00f9e00d, 0x00f9e80d, 0x00f9f00d,
+    0x00f9f80d, 0x00fa0007, 0x00fa3001, 0x00fa400d, 0x00fa480d, 0x00fa500d, 0x00fa580d, 0x00fa600d,
+    0x00fa680d, 0x00fa7001, 0x00fa8007, 0x00fac001, 0x00fac80d, 0x00fad001, 0x00fad80d, 0x00fae001,
+    0x00fae80d, 0x00faf001, 0x00faf80d, 0x00fb0007, 0x00fb400d, 0x00fb480d, 0x00fb500d, 0x00fb580d,
+    0x00fb600d, 0x00fb680d, 0x00fb700d, 0x00fb780d, 0x00fb8007, 0x00fb880d, 0x00fb9007, 0x00fb980d,
+    0x00fba007, 0x00fba80d, 0x00fbb007, 0x00fbb80d, 0x00fbc007, 0x00fbc80d, 0x00fbd007, 0x00fbd80d,
+    0x00fbe007, 0x00fbe80d, 0x00fbf001, 0x00fc0015, 0x00fc0815, 0x00fc1015, 0x00fc1815, 0x00fc2015,
+    0x00fc2815, 0x00fc3015, 0x00fc3815, 0x00fc4015, 0x00fc4815, 0x00fc5015, 0x00fc5815, 0x00fc6015,
+    0x00fc6815, 0x00fc7015, 0x00fc7815, 0x00fc8015, 0x00fc8815, 0x00fc9015, 0x00fc9815, 0x00fca015,
+    0x00fca815, 0x00fcb015, 0x00fcb815, 0x00fcc015, 0x00fcc815, 0x00fcd015, 0x00fcd815, 0x00fce015,
+    0x00fce815, 0x00fcf015, 0x00fcf815, 0x00fd0015, 0x00fd0815, 0x00fd1015, 0x00fd1815, 0x00fd2015,
+    0x00fd2815, 0x00fd3015, 0x00fd3815, 0x00fd4015, 0x00fd4815, 0x00fd5015, 0x00fd5815, 0x00fd6015,
+    0x00fd6815, 0x00fd7015, 0x00fd7815, 0x00fd8007, 0x00fd9015, 0x00fd9815, 0x00fda015, 0x00fda801,
+    0x00fdb007, 0x00fdb815, 0x00fdc00d, 0x00fdc80d, 0x00fdd00d, 0x00fdd80d, 0x00fde015, 0x00fde813,
+    0x00fdf00d, 0x00fdf813, 0x00fe0013, 0x00fe081b, 0x00fe1015, 0x00fe1815, 0x00fe2015, 0x00fe2801,
+    0x00fe3007, 0x00fe3815, 0x00fe400d, 0x00fe480d, 0x00fe500d, 0x00fe580d, 0x00fe6015, 0x00fe681b,
+    0x00fe701b, 0x00fe781b, 0x00fe8007, 0x00fe980d, 0x00fea001, 0x00feb007, 0x00fec00d, 0x00fec80d,
+    0x00fed00d, 0x00fed80d, 0x00fee001, 0x00fee81b, 0x00fef01b, 0x00fef81b, 0x00ff0007, 0x00ff180d,
+    0x00ff2007, 0x00ff400d, 0x00ff480d, 0x00ff500d, 0x00ff580d, 0x00ff600d, 0x00ff681b, 0x00ff701b,
+    0x00ff780b, 0x00ff8001, 0x00ff9015, 0x00ff9815, 0x00ffa015, 0x00ffa801, 0x00ffb007, 0x00ffb815,
+    0x00ffc00d, 0x00ffc80d, 0x00ffd00d, 0x00ffd80d, 0x00ffe015, 0x00ffe813, 0x00fff013, 0x00fff801,
+    0x0100000b, 0x01005804, 0x01006006, 0x01007001, 0x01008007, 0x0100880d, 0x01009007, 0x0100b813,
+    0x0100c007, 0x01012001, 0x01013807, 0x01014001, 0x0101780b, 0x01018007, 0x01019815, 0x0101a01d,
+    0x0101a807, 0x0101b015, 0x0101b81d, 0x0101c007, 0x0101e013, 0x0101e807, 0x0101f013, 0x0101f807,
+    0x01023813, 0x01024013, 0x01024813, 0x01025007, 0x0102b825, 0x0102c007, 0x0102f80b, 0x01030004,
+    0x01030801, 0x01032004, 0x01032801, 0x0103800d, 0x0103880d, 0x01039001, 0x0103a00d, 0x0103a80d,
+    0x0103b00d, 0x0103b80d, 0x0103c00d, 0x0103c80d, 0x0103d00b, 0x0103d80d, 0x0103e00b, 0x0103e80b,
+    0x0103f00b, 0x0103f80d, 0x0104000d, 0x0104080d, 0x0104100d, 0x0104180d, 0x0104200d, 0x0104280d,
+    0x0104300d, 0x0104380d, 0x0104400d, 0x0104480d, 0x0104500b, 0x0104580d, 0x0104600b, 0x0104680b,
+    0x0104700b, 0x01047801, 0x0104800d, 0x0104880d, 0x0104900d, 0x0104980d, 0x0104a00d, 0x0104a80d,
+    0x0104b00d, 0x0104b80d, 0x0104c00d, 0x0104c80d, 0x0104d00d, 0x0104d80d, 0x0104e00d, 0x0104e801,
+    0x01050007, 0x01054015, 0x01054807, 0x01060801, 0x01068007, 0x01078801, 0x0108001b, 0x0108081b,
+    0x0108100d, 0x01081815, 0x01082007, 0x0108281b, 0x0108301b, 0x0108380d, 0x01084007, 0x01084815,
+    0x0108500d, 0x0108580d, 0x0108780d, 0x0108800d, 0x0108900d, 0x0108a007, 0x0108a80d, 0x0108b015,
+    0x0108b807, 0x0108c80d, 0x0108d00d, 0x0108d80d, 0x0108f007, 0x01090015, 0x0109081d, 0x01091015,
+    0x01091807, 0x0109200d, 0x01092807, 0x0109300d, 0x01093807, 0x0109400d, 0x01094807, 0x0109500d,
+    0x0109580d, 0x0109600d, 0x0109680d, 0x01097007, 0x0109780d, 0x0109880d, 0x01099001, 0x0109980d,
+    0x0109a00d, 0x0109a80d, 0x0109b00d, 0x0109b80d, 0x0109c00d, 0x0109c80d, 0x0109d007, 0x0109d81d,
+    0x0109e00d, 0x0109e80d, 0x0109f80d, 0x010a000d, 0x010a0807, 0x010a280d, 0x010a380d, 0x010a400d,
+    0x010a480d, 0x010a5007, 0x010a801d, 0x010a881d, 0x010a9025, 0x010a981d, 0x010aa01d, 0x010aa81d,
+    0x010ab01d, 0x010ab81d, 0x010ac01d, 0x010ac81d, 0x010ad01d, 0x010ad81d, 0x010ae01d, 0x010ae81d,
+    0x010af01d, 0x010af815, 0x010b000d, 0x010b0815, 0x010b101d, 0x010b1815, 0x010b200d, 0x010b2815,
+    0x010b301d, 0x010b3825, 0x010b4015, 0x010b480d, 0x010b5015, 0x010b581d, 0x010b600d, 0x010b680d,
+    0x010b700d, 0x010b780d, 0x010b800d, 0x010b8815, 0x010b901d, 0x010b9815, 0x010ba00d, 0x010ba815,
+    0x010bb01d, 0x010bb825, 0x010bc015, 0x010bc80d, 0x010bd015, 0x010bd81d, 0x010be00d, 0x010be80d,
+    0x010bf00d, 0x010bf80d, 0x010c0007, 0x010c1801, 0x010c2007, 0x010c481d, 0x010c5007, 0x010c6001,
+    0x010c8007, 0x01116015, 0x0111681d, 0x01117007, 0x01117815, 0x0111801d, 0x01118807, 0x0119480d,
+    0x0119500d, 0x01195807, 0x01213801, 0x01220007, 0x01225801, 0x0123000d, 0x0123080d, 0x0123100d,
+    0x0123180d, 0x0123200d, 0x0123280d, 0x0123300d, 0x0123380d, 0x0123400d, 0x01234815, 0x01235015,
+    0x01235815, 0x01236015, 0x01236815, 0x01237015, 0x01237815, 0x01238015, 0x01238815, 0x01239015,
+    0x01239815, 0x0123a01b, 0x0123a81b, 0x0123b01b, 0x0123b81b, 0x0123c01b, 0x0123c81b, 0x0123d01b,
+    0x0123d81b, 0x0123e01b, 0x0123e823, 0x0123f023, 0x0123f823, 0x01240023, 0x01240823, 0x01241023,
+    0x01241823, 0x01242023, 0x01242823, 0x01243023, 0x01243823, 0x01244001, 0x0124e01b, 0x0124e81b,
+    0x0124f01b, 0x0124f81b, 0x0125001b, 0x0125081b, 0x0125101b, 0x0125181b, 0x0125201b, 0x0125281b,
+    0x0125301b, 0x0125381b, 0x0125401b, 0x0125481b, 0x0125501b, 0x0125581b, 0x0125601b, 0x0125681b,
+    0x0125701b, 0x0125781b, 0x0125801b, 0x0125881b, 0x0125901b, 0x0125981b, 0x0125a01b, 0x0125a81b,
+    0x0125b00d, 0x0125b80d, 0x0125c00d, 0x0125c80d, 0x0125d00d, 0x0125d80d, 0x0125e00d, 0x0125e80d,
+    0x0125f00d, 0x0125f80d, 0x0126000d, 0x0126080d, 0x0126100d, 0x0126180d, 0x0126200d, 0x0126280d,
+    0x0126300d, 0x0126380d, 0x0126400d, 0x0126480d, 0x0126500d, 0x0126580d, 0x0126600d, 0x0126680d,
+    0x0126700d, 0x0126780d, 0x0126800d, 0x0126880d, 0x0126900d, 0x0126980d, 0x0126a00d, 0x0126a80d,
+    0x0126b00d, 0x0126b80d, 0x0126c00d, 0x0126c80d, 0x0126d00d, 0x0126d80d, 0x0126e00d, 0x0126e80d,
+    0x0126f00d, 0x0126f80d, 0x0127000d, 0x0127080d, 0x0127100d, 0x0127180d, 0x0127200d, 0x0127280d,
+    0x0127300d, 0x0127380d, 0x0127400d, 0x0127480d, 0x0127500d, 0x01275807, 0x01506025, 0x01506807,
+    0x0153a01b, 0x0153a813, 0x0153b01b, 0x0153b807, 0x0156e015, 0x0156e807, 0x015ba001, 0x015bb007,
+    0x015cb001, 0x015cb807, 0x0160000d, 0x0160080d, 0x0160100d, 0x0160180d, 0x0160200d, 0x0160280d,
+    0x0160300d, 0x0160380d, 0x0160400d, 0x0160480d, 0x0160500d, 0x0160580d, 0x0160600d, 0x0160680d,
+    0x0160700d, 0x0160780d, 0x0160800d, 0x0160880d, 0x0160900d, 0x0160980d, 0x0160a00d, 0x0160a80d,
+    0x0160b00d, 0x0160b80d, 0x0160c00d, 0x0160c80d, 0x0160d00d, 0x0160d80d, 0x0160e00d, 0x0160e80d,
+    0x0160f00d, 0x0160f80d, 0x0161000d, 0x0161080d, 0x0161100d, 0x0161180d, 0x0161200d, 0x0161280d,
+    0x0161300d, 0x0161380d, 0x0161400d, 0x0161480d, 0x0161500d, 0x0161580d, 0x0161600d, 0x0161680d,
+    0x0161700d, 0x0161780d, 0x01618007, 0x0163000d, 0x01630807, 0x0163100d, 0x0163180d, 0x0163200d,
+    0x01632807, 0x0163380d, 0x01634007, 0x0163480d, 0x01635007, 0x0163580d, 0x01636007, 0x0163680d,
+    0x0163700d, 0x0163780d, 0x0163800d, 0x01638807, 0x0163900d, 0x01639807, 0x0163a80d, 0x0163b007,
+    0x0163e00d, 0x0163e80d, 0x0163f00d, 0x0163f80d, 0x0164000d, 0x01640807, 0x0164100d, 0x01641807,
+    0x0164200d, 0x01642807, 0x0164300d, 0x01643807, 0x0164400d, 0x01644807, 0x0164500d, 0x01645807,
+    0x0164600d, 0x01646807, 0x0164700d, 0x01647807, 0x0164800d, 0x01648807, 0x0164900d, 0x01649807,
+    0x0164a00d, 0x0164a807, 0x0164b00d, 0x0164b807, 0x0164c00d, 0x0164c807, 0x0164d00d, 0x0164d807,
+    0x0164e00d, 0x0164e807, 0x0164f00d, 0x0164f807, 0x0165000d, 0x01650807, 0x0165100d, 0x01651807,
+    0x0165200d, 0x01652807, 0x0165300d, 0x01653807, 0x0165400d, 0x01654807, 0x0165500d, 0x01655807,
+    0x0165600d, 0x01656807, 0x0165700d, 0x01657807, 0x0165800d, 0x01658807, 0x0165900d, 0x01659807,
+    0x0165a00d, 0x0165a807, 0x0165b00d, 0x0165b807, 0x0165c00d, 0x0165c807, 0x0165d00d, 0x0165d807,
+    0x0165e00d, 0x0165e807, 0x0165f00d, 0x0165f807, 0x0166000d, 0x01660807, 0x0166100d, 0x01661807,
+    0x0166200d, 0x01662807, 0x0166300d, 0x01663807, 0x0166400d, 0x01664807, 0x0166500d, 0x01665807,
+    0x0166600d, 0x01666807, 0x0166700d, 0x01667807, 0x0166800d, 0x01668807, 0x0166900d, 0x01669807,
+    0x0166a00d, 0x0166a807, 0x0166b00d, 0x0166b807, 0x0166c00d, 0x0166c807, 0x0166d00d, 0x0166d807,
+    0x0166e00d, 0x0166e807, 0x0166f00d, 0x0166f807, 0x0167000d, 0x01670807, 0x0167100d, 0x01671807,
+    0x0167580d, 0x01676007, 0x0167680d, 0x01677007, 0x0167900d, 0x01679807, 0x0167a001, 0x0167c807,
+    0x01693001, 0x01693807, 0x01694001, 0x01696807, 0x01697001, 0x01698007, 0x016b4001, 0x016b780d,
+    0x016b8007, 0x016b8801, 0x016bf807, 0x016cb801, 0x016d0007, 0x016d3801, 0x016d4007, 0x016d7801,
+    0x016d8007, 0x016db801, 0x016dc007, 0x016df801, 0x016e0007, 0x016e3801, 0x016e4007, 0x016e7801,
+    0x016e8007, 0x016eb801, 0x016ec007, 0x016ef801, 0x016f0007, 0x0172f001, 0x01740007, 0x0174d001,
+    0x0174d807, 0x0174f80d, 0x01750007, 0x0177980d, 0x0177a001, 0x0178000d, 0x0178080d, 0x0178100d,
+    0x0178180d, 0x0178200d, 0x0178280d, 0x0178300d, 0x0178380d, 0x0178400d, 0x0178480d, 0x0178500d,
+    0x0178580d, 0x0178600d, 0x0178680d, 0x0178700d, 0x0178780d, 0x0178800d, 0x0178880d, 0x0178900d,
+    0x0178980d, 0x0178a00d, 0x0178a80d, 0x0178b00d, 0x0178b80d, 0x0178c00d, 0x0178c80d, 0x0178d00d,
+    0x0178d80d, 0x0178e00d, 0x0178e80d, 0x0178f00d, 0x0178f80d, 0x0179000d, 0x0179080d, 0x0179100d,
+    0x0179180d, 0x0179200d, 0x0179280d, 0x0179300d, 0x0179380d, 0x0179400d, 0x0179480d, 0x0179500d,
+    0x0179580d, 0x0179600d, 0x0179680d, 0x0179700d, 0x0179780d, 0x0179800d, 0x0179880d, 0x0179900d,
+    0x0179980d, 0x0179a00d, 0x0179a80d, 0x0179b00d, 0x0179b80d, 0x0179c00d, 0x0179c80d, 0x0179d00d,
+    0x0179d80d, 0x0179e00d, 0x0179e80d, 0x0179f00d, 0x0179f80d, 0x017a000d, 0x017a080d, 0x017a100d,
+    0x017a180d, 0x017a200d, 0x017a280d, 0x017a300d, 0x017a380d, 0x017a400d, 0x017a480d, 0x017a500d,
+    0x017a580d, 0x017a600d, 0x017a680d, 0x017a700d, 0x017a780d, 0x017a800d, 0x017a880d, 0x017a900d,
+    0x017a980d, 0x017aa00d, 0x017aa80d, 0x017ab00d, 0x017ab80d, 0x017ac00d, 0x017ac80d, 0x017ad00d,
+    0x017ad80d, 0x017ae00d, 0x017ae80d, 0x017af00d, 0x017af80d, 0x017b000d, 0x017b080d, 0x017b100d,
+    0x017b180d, 0x017b200d, 0x017b280d, 0x017b300d, 0x017b380d, 0x017b400d, 0x017b480d, 0x017b500d,
+    0x017b580d, 0x017b600d, 0x017b680d, 0x017b700d, 0x017b780d, 0x017b800d, 0x017b880d, 0x017b900d,
+    0x017b980d, 0x017ba00d, 0x017ba80d, 0x017bb00d, 0x017bb80d, 0x017bc00d, 0x017bc80d, 0x017bd00d,
+    0x017bd80d, 0x017be00d, 0x017be80d, 0x017bf00d, 0x017bf80d, 0x017c000d, 0x017c080d, 0x017c100d,
+    0x017c180d, 0x017c200d, 0x017c280d, 0x017c300d, 0x017c380d, 0x017c400d, 0x017c480d, 0x017c500d,
+    0x017c580d, 0x017c600d, 0x017c680d, 0x017c700d, 0x017c780d, 0x017c800d, 0x017c880d, 0x017c900d,
+    0x017c980d, 0x017ca00d, 0x017ca80d, 0x017cb00d, 0x017cb80d, 0x017cc00d, 0x017cc80d, 0x017cd00d,
+    0x017cd80d, 0x017ce00d, 0x017ce80d, 0x017cf00d, 0x017cf80d, 0x017d000d, 0x017d080d, 0x017d100d,
+    0x017d180d, 0x017d200d, 0x017d280d, 0x017d300d, 0x017d380d, 0x017d400d, 0x017d480d, 0x017d500d,
+    0x017d580d, 0x017d600d, 0x017d680d, 0x017d700d, 0x017d780d, 0x017d800d, 0x017d880d, 0x017d900d,
+    0x017d980d, 0x017da00d, 0x017da80d, 0x017db00d, 0x017db80d, 0x017dc00d, 0x017dc80d, 0x017dd00d,
+    0x017dd80d, 0x017de00d, 0x017de80d, 0x017df00d, 0x017df80d, 0x017e000d, 0x017e080d, 0x017e100d,
+    0x017e180d, 0x017e200d, 0x017e280d, 0x017e300d, 0x017e380d, 0x017e400d, 0x017e480d, 0x017e500d,
+    0x017e580d, 0x017e600d, 0x017e680d, 0x017e700d, 0x017e780d, 0x017e800d, 0x017e880d, 0x017e900d,
+    0x017e980d, 0x017ea00d, 0x017ea80d, 0x017eb001, 0x0180000b, 0x01800807, 0x0180100d, 0x01801807,
+    0x0181b00d, 0x0181b807, 0x0181c00d, 0x0181c80d, 0x0181d00d, 0x0181d807, 0x01820001, 0x01820807,
+    0x0184b801, 0x0184c807, 0x0184d813, 0x0184e013, 0x0184e807, 0x0184f815, 0x01850007, 0x0187f815,
+    0x01880001, 0x01882807, 0x01898001, 0x0189880d, 0x0189900d, 0x0189980d, 0x0189a00d, 0x0189a80d,
+    0x0189b00d, 0x0189b80d, 0x0189c00d, 0x0189c80d, 0x0189d00d, 0x0189d80d, 0x0189e00d, 0x0189e80d,
+    0x0189f00d, 0x0189f80d, 0x018a000d, 0x018a080d, 0x018a100d, 0x018a180d, 0x018a200d, 0x018a280d,
+    0x018a300d, 0x018a380d, 0x018a400d, 0x018a480d, 0x018a500d, 0x018a580d, 0x018a600d, 0x018a680d,
+    0x018a700d, 0x018a780d, 0x018a800d, 0x018a880d, 0x018a900d, 0x018a980d, 0x018aa00d, 0x018aa80d,
+    0x018ab00d, 0x018ab80d, 0x018ac00d, 0x018ac80d, 0x018ad00d, 0x018ad80d, 0x018ae00d, 0x018ae80d,
+    0x018af00d, 0x018af80d, 0x018b000d, 0x018b080d, 0x018b100d, 0x018b180d, 0x018b2001, 0x018b280d,
+    0x018b300d, 0x018b380d, 0x018b400d, 0x018b480d, 0x018b500d, 0x018b580d, 0x018b600d, 0x018b680d,
+    0x018b700d, 0x018b780d, 0x018b800d, 0x018b880d, 0x018b900d, 0x018b980d, 0x018ba00d, 0x018ba80d,
+    0x018bb00d, 0x018bb80d, 0x018bc00d, 0x018bc80d, 0x018bd00d, 0x018bd80d, 0x018be00d, 0x018be80d,
+    0x018bf00d, 0x018bf80d, 0x018c000d, 0x018c080d, 0x018c100d, 0x018c180d, 0x018c200d, 0x018c280d,
+    0x018c300d, 0x018c380d, 0x018c400d, 0x018c480d, 0x018c500d, 0x018c580d, 0x018c600d, 0x018c680d,
+    0x018c700d, 0x018c7801, 0x018c8007, 0x018c900d, 0x018c980d, 0x018ca00d, 0x018ca80d, 0x018cb00d,
+    0x018cb80d, 0x018cc00d, 0x018cc80d, 0x018cd00d, 0x018cd80d, 0x018ce00d, 0x018ce80d, 0x018cf00d,
+    0x018cf80d, 0x018d0007, 0x018f2001, 0x018f8007, 0x0190001b, 0x0190081b, 0x0190101b, 0x0190181b,
+    0x0190201b, 0x0190281b, 0x0190301b, 0x0190381b, 0x0190401b, 0x0190481b, 0x0190501b, 0x0190581b,
+    0x0190601b, 0x0190681b, 0x0190701b, 0x0190781b, 0x0190801b, 0x0190881b, 0x0190901b, 0x0190981b,
+    0x0190a01b, 0x0190a81b, 0x0190b01b, 0x0190b81b, 0x0190c01b, 0x0190c81b, 0x0190d01b, 0x0190d81b,
+    0x0190e01b, 0x0190e823, 0x0190f023, 0x0190f801, 0x0191001b, 0x0191081b, 0x0191101b, 0x0191181b,
+    0x0191201b, 0x0191281b, 0x0191301b, 0x0191381b, 0x0191401b, 0x0191481b, 0x0191501b, 0x0191581b,
+    0x0191601b, 0x0191681b, 0x0191701b, 0x0191781b, 0x0191801b, 0x0191881b, 0x0191901b, 0x0191981b,
+    0x0191a01b, 0x0191a81b, 0x0191b01b, 0x0191b81b, 0x0191c01b, 0x0191c81b, 0x0191d01b, 0x0191d81b,
+    0x0191e01b, 0x0191e81b, 0x0191f01b, 0x0191f81b, 0x0192001b, 0x0192081b, 0x0192101b, 0x0192181b,
+    0x0192200d, 0x0192280d, 0x0192300d, 0x0192380d, 0x01924007, 0x0192801d, 0x01928815, 0x01929015,
+    0x01929815, 0x0192a015, 0x0192a815, 0x0192b015, 0x0192b815, 0x0192c015, 0x0192c815, 0x0192d015,
+    0x0192d815, 0x0192e015, 0x0192e815, 0x0192f015, 0x0192f815, 0x0193000d, 0x0193080d, 0x0193100d,
+    0x0193180d, 0x0193200d, 0x0193280d, 0x0193300d, 0x0193380d, 0x0193400d, 0x0193480d, 0x0193500d,
+    0x0193580d, 0x0193600d, 0x0193680d, 0x0193700d, 0x0193780d, 0x0193800d, 0x0193880d, 0x0193900d,
+    0x0193980d, 0x0193a00d, 0x0193a80d, 0x0193b00d, 0x0193b80d, 0x0193c00d, 0x0193c80d, 0x0193d00d,
+    0x0193d80d, 0x0193e015, 0x0193e815, 0x0193f00d, 0x0193f807, 0x0194000d, 0x0194080d, 0x0194100d,
+    0x0194180d, 0x0194200d, 0x0194280d, 0x0194300d, 0x0194380d, 0x0194400d, 0x0194480d, 0x0194500d,
+    0x0194580d, 0x0194600d, 0x0194680d, 0x0194700d, 0x0194780d, 0x0194800d, 0x0194880d, 0x0194900d,
+    0x0194980d, 0x0194a00d, 0x0194a80d, 0x0194b00d, 0x0194b80d, 0x0194c00d, 0x0194c80d, 0x0194d00d,
+    0x0194d80d, 0x0194e00d, 0x0194e80d, 0x0194f00d, 0x0194f80d, 0x0195000d, 0x0195080d, 0x0195100d,
+    0x0195180d, 0x0195200d, 0x0195280d, 0x0195300d, 0x0195380d, 0x0195400d, 0x0195480d, 0x0195500d,
+    0x0195580d, 0x0195600d, 0x0195680d, 0x0195700d, 0x0195780d, 0x0195800d, 0x01958815, 0x01959015,
+    0x01959815, 0x0195a015, 0x0195a815, 0x0195b015, 0x0195b815, 0x0195c015, 0x0195c815, 0x0195d015,
+    0x0195d815, 0x0195e015, 0x0195e815, 0x0195f015, 0x0195f815, 0x01960015, 0x01960815, 0x01961015,
+    0x01961815, 0x01962015, 0x01962815, 0x01963015, 0x01963815, 0x01964015, 0x0196481d, 0x0196501d,
+    0x0196581d, 0x01966015, 0x0196681d, 0x01967015, 0x0196781d, 0x0196800d, 0x0196880d, 0x0196900d,
+    0x0196980d, 0x0196a00d, 0x0196a80d, 0x0196b00d, 0x0196b80d, 0x0196c00d, 0x0196c80d, 0x0196d00d,
+    0x0196d80d, 0x0196e00d, 0x0196e80d, 0x0196f00d, 0x0196f80d, 0x0197000d, 0x0197080d, 0x0197100d,
+    0x0197180d, 0x0197200d, 0x0197280d, 0x0197300d, 0x0197380d, 0x0197400d, 0x0197480d, 0x0197500d,
+    0x0197580d, 0x0197600d, 0x0197680d, 0x0197700d, 0x0197780d, 0x0197800d, 0x0197880d, 0x0197900d,
+    0x0197980d, 0x0197a00d, 0x0197a80d, 0x0197b00d, 0x0197b80d, 0x0197c00d, 0x0197c80d, 0x0197d00d,
+    0x0197d80d, 0x0197e00d, 0x0197e80d, 0x0197f00d, 0x0197f815, 0x01980025, 0x01980825, 0x01981025,
+    0x0198181d, 0x01982025, 0x0198281d, 0x0198301d, 0x0198382d, 0x01984025, 0x0198481d, 0x0198501d,
+    0x0198581d, 0x01986025, 0x01986825, 0x0198701d, 0x0198781d, 0x01988015, 0x0198881d, 0x01989025,
+    0x01989825, 0x0198a015, 0x0198a82d, 0x0198b035, 0x0198b82d, 0x0198c01d, 0x0198c82d, 0x0198d02d,
+    0x0198d825, 0x0198e01d, 0x0198e81d, 0x0198f01d, 0x0198f825, 0x0199002d, 0x01990825, 0x0199101d,
+    0x0199181d, 0x0199201d, 0x01992815, 0x01993015, 0x01993815, 0x01994015, 0x0199481d, 0x0199501d,
+    0x0199582d, 0x0199601d, 0x01996825, 0x0199702d, 0x0199781d, 0x01998015, 0x01998815, 0x0199902d,
+    0x01999825, 0x0199a02d, 0x0199a81d, 0x0199b02d, 0x0199b815, 0x0199c01d, 0x0199c81d, 0x0199d01d,
+    0x0199d81d, 0x0199e01d, 0x0199e825, 0x0199f01d, 0x0199f815, 0x019a001d, 0x019a081d, 0x019a101d,
+    0x019a1825, 0x019a201d, 0x019a281d, 0x019a301d, 0x019a382d, 0x019a4025, 0x019a4815, 0x019a502d,
+    0x019a5815, 0x019a6025, 0x019a6825, 0x019a701d, 0x019a781d, 0x019a801d, 0x019a8825, 0x019a9015,
+    0x019a981d, 0x019aa025, 0x019aa815, 0x019ab02d, 0x019ab81d, 0x019ac015, 0x019ac815, 0x019ad015,
+    0x019ad815, 0x019ae015, 0x019ae815, 0x019af015, 0x019af815, 0x019b0015, 0x019b0815, 0x019b101d,
+    0x019b181d, 0x019b201d, 0x019b281d, 0x019b301d, 0x019b381d, 0x019b401d, 0x019b481d, 0x019b501d,
+    0x019b581d, 0x019b601d, 0x019b681d, 0x019b701d, 0x019b781d, 0x019b801d, 0x019b881d, 0x019b9015,
+    0x019b9815, 0x019ba01d, 0x019ba815, 0x019bb015, 0x019bb815, 0x019bc01d, 0x019bc81d, 0x019bd015,
+    0x019bd815, 0x019be015, 0x019be815, 0x019bf015, 0x019bf825, 0x019c0015, 0x019c0815, 0x019c1015,
+    0x019c1815, 0x019c2015, 0x019c2815, 0x019c3015, 0x019c3815, 0x019c401d, 0x019c4825, 0x019c5015,
+    0x019c5815, 0x019c6015, 0x019c6815, 0x019c7015, 0x019c7815, 0x019c8015, 0x019c881d, 0x019c901d,
+    0x019c981d, 0x019ca01d, 0x019ca815, 0x019cb015, 0x019cb815, 0x019cc015, 0x019cc815, 0x019cd015,
+    0x019cd815, 0x019ce015, 0x019ce815, 0x019cf015, 0x019cf81d, 0x019d001d, 0x019d0815, 0x019d101d,
+    0x019d181d, 0x019d201d, 0x019d2815, 0x019d301d, 0x019d381d, 0x019d4025, 0x019d4815, 0x019d501d,
+    0x019d581d, 0x019d601d, 0x019d681d, 0x019d702d, 0x019d7835, 0x019d8015, 0x019d8815, 0x019d9015,
+    0x019d9815, 0x019da015, 0x019da815, 0x019db015, 0x019db815, 0x019dc015, 0x019dc815, 0x019dd015,
+    0x019dd815, 0x019de015, 0x019de815, 0x019df015, 0x019df815, 0x019e0015, 0x019e0815, 0x019e1001,
+    0x019e1815, 0x019e2015, 0x019e2815, 0x019e3025, 0x019e3801, 0x019e4015, 0x019e4815, 0x019e5015,
+    0x019e5815, 0x019e6015, 0x019e6815, 0x019e7015, 0x019e7815, 0x019e8015, 0x019e8815, 0x019e901d,
+    0x019e9815, 0x019ea015, 0x019ea81d, 0x019eb01d, 0x019eb815, 0x019ec001, 0x019ec81d, 0x019ed015,
+    0x019ed815, 0x019ee015, 0x019ee815, 0x019ef01d, 0x019ef81d, 0x019f0015, 0x019f0815, 0x019f1015,
+    0x019f1815, 0x019f2015, 0x019f2815, 0x019f3015, 0x019f3815, 0x019f4015, 0x019f481d, 0x019f501d,
+    0x019f581d, 0x019f601d, 0x019f681d, 0x019f701d, 0x019f781d, 0x019f801d, 0x019f881d, 0x019f901d,
+    0x019f981d, 0x019fa01d, 0x019fa81d, 0x019fb01d, 0x019fb81d, 0x019fc01d, 0x019fc81d, 0x019fd01d,
+    0x019fd81d, 0x019fe01d, 0x019fe81d, 0x019ff01d, 0x019ff81d, 0x01a00007, 0x05246801, 0x05248007,
+    0x05263801, 0x05268007, 0x05316001, 0x0532000d, 0x05320807, 0x0532100d, 0x05321807, 0x0532200d,
+    0x05322807, 0x0532300d, 0x05323807, 0x0532400d, 0x05324807, 0x0532500d, 0x05325807, 0x0532600d,
+    0x05326807, 0x0532700d, 0x05327807, 0x0532800d, 0x05328807, 0x0532900d, 0x05329807, 0x0532a00d,
+    0x0532a807, 0x0532b00d, 0x0532b807, 0x0532c00d, 0x0532c807, 0x0532d00d, 0x0532d807, 0x0532e00d,
+    0x0532e807, 0x0532f00d, 0x0532f807, 0x0533000d, 0x05330807, 0x0533100d, 0x05331807, 0x0533200d,
+    0x05332807, 0x0533300d, 0x05333807, 0x0533400d, 0x05334807, 0x0533500d, 0x05335807, 0x0533600d,
+    0x05336807, 0x0534000d, 0x05340807, 0x0534100d, 0x05341807, 0x0534200d, 0x05342807, 0x0534300d,
+    0x05343807, 0x0534400d, 0x05344807, 0x0534500d, 0x05345807, 0x0534600d, 0x05346807, 0x0534700d,
+    0x05347807, 0x0534800d, 0x05348807, 0x0534900d, 0x05349807, 0x0534a00d, 0x0534a807, 0x0534b00d,
+    0x0534b807, 0x0534c00d, 0x0534c807, 0x0534d00d, 0x0534d807, 0x0534e00d, 0x0534e80d, 0x0534f007,
+    0x0537c001, 0x05380007, 0x0539100d, 0x05391807, 0x0539200d, 0x05392807, 0x0539300d, 0x05393807,
+    0x0539400d, 0x05394807, 0x0539500d, 0x05395807, 0x0539600d, 0x05396807, 0x0539700d, 0x05397807,
+    0x0539900d, 0x05399807, 0x0539a00d, 0x0539a807, 0x0539b00d, 0x0539b807, 0x0539c00d, 0x0539c807,
+    0x0539d00d, 0x0539d807, 0x0539e00d, 0x0539e807, 0x0539f00d, 0x0539f807, 0x053a000d, 0x053a0807,
+    0x053a100d, 0x053a1807, 0x053a200d, 0x053a2807, 0x053a300d, 0x053a3807, 0x053a400d, 0x053a4807,
+    0x053a500d, 0x053a5807, 0x053a600d, 0x053a6807, 0x053a700d, 0x053a7807, 0x053a800d, 0x053a8807,
+    0x053a900d, 0x053a9807, 0x053aa00d, 0x053aa807, 0x053ab00d, 0x053ab807, 0x053ac00d, 0x053ac807,
+    0x053ad00d, 0x053ad807, 0x053ae00d, 0x053ae807, 0x053af00d, 0x053af807, 0x053b000d, 0x053b0807,
+    0x053b100d, 0x053b1807, 0x053b200d, 0x053b2807, 0x053b300d, 0x053b3807, 0x053b400d, 0x053b4807,
+    0x053b500d, 0x053b5807, 0x053b600d, 0x053b6807, 0x053b700d, 0x053b7807, 0x053b800d, 0x053b8807,
+    0x053bc80d, 0x053bd007, 0x053bd80d, 0x053be007, 0x053be80d, 0x053bf00d, 0x053bf807, 0x053c000d,
+    0x053c0807, 0x053c100d, 0x053c1807, 0x053c200d, 0x053c2807, 0x053c300d, 0x053c3807, 0x053c580d,
+    0x053c6007, 0x053c680d, 0x053c7007, 0x053c800d, 0x053c8807, 0x053c900d, 0x053c9807, 0x053cb00d,
+    0x053cb807, 0x053cc00d, 0x053cc807, 0x053cd00d, 0x053cd807, 0x053ce00d, 0x053ce807, 0x053cf00d,
+    0x053cf807, 0x053d000d, 0x053d0807, 0x053d100d, 0x053d1807, 0x053d200d, 0x053d2807, 0x053d300d,
+    0x053d3807, 0x053d400d, 0x053d4807, 0x053d500d, 0x053d580d, 0x053d600d, 0x053d680d, 0x053d700d,
+    0x053d7807, 0x053d800d, 0x053d880d, 0x053d900d, 0x053d980d, 0x053da00d, 0x053da807, 0x053db00d,
+    0x053db807, 0x053dc00d, 0x053dc807, 0x053dd00d, 0x053dd807, 0x053de00d, 0x053de807, 0x053df00d,
+    0x053df807, 0x053e000d, 0x053e0807, 0x053e100d, 0x053e1807, 0x053e200d, 0x053e280d, 0x053e300d,
+    0x053e380d, 0x053e4007, 0x053e480d, 0x053e5007, 0x053e5801, 0x053e800d, 0x053e8807, 0x053e9001,
+    0x053e9807, 0x053ea001, 0x053ea807, 0x053eb00d, 0x053eb807, 0x053ec00d, 0x053ec807, 0x053ed001,
+    0x053f900d, 0x053f980d, 0x053fa00d, 0x053fa80d, 0x053fb007, 0x053fc00d, 0x053fc80d, 0x053fd007,
+    0x05416801, 0x05418007, 0x0541d001, 0x05420007, 0x0543c001, 0x05440007, 0x05463001, 0x05467007,
+    0x0546d001, 0x05470007, 0x054aa001, 0x054af807, 0x054be801, 0x054c0007, 0x054e7001, 0x054e7807,
+    0x054ed001, 0x054ef007, 0x054ff801, 0x05500007, 0x0551b801, 0x05520007, 0x05527001, 0x05528007,
+    0x0552d001, 0x0552e007, 0x05561801, 0x0556d807, 0x0557b801, 0x05580807, 0x05583801, 0x05584807,
+    0x05587801, 0x05588807, 0x0558b801, 0x05590007, 0x05593801, 0x05594007, 0x05597801, 0x05598007,
+    0x055ae00d, 0x055ae80d, 0x055af00d, 0x055af80d, 0x055b0007, 0x055b480d, 0x055b5007, 0x055b6001,
+    0x055b800d, 0x055b880d, 0x055b900d, 0x055b980d, 0x055ba00d, 0x055ba80d, 0x055bb00d, 0x055bb80d,
+    0x055bc00d, 0x055bc80d, 0x055bd00d, 0x055bd80d, 0x055be00d, 0x055be80d, 0x055bf00d, 0x055bf80d,
+    0x055c000d, 0x055c080d, 0x055c100d, 0x055c180d, 0x055c200d, 0x055c280d, 0x055c300d, 0x055c380d,
+    0x055c400d, 0x055c480d, 0x055c500d, 0x055c580d, 0x055c600d, 0x055c680d, 0x055c700d, 0x055c780d,
+    0x055c800d, 0x055c880d, 0x055c900d, 0x055c980d, 0x055ca00d, 0x055ca80d, 0x055cb00d, 0x055cb80d,
+    0x055cc00d, 0x055cc80d, 0x055cd00d, 0x055cd80d, 0x055ce00d, 0x055ce80d, 0x055cf00d, 0x055cf80d,
+    0x055d000d, 0x055d080d, 0x055d100d, 0x055d180d, 0x055d200d, 0x055d280d, 0x055d300d, 0x055d380d,
+    0x055d400d, 0x055d480d, 0x055d500d, 0x055d580d, 0x055d600d, 0x055d680d, 0x055d700d, 0x055d780d,
+    0x055d800d, 0x055d880d, 0x055d900d, 0x055d980d, 0x055da00d, 0x055da80d, 0x055db00d, 0x055db80d,
+    0x055dc00d, 0x055dc80d, 0x055dd00d, 0x055dd80d, 0x055de00d, 0x055de80d, 0x055df00d, 0x055df80d,
+    0x055e0007, 0x055f7001, 0x055f8007, 0x055fd001, 0x05600007, 0x06bd2001, 0x06bd8007, 0x06be3801,
+    0x06be5807, 0x06bfe001, 0x07c8000d, 0x07c8080d, 0x07c8100d, 0x07c8180d, 0x07c8200d, 0x07c8280d,
+    0x07c8300d, 0x07c8380d, 0x07c8480d, 0x07c8500d, 0x07c8580d, 0x07c8600d, 0x07c8680d, 0x07c8700d,
+    0x07c8780d, 0x07c8800d, 0x07c8880d, 0x07c8900d, 0x07c8980d, 0x07c8a00d, 0x07c8a80d, 0x07c8b00d,
+    0x07c8b80d, 0x07c8c00d, 0x07c8c80d, 0x07c8d00d, 0x07c8d80d, 0x07c8e00d, 0x07c8e80d, 0x07c8f00d,
+    0x07c8f80d, 0x07c9000d, 0x07c9080d, 0x07c9100d, 0x07c9180d, 0x07c9200d, 0x07c9280d, 0x07c9300d,
+    0x07c9380d, 0x07c9400d, 0x07c9480d, 0x07c9500d, 0x07c9580d, 0x07c9600d, 0x07c9680d, 0x07c9700d,
+    0x07c9780d, 0x07c9800d, 0x07c9880d, 0x07c9900d, 0x07c9980d, 0x07c9a00d, 0x07c9a80d, 0x07c9b00d,
+    0x07c9b80d, 0x07c9c00d, 0x07c9c80d, 0x07c9d00d, 0x07c9d80d, 0x07c9e00d, 0x07c9e80d, 0x07c9f00d,
+    0x07c9f80d, 0x07ca000d, 0x07ca080d, 0x07ca100d, 0x07ca180d, 0x07ca200d, 0x07ca280d, 0x07ca300d,
+    0x07ca380d, 0x07ca400d, 0x07ca480d, 0x07ca500d, 0x07ca580d, 0x07ca600d, 0x07ca680d, 0x07ca700d,
+    0x07ca780d, 0x07ca800d, 0x07ca880d, 0x07ca900d, 0x07ca980d, 0x07caa00d, 0x07caa80d, 0x07cab00d,
+    0x07cab80d, 0x07cac00d, 0x07cac80d, 0x07cad00d, 0x07cad80d, 0x07cae00d, 0x07cae80d, 0x07caf00d,
+    0x07caf80d, 0x07cb000d, 0x07cb080d, 0x07cb100d, 0x07cb180d, 0x07cb200d, 0x07cb280d, 0x07cb300d,
+    0x07cb380d, 0x07cb400d, 0x07cb480d, 0x07cb500d, 0x07cb580d, 0x07cb600d, 0x07cb680d, 0x07cb700d,
+    0x07cb780d, 0x07cb800d, 0x07cb880d, 0x07cb900d, 0x07cb980d, 0x07cba00d, 0x07cba80d, 0x07cbb00d,
+    0x07cbb80d, 0x07cbc00d, 0x07cbc80d, 0x07cbd00d, 0x07cbd80d, 0x07cbe00d, 0x07cbe80d, 0x07cbf00d,
+    0x07cbf80d, 0x07cc000d, 0x07cc080d, 0x07cc100d, 0x07cc180d, 0x07cc200d, 0x07cc280d, 0x07cc300d,
+    0x07cc380d, 0x07cc400d, 0x07cc480d, 0x07cc500d, 0x07cc580d, 0x07cc600d, 0x07cc680d, 0x07cc700d,
+    0x07cc780d, 0x07cc800d, 0x07cc880d, 0x07cc900d, 0x07cc980d, 0x07cca00d, 0x07cca80d, 0x07ccb00d,
+    0x07ccb80d, 0x07ccc00d, 0x07ccc80d, 0x07ccd00d, 0x07ccd80d, 0x07cce00d, 0x07cce80d, 0x07ccf00d,
+    0x07ccf80d, 0x07cd000d, 0x07cd080d, 0x07cd100d, 0x07cd180d, 0x07cd200d, 0x07cd280d, 0x07cd300d,
+    0x07cd380d, 0x07cd400d, 0x07cd480d, 0x07cd500d, 0x07cd580d, 0x07cd600d, 0x07cd680d, 0x07cd700d,
+    0x07cd780d, 0x07cd800d, 0x07cd880d, 0x07cd900d, 0x07cd980d, 0x07cda00d, 0x07cda80d, 0x07cdb00d,
+    0x07cdb80d, 0x07cdc00d, 0x07cdc80d, 0x07cdd00d, 0x07cdd80d, 0x07cde00d, 0x07cde80d, 0x07cdf00d,
+    0x07cdf80d, 0x07ce000d, 0x07ce080d, 0x07ce100d, 0x07ce180d, 0x07ce200d, 0x07ce280d, 0x07ce300d,
+    0x07ce380d, 0x07ce400d, 0x07ce480d, 0x07ce500d, 0x07ce580d, 0x07ce600d, 0x07ce680d, 0x07ce700d,
+    0x07ce780d, 0x07ce800d, 0x07ce880d, 0x07ce900d, 0x07ce980d, 0x07cea00d, 0x07cea80d, 0x07ceb00d,
+    0x07ceb80d, 0x07cec00d, 0x07cec80d, 0x07ced00d, 0x07ced80d, 0x07cee00d, 0x07cee80d, 0x07cef00d,
+    0x07cef80d, 0x07cf000d, 0x07cf080d, 0x07cf100d, 0x07cf180d, 0x07cf200d, 0x07cf280d, 0x07cf300d,
+    0x07cf380d, 0x07cf400d, 0x07cf480d, 0x07cf500d, 0x07cf580d, 0x07cf600d, 0x07cf680d, 0x07cf700d,
+    0x07cf780d, 0x07cf800d, 0x07cf880d, 0x07cf900d, 0x07cf980d, 0x07cfa00d, 0x07cfa80d, 0x07cfb00d,
+    0x07cfb80d, 0x07cfc00d, 0x07cfc80d, 0x07cfd00d, 0x07cfd80d, 0x07cfe00d, 0x07cfe80d, 0x07cff00d,
+    0x07cff80d, 0x07d0000d, 0x07d0080d, 0x07d0100d, 0x07d0180d, 0x07d0200d, 0x07d0280d, 0x07d0300d,
+    0x07d0380d, 0x07d0400d, 0x07d0480d, 0x07d0500d, 0x07d0580d, 0x07d0600d, 0x07d0680d, 0x07d07007,
+    0x07d0800d, 0x07d08807, 0x07d0900d, 0x07d09807, 0x07d0a80d, 0x07d0b00d, 0x07d0b80d, 0x07d0c00d,
+    0x07d0c80d, 0x07d0d00d, 0x07d0d80d, 0x07d0e00d, 0x07d0e80d, 0x07d0f00d, 0x07d0f807, 0x07d1000d,
+    0x07d10807, 0x07d1100d, 0x07d11807, 0x07d1280d, 0x07d1300d, 0x07d13807, 0x07d1500d, 0x07d1580d,
+    0x07d1600d, 0x07d1680d, 0x07d1700d, 0x07d1780d, 0x07d1800d, 0x07d1880d, 0x07d1900d, 0x07d1980d,
+    0x07d1a00d, 0x07d1a80d, 0x07d1b00d, 0x07d1b80d, 0x07d1c00d, 0x07d1c80d, 0x07d1d00d, 0x07d1d80d,
+    0x07d1e00d, 0x07d1e80d, 0x07d1f00d, 0x07d1f80d, 0x07d2000d, 0x07d2080d, 0x07d2100d, 0x07d2180d,
+    0x07d2200d, 0x07d2280d, 0x07d2300d, 0x07d2380d, 0x07d2400d, 0x07d2480d, 0x07d2500d, 0x07d2580d,
+    0x07d2600d, 0x07d2680d, 0x07d2700d, 0x07d2780d, 0x07d2800d, 0x07d2880d, 0x07d2900d, 0x07d2980d,
+    0x07d2a00d, 0x07d2a80d, 0x07d2b00d, 0x07d2b80d, 0x07d2c00d, 0x07d2c80d, 0x07d2d00d, 0x07d2d80d,
+    0x07d2e00d, 0x07d2e80d, 0x07d2f80d, 0x07d3000d, 0x07d3080d, 0x07d3100d, 0x07d3180d, 0x07d3200d,
+    0x07d3280d, 0x07d3300d, 0x07d3380d, 0x07d3400d, 0x07d3480d, 0x07d3500d, 0x07d3580d, 0x07d3600d,
+    0x07d3680d, 0x07d37001, 0x07d3800d, 0x07d3880d, 0x07d3900d, 0x07d3980d, 0x07d3a00d, 0x07d3a80d,
+    0x07d3b00d, 0x07d3b80d, 0x07d3c00d, 0x07d3c80d, 0x07d3d00d, 0x07d3d80d, 0x07d3e00d, 0x07d3e80d,
+    0x07d3f00d, 0x07d3f80d, 0x07d4000d, 0x07d4080d, 0x07d4100d, 0x07d4180d, 0x07d4200d, 0x07d4280d,
+    0x07d4300d, 0x07d4380d, 0x07d4400d, 0x07d4480d, 0x07d4500d, 0x07d4580d, 0x07d4600d, 0x07d4680d,
+    0x07d4700d, 0x07d4780d, 0x07d4800d, 0x07d4880d, 0x07d4900d, 0x07d4980d, 0x07d4a00d, 0x07d4a80d,
+    0x07d4b00d, 0x07d4b80d, 0x07d4c00d, 0x07d4c80d, 0x07d4d00d, 0x07d4d80d, 0x07d4e00d, 0x07d4e80d,
+    0x07d4f00d, 0x07d4f80d, 0x07d5000d, 0x07d5080d, 0x07d5100d, 0x07d5180d, 0x07d5200d, 0x07d5280d,
+    0x07d5300d, 0x07d5380d, 0x07d5400d, 0x07d5480d, 0x07d5500d, 0x07d5580d, 0x07d5600d, 0x07d5680d,
+    0x07d5700d, 0x07d5780d, 0x07d5800d, 0x07d5880d, 0x07d5900d, 0x07d5980d, 0x07d5a00d, 0x07d5a80d,
+    0x07d5b00d, 0x07d5b80d, 0x07d5c00d, 0x07d5c80d, 0x07d5d00d, 0x07d5d80d, 0x07d5e00d, 0x07d5e80d,
+    0x07d5f00d, 0x07d5f80d, 0x07d6000d, 0x07d6080d, 0x07d6100d, 0x07d6180d, 0x07d6200d, 0x07d6280d,
+    0x07d6300d, 0x07d6380d, 0x07d6400d, 0x07d6480d, 0x07d6500d, 0x07d6580d, 0x07d6600d, 0x07d6680d,
+    0x07d6700d, 0x07d6780d, 0x07d6800d, 0x07d6880d, 0x07d6900d, 0x07d6980d, 0x07d6a00d, 0x07d6a80d,
+    0x07d6b00d, 0x07d6b80d, 0x07d6c00d, 0x07d6c80d, 0x07d6d001, 0x07d80015, 0x07d80815, 0x07d81015,
+    0x07d8181d, 0x07d8201d, 0x07d82815, 0x07d83801, 0x07d89815, 0x07d8a015, 0x07d8a815, 0x07d8b015,
+    0x07d8b815, 0x07d8c001, 0x07d8e815, 0x07d8f007, 0x07d8f815, 0x07d9000d, 0x07d9080d, 0x07d9100d,
+    0x07d9180d, 0x07d9200d, 0x07d9280d, 0x07d9300d, 0x07d9380d, 0x07d9400d, 0x07d9480b, 0x07d95015,
+    0x07d95815, 0x07d9601d, 0x07d9681d, 0x07d97015, 0x07d97815, 0x07d98015, 0x07d98815, 0x07d99015,
+    0x07d99815, 0x07d9a015, 0x07d9a815, 0x07d9b015, 0x07d9b801, 0x07d9c015, 0x07d9c815, 0x07d9d015,
+    0x07d9d815, 0x07d9e015, 0x07d9e801, 0x07d9f015, 0x07d9f801, 0x07da0015, 0x07da0815, 0x07da1001,
+    0x07da1815, 0x07da2015, 0x07da2801, 0x07da3015, 0x07da3815, 0x07da4015, 0x07da4815, 0x07da5015,
+    0x07da5815, 0x07da6015, 0x07da6815, 0x07da7015, 0x07da7815, 0x07da800d, 0x07da900d, 0x07dab00d,
+    0x07dad00d, 0x07daf00d, 0x07db100d, 0x07db300d, 0x07db500d, 0x07db700d, 0x07db900d, 0x07dbb00d,
+    0x07dbd00d, 0x07dbf00d, 0x07dc100d, 0x07dc200d, 0x07dc300d, 0x07dc400d, 0x07dc500d, 0x07dc600d,
+    0x07dc700d, 0x07dc900d, 0x07dcb00d, 0x07dcd00d, 0x07dcf00d, 0x07dd000d, 0x07dd200d, 0x07dd300d,
+    0x07dd500d, 0x07dd700d, 0x07dd800d, 0x07dd9007, 0x07de1801, 0x07de980d, 0x07deb80d, 0x07dec80d,
+    0x07ded80d, 0x07dee815, 0x07def00d, 0x07df000d, 0x07df100d, 0x07df200d, 0x07df400d, 0x07df5015,
+    0x07df6015, 0x07df7015, 0x07df8015, 0x07df9015, 0x07dfa015, 0x07dfb015, 0x07dfc815, 0x07dfe00d,
+    0x07e00015, 0x07e00815, 0x07e01015, 0x07e01815, 0x07e02015, 0x07e02815, 0x07e03015, 0x07e03815,
+    0x07e04015, 0x07e04815, 0x07e05015, 0x07e05815, 0x07e06015, 0x07e06815, 0x07e07015, 0x07e07815,
+    0x07e08015, 0x07e08815, 0x07e09015, 0x07e09815, 0x07e0a015, 0x07e0a815, 0x07e0b015, 0x07e0b815,
+    0x07e0c015, 0x07e0c815, 0x07e0d015, 0x07e0d815, 0x07e0e015, 0x07e0e815, 0x07e0f015, 0x07e0f815,
+    0x07e10015, 0x07e10815, 0x07e11015, 0x07e11815, 0x07e12015, 0x07e12815, 0x07e13015, 0x07e13815,
+    0x07e14015, 0x07e14815, 0x07e15015, 0x07e15815, 0x07e16015, 0x07e16815, 0x07e17015, 0x07e17815,
+    0x07e18015, 0x07e18815, 0x07e19015, 0x07e19815, 0x07e1a015, 0x07e1a815, 0x07e1b015, 0x07e1b815,
+    0x07e1c015, 0x07e1c815, 0x07e1d015, 0x07e1d815, 0x07e1e015, 0x07e1e815, 0x07e1f015, 0x07e1f815,
+    0x07e20015, 0x07e20815, 0x07e21015, 0x07e21815, 0x07e22015, 0x07e22815, 0x07e23015, 0x07e23815,
+    0x07e24015, 0x07e24815, 0x07e25015, 0x07e25815, 0x07e26015, 0x07e26815, 0x07e27015, 0x07e27815,
+    0x07e28015, 0x07e28815, 0x07e29015, 0x07e29815, 0x07e2a015, 0x07e2a815, 0x07e2b015, 0x07e2b815,
+    0x07e2c015, 0x07e2c815, 0x07e2d015, 0x07e2d815, 0x07e2e015, 0x07e2e815, 0x07e2f01b, 0x07e2f81b,
+    0x07e3001b, 0x07e3081b, 0x07e3101b, 0x07e3181b, 0x07e32015, 0x07e32815, 0x07e33015, 0x07e33815,
+    0x07e34015, 0x07e34815, 0x07e35015, 0x07e35815, 0x07e36015, 0x07e36815, 0x07e37015, 0x07e37815,
+    0x07e38015, 0x07e38815, 0x07e39015, 0x07e39815, 0x07e3a015, 0x07e3a815, 0x07e3b015, 0x07e3b815,
+    0x07e3c015, 0x07e3c815, 0x07e3d015, 0x07e3d815, 0x07e3e015, 0x07e3e815, 0x07e3f015, 0x07e3f815,
+    0x07e40015, 0x07e40815, 0x07e41015, 0x07e41815, 0x07e42015, 0x07e42815, 0x07e43015, 0x07e43815,
+    0x07e44015, 0x07e44815, 0x07e45015, 0x07e45815, 0x07e46015, 0x07e46815, 0x07e47015, 0x07e47815,
+    0x07e48015, 0x07e48815, 0x07e49015, 0x07e49815, 0x07e4a015, 0x07e4a815, 0x07e4b015, 0x07e4b815,
+    0x07e4c015, 0x07e4c815, 0x07e4d015, 0x07e4d815, 0x07e4e015, 0x07e4e815, 0x07e4f015, 0x07e4f815,
+    0x07e50015, 0x07e50815, 0x07e51015, 0x07e51815, 0x07e52015, 0x07e52815, 0x07e53015, 0x07e53815,
+    0x07e54015, 0x07e54815, 0x07e55015, 0x07e55815, 0x07e56015, 0x07e56815, 0x07e57015, 0x07e57815,
+    0x07e58015, 0x07e58815, 0x07e59015, 0x07e59815, 0x07e5a015, 0x07e5a815, 0x07e5b015, 0x07e5b815,
+    0x07e5c015, 0x07e5c815, 0x07e5d015, 0x07e5d815, 0x07e5e015, 0x07e5e815, 0x07e5f015, 0x07e5f815,
+    0x07e60015, 0x07e60815, 0x07e61015, 0x07e61815, 0x07e62015, 0x07e62815, 0x07e63015, 0x07e63815,
+    0x07e64015, 0x07e64815, 0x07e65015, 0x07e65815, 0x07e66015, 0x07e66815, 0x07e67015, 0x07e67815,
+    0x07e68015, 0x07e68815, 0x07e69015, 0x07e69815, 0x07e6a015, 0x07e6a815, 0x07e6b015, 0x07e6b815,
+    0x07e6c015, 0x07e6c815, 0x07e6d015, 0x07e6d815, 0x07e6e015, 0x07e6e815, 0x07e6f015, 0x07e6f815,
+    0x07e70015, 0x07e70815, 0x07e71015, 0x07e71815, 0x07e72015, 0x07e72815, 0x07e73015, 0x07e73815,
+    0x07e74015, 0x07e74815, 0x07e75015, 0x07e75815, 0x07e76015, 0x07e76815, 0x07e77015, 0x07e77815,
+    0x07e78015, 0x07e78815, 0x07e7901d, 0x07e7981d, 0x07e7a01d, 0x07e7a815, 0x07e7b015, 0x07e7b815,
+    0x07e7c015, 0x07e7c815, 0x07e7d015, 0x07e7d815, 0x07e7e015, 0x07e7e815, 0x07e7f015, 0x07e7f815,
+    0x07e80015, 0x07e80815, 0x07e81015, 0x07e81815, 0x07e82015, 0x07e82815, 0x07e83015, 0x07e83815,
+    0x07e84015, 0x07e84815, 0x07e85015, 0x07e85815, 0x07e86015, 0x07e86815, 0x07e87015, 0x07e87815,
+    0x07e88015, 0x07e88815, 0x07e89015, 0x07e89815, 0x07e8a015, 0x07e8a815, 0x07e8b015, 0x07e8b815,
+    0x07e8c015, 0x07e8c815, 0x07e8d015, 0x07e8d815, 0x07e8e015, 0x07e8e815, 0x07e8f015, 0x07e8f815,
+    0x07e90015, 0x07e90815, 0x07e91015, 0x07e91815, 0x07e92015, 0x07e92815, 0x07e93015, 0x07e93815,
+    0x07e94015, 0x07e94815, 0x07e95015, 0x07e95815, 0x07e96015, 0x07e96815, 0x07e97015, 0x07e97815,
+    0x07e98015, 0x07e98815, 0x07e99015, 0x07e99815, 0x07e9a015, 0x07e9a815, 0x07e9b015, 0x07e9b815,
+    0x07e9c015, 0x07e9c815, 0x07e9d015, 0x07e9d815, 0x07e9e015, 0x07e9f007, 0x07ea801d, 0x07ea881d,
+    0x07ea981d, 0x07eaa01d, 0x07eaa81d, 0x07eab01d, 0x07eab81d, 0x07eac01d, 0x07ead01d, 0x07ead81d,
+    0x07eae01d, 0x07eae81d, 0x07eaf01d, 0x07eaf81d, 0x07eb081d, 0x07eb101d, 0x07eb201d, 0x07eb301d,
+    0x07eb381d, 0x07eb481d, 0x07eb501d, 0x07eb601d, 0x07eb701d, 0x07eb781d, 0x07eb881d, 0x07eb981d,
+    0x07eba01d, 0x07eba81d, 0x07ebb01d, 0x07ebc01d, 0x07ebc81d, 0x07ebd01d, 0x07ebd81d, 0x07ebe01d,
+    0x07ebf01d, 0x07ebf81d, 0x07ec001d, 0x07ec081d, 0x07ec101d, 0x07ec181d, 0x07ec281d, 0x07ec381d,
+    0x07ec481d, 0x07ec501d, 0x07ec581d, 0x07ec601d, 0x07ec681d, 0x07ec701d, 0x07ec781d, 0x07ec8001,
+    0x07ec901d, 0x07ec981d, 0x07eca01d, 0x07eca81d, 0x07ecb01d, 0x07ecb81d, 0x07ecc81d, 0x07ecd01d,
+    0x07ecd81d, 0x07ece01d, 0x07ecf01d, 0x07ecf81d, 0x07ed001d, 0x07ed081d, 0x07ed101d, 0x07ed181d,
+    0x07ed201d, 0x07ed281d, 0x07ed301d, 0x07ed381d, 0x07ed401d, 0x07ed481d, 0x07ed501d, 0x07ed581d,
+    0x07ed601d, 0x07ed681d, 0x07ed701d, 0x07ed781d, 0x07ed801d, 0x07ed881d, 0x07ed901d, 0x07ed981d,
+    0x07eda01d, 0x07eda81d, 0x07edb01d, 0x07edb81d, 0x07edc01d, 0x07edc81d, 0x07edd01d, 0x07edd81d,
+    0x07ede01d, 0x07ede81d, 0x07edf01d, 0x07edf81d, 0x07ee001d, 0x07ee081d, 0x07ee101d, 0x07ee181d,
+    0x07ee201d, 0x07ee281d, 0x07ee301d, 0x07ee381d, 0x07ee4001, 0x07ee7807, 0x07ee8001, 0x07ef801d,
+    0x07ef881d, 0x07ef9025, 0x07ef9825, 0x07efa025, 0x07efa825, 0x07efb025, 0x07efb825, 0x07efc025,
+    0x07efc81d, 0x07efd093, 0x07efd843, 0x07efe025, 0x07efe807, 0x07f00004, 0x07f0800b, 0x07f0880d,
+    0x07f09001, 0x07f0980b, 0x07f0a00b, 0x07f0a80b, 0x07f0b00b, 0x07f0b80d, 0x07f0c00d, 0x07f0c801,
+    0x07f10007, 0x07f18001, 0x07f1880d, 0x07f1900d, 0x07f1980b, 0x07f1a80b, 0x07f1b00b, 0x07f1b80b,
+    0x07f1c00b, 0x07f1c80d, 0x07f1d00d, 0x07f1d80d, 0x07f1e00d, 0x07f1e80d, 0x07f1f00d, 0x07f1f80d,
+    0x07f2000d, 0x07f2080d, 0x07f2100d, 0x07f2180d, 0x07f2200d, 0x07f22807, 0x07f2380b, 0x07f2400b,
+    0x07f24813, 0x07f2680b, 0x07f2800b, 0x07f2880d, 0x07f29001, 0x07f2a00b, 0x07f2a80b, 0x07f2b00b,
+    0x07f2b80b, 0x07f2c00d, 0x07f2c80b, 0x07f2d00b, 0x07f2d80b, 0x07f2e00b, 0x07f2e80d, 0x07f2f00d,
+    0x07f2f80b, 0x07f3000b, 0x07f3080b, 0x07f3100b, 0x07f3180d, 0x07f3200b, 0x07f3280b, 0x07f3300b,
+    0x07f33801, 0x07f3400b, 0x07f3480b, 0x07f3500b, 0x07f3580b, 0x07f36001, 0x07f38013, 0x07f38815,
+    0x07f39013, 0x07f39807, 0x07f3a013, 0x07f3a801, 0x07f3b013, 0x07f3b815, 0x07f3c013, 0x07f3c815,
+    0x07f3d013, 0x07f3d815, 0x07f3e013, 0x07f3e815, 0x07f3f013, 0x07f3f815, 0x07f4000d, 0x07f4080d,
+    0x07f4180d, 0x07f4280d, 0x07f4380d, 0x07f4480d, 0x07f4680d, 0x07f4780d, 0x07f4980d, 0x07f4a80d,
+    0x07f4c80d, 0x07f4e80d, 0x07f5080d, 0x07f5280d, 0x07f5480d, 0x07f5580d, 0x07f5680d, 0x07f5780d,
+    0x07f5880d, 0x07f5a80d, 0x07f5c80d, 0x07f5e80d, 0x07f6080d, 0x07f6280d, 0x07f6480d, 0x07f6680d,
+    0x07f6880d, 0x07f6a80d, 0x07f6c80d, 0x07f6e80d, 0x07f7080d, 0x07f7280d, 0x07f7480d, 0x07f7680d,
+    0x07f7780d, 0x07f7880d, 0x07f7a815, 0x07f7b815, 0x07f7c815, 0x07f7d815, 0x07f7e801, 0x07f7f804,
+    0x07f80001, 0x07f8080b, 0x07f8100b, 0x07f8180b, 0x07f8200b, 0x07f8280b, 0x07f8300b, 0x07f8380b,
+    0x07f8400b, 0x07f8480b, 0x07f8500b, 0x07f8580b, 0x07f8600b, 0x07f8680d, 0x07f8700d, 0x07f8780b,
+    0x07f8800d, 0x07f8880d, 0x07f8900d, 0x07f8980d, 0x07f8a00d, 0x07f8a80d, 0x07f8b00d, 0x07f8b80d,
+    0x07f8c00d, 0x07f8c80d, 0x07f8d00b, 0x07f8d80b, 0x07f8e00b, 0x07f8e80b, 0x07f8f00b, 0x07f8f80b,
+    0x07f9000b, 0x07f9080d, 0x07f9100d, 0x07f9180d, 0x07f9200d, 0x07f9280d, 0x07f9300d, 0x07f9380d,
+    0x07f9400d, 0x07f9480d, 0x07f9500d, 0x07f9580d, 0x07f9600d, 0x07f9680d, 0x07f9700d, 0x07f9780d,
+    0x07f9800d, 0x07f9880d, 0x07f9900d, 0x07f9980d, 0x07f9a00d, 0x07f9a80d, 0x07f9b00d, 0x07f9b80d,
+    0x07f9c00d, 0x07f9c80d, 0x07f9d00d, 0x07f9d80b, 0x07f9e00b, 0x07f9e80b, 0x07f9f00b, 0x07f9f80b,
+    0x07fa000b, 0x07fa080d, 0x07fa100d, 0x07fa180d, 0x07fa200d, 0x07fa280d, 0x07fa300d, 0x07fa380d,
+    0x07fa400d, 0x07fa480d, 0x07fa500d, 0x07fa580d, 0x07fa600d, 0x07fa680d, 0x07fa700d, 0x07fa780d,
+    0x07fa800d, 0x07fa880d, 0x07fa900d, 0x07fa980d, 0x07faa00d, 0x07faa80d, 0x07fab00d, 0x07fab80d,
+    0x07fac00d, 0x07fac80d, 0x07fad00d, 0x07fad80b, 0x07fae00b, 0x07fae80b, 0x07faf00b, 0x07faf80d,
+    0x07fb000d, 0x07fb080d, 0x07fb100d, 0x07fb180d, 0x07fb200d, 0x07fb280d, 0x07fb300d, 0x07fb380d,
+    0x07fb400d, 0x07fb480d, 0x07fb500d, 0x07fb580d, 0x07fb600d, 0x07fb680d, 0x07fb700d, 0x07fb780d,
+    0x07fb800d, 0x07fb880d, 0x07fb900d, 0x07fb980d, 0x07fba00d, 0x07fba80d, 0x07fbb00d, 0x07fbb80d,
+    0x07fbc00d, 0x07fbc80d, 0x07fbd00d, 0x07fbd80d, 0x07fbe00d, 0x07fbe80d, 0x07fbf00d, 0x07fbf80d,
+    0x07fc000d, 0x07fc080d, 0x07fc100d, 0x07fc180d, 0x07fc200d, 0x07fc280d, 0x07fc300d, 0x07fc380d,
+    0x07fc400d, 0x07fc480d, 0x07fc500d, 0x07fc580d, 0x07fc600d, 0x07fc680d, 0x07fc700d, 0x07fc780d,
+    0x07fc800d, 0x07fc880d, 0x07fc900d, 0x07fc980d, 0x07fca00d, 0x07fca80d, 0x07fcb00d, 0x07fcb80d,
+    0x07fcc00d, 0x07fcc80d, 0x07fcd00d, 0x07fcd80d, 0x07fce00d, 0x07fce80d, 0x07fcf00d, 0x07fcf80d,
+    0x07fd0001, 0x07fd080d, 0x07fd100d, 0x07fd180d, 0x07fd200d, 0x07fd280d, 0x07fd300d, 0x07fd380d,
+    0x07fd400d, 0x07fd480d, 0x07fd500d, 0x07fd580d, 0x07fd600d, 0x07fd680d, 0x07fd700d, 0x07fd780d,
+    0x07fd800d, 0x07fd880d, 0x07fd900d, 0x07fd980d, 0x07fda00d, 0x07fda80d, 0x07fdb00d, 0x07fdb80d,
+    0x07fdc00d, 0x07fdc80d, 0x07fdd00d, 0x07fdd80d, 0x07fde00d, 0x07fde80d, 0x07fdf00d, 0x07fdf801,
+    0x07fe100d, 0x07fe180d, 0x07fe200d, 0x07fe280d, 0x07fe300d, 0x07fe380d, 0x07fe4001, 0x07fe500d,
+    0x07fe580d, 0x07fe600d, 0x07fe680d, 0x07fe700d, 0x07fe780d, 0x07fe8001, 0x07fe900d, 0x07fe980d,
+    0x07fea00d, 0x07fea80d, 0x07feb00d, 0x07feb80d, 0x07fec001, 0x07fed00d, 0x07fed80d, 0x07fee00d,
+    0x07fee801, 0x07ff000d, 0x07ff080d, 0x07ff100d, 0x07ff1813, 0x07ff200d, 0x07ff280d, 0x07ff300d,
+    0x07ff3801, 0x07ff400d, 0x07ff480d, 0x07ff500d, 0x07ff580d, 0x07ff600d, 0x07ff680d, 0x07ff700d,
+    0x07ff7801, 0x08000007, 0x08006001, 0x08006807, 0x08013801, 0x08014007, 0x0801d801, 0x0801e007,
+    0x0801f001, 0x0801f807, 0x08027001, 0x08028007, 0x0802f001, 0x08040007, 0x0807d801, 0x08080007,
+    0x08081801, 0x08083807, 0x0809a001, 0x0809b807, 0x080c7801, 0x080c8007, 0x080ce801, 0x080d0007,
+    0x080d0801, 0x080e8007, 0x080ff001, 0x08140007, 0x0814e801, 0x08150007, 0x08168801, 0x08170007,
+    0x0817e001, 0x08180007, 0x08192001, 0x08196807, 0x081a5801, 0x081a8007, 0x081bd801, 0x081c0007,
+    0x081cf001, 0x081cf807, 0x081e2001, 0x081e4007, 0x081eb001, 0x0820000d, 0x0820080d, 0x0820100d,
+    0x0820180d, 0x0820200d, 0x0820280d, 0x0820300d, 0x0820380d, 0x0820400d, 0x0820480d, 0x0820500d,
+    0x0820580d, 0x0820600d, 0x0820680d, 0x0820700d, 0x0820780d, 0x0820800d, 0x0820880d, 0x0820900d,
+    0x0820980d, 0x0820a00d, 0x0820a80d, 0x0820b00d, 0x0820b80d, 0x0820c00d, 0x0820c80d, 0x0820d00d,
+    0x0820d80d, 0x0820e00d, 0x0820e80d, 0x0820f00d, 0x0820f80d, 0x0821000d, 0x0821080d, 0x0821100d,
+    0x0821180d, 0x0821200d, 0x0821280d, 0x0821300d, 0x0821380d, 0x08214007, 0x0824f001, 0x08250007,
+    0x08255001, 0x0825800d, 0x0825880d, 0x0825900d, 0x0825980d, 0x0825a00d, 0x0825a80d, 0x0825b00d,
+    0x0825b80d, 0x0825c00d, 0x0825c80d, 0x0825d00d, 0x0825d80d, 0x0825e00d, 0x0825e80d, 0x0825f00d,
+    0x0825f80d, 0x0826000d, 0x0826080d, 0x0826100d, 0x0826180d, 0x0826200d, 0x0826280d, 0x0826300d,
+    0x0826380d, 0x0826400d, 0x0826480d, 0x0826500d, 0x0826580d, 0x0826600d, 0x0826680d, 0x0826700d,
+    0x0826780d, 0x0826800d, 0x0826880d, 0x0826900d, 0x0826980d, 0x0826a001, 0x0826c007, 0x0827e001,
+    0x08280007, 0x08294001, 0x08298007, 0x082b2001, 0x082b7807, 0x082b800d, 0x082b880d, 0x082b900d,
+    0x082b980d, 0x082ba00d, 0x082ba80d, 0x082bb00d, 0x082bb80d, 0x082bc00d, 0x082bc80d, 0x082bd00d,
+    0x082bd801, 0x082be00d, 0x082be80d, 0x082bf00d, 0x082bf80d, 0x082c000d, 0x082c080d, 0x082c100d,
+    0x082c180d, 0x082c200d, 0x082c280d, 0x082c300d, 0x082c380d, 0x082c400d, 0x082c480d, 0x082c500d,
+    0x082c5801, 0x082c600d, 0x082c680d, 0x082c700d, 0x082c780d, 0x082c800d, 0x082c880d, 0x082c900d,
+    0x082c9801, 0x082ca00d, 0x082ca80d, 0x082cb001, 0x082cb807, 0x082d1001, 0x082d1807, 0x082d9001,
+    0x082d9807, 0x082dd001, 0x082dd807, 0x082de801, 0x08300007, 0x0839b801, 0x083a0007, 0x083ab001,
+    0x083b0007, 0x083b4001, 0x083c0007, 0x083c080d, 0x083c100d, 0x083c180d, 0x083c200d, 0x083c280d,
+    0x083c3001, 0x083c380d, 0x083c400d, 0x083c480d, 0x083c500d, 0x083c580d, 0x083c600d, 0x083c680d,
+    0x083c700d, 0x083c780d, 0x083c800d, 0x083c880d, 0x083c900d, 0x083c980d, 0x083ca00d, 0x083ca80d,
+    0x083cb00d, 0x083cb80d, 0x083cc00d, 0x083cc80d, 0x083cd00d, 0x083cd80d, 0x083ce00d, 0x083ce80d,
+    0x083cf00d, 0x083cf80d, 0x083d000d, 0x083d080d, 0x083d100d, 0x083d180d, 0x083d200d, 0x083d280d,
+    0x083d300d, 0x083d380d, 0x083d400d, 0x083d480d, 0x083d500d, 0x083d580d, 0x083d600d, 0x083d680d,
+    0x083d700d, 0x083d780d, 0x083d800d, 0x083d8801, 0x083d900d, 0x083d980d, 0x083da00d, 0x083da80d,
+    0x083db00d, 0x083db80d, 0x083dc00d, 0x083dc80d, 0x083dd00d, 0x083dd801, 0x08400007, 0x08403001,
+    0x08404007, 0x08404801, 0x08405007, 0x0841b001, 0x0841b807, 0x0841c801, 0x0841e007, 0x0841e801,
+    0x0841f807, 0x0842b001, 0x0842b807, 0x0844f801, 0x08453807, 0x08458001, 0x08470007, 0x08479801,
+    0x0847a007, 0x0847b001, 0x0847d807, 0x0848e001, 0x0848f807, 0x0849d001, 0x0849f807, 0x084a0001,
+    0x084c0007, 0x084dc001, 0x084de007, 0x084e8001, 0x084e9007, 0x08502001, 0x08502807, 0x08503801,
+    0x08506007, 0x0850a001, 0x0850a807, 0x0850c001, 0x0850c807, 0x0851b001, 0x0851c007, 0x0851d801,
+    0x0851f807, 0x08524801, 0x08528007, 0x0852c801, 0x08530007, 0x08550001, 0x08560007, 0x08573801,
+    0x08575807, 0x0857b801, 0x08580007, 0x0859b001, 0x0859c807, 0x085ab001, 0x085ac007, 0x085b9801,
+    0x085bc007, 0x085c9001, 0x085cc807, 0x085ce801, 0x085d4807, 0x085d8001, 0x08600007, 0x08624801,
+    0x0864000d, 0x0864080d, 0x0864100d, 0x0864180d, 0x0864200d, 0x0864280d, 0x0864300d, 0x0864380d,
+    0x0864400d, 0x0864480d, 0x0864500d, 0x0864580d, 0x0864600d, 0x0864680d, 0x0864700d, 0x0864780d,
+    0x0864800d, 0x0864880d, 0x0864900d, 0x0864980d, 0x0864a00d, 0x0864a80d, 0x0864b00d, 0x0864b80d,
+    0x0864c00d, 0x0864c80d, 0x0864d00d, 0x0864d80d, 0x0864e00d, 0x0864e80d, 0x0864f00d, 0x0864f80d,
+    0x0865000d, 0x0865080d, 0x0865100d, 0x0865180d, 0x0865200d, 0x0865280d, 0x0865300d, 0x0865380d,
+    0x0865400d, 0x0865480d, 0x0865500d, 0x0865580d, 0x0865600d, 0x0865680d, 0x0865700d, 0x0865780d,
+    0x0865800d, 0x0865880d, 0x0865900d, 0x08659801, 0x08660007, 0x08679801, 0x0867d007, 0x08694001,
+    0x08698007, 0x0869d001, 0x08730007, 0x0873f801, 0x08740007, 0x08755001, 0x08755807, 0x08757001,
+    0x08758007, 0x08759001, 0x0877e807, 0x08794001, 0x08798007, 0x087ad001, 0x087b8007, 0x087c5001,
+    0x087d8007, 0x087e6001, 0x087f0007, 0x087fb801, 0x08800007, 0x08827001, 0x08829007, 0x0883b001,
+    0x0883f807, 0x0885e801, 0x0885f007, 0x08861801, 0x08868007, 0x08874801, 0x08878007, 0x0887d001,
+    0x08880007, 0x0889a801, 0x0889b007, 0x088a4001, 0x088a8007, 0x088bb801, 0x088c0007, 0x088f0001,
+    0x088f0807, 0x088fa801, 0x08900007, 0x08909001, 0x08909807, 0x08921001, 0x08940007, 0x08943801,
+    0x08944007, 0x08944801, 0x08945007, 0x08947001, 0x08947807, 0x0894f001, 0x0894f807, 0x08955001,
+    0x08958007, 0x08975801, 0x08978007, 0x0897d001, 0x08980007, 0x08982001, 0x08982807, 0x08986801,
+    0x08987807, 0x08988801, 0x08989807, 0x08994801, 0x08995007, 0x08998801, 0x08999007, 0x0899a001,
+    0x0899a807, 0x0899d001, 0x0899d807, 0x089a2801, 0x089a3807, 0x089a4801, 0x089a5807, 0x089a7001,
+    0x089a8007, 0x089a8801, 0x089ab807, 0x089ac001, 0x089ae807, 0x089b2001, 0x089b3007, 0x089b6801,
+    0x089b8007, 0x089ba801, 0x08a00007, 0x08a2e001, 0x08a2e807, 0x08a31001, 0x08a40007, 0x08a64001,
+    0x08a68007, 0x08a6d001, 0x08ac0007, 0x08adb001, 0x08adc007, 0x08aef001, 0x08b00007, 0x08b22801,
+    0x08b28007, 0x08b2d001, 0x08b30007, 0x08b36801, 0x08b40007, 0x08b5d001, 0x08b60007, 0x08b65001,
+    0x08b80007, 0x08b8d801, 0x08b8e807, 0x08b96001, 0x08b98007, 0x08ba3801, 0x08c00007, 0x08c1e001,
+    0x08c5000d, 0x08c5080d, 0x08c5100d, 0x08c5180d, 0x08c5200d, 0x08c5280d, 0x08c5300d, 0x08c5380d,
+    0x08c5400d, 0x08c5480d, 0x08c5500d, 0x08c5580d, 0x08c5600d, 0x08c5680d, 0x08c5700d, 0x08c5780d,
+    0x08c5800d, 0x08c5880d, 0x08c5900d, 0x08c5980d, 0x08c5a00d, 0x08c5a80d, 0x08c5b00d, 0x08c5b80d,
+    0x08c5c00d, 0x08c5c80d, 0x08c5d00d, 0x08c5d80d, 0x08c5e00d, 0x08c5e80d, 0x08c5f00d, 0x08c5f80d,
+    0x08c60007, 0x08c79801, 0x08c7f807, 0x08c83801, 0x08c84807, 0x08c85001, 0x08c86007, 0x08c8a001,
+    0x08c8a807, 0x08c8b801, 0x08c8c007, 0x08c9b001, 0x08c9b807, 0x08c9c801, 0x08c9d807, 0x08ca3801,
+    0x08ca8007, 0x08cad001, 0x08cd0007, 0x08cd4001, 0x08cd5007, 0x08cec001, 0x08ced007, 0x08cf2801,
+    0x08d00007, 0x08d24001, 0x08d28007, 0x08d51801, 0x08d58007, 0x08d7c801, 0x08d80007, 0x08d85001,
+    0x08e00007, 0x08e04801, 0x08e05007, 0x08e1b801, 0x08e1c007, 0x08e23001, 0x08e28007, 0x08e36801,
+    0x08e38007, 0x08e48001, 0x08e49007, 0x08e54001, 0x08e54807, 0x08e5b801, 0x08e80007, 0x08e83801,
+    0x08e84007, 0x08e85001, 0x08e85807, 0x08e9b801, 0x08e9d007, 0x08e9d801, 0x08e9e007, 0x08e9f001,
+    0x08e9f807, 0x08ea4001, 0x08ea8007, 0x08ead001, 0x08eb0007, 0x08eb3001, 0x08eb3807, 0x08eb4801,
+    0x08eb5007, 0x08ec7801, 0x08ec8007, 0x08ec9001, 0x08ec9807, 0x08ecc801, 0x08ed0007, 0x08ed5001,
+    0x08f70007, 0x08f7c801, 0x08f80007, 0x08f88801, 0x08f89007, 0x08f9d801, 0x08f9f007, 0x08fad001,
+    0x08fd8007, 0x08fd8801, 0x08fe0007, 0x08ff9001, 0x08fff807, 0x091cd001, 0x09200007, 0x09237801,
+    0x09238007, 0x0923a801, 0x09240007, 0x092a2001, 0x097c8007, 0x097f9801, 0x09800007, 0x09a18001,
+    0x09a20007, 0x09a2b001, 0x0a200007, 0x0a323801, 0x0b400007, 0x0b51c801, 0x0b520007, 0x0b52f801,
+    0x0b530007, 0x0b535001, 0x0b537007, 0x0b55f801, 0x0b560007, 0x0b565001, 0x0b568007, 0x0b577001,
+    0x0b578007, 0x0b57b001, 0x0b580007, 0x0b5a3001, 0x0b5a8007, 0x0b5ad001, 0x0b5ad807, 0x0b5b1001,
+    0x0b5b1807, 0x0b5bc001, 0x0b5be807, 0x0b5c8001, 0x0b72000d, 0x0b72080d, 0x0b72100d, 0x0b72180d,
+    0x0b72200d, 0x0b72280d, 0x0b72300d, 0x0b72380d, 0x0b72400d, 0x0b72480d, 0x0b72500d, 0x0b72580d,
+    0x0b72600d, 0x0b72680d, 0x0b72700d, 0x0b72780d, 0x0b72800d, 0x0b72880d, 0x0b72900d, 0x0b72980d,
+    0x0b72a00d, 0x0b72a80d, 0x0b72b00d, 0x0b72b80d, 0x0b72c00d, 0x0b72c80d, 0x0b72d00d, 0x0b72d80d,
+    0x0b72e00d, 0x0b72e80d, 0x0b72f00d, 0x0b72f80d, 0x0b730007, 0x0b74d801, 0x0b780007, 0x0b7a5801,
+    0x0b7a7807, 0x0b7c4001, 0x0b7c7807, 0x0b7d0001, 0x0b7f0007, 0x0b7f2801, 0x0b7f8007, 0x0b7f9001,
+    0x0b800007, 0x0c3fc001, 0x0c400007, 0x0c66b001, 0x0c680007, 0x0c684801, 0x0d7f8007, 0x0d7fa001,
+    0x0d7fa807, 0x0d7fe001, 0x0d7fe807, 0x0d7ff801, 0x0d800007, 0x0d891801, 0x0d899007, 0x0d899801,
+    0x0d8a8007, 0x0d8a9801, 0x0d8aa807, 0x0d8ab001, 0x0d8b2007, 0x0d8b4001, 0x0d8b8007, 0x0d97e001,
+    0x0de00007, 0x0de35801, 0x0de38007, 0x0de3e801, 0x0de40007, 0x0de44801, 0x0de48007, 0x0de4d001,
+    0x0de4e007, 0x0de50004, 0x0de52001, 0x0e780007, 0x0e797001, 0x0e798007, 0x0e7a3801, 0x0e7a8007,
+    0x0e7e2001, 0x0e800007, 0x0e87b001, 0x0e880007, 0x0e893801, 0x0e894807, 0x0e8af015, 0x0e8af815,
+    0x0e8b001d, 0x0e8b081d, 0x0e8b101d, 0x0e8b181d, 0x0e8b201d, 0x0e8b2807, 0x0e8b9801, 0x0e8bd807,
+    0x0e8dd815, 0x0e8de015, 0x0e8de81d, 0x0e8df01d, 0x0e8df81d, 0x0e8e001d, 0x0e8e0807, 0x0e8f5801,
+    0x0e900007, 0x0e923001, 0x0e960007, 0x0e96a001, 0x0e970007, 0x0e97a001, 0x0e980007, 0x0e9ab801,
+    0x0e9b0007, 0x0e9bc801, 0x0ea0000d, 0x0ea0080d, 0x0ea0100d, 0x0ea0180d, 0x0ea0200d, 0x0ea0280d,
+    0x0ea0300d, 0x0ea0380d, 0x0ea0400d, 0x0ea0480d, 0x0ea0500d, 0x0ea0580d, 0x0ea0600d, 0x0ea0680d,
+    0x0ea0700d, 0x0ea0780d, 0x0ea0800d, 0x0ea0880d, 0x0ea0900d, 0x0ea0980d, 0x0ea0a00d, 0x0ea0a80d,
+    0x0ea0b00d, 0x0ea0b80d, 0x0ea0c00d, 0x0ea0c80d, 0x0ea0d00d, 0x0ea0d80d, 0x0ea0e00d, 0x0ea0e80d,
+    0x0ea0f00d, 0x0ea0f80d, 0x0ea1000d, 0x0ea1080d, 0x0ea1100d, 0x0ea1180d, 0x0ea1200d, 0x0ea1280d,
+    0x0ea1300d, 0x0ea1380d, 0x0ea1400d, 0x0ea1480d, 0x0ea1500d, 0x0ea1580d, 0x0ea1600d, 0x0ea1680d,
+    0x0ea1700d, 0x0ea1780d, 0x0ea1800d, 0x0ea1880d, 0x0ea1900d, 0x0ea1980d, 0x0ea1a00d, 0x0ea1a80d,
+    0x0ea1b00d, 0x0ea1b80d, 0x0ea1c00d, 0x0ea1c80d, 0x0ea1d00d, 0x0ea1d80d, 0x0ea1e00d, 0x0ea1e80d,
+    0x0ea1f00d, 0x0ea1f80d, 0x0ea2000d, 0x0ea2080d, 0x0ea2100d, 0x0ea2180d, 0x0ea2200d, 0x0ea2280d,
+    0x0ea2300d, 0x0ea2380d, 0x0ea2400d, 0x0ea2480d, 0x0ea2500d, 0x0ea2580d, 0x0ea2600d, 0x0ea2680d,
+    0x0ea2700d, 0x0ea2780d, 0x0ea2800d, 0x0ea2880d, 0x0ea2900d, 0x0ea2980d, 0x0ea2a00d, 0x0ea2a801,
+    0x0ea2b00d, 0x0ea2b80d, 0x0ea2c00d, 0x0ea2c80d, 0x0ea2d00d, 0x0ea2d80d, 0x0ea2e00d, 0x0ea2e80d,
+    0x0ea2f00d, 0x0ea2f80d, 0x0ea3000d, 0x0ea3080d, 0x0ea3100d, 0x0ea3180d, 0x0ea3200d, 0x0ea3280d,
+    0x0ea3300d, 0x0ea3380d, 0x0ea3400d, 0x0ea3480d, 0x0ea3500d, 0x0ea3580d, 0x0ea3600d, 0x0ea3680d,
+    0x0ea3700d, 0x0ea3780d, 0x0ea3800d, 0x0ea3880d, 0x0ea3900d, 0x0ea3980d, 0x0ea3a00d, 0x0ea3a80d,
+    0x0ea3b00d, 0x0ea3b80d, 0x0ea3c00d, 0x0ea3c80d, 0x0ea3d00d, 0x0ea3d80d, 0x0ea3e00d, 0x0ea3e80d,
+    0x0ea3f00d, 0x0ea3f80d, 0x0ea4000d, 0x0ea4080d, 0x0ea4100d, 0x0ea4180d, 0x0ea4200d, 0x0ea4280d,
+    0x0ea4300d, 0x0ea4380d, 0x0ea4400d, 0x0ea4480d, 0x0ea4500d, 0x0ea4580d, 0x0ea4600d, 0x0ea4680d,
+    0x0ea4700d, 0x0ea4780d, 0x0ea4800d, 0x0ea4880d, 0x0ea4900d, 0x0ea4980d, 0x0ea4a00d, 0x0ea4a80d,
+    0x0ea4b00d, 0x0ea4b80d, 0x0ea4c00d, 0x0ea4c80d, 0x0ea4d00d, 0x0ea4d80d, 0x0ea4e00d, 0x0ea4e801,
+    0x0ea4f00d, 0x0ea4f80d, 0x0ea50001, 0x0ea5100d, 0x0ea51801, 0x0ea5280d, 0x0ea5300d, 0x0ea53801,
+    0x0ea5480d, 0x0ea5500d, 0x0ea5580d, 0x0ea5600d, 0x0ea56801, 0x0ea5700d, 0x0ea5780d, 0x0ea5800d,
+    0x0ea5880d, 0x0ea5900d, 0x0ea5980d, 0x0ea5a00d, 0x0ea5a80d, 0x0ea5b00d, 0x0ea5b80d, 0x0ea5c00d,
+    0x0ea5c80d, 0x0ea5d001, 0x0ea5d80d, 0x0ea5e001, 0x0ea5e80d, 0x0ea5f00d, 0x0ea5f80d, 0x0ea6000d,
+    0x0ea6080d, 0x0ea6100d, 0x0ea6180d, 0x0ea62001, 0x0ea6280d, 0x0ea6300d, 0x0ea6380d, 0x0ea6400d,
+    0x0ea6480d, 0x0ea6500d, 0x0ea6580d, 0x0ea6600d, 0x0ea6680d, 0x0ea6700d, 0x0ea6780d, 0x0ea6800d,
+    0x0ea6880d, 0x0ea6900d, 0x0ea6980d, 0x0ea6a00d, 0x0ea6a80d, 0x0ea6b00d, 0x0ea6b80d, 0x0ea6c00d,
+    0x0ea6c80d, 0x0ea6d00d, 0x0ea6d80d, 0x0ea6e00d, 0x0ea6e80d, 0x0ea6f00d, 0x0ea6f80d, 0x0ea7000d,
+    0x0ea7080d, 0x0ea7100d, 0x0ea7180d, 0x0ea7200d, 0x0ea7280d, 0x0ea7300d, 0x0ea7380d, 0x0ea7400d,
+    0x0ea7480d, 0x0ea7500d, 0x0ea7580d, 0x0ea7600d, 0x0ea7680d, 0x0ea7700d, 0x0ea7780d, 0x0ea7800d,
+    0x0ea7880d, 0x0ea7900d, 0x0ea7980d, 0x0ea7a00d, 0x0ea7a80d, 0x0ea7b00d, 0x0ea7b80d, 0x0ea7c00d,
+    0x0ea7c80d, 0x0ea7d00d, 0x0ea7d80d, 0x0ea7e00d, 0x0ea7e80d, 0x0ea7f00d, 0x0ea7f80d, 0x0ea8000d,
+    0x0ea8080d, 0x0ea8100d, 0x0ea8180d, 0x0ea8200d, 0x0ea8280d, 0x0ea83001, 0x0ea8380d, 0x0ea8400d,
+    0x0ea8480d, 0x0ea8500d, 0x0ea85801, 0x0ea8680d, 0x0ea8700d, 0x0ea8780d, 0x0ea8800d, 0x0ea8880d,
+    0x0ea8900d, 0x0ea8980d, 0x0ea8a00d, 0x0ea8a801, 0x0ea8b00d, 0x0ea8b80d, 0x0ea8c00d, 0x0ea8c80d,
+    0x0ea8d00d, 0x0ea8d80d, 0x0ea8e00d, 0x0ea8e801, 0x0ea8f00d, 0x0ea8f80d, 0x0ea9000d, 0x0ea9080d,
+    0x0ea9100d, 0x0ea9180d, 0x0ea9200d, 0x0ea9280d, 0x0ea9300d, 0x0ea9380d, 0x0ea9400d, 0x0ea9480d,
+    0x0ea9500d, 0x0ea9580d, 0x0ea9600d, 0x0ea9680d, 0x0ea9700d, 0x0ea9780d, 0x0ea9800d, 0x0ea9880d,
+    0x0ea9900d, 0x0ea9980d, 0x0ea9a00d, 0x0ea9a80d, 0x0ea9b00d, 0x0ea9b80d, 0x0ea9c00d, 0x0ea9c80d,
+    0x0ea9d001, 0x0ea9d80d, 0x0ea9e00d, 0x0ea9e80d, 0x0ea9f00d, 0x0ea9f801, 0x0eaa000d, 0x0eaa080d,
+    0x0eaa100d, 0x0eaa180d, 0x0eaa200d, 0x0eaa2801, 0x0eaa300d, 0x0eaa3801, 0x0eaa500d, 0x0eaa580d,
+    0x0eaa600d, 0x0eaa680d, 0x0eaa700d, 0x0eaa780d, 0x0eaa800d, 0x0eaa8801, 0x0eaa900d, 0x0eaa980d,
+    0x0eaaa00d, 0x0eaaa80d, 0x0eaab00d, 0x0eaab80d, 0x0eaac00d, 0x0eaac80d, 0x0eaad00d, 0x0eaad80d,
+    0x0eaae00d, 0x0eaae80d, 0x0eaaf00d, 0x0eaaf80d, 0x0eab000d, 0x0eab080d, 0x0eab100d, 0x0eab180d,
+    0x0eab200d, 0x0eab280d, 0x0eab300d, 0x0eab380d, 0x0eab400d, 0x0eab480d, 0x0eab500d, 0x0eab580d,
+    0x0eab600d, 0x0eab680d, 0x0eab700d, 0x0eab780d, 0x0eab800d, 0x0eab880d, 0x0eab900d, 0x0eab980d,
+    0x0eaba00d, 0x0eaba80d, 0x0eabb00d, 0x0eabb80d, 0x0eabc00d, 0x0eabc80d, 0x0eabd00d, 0x0eabd80d,
+    0x0eabe00d, 0x0eabe80d, 0x0eabf00d, 0x0eabf80d, 0x0eac000d, 0x0eac080d, 0x0eac100d, 0x0eac180d,
+    0x0eac200d, 0x0eac280d, 0x0eac300d, 0x0eac380d, 0x0eac400d, 0x0eac480d, 0x0eac500d, 0x0eac580d,
+    0x0eac600d, 0x0eac680d, 0x0eac700d, 0x0eac780d, 0x0eac800d, 0x0eac880d, 0x0eac900d, 0x0eac980d,
+    0x0eaca00d, 0x0eaca80d, 0x0eacb00d, 0x0eacb80d, 0x0eacc00d, 0x0eacc80d, 0x0eacd00d, 0x0eacd80d,
+    0x0eace00d, 0x0eace80d, 0x0eacf00d, 0x0eacf80d, 0x0ead000d, 0x0ead080d, 0x0ead100d, 0x0ead180d,
+    0x0ead200d, 0x0ead280d, 0x0ead300d, 0x0ead380d, 0x0ead400d, 0x0ead480d, 0x0ead500d, 0x0ead580d,
+    0x0ead600d, 0x0ead680d, 0x0ead700d, 0x0ead780d, 0x0ead800d, 0x0ead880d, 0x0ead900d, 0x0ead980d,
+    0x0eada00d, 0x0eada80d, 0x0eadb00d, 0x0eadb80d, 0x0eadc00d, 0x0eadc80d, 0x0eadd00d, 0x0eadd80d,
+    0x0eade00d, 0x0eade80d, 0x0eadf00d, 0x0eadf80d, 0x0eae000d, 0x0eae080d, 0x0eae100d, 0x0eae180d,
+    0x0eae200d, 0x0eae280d, 0x0eae300d, 0x0eae380d, 0x0eae400d, 0x0eae480d, 0x0eae500d, 0x0eae580d,
+    0x0eae600d, 0x0eae680d, 0x0eae700d, 0x0eae780d, 0x0eae800d, 0x0eae880d, 0x0eae900d, 0x0eae980d,
+    0x0eaea00d, 0x0eaea80d, 0x0eaeb00d, 0x0eaeb80d, 0x0eaec00d, 0x0eaec80d, 0x0eaed00d, 0x0eaed80d,
+    0x0eaee00d, 0x0eaee80d, 0x0eaef00d, 0x0eaef80d, 0x0eaf000d, 0x0eaf080d, 0x0eaf100d, 0x0eaf180d,
+    0x0eaf200d, 0x0eaf280d, 0x0eaf300d, 0x0eaf380d, 0x0eaf400d, 0x0eaf480d, 0x0eaf500d, 0x0eaf580d,
+    0x0eaf600d, 0x0eaf680d, 0x0eaf700d, 0x0eaf780d, 0x0eaf800d, 0x0eaf880d, 0x0eaf900d, 0x0eaf980d,
+    0x0eafa00d, 0x0eafa80d, 0x0eafb00d, 0x0eafb80d, 0x0eafc00d, 0x0eafc80d, 0x0eafd00d, 0x0eafd80d,
+    0x0eafe00d, 0x0eafe80d, 0x0eaff00d, 0x0eaff80d, 0x0eb0000d, 0x0eb0080d, 0x0eb0100d, 0x0eb0180d,
+    0x0eb0200d, 0x0eb0280d, 0x0eb0300d, 0x0eb0380d, 0x0eb0400d, 0x0eb0480d, 0x0eb0500d, 0x0eb0580d,
+    0x0eb0600d, 0x0eb0680d, 0x0eb0700d, 0x0eb0780d, 0x0eb0800d, 0x0eb0880d, 0x0eb0900d, 0x0eb0980d,
+    0x0eb0a00d, 0x0eb0a80d, 0x0eb0b00d, 0x0eb0b80d, 0x0eb0c00d, 0x0eb0c80d, 0x0eb0d00d, 0x0eb0d80d,
+    0x0eb0e00d, 0x0eb0e80d, 0x0eb0f00d, 0x0eb0f80d, 0x0eb1000d, 0x0eb1080d, 0x0eb1100d, 0x0eb1180d,
+    0x0eb1200d, 0x0eb1280d, 0x0eb1300d, 0x0eb1380d, 0x0eb1400d, 0x0eb1480d, 0x0eb1500d, 0x0eb1580d,
+    0x0eb1600d, 0x0eb1680d, 0x0eb1700d, 0x0eb1780d, 0x0eb1800d, 0x0eb1880d, 0x0eb1900d, 0x0eb1980d,
+    0x0eb1a00d, 0x0eb1a80d, 0x0eb1b00d, 0x0eb1b80d, 0x0eb1c00d, 0x0eb1c80d, 0x0eb1d00d, 0x0eb1d80d,
+    0x0eb1e00d, 0x0eb1e80d, 0x0eb1f00d, 0x0eb1f80d, 0x0eb2000d, 0x0eb2080d, 0x0eb2100d, 0x0eb2180d,
+    0x0eb2200d, 0x0eb2280d, 0x0eb2300d, 0x0eb2380d, 0x0eb2400d, 0x0eb2480d, 0x0eb2500d, 0x0eb2580d,
+    0x0eb2600d, 0x0eb2680d, 0x0eb2700d, 0x0eb2780d, 0x0eb2800d, 0x0eb2880d, 0x0eb2900d, 0x0eb2980d,
+    0x0eb2a00d, 0x0eb2a80d, 0x0eb2b00d, 0x0eb2b80d, 0x0eb2c00d, 0x0eb2c80d, 0x0eb2d00d, 0x0eb2d80d,
+    0x0eb2e00d, 0x0eb2e80d, 0x0eb2f00d, 0x0eb2f80d, 0x0eb3000d, 0x0eb3080d, 0x0eb3100d, 0x0eb3180d,
+    0x0eb3200d, 0x0eb3280d, 0x0eb3300d, 0x0eb3380d, 0x0eb3400d, 0x0eb3480d, 0x0eb3500d, 0x0eb3580d,
+    0x0eb3600d, 0x0eb3680d, 0x0eb3700d, 0x0eb3780d, 0x0eb3800d, 0x0eb3880d, 0x0eb3900d, 0x0eb3980d,
+    0x0eb3a00d, 0x0eb3a80d, 0x0eb3b00d, 0x0eb3b80d, 0x0eb3c00d, 0x0eb3c80d, 0x0eb3d00d, 0x0eb3d80d,
+    0x0eb3e00d, 0x0eb3e80d, 0x0eb3f00d, 0x0eb3f80d, 0x0eb4000d, 0x0eb4080d, 0x0eb4100d, 0x0eb4180d,
+    0x0eb4200d, 0x0eb4280d, 0x0eb4300d, 0x0eb4380d, 0x0eb4400d, 0x0eb4480d, 0x0eb4500d, 0x0eb4580d,
+    0x0eb4600d, 0x0eb4680d, 0x0eb4700d, 0x0eb4780d, 0x0eb4800d, 0x0eb4880d, 0x0eb4900d, 0x0eb4980d,
+    0x0eb4a00d, 0x0eb4a80d, 0x0eb4b00d, 0x0eb4b80d, 0x0eb4c00d, 0x0eb4c80d, 0x0eb4d00d, 0x0eb4d80d,
+    0x0eb4e00d, 0x0eb4e80d, 0x0eb4f00d, 0x0eb4f80d, 0x0eb5000d, 0x0eb5080d, 0x0eb5100d, 0x0eb5180d,
+    0x0eb5200d, 0x0eb5280d, 0x0eb53001, 0x0eb5400d, 0x0eb5480d, 0x0eb5500d, 0x0eb5580d, 0x0eb5600d,
+    0x0eb5680d, 0x0eb5700d, 0x0eb5780d, 0x0eb5800d, 0x0eb5880d, 0x0eb5900d, 0x0eb5980d, 0x0eb5a00d,
+    0x0eb5a80d, 0x0eb5b00d, 0x0eb5b80d, 0x0eb5c00d, 0x0eb5c80d, 0x0eb5d00d, 0x0eb5d80d, 0x0eb5e00d,
+    0x0eb5e80d, 0x0eb5f00d, 0x0eb5f80d, 0x0eb6000d, 0x0eb6080d, 0x0eb6100d, 0x0eb6180d, 0x0eb6200d,
+    0x0eb6280d, 0x0eb6300d, 0x0eb6380d, 0x0eb6400d, 0x0eb6480d, 0x0eb6500d, 0x0eb6580d, 0x0eb6600d,
+    0x0eb6680d, 0x0eb6700d, 0x0eb6780d, 0x0eb6800d, 0x0eb6880d, 0x0eb6900d, 0x0eb6980d, 0x0eb6a80d,
+    0x0eb6b00d, 0x0eb6b80d, 0x0eb6c00d, 0x0eb6c80d, 0x0eb6d00d, 0x0eb6d80d, 0x0eb6e00d, 0x0eb6e80d,
+    0x0eb6f00d, 0x0eb6f80d, 0x0eb7000d, 0x0eb7080d, 0x0eb7100d, 0x0eb7180d, 0x0eb7200d, 0x0eb7280d,
+    0x0eb7300d, 0x0eb7380d, 0x0eb7400d, 0x0eb7480d, 0x0eb7500d, 0x0eb7580d, 0x0eb7600d, 0x0eb7680d,
+    0x0eb7700d, 0x0eb7780d, 0x0eb7800d, 0x0eb7880d, 0x0eb7900d, 0x0eb7980d, 0x0eb7a00d, 0x0eb7a80d,
+    0x0eb7b00d, 0x0eb7b80d, 0x0eb7c00d, 0x0eb7c80d, 0x0eb7d00d, 0x0eb7d80d, 0x0eb7e00d, 0x0eb7e80d,
+    0x0eb7f00d, 0x0eb7f80d, 0x0eb8000d, 0x0eb8080d, 0x0eb8100d, 0x0eb8180d, 0x0eb8200d, 0x0eb8280d,
+    0x0eb8300d, 0x0eb8380d, 0x0eb8400d, 0x0eb8480d, 0x0eb8500d, 0x0eb8580d, 0x0eb8600d, 0x0eb8680d,
+    0x0eb8780d, 0x0eb8800d, 0x0eb8880d, 0x0eb8900d, 0x0eb8980d, 0x0eb8a00d, 0x0eb8a80d, 0x0eb8b00d,
+    0x0eb8b80d, 0x0eb8c00d, 0x0eb8c80d, 0x0eb8d00d, 0x0eb8d80d, 0x0eb8e00d, 0x0eb8e80d, 0x0eb8f00d,
+    0x0eb8f80d, 0x0eb9000d, 0x0eb9080d, 0x0eb9100d, 0x0eb9180d, 0x0eb9200d, 0x0eb9280d, 0x0eb9300d,
+    0x0eb9380d, 0x0eb9400d, 0x0eb9480d, 0x0eb9500d, 0x0eb9580d, 0x0eb9600d, 0x0eb9680d, 0x0eb9700d,
+    0x0eb9780d, 0x0eb9800d, 0x0eb9880d, 0x0eb9900d, 0x0eb9980d, 0x0eb9a00d, 0x0eb9a80d, 0x0eb9b00d,
+    0x0eb9b80d, 0x0eb9c00d, 0x0eb9c80d, 0x0eb9d00d, 0x0eb9d80d, 0x0eb9e00d, 0x0eb9e80d, 0x0eb9f00d,
+    0x0eb9f80d, 0x0eba000d, 0x0eba080d, 0x0eba100d, 0x0eba180d, 0x0eba200d, 0x0eba280d, 0x0eba300d,
+    0x0eba380d, 0x0eba480d, 0x0eba500d, 0x0eba580d, 0x0eba600d, 0x0eba680d, 0x0eba700d, 0x0eba780d,
+    0x0eba800d, 0x0eba880d, 0x0eba900d, 0x0eba980d, 0x0ebaa00d, 0x0ebaa80d, 0x0ebab00d, 0x0ebab80d,
+    0x0ebac00d, 0x0ebac80d, 0x0ebad00d, 0x0ebad80d, 0x0ebae00d, 0x0ebae80d, 0x0ebaf00d, 0x0ebaf80d,
+    0x0ebb000d, 0x0ebb080d, 0x0ebb100d, 0x0ebb180d, 0x0ebb200d, 0x0ebb280d, 0x0ebb300d, 0x0ebb380d,
+    0x0ebb400d, 0x0ebb480d, 0x0ebb500d, 0x0ebb580d, 0x0ebb600d, 0x0ebb680d, 0x0ebb700d, 0x0ebb780d,
+    0x0ebb800d, 0x0ebb880d, 0x0ebb900d, 0x0ebb980d, 0x0ebba00d, 0x0ebba80d, 0x0ebbb00d, 0x0ebbb80d,
+    0x0ebbc00d, 0x0ebbc80d, 0x0ebbd00d, 0x0ebbd80d, 0x0ebbe00d, 0x0ebbe80d, 0x0ebbf00d, 0x0ebbf80d,
+    0x0ebc000d, 0x0ebc080d, 0x0ebc180d, 0x0ebc200d, 0x0ebc280d, 0x0ebc300d, 0x0ebc380d, 0x0ebc400d,
+    0x0ebc480d, 0x0ebc500d, 0x0ebc580d, 0x0ebc600d, 0x0ebc680d, 0x0ebc700d, 0x0ebc780d, 0x0ebc800d,
+    0x0ebc880d, 0x0ebc900d, 0x0ebc980d, 0x0ebca00d, 0x0ebca80d, 0x0ebcb00d, 0x0ebcb80d, 0x0ebcc00d,
+    0x0ebcc80d, 0x0ebcd00d, 0x0ebcd80d, 0x0ebce00d, 0x0ebce80d, 0x0ebcf00d, 0x0ebcf80d, 0x0ebd000d,
+    0x0ebd080d, 0x0ebd100d, 0x0ebd180d, 0x0ebd200d, 0x0ebd280d, 0x0ebd300d, 0x0ebd380d, 0x0ebd400d,
+    0x0ebd480d, 0x0ebd500d, 0x0ebd580d, 0x0ebd600d, 0x0ebd680d, 0x0ebd700d, 0x0ebd780d, 0x0ebd800d,
+    0x0ebd880d, 0x0ebd900d, 0x0ebd980d, 0x0ebda00d, 0x0ebda80d, 0x0ebdb00d, 0x0ebdb80d, 0x0ebdc00d,
+    0x0ebdc80d, 0x0ebdd00d, 0x0ebdd80d, 0x0ebde80d, 0x0ebdf00d, 0x0ebdf80d, 0x0ebe000d, 0x0ebe080d,
+    0x0ebe100d, 0x0ebe180d, 0x0ebe200d, 0x0ebe280d, 0x0ebe300d, 0x0ebe380d, 0x0ebe400d, 0x0ebe480d,
+    0x0ebe500d, 0x0ebe6001, 0x0ebe700d, 0x0ebe780d, 0x0ebe800d, 0x0ebe880d, 0x0ebe900d, 0x0ebe980d,
+    0x0ebea00d, 0x0ebea80d, 0x0ebeb00d, 0x0ebeb80d, 0x0ebec00d, 0x0ebec80d, 0x0ebed00d, 0x0ebed80d,
+    0x0ebee00d, 0x0ebee80d, 0x0ebef00d, 0x0ebef80d, 0x0ebf000d, 0x0ebf080d, 0x0ebf100d, 0x0ebf180d,
+    0x0ebf200d, 0x0ebf280d, 0x0ebf300d, 0x0ebf380d, 0x0ebf400d, 0x0ebf480d, 0x0ebf500d, 0x0ebf580d,
+    0x0ebf600d, 0x0ebf680d, 0x0ebf700d, 0x0ebf780d, 0x0ebf800d, 0x0ebf880d, 0x0ebf900d, 0x0ebf980d,
+    0x0ebfa00d, 0x0ebfa80d, 0x0ebfb00d, 0x0ebfb80d, 0x0ebfc00d, 0x0ebfc80d, 0x0ebfd00d, 0x0ebfd80d,
+    0x0ebfe00d, 0x0ebfe80d, 0x0ebff00d, 0x0ebff80d, 0x0ec00007, 0x0ed46001, 0x0ed4d807, 0x0ed50001,
+    0x0ed50807, 0x0ed58001, 0x0ef80007, 0x0ef8f801, 0x0ef92807, 0x0ef95801, 0x0f000007, 0x0f003801,
+    0x0f004007, 0x0f00c801, 0x0f00d807, 0x0f011001, 0x0f011807, 0x0f012801, 0x0f013007, 0x0f015801,
+    0x0f01800d, 0x0f01880d, 0x0f01900d, 0x0f01980d, 0x0f01a00d, 0x0f01a80d, 0x0f01b00d, 0x0f01b80d,
+    0x0f01c00d, 0x0f01c80d, 0x0f01d00d, 0x0f01d80d, 0x0f01e00d, 0x0f01e80d, 0x0f01f00d, 0x0f01f80d,
+    0x0f02000d, 0x0f02080d, 0x0f02100d, 0x0f02180d, 0x0f02200d, 0x0f02280d, 0x0f02300d, 0x0f02380d,
+    0x0f02400d, 0x0f02480d, 0x0f02500d, 0x0f02580d, 0x0f02600d, 0x0f02680d, 0x0f02700d, 0x0f02780d,
+    0x0f02800d, 0x0f02880d, 0x0f02900d, 0x0f02980d, 0x0f02a00d, 0x0f02a80d, 0x0f02b00d, 0x0f02b80d,
+    0x0f02c00d, 0x0f02c80d, 0x0f02d00d, 0x0f02d80d, 0x0f02e00d, 0x0f02e80d, 0x0f02f00d, 0x0f02f80d,
+    0x0f03000d, 0x0f03080d, 0x0f03100d, 0x0f03180d, 0x0f03200d, 0x0f03280d, 0x0f03300d, 0x0f03380d,
+    0x0f03400d, 0x0f03480d, 0x0f03500d, 0x0f03580d, 0x0f03600d, 0x0f03680d, 0x0f037001, 0x0f047807,
+    0x0f048001, 0x0f080007, 0x0f096801, 0x0f098007, 0x0f09f001, 0x0f0a0007, 0x0f0a5001, 0x0f0a7007,
+    0x0f0a8001, 0x0f148007, 0x0f157801, 0x0f160007, 0x0f17d001, 0x0f17f807, 0x0f180001, 0x0f268007,
+    0x0f27d001, 0x0f3f0007, 0x0f3f3801, 0x0f3f4007, 0x0f3f6001, 0x0f3f6807, 0x0f3f7801, 0x0f3f8007,
+    0x0f3ff801, 0x0f400007, 0x0f462801, 0x0f463807, 0x0f46b801, 0x0f48000d, 0x0f48080d, 0x0f48100d,
+    0x0f48180d, 0x0f48200d, 0x0f48280d, 0x0f48300d, 0x0f48380d, 0x0f48400d, 0x0f48480d, 0x0f48500d,
+    0x0f48580d, 0x0f48600d, 0x0f48680d, 0x0f48700d, 0x0f48780d, 0x0f48800d, 0x0f48880d, 0x0f48900d,
+    0x0f48980d, 0x0f48a00d, 0x0f48a80d, 0x0f48b00d, 0x0f48b80d, 0x0f48c00d, 0x0f48c80d, 0x0f48d00d,
+    0x0f48d80d, 0x0f48e00d, 0x0f48e80d, 0x0f48f00d, 0x0f48f80d, 0x0f49000d, 0x0f49080d, 0x0f491007,
+    0x0f4a6001, 0x0f4a8007, 0x0f4ad001, 0x0f4af007, 0x0f4b0001, 0x0f638807, 0x0f65a801, 0x0f680807,
+    0x0f69f001, 0x0f70000d, 0x0f70080d, 0x0f70100d, 0x0f70180d, 0x0f702001, 0x0f70280d, 0x0f70300d,
+    0x0f70380d, 0x0f70400d, 0x0f70480d, 0x0f70500d, 0x0f70580d, 0x0f70600d, 0x0f70680d, 0x0f70700d,
+    0x0f70780d, 0x0f70800d, 0x0f70880d, 0x0f70900d, 0x0f70980d, 0x0f70a00d, 0x0f70a80d, 0x0f70b00d,
+    0x0f70b80d, 0x0f70c00d, 0x0f70c80d, 0x0f70d00d, 0x0f70d80d, 0x0f70e00d, 0x0f70e80d, 0x0f70f00d,
+    0x0f70f80d, 0x0f710001, 0x0f71080d, 0x0f71100d, 0x0f711801, 0x0f71200d, 0x0f712801, 0x0f71380d,
+    0x0f714001, 0x0f71480d, 0x0f71500d, 0x0f71580d, 0x0f71600d, 0x0f71680d, 0x0f71700d, 0x0f71780d,
+    0x0f71800d, 0x0f71880d, 0x0f71900d, 0x0f719801, 0x0f71a00d, 0x0f71a80d, 0x0f71b00d, 0x0f71b80d,
+    0x0f71c001, 0x0f71c80d, 0x0f71d001, 0x0f71d80d, 0x0f71e001, 0x0f72100d, 0x0f721801, 0x0f72380d,
+    0x0f724001, 0x0f72480d, 0x0f725001, 0x0f72580d, 0x0f726001, 0x0f72680d, 0x0f72700d, 0x0f72780d,
+    0x0f728001, 0x0f72880d, 0x0f72900d, 0x0f729801, 0x0f72a00d, 0x0f72a801, 0x0f72b80d, 0x0f72c001,
+    0x0f72c80d, 0x0f72d001, 0x0f72d80d, 0x0f72e001, 0x0f72e80d, 0x0f72f001, 0x0f72f80d, 0x0f730001,
+    0x0f73080d, 0x0f73100d, 0x0f731801, 0x0f73200d, 0x0f732801, 0x0f73380d, 0x0f73400d, 0x0f73480d,
+    0x0f73500d, 0x0f735801, 0x0f73600d, 0x0f73680d, 0x0f73700d, 0x0f73780d, 0x0f73800d, 0x0f73880d,
+    0x0f73900d, 0x0f739801, 0x0f73a00d, 0x0f73a80d, 0x0f73b00d, 0x0f73b80d, 0x0f73c001, 0x0f73c80d,
+    0x0f73d00d, 0x0f73d80d, 0x0f73e00d, 0x0f73e801, 0x0f73f00d, 0x0f73f801, 0x0f74000d, 0x0f74080d,
+    0x0f74100d, 0x0f74180d, 0x0f74200d, 0x0f74280d, 0x0f74300d, 0x0f74380d, 0x0f74400d, 0x0f74480d,
+    0x0f745001, 0x0f74580d, 0x0f74600d, 0x0f74680d, 0x0f74700d, 0x0f74780d, 0x0f74800d, 0x0f74880d,
+    0x0f74900d, 0x0f74980d, 0x0f74a00d, 0x0f74a80d, 0x0f74b00d, 0x0f74b80d, 0x0f74c00d, 0x0f74c80d,
+    0x0f74d00d, 0x0f74d80d, 0x0f74e001, 0x0f75080d, 0x0f75100d, 0x0f75180d, 0x0f752001, 0x0f75280d,
+    0x0f75300d, 0x0f75380d, 0x0f75400d, 0x0f75480d, 0x0f755001, 0x0f75580d, 0x0f75600d, 0x0f75680d,
+    0x0f75700d, 0x0f75780d, 0x0f75800d, 0x0f75880d, 0x0f75900d, 0x0f75980d, 0x0f75a00d, 0x0f75a80d,
+    0x0f75b00d, 0x0f75b80d, 0x0f75c00d, 0x0f75c80d, 0x0f75d00d, 0x0f75d80d, 0x0f75e001, 0x0f778007,
+    0x0f779001, 0x0f800007, 0x0f816001, 0x0f818007, 0x0f84a001, 0x0f850007, 0x0f857801, 0x0f858807,
+    0x0f860001, 0x0f860807, 0x0f868001, 0x0f868807, 0x0f87b001, 0x0f880813, 0x0f881013, 0x0f881813,
+    0x0f882013, 0x0f882813, 0x0f883013, 0x0f883813, 0x0f884013, 0x0f884813, 0x0f885013, 0x0f885807,
+    0x0f88801b, 0x0f88881b, 0x0f88901b, 0x0f88981b, 0x0f88a01b, 0x0f88a81b, 0x0f88b01b, 0x0f88b81b,
+    0x0f88c01b, 0x0f88c81b, 0x0f88d01b, 0x0f88d81b, 0x0f88e01b, 0x0f88e81b, 0x0f88f01b, 0x0f88f81b,
+    0x0f89001b, 0x0f89081b, 0x0f89101b, 0x0f89181b, 0x0f89201b, 0x0f89281b, 0x0f89301b, 0x0f89381b,
+    0x0f89401b, 0x0f89481b, 0x0f89501d, 0x0f89580d, 0x0f89600d, 0x0f896815, 0x0f897015, 0x0f897807,
+    0x0f89800d, 0x0f89880d, 0x0f89900d, 0x0f89980d, 0x0f89a00d, 0x0f89a80d, 0x0f89b00d, 0x0f89b80d,
+    0x0f89c00d, 0x0f89c80d, 0x0f89d00d, 0x0f89d80d, 0x0f89e00d, 0x0f89e80d, 0x0f89f00d, 0x0f89f80d,
+    0x0f8a000d, 0x0f8a080d, 0x0f8a100d, 0x0f8a180d, 0x0f8a200d, 0x0f8a280d, 0x0f8a300d, 0x0f8a380d,
+    0x0f8a400d, 0x0f8a480d, 0x0f8a5015, 0x0f8a5815, 0x0f8a6015, 0x0f8a6815, 0x0f8a701d, 0x0f8a7815,
+    0x0f8a8007, 0x0f8b5015, 0x0f8b5815, 0x0f8b6015, 0x0f8b6807, 0x0f8c8015, 0x0f8c8807, 0x0f8d7001,
+    0x0f8f3007, 0x0f900015, 0x0f900815, 0x0f90100d, 0x0f901801, 0x0f90800d, 0x0f90880d, 0x0f90900d,
+    0x0f90980d, 0x0f90a00d, 0x0f90a80d, 0x0f90b00d, 0x0f90b80d, 0x0f90c00d, 0x0f90c80d, 0x0f90d00d,
+    0x0f90d80d, 0x0f90e00d, 0x0f90e80d, 0x0f90f00d, 0x0f90f80d, 0x0f91000d, 0x0f91080d, 0x0f91100d,
+    0x0f91180d, 0x0f91200d, 0x0f91280d, 0x0f91300d, 0x0f91380d, 0x0f91400d, 0x0f91480d, 0x0f91500d,
+    0x0f91580d, 0x0f91600d, 0x0f91680d, 0x0f91700d, 0x0f91780d, 0x0f91800d, 0x0f91880d, 0x0f91900d,
+    0x0f91980d, 0x0f91a00d, 0x0f91a80d, 0x0f91b00d, 0x0f91b80d, 0x0f91c00d, 0x0f91c80d, 0x0f91d00d,
+    0x0f91d80d, 0x0f91e001, 0x0f92001d, 0x0f92081d, 0x0f92101d, 0x0f92181d, 0x0f92201d, 0x0f92281d,
+    0x0f92301d, 0x0f92381d, 0x0f92401d, 0x0f924801, 0x0f92800d, 0x0f92880d, 0x0f929001, 0x0f930007,
+    0x0f933001, 0x0f980007, 0x0fb6c001, 0x0fb6e007, 0x0fb76801, 0x0fb78007, 0x0fb7e801, 0x0fb80007,
+    0x0fbbb801, 0x0fbbd807, 0x0fbed001, 0x0fbf0007, 0x0fbf6001, 0x0fbf8007, 0x0fbf8801, 0x0fc00007,
+    0x0fc06001, 0x0fc08007, 0x0fc24001, 0x0fc28007, 0x0fc2d001, 0x0fc30007, 0x0fc44001, 0x0fc48007,
+    0x0fc57001, 0x0fc58007, 0x0fc59001, 0x0fc80007, 0x0fd2a001, 0x0fd30007, 0x0fd37001, 0x0fd38007,
+    0x0fd3e801, 0x0fd40007, 0x0fd44801, 0x0fd48007, 0x0fd5f001, 0x0fd5f807, 0x0fd63001, 0x0fd67007,
+    0x0fd6e001, 0x0fd70007, 0x0fd74801, 0x0fd78007, 0x0fd7c801, 0x0fd80007, 0x0fdc9801, 0x0fdca007,
+    0x0fde5801, 0x0fdf800d, 0x0fdf880d, 0x0fdf900d, 0x0fdf980d, 0x0fdfa00d, 0x0fdfa80d, 0x0fdfb00d,
+    0x0fdfb80d, 0x0fdfc00d, 0x0fdfc80d, 0x0fdfd001, 0x10000007, 0x15370001, 0x15380007, 0x15b9d001,
+    0x15ba0007, 0x15c0f001, 0x15c10007, 0x16751001, 0x16758007, 0x175f0801, 0x175f8007, 0x1772f001,
+    0x17c0000d, 0x17c0080d, 0x17c0100d, 0x17c0180d, 0x17c0200d, 0x17c0280d, 0x17c0300d, 0x17c0380d,
+    0x17c0400d, 0x17c0480d, 0x17c0500d, 0x17c0580d, 0x17c0600d, 0x17c0680d, 0x17c0700d, 0x17c0780d,
+    0x17c0800d, 0x17c0880d, 0x17c0900d, 0x17c0980d, 0x17c0a00d, 0x17c0a80d, 0x17c0b00d, 0x17c0b80d,
+    0x17c0c00d, 0x17c0c80d, 0x17c0d00d, 0x17c0d80d, 0x17c0e00d, 0x17c0e80d, 0x17c0f00d, 0x17c0f80d,
+    0x17c1000d, 0x17c1080d, 0x17c1100d, 0x17c1180d, 0x17c1200d, 0x17c1280d, 0x17c1300d, 0x17c1380d,
+    0x17c1400d, 0x17c1480d, 0x17c1500d, 0x17c1580d, 0x17c1600d, 0x17c1680d, 0x17c1700d, 0x17c1780d,
+    0x17c1800d, 0x17c1880d, 0x17c1a00d, 0x17c1a80d, 0x17c1b00d, 0x17c1b80d, 0x17c1c00d, 0x17c1c80d,
+    0x17c1d00d, 0x17c1d80d, 0x17c1e00d, 0x17c1e80d, 0x17c1f00d, 0x17c1f80d, 0x17c2000d, 0x17c2080d,
+    0x17c2100d, 0x17c2180d, 0x17c2200d, 0x17c2280d, 0x17c2380d, 0x17c2400d, 0x17c2480d, 0x17c2500d,
+    0x17c2580d, 0x17c2600d, 0x17c2680d, 0x17c2700d, 0x17c2780d, 0x17c2800d, 0x17c2880d, 0x17c2900d,
+    0x17c2980d, 0x17c2a00d, 0x17c2a80d, 0x17c2b00d, 0x17c2b80d, 0x17c2c00d, 0x17c2c80d, 0x17c2d00d,
+    0x17c2d80d, 0x17c2e00d, 0x17c2e80d, 0x17c2f00d, 0x17c2f80d, 0x17c3000d, 0x17c3080d, 0x17c3100d,
+    0x17c3180d, 0x17c3200d, 0x17c3280d, 0x17c3300d, 0x17c3380d, 0x17c34001, 0x17c3480d, 0x17c3500d,
+    0x17c3600d, 0x17c3680d, 0x17c3700d, 0x17c3780d, 0x17c3800d, 0x17c3880d, 0x17c3900d, 0x17c3980d,
+    0x17c3a001, 0x17c3a80d, 0x17c3b00d, 0x17c3b80d, 0x17c3c00d, 0x17c3c80d, 0x17c3d00d, 0x17c3d80d,
+    0x17c3e00d, 0x17c3e80d, 0x17c3f00d, 0x17c3f80d, 0x17c4000d, 0x17c4080d, 0x17c4100d, 0x17c4180d,
+    0x17c4200d, 0x17c4280d, 0x17c4300d, 0x17c4380d, 0x17c4400d, 0x17c4480d, 0x17c4500d, 0x17c4580d,
+    0x17c4600d, 0x17c4680d, 0x17c4700d, 0x17c4780d, 0x17c4800d, 0x17c4880d, 0x17c4980d, 0x17c4a00d,
+    0x17c4b00d, 0x17c4b80d, 0x17c4c00d, 0x17c4c80d, 0x17c4d00d, 0x17c4d80d, 0x17c4e00d, 0x17c4e80d,
+    0x17c4f00d, 0x17c4f80d, 0x17c5000d, 0x17c5080d, 0x17c5100d, 0x17c5180d, 0x17c5200d, 0x17c5280d,
+    0x17c5300d, 0x17c5380d, 0x17c5400d, 0x17c5480d, 0x17c5500d, 0x17c5580d, 0x17c5600d, 0x17c5680d,
+    0x17c5700d, 0x17c5780d, 0x17c5800d, 0x17c5880d, 0x17c5900d, 0x17c5980d, 0x17c5a00d, 0x17c5a80d,
+    0x17c5b00d, 0x17c5b80d, 0x17c5c00d, 0x17c5c80d, 0x17c5d00d, 0x17c5d80d, 0x17c5e00d, 0x17c5e80d,
+    0x17c5f00d, 0x17c5f80d, 0x17c6000d, 0x17c6080d, 0x17c6100d, 0x17c6180d, 0x17c6200d, 0x17c6280d,
+    0x17c6300d, 0x17c6380d, 0x17c6400d, 0x17c6480d, 0x17c6500d, 0x17c6580d, 0x17c6600d, 0x17c6680d,
+    0x17c6700d, 0x17c6780d, 0x17c6800d, 0x17c6880d, 0x17c6900d, 0x17c6980d, 0x17c6a00d, 0x17c6a80d,
+    0x17c6b00d, 0x17c6b80d, 0x17c6c00d, 0x17c6c80d, 0x17c6d00d, 0x17c6d80d, 0x17c6e00d, 0x17c6e80d,
+    0x17c6f00d, 0x17c6f80d, 0x17c7000d, 0x17c7080d, 0x17c7100d, 0x17c7180d, 0x17c7200d, 0x17c7280d,
+    0x17c7300d, 0x17c7380d, 0x17c7400d, 0x17c7480d, 0x17c7500d, 0x17c7580d, 0x17c7600d, 0x17c7680d,
+    0x17c7700d, 0x17c7780d, 0x17c7800d, 0x17c7880d, 0x17c7900d, 0x17c7980d, 0x17c7a00d, 0x17c7a80d,
+    0x17c7b00d, 0x17c7b80d, 0x17c7c00d, 0x17c7c80d, 0x17c7d00d, 0x17c7d80d, 0x17c7e00d, 0x17c7e80d,
+    0x17c7f00d, 0x17c7f80d, 0x17c8000d, 0x17c8080d, 0x17c8100d, 0x17c8180d, 0x17c8200d, 0x17c8280d,
+    0x17c8300d, 0x17c8380d, 0x17c8400d, 0x17c8480d, 0x17c8500d, 0x17c8580d, 0x17c8600d, 0x17c8680d,
+    0x17c8700d, 0x17c8780d, 0x17c8800d, 0x17c8880d, 0x17c8900d, 0x17c8980d, 0x17c8a00d, 0x17c8a80d,
+    0x17c8b00d, 0x17c8b80d, 0x17c8c00d, 0x17c8c80d, 0x17c8d00d, 0x17c8d80d, 0x17c8e00d, 0x17c8e80d,
+    0x17c8f00d, 0x17c8f801, 0x17c9000d, 0x17c9080d, 0x17c9100d, 0x17c9180d, 0x17c9200d, 0x17c9280d,
+    0x17c9300d, 0x17c9380d, 0x17c9400d, 0x17c9480d, 0x17c9500d, 0x17c9580d, 0x17c9600d, 0x17c9700d,
+    0x17c9780d, 0x17c9800d, 0x17c9880d, 0x17c9900d, 0x17c9980d, 0x17c9a00d, 0x17c9a80d, 0x17c9b00d,
+    0x17c9b80d, 0x17c9c00d, 0x17c9c80d, 0x17c9d00d, 0x17c9d80d, 0x17c9e00d, 0x17c9e80d, 0x17c9f00d,
+    0x17c9f80d, 0x17ca000d, 0x17ca080d, 0x17ca100d, 0x17ca180d, 0x17ca200d, 0x17ca280d, 0x17ca300d,
+    0x17ca400d, 0x17ca480d, 0x17ca500d, 0x17ca580d, 0x17ca600d, 0x17ca680d, 0x17ca700d, 0x17ca780d,
+    0x17ca800d, 0x17ca880d, 0x17ca900d, 0x17ca980d, 0x17caa00d, 0x17caa80d, 0x17cab00d, 0x17cab80d,
+    0x17cac00d, 0x17cac80d, 0x17cad00d, 0x17cad80d, 0x17cae00d, 0x17cae80d, 0x17caf801, 0x17cb000d,
+    0x17cb080d, 0x17cb100d, 0x17cb180d, 0x17cb200d, 0x17cb280d, 0x17cb300d, 0x17cb380d, 0x17cb400d,
+    0x17cb480d, 0x17cb500d, 0x17cb580d, 0x17cb600d, 0x17cb680d, 0x17cb700d, 0x17cb780d, 0x17cb800d,
+    0x17cb880d, 0x17cb900d, 0x17cb980d, 0x17cba00d, 0x17cba80d, 0x17cbb00d, 0x17cbb80d, 0x17cbc00d,
+    0x17cbc80d, 0x17cbd00d, 0x17cbd80d, 0x17cbe00d, 0x17cbe80d, 0x17cbf00d, 0x17cbf80d, 0x17cc000d,
+    0x17cc080d, 0x17cc100d, 0x17cc180d, 0x17cc200d, 0x17cc280d, 0x17cc300d, 0x17cc380d, 0x17cc400d,
+    0x17cc480d, 0x17cc500d, 0x17cc580d, 0x17cc600d, 0x17cc680d, 0x17cc700d, 0x17cc780d, 0x17cc800d,
+    0x17cc880d, 0x17cc900d, 0x17cc980d, 0x17cca00d, 0x17cca80d, 0x17ccb00d, 0x17ccb80d, 0x17ccc00d,
+    0x17ccc80d, 0x17ccd00d, 0x17ccd80d, 0x17cce00d, 0x17cce80d, 0x17ccf00d, 0x17ccf80d, 0x17cd000d,
+    0x17cd080d, 0x17cd100d, 0x17cd180d, 0x17cd200d, 0x17cd280d, 0x17cd300d, 0x17cd380d, 0x17cd400d,
+    0x17cd480d, 0x17cd500d, 0x17cd580d, 0x17cd600d, 0x17cd680d, 0x17cd700d, 0x17cd780d, 0x17cd800d,
+    0x17cd880d, 0x17cd900d, 0x17cd980d, 0x17cda00d, 0x17cda80d, 0x17cdb00d, 0x17cdb80d, 0x17cdc00d,
+    0x17cdc80d, 0x17cdd00d, 0x17cdd80d, 0x17cde00d, 0x17cde80d, 0x17cdf00d, 0x17cdf801, 0x17ce000d,
+    0x17ce080d, 0x17ce100d, 0x17ce180d, 0x17ce200d, 0x17ce280d, 0x17ce300d, 0x17ce380d, 0x17ce400d,
+    0x17ce480d, 0x17ce500d, 0x17ce580d, 0x17ce600d, 0x17ce680d, 0x17ce700d, 0x17ce780d, 0x17ce800d,
+    0x17ce880d, 0x17ce900d, 0x17ce980d, 0x17cea00d, 0x17cea80d, 0x17ceb00d, 0x17ceb80d, 0x17cec00d,
+    0x17cec80d, 0x17ced00d, 0x17ced80d, 0x17cee00d, 0x17cee80d, 0x17cef00d, 0x17cef80d, 0x17cf000d,
+    0x17cf080d, 0x17cf100d, 0x17cf180d, 0x17cf200d, 0x17cf280d, 0x17cf300d, 0x17cf380d, 0x17cf400d,
+    0x17cf480d, 0x17cf500d, 0x17cf580d, 0x17cf600d, 0x17cf680d, 0x17cf700d, 0x17cf780d, 0x17cf800d,
+    0x17cf880d, 0x17cf900d, 0x17cf980d, 0x17cfa00d, 0x17cfa80d, 0x17cfb00d, 0x17cfb80d, 0x17cfc00d,
+    0x17cfc80d, 0x17cfd00d, 0x17cfd80d, 0x17cfe00d, 0x17cfe80d, 0x17cff00d, 0x17d0000d, 0x17d0080d,
+    0x17d0100d, 0x17d0180d, 0x17d0200d, 0x17d0280d, 0x17d0300d, 0x17d0380d, 0x17d0400d, 0x17d0480d,
+    0x17d0500d, 0x17d0580d, 0x17d0600d, 0x17d0680d, 0x17d0700d, 0x17d0780d, 0x17d0800d, 0x17d0880d,
+    0x17d0900d, 0x17d0980d, 0x17d0a00d, 0x17d0a80d, 0x17d0b00d, 0x17d0b80d, 0x17d0c00d, 0x17d0c80d,
+    0x17d0d00d, 0x17d0d80d, 0x17d0e00d, 0x17d0e80d, 0x17d0f001, 0x18000007, 0x189a5801, 0x189a8007,
+    0x191d8001, 0x70080004, 0x700f8001,
 }};
 
-struct mapped_16_code_point {
-  char16_t code_point;
-  char16_t mapped;
-};
-
-constexpr static auto mapped_16 = std::array<mapped_16_code_point, 3785>{{
-    {U'\x0041', U'\x0061'}, {U'\x0042', U'\x0062'}, {U'\x0043', U'\x0063'}, {U'\x0044', U'\x0064'},
-    {U'\x0045', U'\x0065'}, {U'\x0046', U'\x0066'}, {U'\x0047', U'\x0067'}, {U'\x0048', U'\x0068'},
-    {U'\x0049', U'\x0069'}, {U'\x004a', U'\x006a'}, {U'\x004b', U'\x006b'}, {U'\x004c', U'\x006c'},
-    {U'\x004d', U'\x006d'}, {U'\x004e', U'\x006e'}, {U'\x004f', U'\x006f'}, {U'\x0050', U'\x0070'},
-    {U'\x0051', U'\x0071'}, {U'\x0052', U'\x0072'}, {U'\x0053', U'\x0073'}, {U'\x0054', U'\x0074'},
-    {U'\x0055', U'\x0075'}, {U'\x0056', U'\x0076'}, {U'\x0057', U'\x0077'}, {U'\x0058', U'\x0078'},
-    {U'\x0059', U'\x0079'}, {U'\x005a', U'\x007a'}, {U'\x00a0', U'\x0020'}, {U'\x00a8', U'\x0020'},
-    {U'\x00aa', U'\x0061'}, {U'\x00af', U'\x0020'}, {U'\x00b2', U'\x0032'}, {U'\x00b3', U'\x0033'},
-    {U'\x00b4', U'\x0020'}, {U'\x00b5', U'\x03bc'}, {U'\x00b8', U'\x0020'}, {U'\x00b9', U'\x0031'},
-    {U'\x00ba', U'\x006f'}, {U'\x00bc', U'\x0031'}, {U'\x00bd', U'\x0031'}, {U'\x00be', U'\x0033'},
-    {U'\x00c0', U'\x00e0'}, {U'\x00c1', U'\x00e1'}, {U'\x00c2', U'\x00e2'}, {U'\x00c3', U'\x00e3'},
-    {U'\x00c4', U'\x00e4'}, {U'\x00c5', U'\x00e5'}, {U'\x00c6', U'\x00e6'}, {U'\x00c7', U'\x00e7'},
-    {U'\x00c8', U'\x00e8'}, {U'\x00c9', U'\x00e9'}, {U'\x00ca', U'\x00ea'}, {U'\x00cb', U'\x00eb'},
-    {U'\x00cc', U'\x00ec'}, {U'\x00cd', U'\x00ed'}, {U'\x00ce', U'\x00ee'}, {U'\x00cf', U'\x00ef'},
-    {U'\x00d0', U'\x00f0'}, {U'\x00d1', U'\x00f1'}, {U'\x00d2', U'\x00f2'}, {U'\x00d3', U'\x00f3'},
-    {U'\x00d4', U'\x00f4'}, {U'\x00d5', U'\x00f5'}, {U'\x00d6', U'\x00f6'}, {U'\x00d8', U'\x00f8'},
-    {U'\x00d9', U'\x00f9'}, {U'\x00da', U'\x00fa'}, {U'\x00db', U'\x00fb'}, {U'\x00dc', U'\x00fc'},
-    {U'\x00dd', U'\x00fd'}, {U'\x00de', U'\x00fe'}, {U'\x0100', U'\x0101'}, {U'\x0102', U'\x0103'},
-    {U'\x0104', U'\x0105'}, {U'\x0106', U'\x0107'}, {U'\x0108', U'\x0109'}, {U'\x010a', U'\x010b'},
-    {U'\x010c', U'\x010d'}, {U'\x010e', U'\x010f'}, {U'\x0110', U'\x0111'}, {U'\x0112', U'\x0113'},
-    {U'\x0114', U'\x0115'}, {U'\x0116', U'\x0117'}, {U'\x0118', U'\x0119'}, {U'\x011a', U'\x011b'},
-    {U'\x011c', U'\x011d'}, {U'\x011e', U'\x011f'}, {U'\x0120', U'\x0121'}, {U'\x0122', U'\x0123'},
-    {U'\x0124', U'\x0125'}, {U'\x0126', U'\x0127'}, {U'\x0128', U'\x0129'}, {U'\x012a', U'\x012b'},
-    {U'\x012c', U'\x012d'}, {U'\x012e', U'\x012f'}, {U'\x0130', U'\x0069'}, {U'\x0132', U'\x0069'},
-    {U'\x0134', U'\x0135'}, {U'\x0136', U'\x0137'}, {U'\x0139', U'\x013a'}, {U'\x013b', U'\x013c'},
-    {U'\x013d', U'\x013e'}, {U'\x013f', U'\x006c'}, {U'\x0141', U'\x0142'}, {U'\x0143', U'\x0144'},
-    {U'\x0145', U'\x0146'}, {U'\x0147', U'\x0148'}, {U'\x0149', U'\x02bc'}, {U'\x014a', U'\x014b'},
-    {U'\x014c', U'\x014d'}, {U'\x014e', U'\x014f'}, {U'\x0150', U'\x0151'}, {U'\x0152', U'\x0153'},
-    {U'\x0154', U'\x0155'}, {U'\x0156', U'\x0157'}, {U'\x0158', U'\x0159'}, {U'\x015a', U'\x015b'},
-    {U'\x015c', U'\x015d'}, {U'\x015e', U'\x015f'}, {U'\x0160', U'\x0161'}, {U'\x0162', U'\x0163'},
-    {U'\x0164', U'\x0165'}, {U'\x0166', U'\x0167'}, {U'\x0168', U'\x0169'}, {U'\x016a', U'\x016b'},
-    {U'\x016c', U'\x016d'}, {U'\x016e', U'\x016f'}, {U'\x0170', U'\x0171'}, {U'\x0172', U'\x0173'},
-    {U'\x0174', U'\x0175'}, {U'\x0176', U'\x0177'}, {U'\x0178', U'\x00ff'}, {U'\x0179', U'\x017a'},
-    {U'\x017b', U'\x017c'}, {U'\x017d', U'\x017e'}, {U'\x017f', U'\x0073'}, {U'\x0181', U'\x0253'},
-    {U'\x0182', U'\x0183'}, {U'\x0184', U'\x0185'}, {U'\x0186', U'\x0254'}, {U'\x0187', U'\x0188'},
-    {U'\x0189', U'\x0256'}, {U'\x018a', U'\x0257'}, {U'\x018b', U'\x018c'}, {U'\x018e', U'\x01dd'},
-    {U'\x018f', U'\x0259'}, {U'\x0190', U'\x025b'}, {U'\x0191', U'\x0192'}, {U'\x0193', U'\x0260'},
-    {U'\x0194', U'\x0263'}, {U'\x0196', U'\x0269'}, {U'\x0197', U'\x0268'}, {U'\x0198', U'\x0199'},
-    {U'\x019c', U'\x026f'}, {U'\x019d', U'\x0272'}, {U'\x019f', U'\x0275'}, {U'\x01a0', U'\x01a1'},
-    {U'\x01a2', U'\x01a3'}, {U'\x01a4', U'\x01a5'}, {U'\x01a6', U'\x0280'}, {U'\x01a7', U'\x01a8'},
-    {U'\x01a9', U'\x0283'}, {U'\x01ac', U'\x01ad'}, {U'\x01ae', U'\x0288'}, {U'\x01af', U'\x01b0'},
-    {U'\x01b1', U'\x028a'}, {U'\x01b2', U'\x028b'}, {U'\x01b3', U'\x01b4'}, {U'\x01b5', U'\x01b6'},
-    {U'\x01b7', U'\x0292'}, {U'\x01b8', U'\x01b9'}, {U'\x01bc', U'\x01bd'}, {U'\x01c4', U'\x0064'},
-    {U'\x01c7', U'\x006c'}, {U'\x01ca', U'\x006e'}, {U'\x01cd', U'\x01ce'}, {U'\x01cf', U'\x01d0'},
-    {U'\x01d1', U'\x01d2'}, {U'\x01d3', U'\x01d4'}, {U'\x01d5', U'\x01d6'}, {U'\x01d7', U'\x01d8'},
-    {U'\x01d9', U'\x01da'}, {U'\x01db', U'\x01dc'}, {U'\x01de', U'\x01df'}, {U'\x01e0', U'\x01e1'},
-    {U'\x01e2', U'\x01e3'}, {U'\x01e4', U'\x01e5'}, {U'\x01e6', U'\x01e7'}, {U'\x01e8', U'\x01e9'},
-    {U'\x01ea', U'\x01eb'}, {U'\x01ec', U'\x01ed'}, {U'\x01ee', U'\x01ef'}, {U'\x01f1', U'\x0064'},
-    {U'\x01f4', U'\x01f5'}, {U'\x01f6', U'\x0195'}, {U'\x01f7', U'\x01bf'}, {U'\x01f8', U'\x01f9'},
-    {U'\x01fa', U'\x01fb'}, {U'\x01fc', U'\x01fd'}, {U'\x01fe', U'\x01ff'}, {U'\x0200', U'\x0201'},
-    {U'\x0202', U'\x0203'}, {U'\x0204', U'\x0205'}, {U'\x0206', U'\x0207'}, {U'\x0208', U'\x0209'},
-    {U'\x020a', U'\x020b'}, {U'\x020c', U'\x020d'}, {U'\x020e', U'\x020f'}, {U'\x0210', U'\x0211'},
-    {U'\x0212', U'\x0213'}, {U'\x0214', U'\x0215'}, {U'\x0216', U'\x0217'}, {U'\x0218', U'\x0219'},
-    {U'\x021a', U'\x021b'}, {U'\x021c', U'\x021d'}, {U'\x021e', U'\x021f'}, {U'\x0220', U'\x019e'},
-    {U'\x0222', U'\x0223'}, {U'\x0224', U'\x0225'}, {U'\x0226', U'\x0227'}, {U'\x0228', U'\x0229'},
-    {U'\x022a', U'\x022b'}, {U'\x022c', U'\x022d'}, {U'\x022e', U'\x022f'}, {U'\x0230', U'\x0231'},
-    {U'\x0232', U'\x0233'}, {U'\x023a', U'\x2c65'}, {U'\x023b', U'\x023c'}, {U'\x023d', U'\x019a'},
-    {U'\x023e', U'\x2c66'}, {U'\x0241', U'\x0242'}, {U'\x0243', U'\x0180'}, {U'\x0244', U'\x0289'},
-    {U'\x0245', U'\x028c'}, {U'\x0246', U'\x0247'}, {U'\x0248', U'\x0249'}, {U'\x024a', U'\x024b'},
-    {U'\x024c', U'\x024d'}, {U'\x024e', U'\x024f'}, {U'\x02b0', U'\x0068'}, {U'\x02b1', U'\x0266'},
-    {U'\x02b2', U'\x006a'}, {U'\x02b3', U'\x0072'}, {U'\x02b4', U'\x0279'}, {U'\x02b5', U'\x027b'},
-    {U'\x02b6', U'\x0281'}, {U'\x02b7', U'\x0077'}, {U'\x02b8', U'\x0079'}, {U'\x02d8', U'\x0020'},
-    {U'\x02d9', U'\x0020'}, {U'\x02da', U'\x0020'}, {U'\x02db', U'\x0020'}, {U'\x02dc', U'\x0020'},
-    {U'\x02dd', U'\x0020'}, {U'\x02e0', U'\x0263'}, {U'\x02e1', U'\x006c'}, {U'\x02e2', U'\x0073'},
-    {U'\x02e3', U'\x0078'}, {U'\x02e4', U'\x0295'}, {U'\x0340', U'\x0300'}, {U'\x0341', U'\x0301'},
-    {U'\x0343', U'\x0313'}, {U'\x0344', U'\x0308'}, {U'\x0345', U'\x03b9'}, {U'\x0370', U'\x0371'},
-    {U'\x0372', U'\x0373'}, {U'\x0374', U'\x02b9'}, {U'\x0376', U'\x0377'}, {U'\x037a', U'\x0020'},
-    {U'\x037e', U'\x003b'}, {U'\x037f', U'\x03f3'}, {U'\x0384', U'\x0020'}, {U'\x0385', U'\x0020'},
-    {U'\x0386', U'\x03ac'}, {U'\x0387', U'\x00b7'}, {U'\x0388', U'\x03ad'}, {U'\x0389', U'\x03ae'},
-    {U'\x038a', U'\x03af'}, {U'\x038c', U'\x03cc'}, {U'\x038e', U'\x03cd'}, {U'\x038f', U'\x03ce'},
-    {U'\x0391', U'\x03b1'}, {U'\x0392', U'\x03b2'}, {U'\x0393', U'\x03b3'}, {U'\x0394', U'\x03b4'},
-    {U'\x0395', U'\x03b5'}, {U'\x0396', U'\x03b6'}, {U'\x0397', U'\x03b7'}, {U'\x0398', U'\x03b8'},
-    {U'\x0399', U'\x03b9'}, {U'\x039a', U'\x03ba'}, {U'\x039b', U'\x03bb'}, {U'\x039c', U'\x03bc'},
-    {U'\x039d', U'\x03bd'}, {U'\x039e', U'\x03be'}, {U'\x039f', U'\x03bf'}, {U'\x03a0', U'\x03c0'},
-    {U'\x03a1', U'\x03c1'}, {U'\x03a3', U'\x03c3'}, {U'\x03a4', U'\x03c4'}, {U'\x03a5', U'\x03c5'},
-    {U'\x03a6', U'\x03c6'}, {U'\x03a7', U'\x03c7'}, {U'\x03a8', U'\x03c8'}, {U'\x03a9', U'\x03c9'},
-    {U'\x03aa', U'\x03ca'}, {U'\x03ab', U'\x03cb'}, {U'\x03cf', U'\x03d7'}, {U'\x03d0', U'\x03b2'},
-    {U'\x03d1', U'\x03b8'}, {U'\x03d2', U'\x03c5'}, {U'\x03d3', U'\x03cd'}, {U'\x03d4', U'\x03cb'},
-    {U'\x03d5', U'\x03c6'}, {U'\x03d6', U'\x03c0'}, {U'\x03d8', U'\x03d9'}, {U'\x03da', U'\x03db'},
-    {U'\x03dc', U'\x03dd'}, {U'\x03de', U'\x03df'}, {U'\x03e0', U'\x03e1'}, {U'\x03e2', U'\x03e3'},
-    {U'\x03e4', U'\x03e5'}, {U'\x03e6', U'\x03e7'}, {U'\x03e8', U'\x03e9'}, {U'\x03ea', U'\x03eb'},
-    {U'\x03ec', U'\x03ed'}, {U'\x03ee', U'\x03ef'}, {U'\x03f0', U'\x03ba'}, {U'\x03f1', U'\x03c1'},
-    {U'\x03f2', U'\x03c3'}, {U'\x03f4', U'\x03b8'}, {U'\x03f5', U'\x03b5'}, {U'\x03f7', U'\x03f8'},
-    {U'\x03f9', U'\x03c3'}, {U'\x03fa', U'\x03fb'}, {U'\x03fd', U'\x037b'}, {U'\x03fe', U'\x037c'},
-    {U'\x03ff', U'\x037d'}, {U'\x0400', U'\x0450'}, {U'\x0401', U'\x0451'}, {U'\x0402', U'\x0452'},
-    {U'\x0403', U'\x0453'}, {U'\x0404', U'\x0454'}, {U'\x0405', U'\x0455'}, {U'\x0406', U'\x0456'},
-    {U'\x0407', U'\x0457'}, {U'\x0408', U'\x0458'}, {U'\x0409', U'\x0459'}, {U'\x040a', U'\x045a'},
-    {U'\x040b', U'\x045b'}, {U'\x040c', U'\x045c'}, {U'\x040d', U'\x045d'}, {U'\x040e', U'\x045e'},
-    {U'\x040f', U'\x045f'}, {U'\x0410', U'\x0430'}, {U'\x0411', U'\x0431'}, {U'\x0412', U'\x0432'},
-    {U'\x0413', U'\x0433'}, {U'\x0414', U'\x0434'}, {U'\x0415', U'\x0435'}, {U'\x0416', U'\x0436'},
-    {U'\x0417', U'\x0437'}, {U'\x0418', U'\x0438'}, {U'\x0419', U'\x0439'}, {U'\x041a', U'\x043a'},
-    {U'\x041b', U'\x043b'}, {U'\x041c', U'\x043c'}, {U'\x041d', U'\x043d'}, {U'\x041e', U'\x043e'},
-    {U'\x041f', U'\x043f'}, {U'\x0420', U'\x0440'}, {U'\x0421', U'\x0441'}, {U'\x0422', U'\x0442'},
-    {U'\x0423', U'\x0443'}, {U'\x0424', U'\x0444'}, {U'\x0425', U'\x0445'}, {U'\x0426', U'\x0446'},
-    {U'\x0427', U'\x0447'}, {U'\x0428', U'\x0448'}, {U'\x0429', U'\x0449'}, {U'\x042a', U'\x044a'},
-    {U'\x042b', U'\x044b'}, {U'\x042c', U'\x044c'}, {U'\x042d', U'\x044d'}, {U'\x042e', U'\x044e'},
-    {U'\x042f', U'\x044f'}, {U'\x0460', U'\x0461'}, {U'\x0462', U'\x0463'}, {U'\x0464', U'\x0465'},
-    {U'\x0466', U'\x0467'}, {U'\x0468', U'\x0469'}, {U'\x046a', U'\x046b'}, {U'\x046c', U'\x046d'},
-    {U'\x046e', U'\x046f'}, {U'\x0470', U'\x0471'}, {U'\x0472', U'\x0473'}, {U'\x0474', U'\x0475'},
-    {U'\x0476', U'\x0477'}, {U'\x0478', U'\x0479'}, {U'\x047a', U'\x047b'}, {U'\x047c', U'\x047d'},
-    {U'\x047e', U'\x047f'}, {U'\x0480', U'\x0481'}, {U'\x048a', U'\x048b'}, {U'\x048c', U'\x048d'},
-    {U'\x048e', U'\x048f'}, {U'\x0490', U'\x0491'}, {U'\x0492', U'\x0493'}, {U'\x0494', U'\x0495'},
-    {U'\x0496', U'\x0497'}, {U'\x0498', U'\x0499'}, {U'\x049a', U'\x049b'}, {U'\x049c', U'\x049d'},
-    {U'\x049e', U'\x049f'}, {U'\x04a0', U'\x04a1'}, {U'\x04a2', U'\x04a3'}, {U'\x04a4', U'\x04a5'},
-    {U'\x04a6', U'\x04a7'}, {U'\x04a8', U'\x04a9'}, {U'\x04aa', U'\x04ab'}, {U'\x04ac', U'\x04ad'},
-    {U'\x04ae', U'\x04af'}, {U'\x04b0', U'\x04b1'}, {U'\x04b2', U'\x04b3'}, {U'\x04b4', U'\x04b5'},
-    {U'\x04b6', U'\x04b7'}, {U'\x04b8', U'\x04b9'}, {U'\x04ba', U'\x04bb'}, {U'\x04bc', U'\x04bd'},
-    {U'\x04be', U'\x04bf'}, {U'\x04c1', U'\x04c2'}, {U'\x04c3', U'\x04c4'}, {U'\x04c5', U'\x04c6'},
-    {U'\x04c7', U'\x04c8'}, {U'\x04c9', U'\x04ca'}, {U'\x04cb', U'\x04cc'}, {U'\x04cd', U'\x04ce'},
-    {U'\x04d0', U'\x04d1'}, {U'\x04d2', U'\x04d3'}, {U'\x04d4', U'\x04d5'}, {U'\x04d6', U'\x04d7'},
-    {U'\x04d8', U'\x04d9'}, {U'\x04da', U'\x04db'}, {U'\x04dc', U'\x04dd'}, {U'\x04de', U'\x04df'},
-    {U'\x04e0', U'\x04e1'}, {U'\x04e2', U'\x04e3'}, {U'\x04e4', U'\x04e5'}, {U'\x04e6', U'\x04e7'},
-    {U'\x04e8', U'\x04e9'}, {U'\x04ea', U'\x04eb'}, {U'\x04ec', U'\x04ed'}, {U'\x04ee', U'\x04ef'},
-    {U'\x04f0', U'\x04f1'}, {U'\x04f2', U'\x04f3'}, {U'\x04f4', U'\x04f5'}, {U'\x04f6', U'\x04f7'},
-    {U'\x04f8', U'\x04f9'}, {U'\x04fa', U'\x04fb'}, {U'\x04fc', U'\x04fd'}, {U'\x04fe', U'\x04ff'},
-    {U'\x0500', U'\x0501'}, {U'\x0502', U'\x0503'}, {U'\x0504', U'\x0505'}, {U'\x0506', U'\x0507'},
-    {U'\x0508', U'\x0509'}, {U'\x050a', U'\x050b'}, {U'\x050c', U'\x050d'}, {U'\x050e', U'\x050f'},
-    {U'\x0510', U'\x0511'}, {U'\x0512', U'\x0513'}, {U'\x0514', U'\x0515'}, {U'\x0516', U'\x0517'},
-    {U'\x0518', U'\x0519'}, {U'\x051a', U'\x051b'}, {U'\x051c', U'\x051d'}, {U'\x051e', U'\x051f'},
-    {U'\x0520', U'\x0521'}, {U'\x0522', U'\x0523'}, {U'\x0524', U'\x0525'}, {U'\x0526', U'\x0527'},
-    {U'\x0528', U'\x0529'}, {U'\x052a', U'\x052b'}, {U'\x052c', U'\x052d'}, {U'\x052e', U'\x052f'},
-    {U'\x0531', U'\x0561'}, {U'\x0532', U'\x0562'}, {U'\x0533', U'\x0563'}, {U'\x0534', U'\x0564'},
-    {U'\x0535', U'\x0565'}, {U'\x0536', U'\x0566'}, {U'\x0537', U'\x0567'}, {U'\x0538', U'\x0568'},
-    {U'\x0539', U'\x0569'}, {U'\x053a', U'\x056a'}, {U'\x053b', U'\x056b'}, {U'\x053c', U'\x056c'},
-    {U'\x053d', U'\x056d'}, {U'\x053e', U'\x056e'}, {U'\x053f', U'\x056f'}, {U'\x0540', U'\x0570'},
-    {U'\x0541', U'\x0571'}, {U'\x0542', U'\x0572'}, {U'\x0543', U'\x0573'}, {U'\x0544', U'\x0574'},
-    {U'\x0545', U'\x0575'}, {U'\x0546', U'\x0576'}, {U'\x0547', U'\x0577'}, {U'\x0548', U'\x0578'},
-    {U'\x0549', U'\x0579'}, {U'\x054a', U'\x057a'}, {U'\x054b', U'\x057b'}, {U'\x054c', U'\x057c'},
-    {U'\x054d', U'\x057d'}, {U'\x054e', U'\x057e'}, {U'\x054f', U'\x057f'}, {U'\x0550', U'\x0580'},
-    {U'\x0551', U'\x0581'}, {U'\x0552', U'\x0582'}, {U'\x0553', U'\x0583'}, {U'\x0554', U'\x0584'},
-    {U'\x0555', U'\x0585'}, {U'\x0556', U'\x0586'}, {U'\x0587', U'\x0565'}, {U'\x0675', U'\x0627'},
-    {U'\x0676', U'\x0648'}, {U'\x0677', U'\x06c7'}, {U'\x0678', U'\x064a'}, {U'\x0958', U'\x0915'},
-    {U'\x0959', U'\x0916'}, {U'\x095a', U'\x0917'}, {U'\x095b', U'\x091c'}, {U'\x095c', U'\x0921'},
-    {U'\x095d', U'\x0922'}, {U'\x095e', U'\x092b'}, {U'\x095f', U'\x092f'}, {U'\x09dc', U'\x09a1'},
-    {U'\x09dd', U'\x09a2'}, {U'\x09df', U'\x09af'}, {U'\x0a33', U'\x0a32'}, {U'\x0a36', U'\x0a38'},
-    {U'\x0a59', U'\x0a16'}, {U'\x0a5a', U'\x0a17'}, {U'\x0a5b', U'\x0a1c'}, {U'\x0a5e', U'\x0a2b'},
-    {U'\x0b5c', U'\x0b21'}, {U'\x0b5d', U'\x0b22'}, {U'\x0e33', U'\x0e4d'}, {U'\x0eb3', U'\x0ecd'},
-    {U'\x0edc', U'\x0eab'}, {U'\x0edd', U'\x0eab'}, {U'\x0f0c', U'\x0f0b'}, {U'\x0f43', U'\x0f42'},
-    {U'\x0f4d', U'\x0f4c'}, {U'\x0f52', U'\x0f51'}, {U'\x0f57', U'\x0f56'}, {U'\x0f5c', U'\x0f5b'},
-    {U'\x0f69', U'\x0f40'}, {U'\x0f73', U'\x0f71'}, {U'\x0f75', U'\x0f71'}, {U'\x0f76', U'\x0fb2'},
-    {U'\x0f77', U'\x0fb2'}, {U'\x0f78', U'\x0fb3'}, {U'\x0f79', U'\x0fb3'}, {U'\x0f81', U'\x0f71'},
-    {U'\x0f93', U'\x0f92'}, {U'\x0f9d', U'\x0f9c'}, {U'\x0fa2', U'\x0fa1'}, {U'\x0fa7', U'\x0fa6'},
-    {U'\x0fac', U'\x0fab'}, {U'\x0fb9', U'\x0f90'}, {U'\x10c7', U'\x2d27'}, {U'\x10cd', U'\x2d2d'},
-    {U'\x10fc', U'\x10dc'}, {U'\x13f8', U'\x13f0'}, {U'\x13f9', U'\x13f1'}, {U'\x13fa', U'\x13f2'},
-    {U'\x13fb', U'\x13f3'}, {U'\x13fc', U'\x13f4'}, {U'\x13fd', U'\x13f5'}, {U'\x1c80', U'\x0432'},
-    {U'\x1c81', U'\x0434'}, {U'\x1c82', U'\x043e'}, {U'\x1c83', U'\x0441'}, {U'\x1c84', U'\x0442'},
-    {U'\x1c86', U'\x044a'}, {U'\x1c87', U'\x0463'}, {U'\x1c88', U'\xa64b'}, {U'\x1c90', U'\x10d0'},
-    {U'\x1c91', U'\x10d1'}, {U'\x1c92', U'\x10d2'}, {U'\x1c93', U'\x10d3'}, {U'\x1c94', U'\x10d4'},
-    {U'\x1c95', U'\x10d5'}, {U'\x1c96', U'\x10d6'}, {U'\x1c97', U'\x10d7'}, {U'\x1c98', U'\x10d8'},
-    {U'\x1c99', U'\x10d9'}, {U'\x1c9a', U'\x10da'}, {U'\x1c9b', U'\x10db'}, {U'\x1c9c', U'\x10dc'},
-    {U'\x1c9d', U'\x10dd'}, {U'\x1c9e', U'\x10de'}, {U'\x1c9f', U'\x10df'}, {U'\x1ca0', U'\x10e0'},
-    {U'\x1ca1', U'\x10e1'}, {U'\x1ca2', U'\x10e2'}, {U'\x1ca3', U'\x10e3'}, {U'\x1ca4', U'\x10e4'},
-    {U'\x1ca5', U'\x10e5'}, {U'\x1ca6', U'\x10e6'}, {U'\x1ca7', U'\x10e7'}, {U'\x1ca8', U'\x10e8'},
-    {U'\x1ca9', U'\x10e9'}, {U'\x1caa', U'\x10ea'}, {U'\x1cab', U'\x10eb'}, {U'\x1cac', U'\x10ec'},
-    {U'\x1cad', U'\x10ed'}, {U'\x1cae', U'\x10ee'}, {U'\x1caf', U'\x10ef'}, {U'\x1cb0', U'\x10f0'},
-    {U'\x1cb1', U'\x10f1'}, {U'\x1cb2', U'\x10f2'}, {U'\x1cb3', U'\x10f3'}, {U'\x1cb4', U'\x10f4'},
-    {U'\x1cb5', U'\x10f5'}, {U'\x1cb6', U'\x10f6'}, {U'\x1cb7', U'\x10f7'}, {U'\x1cb8', U'\x10f8'},
-    {U'\x1cb9', U'\x10f9'}, {U'\x1cba', U'\x10fa'}, {U'\x1cbd', U'\x10fd'}, {U'\x1cbe', U'\x10fe'},
-    {U'\x1cbf', U'\x10ff'}, {U'\x1d2c', U'\x0061'}, {U'\x1d2d', U'\x00e6'}, {U'\x1d2e', U'\x0062'},
-    {U'\x1d30', U'\x0064'}, {U'\x1d31', U'\x0065'}, {U'\x1d32', U'\x01dd'}, {U'\x1d33', U'\x0067'},
-    {U'\x1d34', U'\x0068'}, {U'\x1d35', U'\x0069'}, {U'\x1d36', U'\x006a'}, {U'\x1d37', U'\x006b'},
-    {U'\x1d38', U'\x006c'}, {U'\x1d39', U'\x006d'}, {U'\x1d3a', U'\x006e'}, {U'\x1d3c', U'\x006f'},
-    {U'\x1d3d', U'\x0223'}, {U'\x1d3e', U'\x0070'}, {U'\x1d3f', U'\x0072'}, {U'\x1d40', U'\x0074'},
-    {U'\x1d41', U'\x0075'}, {U'\x1d42', U'\x0077'}, {U'\x1d43', U'\x0061'}, {U'\x1d44', U'\x0250'},
-    {U'\x1d45', U'\x0251'}, {U'\x1d46', U'\x1d02'}, {U'\x1d47', U'\x0062'}, {U'\x1d48', U'\x0064'},
-    {U'\x1d49', U'\x0065'}, {U'\x1d4a', U'\x0259'}, {U'\x1d4b', U'\x025b'}, {U'\x1d4c', U'\x025c'},
-    {U'\x1d4d', U'\x0067'}, {U'\x1d4f', U'\x006b'}, {U'\x1d50', U'\x006d'}, {U'\x1d51', U'\x014b'},
-    {U'\x1d52', U'\x006f'}, {U'\x1d53', U'\x0254'}, {U'\x1d54', U'\x1d16'}, {U'\x1d55', U'\x1d17'},
-    {U'\x1d56', U'\x0070'}, {U'\x1d57', U'\x0074'}, {U'\x1d58', U'\x0075'}, {U'\x1d59', U'\x1d1d'},
-    {U'\x1d5a', U'\x026f'}, {U'\x1d5b', U'\x0076'}, {U'\x1d5c', U'\x1d25'}, {U'\x1d5d', U'\x03b2'},
-    {U'\x1d5e', U'\x03b3'}, {U'\x1d5f', U'\x03b4'}, {U'\x1d60', U'\x03c6'}, {U'\x1d61', U'\x03c7'},
-    {U'\x1d62', U'\x0069'}, {U'\x1d63', U'\x0072'}, {U'\x1d64', U'\x0075'}, {U'\x1d65', U'\x0076'},
-    {U'\x1d66', U'\x03b2'}, {U'\x1d67', U'\x03b3'}, {U'\x1d68', U'\x03c1'}, {U'\x1d69', U'\x03c6'},
-    {U'\x1d6a', U'\x03c7'}, {U'\x1d78', U'\x043d'}, {U'\x1d9b', U'\x0252'}, {U'\x1d9c', U'\x0063'},
-    {U'\x1d9d', U'\x0255'}, {U'\x1d9e', U'\x00f0'}, {U'\x1d9f', U'\x025c'}, {U'\x1da0', U'\x0066'},
-    {U'\x1da1', U'\x025f'}, {U'\x1da2', U'\x0261'}, {U'\x1da3', U'\x0265'}, {U'\x1da4', U'\x0268'},
-    {U'\x1da5', U'\x0269'}, {U'\x1da6', U'\x026a'}, {U'\x1da7', U'\x1d7b'}, {U'\x1da8', U'\x029d'},
-    {U'\x1da9', U'\x026d'}, {U'\x1daa', U'\x1d85'}, {U'\x1dab', U'\x029f'}, {U'\x1dac', U'\x0271'},
-    {U'\x1dad', U'\x0270'}, {U'\x1dae', U'\x0272'}, {U'\x1daf', U'\x0273'}, {U'\x1db0', U'\x0274'},
-    {U'\x1db1', U'\x0275'}, {U'\x1db2', U'\x0278'}, {U'\x1db3', U'\x0282'}, {U'\x1db4', U'\x0283'},
-    {U'\x1db5', U'\x01ab'}, {U'\x1db6', U'\x0289'}, {U'\x1db7', U'\x028a'}, {U'\x1db8', U'\x1d1c'},
-    {U'\x1db9', U'\x028b'}, {U'\x1dba', U'\x028c'}, {U'\x1dbb', U'\x007a'}, {U'\x1dbc', U'\x0290'},
-    {U'\x1dbd', U'\x0291'}, {U'\x1dbe', U'\x0292'}, {U'\x1dbf', U'\x03b8'}, {U'\x1e00', U'\x1e01'},
-    {U'\x1e02', U'\x1e03'}, {U'\x1e04', U'\x1e05'}, {U'\x1e06', U'\x1e07'}, {U'\x1e08', U'\x1e09'},
-    {U'\x1e0a', U'\x1e0b'}, {U'\x1e0c', U'\x1e0d'}, {U'\x1e0e', U'\x1e0f'}, {U'\x1e10', U'\x1e11'},
-    {U'\x1e12', U'\x1e13'}, {U'\x1e14', U'\x1e15'}, {U'\x1e16', U'\x1e17'}, {U'\x1e18', U'\x1e19'},
-    {U'\x1e1a', U'\x1e1b'}, {U'\x1e1c', U'\x1e1d'}, {U'\x1e1e', U'\x1e1f'}, {U'\x1e20', U'\x1e21'},
-    {U'\x1e22', U'\x1e23'}, {U'\x1e24', U'\x1e25'}, {U'\x1e26', U'\x1e27'}, {U'\x1e28', U'\x1e29'},
-    {U'\x1e2a', U'\x1e2b'}, {U'\x1e2c', U'\x1e2d'}, {U'\x1e2e', U'\x1e2f'}, {U'\x1e30', U'\x1e31'},
-    {U'\x1e32', U'\x1e33'}, {U'\x1e34', U'\x1e35'}, {U'\x1e36', U'\x1e37'}, {U'\x1e38', U'\x1e39'},
-    {U'\x1e3a', U'\x1e3b'}, {U'\x1e3c', U'\x1e3d'}, {U'\x1e3e', U'\x1e3f'}, {U'\x1e40', U'\x1e41'},
-    {U'\x1e42', U'\x1e43'}, {U'\x1e44', U'\x1e45'}, {U'\x1e46', U'\x1e47'}, {U'\x1e48', U'\x1e49'},
-    {U'\x1e4a', U'\x1e4b'}, {U'\x1e4c', U'\x1e4d'}, {U'\x1e4e', U'\x1e4f'}, {U'\x1e50', U'\x1e51'},
-    {U'\x1e52', U'\x1e53'}, {U'\x1e54', U'\x1e55'}, {U'\x1e56', U'\x1e57'}, {U'\x1e58', U'\x1e59'},
-    {U'\x1e5a', U'\x1e5b'}, {U'\x1e5c', U'\x1e5d'}, {U'\x1e5e', U'\x1e5f'}, {U'\x1e60', U'\x1e61'},
-    {U'\x1e62', U'\x1e63'}, {U'\x1e64', U'\x1e65'}, {U'\x1e66', U'\x1e67'}, {U'\x1e68', U'\x1e69'},
-    {U'\x1e6a', U'\x1e6b'}, {U'\x1e6c', U'\x1e6d'}, {U'\x1e6e', U'\x1e6f'}, {U'\x1e70', U'\x1e71'},
-    {U'\x1e72', U'\x1e73'}, {U'\x1e74', U'\x1e75'}, {U'\x1e76', U'\x1e77'}, {U'\x1e78', U'\x1e79'},
-    {U'\x1e7a', U'\x1e7b'}, {U'\x1e7c', U'\x1e7d'}, {U'\x1e7e', U'\x1e7f'}, {U'\x1e80', U'\x1e81'},
-    {U'\x1e82', U'\x1e83'}, {U'\x1e84', U'\x1e85'}, {U'\x1e86', U'\x1e87'}, {U'\x1e88', U'\x1e89'},
-    {U'\x1e8a', U'\x1e8b'}, {U'\x1e8c', U'\x1e8d'}, {U'\x1e8e', U'\x1e8f'}, {U'\x1e90', U'\x1e91'},
-    {U'\x1e92', U'\x1e93'}, {U'\x1e94', U'\x1e95'}, {U'\x1e9a', U'\x0061'}, {U'\x1e9b', U'\x1e61'},
-    {U'\x1e9e', U'\x00df'}, {U'\x1ea0', U'\x1ea1'}, {U'\x1ea2', U'\x1ea3'}, {U'\x1ea4', U'\x1ea5'},
-    {U'\x1ea6', U'\x1ea7'}, {U'\x1ea8', U'\x1ea9'}, {U'\x1eaa', U'\x1eab'}, {U'\x1eac', U'\x1ead'},
-    {U'\x1eae', U'\x1eaf'}, {U'\x1eb0', U'\x1eb1'}, {U'\x1eb2', U'\x1eb3'}, {U'\x1eb4', U'\x1eb5'},
-    {U'\x1eb6', U'\x1eb7'}, {U'\x1eb8', U'\x1eb9'}, {U'\x1eba', U'\x1ebb'}, {U'\x1ebc', U'\x1ebd'},
-    {U'\x1ebe', U'\x1ebf'}, {U'\x1ec0', U'\x1ec1'}, {U'\x1ec2', U'\x1ec3'}, {U'\x1ec4', U'\x1ec5'},
-    {U'\x1ec6', U'\x1ec7'}, {U'\x1ec8', U'\x1ec9'}, {U'\x1eca', U'\x1ecb'}, {U'\x1ecc', U'\x1ecd'},
-    {U'\x1ece', U'\x1ecf'}, {U'\x1ed0', U'\x1ed1'}, {U'\x1ed2', U'\x1ed3'}, {U'\x1ed4', U'\x1ed5'},
-    {U'\x1ed6', U'\x1ed7'}, {U'\x1ed8', U'\x1ed9'}, {U'\x1eda', U'\x1edb'}, {U'\x1edc', U'\x1edd'},
-    {U'\x1ede', U'\x1edf'}, {U'\x1ee0', U'\x1ee1'}, {U'\x1ee2', U'\x1ee3'}, {U'\x1ee4', U'\x1ee5'},
-    {U'\x1ee6', U'\x1ee7'}, {U'\x1ee8', U'\x1ee9'}, {U'\x1eea', U'\x1eeb'}, {U'\x1eec', U'\x1eed'},
-    {U'\x1eee', U'\x1eef'}, {U'\x1ef0', U'\x1ef1'}, {U'\x1ef2', U'\x1ef3'}, {U'\x1ef4', U'\x1ef5'},
-    {U'\x1ef6', U'\x1ef7'}, {U'\x1ef8', U'\x1ef9'}, {U'\x1efa', U'\x1efb'}, {U'\x1efc', U'\x1efd'},
-    {U'\x1efe', U'\x1eff'}, {U'\x1f08', U'\x1f00'}, {U'\x1f09', U'\x1f01'}, {U'\x1f0a', U'\x1f02'},
-    {U'\x1f0b', U'\x1f03'}, {U'\x1f0c', U'\x1f04'}, {U'\x1f0d', U'\x1f05'}, {U'\x1f0e', U'\x1f06'},
-    {U'\x1f0f', U'\x1f07'}, {U'\x1f18', U'\x1f10'}, {U'\x1f19', U'\x1f11'}, {U'\x1f1a', U'\x1f12'},
-    {U'\x1f1b', U'\x1f13'}, {U'\x1f1c', U'\x1f14'}, {U'\x1f1d', U'\x1f15'}, {U'\x1f28', U'\x1f20'},
-    {U'\x1f29', U'\x1f21'}, {U'\x1f2a', U'\x1f22'}, {U'\x1f2b', U'\x1f23'}, {U'\x1f2c', U'\x1f24'},
-    {U'\x1f2d', U'\x1f25'}, {U'\x1f2e', U'\x1f26'}, {U'\x1f2f', U'\x1f27'}, {U'\x1f38', U'\x1f30'},
-    {U'\x1f39', U'\x1f31'}, {U'\x1f3a', U'\x1f32'}, {U'\x1f3b', U'\x1f33'}, {U'\x1f3c', U'\x1f34'},
-    {U'\x1f3d', U'\x1f35'}, {U'\x1f3e', U'\x1f36'}, {U'\x1f3f', U'\x1f37'}, {U'\x1f48', U'\x1f40'},
-    {U'\x1f49', U'\x1f41'}, {U'\x1f4a', U'\x1f42'}, {U'\x1f4b', U'\x1f43'}, {U'\x1f4c', U'\x1f44'},
-    {U'\x1f4d', U'\x1f45'}, {U'\x1f59', U'\x1f51'}, {U'\x1f5b', U'\x1f53'}, {U'\x1f5d', U'\x1f55'},
-    {U'\x1f5f', U'\x1f57'}, {U'\x1f68', U'\x1f60'}, {U'\x1f69', U'\x1f61'}, {U'\x1f6a', U'\x1f62'},
-    {U'\x1f6b', U'\x1f63'}, {U'\x1f6c', U'\x1f64'}, {U'\x1f6d', U'\x1f65'}, {U'\x1f6e', U'\x1f66'},
-    {U'\x1f6f', U'\x1f67'}, {U'\x1f71', U'\x03ac'}, {U'\x1f73', U'\x03ad'}, {U'\x1f75', U'\x03ae'},
-    {U'\x1f77', U'\x03af'}, {U'\x1f79', U'\x03cc'}, {U'\x1f7b', U'\x03cd'}, {U'\x1f7d', U'\x03ce'},
-    {U'\x1f80', U'\x1f00'}, {U'\x1f81', U'\x1f01'}, {U'\x1f82', U'\x1f02'}, {U'\x1f83', U'\x1f03'},
-    {U'\x1f84', U'\x1f04'}, {U'\x1f85', U'\x1f05'}, {U'\x1f86', U'\x1f06'}, {U'\x1f87', U'\x1f07'},
-    {U'\x1f88', U'\x1f00'}, {U'\x1f89', U'\x1f01'}, {U'\x1f8a', U'\x1f02'}, {U'\x1f8b', U'\x1f03'},
-    {U'\x1f8c', U'\x1f04'}, {U'\x1f8d', U'\x1f05'}, {U'\x1f8e', U'\x1f06'}, {U'\x1f8f', U'\x1f07'},
-    {U'\x1f90', U'\x1f20'}, {U'\x1f91', U'\x1f21'}, {U'\x1f92', U'\x1f22'}, {U'\x1f93', U'\x1f23'},
-    {U'\x1f94', U'\x1f24'}, {U'\x1f95', U'\x1f25'}, {U'\x1f96', U'\x1f26'}, {U'\x1f97', U'\x1f27'},
-    {U'\x1f98', U'\x1f20'}, {U'\x1f99', U'\x1f21'}, {U'\x1f9a', U'\x1f22'}, {U'\x1f9b', U'\x1f23'},
-    {U'\x1f9c', U'\x1f24'}, {U'\x1f9d', U'\x1f25'}, {U'\x1f9e', U'\x1f26'}, {U'\x1f9f', U'\x1f27'},
-    {U'\x1fa0', U'\x1f60'}, {U'\x1fa1', U'\x1f61'}, {U'\x1fa2', U'\x1f62'}, {U'\x1fa3', U'\x1f63'},
-    {U'\x1fa4', U'\x1f64'}, {U'\x1fa5', U'\x1f65'}, {U'\x1fa6', U'\x1f66'}, {U'\x1fa7', U'\x1f67'},
-    {U'\x1fa8', U'\x1f60'}, {U'\x1fa9', U'\x1f61'}, {U'\x1faa', U'\x1f62'}, {U'\x1fab', U'\x1f63'},
-    {U'\x1fac', U'\x1f64'}, {U'\x1fad', U'\x1f65'}, {U'\x1fae', U'\x1f66'}, {U'\x1faf', U'\x1f67'},
-    {U'\x1fb2', U'\x1f70'}, {U'\x1fb3', U'\x03b1'}, {U'\x1fb4', U'\x03ac'}, {U'\x1fb7', U'\x1fb6'},
-    {U'\x1fb8', U'\x1fb0'}, {U'\x1fb9', U'\x1fb1'}, {U'\x1fba', U'\x1f70'}, {U'\x1fbb', U'\x03ac'},
-    {U'\x1fbc', U'\x03b1'}, {U'\x1fbd', U'\x0020'}, {U'\x1fbe', U'\x03b9'}, {U'\x1fbf', U'\x0020'},
-    {U'\x1fc0', U'\x0020'}, {U'\x1fc1', U'\x0020'}, {U'\x1fc2', U'\x1f74'}, {U'\x1fc3', U'\x03b7'},
-    {U'\x1fc4', U'\x03ae'}, {U'\x1fc7', U'\x1fc6'}, {U'\x1fc8', U'\x1f72'}, {U'\x1fc9', U'\x03ad'},
-    {U'\x1fca', U'\x1f74'}, {U'\x1fcb', U'\x03ae'}, {U'\x1fcc', U'\x03b7'}, {U'\x1fcd', U'\x0020'},
-    {U'\x1fce', U'\x0020'}, {U'\x1fcf', U'\x0020'}, {U'\x1fd3', U'\x0390'}, {U'\x1fd8', U'\x1fd0'},
-    {U'\x1fd9', U'\x1fd1'}, {U'\x1fda', U'\x1f76'}, {U'\x1fdb', U'\x03af'}, {U'\x1fdd', U'\x0020'},
-    {U'\x1fde', U'\x0020'}, {U'\x1fdf', U'\x0020'}, {U'\x1fe3', U'\x03b0'}, {U'\x1fe8', U'\x1fe0'},
-    {U'\x1fe9', U'\x1fe1'}, {U'\x1fea', U'\x1f7a'}, {U'\x1feb', U'\x03cd'}, {U'\x1fec', U'\x1fe5'},
-    {U'\x1fed', U'\x0020'}, {U'\x1fee', U'\x0020'}, {U'\x1fef', U'\x0060'}, {U'\x1ff2', U'\x1f7c'},
-    {U'\x1ff3', U'\x03c9'}, {U'\x1ff4', U'\x03ce'}, {U'\x1ff7', U'\x1ff6'}, {U'\x1ff8', U'\x1f78'},
-    {U'\x1ff9', U'\x03cc'}, {U'\x1ffa', U'\x1f7c'}, {U'\x1ffb', U'\x03ce'}, {U'\x1ffc', U'\x03c9'},
-    {U'\x1ffd', U'\x0020'}, {U'\x1ffe', U'\x0020'}, {U'\x2000', U'\x0020'}, {U'\x2011', U'\x2010'},
-    {U'\x2017', U'\x0020'}, {U'\x202f', U'\x0020'}, {U'\x2033', U'\x2032'}, {U'\x2034', U'\x2032'},
-    {U'\x2036', U'\x2035'}, {U'\x2037', U'\x2035'}, {U'\x203c', U'\x0021'}, {U'\x203e', U'\x0020'},
-    {U'\x2047', U'\x003f'}, {U'\x2048', U'\x003f'}, {U'\x2049', U'\x0021'}, {U'\x2057', U'\x2032'},
-    {U'\x205f', U'\x0020'}, {U'\x2070', U'\x0030'}, {U'\x2071', U'\x0069'}, {U'\x2074', U'\x0034'},
-    {U'\x2075', U'\x0035'}, {U'\x2076', U'\x0036'}, {U'\x2077', U'\x0037'}, {U'\x2078', U'\x0038'},
-    {U'\x2079', U'\x0039'}, {U'\x207a', U'\x002b'}, {U'\x207b', U'\x2212'}, {U'\x207c', U'\x003d'},
-    {U'\x207d', U'\x0028'}, {U'\x207e', U'\x0029'}, {U'\x207f', U'\x006e'}, {U'\x2080', U'\x0030'},
-    {U'\x2081', U'\x0031'}, {U'\x2082', U'\x0032'}, {U'\x2083', U'\x0033'}, {U'\x2084', U'\x0034'},
-    {U'\x2085', U'\x0035'}, {U'\x2086', U'\x0036'}, {U'\x2087', U'\x0037'}, {U'\x2088', U'\x0038'},
-    {U'\x2089', U'\x0039'}, {U'\x208a', U'\x002b'}, {U'\x208b', U'\x2212'}, {U'\x208c', U'\x003d'},
-    {U'\x208d', U'\x0028'}, {U'\x208e', U'\x0029'}, {U'\x2090', U'\x0061'}, {U'\x2091', U'\x0065'},
-    {U'\x2092', U'\x006f'}, {U'\x2093', U'\x0078'}, {U'\x2094', U'\x0259'}, {U'\x2095', U'\x0068'},
-    {U'\x2096', U'\x006b'}, {U'\x2097', U'\x006c'}, {U'\x2098', U'\x006d'}, {U'\x2099', U'\x006e'},
-    {U'\x209a', U'\x0070'}, {U'\x209b', U'\x0073'}, {U'\x209c', U'\x0074'}, {U'\x20a8', U'\x0072'},
-    {U'\x2100', U'\x0061'}, {U'\x2101', U'\x0061'}, {U'\x2102', U'\x0063'}, {U'\x2103', U'\x00b0'},
-    {U'\x2105', U'\x0063'}, {U'\x2106', U'\x0063'}, {U'\x2107', U'\x025b'}, {U'\x2109', U'\x00b0'},
-    {U'\x210a', U'\x0067'}, {U'\x210b', U'\x0068'}, {U'\x210f', U'\x0127'}, {U'\x2110', U'\x0069'},
-    {U'\x2112', U'\x006c'}, {U'\x2115', U'\x006e'}, {U'\x2116', U'\x006e'}, {U'\x2119', U'\x0070'},
-    {U'\x211a', U'\x0071'}, {U'\x211b', U'\x0072'}, {U'\x2120', U'\x0073'}, {U'\x2121', U'\x0074'},
-    {U'\x2122', U'\x0074'}, {U'\x2124', U'\x007a'}, {U'\x2126', U'\x03c9'}, {U'\x2128', U'\x007a'},
-    {U'\x212a', U'\x006b'}, {U'\x212b', U'\x00e5'}, {U'\x212c', U'\x0062'}, {U'\x212d', U'\x0063'},
-    {U'\x212f', U'\x0065'}, {U'\x2131', U'\x0066'}, {U'\x2133', U'\x006d'}, {U'\x2134', U'\x006f'},
-    {U'\x2135', U'\x05d0'}, {U'\x2136', U'\x05d1'}, {U'\x2137', U'\x05d2'}, {U'\x2138', U'\x05d3'},
-    {U'\x2139', U'\x0069'}, {U'\x213b', U'\x0066'}, {U'\x213c', U'\x03c0'}, {U'\x213d', U'\x03b3'},
-    {U'\x213f', U'\x03c0'}, {U'\x2140', U'\x2211'}, {U'\x2145', U'\x0064'}, {U'\x2147', U'\x0065'},
-    {U'\x2148', U'\x0069'}, {U'\x2149', U'\x006a'}, {U'\x2150', U'\x0031'}, {U'\x2151', U'\x0031'},
-    {U'\x2152', U'\x0031'}, {U'\x2153', U'\x0031'}, {U'\x2154', U'\x0032'}, {U'\x2155', U'\x0031'},
-    {U'\x2156', U'\x0032'}, {U'\x2157', U'\x0033'}, {U'\x2158', U'\x0034'}, {U'\x2159', U'\x0031'},
-    {U'\x215a', U'\x0035'}, {U'\x215b', U'\x0031'}, {U'\x215c', U'\x0033'}, {U'\x215d', U'\x0035'},
-    {U'\x215e', U'\x0037'}, {U'\x215f', U'\x0031'}, {U'\x2160', U'\x0069'}, {U'\x2161', U'\x0069'},
-    {U'\x2162', U'\x0069'}, {U'\x2163', U'\x0069'}, {U'\x2164', U'\x0076'}, {U'\x2165', U'\x0076'},
-    {U'\x2166', U'\x0076'}, {U'\x2167', U'\x0076'}, {U'\x2168', U'\x0069'}, {U'\x2169', U'\x0078'},
-    {U'\x216a', U'\x0078'}, {U'\x216b', U'\x0078'}, {U'\x216c', U'\x006c'}, {U'\x216d', U'\x0063'},
-    {U'\x216e', U'\x0064'}, {U'\x216f', U'\x006d'}, {U'\x2170', U'\x0069'}, {U'\x2171', U'\x0069'},
-    {U'\x2172', U'\x0069'}, {U'\x2173', U'\x0069'}, {U'\x2174', U'\x0076'}, {U'\x2175', U'\x0076'},
-    {U'\x2176', U'\x0076'}, {U'\x2177', U'\x0076'}, {U'\x2178', U'\x0069'}, {U'\x2179', U'\x0078'},
-    {U'\x217a', U'\x0078'}, {U'\x217b', U'\x0078'}, {U'\x217c', U'\x006c'}, {U'\x217d', U'\x0063'},
-    {U'\x217e', U'\x0064'}, {U'\x217f', U'\x006d'}, {U'\x2189', U'\x0030'}, {U'\x222c', U'\x222b'},
-    {U'\x222d', U'\x222b'}, {U'\x222f', U'\x222e'}, {U'\x2230', U'\x222e'}, {U'\x2329', U'\x3008'},
-    {U'\x232a', U'\x3009'}, {U'\x2460', U'\x0031'}, {U'\x2461', U'\x0032'}, {U'\x2462', U'\x0033'},
-    {U'\x2463', U'\x0034'}, {U'\x2464', U'\x0035'}, {U'\x2465', U'\x0036'}, {U'\x2466', U'\x0037'},
-    {U'\x2467', U'\x0038'}, {U'\x2468', U'\x0039'}, {U'\x2469', U'\x0031'}, {U'\x246a', U'\x0031'},
-    {U'\x246b', U'\x0031'}, {U'\x246c', U'\x0031'}, {U'\x246d', U'\x0031'}, {U'\x246e', U'\x0031'},
-    {U'\x246f', U'\x0031'}, {U'\x2470', U'\x0031'}, {U'\x2471', U'\x0031'}, {U'\x2472', U'\x0031'},
-    {U'\x2473', U'\x0032'}, {U'\x2474', U'\x0028'}, {U'\x2475', U'\x0028'}, {U'\x2476', U'\x0028'},
-    {U'\x2477', U'\x0028'}, {U'\x2478', U'\x0028'}, {U'\x2479', U'\x0028'}, {U'\x247a', U'\x0028'},
-    {U'\x247b', U'\x0028'}, {U'\x247c', U'\x0028'}, {U'\x247d', U'\x0028'}, {U'\x247e', U'\x0028'},
-    {U'\x247f', U'\x0028'}, {U'\x2480', U'\x0028'}, {U'\x2481', U'\x0028'}, {U'\x2482', U'\x0028'},
-    {U'\x2483', U'\x0028'}, {U'\x2484', U'\x0028'}, {U'\x2485', U'\x0028'}, {U'\x2486', U'\x0028'},
-    {U'\x2487', U'\x0028'}, {U'\x249c', U'\x0028'}, {U'\x249d', U'\x0028'}, {U'\x249e', U'\x0028'},
-    {U'\x249f', U'\x0028'}, {U'\x24a0', U'\x0028'}, {U'\x24a1', U'\x0028'}, {U'\x24a2', U'\x0028'},
-    {U'\x24a3', U'\x0028'}, {U'\x24a4', U'\x0028'}, {U'\x24a5', U'\x0028'}, {U'\x24a6', U'\x0028'},
-    {U'\x24a7', U'\x0028'}, {U'\x24a8', U'\x0028'}, {U'\x24a9', U'\x0028'}, {U'\x24aa', U'\x0028'},
-    {U'\x24ab', U'\x0028'}, {U'\x24ac', U'\x0028'}, {U'\x24ad', U'\x0028'}, {U'\x24ae', U'\x0028'},
-    {U'\x24af', U'\x0028'}, {U'\x24b0', U'\x0028'}, {U'\x24b1', U'\x0028'}, {U'\x24b2', U'\x0028'},
-    {U'\x24b3', U'\x0028'}, {U'\x24b4', U'\x0028'}, {U'\x24b5', U'\x0028'}, {U'\x24b6', U'\x0061'},
-    {U'\x24b7', U'\x0062'}, {U'\x24b8', U'\x0063'}, {U'\x24b9', U'\x0064'}, {U'\x24ba', U'\x0065'},
-    {U'\x24bb', U'\x0066'}, {U'\x24bc', U'\x0067'}, {U'\x24bd', U'\x0068'}, {U'\x24be', U'\x0069'},
-    {U'\x24bf', U'\x006a'}, {U'\x24c0', U'\x006b'}, {U'\x24c1', U'\x006c'}, {U'\x24c2', U'\x006d'},
-    {U'\x24c3', U'\x006e'}, {U'\x24c4', U'\x006f'}, {U'\x24c5', U'\x0070'}, {U'\x24c6', U'\x0071'},
-    {U'\x24c7', U'\x0072'}, {U'\x24c8', U'\x0073'}, {U'\x24c9', U'\x0074'}, {U'\x24ca', U'\x0075'},
-    {U'\x24cb', U'\x0076'}, {U'\x24cc', U'\x0077'}, {U'\x24cd', U'\x0078'}, {U'\x24ce', U'\x0079'},
-    {U'\x24cf', U'\x007a'}, {U'\x24d0', U'\x0061'}, {U'\x24d1', U'\x0062'}, {U'\x24d2', U'\x0063'},
-    {U'\x24d3', U'\x0064'}, {U'\x24d4', U'\x0065'}, {U'\x24d5', U'\x0066'}, {U'\x24d6', U'\x0067'},
-    {U'\x24d7', U'\x0068'}, {U'\x24d8', U'\x0069'}, {U'\x24d9', U'\x006a'}, {U'\x24da', U'\x006b'},
-    {U'\x24db', U'\x006c'}, {U'\x24dc', U'\x006d'}, {U'\x24dd', U'\x006e'}, {U'\x24de', U'\x006f'},
-    {U'\x24df', U'\x0070'}, {U'\x24e0', U'\x0071'}, {U'\x24e1', U'\x0072'}, {U'\x24e2', U'\x0073'},
-    {U'\x24e3', U'\x0074'}, {U'\x24e4', U'\x0075'}, {U'\x24e5', U'\x0076'}, {U'\x24e6', U'\x0077'},
-    {U'\x24e7', U'\x0078'}, {U'\x24e8', U'\x0079'}, {U'\x24e9', U'\x007a'}, {U'\x24ea', U'\x0030'},
-    {U'\x2a0c', U'\x222b'}, {U'\x2a74', U'\x003a'}, {U'\x2a75', U'\x003d'}, {U'\x2a76', U'\x003d'},
-    {U'\x2adc', U'\x2add'}, {U'\x2c00', U'\x2c30'}, {U'\x2c01', U'\x2c31'}, {U'\x2c02', U'\x2c32'},
-    {U'\x2c03', U'\x2c33'}, {U'\x2c04', U'\x2c34'}, {U'\x2c05', U'\x2c35'}, {U'\x2c06', U'\x2c36'},
-    {U'\x2c07', U'\x2c37'}, {U'\x2c08', U'\x2c38'}, {U'\x2c09', U'\x2c39'}, {U'\x2c0a', U'\x2c3a'},
-    {U'\x2c0b', U'\x2c3b'}, {U'\x2c0c', U'\x2c3c'}, {U'\x2c0d', U'\x2c3d'}, {U'\x2c0e', U'\x2c3e'},
-    {U'\x2c0f', U'\x2c3f'}, {U'\x2c10', U'\x2c40'}, {U'\x2c11', U'\x2c41'}, {U'\x2c12', U'\x2c42'},
-    {U'\x2c13', U'\x2c43'}, {U'\x2c14', U'\x2c44'}, {U'\x2c15', U'\x2c45'}, {U'\x2c16', U'\x2c46'},
-    {U'\x2c17', U'\x2c47'}, {U'\x2c18', U'\x2c48'}, {U'\x2c19', U'\x2c49'}, {U'\x2c1a', U'\x2c4a'},
-    {U'\x2c1b', U'\x2c4b'}, {U'\x2c1c', U'\x2c4c'}, {U'\x2c1d', U'\x2c4d'}, {U'\x2c1e', U'\x2c4e'},
-    {U'\x2c1f', U'\x2c4f'}, {U'\x2c20', U'\x2c50'}, {U'\x2c21', U'\x2c51'}, {U'\x2c22', U'\x2c52'},
-    {U'\x2c23', U'\x2c53'}, {U'\x2c24', U'\x2c54'}, {U'\x2c25', U'\x2c55'}, {U'\x2c26', U'\x2c56'},
-    {U'\x2c27', U'\x2c57'}, {U'\x2c28', U'\x2c58'}, {U'\x2c29', U'\x2c59'}, {U'\x2c2a', U'\x2c5a'},
-    {U'\x2c2b', U'\x2c5b'}, {U'\x2c2c', U'\x2c5c'}, {U'\x2c2d', U'\x2c5d'}, {U'\x2c2e', U'\x2c5e'},
-    {U'\x2c2f', U'\x2c5f'}, {U'\x2c60', U'\x2c61'}, {U'\x2c62', U'\x026b'}, {U'\x2c63', U'\x1d7d'},
-    {U'\x2c64', U'\x027d'}, {U'\x2c67', U'\x2c68'}, {U'\x2c69', U'\x2c6a'}, {U'\x2c6b', U'\x2c6c'},
-    {U'\x2c6d', U'\x0251'}, {U'\x2c6e', U'\x0271'}, {U'\x2c6f', U'\x0250'}, {U'\x2c70', U'\x0252'},
-    {U'\x2c72', U'\x2c73'}, {U'\x2c75', U'\x2c76'}, {U'\x2c7c', U'\x006a'}, {U'\x2c7d', U'\x0076'},
-    {U'\x2c7e', U'\x023f'}, {U'\x2c7f', U'\x0240'}, {U'\x2c80', U'\x2c81'}, {U'\x2c82', U'\x2c83'},
-    {U'\x2c84', U'\x2c85'}, {U'\x2c86', U'\x2c87'}, {U'\x2c88', U'\x2c89'}, {U'\x2c8a', U'\x2c8b'},
-    {U'\x2c8c', U'\x2c8d'}, {U'\x2c8e', U'\x2c8f'}, {U'\x2c90', U'\x2c91'}, {U'\x2c92', U'\x2c93'},
-    {U'\x2c94', U'\x2c95'}, {U'\x2c96', U'\x2c97'}, {U'\x2c98', U'\x2c99'}, {U'\x2c9a', U'\x2c9b'},
-    {U'\x2c9c', U'\x2c9d'}, {U'\x2c9e', U'\x2c9f'}, {U'\x2ca0', U'\x2ca1'}, {U'\x2ca2', U'\x2ca3'},
-    {U'\x2ca4', U'\x2ca5'}, {U'\x2ca6', U'\x2ca7'}, {U'\x2ca8', U'\x2ca9'}, {U'\x2caa', U'\x2cab'},
-    {U'\x2cac', U'\x2cad'}, {U'\x2cae', U'\x2caf'}, {U'\x2cb0', U'\x2cb1'}, {U'\x2cb2', U'\x2cb3'},
-    {U'\x2cb4', U'\x2cb5'}, {U'\x2cb6', U'\x2cb7'}, {U'\x2cb8', U'\x2cb9'}, {U'\x2cba', U'\x2cbb'},
-    {U'\x2cbc', U'\x2cbd'}, {U'\x2cbe', U'\x2cbf'}, {U'\x2cc0', U'\x2cc1'}, {U'\x2cc2', U'\x2cc3'},
-    {U'\x2cc4', U'\x2cc5'}, {U'\x2cc6', U'\x2cc7'}, {U'\x2cc8', U'\x2cc9'}, {U'\x2cca', U'\x2ccb'},
-    {U'\x2ccc', U'\x2ccd'}, {U'\x2cce', U'\x2ccf'}, {U'\x2cd0', U'\x2cd1'}, {U'\x2cd2', U'\x2cd3'},
-    {U'\x2cd4', U'\x2cd5'}, {U'\x2cd6', U'\x2cd7'}, {U'\x2cd8', U'\x2cd9'}, {U'\x2cda', U'\x2cdb'},
-    {U'\x2cdc', U'\x2cdd'}, {U'\x2cde', U'\x2cdf'}, {U'\x2ce0', U'\x2ce1'}, {U'\x2ce2', U'\x2ce3'},
-    {U'\x2ceb', U'\x2cec'}, {U'\x2ced', U'\x2cee'}, {U'\x2cf2', U'\x2cf3'}, {U'\x2d6f', U'\x2d61'},
-    {U'\x2e9f', U'\x6bcd'}, {U'\x2ef3', U'\x9f9f'}, {U'\x2f00', U'\x4e00'}, {U'\x2f01', U'\x4e28'},
-    {U'\x2f02', U'\x4e36'}, {U'\x2f03', U'\x4e3f'}, {U'\x2f04', U'\x4e59'}, {U'\x2f05', U'\x4e85'},
-    {U'\x2f06', U'\x4e8c'}, {U'\x2f07', U'\x4ea0'}, {U'\x2f08', U'\x4eba'}, {U'\x2f09', U'\x513f'},
-    {U'\x2f0a', U'\x5165'}, {U'\x2f0b', U'\x516b'}, {U'\x2f0c', U'\x5182'}, {U'\x2f0d', U'\x5196'},
-    {U'\x2f0e', U'\x51ab'}, {U'\x2f0f', U'\x51e0'}, {U'\x2f10', U'\x51f5'}, {U'\x2f11', U'\x5200'},
-    {U'\x2f12', U'\x529b'}, {U'\x2f13', U'\x52f9'}, {U'\x2f14', U'\x5315'}, {U'\x2f15', U'\x531a'},
-    {U'\x2f16', U'\x5338'}, {U'\x2f17', U'\x5341'}, {U'\x2f18', U'\x535c'}, {U'\x2f19', U'\x5369'},
-    {U'\x2f1a', U'\x5382'}, {U'\x2f1b', U'\x53b6'}, {U'\x2f1c', U'\x53c8'}, {U'\x2f1d', U'\x53e3'},
-    {U'\x2f1e', U'\x56d7'}, {U'\x2f1f', U'\x571f'}, {U'\x2f20', U'\x58eb'}, {U'\x2f21', U'\x5902'},
-    {U'\x2f22', U'\x590a'}, {U'\x2f23', U'\x5915'}, {U'\x2f24', U'\x5927'}, {U'\x2f25', U'\x5973'},
-    {U'\x2f26', U'\x5b50'}, {U'\x2f27', U'\x5b80'}, {U'\x2f28', U'\x5bf8'}, {U'\x2f29', U'\x5c0f'},
-    {U'\x2f2a', U'\x5c22'}, {U'\x2f2b', U'\x5c38'}, {U'\x2f2c', U'\x5c6e'}, {U'\x2f2d', U'\x5c71'},
-    {U'\x2f2e', U'\x5ddb'}, {U'\x2f2f', U'\x5de5'}, {U'\x2f30', U'\x5df1'}, {U'\x2f31', U'\x5dfe'},
-    {U'\x2f32', U'\x5e72'}, {U'\x2f33', U'\x5e7a'}, {U'\x2f34', U'\x5e7f'}, {U'\x2f35', U'\x5ef4'},
-    {U'\x2f36', U'\x5efe'}, {U'\x2f37', U'\x5f0b'}, {U'\x2f38', U'\x5f13'}, {U'\x2f39', U'\x5f50'},
-    {U'\x2f3a', U'\x5f61'}, {U'\x2f3b', U'\x5f73'}, {U'\x2f3c', U'\x5fc3'}, {U'\x2f3d', U'\x6208'},
-    {U'\x2f3e', U'\x6236'}, {U'\x2f3f', U'\x624b'}, {U'\x2f40', U'\x652f'}, {U'\x2f41', U'\x6534'},
-    {U'\x2f42', U'\x6587'}, {U'\x2f43', U'\x6597'}, {U'\x2f44', U'\x65a4'}, {U'\x2f45', U'\x65b9'},
-    {U'\x2f46', U'\x65e0'}, {U'\x2f47', U'\x65e5'}, {U'\x2f48', U'\x66f0'}, {U'\x2f49', U'\x6708'},
-    {U'\x2f4a', U'\x6728'}, {U'\x2f4b', U'\x6b20'}, {U'\x2f4c', U'\x6b62'}, {U'\x2f4d', U'\x6b79'},
-    {U'\x2f4e', U'\x6bb3'}, {U'\x2f4f', U'\x6bcb'}, {U'\x2f50', U'\x6bd4'}, {U'\x2f51', U'\x6bdb'},
-    {U'\x2f52', U'\x6c0f'}, {U'\x2f53', U'\x6c14'}, {U'\x2f54', U'\x6c34'}, {U'\x2f55', U'\x706b'},
-    {U'\x2f56', U'\x722a'}, {U'\x2f57', U'\x7236'}, {U'\x2f58', U'\x723b'}, {U'\x2f59', U'\x723f'},
-    {U'\x2f5a', U'\x7247'}, {U'\x2f5b', U'\x7259'}, {U'\x2f5c', U'\x725b'}, {U'\x2f5d', U'\x72ac'},
-    {U'\x2f5e', U'\x7384'}, {U'\x2f5f', U'\x7389'}, {U'\x2f60', U'\x74dc'}, {U'\x2f61', U'\x74e6'},
-    {U'\x2f62', U'\x7518'}, {U'\x2f63', U'\x751f'}, {U'\x2f64', U'\x7528'}, {U'\x2f65', U'\x7530'},
-    {U'\x2f66', U'\x758b'}, {U'\x2f67', U'\x7592'}, {U'\x2f68', U'\x7676'}, {U'\x2f69', U'\x767d'},
-    {U'\x2f6a', U'\x76ae'}, {U'\x2f6b', U'\x76bf'}, {U'\x2f6c', U'\x76ee'}, {U'\x2f6d', U'\x77db'},
-    {U'\x2f6e', U'\x77e2'}, {U'\x2f6f', U'\x77f3'}, {U'\x2f70', U'\x793a'}, {U'\x2f71', U'\x79b8'},
-    {U'\x2f72', U'\x79be'}, {U'\x2f73', U'\x7a74'}, {U'\x2f74', U'\x7acb'}, {U'\x2f75', U'\x7af9'},
-    {U'\x2f76', U'\x7c73'}, {U'\x2f77', U'\x7cf8'}, {U'\x2f78', U'\x7f36'}, {U'\x2f79', U'\x7f51'},
-    {U'\x2f7a', U'\x7f8a'}, {U'\x2f7b', U'\x7fbd'}, {U'\x2f7c', U'\x8001'}, {U'\x2f7d', U'\x800c'},
-    {U'\x2f7e', U'\x8012'}, {U'\x2f7f', U'\x8033'}, {U'\x2f80', U'\x807f'}, {U'\x2f81', U'\x8089'},
-    {U'\x2f82', U'\x81e3'}, {U'\x2f83', U'\x81ea'}, {U'\x2f84', U'\x81f3'}, {U'\x2f85', U'\x81fc'},
-    {U'\x2f86', U'\x820c'}, {U'\x2f87', U'\x821b'}, {U'\x2f88', U'\x821f'}, {U'\x2f89', U'\x826e'},
-    {U'\x2f8a', U'\x8272'}, {U'\x2f8b', U'\x8278'}, {U'\x2f8c', U'\x864d'}, {U'\x2f8d', U'\x866b'},
-    {U'\x2f8e', U'\x8840'}, {U'\x2f8f', U'\x884c'}, {U'\x2f90', U'\x8863'}, {U'\x2f91', U'\x897e'},
-    {U'\x2f92', U'\x898b'}, {U'\x2f93', U'\x89d2'}, {U'\x2f94', U'\x8a00'}, {U'\x2f95', U'\x8c37'},
-    {U'\x2f96', U'\x8c46'}, {U'\x2f97', U'\x8c55'}, {U'\x2f98', U'\x8c78'}, {U'\x2f99', U'\x8c9d'},
-    {U'\x2f9a', U'\x8d64'}, {U'\x2f9b', U'\x8d70'}, {U'\x2f9c', U'\x8db3'}, {U'\x2f9d', U'\x8eab'},
-    {U'\x2f9e', U'\x8eca'}, {U'\x2f9f', U'\x8f9b'}, {U'\x2fa0', U'\x8fb0'}, {U'\x2fa1', U'\x8fb5'},
-    {U'\x2fa2', U'\x9091'}, {U'\x2fa3', U'\x9149'}, {U'\x2fa4', U'\x91c6'}, {U'\x2fa5', U'\x91cc'},
-    {U'\x2fa6', U'\x91d1'}, {U'\x2fa7', U'\x9577'}, {U'\x2fa8', U'\x9580'}, {U'\x2fa9', U'\x961c'},
-    {U'\x2faa', U'\x96b6'}, {U'\x2fab', U'\x96b9'}, {U'\x2fac', U'\x96e8'}, {U'\x2fad', U'\x9751'},
-    {U'\x2fae', U'\x975e'}, {U'\x2faf', U'\x9762'}, {U'\x2fb0', U'\x9769'}, {U'\x2fb1', U'\x97cb'},
-    {U'\x2fb2', U'\x97ed'}, {U'\x2fb3', U'\x97f3'}, {U'\x2fb4', U'\x9801'}, {U'\x2fb5', U'\x98a8'},
-    {U'\x2fb6', U'\x98db'}, {U'\x2fb7', U'\x98df'}, {U'\x2fb8', U'\x9996'}, {U'\x2fb9', U'\x9999'},
-    {U'\x2fba', U'\x99ac'}, {U'\x2fbb', U'\x9aa8'}, {U'\x2fbc', U'\x9ad8'}, {U'\x2fbd', U'\x9adf'},
-    {U'\x2fbe', U'\x9b25'}, {U'\x2fbf', U'\x9b2f'}, {U'\x2fc0', U'\x9b32'}, {U'\x2fc1', U'\x9b3c'},
-    {U'\x2fc2', U'\x9b5a'}, {U'\x2fc3', U'\x9ce5'}, {U'\x2fc4', U'\x9e75'}, {U'\x2fc5', U'\x9e7f'},
-    {U'\x2fc6', U'\x9ea5'}, {U'\x2fc7', U'\x9ebb'}, {U'\x2fc8', U'\x9ec3'}, {U'\x2fc9', U'\x9ecd'},
-    {U'\x2fca', U'\x9ed1'}, {U'\x2fcb', U'\x9ef9'}, {U'\x2fcc', U'\x9efd'}, {U'\x2fcd', U'\x9f0e'},
-    {U'\x2fce', U'\x9f13'}, {U'\x2fcf', U'\x9f20'}, {U'\x2fd0', U'\x9f3b'}, {U'\x2fd1', U'\x9f4a'},
-    {U'\x2fd2', U'\x9f52'}, {U'\x2fd3', U'\x9f8d'}, {U'\x2fd4', U'\x9f9c'}, {U'\x2fd5', U'\x9fa0'},
-    {U'\x3000', U'\x0020'}, {U'\x3002', U'\x002e'}, {U'\x3036', U'\x3012'}, {U'\x3038', U'\x5341'},
-    {U'\x3039', U'\x5344'}, {U'\x303a', U'\x5345'}, {U'\x309b', U'\x0020'}, {U'\x309c', U'\x0020'},
-    {U'\x309f', U'\x3088'}, {U'\x30ff', U'\x30b3'}, {U'\x3131', U'\x1100'}, {U'\x3132', U'\x1101'},
-    {U'\x3133', U'\x11aa'}, {U'\x3134', U'\x1102'}, {U'\x3135', U'\x11ac'}, {U'\x3136', U'\x11ad'},
-    {U'\x3137', U'\x1103'}, {U'\x3138', U'\x1104'}, {U'\x3139', U'\x1105'}, {U'\x313a', U'\x11b0'},
-    {U'\x313b', U'\x11b1'}, {U'\x313c', U'\x11b2'}, {U'\x313d', U'\x11b3'}, {U'\x313e', U'\x11b4'},
-    {U'\x313f', U'\x11b5'}, {U'\x3140', U'\x111a'}, {U'\x3141', U'\x1106'}, {U'\x3142', U'\x1107'},
-    {U'\x3143', U'\x1108'}, {U'\x3144', U'\x1121'}, {U'\x3145', U'\x1109'}, {U'\x3146', U'\x110a'},
-    {U'\x3147', U'\x110b'}, {U'\x3148', U'\x110c'}, {U'\x3149', U'\x110d'}, {U'\x314a', U'\x110e'},
-    {U'\x314b', U'\x110f'}, {U'\x314c', U'\x1110'}, {U'\x314d', U'\x1111'}, {U'\x314e', U'\x1112'},
-    {U'\x314f', U'\x1161'}, {U'\x3150', U'\x1162'}, {U'\x3151', U'\x1163'}, {U'\x3152', U'\x1164'},
-    {U'\x3153', U'\x1165'}, {U'\x3154', U'\x1166'}, {U'\x3155', U'\x1167'}, {U'\x3156', U'\x1168'},
-    {U'\x3157', U'\x1169'}, {U'\x3158', U'\x116a'}, {U'\x3159', U'\x116b'}, {U'\x315a', U'\x116c'},
-    {U'\x315b', U'\x116d'}, {U'\x315c', U'\x116e'}, {U'\x315d', U'\x116f'}, {U'\x315e', U'\x1170'},
-    {U'\x315f', U'\x1171'}, {U'\x3160', U'\x1172'}, {U'\x3161', U'\x1173'}, {U'\x3162', U'\x1174'},
-    {U'\x3163', U'\x1175'}, {U'\x3165', U'\x1114'}, {U'\x3166', U'\x1115'}, {U'\x3167', U'\x11c7'},
-    {U'\x3168', U'\x11c8'}, {U'\x3169', U'\x11cc'}, {U'\x316a', U'\x11ce'}, {U'\x316b', U'\x11d3'},
-    {U'\x316c', U'\x11d7'}, {U'\x316d', U'\x11d9'}, {U'\x316e', U'\x111c'}, {U'\x316f', U'\x11dd'},
-    {U'\x3170', U'\x11df'}, {U'\x3171', U'\x111d'}, {U'\x3172', U'\x111e'}, {U'\x3173', U'\x1120'},
-    {U'\x3174', U'\x1122'}, {U'\x3175', U'\x1123'}, {U'\x3176', U'\x1127'}, {U'\x3177', U'\x1129'},
-    {U'\x3178', U'\x112b'}, {U'\x3179', U'\x112c'}, {U'\x317a', U'\x112d'}, {U'\x317b', U'\x112e'},
-    {U'\x317c', U'\x112f'}, {U'\x317d', U'\x1132'}, {U'\x317e', U'\x1136'}, {U'\x317f', U'\x1140'},
-    {U'\x3180', U'\x1147'}, {U'\x3181', U'\x114c'}, {U'\x3182', U'\x11f1'}, {U'\x3183', U'\x11f2'},
-    {U'\x3184', U'\x1157'}, {U'\x3185', U'\x1158'}, {U'\x3186', U'\x1159'}, {U'\x3187', U'\x1184'},
-    {U'\x3188', U'\x1185'}, {U'\x3189', U'\x1188'}, {U'\x318a', U'\x1191'}, {U'\x318b', U'\x1192'},
-    {U'\x318c', U'\x1194'}, {U'\x318d', U'\x119e'}, {U'\x318e', U'\x11a1'}, {U'\x3192', U'\x4e00'},
-    {U'\x3193', U'\x4e8c'}, {U'\x3194', U'\x4e09'}, {U'\x3195', U'\x56db'}, {U'\x3196', U'\x4e0a'},
-    {U'\x3197', U'\x4e2d'}, {U'\x3198', U'\x4e0b'}, {U'\x3199', U'\x7532'}, {U'\x319a', U'\x4e59'},
-    {U'\x319b', U'\x4e19'}, {U'\x319c', U'\x4e01'}, {U'\x319d', U'\x5929'}, {U'\x319e', U'\x5730'},
-    {U'\x319f', U'\x4eba'}, {U'\x3200', U'\x0028'}, {U'\x3201', U'\x0028'}, {U'\x3202', U'\x0028'},
-    {U'\x3203', U'\x0028'}, {U'\x3204', U'\x0028'}, {U'\x3205', U'\x0028'}, {U'\x3206', U'\x0028'},
-    {U'\x3207', U'\x0028'}, {U'\x3208', U'\x0028'}, {U'\x3209', U'\x0028'}, {U'\x320a', U'\x0028'},
-    {U'\x320b', U'\x0028'}, {U'\x320c', U'\x0028'}, {U'\x320d', U'\x0028'}, {U'\x320e', U'\x0028'},
-    {U'\x320f', U'\x0028'}, {U'\x3210', U'\x0028'}, {U'\x3211', U'\x0028'}, {U'\x3212', U'\x0028'},
-    {U'\x3213', U'\x0028'}, {U'\x3214', U'\x0028'}, {U'\x3215', U'\x0028'}, {U'\x3216', U'\x0028'},
-    {U'\x3217', U'\x0028'}, {U'\x3218', U'\x0028'}, {U'\x3219', U'\x0028'}, {U'\x321a', U'\x0028'},
-    {U'\x321b', U'\x0028'}, {U'\x321c', U'\x0028'}, {U'\x321d', U'\x0028'}, {U'\x321e', U'\x0028'},
-    {U'\x3220', U'\x0028'}, {U'\x3221', U'\x0028'}, {U'\x3222', U'\x0028'}, {U'\x3223', U'\x0028'},
-    {U'\x3224', U'\x0028'}, {U'\x3225', U'\x0028'}, {U'\x3226', U'\x0028'}, {U'\x3227', U'\x0028'},
-    {U'\x3228', U'\x0028'}, {U'\x3229', U'\x0028'}, {U'\x322a', U'\x0028'}, {U'\x322b', U'\x0028'},
-    {U'\x322c', U'\x0028'}, {U'\x322d', U'\x0028'}, {U'\x322e', U'\x0028'}, {U'\x322f', U'\x0028'},
-    {U'\x3230', U'\x0028'}, {U'\x3231', U'\x0028'}, {U'\x3232', U'\x0028'}, {U'\x3233', U'\x0028'},
-    {U'\x3234', U'\x0028'}, {U'\x3235', U'\x0028'}, {U'\x3236', U'\x0028'}, {U'\x3237', U'\x0028'},
-    {U'\x3238', U'\x0028'}, {U'\x3239', U'\x0028'}, {U'\x323a', U'\x0028'}, {U'\x323b', U'\x0028'},
-    {U'\x323c', U'\x0028'}, {U'\x323d', U'\x0028'}, {U'\x323e', U'\x0028'}, {U'\x323f', U'\x0028'},
-    {U'\x3240', U'\x0028'}, {U'\x3241', U'\x0028'}, {U'\x3242', U'\x0028'}, {U'\x3243', U'\x0028'},
-    {U'\x3244', U'\x554f'}, {U'\x3245', U'\x5e7c'}, {U'\x3246', U'\x6587'}, {U'\x3247', U'\x7b8f'},
-    {U'\x3250', U'\x0070'}, {U'\x3251', U'\x0032'}, {U'\x3252', U'\x0032'}, {U'\x3253', U'\x0032'},
-    {U'\x3254', U'\x0032'}, {U'\x3255', U'\x0032'}, {U'\x3256', U'\x0032'}, {U'\x3257', U'\x0032'},
-    {U'\x3258', U'\x0032'}, {U'\x3259', U'\x0032'}, {U'\x325a', U'\x0033'}, {U'\x325b', U'\x0033'},
-    {U'\x325c', U'\x0033'}, {U'\x325d', U'\x0033'}, {U'\x325e', U'\x0033'}, {U'\x325f', U'\x0033'},
-    {U'\x3260', U'\x1100'}, {U'\x3261', U'\x1102'}, {U'\x3262', U'\x1103'}, {U'\x3263', U'\x1105'},
-    {U'\x3264', U'\x1106'}, {U'\x3265', U'\x1107'}, {U'\x3266', U'\x1109'}, {U'\x3267', U'\x110b'},
-    {U'\x3268', U'\x110c'}, {U'\x3269', U'\x110e'}, {U'\x326a', U'\x110f'}, {U'\x326b', U'\x1110'},
-    {U'\x326c', U'\x1111'}, {U'\x326d', U'\x1112'}, {U'\x326e', U'\xac00'}, {U'\x326f', U'\xb098'},
-    {U'\x3270', U'\xb2e4'}, {U'\x3271', U'\xb77c'}, {U'\x3272', U'\xb9c8'}, {U'\x3273', U'\xbc14'},
-    {U'\x3274', U'\xc0ac'}, {U'\x3275', U'\xc544'}, {U'\x3276', U'\xc790'}, {U'\x3277', U'\xcc28'},
-    {U'\x3278', U'\xce74'}, {U'\x3279', U'\xd0c0'}, {U'\x327a', U'\xd30c'}, {U'\x327b', U'\xd558'},
-    {U'\x327c', U'\xcc38'}, {U'\x327d', U'\xc8fc'}, {U'\x327e', U'\xc6b0'}, {U'\x3280', U'\x4e00'},
-    {U'\x3281', U'\x4e8c'}, {U'\x3282', U'\x4e09'}, {U'\x3283', U'\x56db'}, {U'\x3284', U'\x4e94'},
-    {U'\x3285', U'\x516d'}, {U'\x3286', U'\x4e03'}, {U'\x3287', U'\x516b'}, {U'\x3288', U'\x4e5d'},
-    {U'\x3289', U'\x5341'}, {U'\x328a', U'\x6708'}, {U'\x328b', U'\x706b'}, {U'\x328c', U'\x6c34'},
-    {U'\x328d', U'\x6728'}, {U'\x328e', U'\x91d1'}, {U'\x328f', U'\x571f'}, {U'\x3290', U'\x65e5'},
-    {U'\x3291', U'\x682a'}, {U'\x3292', U'\x6709'}, {U'\x3293', U'\x793e'}, {U'\x3294', U'\x540d'},
-    {U'\x3295', U'\x7279'}, {U'\x3296', U'\x8ca1'}, {U'\x3297', U'\x795d'}, {U'\x3298', U'\x52b4'},
-    {U'\x3299', U'\x79d8'}, {U'\x329a', U'\x7537'}, {U'\x329b', U'\x5973'}, {U'\x329c', U'\x9069'},
-    {U'\x329d', U'\x512a'}, {U'\x329e', U'\x5370'}, {U'\x329f', U'\x6ce8'}, {U'\x32a0', U'\x9805'},
-    {U'\x32a1', U'\x4f11'}, {U'\x32a2', U'\x5199'}, {U'\x32a3', U'\x6b63'}, {U'\x32a4', U'\x4e0a'},
-    {U'\x32a5', U'\x4e2d'}, {U'\x32a6', U'\x4e0b'}, {U'\x32a7', U'\x5de6'}, {U'\x32a8', U'\x53f3'},
-    {U'\x32a9', U'\x533b'}, {U'\x32aa', U'\x5b97'}, {U'\x32ab', U'\x5b66'}, {U'\x32ac', U'\x76e3'},
-    {U'\x32ad', U'\x4f01'}, {U'\x32ae', U'\x8cc7'}, {U'\x32af', U'\x5354'}, {U'\x32b0', U'\x591c'},
-    {U'\x32b1', U'\x0033'}, {U'\x32b2', U'\x0033'}, {U'\x32b3', U'\x0033'}, {U'\x32b4', U'\x0033'},
-    {U'\x32b5', U'\x0034'}, {U'\x32b6', U'\x0034'}, {U'\x32b7', U'\x0034'}, {U'\x32b8', U'\x0034'},
-    {U'\x32b9', U'\x0034'}, {U'\x32ba', U'\x0034'}, {U'\x32bb', U'\x0034'}, {U'\x32bc', U'\x0034'},
-    {U'\x32bd', U'\x0034'}, {U'\x32be', U'\x0034'}, {U'\x32bf', U'\x0035'}, {U'\x32c0', U'\x0031'},
-    {U'\x32c1', U'\x0032'}, {U'\x32c2', U'\x0033'}, {U'\x32c3', U'\x0034'}, {U'\x32c4', U'\x0035'},
-    {U'\x32c5', U'\x0036'}, {U'\x32c6', U'\x0037'}, {U'\x32c7', U'\x0038'}, {U'\x32c8', U'\x0039'},
-    {U'\x32c9', U'\x0031'}, {U'\x32ca', U'\x0031'}, {U'\x32cb', U'\x0031'}, {U'\x32cc', U'\x0068'},
-    {U'\x32cd', U'\x0065'}, {U'\x32ce', U'\x0065'}, {U'\x32cf', U'\x006c'}, {U'\x32d0', U'\x30a2'},
-    {U'\x32d1', U'\x30a4'}, {U'\x32d2', U'\x30a6'}, {U'\x32d3', U'\x30a8'}, {U'\x32d4', U'\x30aa'},
-    {U'\x32d5', U'\x30ab'}, {U'\x32d6', U'\x30ad'}, {U'\x32d7', U'\x30af'}, {U'\x32d8', U'\x30b1'},
-    {U'\x32d9', U'\x30b3'}, {U'\x32da', U'\x30b5'}, {U'\x32db', U'\x30b7'}, {U'\x32dc', U'\x30b9'},
-    {U'\x32dd', U'\x30bb'}, {U'\x32de', U'\x30bd'}, {U'\x32df', U'\x30bf'}, {U'\x32e0', U'\x30c1'},
-    {U'\x32e1', U'\x30c4'}, {U'\x32e2', U'\x30c6'}, {U'\x32e3', U'\x30c8'}, {U'\x32e4', U'\x30ca'},
-    {U'\x32e5', U'\x30cb'}, {U'\x32e6', U'\x30cc'}, {U'\x32e7', U'\x30cd'}, {U'\x32e8', U'\x30ce'},
-    {U'\x32e9', U'\x30cf'}, {U'\x32ea', U'\x30d2'}, {U'\x32eb', U'\x30d5'}, {U'\x32ec', U'\x30d8'},
-    {U'\x32ed', U'\x30db'}, {U'\x32ee', U'\x30de'}, {U'\x32ef', U'\x30df'}, {U'\x32f0', U'\x30e0'},
-    {U'\x32f1', U'\x30e1'}, {U'\x32f2', U'\x30e2'}, {U'\x32f3', U'\x30e4'}, {U'\x32f4', U'\x30e6'},
-    {U'\x32f5', U'\x30e8'}, {U'\x32f6', U'\x30e9'}, {U'\x32f7', U'\x30ea'}, {U'\x32f8', U'\x30eb'},
-    {U'\x32f9', U'\x30ec'}, {U'\x32fa', U'\x30ed'}, {U'\x32fb', U'\x30ef'}, {U'\x32fc', U'\x30f0'},
-    {U'\x32fd', U'\x30f1'}, {U'\x32fe', U'\x30f2'}, {U'\x32ff', U'\x4ee4'}, {U'\x3300', U'\x30a2'},
-    {U'\x3301', U'\x30a2'}, {U'\x3302', U'\x30a2'}, {U'\x3303', U'\x30a2'}, {U'\x3304', U'\x30a4'},
-    {U'\x3305', U'\x30a4'}, {U'\x3306', U'\x30a6'}, {U'\x3307', U'\x30a8'}, {U'\x3308', U'\x30a8'},
-    {U'\x3309', U'\x30aa'}, {U'\x330a', U'\x30aa'}, {U'\x330b', U'\x30ab'}, {U'\x330c', U'\x30ab'},
-    {U'\x330d', U'\x30ab'}, {U'\x330e', U'\x30ac'}, {U'\x330f', U'\x30ac'}, {U'\x3310', U'\x30ae'},
-    {U'\x3311', U'\x30ae'}, {U'\x3312', U'\x30ad'}, {U'\x3313', U'\x30ae'}, {U'\x3314', U'\x30ad'},
-    {U'\x3315', U'\x30ad'}, {U'\x3316', U'\x30ad'}, {U'\x3317', U'\x30ad'}, {U'\x3318', U'\x30b0'},
-    {U'\x3319', U'\x30b0'}, {U'\x331a', U'\x30af'}, {U'\x331b', U'\x30af'}, {U'\x331c', U'\x30b1'},
-    {U'\x331d', U'\x30b3'}, {U'\x331e', U'\x30b3'}, {U'\x331f', U'\x30b5'}, {U'\x3320', U'\x30b5'},
-    {U'\x3321', U'\x30b7'}, {U'\x3322', U'\x30bb'}, {U'\x3323', U'\x30bb'}, {U'\x3324', U'\x30c0'},
-    {U'\x3325', U'\x30c7'}, {U'\x3326', U'\x30c9'}, {U'\x3327', U'\x30c8'}, {U'\x3328', U'\x30ca'},
-    {U'\x3329', U'\x30ce'}, {U'\x332a', U'\x30cf'}, {U'\x332b', U'\x30d1'}, {U'\x332c', U'\x30d1'},
-    {U'\x332d', U'\x30d0'}, {U'\x332e', U'\x30d4'}, {U'\x332f', U'\x30d4'}, {U'\x3330', U'\x30d4'},
-    {U'\x3331', U'\x30d3'}, {U'\x3332', U'\x30d5'}, {U'\x3333', U'\x30d5'}, {U'\x3334', U'\x30d6'},
-    {U'\x3335', U'\x30d5'}, {U'\x3336', U'\x30d8'}, {U'\x3337', U'\x30da'}, {U'\x3338', U'\x30da'},
-    {U'\x3339', U'\x30d8'}, {U'\x333a', U'\x30da'}, {U'\x333b', U'\x30da'}, {U'\x333c', U'\x30d9'},
-    {U'\x333d', U'\x30dd'}, {U'\x333e', U'\x30dc'}, {U'\x333f', U'\x30db'}, {U'\x3340', U'\x30dd'},
-    {U'\x3341', U'\x30db'}, {U'\x3342', U'\x30db'}, {U'\x3343', U'\x30de'}, {U'\x3344', U'\x30de'},
-    {U'\x3345', U'\x30de'}, {U'\x3346', U'\x30de'}, {U'\x3347', U'\x30de'}, {U'\x3348', U'\x30df'},
-    {U'\x3349', U'\x30df'}, {U'\x334a', U'\x30df'}, {U'\x334b', U'\x30e1'}, {U'\x334c', U'\x30e1'},
-    {U'\x334d', U'\x30e1'}, {U'\x334e', U'\x30e4'}, {U'\x334f', U'\x30e4'}, {U'\x3350', U'\x30e6'},
-    {U'\x3351', U'\x30ea'}, {U'\x3352', U'\x30ea'}, {U'\x3353', U'\x30eb'}, {U'\x3354', U'\x30eb'},
-    {U'\x3355', U'\x30ec'}, {U'\x3356', U'\x30ec'}, {U'\x3357', U'\x30ef'}, {U'\x3358', U'\x0030'},
-    {U'\x3359', U'\x0031'}, {U'\x335a', U'\x0032'}, {U'\x335b', U'\x0033'}, {U'\x335c', U'\x0034'},
-    {U'\x335d', U'\x0035'}, {U'\x335e', U'\x0036'}, {U'\x335f', U'\x0037'}, {U'\x3360', U'\x0038'},
-    {U'\x3361', U'\x0039'}, {U'\x3362', U'\x0031'}, {U'\x3363', U'\x0031'}, {U'\x3364', U'\x0031'},
-    {U'\x3365', U'\x0031'}, {U'\x3366', U'\x0031'}, {U'\x3367', U'\x0031'}, {U'\x3368', U'\x0031'},
-    {U'\x3369', U'\x0031'}, {U'\x336a', U'\x0031'}, {U'\x336b', U'\x0031'}, {U'\x336c', U'\x0032'},
-    {U'\x336d', U'\x0032'}, {U'\x336e', U'\x0032'}, {U'\x336f', U'\x0032'}, {U'\x3370', U'\x0032'},
-    {U'\x3371', U'\x0068'}, {U'\x3372', U'\x0064'}, {U'\x3373', U'\x0061'}, {U'\x3374', U'\x0062'},
-    {U'\x3375', U'\x006f'}, {U'\x3376', U'\x0070'}, {U'\x3377', U'\x0064'}, {U'\x3378', U'\x0064'},
-    {U'\x3379', U'\x0064'}, {U'\x337a', U'\x0069'}, {U'\x337b', U'\x5e73'}, {U'\x337c', U'\x662d'},
-    {U'\x337d', U'\x5927'}, {U'\x337e', U'\x660e'}, {U'\x337f', U'\x682a'}, {U'\x3380', U'\x0070'},
-    {U'\x3381', U'\x006e'}, {U'\x3382', U'\x03bc'}, {U'\x3383', U'\x006d'}, {U'\x3384', U'\x006b'},
-    {U'\x3385', U'\x006b'}, {U'\x3386', U'\x006d'}, {U'\x3387', U'\x0067'}, {U'\x3388', U'\x0063'},
-    {U'\x3389', U'\x006b'}, {U'\x338a', U'\x0070'}, {U'\x338b', U'\x006e'}, {U'\x338c', U'\x03bc'},
-    {U'\x338d', U'\x03bc'}, {U'\x338e', U'\x006d'}, {U'\x338f', U'\x006b'}, {U'\x3390', U'\x0068'},
-    {U'\x3391', U'\x006b'}, {U'\x3392', U'\x006d'}, {U'\x3393', U'\x0067'}, {U'\x3394', U'\x0074'},
-    {U'\x3395', U'\x03bc'}, {U'\x3396', U'\x006d'}, {U'\x3397', U'\x0064'}, {U'\x3398', U'\x006b'},
-    {U'\x3399', U'\x0066'}, {U'\x339a', U'\x006e'}, {U'\x339b', U'\x03bc'}, {U'\x339c', U'\x006d'},
-    {U'\x339d', U'\x0063'}, {U'\x339e', U'\x006b'}, {U'\x339f', U'\x006d'}, {U'\x33a0', U'\x0063'},
-    {U'\x33a1', U'\x006d'}, {U'\x33a2', U'\x006b'}, {U'\x33a3', U'\x006d'}, {U'\x33a4', U'\x0063'},
-    {U'\x33a5', U'\x006d'}, {U'\x33a6', U'\x006b'}, {U'\x33a7', U'\x006d'}, {U'\x33a8', U'\x006d'},
-    {U'\x33a9', U'\x0070'}, {U'\x33aa', U'\x006b'}, {U'\x33ab', U'\x006d'}, {U'\x33ac', U'\x0067'},
-    {U'\x33ad', U'\x0072'}, {U'\x33ae', U'\x0072'}, {U'\x33af', U'\x0072'}, {U'\x33b0', U'\x0070'},
-    {U'\x33b1', U'\x006e'}, {U'\x33b2', U'\x03bc'}, {U'\x33b3', U'\x006d'}, {U'\x33b4', U'\x0070'},
-    {U'\x33b5', U'\x006e'}, {U'\x33b6', U'\x03bc'}, {U'\x33b7', U'\x006d'}, {U'\x33b8', U'\x006b'},
-    {U'\x33b9', U'\x006d'}, {U'\x33ba', U'\x0070'}, {U'\x33bb', U'\x006e'}, {U'\x33bc', U'\x03bc'},
-    {U'\x33bd', U'\x006d'}, {U'\x33be', U'\x006b'}, {U'\x33bf', U'\x006d'}, {U'\x33c0', U'\x006b'},
-    {U'\x33c1', U'\x006d'}, {U'\x33c3', U'\x0062'}, {U'\x33c4', U'\x0063'}, {U'\x33c5', U'\x0063'},
-    {U'\x33c6', U'\x0063'}, {U'\x33c8', U'\x0064'}, {U'\x33c9', U'\x0067'}, {U'\x33ca', U'\x0068'},
-    {U'\x33cb', U'\x0068'}, {U'\x33cc', U'\x0069'}, {U'\x33cd', U'\x006b'}, {U'\x33ce', U'\x006b'},
-    {U'\x33cf', U'\x006b'}, {U'\x33d0', U'\x006c'}, {U'\x33d1', U'\x006c'}, {U'\x33d2', U'\x006c'},
-    {U'\x33d3', U'\x006c'}, {U'\x33d4', U'\x006d'}, {U'\x33d5', U'\x006d'}, {U'\x33d6', U'\x006d'},
-    {U'\x33d7', U'\x0070'}, {U'\x33d9', U'\x0070'}, {U'\x33da', U'\x0070'}, {U'\x33db', U'\x0073'},
-    {U'\x33dc', U'\x0073'}, {U'\x33dd', U'\x0077'}, {U'\x33de', U'\x0076'}, {U'\x33df', U'\x0061'},
-    {U'\x33e0', U'\x0031'}, {U'\x33e1', U'\x0032'}, {U'\x33e2', U'\x0033'}, {U'\x33e3', U'\x0034'},
-    {U'\x33e4', U'\x0035'}, {U'\x33e5', U'\x0036'}, {U'\x33e6', U'\x0037'}, {U'\x33e7', U'\x0038'},
-    {U'\x33e8', U'\x0039'}, {U'\x33e9', U'\x0031'}, {U'\x33ea', U'\x0031'}, {U'\x33eb', U'\x0031'},
-    {U'\x33ec', U'\x0031'}, {U'\x33ed', U'\x0031'}, {U'\x33ee', U'\x0031'}, {U'\x33ef', U'\x0031'},
-    {U'\x33f0', U'\x0031'}, {U'\x33f1', U'\x0031'}, {U'\x33f2', U'\x0031'}, {U'\x33f3', U'\x0032'},
-    {U'\x33f4', U'\x0032'}, {U'\x33f5', U'\x0032'}, {U'\x33f6', U'\x0032'}, {U'\x33f7', U'\x0032'},
-    {U'\x33f8', U'\x0032'}, {U'\x33f9', U'\x0032'}, {U'\x33fa', U'\x0032'}, {U'\x33fb', U'\x0032'},
-    {U'\x33fc', U'\x0032'}, {U'\x33fd', U'\x0033'}, {U'\x33fe', U'\x0033'}, {U'\x33ff', U'\x0067'},
-    {U'\xa640', U'\xa641'}, {U'\xa642', U'\xa643'}, {U'\xa644', U'\xa645'}, {U'\xa646', U'\xa647'},
-    {U'\xa648', U'\xa649'}, {U'\xa64a', U'\xa64b'}, {U'\xa64c', U'\xa64d'}, {U'\xa64e', U'\xa64f'},
-    {U'\xa650', U'\xa651'}, {U'\xa652', U'\xa653'}, {U'\xa654', U'\xa655'}, {U'\xa656', U'\xa657'},
-    {U'\xa658', U'\xa659'}, {U'\xa65a', U'\xa65b'}, {U'\xa65c', U'\xa65d'}, {U'\xa65e', U'\xa65f'},
-    {U'\xa660', U'\xa661'}, {U'\xa662', U'\xa663'}, {U'\xa664', U'\xa665'}, {U'\xa666', U'\xa667'},
-    {U'\xa668', U'\xa669'}, {U'\xa66a', U'\xa66b'}, {U'\xa66c', U'\xa66d'}, {U'\xa680', U'\xa681'},
-    {U'\xa682', U'\xa683'}, {U'\xa684', U'\xa685'}, {U'\xa686', U'\xa687'}, {U'\xa688', U'\xa689'},
-    {U'\xa68a', U'\xa68b'}, {U'\xa68c', U'\xa68d'}, {U'\xa68e', U'\xa68f'}, {U'\xa690', U'\xa691'},
-    {U'\xa692', U'\xa693'}, {U'\xa694', U'\xa695'}, {U'\xa696', U'\xa697'}, {U'\xa698', U'\xa699'},
-    {U'\xa69a', U'\xa69b'}, {U'\xa69c', U'\x044a'}, {U'\xa69d', U'\x044c'}, {U'\xa722', U'\xa723'},
-    {U'\xa724', U'\xa725'}, {U'\xa726', U'\xa727'}, {U'\xa728', U'\xa729'}, {U'\xa72a', U'\xa72b'},
-    {U'\xa72c', U'\xa72d'}, {U'\xa72e', U'\xa72f'}, {U'\xa732', U'\xa733'}, {U'\xa734', U'\xa735'},
-    {U'\xa736', U'\xa737'}, {U'\xa738', U'\xa739'}, {U'\xa73a', U'\xa73b'}, {U'\xa73c', U'\xa73d'},
-    {U'\xa73e', U'\xa73f'}, {U'\xa740', U'\xa741'}, {U'\xa742', U'\xa743'}, {U'\xa744', U'\xa745'},
-    {U'\xa746', U'\xa747'}, {U'\xa748', U'\xa749'}, {U'\xa74a', U'\xa74b'}, {U'\xa74c', U'\xa74d'},
-    {U'\xa74e', U'\xa74f'}, {U'\xa750', U'\xa751'}, {U'\xa752', U'\xa753'}, {U'\xa754', U'\xa755'},
-    {U'\xa756', U'\xa757'}, {U'\xa758', U'\xa759'}, {U'\xa75a', U'\xa75b'}, {U'\xa75c', U'\xa75d'},
-    {U'\xa75e', U'\xa75f'}, {U'\xa760', U'\xa761'}, {U'\xa762', U'\xa763'}, {U'\xa764', U'\xa765'},
-    {U'\xa766', U'\xa767'}, {U'\xa768', U'\xa769'}, {U'\xa76a', U'\xa76b'}, {U'\xa76c', U'\xa76d'},
-    {U'\xa76e', U'\xa76f'}, {U'\xa770', U'\xa76f'}, {U'\xa779', U'\xa77a'}, {U'\xa77b', U'\xa77c'},
-    {U'\xa77d', U'\x1d79'}, {U'\xa77e', U'\xa77f'}, {U'\xa780', U'\xa781'}, {U'\xa782', U'\xa783'},
-    {U'\xa784', U'\xa785'}, {U'\xa786', U'\xa787'}, {U'\xa78b', U'\xa78c'}, {U'\xa78d', U'\x0265'},
-    {U'\xa790', U'\xa791'}, {U'\xa792', U'\xa793'}, {U'\xa796', U'\xa797'}, {U'\xa798', U'\xa799'},
-    {U'\xa79a', U'\xa79b'}, {U'\xa79c', U'\xa79d'}, {U'\xa79e', U'\xa79f'}, {U'\xa7a0', U'\xa7a1'},
-    {U'\xa7a2', U'\xa7a3'}, {U'\xa7a4', U'\xa7a5'}, {U'\xa7a6', U'\xa7a7'}, {U'\xa7a8', U'\xa7a9'},
-    {U'\xa7aa', U'\x0266'}, {U'\xa7ab', U'\x025c'}, {U'\xa7ac', U'\x0261'}, {U'\xa7ad', U'\x026c'},
-    {U'\xa7ae', U'\x026a'}, {U'\xa7b0', U'\x029e'}, {U'\xa7b1', U'\x0287'}, {U'\xa7b2', U'\x029d'},
-    {U'\xa7b3', U'\xab53'}, {U'\xa7b4', U'\xa7b5'}, {U'\xa7b6', U'\xa7b7'}, {U'\xa7b8', U'\xa7b9'},
-    {U'\xa7ba', U'\xa7bb'}, {U'\xa7bc', U'\xa7bd'}, {U'\xa7be', U'\xa7bf'}, {U'\xa7c0', U'\xa7c1'},
-    {U'\xa7c2', U'\xa7c3'}, {U'\xa7c4', U'\xa794'}, {U'\xa7c5', U'\x0282'}, {U'\xa7c6', U'\x1d8e'},
-    {U'\xa7c7', U'\xa7c8'}, {U'\xa7c9', U'\xa7ca'}, {U'\xa7d0', U'\xa7d1'}, {U'\xa7d6', U'\xa7d7'},
-    {U'\xa7d8', U'\xa7d9'}, {U'\xa7f2', U'\x0063'}, {U'\xa7f3', U'\x0066'}, {U'\xa7f4', U'\x0071'},
-    {U'\xa7f5', U'\xa7f6'}, {U'\xa7f8', U'\x0127'}, {U'\xa7f9', U'\x0153'}, {U'\xab5c', U'\xa727'},
-    {U'\xab5d', U'\xab37'}, {U'\xab5e', U'\x026b'}, {U'\xab5f', U'\xab52'}, {U'\xab69', U'\x028d'},
-    {U'\xab70', U'\x13a0'}, {U'\xab71', U'\x13a1'}, {U'\xab72', U'\x13a2'}, {U'\xab73', U'\x13a3'},
-    {U'\xab74', U'\x13a4'}, {U'\xab75', U'\x13a5'}, {U'\xab76', U'\x13a6'}, {U'\xab77', U'\x13a7'},
-    {U'\xab78', U'\x13a8'}, {U'\xab79', U'\x13a9'}, {U'\xab7a', U'\x13aa'}, {U'\xab7b', U'\x13ab'},
-    {U'\xab7c', U'\x13ac'}, {U'\xab7d', U'\x13ad'}, {U'\xab7e', U'\x13ae'}, {U'\xab7f', U'\x13af'},
-    {U'\xab80', U'\x13b0'}, {U'\xab81', U'\x13b1'}, {U'\xab82', U'\x13b2'}, {U'\xab83', U'\x13b3'},
-    {U'\xab84', U'\x13b4'}, {U'\xab85', U'\x13b5'}, {U'\xab86', U'\x13b6'}, {U'\xab87', U'\x13b7'},
-    {U'\xab88', U'\x13b8'}, {U'\xab89', U'\x13b9'}, {U'\xab8a', U'\x13ba'}, {U'\xab8b', U'\x13bb'},
-    {U'\xab8c', U'\x13bc'}, {U'\xab8d', U'\x13bd'}, {U'\xab8e', U'\x13be'}, {U'\xab8f', U'\x13bf'},
-    {U'\xab90', U'\x13c0'}, {U'\xab91', U'\x13c1'}, {U'\xab92', U'\x13c2'}, {U'\xab93', U'\x13c3'},
-    {U'\xab94', U'\x13c4'}, {U'\xab95', U'\x13c5'}, {U'\xab96', U'\x13c6'}, {U'\xab97', U'\x13c7'},
-    {U'\xab98', U'\x13c8'}, {U'\xab99', U'\x13c9'}, {U'\xab9a', U'\x13ca'}, {U'\xab9b', U'\x13cb'},
-    {U'\xab9c', U'\x13cc'}, {U'\xab9d', U'\x13cd'}, {U'\xab9e', U'\x13ce'}, {U'\xab9f', U'\x13cf'},
-    {U'\xaba0', U'\x13d0'}, {U'\xaba1', U'\x13d1'}, {U'\xaba2', U'\x13d2'}, {U'\xaba3', U'\x13d3'},
-    {U'\xaba4', U'\x13d4'}, {U'\xaba5', U'\x13d5'}, {U'\xaba6', U'\x13d6'}, {U'\xaba7', U'\x13d7'},
-    {U'\xaba8', U'\x13d8'}, {U'\xaba9', U'\x13d9'}, {U'\xabaa', U'\x13da'}, {U'\xabab', U'\x13db'},
-    {U'\xabac', U'\x13dc'}, {U'\xabad', U'\x13dd'}, {U'\xabae', U'\x13de'}, {U'\xabaf', U'\x13df'},
-    {U'\xabb0', U'\x13e0'}, {U'\xabb1', U'\x13e1'}, {U'\xabb2', U'\x13e2'}, {U'\xabb3', U'\x13e3'},
-    {U'\xabb4', U'\x13e4'}, {U'\xabb5', U'\x13e5'}, {U'\xabb6', U'\x13e6'}, {U'\xabb7', U'\x13e7'},
-    {U'\xabb8', U'\x13e8'}, {U'\xabb9', U'\x13e9'}, {U'\xabba', U'\x13ea'}, {U'\xabbb', U'\x13eb'},
-    {U'\xabbc', U'\x13ec'}, {U'\xabbd', U'\x13ed'}, {U'\xabbe', U'\x13ee'}, {U'\xabbf', U'\x13ef'},
-    {U'\xf900', U'\x8c48'}, {U'\xf901', U'\x66f4'}, {U'\xf902', U'\x8eca'}, {U'\xf903', U'\x8cc8'},
-    {U'\xf904', U'\x6ed1'}, {U'\xf905', U'\x4e32'}, {U'\xf906', U'\x53e5'}, {U'\xf907', U'\x9f9c'},
-    {U'\xf909', U'\x5951'}, {U'\xf90a', U'\x91d1'}, {U'\xf90b', U'\x5587'}, {U'\xf90c', U'\x5948'},
-    {U'\xf90d', U'\x61f6'}, {U'\xf90e', U'\x7669'}, {U'\xf90f', U'\x7f85'}, {U'\xf910', U'\x863f'},
-    {U'\xf911', U'\x87ba'}, {U'\xf912', U'\x88f8'}, {U'\xf913', U'\x908f'}, {U'\xf914', U'\x6a02'},
-    {U'\xf915', U'\x6d1b'}, {U'\xf916', U'\x70d9'}, {U'\xf917', U'\x73de'}, {U'\xf918', U'\x843d'},
-    {U'\xf919', U'\x916a'}, {U'\xf91a', U'\x99f1'}, {U'\xf91b', U'\x4e82'}, {U'\xf91c', U'\x5375'},
-    {U'\xf91d', U'\x6b04'}, {U'\xf91e', U'\x721b'}, {U'\xf91f', U'\x862d'}, {U'\xf920', U'\x9e1e'},
-    {U'\xf921', U'\x5d50'}, {U'\xf922', U'\x6feb'}, {U'\xf923', U'\x85cd'}, {U'\xf924', U'\x8964'},
-    {U'\xf925', U'\x62c9'}, {U'\xf926', U'\x81d8'}, {U'\xf927', U'\x881f'}, {U'\xf928', U'\x5eca'},
-    {U'\xf929', U'\x6717'}, {U'\xf92a', U'\x6d6a'}, {U'\xf92b', U'\x72fc'}, {U'\xf92c', U'\x90ce'},
-    {U'\xf92d', U'\x4f86'}, {U'\xf92e', U'\x51b7'}, {U'\xf92f', U'\x52de'}, {U'\xf930', U'\x64c4'},
-    {U'\xf931', U'\x6ad3'}, {U'\xf932', U'\x7210'}, {U'\xf933', U'\x76e7'}, {U'\xf934', U'\x8001'},
-    {U'\xf935', U'\x8606'}, {U'\xf936', U'\x865c'}, {U'\xf937', U'\x8def'}, {U'\xf938', U'\x9732'},
-    {U'\xf939', U'\x9b6f'}, {U'\xf93a', U'\x9dfa'}, {U'\xf93b', U'\x788c'}, {U'\xf93c', U'\x797f'},
-    {U'\xf93d', U'\x7da0'}, {U'\xf93e', U'\x83c9'}, {U'\xf93f', U'\x9304'}, {U'\xf940', U'\x9e7f'},
-    {U'\xf941', U'\x8ad6'}, {U'\xf942', U'\x58df'}, {U'\xf943', U'\x5f04'}, {U'\xf944', U'\x7c60'},
-    {U'\xf945', U'\x807e'}, {U'\xf946', U'\x7262'}, {U'\xf947', U'\x78ca'}, {U'\xf948', U'\x8cc2'},
-    {U'\xf949', U'\x96f7'}, {U'\xf94a', U'\x58d8'}, {U'\xf94b', U'\x5c62'}, {U'\xf94c', U'\x6a13'},
-    {U'\xf94d', U'\x6dda'}, {U'\xf94e', U'\x6f0f'}, {U'\xf94f', U'\x7d2f'}, {U'\xf950', U'\x7e37'},
-    {U'\xf951', U'\x964b'}, {U'\xf952', U'\x52d2'}, {U'\xf953', U'\x808b'}, {U'\xf954', U'\x51dc'},
-    {U'\xf955', U'\x51cc'}, {U'\xf956', U'\x7a1c'}, {U'\xf957', U'\x7dbe'}, {U'\xf958', U'\x83f1'},
-    {U'\xf959', U'\x9675'}, {U'\xf95a', U'\x8b80'}, {U'\xf95b', U'\x62cf'}, {U'\xf95c', U'\x6a02'},
-    {U'\xf95d', U'\x8afe'}, {U'\xf95e', U'\x4e39'}, {U'\xf95f', U'\x5be7'}, {U'\xf960', U'\x6012'},
-    {U'\xf961', U'\x7387'}, {U'\xf962', U'\x7570'}, {U'\xf963', U'\x5317'}, {U'\xf964', U'\x78fb'},
-    {U'\xf965', U'\x4fbf'}, {U'\xf966', U'\x5fa9'}, {U'\xf967', U'\x4e0d'}, {U'\xf968', U'\x6ccc'},
-    {U'\xf969', U'\x6578'}, {U'\xf96a', U'\x7d22'}, {U'\xf96b', U'\x53c3'}, {U'\xf96c', U'\x585e'},
-    {U'\xf96d', U'\x7701'}, {U'\xf96e', U'\x8449'}, {U'\xf96f', U'\x8aaa'}, {U'\xf970', U'\x6bba'},
-    {U'\xf971', U'\x8fb0'}, {U'\xf972', U'\x6c88'}, {U'\xf973', U'\x62fe'}, {U'\xf974', U'\x82e5'},
-    {U'\xf975', U'\x63a0'}, {U'\xf976', U'\x7565'}, {U'\xf977', U'\x4eae'}, {U'\xf978', U'\x5169'},
-    {U'\xf979', U'\x51c9'}, {U'\xf97a', U'\x6881'}, {U'\xf97b', U'\x7ce7'}, {U'\xf97c', U'\x826f'},
-    {U'\xf97d', U'\x8ad2'}, {U'\xf97e', U'\x91cf'}, {U'\xf97f', U'\x52f5'}, {U'\xf980', U'\x5442'},
-    {U'\xf981', U'\x5973'}, {U'\xf982', U'\x5eec'}, {U'\xf983', U'\x65c5'}, {U'\xf984', U'\x6ffe'},
-    {U'\xf985', U'\x792a'}, {U'\xf986', U'\x95ad'}, {U'\xf987', U'\x9a6a'}, {U'\xf988', U'\x9e97'},
-    {U'\xf989', U'\x9ece'}, {U'\xf98a', U'\x529b'}, {U'\xf98b', U'\x66c6'}, {U'\xf98c', U'\x6b77'},
-    {U'\xf98d', U'\x8f62'}, {U'\xf98e', U'\x5e74'}, {U'\xf98f', U'\x6190'}, {U'\xf990', U'\x6200'},
-    {U'\xf991', U'\x649a'}, {U'\xf992', U'\x6f23'}, {U'\xf993', U'\x7149'}, {U'\xf994', U'\x7489'},
-    {U'\xf995', U'\x79ca'}, {U'\xf996', U'\x7df4'}, {U'\xf997', U'\x806f'}, {U'\xf998', U'\x8f26'},
-    {U'\xf999', U'\x84ee'}, {U'\xf99a', U'\x9023'}, {U'\xf99b', U'\x934a'}, {U'\xf99c', U'\x5217'},
-    {U'\xf99d', U'\x52a3'}, {U'\xf99e', U'\x54bd'}, {U'\xf99f', U'\x70c8'}, {U'\xf9a0', U'\x88c2'},
-    {U'\xf9a1', U'\x8aaa'}, {U'\xf9a2', U'\x5ec9'}, {U'\xf9a3', U'\x5ff5'}, {U'\xf9a4', U'\x637b'},
-    {U'\xf9a5', U'\x6bae'}, {U'\xf9a6', U'\x7c3e'}, {U'\xf9a7', U'\x7375'}, {U'\xf9a8', U'\x4ee4'},
-    {U'\xf9a9', U'\x56f9'}, {U'\xf9aa', U'\x5be7'}, {U'\xf9ab', U'\x5dba'}, {U'\xf9ac', U'\x601c'},
-    {U'\xf9ad', U'\x73b2'}, {U'\xf9ae', U'\x7469'}, {U'\xf9af', U'\x7f9a'}, {U'\xf9b0', U'\x8046'},
-    {U'\xf9b1', U'\x9234'}, {U'\xf9b2', U'\x96f6'}, {U'\xf9b3', U'\x9748'}, {U'\xf9b4', U'\x9818'},
-    {U'\xf9b5', U'\x4f8b'}, {U'\xf9b6', U'\x79ae'}, {U'\xf9b7', U'\x91b4'}, {U'\xf9b8', U'\x96b8'},
-    {U'\xf9b9', U'\x60e1'}, {U'\xf9ba', U'\x4e86'}, {U'\xf9bb', U'\x50da'}, {U'\xf9bc', U'\x5bee'},
-    {U'\xf9bd', U'\x5c3f'}, {U'\xf9be', U'\x6599'}, {U'\xf9bf', U'\x6a02'}, {U'\xf9c0', U'\x71ce'},
-    {U'\xf9c1', U'\x7642'}, {U'\xf9c2', U'\x84fc'}, {U'\xf9c3', U'\x907c'}, {U'\xf9c4', U'\x9f8d'},
-    {U'\xf9c5', U'\x6688'}, {U'\xf9c6', U'\x962e'}, {U'\xf9c7', U'\x5289'}, {U'\xf9c8', U'\x677b'},
-    {U'\xf9c9', U'\x67f3'}, {U'\xf9ca', U'\x6d41'}, {U'\xf9cb', U'\x6e9c'}, {U'\xf9cc', U'\x7409'},
-    {U'\xf9cd', U'\x7559'}, {U'\xf9ce', U'\x786b'}, {U'\xf9cf', U'\x7d10'}, {U'\xf9d0', U'\x985e'},
-    {U'\xf9d1', U'\x516d'}, {U'\xf9d2', U'\x622e'}, {U'\xf9d3', U'\x9678'}, {U'\xf9d4', U'\x502b'},
-    {U'\xf9d5', U'\x5d19'}, {U'\xf9d6', U'\x6dea'}, {U'\xf9d7', U'\x8f2a'}, {U'\xf9d8', U'\x5f8b'},
-    {U'\xf9d9', U'\x6144'}, {U'\xf9da', U'\x6817'}, {U'\xf9db', U'\x7387'}, {U'\xf9dc', U'\x9686'},
-    {U'\xf9dd', U'\x5229'}, {U'\xf9de', U'\x540f'}, {U'\xf9df', U'\x5c65'}, {U'\xf9e0', U'\x6613'},
-    {U'\xf9e1', U'\x674e'}, {U'\xf9e2', U'\x68a8'}, {U'\xf9e3', U'\x6ce5'}, {U'\xf9e4', U'\x7406'},
-    {U'\xf9e5', U'\x75e2'}, {U'\xf9e6', U'\x7f79'}, {U'\xf9e7', U'\x88cf'}, {U'\xf9e8', U'\x88e1'},
-    {U'\xf9e9', U'\x91cc'}, {U'\xf9ea', U'\x96e2'}, {U'\xf9eb', U'\x533f'}, {U'\xf9ec', U'\x6eba'},
-    {U'\xf9ed', U'\x541d'}, {U'\xf9ee', U'\x71d0'}, {U'\xf9ef', U'\x7498'}, {U'\xf9f0', U'\x85fa'},
-    {U'\xf9f1', U'\x96a3'}, {U'\xf9f2', U'\x9c57'}, {U'\xf9f3', U'\x9e9f'}, {U'\xf9f4', U'\x6797'},
-    {U'\xf9f5', U'\x6dcb'}, {U'\xf9f6', U'\x81e8'}, {U'\xf9f7', U'\x7acb'}, {U'\xf9f8', U'\x7b20'},
-    {U'\xf9f9', U'\x7c92'}, {U'\xf9fa', U'\x72c0'}, {U'\xf9fb', U'\x7099'}, {U'\xf9fc', U'\x8b58'},
-    {U'\xf9fd', U'\x4ec0'}, {U'\xf9fe', U'\x8336'}, {U'\xf9ff', U'\x523a'}, {U'\xfa00', U'\x5207'},
-    {U'\xfa01', U'\x5ea6'}, {U'\xfa02', U'\x62d3'}, {U'\xfa03', U'\x7cd6'}, {U'\xfa04', U'\x5b85'},
-    {U'\xfa05', U'\x6d1e'}, {U'\xfa06', U'\x66b4'}, {U'\xfa07', U'\x8f3b'}, {U'\xfa08', U'\x884c'},
-    {U'\xfa09', U'\x964d'}, {U'\xfa0a', U'\x898b'}, {U'\xfa0b', U'\x5ed3'}, {U'\xfa0c', U'\x5140'},
-    {U'\xfa0d', U'\x55c0'}, {U'\xfa10', U'\x585a'}, {U'\xfa12', U'\x6674'}, {U'\xfa15', U'\x51de'},
-    {U'\xfa16', U'\x732a'}, {U'\xfa17', U'\x76ca'}, {U'\xfa18', U'\x793c'}, {U'\xfa19', U'\x795e'},
-    {U'\xfa1a', U'\x7965'}, {U'\xfa1b', U'\x798f'}, {U'\xfa1c', U'\x9756'}, {U'\xfa1d', U'\x7cbe'},
-    {U'\xfa1e', U'\x7fbd'}, {U'\xfa20', U'\x8612'}, {U'\xfa22', U'\x8af8'}, {U'\xfa25', U'\x9038'},
-    {U'\xfa26', U'\x90fd'}, {U'\xfa2a', U'\x98ef'}, {U'\xfa2b', U'\x98fc'}, {U'\xfa2c', U'\x9928'},
-    {U'\xfa2d', U'\x9db4'}, {U'\xfa2e', U'\x90de'}, {U'\xfa2f', U'\x96b7'}, {U'\xfa30', U'\x4fae'},
-    {U'\xfa31', U'\x50e7'}, {U'\xfa32', U'\x514d'}, {U'\xfa33', U'\x52c9'}, {U'\xfa34', U'\x52e4'},
-    {U'\xfa35', U'\x5351'}, {U'\xfa36', U'\x559d'}, {U'\xfa37', U'\x5606'}, {U'\xfa38', U'\x5668'},
-    {U'\xfa39', U'\x5840'}, {U'\xfa3a', U'\x58a8'}, {U'\xfa3b', U'\x5c64'}, {U'\xfa3c', U'\x5c6e'},
-    {U'\xfa3d', U'\x6094'}, {U'\xfa3e', U'\x6168'}, {U'\xfa3f', U'\x618e'}, {U'\xfa40', U'\x61f2'},
-    {U'\xfa41', U'\x654f'}, {U'\xfa42', U'\x65e2'}, {U'\xfa43', U'\x6691'}, {U'\xfa44', U'\x6885'},
-    {U'\xfa45', U'\x6d77'}, {U'\xfa46', U'\x6e1a'}, {U'\xfa47', U'\x6f22'}, {U'\xfa48', U'\x716e'},
-    {U'\xfa49', U'\x722b'}, {U'\xfa4a', U'\x7422'}, {U'\xfa4b', U'\x7891'}, {U'\xfa4c', U'\x793e'},
-    {U'\xfa4d', U'\x7949'}, {U'\xfa4e', U'\x7948'}, {U'\xfa4f', U'\x7950'}, {U'\xfa50', U'\x7956'},
-    {U'\xfa51', U'\x795d'}, {U'\xfa52', U'\x798d'}, {U'\xfa53', U'\x798e'}, {U'\xfa54', U'\x7a40'},
-    {U'\xfa55', U'\x7a81'}, {U'\xfa56', U'\x7bc0'}, {U'\xfa57', U'\x7df4'}, {U'\xfa58', U'\x7e09'},
-    {U'\xfa59', U'\x7e41'}, {U'\xfa5a', U'\x7f72'}, {U'\xfa5b', U'\x8005'}, {U'\xfa5c', U'\x81ed'},
-    {U'\xfa5d', U'\x8279'}, {U'\xfa5f', U'\x8457'}, {U'\xfa60', U'\x8910'}, {U'\xfa61', U'\x8996'},
-    {U'\xfa62', U'\x8b01'}, {U'\xfa63', U'\x8b39'}, {U'\xfa64', U'\x8cd3'}, {U'\xfa65', U'\x8d08'},
-    {U'\xfa66', U'\x8fb6'}, {U'\xfa67', U'\x9038'}, {U'\xfa68', U'\x96e3'}, {U'\xfa69', U'\x97ff'},
-    {U'\xfa6a', U'\x983b'}, {U'\xfa6b', U'\x6075'}, {U'\xfa6d', U'\x8218'}, {U'\xfa70', U'\x4e26'},
-    {U'\xfa71', U'\x51b5'}, {U'\xfa72', U'\x5168'}, {U'\xfa73', U'\x4f80'}, {U'\xfa74', U'\x5145'},
-    {U'\xfa75', U'\x5180'}, {U'\xfa76', U'\x52c7'}, {U'\xfa77', U'\x52fa'}, {U'\xfa78', U'\x559d'},
-    {U'\xfa79', U'\x5555'}, {U'\xfa7a', U'\x5599'}, {U'\xfa7b', U'\x55e2'}, {U'\xfa7c', U'\x585a'},
-    {U'\xfa7d', U'\x58b3'}, {U'\xfa7e', U'\x5944'}, {U'\xfa7f', U'\x5954'}, {U'\xfa80', U'\x5a62'},
-    {U'\xfa81', U'\x5b28'}, {U'\xfa82', U'\x5ed2'}, {U'\xfa83', U'\x5ed9'}, {U'\xfa84', U'\x5f69'},
-    {U'\xfa85', U'\x5fad'}, {U'\xfa86', U'\x60d8'}, {U'\xfa87', U'\x614e'}, {U'\xfa88', U'\x6108'},
-    {U'\xfa89', U'\x618e'}, {U'\xfa8a', U'\x6160'}, {U'\xfa8b', U'\x61f2'}, {U'\xfa8c', U'\x6234'},
-    {U'\xfa8d', U'\x63c4'}, {U'\xfa8e', U'\x641c'}, {U'\xfa8f', U'\x6452'}, {U'\xfa90', U'\x6556'},
-    {U'\xfa91', U'\x6674'}, {U'\xfa92', U'\x6717'}, {U'\xfa93', U'\x671b'}, {U'\xfa94', U'\x6756'},
-    {U'\xfa95', U'\x6b79'}, {U'\xfa96', U'\x6bba'}, {U'\xfa97', U'\x6d41'}, {U'\xfa98', U'\x6edb'},
-    {U'\xfa99', U'\x6ecb'}, {U'\xfa9a', U'\x6f22'}, {U'\xfa9b', U'\x701e'}, {U'\xfa9c', U'\x716e'},
-    {U'\xfa9d', U'\x77a7'}, {U'\xfa9e', U'\x7235'}, {U'\xfa9f', U'\x72af'}, {U'\xfaa0', U'\x732a'},
-    {U'\xfaa1', U'\x7471'}, {U'\xfaa2', U'\x7506'}, {U'\xfaa3', U'\x753b'}, {U'\xfaa4', U'\x761d'},
-    {U'\xfaa5', U'\x761f'}, {U'\xfaa6', U'\x76ca'}, {U'\xfaa7', U'\x76db'}, {U'\xfaa8', U'\x76f4'},
-    {U'\xfaa9', U'\x774a'}, {U'\xfaaa', U'\x7740'}, {U'\xfaab', U'\x78cc'}, {U'\xfaac', U'\x7ab1'},
-    {U'\xfaad', U'\x7bc0'}, {U'\xfaae', U'\x7c7b'}, {U'\xfaaf', U'\x7d5b'}, {U'\xfab0', U'\x7df4'},
-    {U'\xfab1', U'\x7f3e'}, {U'\xfab2', U'\x8005'}, {U'\xfab3', U'\x8352'}, {U'\xfab4', U'\x83ef'},
-    {U'\xfab5', U'\x8779'}, {U'\xfab6', U'\x8941'}, {U'\xfab7', U'\x8986'}, {U'\xfab8', U'\x8996'},
-    {U'\xfab9', U'\x8abf'}, {U'\xfaba', U'\x8af8'}, {U'\xfabb', U'\x8acb'}, {U'\xfabc', U'\x8b01'},
-    {U'\xfabd', U'\x8afe'}, {U'\xfabe', U'\x8aed'}, {U'\xfabf', U'\x8b39'}, {U'\xfac0', U'\x8b8a'},
-    {U'\xfac1', U'\x8d08'}, {U'\xfac2', U'\x8f38'}, {U'\xfac3', U'\x9072'}, {U'\xfac4', U'\x9199'},
-    {U'\xfac5', U'\x9276'}, {U'\xfac6', U'\x967c'}, {U'\xfac7', U'\x96e3'}, {U'\xfac8', U'\x9756'},
-    {U'\xfac9', U'\x97db'}, {U'\xfaca', U'\x97ff'}, {U'\xfacb', U'\x980b'}, {U'\xfacc', U'\x983b'},
-    {U'\xfacd', U'\x9b12'}, {U'\xface', U'\x9f9c'}, {U'\xfad2', U'\x3b9d'}, {U'\xfad3', U'\x4018'},
-    {U'\xfad4', U'\x4039'}, {U'\xfad8', U'\x9f43'}, {U'\xfad9', U'\x9f8e'}, {U'\xfb00', U'\x0066'},
-    {U'\xfb01', U'\x0066'}, {U'\xfb02', U'\x0066'}, {U'\xfb03', U'\x0066'}, {U'\xfb04', U'\x0066'},
-    {U'\xfb05', U'\x0073'}, {U'\xfb13', U'\x0574'}, {U'\xfb14', U'\x0574'}, {U'\xfb15', U'\x0574'},
-    {U'\xfb16', U'\x057e'}, {U'\xfb17', U'\x0574'}, {U'\xfb1d', U'\x05d9'}, {U'\xfb1f', U'\x05f2'},
-    {U'\xfb20', U'\x05e2'}, {U'\xfb21', U'\x05d0'}, {U'\xfb22', U'\x05d3'}, {U'\xfb23', U'\x05d4'},
-    {U'\xfb24', U'\x05db'}, {U'\xfb25', U'\x05dc'}, {U'\xfb26', U'\x05dd'}, {U'\xfb27', U'\x05e8'},
-    {U'\xfb28', U'\x05ea'}, {U'\xfb29', U'\x002b'}, {U'\xfb2a', U'\x05e9'}, {U'\xfb2b', U'\x05e9'},
-    {U'\xfb2c', U'\x05e9'}, {U'\xfb2d', U'\x05e9'}, {U'\xfb2e', U'\x05d0'}, {U'\xfb2f', U'\x05d0'},
-    {U'\xfb30', U'\x05d0'}, {U'\xfb31', U'\x05d1'}, {U'\xfb32', U'\x05d2'}, {U'\xfb33', U'\x05d3'},
-    {U'\xfb34', U'\x05d4'}, {U'\xfb35', U'\x05d5'}, {U'\xfb36', U'\x05d6'}, {U'\xfb38', U'\x05d8'},
-    {U'\xfb39', U'\x05d9'}, {U'\xfb3a', U'\x05da'}, {U'\xfb3b', U'\x05db'}, {U'\xfb3c', U'\x05dc'},
-    {U'\xfb3e', U'\x05de'}, {U'\xfb40', U'\x05e0'}, {U'\xfb41', U'\x05e1'}, {U'\xfb43', U'\x05e3'},
-    {U'\xfb44', U'\x05e4'}, {U'\xfb46', U'\x05e6'}, {U'\xfb47', U'\x05e7'}, {U'\xfb48', U'\x05e8'},
-    {U'\xfb49', U'\x05e9'}, {U'\xfb4a', U'\x05ea'}, {U'\xfb4b', U'\x05d5'}, {U'\xfb4c', U'\x05d1'},
-    {U'\xfb4d', U'\x05db'}, {U'\xfb4e', U'\x05e4'}, {U'\xfb4f', U'\x05d0'}, {U'\xfb50', U'\x0671'},
-    {U'\xfb52', U'\x067b'}, {U'\xfb56', U'\x067e'}, {U'\xfb5a', U'\x0680'}, {U'\xfb5e', U'\x067a'},
-    {U'\xfb62', U'\x067f'}, {U'\xfb66', U'\x0679'}, {U'\xfb6a', U'\x06a4'}, {U'\xfb6e', U'\x06a6'},
-    {U'\xfb72', U'\x0684'}, {U'\xfb76', U'\x0683'}, {U'\xfb7a', U'\x0686'}, {U'\xfb7e', U'\x0687'},
-    {U'\xfb82', U'\x068d'}, {U'\xfb84', U'\x068c'}, {U'\xfb86', U'\x068e'}, {U'\xfb88', U'\x0688'},
-    {U'\xfb8a', U'\x0698'}, {U'\xfb8c', U'\x0691'}, {U'\xfb8e', U'\x06a9'}, {U'\xfb92', U'\x06af'},
-    {U'\xfb96', U'\x06b3'}, {U'\xfb9a', U'\x06b1'}, {U'\xfb9e', U'\x06ba'}, {U'\xfba0', U'\x06bb'},
-    {U'\xfba4', U'\x06c0'}, {U'\xfba6', U'\x06c1'}, {U'\xfbaa', U'\x06be'}, {U'\xfbae', U'\x06d2'},
-    {U'\xfbb0', U'\x06d3'}, {U'\xfbd3', U'\x06ad'}, {U'\xfbd7', U'\x06c7'}, {U'\xfbd9', U'\x06c6'},
-    {U'\xfbdb', U'\x06c8'}, {U'\xfbdd', U'\x06c7'}, {U'\xfbde', U'\x06cb'}, {U'\xfbe0', U'\x06c5'},
-    {U'\xfbe2', U'\x06c9'}, {U'\xfbe4', U'\x06d0'}, {U'\xfbe8', U'\x0649'}, {U'\xfbea', U'\x0626'},
-    {U'\xfbec', U'\x0626'}, {U'\xfbee', U'\x0626'}, {U'\xfbf0', U'\x0626'}, {U'\xfbf2', U'\x0626'},
-    {U'\xfbf4', U'\x0626'}, {U'\xfbf6', U'\x0626'}, {U'\xfbf9', U'\x0626'}, {U'\xfbfc', U'\x06cc'},
-    {U'\xfc00', U'\x0626'}, {U'\xfc01', U'\x0626'}, {U'\xfc02', U'\x0626'}, {U'\xfc03', U'\x0626'},
-    {U'\xfc04', U'\x0626'}, {U'\xfc05', U'\x0628'}, {U'\xfc06', U'\x0628'}, {U'\xfc07', U'\x0628'},
-    {U'\xfc08', U'\x0628'}, {U'\xfc09', U'\x0628'}, {U'\xfc0a', U'\x0628'}, {U'\xfc0b', U'\x062a'},
-    {U'\xfc0c', U'\x062a'}, {U'\xfc0d', U'\x062a'}, {U'\xfc0e', U'\x062a'}, {U'\xfc0f', U'\x062a'},
-    {U'\xfc10', U'\x062a'}, {U'\xfc11', U'\x062b'}, {U'\xfc12', U'\x062b'}, {U'\xfc13', U'\x062b'},
-    {U'\xfc14', U'\x062b'}, {U'\xfc15', U'\x062c'}, {U'\xfc16', U'\x062c'}, {U'\xfc17', U'\x062d'},
-    {U'\xfc18', U'\x062d'}, {U'\xfc19', U'\x062e'}, {U'\xfc1a', U'\x062e'}, {U'\xfc1b', U'\x062e'},
-    {U'\xfc1c', U'\x0633'}, {U'\xfc1d', U'\x0633'}, {U'\xfc1e', U'\x0633'}, {U'\xfc1f', U'\x0633'},
-    {U'\xfc20', U'\x0635'}, {U'\xfc21', U'\x0635'}, {U'\xfc22', U'\x0636'}, {U'\xfc23', U'\x0636'},
-    {U'\xfc24', U'\x0636'}, {U'\xfc25', U'\x0636'}, {U'\xfc26', U'\x0637'}, {U'\xfc27', U'\x0637'},
-    {U'\xfc28', U'\x0638'}, {U'\xfc29', U'\x0639'}, {U'\xfc2a', U'\x0639'}, {U'\xfc2b', U'\x063a'},
-    {U'\xfc2c', U'\x063a'}, {U'\xfc2d', U'\x0641'}, {U'\xfc2e', U'\x0641'}, {U'\xfc2f', U'\x0641'},
-    {U'\xfc30', U'\x0641'}, {U'\xfc31', U'\x0641'}, {U'\xfc32', U'\x0641'}, {U'\xfc33', U'\x0642'},
-    {U'\xfc34', U'\x0642'}, {U'\xfc35', U'\x0642'}, {U'\xfc36', U'\x0642'}, {U'\xfc37', U'\x0643'},
-    {U'\xfc38', U'\x0643'}, {U'\xfc39', U'\x0643'}, {U'\xfc3a', U'\x0643'}, {U'\xfc3b', U'\x0643'},
-    {U'\xfc3c', U'\x0643'}, {U'\xfc3d', U'\x0643'}, {U'\xfc3e', U'\x0643'}, {U'\xfc3f', U'\x0644'},
-    {U'\xfc40', U'\x0644'}, {U'\xfc41', U'\x0644'}, {U'\xfc42', U'\x0644'}, {U'\xfc43', U'\x0644'},
-    {U'\xfc44', U'\x0644'}, {U'\xfc45', U'\x0645'}, {U'\xfc46', U'\x0645'}, {U'\xfc47', U'\x0645'},
-    {U'\xfc48', U'\x0645'}, {U'\xfc49', U'\x0645'}, {U'\xfc4a', U'\x0645'}, {U'\xfc4b', U'\x0646'},
-    {U'\xfc4c', U'\x0646'}, {U'\xfc4d', U'\x0646'}, {U'\xfc4e', U'\x0646'}, {U'\xfc4f', U'\x0646'},
-    {U'\xfc50', U'\x0646'}, {U'\xfc51', U'\x0647'}, {U'\xfc52', U'\x0647'}, {U'\xfc53', U'\x0647'},
-    {U'\xfc54', U'\x0647'}, {U'\xfc55', U'\x064a'}, {U'\xfc56', U'\x064a'}, {U'\xfc57', U'\x064a'},
-    {U'\xfc58', U'\x064a'}, {U'\xfc59', U'\x064a'}, {U'\xfc5a', U'\x064a'}, {U'\xfc5b', U'\x0630'},
-    {U'\xfc5c', U'\x0631'}, {U'\xfc5d', U'\x0649'}, {U'\xfc5e', U'\x0020'}, {U'\xfc5f', U'\x0020'},
-    {U'\xfc60', U'\x0020'}, {U'\xfc61', U'\x0020'}, {U'\xfc62', U'\x0020'}, {U'\xfc63', U'\x0020'},
-    {U'\xfc64', U'\x0626'}, {U'\xfc65', U'\x0626'}, {U'\xfc66', U'\x0626'}, {U'\xfc67', U'\x0626'},
-    {U'\xfc68', U'\x0626'}, {U'\xfc69', U'\x0626'}, {U'\xfc6a', U'\x0628'}, {U'\xfc6b', U'\x0628'},
-    {U'\xfc6c', U'\x0628'}, {U'\xfc6d', U'\x0628'}, {U'\xfc6e', U'\x0628'}, {U'\xfc6f', U'\x0628'},
-    {U'\xfc70', U'\x062a'}, {U'\xfc71', U'\x062a'}, {U'\xfc72', U'\x062a'}, {U'\xfc73', U'\x062a'},
-    {U'\xfc74', U'\x062a'}, {U'\xfc75', U'\x062a'}, {U'\xfc76', U'\x062b'}, {U'\xfc77', U'\x062b'},
-    {U'\xfc78', U'\x062b'}, {U'\xfc79', U'\x062b'}, {U'\xfc7a', U'\x062b'}, {U'\xfc7b', U'\x062b'},
-    {U'\xfc7c', U'\x0641'}, {U'\xfc7d', U'\x0641'}, {U'\xfc7e', U'\x0642'}, {U'\xfc7f', U'\x0642'},
-    {U'\xfc80', U'\x0643'}, {U'\xfc81', U'\x0643'}, {U'\xfc82', U'\x0643'}, {U'\xfc83', U'\x0643'},
-    {U'\xfc84', U'\x0643'}, {U'\xfc85', U'\x0644'}, {U'\xfc86', U'\x0644'}, {U'\xfc87', U'\x0644'},
-    {U'\xfc88', U'\x0645'}, {U'\xfc89', U'\x0645'}, {U'\xfc8a', U'\x0646'}, {U'\xfc8b', U'\x0646'},
-    {U'\xfc8c', U'\x0646'}, {U'\xfc8d', U'\x0646'}, {U'\xfc8e', U'\x0646'}, {U'\xfc8f', U'\x0646'},
-    {U'\xfc90', U'\x0649'}, {U'\xfc91', U'\x064a'}, {U'\xfc92', U'\x064a'}, {U'\xfc93', U'\x064a'},
-    {U'\xfc94', U'\x064a'}, {U'\xfc95', U'\x064a'}, {U'\xfc96', U'\x064a'}, {U'\xfc97', U'\x0626'},
-    {U'\xfc98', U'\x0626'}, {U'\xfc99', U'\x0626'}, {U'\xfc9a', U'\x0626'}, {U'\xfc9b', U'\x0626'},
-    {U'\xfc9c', U'\x0628'}, {U'\xfc9d', U'\x0628'}, {U'\xfc9e', U'\x0628'}, {U'\xfc9f', U'\x0628'},
-    {U'\xfca0', U'\x0628'}, {U'\xfca1', U'\x062a'}, {U'\xfca2', U'\x062a'}, {U'\xfca3', U'\x062a'},
-    {U'\xfca4', U'\x062a'}, {U'\xfca5', U'\x062a'}, {U'\xfca6', U'\x062b'}, {U'\xfca7', U'\x062c'},
-    {U'\xfca8', U'\x062c'}, {U'\xfca9', U'\x062d'}, {U'\xfcaa', U'\x062d'}, {U'\xfcab', U'\x062e'},
-    {U'\xfcac', U'\x062e'}, {U'\xfcad', U'\x0633'}, {U'\xfcae', U'\x0633'}, {U'\xfcaf', U'\x0633'},
-    {U'\xfcb0', U'\x0633'}, {U'\xfcb1', U'\x0635'}, {U'\xfcb2', U'\x0635'}, {U'\xfcb3', U'\x0635'},
-    {U'\xfcb4', U'\x0636'}, {U'\xfcb5', U'\x0636'}, {U'\xfcb6', U'\x0636'}, {U'\xfcb7', U'\x0636'},
-    {U'\xfcb8', U'\x0637'}, {U'\xfcb9', U'\x0638'}, {U'\xfcba', U'\x0639'}, {U'\xfcbb', U'\x0639'},
-    {U'\xfcbc', U'\x063a'}, {U'\xfcbd', U'\x063a'}, {U'\xfcbe', U'\x0641'}, {U'\xfcbf', U'\x0641'},
-    {U'\xfcc0', U'\x0641'}, {U'\xfcc1', U'\x0641'}, {U'\xfcc2', U'\x0642'}, {U'\xfcc3', U'\x0642'},
-    {U'\xfcc4', U'\x0643'}, {U'\xfcc5', U'\x0643'}, {U'\xfcc6', U'\x0643'}, {U'\xfcc7', U'\x0643'},
-    {U'\xfcc8', U'\x0643'}, {U'\xfcc9', U'\x0644'}, {U'\xfcca', U'\x0644'}, {U'\xfccb', U'\x0644'},
-    {U'\xfccc', U'\x0644'}, {U'\xfccd', U'\x0644'}, {U'\xfcce', U'\x0645'}, {U'\xfccf', U'\x0645'},
-    {U'\xfcd0', U'\x0645'}, {U'\xfcd1', U'\x0645'}, {U'\xfcd2', U'\x0646'}, {U'\xfcd3', U'\x0646'},
-    {U'\xfcd4', U'\x0646'}, {U'\xfcd5', U'\x0646'}, {U'\xfcd6', U'\x0646'}, {U'\xfcd7', U'\x0647'},
-    {U'\xfcd8', U'\x0647'}, {U'\xfcd9', U'\x0647'}, {U'\xfcda', U'\x064a'}, {U'\xfcdb', U'\x064a'},
-    {U'\xfcdc', U'\x064a'}, {U'\xfcdd', U'\x064a'}, {U'\xfcde', U'\x064a'}, {U'\xfcdf', U'\x0626'},
-    {U'\xfce0', U'\x0626'}, {U'\xfce1', U'\x0628'}, {U'\xfce2', U'\x0628'}, {U'\xfce3', U'\x062a'},
-    {U'\xfce4', U'\x062a'}, {U'\xfce5', U'\x062b'}, {U'\xfce6', U'\x062b'}, {U'\xfce7', U'\x0633'},
-    {U'\xfce8', U'\x0633'}, {U'\xfce9', U'\x0634'}, {U'\xfcea', U'\x0634'}, {U'\xfceb', U'\x0643'},
-    {U'\xfcec', U'\x0643'}, {U'\xfced', U'\x0644'}, {U'\xfcee', U'\x0646'}, {U'\xfcef', U'\x0646'},
-    {U'\xfcf0', U'\x064a'}, {U'\xfcf1', U'\x064a'}, {U'\xfcf2', U'\x0640'}, {U'\xfcf3', U'\x0640'},
-    {U'\xfcf4', U'\x0640'}, {U'\xfcf5', U'\x0637'}, {U'\xfcf6', U'\x0637'}, {U'\xfcf7', U'\x0639'},
-    {U'\xfcf8', U'\x0639'}, {U'\xfcf9', U'\x063a'}, {U'\xfcfa', U'\x063a'}, {U'\xfcfb', U'\x0633'},
-    {U'\xfcfc', U'\x0633'}, {U'\xfcfd', U'\x0634'}, {U'\xfcfe', U'\x0634'}, {U'\xfcff', U'\x062d'},
-    {U'\xfd00', U'\x062d'}, {U'\xfd01', U'\x062c'}, {U'\xfd02', U'\x062c'}, {U'\xfd03', U'\x062e'},
-    {U'\xfd04', U'\x062e'}, {U'\xfd05', U'\x0635'}, {U'\xfd06', U'\x0635'}, {U'\xfd07', U'\x0636'},
-    {U'\xfd08', U'\x0636'}, {U'\xfd09', U'\x0634'}, {U'\xfd0a', U'\x0634'}, {U'\xfd0b', U'\x0634'},
-    {U'\xfd0c', U'\x0634'}, {U'\xfd0d', U'\x0634'}, {U'\xfd0e', U'\x0633'}, {U'\xfd0f', U'\x0635'},
-    {U'\xfd10', U'\x0636'}, {U'\xfd11', U'\x0637'}, {U'\xfd12', U'\x0637'}, {U'\xfd13', U'\x0639'},
-    {U'\xfd14', U'\x0639'}, {U'\xfd15', U'\x063a'}, {U'\xfd16', U'\x063a'}, {U'\xfd17', U'\x0633'},
-    {U'\xfd18', U'\x0633'}, {U'\xfd19', U'\x0634'}, {U'\xfd1a', U'\x0634'}, {U'\xfd1b', U'\x062d'},
-    {U'\xfd1c', U'\x062d'}, {U'\xfd1d', U'\x062c'}, {U'\xfd1e', U'\x062c'}, {U'\xfd1f', U'\x062e'},
-    {U'\xfd20', U'\x062e'}, {U'\xfd21', U'\x0635'}, {U'\xfd22', U'\x0635'}, {U'\xfd23', U'\x0636'},
-    {U'\xfd24', U'\x0636'}, {U'\xfd25', U'\x0634'}, {U'\xfd26', U'\x0634'}, {U'\xfd27', U'\x0634'},
-    {U'\xfd28', U'\x0634'}, {U'\xfd29', U'\x0634'}, {U'\xfd2a', U'\x0633'}, {U'\xfd2b', U'\x0635'},
-    {U'\xfd2c', U'\x0636'}, {U'\xfd2d', U'\x0634'}, {U'\xfd2e', U'\x0634'}, {U'\xfd2f', U'\x0634'},
-    {U'\xfd30', U'\x0634'}, {U'\xfd31', U'\x0633'}, {U'\xfd32', U'\x0634'}, {U'\xfd33', U'\x0637'},
-    {U'\xfd34', U'\x0633'}, {U'\xfd35', U'\x0633'}, {U'\xfd36', U'\x0633'}, {U'\xfd37', U'\x0634'},
-    {U'\xfd38', U'\x0634'}, {U'\xfd39', U'\x0634'}, {U'\xfd3a', U'\x0637'}, {U'\xfd3b', U'\x0638'},
-    {U'\xfd3c', U'\x0627'}, {U'\xfd50', U'\x062a'}, {U'\xfd51', U'\x062a'}, {U'\xfd53', U'\x062a'},
-    {U'\xfd54', U'\x062a'}, {U'\xfd55', U'\x062a'}, {U'\xfd56', U'\x062a'}, {U'\xfd57', U'\x062a'},
-    {U'\xfd58', U'\x062c'}, {U'\xfd5a', U'\x062d'}, {U'\xfd5b', U'\x062d'}, {U'\xfd5c', U'\x0633'},
-    {U'\xfd5d', U'\x0633'}, {U'\xfd5e', U'\x0633'}, {U'\xfd5f', U'\x0633'}, {U'\xfd61', U'\x0633'},
-    {U'\xfd62', U'\x0633'}, {U'\xfd64', U'\x0635'}, {U'\xfd66', U'\x0635'}, {U'\xfd67', U'\x0634'},
-    {U'\xfd69', U'\x0634'}, {U'\xfd6a', U'\x0634'}, {U'\xfd6c', U'\x0634'}, {U'\xfd6e', U'\x0636'},
-    {U'\xfd6f', U'\x0636'}, {U'\xfd71', U'\x0637'}, {U'\xfd73', U'\x0637'}, {U'\xfd74', U'\x0637'},
-    {U'\xfd75', U'\x0639'}, {U'\xfd76', U'\x0639'}, {U'\xfd78', U'\x0639'}, {U'\xfd79', U'\x063a'},
-    {U'\xfd7a', U'\x063a'}, {U'\xfd7b', U'\x063a'}, {U'\xfd7c', U'\x0641'}, {U'\xfd7e', U'\x0642'},
-    {U'\xfd7f', U'\x0642'}, {U'\xfd80', U'\x0644'}, {U'\xfd81', U'\x0644'}, {U'\xfd82', U'\x0644'},
-    {U'\xfd83', U'\x0644'}, {U'\xfd85', U'\x0644'}, {U'\xfd87', U'\x0644'}, {U'\xfd89', U'\x0645'},
-    {U'\xfd8a', U'\x0645'}, {U'\xfd8b', U'\x0645'}, {U'\xfd8c', U'\x0645'}, {U'\xfd8d', U'\x0645'},
-    {U'\xfd8e', U'\x0645'}, {U'\xfd8f', U'\x0645'}, {U'\xfd92', U'\x0645'}, {U'\xfd93', U'\x0647'},
-    {U'\xfd94', U'\x0647'}, {U'\xfd95', U'\x0646'}, {U'\xfd96', U'\x0646'}, {U'\xfd97', U'\x0646'},
-    {U'\xfd99', U'\x0646'}, {U'\xfd9a', U'\x0646'}, {U'\xfd9b', U'\x0646'}, {U'\xfd9c', U'\x064a'},
-    {U'\xfd9e', U'\x0628'}, {U'\xfd9f', U'\x062a'}, {U'\xfda0', U'\x062a'}, {U'\xfda1', U'\x062a'},
-    {U'\xfda2', U'\x062a'}, {U'\xfda3', U'\x062a'}, {U'\xfda4', U'\x062a'}, {U'\xfda5', U'\x062c'},
-    {U'\xfda6', U'\x062c'}, {U'\xfda7', U'\x062c'}, {U'\xfda8', U'\x0633'}, {U'\xfda9', U'\x0635'},
-    {U'\xfdaa', U'\x0634'}, {U'\xfdab', U'\x0636'}, {U'\xfdac', U'\x0644'}, {U'\xfdad', U'\x0644'},
-    {U'\xfdae', U'\x064a'}, {U'\xfdaf', U'\x064a'}, {U'\xfdb0', U'\x064a'}, {U'\xfdb1', U'\x0645'},
-    {U'\xfdb2', U'\x0642'}, {U'\xfdb3', U'\x0646'}, {U'\xfdb4', U'\x0642'}, {U'\xfdb5', U'\x0644'},
-    {U'\xfdb6', U'\x0639'}, {U'\xfdb7', U'\x0643'}, {U'\xfdb8', U'\x0646'}, {U'\xfdb9', U'\x0645'},
-    {U'\xfdba', U'\x0644'}, {U'\xfdbb', U'\x0643'}, {U'\xfdbc', U'\x0644'}, {U'\xfdbd', U'\x0646'},
-    {U'\xfdbe', U'\x062c'}, {U'\xfdbf', U'\x062d'}, {U'\xfdc0', U'\x0645'}, {U'\xfdc1', U'\x0641'},
-    {U'\xfdc2', U'\x0628'}, {U'\xfdc3', U'\x0643'}, {U'\xfdc4', U'\x0639'}, {U'\xfdc5', U'\x0635'},
-    {U'\xfdc6', U'\x0633'}, {U'\xfdc7', U'\x0646'}, {U'\xfdf0', U'\x0635'}, {U'\xfdf1', U'\x0642'},
-    {U'\xfdf2', U'\x0627'}, {U'\xfdf3', U'\x0627'}, {U'\xfdf4', U'\x0645'}, {U'\xfdf5', U'\x0635'},
-    {U'\xfdf6', U'\x0631'}, {U'\xfdf7', U'\x0639'}, {U'\xfdf8', U'\x0648'}, {U'\xfdf9', U'\x0635'},
-    {U'\xfdfa', U'\x0635'}, {U'\xfdfb', U'\x062c'}, {U'\xfdfc', U'\x0631'}, {U'\xfe10', U'\x002c'},
-    {U'\xfe11', U'\x3001'}, {U'\xfe13', U'\x003a'}, {U'\xfe14', U'\x003b'}, {U'\xfe15', U'\x0021'},
-    {U'\xfe16', U'\x003f'}, {U'\xfe17', U'\x3016'}, {U'\xfe18', U'\x3017'}, {U'\xfe31', U'\x2014'},
-    {U'\xfe32', U'\x2013'}, {U'\xfe33', U'\x005f'}, {U'\xfe35', U'\x0028'}, {U'\xfe36', U'\x0029'},
-    {U'\xfe37', U'\x007b'}, {U'\xfe38', U'\x007d'}, {U'\xfe39', U'\x3014'}, {U'\xfe3a', U'\x3015'},
-    {U'\xfe3b', U'\x3010'}, {U'\xfe3c', U'\x3011'}, {U'\xfe3d', U'\x300a'}, {U'\xfe3e', U'\x300b'},
-    {U'\xfe3f', U'\x3008'}, {U'\xfe40', U'\x3009'}, {U'\xfe41', U'\x300c'}, {U'\xfe42', U'\x300d'},
-    {U'\xfe43', U'\x300e'}, {U'\xfe44', U'\x300f'}, {U'\xfe47', U'\x005b'}, {U'\xfe48', U'\x005d'},
-    {U'\xfe49', U'\x0020'}, {U'\xfe4d', U'\x005f'}, {U'\xfe50', U'\x002c'}, {U'\xfe51', U'\x3001'},
-    {U'\xfe54', U'\x003b'}, {U'\xfe55', U'\x003a'}, {U'\xfe56', U'\x003f'}, {U'\xfe57', U'\x0021'},
-    {U'\xfe58', U'\x2014'}, {U'\xfe59', U'\x0028'}, {U'\xfe5a', U'\x0029'}, {U'\xfe5b', U'\x007b'},
-    {U'\xfe5c', U'\x007d'}, {U'\xfe5d', U'\x3014'}, {U'\xfe5e', U'\x3015'}, {U'\xfe5f', U'\x0023'},
-    {U'\xfe60', U'\x0026'}, {U'\xfe61', U'\x002a'}, {U'\xfe62', U'\x002b'}, {U'\xfe63', U'\x002d'},
-    {U'\xfe64', U'\x003c'}, {U'\xfe65', U'\x003e'}, {U'\xfe66', U'\x003d'}, {U'\xfe68', U'\x005c'},
-    {U'\xfe69', U'\x0024'}, {U'\xfe6a', U'\x0025'}, {U'\xfe6b', U'\x0040'}, {U'\xfe70', U'\x0020'},
-    {U'\xfe71', U'\x0640'}, {U'\xfe72', U'\x0020'}, {U'\xfe74', U'\x0020'}, {U'\xfe76', U'\x0020'},
-    {U'\xfe77', U'\x0640'}, {U'\xfe78', U'\x0020'}, {U'\xfe79', U'\x0640'}, {U'\xfe7a', U'\x0020'},
-    {U'\xfe7b', U'\x0640'}, {U'\xfe7c', U'\x0020'}, {U'\xfe7d', U'\x0640'}, {U'\xfe7e', U'\x0020'},
-    {U'\xfe7f', U'\x0640'}, {U'\xfe80', U'\x0621'}, {U'\xfe81', U'\x0622'}, {U'\xfe83', U'\x0623'},
-    {U'\xfe85', U'\x0624'}, {U'\xfe87', U'\x0625'}, {U'\xfe89', U'\x0626'}, {U'\xfe8d', U'\x0627'},
-    {U'\xfe8f', U'\x0628'}, {U'\xfe93', U'\x0629'}, {U'\xfe95', U'\x062a'}, {U'\xfe99', U'\x062b'},
-    {U'\xfe9d', U'\x062c'}, {U'\xfea1', U'\x062d'}, {U'\xfea5', U'\x062e'}, {U'\xfea9', U'\x062f'},
-    {U'\xfeab', U'\x0630'}, {U'\xfead', U'\x0631'}, {U'\xfeaf', U'\x0632'}, {U'\xfeb1', U'\x0633'},
-    {U'\xfeb5', U'\x0634'}, {U'\xfeb9', U'\x0635'}, {U'\xfebd', U'\x0636'}, {U'\xfec1', U'\x0637'},
-    {U'\xfec5', U'\x0638'}, {U'\xfec9', U'\x0639'}, {U'\xfecd', U'\x063a'}, {U'\xfed1', U'\x0641'},
-    {U'\xfed5', U'\x0642'}, {U'\xfed9', U'\x0643'}, {U'\xfedd', U'\x0644'}, {U'\xfee1', U'\x0645'},
-    {U'\xfee5', U'\x0646'}, {U'\xfee9', U'\x0647'}, {U'\xfeed', U'\x0648'}, {U'\xfeef', U'\x0649'},
-    {U'\xfef1', U'\x064a'}, {U'\xfef5', U'\x0644'}, {U'\xfef7', U'\x0644'}, {U'\xfef9', U'\x0644'},
-    {U'\xfefb', U'\x0644'}, {U'\xff01', U'\x0021'}, {U'\xff02', U'\x0022'}, {U'\xff03', U'\x0023'},
-    {U'\xff04', U'\x0024'}, {U'\xff05', U'\x0025'}, {U'\xff06', U'\x0026'}, {U'\xff07', U'\x0027'},
-    {U'\xff08', U'\x0028'}, {U'\xff09', U'\x0029'}, {U'\xff0a', U'\x002a'}, {U'\xff0b', U'\x002b'},
-    {U'\xff0c', U'\x002c'}, {U'\xff0d', U'\x002d'}, {U'\xff0e', U'\x002e'}, {U'\xff0f', U'\x002f'},
-    {U'\xff10', U'\x0030'}, {U'\xff11', U'\x0031'}, {U'\xff12', U'\x0032'}, {U'\xff13', U'\x0033'},
-    {U'\xff14', U'\x0034'}, {U'\xff15', U'\x0035'}, {U'\xff16', U'\x0036'}, {U'\xff17', U'\x0037'},
-    {U'\xff18', U'\x0038'}, {U'\xff19', U'\x0039'}, {U'\xff1a', U'\x003a'}, {U'\xff1b', U'\x003b'},
-    {U'\xff1c', U'\x003c'}, {U'\xff1d', U'\x003d'}, {U'\xff1e', U'\x003e'}, {U'\xff1f', U'\x003f'},
-    {U'\xff20', U'\x0040'}, {U'\xff21', U'\x0061'}, {U'\xff22', U'\x0062'}, {U'\xff23', U'\x0063'},
-    {U'\xff24', U'\x0064'}, {U'\xff25', U'\x0065'}, {U'\xff26', U'\x0066'}, {U'\xff27', U'\x0067'},
-    {U'\xff28', U'\x0068'}, {U'\xff29', U'\x0069'}, {U'\xff2a', U'\x006a'}, {U'\xff2b', U'\x006b'},
-    {U'\xff2c', U'\x006c'}, {U'\xff2d', U'\x006d'}, {U'\xff2e', U'\x006e'}, {U'\xff2f', U'\x006f'},
-    {U'\xff30', U'\x0070'}, {U'\xff31', U'\x0071'}, {U'\xff32', U'\x0072'}, {U'\xff33', U'\x0073'},
-    {U'\xff34', U'\x0074'}, {U'\xff35', U'\x0075'}, {U'\xff36', U'\x0076'}, {U'\xff37', U'\x0077'},
-    {U'\xff38', U'\x0078'}, {U'\xff39', U'\x0079'}, {U'\xff3a', U'\x007a'}, {U'\xff3b', U'\x005b'},
-    {U'\xff3c', U'\x005c'}, {U'\xff3d', U'\x005d'}, {U'\xff3e', U'\x005e'}, {U'\xff3f', U'\x005f'},
-    {U'\xff40', U'\x0060'}, {U'\xff41', U'\x0061'}, {U'\xff42', U'\x0062'}, {U'\xff43', U'\x0063'},
-    {U'\xff44', U'\x0064'}, {U'\xff45', U'\x0065'}, {U'\xff46', U'\x0066'}, {U'\xff47', U'\x0067'},
-    {U'\xff48', U'\x0068'}, {U'\xff49', U'\x0069'}, {U'\xff4a', U'\x006a'}, {U'\xff4b', U'\x006b'},
-    {U'\xff4c', U'\x006c'}, {U'\xff4d', U'\x006d'}, {U'\xff4e', U'\x006e'}, {U'\xff4f', U'\x006f'},
-    {U'\xff50', U'\x0070'}, {U'\xff51', U'\x0071'}, {U'\xff52', U'\x0072'}, {U'\xff53', U'\x0073'},
-    {U'\xff54', U'\x0074'}, {U'\xff55', U'\x0075'}, {U'\xff56', U'\x0076'}, {U'\xff57', U'\x0077'},
-    {U'\xff58', U'\x0078'}, {U'\xff59', U'\x0079'}, {U'\xff5a', U'\x007a'}, {U'\xff5b', U'\x007b'},
-    {U'\xff5c', U'\x007c'}, {U'\xff5d', U'\x007d'}, {U'\xff5e', U'\x007e'}, {U'\xff5f', U'\x2985'},
-    {U'\xff60', U'\x2986'}, {U'\xff61', U'\x002e'}, {U'\xff62', U'\x300c'}, {U'\xff63', U'\x300d'},
-    {U'\xff64', U'\x3001'}, {U'\xff65', U'\x30fb'}, {U'\xff66', U'\x30f2'}, {U'\xff67', U'\x30a1'},
-    {U'\xff68', U'\x30a3'}, {U'\xff69', U'\x30a5'}, {U'\xff6a', U'\x30a7'}, {U'\xff6b', U'\x30a9'},
-    {U'\xff6c', U'\x30e3'}, {U'\xff6d', U'\x30e5'}, {U'\xff6e', U'\x30e7'}, {U'\xff6f', U'\x30c3'},
-    {U'\xff70', U'\x30fc'}, {U'\xff71', U'\x30a2'}, {U'\xff72', U'\x30a4'}, {U'\xff73', U'\x30a6'},
-    {U'\xff74', U'\x30a8'}, {U'\xff75', U'\x30aa'}, {U'\xff76', U'\x30ab'}, {U'\xff77', U'\x30ad'},
-    {U'\xff78', U'\x30af'}, {U'\xff79', U'\x30b1'}, {U'\xff7a', U'\x30b3'}, {U'\xff7b', U'\x30b5'},
-    {U'\xff7c', U'\x30b7'}, {U'\xff7d', U'\x30b9'}, {U'\xff7e', U'\x30bb'}, {U'\xff7f', U'\x30bd'},
-    {U'\xff80', U'\x30bf'}, {U'\xff81', U'\x30c1'}, {U'\xff82', U'\x30c4'}, {U'\xff83', U'\x30c6'},
-    {U'\xff84', U'\x30c8'}, {U'\xff85', U'\x30ca'}, {U'\xff86', U'\x30cb'}, {U'\xff87', U'\x30cc'},
-    {U'\xff88', U'\x30cd'}, {U'\xff89', U'\x30ce'}, {U'\xff8a', U'\x30cf'}, {U'\xff8b', U'\x30d2'},
-    {U'\xff8c', U'\x30d5'}, {U'\xff8d', U'\x30d8'}, {U'\xff8e', U'\x30db'}, {U'\xff8f', U'\x30de'},
-    {U'\xff90', U'\x30df'}, {U'\xff91', U'\x30e0'}, {U'\xff92', U'\x30e1'}, {U'\xff93', U'\x30e2'},
-    {U'\xff94', U'\x30e4'}, {U'\xff95', U'\x30e6'}, {U'\xff96', U'\x30e8'}, {U'\xff97', U'\x30e9'},
-    {U'\xff98', U'\x30ea'}, {U'\xff99', U'\x30eb'}, {U'\xff9a', U'\x30ec'}, {U'\xff9b', U'\x30ed'},
-    {U'\xff9c', U'\x30ef'}, {U'\xff9d', U'\x30f3'}, {U'\xff9e', U'\x3099'}, {U'\xff9f', U'\x309a'},
-    {U'\xffa1', U'\x1100'}, {U'\xffa2', U'\x1101'}, {U'\xffa3', U'\x11aa'}, {U'\xffa4', U'\x1102'},
-    {U'\xffa5', U'\x11ac'}, {U'\xffa6', U'\x11ad'}, {U'\xffa7', U'\x1103'}, {U'\xffa8', U'\x1104'},
-    {U'\xffa9', U'\x1105'}, {U'\xffaa', U'\x11b0'}, {U'\xffab', U'\x11b1'}, {U'\xffac', U'\x11b2'},
-    {U'\xffad', U'\x11b3'}, {U'\xffae', U'\x11b4'}, {U'\xffaf', U'\x11b5'}, {U'\xffb0', U'\x111a'},
-    {U'\xffb1', U'\x1106'}, {U'\xffb2', U'\x1107'}, {U'\xffb3', U'\x1108'}, {U'\xffb4', U'\x1121'},
-    {U'\xffb5', U'\x1109'}, {U'\xffb6', U'\x110a'}, {U'\xffb7', U'\x110b'}, {U'\xffb8', U'\x110c'},
-    {U'\xffb9', U'\x110d'}, {U'\xffba', U'\x110e'}, {U'\xffbb', U'\x110f'}, {U'\xffbc', U'\x1110'},
-    {U'\xffbd', U'\x1111'}, {U'\xffbe', U'\x1112'}, {U'\xffc2', U'\x1161'}, {U'\xffc3', U'\x1162'},
-    {U'\xffc4', U'\x1163'}, {U'\xffc5', U'\x1164'}, {U'\xffc6', U'\x1165'}, {U'\xffc7', U'\x1166'},
-    {U'\xffca', U'\x1167'}, {U'\xffcb', U'\x1168'}, {U'\xffcc', U'\x1169'}, {U'\xffcd', U'\x116a'},
-    {U'\xffce', U'\x116b'}, {U'\xffcf', U'\x116c'}, {U'\xffd2', U'\x116d'}, {U'\xffd3', U'\x116e'},
-    {U'\xffd4', U'\x116f'}, {U'\xffd5', U'\x1170'}, {U'\xffd6', U'\x1171'}, {U'\xffd7', U'\x1172'},
-    {U'\xffda', U'\x1173'}, {U'\xffdb', U'\x1174'}, {U'\xffdc', U'\x1175'}, {U'\xffe0', U'\x00a2'},
-    {U'\xffe1', U'\x00a3'}, {U'\xffe2', U'\x00ac'}, {U'\xffe3', U'\x0020'}, {U'\xffe4', U'\x00a6'},
-    {U'\xffe5', U'\x00a5'}, {U'\xffe6', U'\x20a9'}, {U'\xffe8', U'\x2502'}, {U'\xffe9', U'\x2190'},
-    {U'\xffea', U'\x2191'}, {U'\xffeb', U'\x2192'}, {U'\xffec', U'\x2193'}, {U'\xffed', U'\x25a0'},
-    {U'\xffee', U'\x25cb'},
+inline constexpr auto mapped_offsets = std::array<std::uint16_t, 8011>{{
+    0, 0, 0, 0, 0, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260,
+    263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 0,
+    0, 0, 0, 3, 0, 301, 0, 33, 0, 0, 0, 1399, 0, 37, 134, 1401,
+    1735, 0, 1403, 112, 345, 0, 292, 295, 298, 0, 2161, 2162, 2163, 2164, 2165, 2166,
+    2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182,
+    2183, 0, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 1405, 0, 2191, 0, 2192, 0, 2193,
+    0, 2194, 0, 2195, 0, 2196, 0, 2197, 0, 2198, 0, 2199, 0, 2200, 0, 2201,
+    0, 2202, 0, 2203, 0, 2204, 0, 2205, 0, 2206, 0, 2207, 0, 2208, 0, 2209,
+    0, 2210, 0, 2211, 0, 2212, 0, 2213, 0, 2214, 0, 1407, 0, 1409, 2215, 0,
+    2216, 0, 2217, 0, 2218, 0, 2219, 0, 1411, 2220, 0, 2221, 0, 2222, 0, 2223,
+    0, 1413, 2224, 0, 2225, 0, 2226, 0, 2227, 0, 2228, 0, 2229, 0, 2230, 0,
+    2231, 0, 2232, 0, 2233, 0, 2234, 0, 2235, 0, 2236, 0, 2237, 0, 2238, 0,
+    2239, 0, 2240, 0, 2241, 0, 2242, 0, 2243, 0, 2244, 0, 2245, 0, 2246, 0,
+    2247, 2248, 0, 2249, 0, 1416, 0, 36, 0, 2250, 2251, 0, 2252, 0, 2253, 2254,
+    0, 2255, 2256, 2257, 0, 2258, 2259, 2260, 2261, 0, 2262, 2263, 0, 2264, 2265, 2266,
+    0, 2267, 2268, 0, 2269, 2270, 0, 2271, 0, 2272, 0, 2273, 2274, 0, 2275, 0,
+    2276, 0, 2277, 2278, 0, 2279, 2280, 2281, 0, 2282, 0, 2283, 2284, 0, 2285, 0,
+    1415, 1417, 1419, 2286, 0, 2287, 0, 2288, 0, 2289, 0, 2290, 0, 2291, 0, 2292,
+    0, 2293, 0, 2294, 0, 2295, 0, 2296, 0, 2297, 0, 2298, 0, 2299, 0, 2300,
+    0, 2301, 0, 2302, 0, 1421, 2303, 0, 2304, 2305, 2306, 0, 2307, 0, 2308, 0,
+    2309, 0, 2310, 0, 2311, 0, 2312, 0, 2313, 0, 2314, 0, 2315, 0, 2316, 0,
+    2317, 0, 2318, 0, 2319, 0, 2320, 0, 2321, 0, 2322, 0, 2323, 0, 2324, 0,
+    2325, 0, 2326, 0, 2327, 0, 2328, 0, 2329, 0, 2330, 0, 2331, 0, 2332, 0,
+    2333, 0, 2334, 0, 2335, 0, 2336, 2337, 0, 2338, 2339, 0, 2340, 0, 2341, 2342,
+    2343, 2344, 0, 2345, 0, 2346, 0, 2347, 0, 2348, 0, 455, 2349, 461, 32, 2350,
+    2351, 2352, 500, 506, 0, 1423, 1425, 1427, 1429, 1431, 1433, 0, 2263, 263, 36, 354,
+    2353, 0, 315, 303, 0, 314, 302, 1436, 0, 0, 0, 2354, 0, 2355, 0, 2356,
+    0, 2357, 0, 0, 1435, 0, 2358, 2359, 0, 1401, 301, 1579, 1412, 2360, 1589, 2361,
+    0, 2362, 0, 2363, 1597, 0, 1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370,
+    2371, 1735, 2372, 2373, 2374, 2375, 2376, 0, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 2383,
+    2384, 0, 2377, 0, 2385, 2364, 2369, 2379, 2363, 2384, 2380, 2375, 0, 2386, 0, 2387,
+    0, 2388, 0, 2389, 0, 2390, 0, 2391, 0, 2392, 0, 2393, 0, 2394, 0, 2395,
+    0, 2396, 0, 2397, 0, 2370, 2376, 2377, 0, 2369, 2367, 0, 2398, 0, 2377, 2399,
+    0, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414,
+    2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430,
+    2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446,
+    2447, 2448, 2449, 2450, 0, 2451, 0, 2452, 0, 2453, 0, 2454, 0, 2455, 0, 2456,
+    0, 2457, 0, 2458, 0, 2459, 0, 2460, 0, 2461, 0, 2462, 0, 2463, 0, 2464,
+    0, 2465, 0, 2466, 0, 2467, 0, 2468, 0, 2469, 0, 2470, 0, 2471, 0, 2472,
+    0, 2473, 0, 2474, 0, 2475, 0, 2476, 0, 2477, 0, 2478, 0, 2479, 0, 2480,
+    0, 2481, 0, 2482, 0, 2483, 0, 2484, 0, 2485, 0, 2486, 0, 2487, 0, 2488,
+    0, 2489, 0, 2490, 0, 2491, 0, 2492, 0, 2493, 0, 2494, 0, 0, 2495, 0,
+    2496, 0, 2497, 0, 2498, 0, 2499, 0, 2500, 0, 2501, 0, 2502, 0, 2503, 0,
+    2504, 0, 2505, 0, 2506, 0, 2507, 0, 2508, 0, 2509, 0, 2510, 0, 2511, 0,
+    2512, 0, 2513, 0, 2514, 0, 2515, 0, 2516, 0, 2517, 0, 2518, 0, 2519, 0,
+    2520, 0, 2521, 0, 2522, 0, 2523, 0, 2524, 0, 2525, 0, 2526, 0, 2527, 0,
+    2528, 0, 2529, 0, 2530, 0, 2531, 0, 2532, 0, 2533, 0, 2534, 0, 2535, 0,
+    2536, 0, 2537, 0, 2538, 0, 2539, 0, 2540, 0, 2541, 0, 2542, 0, 2543, 0,
+    2544, 0, 2545, 0, 2546, 0, 2547, 0, 2548, 0, 2549, 0, 0, 2550, 2551, 2552,
+    2553, 1437, 2554, 2555, 2556, 2557, 2558, 1836, 2559, 1840, 2560, 2561, 2562, 2563, 2564, 2565,
+    1831, 2566, 1832, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 1837, 2574, 2575, 2576, 1438, 2577,
+    2578, 2579, 2580, 0, 0, 1437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1439, 1441, 1443, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1447, 1449, 1451, 1453, 1455, 1457, 1459, 1461, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1463, 1465,
+    0, 1467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1469, 0, 0, 1471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1473, 1475, 1477, 0, 0, 1479, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1481, 1483, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1485, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1487, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1489, 1491, 0, 0, 0, 2581, 0, 1493,
+    0, 0, 0, 1495, 0, 1497, 0, 1499, 0, 1501, 0, 1503, 0, 0, 0, 1505,
+    0, 1507, 1509, 304, 1511, 307, 0, 305, 0, 1513, 0, 0, 0, 1515, 0, 1517,
+    0, 1519, 0, 1521, 0, 1523, 0, 0, 0, 0, 0, 0, 0, 0, 2582, 0,
+    2583, 0, 0, 2584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2585, 2586, 2587, 2588,
+    2589, 2590, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2421, 2423, 2433, 2436, 2437, 2445, 2452, 2591, 0, 2592,
+    2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2584, 2604, 2605, 2606, 2607,
+    2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+    2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 0, 2634, 2635, 2636, 0, 0,
+    0, 0, 0, 33, 2167, 437, 0, 34, 350, 2258, 271, 455, 117, 461, 260, 263,
+    264, 473, 0, 345, 2327, 479, 32, 349, 348, 500, 33, 2637, 2638, 2639, 437, 34,
+    350, 2259, 2260, 2640, 271, 0, 260, 264, 2224, 345, 2253, 2641, 2642, 479, 349, 348,
+    2643, 2267, 116, 2644, 2364, 2365, 2366, 2380, 2381, 117, 32, 348, 116, 2364, 2365, 2376,
+    2380, 2381, 0, 2432, 0, 2645, 261, 2646, 2177, 2640, 352, 2647, 2648, 2649, 2265, 2264,
+    2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2268, 2658, 2659, 2269, 2660, 2661, 2275, 2662,
+    2342, 2279, 2663, 2280, 2343, 509, 2664, 2665, 2283, 2369, 0, 2666, 0, 2667, 0, 2668,
+    0, 2669, 0, 2670, 0, 2671, 0, 2672, 0, 2673, 0, 2674, 0, 2675, 0, 2676,
+    0, 2677, 0, 2678, 0, 2679, 0, 2680, 0, 2681, 0, 2682, 0, 2683, 0, 2684,
+    0, 2685, 0, 2686, 0, 2687, 0, 2688, 0, 2689, 0, 2690, 0, 2691, 0, 2692,
+    0, 2693, 0, 2694, 0, 2695, 0, 2696, 0, 2697, 0, 2698, 0, 2699, 0, 2700,
+    0, 2701, 0, 2702, 0, 2703, 0, 2704, 0, 2705, 0, 2706, 0, 2707, 0, 2708,
+    0, 2709, 0, 2710, 0, 2711, 0, 2712, 0, 2713, 0, 2714, 0, 2715, 0, 2716,
+    0, 2717, 0, 2718, 0, 2719, 0, 2720, 0, 2721, 0, 2722, 0, 2723, 0, 2724,
+    0, 2725, 0, 2726, 0, 2727, 0, 2728, 0, 2729, 0, 2730, 0, 2731, 0, 2732,
+    0, 2733, 0, 2734, 0, 2735, 0, 2736, 0, 2737, 0, 2738, 0, 2739, 0, 2740,
+    0, 1525, 2714, 0, 2741, 0, 2742, 0, 2743, 0, 2744, 0, 2745, 0, 2746, 0,
+    2747, 0, 2748, 0, 2749, 0, 2750, 0, 2751, 0, 2752, 0, 2753, 0, 2754, 0,
+    2755, 0, 2756, 0, 2757, 0, 2758, 0, 2759, 0, 2760, 0, 2761, 0, 2762, 0,
+    2763, 0, 2764, 0, 2765, 0, 2766, 0, 2767, 0, 2768, 0, 2769, 0, 2770, 0,
+    2771, 0, 2772, 0, 2773, 0, 2774, 0, 2775, 0, 2776, 0, 2777, 0, 2778, 0,
+    2779, 0, 2780, 0, 2781, 0, 2782, 0, 2783, 0, 2784, 0, 2785, 0, 2786, 0,
+    2787, 0, 2788, 0, 2789, 0, 1527, 1529, 1531, 1533, 1535, 1537, 1539, 1541, 0, 0,
+    2790, 2791, 2792, 2793, 2794, 2795, 0, 0, 1543, 1545, 1547, 1549, 1551, 1553, 1555, 1557,
+    0, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 0, 0, 2804, 2805, 2806, 2807, 2808,
+    2809, 0, 0, 0, 2810, 0, 2811, 0, 2812, 0, 2813, 0, 1559, 1561, 1563, 1565,
+    1567, 1569, 1571, 1573, 0, 1579, 0, 2360, 0, 1589, 0, 2361, 0, 2362, 0, 2363,
+    0, 1597, 0, 1527, 1529, 1531, 1533, 1535, 1537, 1539, 1541, 1527, 1529, 1531, 1533, 1535,
+    1537, 1539, 1541, 1543, 1545, 1547, 1549, 1551, 1553, 1555, 1557, 1543, 1545, 1547, 1549, 1551,
+    1553, 1555, 1557, 1559, 1561, 1563, 1565, 1567, 1569, 1571, 1573, 1559, 1561, 1563, 1565, 1567,
+    1569, 1571, 1573, 0, 1575, 1577, 1579, 0, 0, 1581, 2814, 2815, 1575, 1579, 1577, 313,
+    1436, 313, 1583, 310, 1585, 1587, 1589, 0, 0, 1591, 2816, 2360, 1585, 1589, 1587, 313,
+    316, 319, 0, 2817, 0, 0, 2818, 2819, 2820, 2361, 0, 322, 325, 328, 0, 2821,
+    0, 2822, 2823, 2824, 2363, 2825, 331, 301, 2826, 0, 1593, 1595, 1597, 0, 0, 1599,
+    2827, 2362, 1593, 1597, 1595, 1401, 322, 0, 3, 0, 0, 0, 0, 2828, 0, 1601,
+    0, 0, 0, 0, 3, 0, 108, 108, 0, 334, 334, 0, 1603, 0, 1605, 0,
+    1607, 1609, 1611, 0, 108, 0, 3, 0, 0, 0, 0, 115, 117, 0, 138, 142,
+    146, 150, 154, 158, 2829, 2830, 513, 120, 123, 473, 115, 112, 37, 134, 138, 142,
+    146, 150, 154, 158, 2829, 2830, 513, 120, 123, 0, 33, 350, 345, 354, 2259, 455,
+    260, 263, 264, 473, 479, 36, 349, 0, 0, 1613, 0, 0, 0, 0, 337, 340,
+    261, 1615, 0, 343, 346, 2260, 0, 1617, 271, 455, 2210, 117, 263, 0, 473, 1619,
+    0, 479, 482, 32, 0, 1621, 349, 1623, 0, 509, 0, 1595, 0, 509, 0, 260,
+    2166, 437, 261, 0, 350, 352, 0, 264, 345, 1849, 1855, 1857, 1859, 117, 0, 352,
+    2375, 2365, 2375, 2831, 0, 34, 350, 117, 461, 0, 355, 358, 112, 361, 364, 367,
+    370, 373, 376, 379, 382, 385, 388, 391, 394, 112, 117, 117, 117, 1625, 116, 116,
+    116, 116, 1627, 354, 397, 397, 263, 261, 34, 264, 117, 117, 117, 1625, 116, 116,
+    116, 116, 1627, 354, 397, 397, 263, 261, 34, 264, 0, 0, 0, 400, 0, 0,
+    0, 164, 164, 0, 403, 403, 0, 2832, 2833, 0, 0, 0, 0, 112, 37, 134,
+    138, 142, 146, 150, 154, 158, 114, 125, 129, 133, 137, 141, 145, 149, 153, 157,
+    161, 406, 409, 412, 415, 418, 421, 424, 427, 430, 120, 124, 128, 132, 136, 140,
+    144, 148, 152, 156, 160, 0, 433, 436, 439, 442, 445, 448, 451, 454, 457, 460,
+    463, 466, 469, 472, 475, 478, 481, 484, 487, 490, 493, 496, 499, 502, 505, 508,
+    33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479,
+    482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352,
+    271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116,
+    500, 354, 506, 509, 115, 0, 164, 0, 511, 513, 514, 0, 1629, 0, 0, 0,
+    0, 0, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847,
+    2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863,
+    2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879,
+    2880, 2881, 0, 2882, 0, 2883, 2884, 2885, 0, 2886, 0, 2887, 0, 2888, 0, 2638,
+    2656, 2637, 2645, 0, 2889, 0, 2890, 0, 461, 116, 2891, 2892, 2893, 0, 2894, 0,
+    2895, 0, 2896, 0, 2897, 0, 2898, 0, 2899, 0, 2900, 0, 2901, 0, 2902, 0,
+    2903, 0, 2904, 0, 2905, 0, 2906, 0, 2907, 0, 2908, 0, 2909, 0, 2910, 0,
+    2911, 0, 2912, 0, 2913, 0, 2914, 0, 2915, 0, 2916, 0, 2917, 0, 2918, 0,
+    2919, 0, 2920, 0, 2921, 0, 2922, 0, 2923, 0, 2924, 0, 2925, 0, 2926, 0,
+    2927, 0, 2928, 0, 2929, 0, 2930, 0, 2931, 0, 2932, 0, 2933, 0, 2934, 0,
+    2935, 0, 2936, 0, 2937, 0, 2938, 0, 2939, 0, 2940, 0, 2941, 0, 2942, 0,
+    2943, 0, 2944, 0, 2945, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2946,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2947, 0, 2948, 0, 605, 2949, 2950,
+    2951, 2952, 2953, 608, 2954, 2955, 2956, 2957, 626, 2958, 2959, 2960, 2961, 2962, 2963, 2964,
+    2965, 2966, 2967, 2968, 632, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 650, 2976, 2977, 2978,
+    2979, 1729, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993,
+    2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009,
+    3010, 3011, 3012, 3013, 653, 3014, 635, 644, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022,
+    3023, 641, 638, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036,
+    3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052,
+    3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068,
+    707, 710, 3069, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082,
+    3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097, 3098,
+    3099, 3100, 3101, 647, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113,
+    3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129,
+    3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145,
+    3146, 3147, 3148, 0, 3, 0, 3149, 0, 3150, 0, 632, 3151, 3152, 0, 0, 0,
+    0, 0, 1631, 1633, 0, 1635, 0, 1637, 0, 0, 0, 518, 3153, 3154, 521, 3155,
+    3156, 524, 3157, 527, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 530, 533, 3165, 3166, 536,
+    3167, 539, 542, 3168, 545, 548, 551, 554, 557, 3169, 3170, 3171, 3172, 3173, 3174, 3175,
+    3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 0, 3190,
+    3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206,
+    3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222,
+    3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 0, 0, 605, 608, 611, 614, 3232,
+    3233, 3234, 3235, 2952, 3236, 3237, 3238, 3239, 2955, 0, 0, 0, 517, 520, 523, 526,
+    529, 532, 535, 538, 541, 544, 547, 550, 553, 556, 559, 562, 565, 568, 571, 574,
+    577, 580, 583, 586, 589, 592, 595, 598, 601, 168, 172, 0, 604, 607, 610, 613,
+    616, 619, 622, 625, 628, 631, 634, 637, 640, 643, 646, 649, 652, 655, 658, 661,
+    664, 667, 670, 673, 676, 679, 682, 685, 688, 691, 694, 697, 700, 703, 706, 709,
+    3240, 3241, 3009, 3242, 0, 712, 868, 871, 297, 877, 994, 997, 1000, 1003, 1006, 1009,
+    366, 363, 1639, 1641, 1643, 518, 521, 524, 527, 530, 533, 536, 539, 542, 545, 548,
+    551, 554, 557, 560, 563, 566, 569, 572, 575, 578, 581, 584, 587, 590, 593, 596,
+    599, 1645, 1647, 3243, 0, 605, 608, 611, 614, 617, 620, 623, 626, 629, 632, 635,
+    638, 641, 644, 647, 650, 653, 256, 659, 259, 665, 668, 671, 674, 677, 3244, 3245,
+    2980, 3246, 3247, 3248, 3249, 3250, 704, 3251, 1730, 3232, 3233, 3234, 3252, 3253, 3254, 3255,
+    686, 689, 692, 695, 698, 3256, 1649, 1651, 1653, 1655, 1657, 294, 1659, 1642, 1661, 1663,
+    1665, 1667, 1669, 1671, 1673, 719, 722, 1675, 1677, 1679, 1681, 1683, 1685, 1687, 715, 718,
+    721, 1689, 724, 1691, 727, 74, 61, 736, 38, 739, 194, 26, 40, 757, 760, 63,
+    85, 39, 70, 1708, 90, 65, 777, 3257, 30, 762, 189, 3258, 215, 772, 775, 789,
+    78, 88, 808, 93, 98, 47, 28, 3259, 823, 829, 3260, 46, 99, 31, 103, 27,
+    50, 3261, 3262, 3263, 1693, 176, 180, 184, 730, 188, 733, 736, 38, 192, 739, 742,
+    745, 196, 200, 748, 751, 1695, 754, 204, 208, 26, 43, 26, 48, 45, 53, 58,
+    212, 757, 760, 763, 216, 63, 220, 766, 70, 769, 1697, 1699, 56, 1701, 772, 775,
+    68, 778, 224, 73, 781, 1703, 1705, 78, 228, 83, 784, 88, 1707, 787, 790, 793,
+    796, 799, 232, 802, 1709, 805, 808, 811, 236, 814, 817, 820, 93, 240, 98, 98,
+    244, 244, 28, 823, 826, 829, 248, 1711, 832, 252, 1713, 103, 50, 836, 839, 842,
+    845, 848, 851, 854, 857, 860, 863, 835, 838, 841, 844, 847, 850, 853, 856, 859,
+    862, 865, 868, 871, 874, 877, 880, 1715, 1717, 883, 1719, 1721, 886, 886, 889, 1723,
+    1725, 1727, 1729, 1731, 256, 881, 1733, 1735, 945, 1737, 1739, 1741, 1743, 261, 260, 1745,
+    1747, 1749, 1751, 1753, 270, 893, 892, 895, 898, 901, 1755, 1757, 1759, 1761, 1763, 1765,
+    1767, 904, 907, 910, 904, 907, 887, 910, 913, 916, 890, 919, 264, 264, 881, 922,
+    925, 928, 32, 32, 32, 1769, 1771, 1773, 1775, 1370, 1777, 1779, 942, 1781, 942, 1783,
+    1785, 1787, 1789, 1791, 1789, 1793, 1795, 0, 1797, 1799, 1801, 268, 0, 1803, 1805, 1807,
+    880, 1809, 1811, 910, 1813, 263, 1815, 931, 1817, 1741, 934, 937, 1819, 0, 940, 1821,
+    1823, 1825, 1827, 943, 946, 953, 956, 959, 962, 965, 968, 971, 974, 977, 949, 952,
+    955, 958, 961, 964, 967, 970, 973, 976, 979, 982, 985, 988, 991, 994, 997, 1000,
+    1003, 1006, 1009, 1012, 1015, 0, 0, 0, 0, 0, 0, 3264, 0, 3265, 0, 3266,
+    0, 3267, 0, 3268, 0, 2591, 0, 3269, 0, 3270, 0, 3271, 0, 3272, 0, 3273,
+    0, 3274, 0, 3275, 0, 3276, 0, 3277, 0, 3278, 0, 3279, 0, 3280, 0, 3281,
+    0, 3282, 0, 3283, 0, 3284, 0, 3285, 0, 3286, 0, 3287, 0, 3288, 0, 3289,
+    0, 3290, 0, 3291, 0, 3292, 0, 3293, 0, 3294, 0, 3295, 0, 3296, 0, 3297,
+    0, 3298, 0, 3299, 0, 2445, 2447, 0, 0, 0, 3300, 0, 3301, 0, 3302, 0,
+    3303, 0, 3304, 0, 3305, 0, 3306, 0, 3307, 0, 3308, 0, 3309, 0, 3310, 0,
+    3311, 0, 3312, 0, 3313, 0, 3314, 0, 3315, 0, 3316, 0, 3317, 0, 3318, 0,
+    3319, 0, 3320, 0, 3321, 0, 3322, 0, 3323, 0, 3324, 0, 3325, 0, 3326, 0,
+    3327, 0, 3328, 0, 3329, 0, 3330, 0, 3331, 0, 3332, 0, 3333, 0, 3334, 0,
+    3335, 0, 3336, 0, 3337, 0, 3337, 0, 3338, 0, 3339, 0, 3340, 3341, 0, 3342,
+    0, 3343, 0, 3344, 0, 3345, 0, 3346, 0, 2649, 0, 3347, 0, 3348, 0, 3349,
+    0, 3350, 0, 3351, 0, 3352, 0, 3353, 0, 3354, 0, 3355, 0, 3356, 0, 3357,
+    0, 3358, 0, 2349, 2640, 2648, 3359, 2650, 0, 3360, 3361, 2652, 3362, 3363, 0, 3364,
+    0, 3365, 0, 3366, 0, 3367, 0, 3368, 0, 3369, 0, 3370, 0, 3371, 2661, 3372,
+    3373, 0, 3374, 0, 0, 3375, 0, 0, 0, 0, 0, 3376, 0, 3377, 0, 0,
+    261, 352, 482, 3378, 0, 2210, 2228, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3302, 3379, 2883, 3380, 0, 3381, 0, 0, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389,
+    3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+    3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421,
+    3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437,
+    3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+    3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3462, 3463, 3094, 3464, 3465, 3466, 3467, 3147, 3468, 647, 3469, 3470, 3471, 3472,
+    3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488,
+    3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504,
+    3505, 3506, 3507, 3508, 3509, 3062, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517, 3518, 3519,
+    3520, 3132, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534,
+    3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3478, 3548, 3549,
+    3550, 3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565,
+    3566, 3567, 3096, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580,
+    3581, 3582, 2980, 3583, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 2964, 3591, 3592, 3593, 3594,
+    3595, 3596, 3597, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610,
+    3611, 3612, 3566, 3613, 3614, 3615, 3616, 3617, 3618, 1693, 3619, 3550, 3620, 3621, 3622, 3623,
+    3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639,
+    3478, 3640, 3641, 3642, 3643, 3146, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653,
+    3654, 3655, 620, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3552, 3665, 3666, 3667,
+    3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3101, 3678, 3679, 3680, 3681, 3682,
+    3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3054, 3691, 3692, 3693, 3694, 3695, 3696, 3697,
+    3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3079, 3707, 3082, 3708, 3709, 3710, 0,
+    3711, 0, 3712, 0, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3061, 0, 3722,
+    0, 3723, 0, 3724, 3725, 0, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735,
+    3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 2987, 3744, 3745, 3746, 3747, 3748, 3749, 3750,
+    3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 259, 3759, 3760, 3761, 3762, 674, 3763, 3764,
+    3765, 3766, 3767, 3602, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779,
+    3780, 3781, 3724, 3782, 3783, 3784, 3785, 3786, 3787, 0, 3788, 3789, 3790, 3791, 3792, 3793,
+    3794, 3795, 3738, 3796, 3797, 3798, 3711, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807,
+    3808, 3809, 3810, 3746, 3811, 3747, 3812, 3813, 3814, 3815, 3816, 3712, 3499, 3817, 3818, 3017,
+    3567, 3649, 3819, 3820, 3754, 3821, 3755, 3822, 3823, 3824, 3714, 3825, 3826, 3827, 3828, 3829,
+    3715, 3830, 3831, 3832, 3833, 3834, 3835, 3767, 3836, 3837, 3602, 3838, 3771, 3839, 3840, 3841,
+    3842, 3843, 3776, 3844, 3723, 3845, 3777, 3548, 3846, 3778, 3847, 3780, 3848, 3849, 3850, 3851,
+    3852, 3782, 3720, 3853, 3783, 3854, 3784, 3855, 3147, 3856, 3857, 3858, 3859, 3860, 3861, 3862,
+    3863, 3864, 3865, 3866, 0, 1018, 1019, 1022, 1018, 1021, 1829, 0, 1831, 1833, 1835, 1837,
+    1839, 0, 1841, 0, 1843, 3867, 1849, 1859, 1861, 1873, 1875, 3868, 1891, 1893, 2829, 1845,
+    1847, 1024, 1027, 1849, 1851, 1853, 1855, 1857, 1859, 1861, 1863, 1865, 0, 1867, 1869, 1871,
+    1873, 1875, 0, 1877, 0, 1879, 1881, 0, 1883, 1885, 0, 1887, 1889, 1891, 1024, 1893,
+    1895, 1897, 1899, 1901, 1903, 3869, 3870, 3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879,
+    3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895,
+    3896, 1335, 3897, 0, 0, 3898, 1443, 1914, 1916, 1443, 3899, 3900, 3901, 1918, 2, 1905,
+    1907, 1909, 1911, 1913, 1915, 1917, 1919, 289, 1921, 1923, 1925, 1919, 1927, 1929, 1324, 1228,
+    1931, 1933, 1935, 1057, 1060, 1066, 1069, 1937, 1939, 1941, 1943, 1945, 1947, 1091, 1058, 1061,
+    277, 1077, 1949, 1067, 1090, 1087, 1258, 1096, 1105, 1108, 1951, 1123, 1126, 1953, 1955, 1129,
+    1957, 1138, 282, 1959, 1147, 1961, 1963, 1156, 1321, 1965, 1967, 1969, 1159, 1971, 1973, 1975,
+    1977, 1979, 1981, 1983, 1297, 1985, 1987, 1174, 1165, 1177, 16, 1, 10, 17, 276, 1076,
+    1103, 1085, 1082, 1213, 1207, 1989, 1219, 1991, 1993, 1995, 1201, 1997, 1999, 1251, 1083, 1948,
+    1188, 2001, 1275, 2003, 2005, 2007, 1030, 1033, 1036, 1039, 1042, 1045, 2009, 2011, 1925, 2013,
+    1919, 1927, 274, 2015, 1931, 2017, 1933, 1935, 2019, 2021, 1069, 2023, 1937, 1939, 2025, 2027,
+    1943, 2029, 1945, 1947, 1965, 1967, 1971, 1973, 1975, 1983, 1297, 1985, 1987, 16, 1, 10,
+    2031, 1103, 2033, 2035, 1219, 2037, 1991, 1993, 2007, 2039, 2041, 1188, 1221, 2001, 1275, 1921,
+    1923, 2043, 1925, 2045, 1929, 1324, 1228, 1931, 2047, 1057, 1060, 1066, 1069, 2049, 1943, 1091,
+    1058, 1061, 277, 1077, 1067, 1090, 1087, 1258, 1096, 1105, 2051, 1108, 1951, 1123, 1126, 1953,
+    1955, 1957, 1138, 282, 1959, 1147, 1961, 1963, 1156, 1321, 1969, 1159, 1977, 1979, 1981, 1983,
+    1297, 1174, 1165, 1177, 16, 6, 17, 276, 1076, 1103, 1213, 1207, 1989, 1219, 2053, 1995,
+    1201, 2055, 1251, 1083, 1948, 1188, 11, 1925, 2045, 1931, 2047, 1069, 2049, 1943, 2057, 1096,
+    2059, 1117, 2061, 1983, 1297, 16, 1219, 2053, 1188, 11, 1048, 1051, 1054, 2063, 2065, 2067,
+    2069, 2071, 2073, 2075, 2077, 2079, 2081, 1124, 1169, 1094, 1115, 1241, 1229, 2083, 2085, 2087,
+    2089, 1114, 1111, 2091, 1117, 2093, 2095, 2097, 2099, 2063, 2065, 2067, 2069, 2071, 2073, 2075,
+    2077, 2079, 2081, 1124, 1169, 1094, 1115, 1241, 1229, 2083, 2085, 2087, 2089, 1114, 1111, 2091,
+    1117, 2093, 2095, 2097, 2099, 1114, 1111, 2091, 1117, 2059, 2061, 1129, 1090, 1087, 1258, 1114,
+    1111, 2091, 1129, 1957, 2101, 0, 1057, 1060, 1063, 1066, 1069, 1072, 1075, 1078, 1081, 1084,
+    1087, 1090, 1093, 1096, 1099, 1102, 1105, 1108, 1111, 1114, 1117, 1120, 1123, 1126, 1129, 1132,
+    1135, 1138, 1141, 1144, 1147, 1150, 1153, 1156, 1159, 1162, 1165, 1168, 1171, 1174, 1177, 1180,
+    1183, 276, 1186, 1189, 1192, 1076, 1195, 0, 1198, 1201, 1204, 1207, 1210, 1213, 1216, 1219,
+    1222, 1225, 1228, 1231, 1234, 1237, 1240, 1243, 1246, 1249, 1252, 1255, 1258, 1261, 1264, 1267,
+    1270, 1273, 1276, 1279, 1282, 1285, 1288, 1291, 1159, 1165, 1294, 1297, 1300, 1303, 1306, 1309,
+    1306, 1300, 1312, 1315, 1318, 1321, 1324, 1309, 1138, 1108, 1327, 1330, 0, 0, 0, 1333,
+    1336, 4, 272, 276, 280, 284, 9, 14, 0, 0, 18, 288, 0, 0, 2122, 3902,
+    0, 511, 2358, 1603, 1607, 3903, 3904, 0, 0, 0, 3905, 3906, 3907, 120, 123, 3908,
+    3909, 1366, 1368, 3910, 3911, 3912, 3913, 2832, 2833, 3914, 3915, 3916, 3917, 0, 3918, 3919,
+    1605, 3907, 2122, 3902, 0, 2358, 511, 1607, 1603, 3905, 120, 123, 3908, 3909, 1366, 1368,
+    3920, 3921, 3922, 2829, 3923, 3924, 3925, 513, 0, 3926, 3927, 3928, 3929, 0, 2103, 2105,
+    1030, 0, 1033, 0, 1036, 1048, 1039, 1051, 1042, 1054, 1045, 2107, 2109, 2111, 3930, 2114,
+    2116, 3931, 2118, 1905, 4, 274, 3932, 1057, 1941, 18, 277, 1067, 279, 2003, 275, 2012,
+    15, 1111, 0, 1123, 1129, 1957, 9, 1147, 1156, 1159, 273, 1, 17, 1207, 7, 14,
+    2, 11, 2113, 2115, 2117, 22, 0, 0, 0, 1603, 3933, 3920, 3927, 3928, 3921, 3934,
+    120, 123, 3922, 2829, 2122, 3923, 3149, 338, 115, 112, 37, 134, 138, 142, 146, 150,
+    154, 158, 511, 2358, 3924, 513, 3925, 1607, 3929, 33, 437, 261, 34, 350, 352, 271,
+    455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500,
+    354, 506, 509, 3918, 3926, 3919, 3935, 3907, 2826, 33, 437, 261, 34, 350, 352, 271,
+    455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500,
+    354, 506, 509, 3908, 3936, 3909, 3937, 3938, 3939, 3149, 3914, 3915, 3902, 3940, 3263, 79,
+    229, 3941, 86, 737, 3942, 205, 96, 51, 29, 74, 61, 736, 38, 739, 194, 26,
+    40, 757, 760, 63, 85, 39, 70, 1708, 90, 65, 777, 3257, 30, 762, 189, 3258,
+    215, 772, 775, 789, 78, 88, 808, 93, 98, 47, 28, 3259, 823, 829, 3260, 46,
+    99, 31, 103, 27, 50, 57, 1632, 1634, 0, 518, 3153, 3154, 521, 3155, 3156, 524,
+    3157, 527, 3158, 3159, 3160, 3161, 3162, 3163, 3164, 530, 533, 3165, 3166, 536, 3167, 539,
+    542, 3168, 545, 548, 551, 554, 557, 0, 3169, 3170, 3171, 3172, 3173, 3174, 0, 3175,
+    3176, 3177, 3178, 3179, 3180, 0, 3181, 3182, 3183, 3184, 3185, 3186, 0, 3187, 3188, 3189,
+    0, 3943, 3944, 3945, 1399, 3946, 3947, 3948, 0, 3949, 3950, 3951, 3952, 3953, 3954, 3955,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3956, 3957, 3958,
+    3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974,
+    3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990,
+    3991, 3992, 3993, 3994, 3995, 0, 0, 0, 0, 3996, 3997, 3998, 3999, 4000, 4001, 4002,
+    4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018,
+    4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 0, 0, 0,
+    0, 0, 0, 0, 0, 4032, 4033, 4034, 4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042,
+    0, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056, 4057,
+    0, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 0, 4065, 4066, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4067, 4068, 2167, 4069, 2250,
+    0, 4070, 4071, 4072, 4073, 2255, 2256, 4074, 4075, 4076, 4077, 4078, 4079, 2262, 4080, 2210,
+    4081, 4082, 4083, 4084, 4085, 3359, 4086, 4087, 4088, 4089, 4090, 4091, 2184, 4092, 4093, 482,
+    4094, 4095, 2885, 4096, 2273, 4097, 4098, 4099, 4100, 2277, 4101, 0, 4102, 4103, 4104, 4105,
+    4106, 4107, 4108, 4109, 4110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118,
+    4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134,
+    4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 4149, 4150,
+    4151, 4152, 4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4162, 4163, 4164, 4165, 4166, 4167, 4168, 4169,
+    4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185,
+    4186, 4187, 4188, 4189, 4190, 4191, 4192, 4193, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4201, 4202, 4203, 4204, 4205,
+    4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214, 4215, 4216, 4217, 4218, 4219, 4220, 4221,
+    4222, 4223, 4224, 4225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2119, 1339,
+    1339, 1342, 1345, 1348, 1351, 0, 0, 0, 1354, 1357, 1354, 1357, 1360, 1363, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 437, 261, 34, 350, 352,
+    271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116,
+    500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263,
+    264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437,
+    261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32,
+    36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 0,
+    117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354,
+    506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473,
+    345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34,
+    350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349,
+    348, 116, 500, 354, 506, 509, 33, 0, 261, 34, 0, 271, 0, 461, 260, 0,
+    473, 345, 479, 482, 0, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261,
+    34, 0, 352, 0, 455, 117, 461, 260, 263, 264, 473, 0, 479, 482, 32, 36,
+    349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117,
+    461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506,
+    509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345,
+    479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 0, 34, 350,
+    352, 271, 0, 461, 260, 263, 264, 473, 345, 479, 482, 0, 36, 349, 348, 116,
+    500, 354, 506, 0, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263,
+    264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437,
+    0, 34, 350, 352, 271, 0, 117, 461, 260, 263, 264, 0, 345, 0, 36, 349,
+    348, 116, 500, 354, 506, 0, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461,
+    260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509,
+    33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479,
+    482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352,
+    271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116,
+    500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263,
+    264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437,
+    261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32,
+    36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455,
+    117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354,
+    506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473,
+    345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34,
+    350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349,
+    348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461,
+    260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509,
+    33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479,
+    482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437, 261, 34, 350, 352,
+    271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32, 36, 349, 348, 116,
+    500, 354, 506, 509, 33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263,
+    264, 473, 345, 479, 482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 33, 437,
+    261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479, 482, 32,
+    36, 349, 348, 116, 500, 354, 506, 509, 4226, 4227, 0, 1577, 2364, 2365, 2366, 2367,
+    2368, 1587, 2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376, 2369, 2377, 2378, 2379,
+    2380, 2381, 2382, 1595, 4228, 1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371,
+    1735, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4229, 2367, 2369,
+    2370, 2380, 2376, 2375, 1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371, 1735,
+    2372, 2373, 2374, 2375, 2376, 2369, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4228, 1577, 2364,
+    2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376, 2377,
+    2378, 2379, 2380, 2381, 2382, 1595, 4229, 2367, 2369, 2370, 2380, 2376, 2375, 1577, 2364, 2365,
+    2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376, 2369, 2377,
+    2378, 2379, 2380, 2381, 2382, 1595, 4228, 1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436,
+    2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4229,
+    2367, 2369, 2370, 2380, 2376, 2375, 1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370,
+    2371, 1735, 2372, 2373, 2374, 2375, 2376, 2369, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4228,
+    1577, 2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375,
+    2376, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4229, 2367, 2369, 2370, 2380, 2376, 2375, 1577,
+    2364, 2365, 2366, 2367, 2368, 1587, 2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376,
+    2369, 2377, 2378, 2379, 2380, 2381, 2382, 1595, 4228, 1577, 2364, 2365, 2366, 2367, 2368, 1587,
+    2369, 1436, 2370, 2371, 1735, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382,
+    1595, 4229, 2367, 2369, 2370, 2380, 2376, 2375, 2388, 0, 115, 112, 37, 134, 138, 142,
+    146, 150, 154, 158, 115, 112, 37, 134, 138, 142, 146, 150, 154, 158, 115, 112,
+    37, 134, 138, 142, 146, 150, 154, 158, 115, 112, 37, 134, 138, 142, 146, 150,
+    154, 158, 115, 112, 37, 134, 138, 142, 146, 150, 154, 158, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2429, 2430, 2431, 2433, 2434, 2435, 2436,
+    2437, 2438, 2439, 2440, 2441, 2442, 2443, 2446, 2448, 2449, 3290, 2506, 2409, 2411, 2514, 2486,
+    4230, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2429, 2430, 2433, 2434, 2436, 2438,
+    2439, 2440, 2441, 2442, 2443, 2445, 2446, 2471, 2409, 2408, 2418, 2484, 3271, 2487, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4231, 4232, 4233,
+    4234, 4235, 4236, 4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249,
+    4250, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 274, 18, 279, 0, 14, 2012,
+    277, 1129, 11, 273, 1, 17, 1207, 15, 9, 1156, 0, 1159, 275, 1111, 1057, 1941,
+    1067, 2003, 1123, 1957, 1147, 4265, 3892, 4266, 4267, 0, 274, 18, 0, 7, 0, 277,
+    0, 11, 273, 1, 17, 1207, 15, 9, 1156, 0, 1159, 0, 1111, 1057, 1941, 1067,
+    0, 1123, 0, 1147, 0, 18, 0, 277, 0, 11, 0, 1, 0, 1207, 15, 9,
+    0, 0, 1159, 0, 1111, 0, 1067, 0, 1123, 0, 1147, 0, 3892, 0, 4267, 0,
+    274, 18, 0, 7, 0, 277, 1129, 11, 273, 0, 17, 1207, 15, 9, 1156, 0,
+    1159, 0, 1111, 1057, 1941, 1067, 0, 1123, 1957, 1147, 4265, 0, 4266, 0, 4, 274,
+    18, 279, 7, 14, 2012, 277, 1129, 11, 0, 1, 17, 1207, 15, 9, 1156, 0,
+    1159, 275, 1111, 1057, 1941, 1067, 2003, 1123, 1957, 1147, 0, 274, 18, 279, 0, 14,
+    2012, 277, 1129, 11, 0, 1, 17, 1207, 15, 9, 1156, 0, 1159, 275, 1111, 1057,
+    1941, 1067, 2003, 1123, 1957, 1147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2121, 2123, 2125, 2127, 2129, 2131, 2133, 2135, 2137, 2139, 0,
+    433, 436, 439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472, 475, 478,
+    481, 484, 487, 490, 493, 496, 499, 502, 505, 508, 1366, 261, 32, 1801, 2141, 0,
+    33, 437, 261, 34, 350, 352, 271, 455, 117, 461, 260, 263, 264, 473, 345, 479,
+    482, 32, 36, 349, 348, 116, 500, 354, 506, 509, 2143, 942, 2145, 1405, 1369, 2147,
+    0, 2149, 2151, 2153, 0, 2155, 0, 0, 0, 2157, 2159, 63, 0, 3006, 4268, 4269,
+    1697, 608, 4270, 4271, 3238, 4272, 4273, 4274, 3639, 4275, 4276, 4277, 4278, 4279, 4280, 3037,
+    4281, 4282, 4283, 4284, 4285, 4286, 605, 611, 4287, 3252, 3233, 3253, 4288, 3091, 1388, 4289,
+    4290, 4291, 4292, 659, 635, 4293, 4294, 4295, 4296, 0, 1372, 1375, 1378, 1381, 1384, 1387,
+    1390, 1393, 1396, 0, 4297, 4298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 112, 37, 134, 138, 142, 146,
+    150, 154, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4299, 4300, 4301, 4302, 4303, 3732, 4304, 4305, 4306, 4307, 3733, 4308, 4309, 4310, 3734, 4311,
+    4312, 4313, 4314, 4315, 4316, 4277, 4317, 4318, 4319, 4320, 4321, 3789, 4322, 2962, 4323, 4324,
+    4325, 4326, 4294, 4327, 4328, 3794, 3735, 3736, 3795, 4329, 4330, 3554, 4331, 3737, 4332, 4333,
+    4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4348, 4349,
+    4350, 4351, 4352, 4353, 3797, 4354, 4355, 4356, 4357, 3739, 4358, 4359, 4360, 3699, 4361, 4362,
+    4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4371, 4372, 4270, 4373, 4374, 4375, 4376, 4377,
+    4378, 4379, 4380, 4381, 4382, 0, 4383, 4384, 4385, 4386, 4387, 3550, 4388, 4389, 4390, 4391,
+    0, 2985, 4392, 4393, 2987, 4394, 4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404,
+    4405, 4406, 4407, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 3498, 4415, 2997, 4416, 4417, 4418,
+    4419, 4420, 4421, 4422, 4423, 4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431, 3744, 4432, 4433,
+    4434, 4435, 3809, 4435, 4436, 3746, 4437, 4438, 4439, 4440, 3747, 3471, 1726, 4441, 4442, 4443,
+    4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459,
+    4460, 4461, 3748, 4462, 4463, 4464, 4465, 4466, 4467, 3750, 4468, 4469, 4470, 4471, 4472, 4473,
+    4474, 4475, 3499, 3817, 4476, 4477, 4478, 4479, 4480, 4481, 4482, 4483, 3751, 4484, 4485, 4486,
+    4487, 3859, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 3567,
+    4501, 4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 3752, 3649, 4512, 4513, 4514,
+    4515, 4516, 4517, 4518, 4519, 3820, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 3821, 4528,
+    4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537, 0, 4538, 3823, 4539, 4540, 4541, 4542,
+    4543, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 3825, 4552, 4553, 4554, 4555, 4556, 4557,
+    4558, 3553, 4559, 4560, 4561, 4562, 4563, 4564, 4565, 3831, 4566, 4567, 4568, 4569, 4570, 4571,
+    3832, 3861, 4572, 4573, 4574, 4575, 4576, 3516, 3834, 4577, 4578, 3762, 4579, 4580, 3719, 4581,
+    4582, 3765, 4583, 4584, 4585, 4586, 0, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595,
+    4596, 4597, 4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611,
+    4612, 3771, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 4626,
+    4627, 4628, 4417, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640, 3570,
+    4641, 4642, 4643, 4644, 4645, 4646, 3774, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655,
+    4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 3511, 4667, 4668, 4669, 4670,
+    4671, 4672, 3841, 4673, 4674, 4675, 0, 4676, 4677, 4678, 4679, 3080, 4680, 4681, 4682, 4683,
+    4684, 4685, 4686, 4687, 4688, 4689, 4690, 3846, 3847, 3087, 4691, 4692, 4693, 4694, 4695, 4696,
+    4697, 4698, 4699, 4700, 4701, 4702, 3848, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711,
+    4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727,
+    4728, 4729, 4730, 4731, 4732, 3854, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742,
+    3855, 4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 3134, 4753, 3138, 4754, 4755,
+    4756, 4757, 3143, 4758, 0, 0, 0, 0, 0, 0, 0,
 }};
 
-struct mapped_32_code_point {
-  char32_t code_point;
-  char32_t mapped;
-};
+/// The index of the range that contains the first code point of each
+/// block of `1 << range_block_shift` code points
+inline constexpr auto range_block_shift = 8;
+
+inline constexpr auto range_index = std::array<std::uint16_t, 4353>{{
+    0, 91, 322, 417, 532, 732, 831, 841, 849, 863, 901, 966, 1028, 1078, 1115, 1148,
+    1196, 1204, 1206, 1232, 1251, 1251, 1251, 1257, 1277, 1291, 1309, 1323, 1329, 1394, 1499, 1749,
+    1944, 2030, 2144, 2150, 2153, 2277, 2277, 2277, 2277, 2277, 2277, 2285, 2290, 2471, 2500, 2509,
+    2724, 2744, 2860, 3109, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365, 3365,
+    3365, 3365, 3365, 3365, 3365, 3369, 3369, 3449, 3623, 3633, 3643, 3652, 3756, 3756, 3756, 3756,
+    3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756,
+    3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756,
+    3756, 3756, 3756, 3756, 3756, 3756, 3756, 3756, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761,
+    3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761,
+    3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3761, 3762, 4017, 4229, 4344, 4600, 4781, 4904,
+    5137, 5151, 5162, 5169, 5181, 5264, 5316, 5316, 5382, 5402, 5412, 5434, 5446, 5502, 5505, 5514,
+    5524, 5536, 5546, 5564, 5594, 5601, 5606, 5616, 5622, 5658, 5680, 5686, 5688, 5702, 5727, 5730,
+    5740, 5740, 5740, 5740, 5742, 5746, 5747, 5747, 5747, 5747, 5747, 5747, 5747, 5747, 5747, 5747,
+    5750, 5750, 5750, 5750, 5750, 5753, 5753, 5753, 5753, 5753, 5753, 5753, 5753, 5753, 5753, 5753,
+    5753, 5753, 5753, 5753, 5754, 5754, 5754, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755,
+    5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755,
+    5755, 5755, 5755, 5755, 5755, 5755, 5755, 5755, 5756, 5756, 5756, 5770, 5779, 5779, 5779, 5814,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824,
+    5824, 5824, 5824, 5824, 5824, 5824, 5824, 5824, 5826, 5826, 5826, 5826, 5826, 5828, 5829, 5829,
+    5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829,
+    5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829, 5829,
+    5836, 5836, 5846, 5847, 5847, 5847, 5847, 5847, 5847, 5847, 5847, 5847, 5848, 5858, 5858, 5858,
+    5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5858, 5859,
+    5865, 5867, 5888, 5894, 5898, 6151, 6404, 6658, 6908, 6908, 6908, 6913, 6913, 6913, 6913, 6914,
+    6918, 6993, 7000, 7006, 7006, 7008, 7008, 7008, 7017, 7021, 7060, 7060, 7060, 7062, 7065, 7240,
+    7241, 7252, 7337, 7401, 7401, 7401, 7401, 7407, 7415, 7427, 7427, 7445, 7459, 7459, 7459, 7459,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460, 7460,
+    7460, 7460, 7460, 7460, 7460, 7460, 7460, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462,
+    7462, 7462, 7462, 7462, 7462, 7462, 7462, 7462, 7464, 7466, 7466, 7466, 7466, 7466, 7466, 7466,
+    7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7466, 7468,
+    7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468,
+    7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7468, 7470, 7470, 7470, 7471,
+    7471, 7471, 7471, 7471, 7471, 7471, 7471, 7471, 7472, 7722, 7974, 8004, 8004, 8004, 8004, 8004,
+    8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005, 8005,
+    8005, 8005, 8005, 8005, 8007, 8007, 8007, 8007, 8007, 8007, 8007, 8007, 8007, 8007, 8007, 8007,
+    8007, 8007, 8007, 8007, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008, 8008,
+    8008, 8009, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010, 8010,
+    8010,
+}};
 
-constexpr static auto mapped_32 = std::array<mapped_32_code_point, 2201>{{
-    {U'\xfa6c', U'\x242ee'},  {U'\xfacf', U'\x2284a'},  {U'\xfad0', U'\x22844'},  {U'\xfad1', U'\x233d5'},
-    {U'\xfad5', U'\x25249'},  {U'\xfad6', U'\x25cd0'},  {U'\xfad7', U'\x27ed3'},  {U'\x10400', U'\x10428'},
-    {U'\x10401', U'\x10429'}, {U'\x10402', U'\x1042a'}, {U'\x10403', U'\x1042b'}, {U'\x10404', U'\x1042c'},
-    {U'\x10405', U'\x1042d'}, {U'\x10406', U'\x1042e'}, {U'\x10407', U'\x1042f'}, {U'\x10408', U'\x10430'},
-    {U'\x10409', U'\x10431'}, {U'\x1040a', U'\x10432'}, {U'\x1040b', U'\x10433'}, {U'\x1040c', U'\x10434'},
-    {U'\x1040d', U'\x10435'}, {U'\x1040e', U'\x10436'}, {U'\x1040f', U'\x10437'}, {U'\x10410', U'\x10438'},
-    {U'\x10411', U'\x10439'}, {U'\x10412', U'\x1043a'}, {U'\x10413', U'\x1043b'}, {U'\x10414', U'\x1043c'},
-    {U'\x10415', U'\x1043d'}, {U'\x10416', U'\x1043e'}, {U'\x10417', U'\x1043f'}, {U'\x10418', U'\x10440'},
-    {U'\x10419', U'\x10441'}, {U'\x1041a', U'\x10442'}, {U'\x1041b', U'\x10443'}, {U'\x1041c', U'\x10444'},
-    {U'\x1041d', U'\x10445'}, {U'\x1041e', U'\x10446'}, {U'\x1041f', U'\x10447'}, {U'\x10420', U'\x10448'},
-    {U'\x10421', U'\x10449'}, {U'\x10422', U'\x1044a'}, {U'\x10423', U'\x1044b'}, {U'\x10424', U'\x1044c'},
-    {U'\x10425', U'\x1044d'}, {U'\x10426', U'\x1044e'}, {U'\x10427', U'\x1044f'}, {U'\x104b0', U'\x104d8'},
-    {U'\x104b1', U'\x104d9'}, {U'\x104b2', U'\x104da'}, {U'\x104b3', U'\x104db'}, {U'\x104b4', U'\x104dc'},
-    {U'\x104b5', U'\x104dd'}, {U'\x104b6', U'\x104de'}, {U'\x104b7', U'\x104df'}, {U'\x104b8', U'\x104e0'},
-    {U'\x104b9', U'\x104e1'}, {U'\x104ba', U'\x104e2'}, {U'\x104bb', U'\x104e3'}, {U'\x104bc', U'\x104e4'},
-    {U'\x104bd', U'\x104e5'}, {U'\x104be', U'\x104e6'}, {U'\x104bf', U'\x104e7'}, {U'\x104c0', U'\x104e8'},
-    {U'\x104c1', U'\x104e9'}, {U'\x104c2', U'\x104ea'}, {U'\x104c3', U'\x104eb'}, {U'\x104c4', U'\x104ec'},
-    {U'\x104c5', U'\x104ed'}, {U'\x104c6', U'\x104ee'}, {U'\x104c7', U'\x104ef'}, {U'\x104c8', U'\x104f0'},
-    {U'\x104c9', U'\x104f1'}, {U'\x104ca', U'\x104f2'}, {U'\x104cb', U'\x104f3'}, {U'\x104cc', U'\x104f4'},
-    {U'\x104cd', U'\x104f5'}, {U'\x104ce', U'\x104f6'}, {U'\x104cf', U'\x104f7'}, {U'\x104d0', U'\x104f8'},
-    {U'\x104d1', U'\x104f9'}, {U'\x104d2', U'\x104fa'}, {U'\x104d3', U'\x104fb'}, {U'\x10570', U'\x10597'},
-    {U'\x10571', U'\x10598'}, {U'\x10572', U'\x10599'}, {U'\x10573', U'\x1059a'}, {U'\x10574', U'\x1059b'},
-    {U'\x10575', U'\x1059c'}, {U'\x10576', U'\x1059d'}, {U'\x10577', U'\x1059e'}, {U'\x10578', U'\x1059f'},
-    {U'\x10579', U'\x105a0'}, {U'\x1057a', U'\x105a1'}, {U'\x1057c', U'\x105a3'}, {U'\x1057d', U'\x105a4'},
-    {U'\x1057e', U'\x105a5'}, {U'\x1057f', U'\x105a6'}, {U'\x10580', U'\x105a7'}, {U'\x10581', U'\x105a8'},
-    {U'\x10582', U'\x105a9'}, {U'\x10583', U'\x105aa'}, {U'\x10584', U'\x105ab'}, {U'\x10585', U'\x105ac'},
-    {U'\x10586', U'\x105ad'}, {U'\x10587', U'\x105ae'}, {U'\x10588', U'\x105af'}, {U'\x10589', U'\x105b0'},
-    {U'\x1058a', U'\x105b1'}, {U'\x1058c', U'\x105b3'}, {U'\x1058d', U'\x105b4'}, {U'\x1058e', U'\x105b5'},
-    {U'\x1058f', U'\x105b6'}, {U'\x10590', U'\x105b7'}, {U'\x10591', U'\x105b8'}, {U'\x10592', U'\x105b9'},
-    {U'\x10594', U'\x105bb'}, {U'\x10595', U'\x105bc'}, {U'\x10781', U'\x02d0'},  {U'\x10782', U'\x02d1'},
-    {U'\x10783', U'\x00e6'},  {U'\x10784', U'\x0299'},  {U'\x10785', U'\x0253'},  {U'\x10787', U'\x02a3'},
-    {U'\x10788', U'\xab66'},  {U'\x10789', U'\x02a5'},  {U'\x1078a', U'\x02a4'},  {U'\x1078b', U'\x0256'},
-    {U'\x1078c', U'\x0257'},  {U'\x1078d', U'\x1d91'},  {U'\x1078e', U'\x0258'},  {U'\x1078f', U'\x025e'},
-    {U'\x10790', U'\x02a9'},  {U'\x10791', U'\x0264'},  {U'\x10792', U'\x0262'},  {U'\x10793', U'\x0260'},
-    {U'\x10794', U'\x029b'},  {U'\x10795', U'\x0127'},  {U'\x10796', U'\x029c'},  {U'\x10797', U'\x0267'},
-    {U'\x10798', U'\x0284'},  {U'\x10799', U'\x02aa'},  {U'\x1079a', U'\x02ab'},  {U'\x1079b', U'\x026c'},
-    {U'\x1079c', U'\x1df04'}, {U'\x1079d', U'\xa78e'},  {U'\x1079e', U'\x026e'},  {U'\x1079f', U'\x1df05'},
-    {U'\x107a0', U'\x028e'},  {U'\x107a1', U'\x1df06'}, {U'\x107a2', U'\x00f8'},  {U'\x107a3', U'\x0276'},
-    {U'\x107a4', U'\x0277'},  {U'\x107a5', U'\x0071'},  {U'\x107a6', U'\x027a'},  {U'\x107a7', U'\x1df08'},
-    {U'\x107a8', U'\x027d'},  {U'\x107a9', U'\x027e'},  {U'\x107aa', U'\x0280'},  {U'\x107ab', U'\x02a8'},
-    {U'\x107ac', U'\x02a6'},  {U'\x107ad', U'\xab67'},  {U'\x107ae', U'\x02a7'},  {U'\x107af', U'\x0288'},
-    {U'\x107b0', U'\x2c71'},  {U'\x107b2', U'\x028f'},  {U'\x107b3', U'\x02a1'},  {U'\x107b4', U'\x02a2'},
-    {U'\x107b5', U'\x0298'},  {U'\x107b6', U'\x01c0'},  {U'\x107b7', U'\x01c1'},  {U'\x107b8', U'\x01c2'},
-    {U'\x107b9', U'\x1df0a'}, {U'\x107ba', U'\x1df1e'}, {U'\x10c80', U'\x10cc0'}, {U'\x10c81', U'\x10cc1'},
-    {U'\x10c82', U'\x10cc2'}, {U'\x10c83', U'\x10cc3'}, {U'\x10c84', U'\x10cc4'}, {U'\x10c85', U'\x10cc5'},
-    {U'\x10c86', U'\x10cc6'}, {U'\x10c87', U'\x10cc7'}, {U'\x10c88', U'\x10cc8'}, {U'\x10c89', U'\x10cc9'},
-    {U'\x10c8a', U'\x10cca'}, {U'\x10c8b', U'\x10ccb'}, {U'\x10c8c', U'\x10ccc'}, {U'\x10c8d', U'\x10ccd'},
-    {U'\x10c8e', U'\x10cce'}, {U'\x10c8f', U'\x10ccf'}, {U'\x10c90', U'\x10cd0'}, {U'\x10c91', U'\x10cd1'},
-    {U'\x10c92', U'\x10cd2'}, {U'\x10c93', U'\x10cd3'}, {U'\x10c94', U'\x10cd4'}, {U'\x10c95', U'\x10cd5'},
-    {U'\x10c96', U'\x10cd6'}, {U'\x10c97', U'\x10cd7'}, {U'\x10c98', U'\x10cd8'}, {U'\x10c99', U'\x10cd9'},
-    {U'\x10c9a', U'\x10cda'}, {U'\x10c9b', U'\x10cdb'}, {U'\x10c9c', U'\x10cdc'}, {U'\x10c9d', U'\x10cdd'},
-    {U'\x10c9e', U'\x10cde'}, {U'\x10c9f', U'\x10cdf'}, {U'\x10ca0', U'\x10ce0'}, {U'\x10ca1', U'\x10ce1'},
-    {U'\x10ca2', U'\x10ce2'}, {U'\x10ca3', U'\x10ce3'}, {U'\x10ca4', U'\x10ce4'}, {U'\x10ca5', U'\x10ce5'},
-    {U'\x10ca6', U'\x10ce6'}, {U'\x10ca7', U'\x10ce7'}, {U'\x10ca8', U'\x10ce8'}, {U'\x10ca9', U'\x10ce9'},
-    {U'\x10caa', U'\x10cea'}, {U'\x10cab', U'\x10ceb'}, {U'\x10cac', U'\x10cec'}, {U'\x10cad', U'\x10ced'},
-    {U'\x10cae', U'\x10cee'}, {U'\x10caf', U'\x10cef'}, {U'\x10cb0', U'\x10cf0'}, {U'\x10cb1', U'\x10cf1'},
-    {U'\x10cb2', U'\x10cf2'}, {U'\x118a0', U'\x118c0'}, {U'\x118a1', U'\x118c1'}, {U'\x118a2', U'\x118c2'},
-    {U'\x118a3', U'\x118c3'}, {U'\x118a4', U'\x118c4'}, {U'\x118a5', U'\x118c5'}, {U'\x118a6', U'\x118c6'},
-    {U'\x118a7', U'\x118c7'}, {U'\x118a8', U'\x118c8'}, {U'\x118a9', U'\x118c9'}, {U'\x118aa', U'\x118ca'},
-    {U'\x118ab', U'\x118cb'}, {U'\x118ac', U'\x118cc'}, {U'\x118ad', U'\x118cd'}, {U'\x118ae', U'\x118ce'},
-    {U'\x118af', U'\x118cf'}, {U'\x118b0', U'\x118d0'}, {U'\x118b1', U'\x118d1'}, {U'\x118b2', U'\x118d2'},
-    {U'\x118b3', U'\x118d3'}, {U'\x118b4', U'\x118d4'}, {U'\x118b5', U'\x118d5'}, {U'\x118b6', U'\x118d6'},
-    {U'\x118b7', U'\x118d7'}, {U'\x118b8', U'\x118d8'}, {U'\x118b9', U'\x118d9'}, {U'\x118ba', U'\x118da'},
-    {U'\x118bb', U'\x118db'}, {U'\x118bc', U'\x118dc'}, {U'\x118bd', U'\x118dd'}, {U'\x118be', U'\x118de'},
-    {U'\x118bf', U'\x118df'}, {U'\x16e40', U'\x16e60'}, {U'\x16e41', U'\x16e61'}, {U'\x16e42', U'\x16e62'},
-    {U'\x16e43', U'\x16e63'}, {U'\x16e44', U'\x16e64'}, {U'\x16e45', U'\x16e65'}, {U'\x16e46', U'\x16e66'},
-    {U'\x16e47', U'\x16e67'}, {U'\x16e48', U'\x16e68'}, {U'\x16e49', U'\x16e69'}, {U'\x16e4a', U'\x16e6a'},
-    {U'\x16e4b', U'\x16e6b'}, {U'\x16e4c', U'\x16e6c'}, {U'\x16e4d', U'\x16e6d'}, {U'\x16e4e', U'\x16e6e'},
-    {U'\x16e4f', U'\x16e6f'}, {U'\x16e50', U'\x16e70'}, {U'\x16e51', U'\x16e71'}, {U'\x16e52', U'\x16e72'},
-    {U'\x16e53', U'\x16e73'}, {U'\x16e54', U'\x16e74'}, {U'\x16e55', U'\x16e75'}, {U'\x16e56', U'\x16e76'},
-    {U'\x16e57', U'\x16e77'}, {U'\x16e58', U'\x16e78'}, {U'\x16e59', U'\x16e79'}, {U'\x16e5a', U'\x16e7a'},
-    {U'\x16e5b', U'\x16e7b'}, {U'\x16e5c', U'\x16e7c'}, {U'\x16e5d', U'\x16e7d'}, {U'\x16e5e', U'\x16e7e'},
-    {U'\x16e5f', U'\x16e7f'}, {U'\x1d15e', U'\x1d157'}, {U'\x1d15f', U'\x1d158'}, {U'\x1d160', U'\x1d158'},
-    {U'\x1d161', U'\x1d158'}, {U'\x1d162', U'\x1d158'}, {U'\x1d163', U'\x1d158'}, {U'\x1d164', U'\x1d158'},
-    {U'\x1d1bb', U'\x1d1b9'}, {U'\x1d1bc', U'\x1d1ba'}, {U'\x1d1bd', U'\x1d1b9'}, {U'\x1d1be', U'\x1d1ba'},
-    {U'\x1d1bf', U'\x1d1b9'}, {U'\x1d1c0', U'\x1d1ba'}, {U'\x1d400', U'\x0061'},  {U'\x1d401', U'\x0062'},
-    {U'\x1d402', U'\x0063'},  {U'\x1d403', U'\x0064'},  {U'\x1d404', U'\x0065'},  {U'\x1d405', U'\x0066'},
-    {U'\x1d406', U'\x0067'},  {U'\x1d407', U'\x0068'},  {U'\x1d408', U'\x0069'},  {U'\x1d409', U'\x006a'},
-    {U'\x1d40a', U'\x006b'},  {U'\x1d40b', U'\x006c'},  {U'\x1d40c', U'\x006d'},  {U'\x1d40d', U'\x006e'},
-    {U'\x1d40e', U'\x006f'},  {U'\x1d40f', U'\x0070'},  {U'\x1d410', U'\x0071'},  {U'\x1d411', U'\x0072'},
-    {U'\x1d412', U'\x0073'},  {U'\x1d413', U'\x0074'},  {U'\x1d414', U'\x0075'},  {U'\x1d415', U'\x0076'},
-    {U'\x1d416', U'\x0077'},  {U'\x1d417', U'\x0078'},  {U'\x1d418', U'\x0079'},  {U'\x1d419', U'\x007a'},
-    {U'\x1d41a', U'\x0061'},  {U'\x1d41b', U'\x0062'},  {U'\x1d41c', U'\x0063'},  {U'\x1d41d', U'\x0064'},
-    {U'\x1d41e', U'\x0065'},  {U'\x1d41f', U'\x0066'},  {U'\x1d420', U'\x0067'},  {U'\x1d421', U'\x0068'},
-    {U'\x1d422', U'\x0069'},  {U'\x1d423', U'\x006a'},  {U'\x1d424', U'\x006b'},  {U'\x1d425', U'\x006c'},
-    {U'\x1d426', U'\x006d'},  {U'\x1d427', U'\x006e'},  {U'\x1d428', U'\x006f'},  {U'\x1d429', U'\x0070'},
-    {U'\x1d42a', U'\x0071'},  {U'\x1d42b', U'\x0072'},  {U'\x1d42c', U'\x0073'},  {U'\x1d42d', U'\x0074'},
-    {U'\x1d42e', U'\x0075'},  {U'\x1d42f', U'\x0076'},  {U'\x1d430', U'\x0077'},  {U'\x1d431', U'\x0078'},
-    {U'\x1d432', U'\x0079'},  {U'\x1d433', U'\x007a'},  {U'\x1d434', U'\x0061'},  {U'\x1d435', U'\x0062'},
-    {U'\x1d436', U'\x0063'},  {U'\x1d437', U'\x0064'},  {U'\x1d438', U'\x0065'},  {U'\x1d439', U'\x0066'},
-    {U'\x1d43a', U'\x0067'},  {U'\x1d43b', U'\x0068'},  {U'\x1d43c', U'\x0069'},  {U'\x1d43d', U'\x006a'},
-    {U'\x1d43e', U'\x006b'},  {U'\x1d43f', U'\x006c'},  {U'\x1d440', U'\x006d'},  {U'\x1d441', U'\x006e'},
-    {U'\x1d442', U'\x006f'},  {U'\x1d443', U'\x0070'},  {U'\x1d444', U'\x0071'},  {U'\x1d445', U'\x0072'},
-    {U'\x1d446', U'\x0073'},  {U'\x1d447', U'\x0074'},  {U'\x1d448', U'\x0075'},  {U'\x1d449', U'\x0076'},
-    {U'\x1d44a', U'\x0077'},  {U'\x1d44b', U'\x0078'},  {U'\x1d44c', U'\x0079'},  {U'\x1d44d', U'\x007a'},
-    {U'\x1d44e', U'\x0061'},  {U'\x1d44f', U'\x0062'},  {U'\x1d450', U'\x0063'},  {U'\x1d451', U'\x0064'},
-    {U'\x1d452', U'\x0065'},  {U'\x1d453', U'\x0066'},  {U'\x1d454', U'\x0067'},  {U'\x1d456', U'\x0069'},
-    {U'\x1d457', U'\x006a'},  {U'\x1d458', U'\x006b'},  {U'\x1d459', U'\x006c'},  {U'\x1d45a', U'\x006d'},
-    {U'\x1d45b', U'\x006e'},  {U'\x1d45c', U'\x006f'},  {U'\x1d45d', U'\x0070'},  {U'\x1d45e', U'\x0071'},
-    {U'\x1d45f', U'\x0072'},  {U'\x1d460', U'\x0073'},  {U'\x1d461', U'\x0074'},  {U'\x1d462', U'\x0075'},
-    {U'\x1d463', U'\x0076'},  {U'\x1d464', U'\x0077'},  {U'\x1d465', U'\x0078'},  {U'\x1d466', U'\x0079'},
-    {U'\x1d467', U'\x007a'},  {U'\x1d468', U'\x0061'},  {U'\x1d469', U'\x0062'},  {U'\x1d46a', U'\x0063'},
-    {U'\x1d46b', U'\x0064'},  {U'\x1d46c', U'\x0065'},  {U'\x1d46d', U'\x0066'},  {U'\x1d46e', U'\x0067'},
-    {U'\x1d46f', U'\x0068'},  {U'\x1d470', U'\x0069'},  {U'\x1d471', U'\x006a'},  {U'\x1d472', U'\x006b'},
-    {U'\x1d473', U'\x006c'},  {U'\x1d474', U'\x006d'},  {U'\x1d475', U'\x006e'},  {U'\x1d476', U'\x006f'},
-    {U'\x1d477', U'\x0070'},  {U'\x1d478', U'\x0071'},  {U'\x1d479', U'\x0072'},  {U'\x1d47a', U'\x0073'},
-    {U'\x1d47b', U'\x0074'},  {U'\x1d47c', U'\x0075'},  {U'\x1d47d', U'\x0076'},  {U'\x1d47e', U'\x0077'},
-    {U'\x1d47f', U'\x0078'},  {U'\x1d480', U'\x0079'},  {U'\x1d481', U'\x007a'},  {U'\x1d482', U'\x0061'},
-    {U'\x1d483', U'\x0062'},  {U'\x1d484', U'\x0063'},  {U'\x1d485', U'\x0064'},  {U'\x1d486', U'\x0065'},
-    {U'\x1d487', U'\x0066'},  {U'\x1d488', U'\x0067'},  {U'\x1d489', U'\x0068'},  {U'\x1d48a', U'\x0069'},
-    {U'\x1d48b', U'\x006a'},  {U'\x1d48c', U'\x006b'},  {U'\x1d48d', U'\x006c'},  {U'\x1d48e', U'\x006d'},
-    {U'\x1d48f', U'\x006e'},  {U'\x1d490', U'\x006f'},  {U'\x1d491', U'\x0070'},  {U'\x1d492', U'\x0071'},
-    {U'\x1d493', U'\x0072'},  {U'\x1d494', U'\x0073'},  {U'\x1d495', U'\x0074'},  {U'\x1d496', U'\x0075'},
-    {U'\x1d497', U'\x0076'},  {U'\x1d498', U'\x0077'},  {U'\x1d499', U'\x0078'},  {U'\x1d49a', U'\x0079'},
-    {U'\x1d49b', U'\x007a'},  {U'\x1d49c', U'\x0061'},  {U'\x1d49e', U'\x0063'},  {U'\x1d49f', U'\x0064'},
-    {U'\x1d4a2', U'\x0067'},  {U'\x1d4a5', U'\x006a'},  {U'\x1d4a6', U'\x006b'},  {U'\x1d4a9', U'\x006e'},
-    {U'\x1d4aa', U'\x006f'},  {U'\x1d4ab', U'\x0070'},  {U'\x1d4ac', U'\x0071'},  {U'\x1d4ae', U'\x0073'},
-    {U'\x1d4af', U'\x0074'},  {U'\x1d4b0', U'\x0075'},  {U'\x1d4b1', U'\x0076'},  {U'\x1d4b2', U'\x0077'},
-    {U'\x1d4b3', U'\x0078'},  {U'\x1d4b4', U'\x0079'},  {U'\x1d4b5', U'\x007a'},  {U'\x1d4b6', U'\x0061'},
-    {U'\x1d4b7', U'\x0062'},  {U'\x1d4b8', U'\x0063'},  {U'\x1d4b9', U'\x0064'},  {U'\x1d4bb', U'\x0066'},
-    {U'\x1d4bd', U'\x0068'},  {U'\x1d4be', U'\x0069'},  {U'\x1d4bf', U'\x006a'},  {U'\x1d4c0', U'\x006b'},
-    {U'\x1d4c1', U'\x006c'},  {U'\x1d4c2', U'\x006d'},  {U'\x1d4c3', U'\x006e'},  {U'\x1d4c5', U'\x0070'},
-    {U'\x1d4c6', U'\x0071'},  {U'\x1d4c7', U'\x0072'},  {U'\x1d4c8', U'\x0073'},  {U'\x1d4c9', U'\x0074'},
-    {U'\x1d4ca', U'\x0075'},  {U'\x1d4cb', U'\x0076'},  {U'\x1d4cc', U'\x0077'},  {U'\x1d4cd', U'\x0078'},
-    {U'\x1d4ce', U'\x0079'},  {U'\x1d4cf', U'\x007a'},  {U'\x1d4d0', U'\x0061'},  {U'\x1d4d1', U'\x0062'},
-    {U'\x1d4d2', U'\x0063'},  {U'\x1d4d3', U'\x0064'},  {U'\x1d4d4', U'\x0065'},  {U'\x1d4d5', U'\x0066'},
-    {U'\x1d4d6', U'\x0067'},  {U'\x1d4d7', U'\x0068'},  {U'\x1d4d8', U'\x0069'},  {U'\x1d4d9', U'\x006a'},
-    {U'\x1d4da', U'\x006b'},  {U'\x1d4db', U'\x006c'},  {U'\x1d4dc', U'\x006d'},  {U'\x1d4dd', U'\x006e'},
-    {U'\x1d4de', U'\x006f'},  {U'\x1d4df', U'\x0070'},  {U'\x1d4e0', U'\x0071'},  {U'\x1d4e1', U'\x0072'},
-    {U'\x1d4e2', U'\x0073'},  {U'\x1d4e3', U'\x0074'},  {U'\x1d4e4', U'\x0075'},  {U'\x1d4e5', U'\x0076'},
-    {U'\x1d4e6', U'\x0077'},  {U'\x1d4e7', U'\x0078'},  {U'\x1d4e8', U'\x0079'},  {U'\x1d4e9', U'\x007a'},
-    {U'\x1d4ea', U'\x0061'},  {U'\x1d4eb', U'\x0062'},  {U'\x1d4ec', U'\x0063'},  {U'\x1d4ed', U'\x0064'},
-    {U'\x1d4ee', U'\x0065'},  {U'\x1d4ef', U'\x0066'},  {U'\x1d4f0', U'\x0067'},  {U'\x1d4f1', U'\x0068'},
-    {U'\x1d4f2', U'\x0069'},  {U'\x1d4f3', U'\x006a'},  {U'\x1d4f4', U'\x006b'},  {U'\x1d4f5', U'\x006c'},
-    {U'\x1d4f6', U'\x006d'},  {U'\x1d4f7', U'\x006e'},  {U'\x1d4f8', U'\x006f'},  {U'\x1d4f9', U'\x0070'},
-    {U'\x1d4fa', U'\x0071'},  {U'\x1d4fb', U'\x0072'},  {U'\x1d4fc', U'\x0073'},  {U'\x1d4fd', U'\x0074'},
-    {U'\x1d4fe', U'\x0075'},  {U'\x1d4ff', U'\x0076'},  {U'\x1d500', U'\x0077'},  {U'\x1d501', U'\x0078'},
-    {U'\x1d502', U'\x0079'},  {U'\x1d503', U'\x007a'},  {U'\x1d504', U'\x0061'},  {U'\x1d505', U'\x0062'},
-    {U'\x1d507', U'\x0064'},  {U'\x1d508', U'\x0065'},  {U'\x1d509', U'\x0066'},  {U'\x1d50a', U'\x0067'},
-    {U'\x1d50d', U'\x006a'},  {U'\x1d50e', U'\x006b'},  {U'\x1d50f', U'\x006c'},  {U'\x1d510', U'\x006d'},
-    {U'\x1d511', U'\x006e'},  {U'\x1d512', U'\x006f'},  {U'\x1d513', U'\x0070'},  {U'\x1d514', U'\x0071'},
-    {U'\x1d516', U'\x0073'},  {U'\x1d517', U'\x0074'},  {U'\x1d518', U'\x0075'},  {U'\x1d519', U'\x0076'},
-    {U'\x1d51a', U'\x0077'},  {U'\x1d51b', U'\x0078'},  {U'\x1d51c', U'\x0079'},  {U'\x1d51e', U'\x0061'},
-    {U'\x1d51f', U'\x0062'},  {U'\x1d520', U'\x0063'},  {U'\x1d521', U'\x0064'},  {U'\x1d522', U'\x0065'},
-    {U'\x1d523', U'\x0066'},  {U'\x1d524', U'\x0067'},  {U'\x1d525', U'\x0068'},  {U'\x1d526', U'\x0069'},
-    {U'\x1d527', U'\x006a'},  {U'\x1d528', U'\x006b'},  {U'\x1d529', U'\x006c'},  {U'\x1d52a', U'\x006d'},
-    {U'\x1d52b', U'\x006e'},  {U'\x1d52c', U'\x006f'},  {U'\x1d52d', U'\x0070'},  {U'\x1d52e', U'\x0071'},
-    {U'\x1d52f', U'\x0072'},  {U'\x1d530', U'\x0073'},  {U'\x1d531', U'\x0074'},  {U'\x1d532', U'\x0075'},
-    {U'\x1d533', U'\x0076'},  {U'\x1d534', U'\x0077'},  {U'\x1d535', U'\x0078'},  {U'\x1d536', U'\x0079'},
-    {U'\x1d537', U'\x007a'},  {U'\x1d538', U'\x0061'},  {U'\x1d539', U'\x0062'},  {U'\x1d53b', U'\x0064'},
-    {U'\x1d53c', U'\x0065'},  {U'\x1d53d', U'\x0066'},  {U'\x1d53e', U'\x0067'},  {U'\x1d540', U'\x0069'},
-    {U'\x1d541', U'\x006a'},  {U'\x1d542', U'\x006b'},  {U'\x1d543', U'\x006c'},  {U'\x1d544', U'\x006d'},
-    {U'\x1d546', U'\x006f'},  {U'\x1d54a', U'\x0073'},  {U'\x1d54b', U'\x0074'},  {U'\x1d54c', U'\x0075'},
-    {U'\x1d54d', U'\x0076'},  {U'\x1d54e', U'\x0077'},  {U'\x1d54f', U'\x0078'},  {U'\x1d550', U'\x0079'},
-    {U'\x1d552', U'\x0061'},  {U'\x1d553', U'\x0062'},  {U'\x1d554', U'\x0063'},  {U'\x1d555', U'\x0064'},
-    {U'\x1d556', U'\x0065'},  {U'\x1d557', U'\x0066'},  {U'\x1d558', U'\x0067'},  {U'\x1d559', U'\x0068'},
-    {U'\x1d55a', U'\x0069'},  {U'\x1d55b', U'\x006a'},  {U'\x1d55c', U'\x006b'},  {U'\x1d55d', U'\x006c'},
-    {U'\x1d55e', U'\x006d'},  {U'\x1d55f', U'\x006e'},  {U'\x1d560', U'\x006f'},  {U'\x1d561', U'\x0070'},
-    {U'\x1d562', U'\x0071'},  {U'\x1d563', U'\x0072'},  {U'\x1d564', U'\x0073'},  {U'\x1d565', U'\x0074'},
-    {U'\x1d566', U'\x0075'},  {U'\x1d567', U'\x0076'},  {U'\x1d568', U'\x0077'},  {U'\x1d569', U'\x0078'},
-    {U'\x1d56a', U'\x0079'},  {U'\x1d56b', U'\x007a'},  {U'\x1d56c', U'\x0061'},  {U'\x1d56d', U'\x0062'},
-    {U'\x1d56e', U'\x0063'},  {U'\x1d56f', U'\x0064'},  {U'\x1d570', U'\x0065'},  {U'\x1d571', U'\x0066'},
-    {U'\x1d572', U'\x0067'},  {U'\x1d573', U'\x0068'},  {U'\x1d574', U'\x0069'},  {U'\x1d575', U'\x006a'},
-    {U'\x1d576', U'\x006b'},  {U'\x1d577', U'\x006c'},  {U'\x1d578', U'\x006d'},  {U'\x1d579', U'\x006e'},
-    {U'\x1d57a', U'\x006f'},  {U'\x1d57b', U'\x0070'},  {U'\x1d57c', U'\x0071'},  {U'\x1d57d', U'\x0072'},
-    {U'\x1d57e', U'\x0073'},  {U'\x1d57f', U'\x0074'},  {U'\x1d580', U'\x0075'},  {U'\x1d581', U'\x0076'},
-    {U'\x1d582', U'\x0077'},  {U'\x1d583', U'\x0078'},  {U'\x1d584', U'\x0079'},  {U'\x1d585', U'\x007a'},
-    {U'\x1d586', U'\x0061'},  {U'\x1d587', U'\x0062'},  {U'\x1d588', U'\x0063'},  {U'\x1d589', U'\x0064'},
-    {U'\x1d58a', U'\x0065'},  {U'\x1d58b', U'\x0066'},  {U'\x1d58c', U'\x0067'},  {U'\x1d58d', U'\x0068'},
-    {U'\x1d58e', U'\x0069'},  {U'\x1d58f', U'\x006a'},  {U'\x1d590', U'\x006b'},  {U'\x1d591', U'\x006c'},
-    {U'\x1d592', U'\x006d'},  {U'\x1d593', U'\x006e'},  {U'\x1d594', U'\x006f'},  {U'\x1d595', U'\x0070'},
-    {U'\x1d596', U'\x0071'},  {U'\x1d597', U'\x0072'},  {U'\x1d598', U'\x0073'},  {U'\x1d599', U'\x0074'},
-    {U'\x1d59a', U'\x0075'},  {U'\x1d59b', U'\x0076'},  {U'\x1d59c', U'\x0077'},  {U'\x1d59d', U'\x0078'},
-    {U'\x1d59e', U'\x0079'},  {U'\x1d59f', U'\x007a'},  {U'\x1d5a0', U'\x0061'},  {U'\x1d5a1', U'\x0062'},
-    {U'\x1d5a2', U'\x0063'},  {U'\x1d5a3', U'\x0064'},  {U'\x1d5a4', U'\x0065'},  {U'\x1d5a5', U'\x0066'},
-    {U'\x1d5a6', U'\x0067'},  {U'\x1d5a7', U'\x0068'},  {U'\x1d5a8', U'\x0069'},  {U'\x1d5a9', U'\x006a'},
-    {U'\x1d5aa', U'\x006b'},  {U'\x1d5ab', U'\x006c'},  {U'\x1d5ac', U'\x006d'},  {U'\x1d5ad', U'\x006e'},
-    {U'\x1d5ae', U'\x006f'},  {U'\x1d5af', U'\x0070'},  {U'\x1d5b0', U'\x0071'},  {U'\x1d5b1', U'\x0072'},
-    {U'\x1d5b2', U'\x0073'},  {U'\x1d5b3', U'\x0074'},  {U'\x1d5b4', U'\x0075'},  {U'\x1d5b5', U'\x0076'},
-    {U'\x1d5b6', U'\x0077'},  {U'\x1d5b7', U'\x0078'},  {U'\x1d5b8', U'\x0079'},  {U'\x1d5b9', U'\x007a'},
-    {U'\x1d5ba', U'\x0061'},  {U'\x1d5bb', U'\x0062'},  {U'\x1d5bc', U'\x0063'},  {U'\x1d5bd', U'\x0064'},
-    {U'\x1d5be', U'\x0065'},  {U'\x1d5bf', U'\x0066'},  {U'\x1d5c0', U'\x0067'},  {U'\x1d5c1', U'\x0068'},
-    {U'\x1d5c2', U'\x0069'},  {U'\x1d5c3', U'\x006a'},  {U'\x1d5c4', U'\x006b'},  {U'\x1d5c5', U'\x006c'},
-    {U'\x1d5c6', U'\x006d'},  {U'\x1d5c7', U'\x006e'},  {U'\x1d5c8', U'\x006f'},  {U'\x1d5c9', U'\x0070'},
-    {U'\x1d5ca', U'\x0071'},  {U'\x1d5cb', U'\x0072'},  {U'\x1d5cc', U'\x0073'},  {U'\x1d5cd', U'\x0074'},
-    {U'\x1d5ce', U'\x0075'},  {U'\x1d5cf', U'\x0076'},  {U'\x1d5d0', U'\x0077'},  {U'\x1d5d1', U'\x0078'},
-    {U'\x1d5d2', U'\x0079'},  {U'\x1d5d3', U'\x007a'},  {U'\x1d5d4', U'\x0061'},  {U'\x1d5d5', U'\x0062'},
-    {U'\x1d5d6', U'\x0063'},  {U'\x1d5d7', U'\x0064'},  {U'\x1d5d8', U'\x0065'},  {U'\x1d5d9', U'\x0066'},
-    {U'\x1d5da', U'\x0067'},  {U'\x1d5db', U'\x0068'},  {U'\x1d5dc', U'\x0069'},  {U'\x1d5dd', U'\x006a'},
-    {U'\x1d5de', U'\x006b'},  {U'\x1d5df', U'\x006c'},  {U'\x1d5e0', U'\x006d'},  {U'\x1d5e1', U'\x006e'},
-    {U'\x1d5e2', U'\x006f'},  {U'\x1d5e3', U'\x0070'},  {U'\x1d5e4', U'\x0071'},  {U'\x1d5e5', U'\x0072'},
-    {U'\x1d5e6', U'\x0073'},  {U'\x1d5e7', U'\x0074'},  {U'\x1d5e8', U'\x0075'},  {U'\x1d5e9', U'\x0076'},
-    {U'\x1d5ea', U'\x0077'},  {U'\x1d5eb', U'\x0078'},  {U'\x1d5ec', U'\x0079'},  {U'\x1d5ed', U'\x007a'},
-    {U'\x1d5ee', U'\x0061'},  {U'\x1d5ef', U'\x0062'},  {U'\x1d5f0', U'\x0063'},  {U'\x1d5f1', U'\x0064'},
-    {U'\x1d5f2', U'\x0065'},  {U'\x1d5f3', U'\x0066'},  {U'\x1d5f4', U'\x0067'},  {U'\x1d5f5', U'\x0068'},
-    {U'\x1d5f6', U'\x0069'},  {U'\x1d5f7', U'\x006a'},  {U'\x1d5f8', U'\x006b'},  {U'\x1d5f9', U'\x006c'},
-    {U'\x1d5fa', U'\x006d'},  {U'\x1d5fb', U'\x006e'},  {U'\x1d5fc', U'\x006f'},  {U'\x1d5fd', U'\x0070'},
-    {U'\x1d5fe', U'\x0071'},  {U'\x1d5ff', U'\x0072'},  {U'\x1d600', U'\x0073'},  {U'\x1d601', U'\x0074'},
-    {U'\x1d602', U'\x0075'},  {U'\x1d603', U'\x0076'},  {U'\x1d604', U'\x0077'},  {U'\x1d605', U'\x0078'},
-    {U'\x1d606', U'\x0079'},  {U'\x1d607', U'\x007a'},  {U'\x1d608', U'\x0061'},  {U'\x1d609', U'\x0062'},
-    {U'\x1d60a', U'\x0063'},  {U'\x1d60b', U'\x0064'},  {U'\x1d60c', U'\x0065'},  {U'\x1d60d', U'\x0066'},
-    {U'\x1d60e', U'\x0067'},  {U'\x1d60f', U'\x0068'},  {U'\x1d610', U'\x0069'},  {U'\x1d611', U'\x006a'},
-    {U'\x1d612', U'\x006b'},  {U'\x1d613', U'\x006c'},  {U'\x1d614', U'\x006d'},  {U'\x1d615', U'\x006e'},
-    {U'\x1d616', U'\x006f'},  {U'\x1d617', U'\x0070'},  {U'\x1d618', U'\x0071'},  {U'\x1d619', U'\x0072'},
-    {U'\x1d61a', U'\x0073'},  {U'\x1d61b', U'\x0074'},  {U'\x1d61c', U'\x0075'},  {U'\x1d61d', U'\x0076'},
-    {U'\x1d61e', U'\x0077'},  {U'\x1d61f', U'\x0078'},  {U'\x1d620', U'\x0079'},  {U'\x1d621', U'\x007a'},
-    {U'\x1d622', U'\x0061'},  {U'\x1d623', U'\x0062'},  {U'\x1d624', U'\x0063'},  {U'\x1d625', U'\x0064'},
-    {U'\x1d626', U'\x0065'},  {U'\x1d627', U'\x0066'},  {U'\x1d628', U'\x0067'},  {U'\x1d629', U'\x0068'},
-    {U'\x1d62a', U'\x0069'},  {U'\x1d62b', U'\x006a'},  {U'\x1d62c', U'\x006b'},  {U'\x1d62d', U'\x006c'},
-    {U'\x1d62e', U'\x006d'},  {U'\x1d62f', U'\x006e'},  {U'\x1d630', U'\x006f'},  {U'\x1d631', U'\x0070'},
-    {U'\x1d632', U'\x0071'},  {U'\x1d633', U'\x0072'},  {U'\x1d634', U'\x0073'},  {U'\x1d635', U'\x0074'},
-    {U'\x1d636', U'\x0075'},  {U'\x1d637', U'\x0076'},  {U'\x1d638', U'\x0077'},  {U'\x1d639', U'\x0078'},
-    {U'\x1d63a', U'\x0079'},  {U'\x1d63b', U'\x007a'},  {U'\x1d63c', U'\x0061'},  {U'\x1d63d', U'\x0062'},
-    {U'\x1d63e', U'\x0063'},  {U'\x1d63f', U'\x0064'},  {U'\x1d640', U'\x0065'},  {U'\x1d641', U'\x0066'},
-    {U'\x1d642', U'\x0067'},  {U'\x1d643', U'\x0068'},  {U'\x1d644', U'\x0069'},  {U'\x1d645', U'\x006a'},
-    {U'\x1d646', U'\x006b'},  {U'\x1d647', U'\x006c'},  {U'\x1d648', U'\x006d'},  {U'\x1d649', U'\x006e'},
-    {U'\x1d64a', U'\x006f'},  {U'\x1d64b', U'\x0070'},  {U'\x1d64c', U'\x0071'},  {U'\x1d64d', U'\x0072'},
-    {U'\x1d64e', U'\x0073'},  {U'\x1d64f', U'\x0074'},  {U'\x1d650', U'\x0075'},  {U'\x1d651', U'\x0076'},
-    {U'\x1d652', U'\x0077'},  {U'\x1d653', U'\x0078'},  {U'\x1d654', U'\x0079'},  {U'\x1d655', U'\x007a'},
-    {U'\x1d656', U'\x0061'},  {U'\x1d657', U'\x0062'},  {U'\x1d658', U'\x0063'},  {U'\x1d659', U'\x0064'},
-    {U'\x1d65a', U'\x0065'},  {U'\x1d65b', U'\x0066'},  {U'\x1d65c', U'\x0067'},  {U'\x1d65d', U'\x0068'},
-    {U'\x1d65e', U'\x0069'},  {U'\x1d65f', U'\x006a'},  {U'\x1d660', U'\x006b'},  {U'\x1d661', U'\x006c'},
-    {U'\x1d662', U'\x006d'},  {U'\x1d663', U'\x006e'},  {U'\x1d664', U'\x006f'},  {U'\x1d665', U'\x0070'},
-    {U'\x1d666', U'\x0071'},  {U'\x1d667', U'\x0072'},  {U'\x1d668', U'\x0073'},  {U'\x1d669', U'\x0074'},
-    {U'\x1d66a', U'\x0075'},  {U'\x1d66b', U'\x0076'},  {U'\x1d66c', U'\x0077'},  {U'\x1d66d', U'\x0078'},
-    {U'\x1d66e', U'\x0079'},  {U'\x1d66f', U'\x007a'},  {U'\x1d670', U'\x0061'},  {U'\x1d671', U'\x0062'},
-    {U'\x1d672', U'\x0063'},  {U'\x1d673', U'\x0064'},  {U'\x1d674', U'\x0065'},  {U'\x1d675', U'\x0066'},
-    {U'\x1d676', U'\x0067'},  {U'\x1d677', U'\x0068'},  {U'\x1d678', U'\x0069'},  {U'\x1d679', U'\x006a'},
-    {U'\x1d67a', U'\x006b'},  {U'\x1d67b', U'\x006c'},  {U'\x1d67c', U'\x006d'},  {U'\x1d67d', U'\x006e'},
-    {U'\x1d67e', U'\x006f'},  {U'\x1d67f', U'\x0070'},  {U'\x1d680', U'\x0071'},  {U'\x1d681', U'\x0072'},
-    {U'\x1d682', U'\x0073'},  {U'\x1d683', U'\x0074'},  {U'\x1d684', U'\x0075'},  {U'\x1d685', U'\x0076'},
-    {U'\x1d686', U'\x0077'},  {U'\x1d687', U'\x0078'},  {U'\x1d688', U'\x0079'},  {U'\x1d689', U'\x007a'},
-    {U'\x1d68a', U'\x0061'},  {U'\x1d68b', U'\x0062'},  {U'\x1d68c', U'\x0063'},  {U'\x1d68d', U'\x0064'},
-    {U'\x1d68e', U'\x0065'},  {U'\x1d68f', U'\x0066'},  {U'\x1d690', U'\x0067'},  {U'\x1d691', U'\x0068'},
-    {U'\x1d692', U'\x0069'},  {U'\x1d693', U'\x006a'},  {U'\x1d694', U'\x006b'},  {U'\x1d695', U'\x006c'},
-    {U'\x1d696', U'\x006d'},  {U'\x1d697', U'\x006e'},  {U'\x1d698', U'\x006f'},  {U'\x1d699', U'\x0070'},
-    {U'\x1d69a', U'\x0071'},  {U'\x1d69b', U'\x0072'},  {U'\x1d69c', U'\x0073'},  {U'\x1d69d', U'\x0074'},
-    {U'\x1d69e', U'\x0075'},  {U'\x1d69f', U'\x0076'},  {U'\x1d6a0', U'\x0077'},  {U'\x1d6a1', U'\x0078'},
-    {U'\x1d6a2', U'\x0079'},  {U'\x1d6a3', U'\x007a'},  {U'\x1d6a4', U'\x0131'},  {U'\x1d6a5', U'\x0237'},
-    {U'\x1d6a8', U'\x03b1'},  {U'\x1d6a9', U'\x03b2'},  {U'\x1d6aa', U'\x03b3'},  {U'\x1d6ab', U'\x03b4'},
-    {U'\x1d6ac', U'\x03b5'},  {U'\x1d6ad', U'\x03b6'},  {U'\x1d6ae', U'\x03b7'},  {U'\x1d6af', U'\x03b8'},
-    {U'\x1d6b0', U'\x03b9'},  {U'\x1d6b1', U'\x03ba'},  {U'\x1d6b2', U'\x03bb'},  {U'\x1d6b3', U'\x03bc'},
-    {U'\x1d6b4', U'\x03bd'},  {U'\x1d6b5', U'\x03be'},  {U'\x1d6b6', U'\x03bf'},  {U'\x1d6b7', U'\x03c0'},
-    {U'\x1d6b8', U'\x03c1'},  {U'\x1d6b9', U'\x03b8'},  {U'\x1d6ba', U'\x03c3'},  {U'\x1d6bb', U'\x03c4'},
-    {U'\x1d6bc', U'\x03c5'},  {U'\x1d6bd', U'\x03c6'},  {U'\x1d6be', U'\x03c7'},  {U'\x1d6bf', U'\x03c8'},
-    {U'\x1d6c0', U'\x03c9'},  {U'\x1d6c1', U'\x2207'},  {U'\x1d6c2', U'\x03b1'},  {U'\x1d6c3', U'\x03b2'},
-    {U'\x1d6c4', U'\x03b3'},  {U'\x1d6c5', U'\x03b4'},  {U'\x1d6c6', U'\x03b5'},  {U'\x1d6c7', U'\x03b6'},
-    {U'\x1d6c8', U'\x03b7'},  {U'\x1d6c9', U'\x03b8'},  {U'\x1d6ca', U'\x03b9'},  {U'\x1d6cb', U'\x03ba'},
-    {U'\x1d6cc', U'\x03bb'},  {U'\x1d6cd', U'\x03bc'},  {U'\x1d6ce', U'\x03bd'},  {U'\x1d6cf', U'\x03be'},
-    {U'\x1d6d0', U'\x03bf'},  {U'\x1d6d1', U'\x03c0'},  {U'\x1d6d2', U'\x03c1'},  {U'\x1d6d3', U'\x03c3'},
-    {U'\x1d6d5', U'\x03c4'},  {U'\x1d6d6', U'\x03c5'},  {U'\x1d6d7', U'\x03c6'},  {U'\x1d6d8', U'\x03c7'},
-    {U'\x1d6d9', U'\x03c8'},  {U'\x1d6da', U'\x03c9'},  {U'\x1d6db', U'\x2202'},  {U'\x1d6dc', U'\x03b5'},
-    {U'\x1d6dd', U'\x03b8'},  {U'\x1d6de', U'\x03ba'},  {U'\x1d6df', U'\x03c6'},  {U'\x1d6e0', U'\x03c1'},
-    {U'\x1d6e1', U'\x03c0'},  {U'\x1d6e2', U'\x03b1'},  {U'\x1d6e3', U'\x03b2'},  {U'\x1d6e4', U'\x03b3'},
-    {U'\x1d6e5', U'\x03b4'},  {U'\x1d6e6', U'\x03b5'},  {U'\x1d6e7', U'\x03b6'},  {U'\x1d6e8', U'\x03b7'},
-    {U'\x1d6e9', U'\x03b8'},  {U'\x1d6ea', U'\x03b9'},  {U'\x1d6eb', U'\x03ba'},  {U'\x1d6ec', U'\x03bb'},
-    {U'\x1d6ed', U'\x03bc'},  {U'\x1d6ee', U'\x03bd'},  {U'\x1d6ef', U'\x03be'},  {U'\x1d6f0', U'\x03bf'},
-    {U'\x1d6f1', U'\x03c0'},  {U'\x1d6f2', U'\x03c1'},  {U'\x1d6f3', U'\x03b8'},  {U'\x1d6f4', U'\x03c3'},
-    {U'\x1d6f5', U'\x03c4'},  {U'\x1d6f6', U'\x03c5'},  {U'\x1d6f7', U'\x03c6'},  {U'\x1d6f8', U'\x03c7'},
-    {U'\x1d6f9', U'\x03c8'},  {U'\x1d6fa', U'\x03c9'},  {U'\x1d6fb', U'\x2207'},  {U'\x1d6fc', U'\x03b1'},
-    {U'\x1d6fd', U'\x03b2'},  {U'\x1d6fe', U'\x03b3'},  {U'\x1d6ff', U'\x03b4'},  {U'\x1d700', U'\x03b5'},
-    {U'\x1d701', U'\x03b6'},  {U'\x1d702', U'\x03b7'},  {U'\x1d703', U'\x03b8'},  {U'\x1d704', U'\x03b9'},
-    {U'\x1d705', U'\x03ba'},  {U'\x1d706', U'\x03bb'},  {U'\x1d707', U'\x03bc'},  {U'\x1d708', U'\x03bd'},
-    {U'\x1d709', U'\x03be'},  {U'\x1d70a', U'\x03bf'},  {U'\x1d70b', U'\x03c0'},  {U'\x1d70c', U'\x03c1'},
-    {U'\x1d70d', U'\x03c3'},  {U'\x1d70f', U'\x03c4'},  {U'\x1d710', U'\x03c5'},  {U'\x1d711', U'\x03c6'},
-    {U'\x1d712', U'\x03c7'},  {U'\x1d713', U'\x03c8'},  {U'\x1d714', U'\x03c9'},  {U'\x1d715', U'\x2202'},
-    {U'\x1d716', U'\x03b5'},  {U'\x1d717', U'\x03b8'},  {U'\x1d718', U'\x03ba'},  {U'\x1d719', U'\x03c6'},
-    {U'\x1d71a', U'\x03c1'},  {U'\x1d71b', U'\x03c0'},  {U'\x1d71c', U'\x03b1'},  {U'\x1d71d', U'\x03b2'},
-    {U'\x1d71e', U'\x03b3'},  {U'\x1d71f', U'\x03b4'},  {U'\x1d720', U'\x03b5'},  {U'\x1d721', U'\x03b6'},
-    {U'\x1d722', U'\x03b7'},  {U'\x1d723', U'\x03b8'},  {U'\x1d724', U'\x03b9'},  {U'\x1d725', U'\x03ba'},
-    {U'\x1d726', U'\x03bb'},  {U'\x1d727', U'\x03bc'},  {U'\x1d728', U'\x03bd'},  {U'\x1d729', U'\x03be'},
-    {U'\x1d72a', U'\x03bf'},  {U'\x1d72b', U'\x03c0'},  {U'\x1d72c', U'\x03c1'},  {U'\x1d72d', U'\x03b8'},
-    {U'\x1d72e', U'\x03c3'},  {U'\x1d72f', U'\x03c4'},  {U'\x1d730', U'\x03c5'},  {U'\x1d731', U'\x03c6'},
-    {U'\x1d732', U'\x03c7'},  {U'\x1d733', U'\x03c8'},  {U'\x1d734', U'\x03c9'},  {U'\x1d735', U'\x2207'},
-    {U'\x1d736', U'\x03b1'},  {U'\x1d737', U'\x03b2'},  {U'\x1d738', U'\x03b3'},  {U'\x1d739', U'\x03b4'},
-    {U'\x1d73a', U'\x03b5'},  {U'\x1d73b', U'\x03b6'},  {U'\x1d73c', U'\x03b7'},  {U'\x1d73d', U'\x03b8'},
-    {U'\x1d73e', U'\x03b9'},  {U'\x1d73f', U'\x03ba'},  {U'\x1d740', U'\x03bb'},  {U'\x1d741', U'\x03bc'},
-    {U'\x1d742', U'\x03bd'},  {U'\x1d743', U'\x03be'},  {U'\x1d744', U'\x03bf'},  {U'\x1d745', U'\x03c0'},
-    {U'\x1d746', U'\x03c1'},  {U'\x1d747', U'\x03c3'},  {U'\x1d749', U'\x03c4'},  {U'\x1d74a', U'\x03c5'},
-    {U'\x1d74b', U'\x03c6'},  {U'\x1d74c', U'\x03c7'},  {U'\x1d74d', U'\x03c8'},  {U'\x1d74e', U'\x03c9'},
-    {U'\x1d74f', U'\x2202'},  {U'\x1d750', U'\x03b5'},  {U'\x1d751', U'\x03b8'},  {U'\x1d752', U'\x03ba'},
-    {U'\x1d753', U'\x03c6'},  {U'\x1d754', U'\x03c1'},  {U'\x1d755', U'\x03c0'},  {U'\x1d756', U'\x03b1'},
-    {U'\x1d757', U'\x03b2'},  {U'\x1d758', U'\x03b3'},  {U'\x1d759', U'\x03b4'},  {U'\x1d75a', U'\x03b5'},
-    {U'\x1d75b', U'\x03b6'},  {U'\x1d75c', U'\x03b7'},  {U'\x1d75d', U'\x03b8'},  {U'\x1d75e', U'\x03b9'},
-    {U'\x1d75f', U'\x03ba'},  {U'\x1d760', U'\x03bb'},  {U'\x1d761', U'\x03bc'},  {U'\x1d762', U'\x03bd'},
-    {U'\x1d763', U'\x03be'},  {U'\x1d764', U'\x03bf'},  {U'\x1d765', U'\x03c0'},  {U'\x1d766', U'\x03c1'},
-    {U'\x1d767', U'\x03b8'},  {U'\x1d768', U'\x03c3'},  {U'\x1d769', U'\x03c4'},  {U'\x1d76a', U'\x03c5'},
-    {U'\x1d76b', U'\x03c6'},  {U'\x1d76c', U'\x03c7'},  {U'\x1d76d', U'\x03c8'},  {U'\x1d76e', U'\x03c9'},
-    {U'\x1d76f', U'\x2207'},  {U'\x1d770', U'\x03b1'},  {U'\x1d771', U'\x03b2'},  {U'\x1d772', U'\x03b3'},
-    {U'\x1d773', U'\x03b4'},  {U'\x1d774', U'\x03b5'},  {U'\x1d775', U'\x03b6'},  {U'\x1d776', U'\x03b7'},
-    {U'\x1d777', U'\x03b8'},  {U'\x1d778', U'\x03b9'},  {U'\x1d779', U'\x03ba'},  {U'\x1d77a', U'\x03bb'},
-    {U'\x1d77b', U'\x03bc'},  {U'\x1d77c', U'\x03bd'},  {U'\x1d77d', U'\x03be'},  {U'\x1d77e', U'\x03bf'},
-    {U'\x1d77f', U'\x03c0'},  {U'\x1d780', U'\x03c1'},  {U'\x1d781', U'\x03c3'},  {U'\x1d783', U'\x03c4'},
-    {U'\x1d784', U'\x03c5'},  {U'\x1d785', U'\x03c6'},  {U'\x1d786', U'\x03c7'},  {U'\x1d787', U'\x03c8'},
-    {U'\x1d788', U'\x03c9'},  {U'\x1d789', U'\x2202'},  {U'\x1d78a', U'\x03b5'},  {U'\x1d78b', U'\x03b8'},
-    {U'\x1d78c', U'\x03ba'},  {U'\x1d78d', U'\x03c6'},  {U'\x1d78e', U'\x03c1'},  {U'\x1d78f', U'\x03c0'},
-    {U'\x1d790', U'\x03b1'},  {U'\x1d791', U'\x03b2'},  {U'\x1d792', U'\x03b3'},  {U'\x1d793', U'\x03b4'},
-    {U'\x1d794', U'\x03b5'},  {U'\x1d795', U'\x03b6'},  {U'\x1d796', U'\x03b7'},  {U'\x1d797', U'\x03b8'},
-    {U'\x1d798', U'\x03b9'},  {U'\x1d799', U'\x03ba'},  {U'\x1d79a', U'\x03bb'},  {U'\x1d79b', U'\x03bc'},
-    {U'\x1d79c', U'\x03bd'},  {U'\x1d79d', U'\x03be'},  {U'\x1d79e', U'\x03bf'},  {U'\x1d79f', U'\x03c0'},
-    {U'\x1d7a0', U'\x03c1'},  {U'\x1d7a1', U'\x03b8'},  {U'\x1d7a2', U'\x03c3'},  {U'\x1d7a3', U'\x03c4'},
-    {U'\x1d7a4', U'\x03c5'},  {U'\x1d7a5', U'\x03c6'},  {U'\x1d7a6', U'\x03c7'},  {U'\x1d7a7', U'\x03c8'},
-    {U'\x1d7a8', U'\x03c9'},  {U'\x1d7a9', U'\x2207'},  {U'\x1d7aa', U'\x03b1'},  {U'\x1d7ab', U'\x03b2'},
-    {U'\x1d7ac', U'\x03b3'},  {U'\x1d7ad', U'\x03b4'},  {U'\x1d7ae', U'\x03b5'},  {U'\x1d7af', U'\x03b6'},
-    {U'\x1d7b0', U'\x03b7'},  {U'\x1d7b1', U'\x03b8'},  {U'\x1d7b2', U'\x03b9'},  {U'\x1d7b3', U'\x03ba'},
-    {U'\x1d7b4', U'\x03bb'},  {U'\x1d7b5', U'\x03bc'},  {U'\x1d7b6', U'\x03bd'},  {U'\x1d7b7', U'\x03be'},
-    {U'\x1d7b8', U'\x03bf'},  {U'\x1d7b9', U'\x03c0'},  {U'\x1d7ba', U'\x03c1'},  {U'\x1d7bb', U'\x03c3'},
-    {U'\x1d7bd', U'\x03c4'},  {U'\x1d7be', U'\x03c5'},  {U'\x1d7bf', U'\x03c6'},  {U'\x1d7c0', U'\x03c7'},
-    {U'\x1d7c1', U'\x03c8'},  {U'\x1d7c2', U'\x03c9'},  {U'\x1d7c3', U'\x2202'},  {U'\x1d7c4', U'\x03b5'},
-    {U'\x1d7c5', U'\x03b8'},  {U'\x1d7c6', U'\x03ba'},  {U'\x1d7c7', U'\x03c6'},  {U'\x1d7c8', U'\x03c1'},
-    {U'\x1d7c9', U'\x03c0'},  {U'\x1d7ca', U'\x03dd'},  {U'\x1d7ce', U'\x0030'},  {U'\x1d7cf', U'\x0031'},
-    {U'\x1d7d0', U'\x0032'},  {U'\x1d7d1', U'\x0033'},  {U'\x1d7d2', U'\x0034'},  {U'\x1d7d3', U'\x0035'},
-    {U'\x1d7d4', U'\x0036'},  {U'\x1d7d5', U'\x0037'},  {U'\x1d7d6', U'\x0038'},  {U'\x1d7d7', U'\x0039'},
-    {U'\x1d7d8', U'\x0030'},  {U'\x1d7d9', U'\x0031'},  {U'\x1d7da', U'\x0032'},  {U'\x1d7db', U'\x0033'},
-    {U'\x1d7dc', U'\x0034'},  {U'\x1d7dd', U'\x0035'},  {U'\x1d7de', U'\x0036'},  {U'\x1d7df', U'\x0037'},
-    {U'\x1d7e0', U'\x0038'},  {U'\x1d7e1', U'\x0039'},  {U'\x1d7e2', U'\x0030'},  {U'\x1d7e3', U'\x0031'},
-    {U'\x1d7e4', U'\x0032'},  {U'\x1d7e5', U'\x0033'},  {U'\x1d7e6', U'\x0034'},  {U'\x1d7e7', U'\x0035'},
-    {U'\x1d7e8', U'\x0036'},  {U'\x1d7e9', U'\x0037'},  {U'\x1d7ea', U'\x0038'},  {U'\x1d7eb', U'\x0039'},
-    {U'\x1d7ec', U'\x0030'},  {U'\x1d7ed', U'\x0031'},  {U'\x1d7ee', U'\x0032'},  {U'\x1d7ef', U'\x0033'},
-    {U'\x1d7f0', U'\x0034'},  {U'\x1d7f1', U'\x0035'},  {U'\x1d7f2', U'\x0036'},  {U'\x1d7f3', U'\x0037'},
-    {U'\x1d7f4', U'\x0038'},  {U'\x1d7f5', U'\x0039'},  {U'\x1d7f6', U'\x0030'},  {U'\x1d7f7', U'\x0031'},
-    {U'\x1d7f8', U'\x0032'},  {U'\x1d7f9', U'\x0033'},  {U'\x1d7fa', U'\x0034'},  {U'\x1d7fb', U'\x0035'},
-    {U'\x1d7fc', U'\x0036'},  {U'\x1d7fd', U'\x0037'},  {U'\x1d7fe', U'\x0038'},  {U'\x1d7ff', U'\x0039'},
-    {U'\x1e030', U'\x0430'},  {U'\x1e031', U'\x0431'},  {U'\x1e032', U'\x0432'},  {U'\x1e033', U'\x0433'},
-    {U'\x1e034', U'\x0434'},  {U'\x1e035', U'\x0435'},  {U'\x1e036', U'\x0436'},  {U'\x1e037', U'\x0437'},
-    {U'\x1e038', U'\x0438'},  {U'\x1e039', U'\x043a'},  {U'\x1e03a', U'\x043b'},  {U'\x1e03b', U'\x043c'},
-    {U'\x1e03c', U'\x043e'},  {U'\x1e03d', U'\x043f'},  {U'\x1e03e', U'\x0440'},  {U'\x1e03f', U'\x0441'},
-    {U'\x1e040', U'\x0442'},  {U'\x1e041', U'\x0443'},  {U'\x1e042', U'\x0444'},  {U'\x1e043', U'\x0445'},
-    {U'\x1e044', U'\x0446'},  {U'\x1e045', U'\x0447'},  {U'\x1e046', U'\x0448'},  {U'\x1e047', U'\x044b'},
-    {U'\x1e048', U'\x044d'},  {U'\x1e049', U'\x044e'},  {U'\x1e04a', U'\xa689'},  {U'\x1e04b', U'\x04d9'},
-    {U'\x1e04c', U'\x0456'},  {U'\x1e04d', U'\x0458'},  {U'\x1e04e', U'\x04e9'},  {U'\x1e04f', U'\x04af'},
-    {U'\x1e050', U'\x04cf'},  {U'\x1e051', U'\x0430'},  {U'\x1e052', U'\x0431'},  {U'\x1e053', U'\x0432'},
-    {U'\x1e054', U'\x0433'},  {U'\x1e055', U'\x0434'},  {U'\x1e056', U'\x0435'},  {U'\x1e057', U'\x0436'},
-    {U'\x1e058', U'\x0437'},  {U'\x1e059', U'\x0438'},  {U'\x1e05a', U'\x043a'},  {U'\x1e05b', U'\x043b'},
-    {U'\x1e05c', U'\x043e'},  {U'\x1e05d', U'\x043f'},  {U'\x1e05e', U'\x0441'},  {U'\x1e05f', U'\x0443'},
-    {U'\x1e060', U'\x0444'},  {U'\x1e061', U'\x0445'},  {U'\x1e062', U'\x0446'},  {U'\x1e063', U'\x0447'},
-    {U'\x1e064', U'\x0448'},  {U'\x1e065', U'\x044a'},  {U'\x1e066', U'\x044b'},  {U'\x1e067', U'\x0491'},
-    {U'\x1e068', U'\x0456'},  {U'\x1e069', U'\x0455'},  {U'\x1e06a', U'\x045f'},  {U'\x1e06b', U'\x04ab'},
-    {U'\x1e06c', U'\xa651'},  {U'\x1e06d', U'\x04b1'},  {U'\x1e900', U'\x1e922'}, {U'\x1e901', U'\x1e923'},
-    {U'\x1e902', U'\x1e924'}, {U'\x1e903', U'\x1e925'}, {U'\x1e904', U'\x1e926'}, {U'\x1e905', U'\x1e927'},
-    {U'\x1e906', U'\x1e928'}, {U'\x1e907', U'\x1e929'}, {U'\x1e908', U'\x1e92a'}, {U'\x1e909', U'\x1e92b'},
-    {U'\x1e90a', U'\x1e92c'}, {U'\x1e90b', U'\x1e92d'}, {U'\x1e90c', U'\x1e92e'}, {U'\x1e90d', U'\x1e92f'},
-    {U'\x1e90e', U'\x1e930'}, {U'\x1e90f', U'\x1e931'}, {U'\x1e910', U'\x1e932'}, {U'\x1e911', U'\x1e933'},
-    {U'\x1e912', U'\x1e934'}, {U'\x1e913', U'\x1e935'}, {U'\x1e914', U'\x1e936'}, {U'\x1e915', U'\x1e937'},
-    {U'\x1e916', U'\x1e938'}, {U'\x1e917', U'\x1e939'}, {U'\x1e918', U'\x1e93a'}, {U'\x1e919', U'\x1e93b'},
-    {U'\x1e91a', U'\x1e93c'}, {U'\x1e91b', U'\x1e93d'}, {U'\x1e91c', U'\x1e93e'}, {U'\x1e91d', U'\x1e93f'},
-    {U'\x1e91e', U'\x1e940'}, {U'\x1e91f', U'\x1e941'}, {U'\x1e920', U'\x1e942'}, {U'\x1e921', U'\x1e943'},
-    {U'\x1ee00', U'\x0627'},  {U'\x1ee01', U'\x0628'},  {U'\x1ee02', U'\x062c'},  {U'\x1ee03', U'\x062f'},
-    {U'\x1ee05', U'\x0648'},  {U'\x1ee06', U'\x0632'},  {U'\x1ee07', U'\x062d'},  {U'\x1ee08', U'\x0637'},
-    {U'\x1ee09', U'\x064a'},  {U'\x1ee0a', U'\x0643'},  {U'\x1ee0b', U'\x0644'},  {U'\x1ee0c', U'\x0645'},
-    {U'\x1ee0d', U'\x0646'},  {U'\x1ee0e', U'\x0633'},  {U'\x1ee0f', U'\x0639'},  {U'\x1ee10', U'\x0641'},
-    {U'\x1ee11', U'\x0635'},  {U'\x1ee12', U'\x0642'},  {U'\x1ee13', U'\x0631'},  {U'\x1ee14', U'\x0634'},
-    {U'\x1ee15', U'\x062a'},  {U'\x1ee16', U'\x062b'},  {U'\x1ee17', U'\x062e'},  {U'\x1ee18', U'\x0630'},
-    {U'\x1ee19', U'\x0636'},  {U'\x1ee1a', U'\x0638'},  {U'\x1ee1b', U'\x063a'},  {U'\x1ee1c', U'\x066e'},
-    {U'\x1ee1d', U'\x06ba'},  {U'\x1ee1e', U'\x06a1'},  {U'\x1ee1f', U'\x066f'},  {U'\x1ee21', U'\x0628'},
-    {U'\x1ee22', U'\x062c'},  {U'\x1ee24', U'\x0647'},  {U'\x1ee27', U'\x062d'},  {U'\x1ee29', U'\x064a'},
-    {U'\x1ee2a', U'\x0643'},  {U'\x1ee2b', U'\x0644'},  {U'\x1ee2c', U'\x0645'},  {U'\x1ee2d', U'\x0646'},
-    {U'\x1ee2e', U'\x0633'},  {U'\x1ee2f', U'\x0639'},  {U'\x1ee30', U'\x0641'},  {U'\x1ee31', U'\x0635'},
-    {U'\x1ee32', U'\x0642'},  {U'\x1ee34', U'\x0634'},  {U'\x1ee35', U'\x062a'},  {U'\x1ee36', U'\x062b'},
-    {U'\x1ee37', U'\x062e'},  {U'\x1ee39', U'\x0636'},  {U'\x1ee3b', U'\x063a'},  {U'\x1ee42', U'\x062c'},
-    {U'\x1ee47', U'\x062d'},  {U'\x1ee49', U'\x064a'},  {U'\x1ee4b', U'\x0644'},  {U'\x1ee4d', U'\x0646'},
-    {U'\x1ee4e', U'\x0633'},  {U'\x1ee4f', U'\x0639'},  {U'\x1ee51', U'\x0635'},  {U'\x1ee52', U'\x0642'},
-    {U'\x1ee54', U'\x0634'},  {U'\x1ee57', U'\x062e'},  {U'\x1ee59', U'\x0636'},  {U'\x1ee5b', U'\x063a'},
-    {U'\x1ee5d', U'\x06ba'},  {U'\x1ee5f', U'\x066f'},  {U'\x1ee61', U'\x0628'},  {U'\x1ee62', U'\x062c'},
-    {U'\x1ee64', U'\x0647'},  {U'\x1ee67', U'\x062d'},  {U'\x1ee68', U'\x0637'},  {U'\x1ee69', U'\x064a'},
-    {U'\x1ee6a', U'\x0643'},  {U'\x1ee6c', U'\x0645'},  {U'\x1ee6d', U'\x0646'},  {U'\x1ee6e', U'\x0633'},
-    {U'\x1ee6f', U'\x0639'},  {U'\x1ee70', U'\x0641'},  {U'\x1ee71', U'\x0635'},  {U'\x1ee72', U'\x0642'},
-    {U'\x1ee74', U'\x0634'},  {U'\x1ee75', U'\x062a'},  {U'\x1ee76', U'\x062b'},  {U'\x1ee77', U'\x062e'},
-    {U'\x1ee79', U'\x0636'},  {U'\x1ee7a', U'\x0638'},  {U'\x1ee7b', U'\x063a'},  {U'\x1ee7c', U'\x066e'},
-    {U'\x1ee7e', U'\x06a1'},  {U'\x1ee80', U'\x0627'},  {U'\x1ee81', U'\x0628'},  {U'\x1ee82', U'\x062c'},
-    {U'\x1ee83', U'\x062f'},  {U'\x1ee84', U'\x0647'},  {U'\x1ee85', U'\x0648'},  {U'\x1ee86', U'\x0632'},
-    {U'\x1ee87', U'\x062d'},  {U'\x1ee88', U'\x0637'},  {U'\x1ee89', U'\x064a'},  {U'\x1ee8b', U'\x0644'},
-    {U'\x1ee8c', U'\x0645'},  {U'\x1ee8d', U'\x0646'},  {U'\x1ee8e', U'\x0633'},  {U'\x1ee8f', U'\x0639'},
-    {U'\x1ee90', U'\x0641'},  {U'\x1ee91', U'\x0635'},  {U'\x1ee92', U'\x0642'},  {U'\x1ee93', U'\x0631'},
-    {U'\x1ee94', U'\x0634'},  {U'\x1ee95', U'\x062a'},  {U'\x1ee96', U'\x062b'},  {U'\x1ee97', U'\x062e'},
-    {U'\x1ee98', U'\x0630'},  {U'\x1ee99', U'\x0636'},  {U'\x1ee9a', U'\x0638'},  {U'\x1ee9b', U'\x063a'},
-    {U'\x1eea1', U'\x0628'},  {U'\x1eea2', U'\x062c'},  {U'\x1eea3', U'\x062f'},  {U'\x1eea5', U'\x0648'},
-    {U'\x1eea6', U'\x0632'},  {U'\x1eea7', U'\x062d'},  {U'\x1eea8', U'\x0637'},  {U'\x1eea9', U'\x064a'},
-    {U'\x1eeab', U'\x0644'},  {U'\x1eeac', U'\x0645'},  {U'\x1eead', U'\x0646'},  {U'\x1eeae', U'\x0633'},
-    {U'\x1eeaf', U'\x0639'},  {U'\x1eeb0', U'\x0641'},  {U'\x1eeb1', U'\x0635'},  {U'\x1eeb2', U'\x0642'},
-    {U'\x1eeb3', U'\x0631'},  {U'\x1eeb4', U'\x0634'},  {U'\x1eeb5', U'\x062a'},  {U'\x1eeb6', U'\x062b'},
-    {U'\x1eeb7', U'\x062e'},  {U'\x1eeb8', U'\x0630'},  {U'\x1eeb9', U'\x0636'},  {U'\x1eeba', U'\x0638'},
-    {U'\x1eebb', U'\x063a'},  {U'\x1f101', U'\x0030'},  {U'\x1f102', U'\x0031'},  {U'\x1f103', U'\x0032'},
-    {U'\x1f104', U'\x0033'},  {U'\x1f105', U'\x0034'},  {U'\x1f106', U'\x0035'},  {U'\x1f107', U'\x0036'},
-    {U'\x1f108', U'\x0037'},  {U'\x1f109', U'\x0038'},  {U'\x1f10a', U'\x0039'},  {U'\x1f110', U'\x0028'},
-    {U'\x1f111', U'\x0028'},  {U'\x1f112', U'\x0028'},  {U'\x1f113', U'\x0028'},  {U'\x1f114', U'\x0028'},
-    {U'\x1f115', U'\x0028'},  {U'\x1f116', U'\x0028'},  {U'\x1f117', U'\x0028'},  {U'\x1f118', U'\x0028'},
-    {U'\x1f119', U'\x0028'},  {U'\x1f11a', U'\x0028'},  {U'\x1f11b', U'\x0028'},  {U'\x1f11c', U'\x0028'},
-    {U'\x1f11d', U'\x0028'},  {U'\x1f11e', U'\x0028'},  {U'\x1f11f', U'\x0028'},  {U'\x1f120', U'\x0028'},
-    {U'\x1f121', U'\x0028'},  {U'\x1f122', U'\x0028'},  {U'\x1f123', U'\x0028'},  {U'\x1f124', U'\x0028'},
-    {U'\x1f125', U'\x0028'},  {U'\x1f126', U'\x0028'},  {U'\x1f127', U'\x0028'},  {U'\x1f128', U'\x0028'},
-    {U'\x1f129', U'\x0028'},  {U'\x1f12a', U'\x3014'},  {U'\x1f12b', U'\x0063'},  {U'\x1f12c', U'\x0072'},
-    {U'\x1f12d', U'\x0063'},  {U'\x1f12e', U'\x0077'},  {U'\x1f130', U'\x0061'},  {U'\x1f131', U'\x0062'},
-    {U'\x1f132', U'\x0063'},  {U'\x1f133', U'\x0064'},  {U'\x1f134', U'\x0065'},  {U'\x1f135', U'\x0066'},
-    {U'\x1f136', U'\x0067'},  {U'\x1f137', U'\x0068'},  {U'\x1f138', U'\x0069'},  {U'\x1f139', U'\x006a'},
-    {U'\x1f13a', U'\x006b'},  {U'\x1f13b', U'\x006c'},  {U'\x1f13c', U'\x006d'},  {U'\x1f13d', U'\x006e'},
-    {U'\x1f13e', U'\x006f'},  {U'\x1f13f', U'\x0070'},  {U'\x1f140', U'\x0071'},  {U'\x1f141', U'\x0072'},
-    {U'\x1f142', U'\x0073'},  {U'\x1f143', U'\x0074'},  {U'\x1f144', U'\x0075'},  {U'\x1f145', U'\x0076'},
-    {U'\x1f146', U'\x0077'},  {U'\x1f147', U'\x0078'},  {U'\x1f148', U'\x0079'},  {U'\x1f149', U'\x007a'},
-    {U'\x1f14a', U'\x0068'},  {U'\x1f14b', U'\x006d'},  {U'\x1f14c', U'\x0073'},  {U'\x1f14d', U'\x0073'},
-    {U'\x1f14e', U'\x0070'},  {U'\x1f14f', U'\x0077'},  {U'\x1f16a', U'\x006d'},  {U'\x1f16b', U'\x006d'},
-    {U'\x1f16c', U'\x006d'},  {U'\x1f190', U'\x0064'},  {U'\x1f200', U'\x307b'},  {U'\x1f201', U'\x30b3'},
-    {U'\x1f202', U'\x30b5'},  {U'\x1f210', U'\x624b'},  {U'\x1f211', U'\x5b57'},  {U'\x1f212', U'\x53cc'},
-    {U'\x1f213', U'\x30c7'},  {U'\x1f214', U'\x4e8c'},  {U'\x1f215', U'\x591a'},  {U'\x1f216', U'\x89e3'},
-    {U'\x1f217', U'\x5929'},  {U'\x1f218', U'\x4ea4'},  {U'\x1f219', U'\x6620'},  {U'\x1f21a', U'\x7121'},
-    {U'\x1f21b', U'\x6599'},  {U'\x1f21c', U'\x524d'},  {U'\x1f21d', U'\x5f8c'},  {U'\x1f21e', U'\x518d'},
-    {U'\x1f21f', U'\x65b0'},  {U'\x1f220', U'\x521d'},  {U'\x1f221', U'\x7d42'},  {U'\x1f222', U'\x751f'},
-    {U'\x1f223', U'\x8ca9'},  {U'\x1f224', U'\x58f0'},  {U'\x1f225', U'\x5439'},  {U'\x1f226', U'\x6f14'},
-    {U'\x1f227', U'\x6295'},  {U'\x1f228', U'\x6355'},  {U'\x1f229', U'\x4e00'},  {U'\x1f22a', U'\x4e09'},
-    {U'\x1f22b', U'\x904a'},  {U'\x1f22c', U'\x5de6'},  {U'\x1f22d', U'\x4e2d'},  {U'\x1f22e', U'\x53f3'},
-    {U'\x1f22f', U'\x6307'},  {U'\x1f230', U'\x8d70'},  {U'\x1f231', U'\x6253'},  {U'\x1f232', U'\x7981'},
-    {U'\x1f233', U'\x7a7a'},  {U'\x1f234', U'\x5408'},  {U'\x1f235', U'\x6e80'},  {U'\x1f236', U'\x6709'},
-    {U'\x1f237', U'\x6708'},  {U'\x1f238', U'\x7533'},  {U'\x1f239', U'\x5272'},  {U'\x1f23a', U'\x55b6'},
-    {U'\x1f23b', U'\x914d'},  {U'\x1f240', U'\x3014'},  {U'\x1f241', U'\x3014'},  {U'\x1f242', U'\x3014'},
-    {U'\x1f243', U'\x3014'},  {U'\x1f244', U'\x3014'},  {U'\x1f245', U'\x3014'},  {U'\x1f246', U'\x3014'},
-    {U'\x1f247', U'\x3014'},  {U'\x1f248', U'\x3014'},  {U'\x1f250', U'\x5f97'},  {U'\x1f251', U'\x53ef'},
-    {U'\x1fbf0', U'\x0030'},  {U'\x1fbf1', U'\x0031'},  {U'\x1fbf2', U'\x0032'},  {U'\x1fbf3', U'\x0033'},
-    {U'\x1fbf4', U'\x0034'},  {U'\x1fbf5', U'\x0035'},  {U'\x1fbf6', U'\x0036'},  {U'\x1fbf7', U'\x0037'},
-    {U'\x1fbf8', U'\x0038'},  {U'\x1fbf9', U'\x0039'},  {U'\x2f800', U'\x4e3d'},  {U'\x2f801', U'\x4e38'},
-    {U'\x2f802', U'\x4e41'},  {U'\x2f803', U'\x20122'}, {U'\x2f804', U'\x4f60'},  {U'\x2f805', U'\x4fae'},
-    {U'\x2f806', U'\x4fbb'},  {U'\x2f807', U'\x5002'},  {U'\x2f808', U'\x507a'},  {U'\x2f809', U'\x5099'},
-    {U'\x2f80a', U'\x50e7'},  {U'\x2f80b', U'\x50cf'},  {U'\x2f80c', U'\x349e'},  {U'\x2f80d', U'\x2063a'},
-    {U'\x2f80e', U'\x514d'},  {U'\x2f80f', U'\x5154'},  {U'\x2f810', U'\x5164'},  {U'\x2f811', U'\x5177'},
-    {U'\x2f812', U'\x2051c'}, {U'\x2f813', U'\x34b9'},  {U'\x2f814', U'\x5167'},  {U'\x2f815', U'\x518d'},
-    {U'\x2f816', U'\x2054b'}, {U'\x2f817', U'\x5197'},  {U'\x2f818', U'\x51a4'},  {U'\x2f819', U'\x4ecc'},
-    {U'\x2f81a', U'\x51ac'},  {U'\x2f81b', U'\x51b5'},  {U'\x2f81c', U'\x291df'}, {U'\x2f81d', U'\x51f5'},
-    {U'\x2f81e', U'\x5203'},  {U'\x2f81f', U'\x34df'},  {U'\x2f820', U'\x523b'},  {U'\x2f821', U'\x5246'},
-    {U'\x2f822', U'\x5272'},  {U'\x2f823', U'\x5277'},  {U'\x2f824', U'\x3515'},  {U'\x2f825', U'\x52c7'},
-    {U'\x2f826', U'\x52c9'},  {U'\x2f827', U'\x52e4'},  {U'\x2f828', U'\x52fa'},  {U'\x2f829', U'\x5305'},
-    {U'\x2f82a', U'\x5306'},  {U'\x2f82b', U'\x5317'},  {U'\x2f82c', U'\x5349'},  {U'\x2f82d', U'\x5351'},
-    {U'\x2f82e', U'\x535a'},  {U'\x2f82f', U'\x5373'},  {U'\x2f830', U'\x537d'},  {U'\x2f831', U'\x537f'},
-    {U'\x2f834', U'\x20a2c'}, {U'\x2f835', U'\x7070'},  {U'\x2f836', U'\x53ca'},  {U'\x2f837', U'\x53df'},
-    {U'\x2f838', U'\x20b63'}, {U'\x2f839', U'\x53eb'},  {U'\x2f83a', U'\x53f1'},  {U'\x2f83b', U'\x5406'},
-    {U'\x2f83c', U'\x549e'},  {U'\x2f83d', U'\x5438'},  {U'\x2f83e', U'\x5448'},  {U'\x2f83f', U'\x5468'},
-    {U'\x2f840', U'\x54a2'},  {U'\x2f841', U'\x54f6'},  {U'\x2f842', U'\x5510'},  {U'\x2f843', U'\x5553'},
-    {U'\x2f844', U'\x5563'},  {U'\x2f845', U'\x5584'},  {U'\x2f847', U'\x5599'},  {U'\x2f848', U'\x55ab'},
-    {U'\x2f849', U'\x55b3'},  {U'\x2f84a', U'\x55c2'},  {U'\x2f84b', U'\x5716'},  {U'\x2f84c', U'\x5606'},
-    {U'\x2f84d', U'\x5717'},  {U'\x2f84e', U'\x5651'},  {U'\x2f84f', U'\x5674'},  {U'\x2f850', U'\x5207'},
-    {U'\x2f851', U'\x58ee'},  {U'\x2f852', U'\x57ce'},  {U'\x2f853', U'\x57f4'},  {U'\x2f854', U'\x580d'},
-    {U'\x2f855', U'\x578b'},  {U'\x2f856', U'\x5832'},  {U'\x2f857', U'\x5831'},  {U'\x2f858', U'\x58ac'},
-    {U'\x2f859', U'\x214e4'}, {U'\x2f85a', U'\x58f2'},  {U'\x2f85b', U'\x58f7'},  {U'\x2f85c', U'\x5906'},
-    {U'\x2f85d', U'\x591a'},  {U'\x2f85e', U'\x5922'},  {U'\x2f85f', U'\x5962'},  {U'\x2f860', U'\x216a8'},
-    {U'\x2f861', U'\x216ea'}, {U'\x2f862', U'\x59ec'},  {U'\x2f863', U'\x5a1b'},  {U'\x2f864', U'\x5a27'},
-    {U'\x2f865', U'\x59d8'},  {U'\x2f866', U'\x5a66'},  {U'\x2f867', U'\x36ee'},  {U'\x2f869', U'\x5b08'},
-    {U'\x2f86a', U'\x5b3e'},  {U'\x2f86c', U'\x219c8'}, {U'\x2f86d', U'\x5bc3'},  {U'\x2f86e', U'\x5bd8'},
-    {U'\x2f86f', U'\x5be7'},  {U'\x2f870', U'\x5bf3'},  {U'\x2f871', U'\x21b18'}, {U'\x2f872', U'\x5bff'},
-    {U'\x2f873', U'\x5c06'},  {U'\x2f875', U'\x5c22'},  {U'\x2f876', U'\x3781'},  {U'\x2f877', U'\x5c60'},
-    {U'\x2f878', U'\x5c6e'},  {U'\x2f879', U'\x5cc0'},  {U'\x2f87a', U'\x5c8d'},  {U'\x2f87b', U'\x21de4'},
-    {U'\x2f87c', U'\x5d43'},  {U'\x2f87d', U'\x21de6'}, {U'\x2f87e', U'\x5d6e'},  {U'\x2f87f', U'\x5d6b'},
-    {U'\x2f880', U'\x5d7c'},  {U'\x2f881', U'\x5de1'},  {U'\x2f882', U'\x5de2'},  {U'\x2f883', U'\x382f'},
-    {U'\x2f884', U'\x5dfd'},  {U'\x2f885', U'\x5e28'},  {U'\x2f886', U'\x5e3d'},  {U'\x2f887', U'\x5e69'},
-    {U'\x2f888', U'\x3862'},  {U'\x2f889', U'\x22183'}, {U'\x2f88a', U'\x387c'},  {U'\x2f88b', U'\x5eb0'},
-    {U'\x2f88c', U'\x5eb3'},  {U'\x2f88d', U'\x5eb6'},  {U'\x2f88e', U'\x5eca'},  {U'\x2f88f', U'\x2a392'},
-    {U'\x2f890', U'\x5efe'},  {U'\x2f891', U'\x22331'}, {U'\x2f893', U'\x8201'},  {U'\x2f894', U'\x5f22'},
-    {U'\x2f896', U'\x38c7'},  {U'\x2f897', U'\x232b8'}, {U'\x2f898', U'\x261da'}, {U'\x2f899', U'\x5f62'},
-    {U'\x2f89a', U'\x5f6b'},  {U'\x2f89b', U'\x38e3'},  {U'\x2f89c', U'\x5f9a'},  {U'\x2f89d', U'\x5fcd'},
-    {U'\x2f89e', U'\x5fd7'},  {U'\x2f89f', U'\x5ff9'},  {U'\x2f8a0', U'\x6081'},  {U'\x2f8a1', U'\x393a'},
-    {U'\x2f8a2', U'\x391c'},  {U'\x2f8a3', U'\x6094'},  {U'\x2f8a4', U'\x226d4'}, {U'\x2f8a5', U'\x60c7'},
-    {U'\x2f8a6', U'\x6148'},  {U'\x2f8a7', U'\x614c'},  {U'\x2f8a8', U'\x614e'},  {U'\x2f8a9', U'\x614c'},
-    {U'\x2f8aa', U'\x617a'},  {U'\x2f8ab', U'\x618e'},  {U'\x2f8ac', U'\x61b2'},  {U'\x2f8ad', U'\x61a4'},
-    {U'\x2f8ae', U'\x61af'},  {U'\x2f8af', U'\x61de'},  {U'\x2f8b0', U'\x61f2'},  {U'\x2f8b1', U'\x61f6'},
-    {U'\x2f8b2', U'\x6210'},  {U'\x2f8b3', U'\x621b'},  {U'\x2f8b4', U'\x625d'},  {U'\x2f8b5', U'\x62b1'},
-    {U'\x2f8b6', U'\x62d4'},  {U'\x2f8b7', U'\x6350'},  {U'\x2f8b8', U'\x22b0c'}, {U'\x2f8b9', U'\x633d'},
-    {U'\x2f8ba', U'\x62fc'},  {U'\x2f8bb', U'\x6368'},  {U'\x2f8bc', U'\x6383'},  {U'\x2f8bd', U'\x63e4'},
-    {U'\x2f8be', U'\x22bf1'}, {U'\x2f8bf', U'\x6422'},  {U'\x2f8c0', U'\x63c5'},  {U'\x2f8c1', U'\x63a9'},
-    {U'\x2f8c2', U'\x3a2e'},  {U'\x2f8c3', U'\x6469'},  {U'\x2f8c4', U'\x647e'},  {U'\x2f8c5', U'\x649d'},
-    {U'\x2f8c6', U'\x6477'},  {U'\x2f8c7', U'\x3a6c'},  {U'\x2f8c8', U'\x654f'},  {U'\x2f8c9', U'\x656c'},
-    {U'\x2f8ca', U'\x2300a'}, {U'\x2f8cb', U'\x65e3'},  {U'\x2f8cc', U'\x66f8'},  {U'\x2f8cd', U'\x6649'},
-    {U'\x2f8ce', U'\x3b19'},  {U'\x2f8cf', U'\x6691'},  {U'\x2f8d0', U'\x3b08'},  {U'\x2f8d1', U'\x3ae4'},
-    {U'\x2f8d2', U'\x5192'},  {U'\x2f8d3', U'\x5195'},  {U'\x2f8d4', U'\x6700'},  {U'\x2f8d5', U'\x669c'},
-    {U'\x2f8d6', U'\x80ad'},  {U'\x2f8d7', U'\x43d9'},  {U'\x2f8d8', U'\x6717'},  {U'\x2f8d9', U'\x671b'},
-    {U'\x2f8da', U'\x6721'},  {U'\x2f8db', U'\x675e'},  {U'\x2f8dc', U'\x6753'},  {U'\x2f8dd', U'\x233c3'},
-    {U'\x2f8de', U'\x3b49'},  {U'\x2f8df', U'\x67fa'},  {U'\x2f8e0', U'\x6785'},  {U'\x2f8e1', U'\x6852'},
-    {U'\x2f8e2', U'\x6885'},  {U'\x2f8e3', U'\x2346d'}, {U'\x2f8e4', U'\x688e'},  {U'\x2f8e5', U'\x681f'},
-    {U'\x2f8e6', U'\x6914'},  {U'\x2f8e7', U'\x3b9d'},  {U'\x2f8e8', U'\x6942'},  {U'\x2f8e9', U'\x69a3'},
-    {U'\x2f8ea', U'\x69ea'},  {U'\x2f8eb', U'\x6aa8'},  {U'\x2f8ec', U'\x236a3'}, {U'\x2f8ed', U'\x6adb'},
-    {U'\x2f8ee', U'\x3c18'},  {U'\x2f8ef', U'\x6b21'},  {U'\x2f8f0', U'\x238a7'}, {U'\x2f8f1', U'\x6b54'},
-    {U'\x2f8f2', U'\x3c4e'},  {U'\x2f8f3', U'\x6b72'},  {U'\x2f8f4', U'\x6b9f'},  {U'\x2f8f5', U'\x6bba'},
-    {U'\x2f8f6', U'\x6bbb'},  {U'\x2f8f7', U'\x23a8d'}, {U'\x2f8f8', U'\x21d0b'}, {U'\x2f8f9', U'\x23afa'},
-    {U'\x2f8fa', U'\x6c4e'},  {U'\x2f8fb', U'\x23cbc'}, {U'\x2f8fc', U'\x6cbf'},  {U'\x2f8fd', U'\x6ccd'},
-    {U'\x2f8fe', U'\x6c67'},  {U'\x2f8ff', U'\x6d16'},  {U'\x2f900', U'\x6d3e'},  {U'\x2f901', U'\x6d77'},
-    {U'\x2f902', U'\x6d41'},  {U'\x2f903', U'\x6d69'},  {U'\x2f904', U'\x6d78'},  {U'\x2f905', U'\x6d85'},
-    {U'\x2f906', U'\x23d1e'}, {U'\x2f907', U'\x6d34'},  {U'\x2f908', U'\x6e2f'},  {U'\x2f909', U'\x6e6e'},
-    {U'\x2f90a', U'\x3d33'},  {U'\x2f90b', U'\x6ecb'},  {U'\x2f90c', U'\x6ec7'},  {U'\x2f90d', U'\x23ed1'},
-    {U'\x2f90e', U'\x6df9'},  {U'\x2f90f', U'\x6f6e'},  {U'\x2f910', U'\x23f5e'}, {U'\x2f911', U'\x23f8e'},
-    {U'\x2f912', U'\x6fc6'},  {U'\x2f913', U'\x7039'},  {U'\x2f914', U'\x701e'},  {U'\x2f915', U'\x701b'},
-    {U'\x2f916', U'\x3d96'},  {U'\x2f917', U'\x704a'},  {U'\x2f918', U'\x707d'},  {U'\x2f919', U'\x7077'},
-    {U'\x2f91a', U'\x70ad'},  {U'\x2f91b', U'\x20525'}, {U'\x2f91c', U'\x7145'},  {U'\x2f91d', U'\x24263'},
-    {U'\x2f91e', U'\x719c'},  {U'\x2f920', U'\x7228'},  {U'\x2f921', U'\x7235'},  {U'\x2f922', U'\x7250'},
-    {U'\x2f923', U'\x24608'}, {U'\x2f924', U'\x7280'},  {U'\x2f925', U'\x7295'},  {U'\x2f926', U'\x24735'},
-    {U'\x2f927', U'\x24814'}, {U'\x2f928', U'\x737a'},  {U'\x2f929', U'\x738b'},  {U'\x2f92a', U'\x3eac'},
-    {U'\x2f92b', U'\x73a5'},  {U'\x2f92c', U'\x3eb8'},  {U'\x2f92e', U'\x7447'},  {U'\x2f92f', U'\x745c'},
-    {U'\x2f930', U'\x7471'},  {U'\x2f931', U'\x7485'},  {U'\x2f932', U'\x74ca'},  {U'\x2f933', U'\x3f1b'},
-    {U'\x2f934', U'\x7524'},  {U'\x2f935', U'\x24c36'}, {U'\x2f936', U'\x753e'},  {U'\x2f937', U'\x24c92'},
-    {U'\x2f938', U'\x7570'},  {U'\x2f939', U'\x2219f'}, {U'\x2f93a', U'\x7610'},  {U'\x2f93b', U'\x24fa1'},
-    {U'\x2f93c', U'\x24fb8'}, {U'\x2f93d', U'\x25044'}, {U'\x2f93e', U'\x3ffc'},  {U'\x2f93f', U'\x4008'},
-    {U'\x2f940', U'\x76f4'},  {U'\x2f941', U'\x250f3'}, {U'\x2f942', U'\x250f2'}, {U'\x2f943', U'\x25119'},
-    {U'\x2f944', U'\x25133'}, {U'\x2f945', U'\x771e'},  {U'\x2f946', U'\x771f'},  {U'\x2f948', U'\x774a'},
-    {U'\x2f949', U'\x4039'},  {U'\x2f94a', U'\x778b'},  {U'\x2f94b', U'\x4046'},  {U'\x2f94c', U'\x4096'},
-    {U'\x2f94d', U'\x2541d'}, {U'\x2f94e', U'\x784e'},  {U'\x2f94f', U'\x788c'},  {U'\x2f950', U'\x78cc'},
-    {U'\x2f951', U'\x40e3'},  {U'\x2f952', U'\x25626'}, {U'\x2f953', U'\x7956'},  {U'\x2f954', U'\x2569a'},
-    {U'\x2f955', U'\x256c5'}, {U'\x2f956', U'\x798f'},  {U'\x2f957', U'\x79eb'},  {U'\x2f958', U'\x412f'},
-    {U'\x2f959', U'\x7a40'},  {U'\x2f95a', U'\x7a4a'},  {U'\x2f95b', U'\x7a4f'},  {U'\x2f95c', U'\x2597c'},
-    {U'\x2f95d', U'\x25aa7'}, {U'\x2f960', U'\x4202'},  {U'\x2f961', U'\x25bab'}, {U'\x2f962', U'\x7bc6'},
-    {U'\x2f963', U'\x7bc9'},  {U'\x2f964', U'\x4227'},  {U'\x2f965', U'\x25c80'}, {U'\x2f966', U'\x7cd2'},
-    {U'\x2f967', U'\x42a0'},  {U'\x2f968', U'\x7ce8'},  {U'\x2f969', U'\x7ce3'},  {U'\x2f96a', U'\x7d00'},
-    {U'\x2f96b', U'\x25f86'}, {U'\x2f96c', U'\x7d63'},  {U'\x2f96d', U'\x4301'},  {U'\x2f96e', U'\x7dc7'},
-    {U'\x2f96f', U'\x7e02'},  {U'\x2f970', U'\x7e45'},  {U'\x2f971', U'\x4334'},  {U'\x2f972', U'\x26228'},
-    {U'\x2f973', U'\x26247'}, {U'\x2f974', U'\x4359'},  {U'\x2f975', U'\x262d9'}, {U'\x2f976', U'\x7f7a'},
-    {U'\x2f977', U'\x2633e'}, {U'\x2f978', U'\x7f95'},  {U'\x2f979', U'\x7ffa'},  {U'\x2f97a', U'\x8005'},
-    {U'\x2f97b', U'\x264da'}, {U'\x2f97c', U'\x26523'}, {U'\x2f97d', U'\x8060'},  {U'\x2f97e', U'\x265a8'},
-    {U'\x2f97f', U'\x8070'},  {U'\x2f980', U'\x2335f'}, {U'\x2f981', U'\x43d5'},  {U'\x2f982', U'\x80b2'},
-    {U'\x2f983', U'\x8103'},  {U'\x2f984', U'\x440b'},  {U'\x2f985', U'\x813e'},  {U'\x2f986', U'\x5ab5'},
-    {U'\x2f987', U'\x267a7'}, {U'\x2f988', U'\x267b5'}, {U'\x2f989', U'\x23393'}, {U'\x2f98a', U'\x2339c'},
-    {U'\x2f98b', U'\x8201'},  {U'\x2f98c', U'\x8204'},  {U'\x2f98d', U'\x8f9e'},  {U'\x2f98e', U'\x446b'},
-    {U'\x2f98f', U'\x8291'},  {U'\x2f990', U'\x828b'},  {U'\x2f991', U'\x829d'},  {U'\x2f992', U'\x52b3'},
-    {U'\x2f993', U'\x82b1'},  {U'\x2f994', U'\x82b3'},  {U'\x2f995', U'\x82bd'},  {U'\x2f996', U'\x82e6'},
-    {U'\x2f997', U'\x26b3c'}, {U'\x2f998', U'\x82e5'},  {U'\x2f999', U'\x831d'},  {U'\x2f99a', U'\x8363'},
-    {U'\x2f99b', U'\x83ad'},  {U'\x2f99c', U'\x8323'},  {U'\x2f99d', U'\x83bd'},  {U'\x2f99e', U'\x83e7'},
-    {U'\x2f99f', U'\x8457'},  {U'\x2f9a0', U'\x8353'},  {U'\x2f9a1', U'\x83ca'},  {U'\x2f9a2', U'\x83cc'},
-    {U'\x2f9a3', U'\x83dc'},  {U'\x2f9a4', U'\x26c36'}, {U'\x2f9a5', U'\x26d6b'}, {U'\x2f9a6', U'\x26cd5'},
-    {U'\x2f9a7', U'\x452b'},  {U'\x2f9a8', U'\x84f1'},  {U'\x2f9a9', U'\x84f3'},  {U'\x2f9aa', U'\x8516'},
-    {U'\x2f9ab', U'\x273ca'}, {U'\x2f9ac', U'\x8564'},  {U'\x2f9ad', U'\x26f2c'}, {U'\x2f9ae', U'\x455d'},
-    {U'\x2f9af', U'\x4561'},  {U'\x2f9b0', U'\x26fb1'}, {U'\x2f9b1', U'\x270d2'}, {U'\x2f9b2', U'\x456b'},
-    {U'\x2f9b3', U'\x8650'},  {U'\x2f9b4', U'\x865c'},  {U'\x2f9b5', U'\x8667'},  {U'\x2f9b6', U'\x8669'},
-    {U'\x2f9b7', U'\x86a9'},  {U'\x2f9b8', U'\x8688'},  {U'\x2f9b9', U'\x870e'},  {U'\x2f9ba', U'\x86e2'},
-    {U'\x2f9bb', U'\x8779'},  {U'\x2f9bc', U'\x8728'},  {U'\x2f9bd', U'\x876b'},  {U'\x2f9be', U'\x8786'},
-    {U'\x2f9c0', U'\x87e1'},  {U'\x2f9c1', U'\x8801'},  {U'\x2f9c2', U'\x45f9'},  {U'\x2f9c3', U'\x8860'},
-    {U'\x2f9c4', U'\x8863'},  {U'\x2f9c5', U'\x27667'}, {U'\x2f9c6', U'\x88d7'},  {U'\x2f9c7', U'\x88de'},
-    {U'\x2f9c8', U'\x4635'},  {U'\x2f9c9', U'\x88fa'},  {U'\x2f9ca', U'\x34bb'},  {U'\x2f9cb', U'\x278ae'},
-    {U'\x2f9cc', U'\x27966'}, {U'\x2f9cd', U'\x46be'},  {U'\x2f9ce', U'\x46c7'},  {U'\x2f9cf', U'\x8aa0'},
-    {U'\x2f9d0', U'\x8aed'},  {U'\x2f9d1', U'\x8b8a'},  {U'\x2f9d2', U'\x8c55'},  {U'\x2f9d3', U'\x27ca8'},
-    {U'\x2f9d4', U'\x8cab'},  {U'\x2f9d5', U'\x8cc1'},  {U'\x2f9d6', U'\x8d1b'},  {U'\x2f9d7', U'\x8d77'},
-    {U'\x2f9d8', U'\x27f2f'}, {U'\x2f9d9', U'\x20804'}, {U'\x2f9da', U'\x8dcb'},  {U'\x2f9db', U'\x8dbc'},
-    {U'\x2f9dc', U'\x8df0'},  {U'\x2f9dd', U'\x208de'}, {U'\x2f9de', U'\x8ed4'},  {U'\x2f9df', U'\x8f38'},
-    {U'\x2f9e0', U'\x285d2'}, {U'\x2f9e1', U'\x285ed'}, {U'\x2f9e2', U'\x9094'},  {U'\x2f9e3', U'\x90f1'},
-    {U'\x2f9e4', U'\x9111'},  {U'\x2f9e5', U'\x2872e'}, {U'\x2f9e6', U'\x911b'},  {U'\x2f9e7', U'\x9238'},
-    {U'\x2f9e8', U'\x92d7'},  {U'\x2f9e9', U'\x92d8'},  {U'\x2f9ea', U'\x927c'},  {U'\x2f9eb', U'\x93f9'},
-    {U'\x2f9ec', U'\x9415'},  {U'\x2f9ed', U'\x28bfa'}, {U'\x2f9ee', U'\x958b'},  {U'\x2f9ef', U'\x4995'},
-    {U'\x2f9f0', U'\x95b7'},  {U'\x2f9f1', U'\x28d77'}, {U'\x2f9f2', U'\x49e6'},  {U'\x2f9f3', U'\x96c3'},
-    {U'\x2f9f4', U'\x5db2'},  {U'\x2f9f5', U'\x9723'},  {U'\x2f9f6', U'\x29145'}, {U'\x2f9f7', U'\x2921a'},
-    {U'\x2f9f8', U'\x4a6e'},  {U'\x2f9f9', U'\x4a76'},  {U'\x2f9fa', U'\x97e0'},  {U'\x2f9fb', U'\x2940a'},
-    {U'\x2f9fc', U'\x4ab2'},  {U'\x2f9fd', U'\x29496'}, {U'\x2f9fe', U'\x980b'},  {U'\x2fa00', U'\x9829'},
-    {U'\x2fa01', U'\x295b6'}, {U'\x2fa02', U'\x98e2'},  {U'\x2fa03', U'\x4b33'},  {U'\x2fa04', U'\x9929'},
-    {U'\x2fa05', U'\x99a7'},  {U'\x2fa06', U'\x99c2'},  {U'\x2fa07', U'\x99fe'},  {U'\x2fa08', U'\x4bce'},
-    {U'\x2fa09', U'\x29b30'}, {U'\x2fa0a', U'\x9b12'},  {U'\x2fa0b', U'\x9c40'},  {U'\x2fa0c', U'\x9cfd'},
-    {U'\x2fa0d', U'\x4cce'},  {U'\x2fa0e', U'\x4ced'},  {U'\x2fa0f', U'\x9d67'},  {U'\x2fa10', U'\x2a0ce'},
-    {U'\x2fa11', U'\x4cf8'},  {U'\x2fa12', U'\x2a105'}, {U'\x2fa13', U'\x2a20e'}, {U'\x2fa14', U'\x2a291'},
-    {U'\x2fa15', U'\x9ebb'},  {U'\x2fa16', U'\x4d56'},  {U'\x2fa17', U'\x9ef9'},  {U'\x2fa18', U'\x9efe'},
-    {U'\x2fa19', U'\x9f05'},  {U'\x2fa1a', U'\x9f0f'},  {U'\x2fa1b', U'\x9f16'},  {U'\x2fa1c', U'\x9f3b'},
-    {U'\x2fa1d', U'\x2a600'},
+inline constexpr auto mapped_code_points = std::array<char32_t, 4759>{{
+    U'\x0635', U'\x0644', U'\x0649', U'\x0020', U'\x0627', U'\x0644', U'\x0644', U'\x0647',
+    U'\x0020', U'\x0639', U'\x0644', U'\x064a', U'\x0647', U'\x0020', U'\x0648', U'\x0633',
+    U'\x0644', U'\x0645', U'\x062c', U'\x0644', U'\x0020', U'\x062c', U'\x0644', U'\x0627',
+    U'\x0644', U'\x0647', U'\x30ad', U'\x30ed', U'\x30e1', U'\x30fc', U'\x30c8', U'\x30eb',
+    U'\x0072', U'\x0061', U'\x0064', U'\x2215', U'\x0073', U'\x0032', U'\x30a8', U'\x30b9',
+    U'\x30af', U'\x30fc', U'\x30c9', U'\x30ad', U'\x30ed', U'\x30b0', U'\x30e9', U'\x30e0',
+    U'\x30ad', U'\x30ed', U'\x30ef', U'\x30c3', U'\x30c8', U'\x30b0', U'\x30e9', U'\x30e0',
+    U'\x30c8', U'\x30f3', U'\x30af', U'\x30eb', U'\x30bc', U'\x30a4', U'\x30ed', U'\x30b5',
+    U'\x30f3', U'\x30c1', U'\x30fc', U'\x30e0', U'\x30d1', U'\x30fc', U'\x30bb', U'\x30f3',
+    U'\x30c8', U'\x30d4', U'\x30a2', U'\x30b9', U'\x30c8', U'\x30eb', U'\x30d5', U'\x30a1',
+    U'\x30e9', U'\x30c3', U'\x30c9', U'\x30d6', U'\x30c3', U'\x30b7', U'\x30a7', U'\x30eb',
+    U'\x30d8', U'\x30af', U'\x30bf', U'\x30fc', U'\x30eb', U'\x30de', U'\x30f3', U'\x30b7',
+    U'\x30e7', U'\x30f3', U'\x30df', U'\x30ea', U'\x30d0', U'\x30fc', U'\x30eb', U'\x30ec',
+    U'\x30f3', U'\x30c8', U'\x30b2', U'\x30f3', U'\x2032', U'\x2032', U'\x2032', U'\x2032',
+    U'\x0031', U'\x2044', U'\x0031', U'\x0030', U'\x0076', U'\x0069', U'\x0069', U'\x0069',
+    U'\x0028', U'\x0031', U'\x0030', U'\x0029', U'\x0028', U'\x0031', U'\x0031', U'\x0029',
+    U'\x0028', U'\x0031', U'\x0032', U'\x0029', U'\x0028', U'\x0031', U'\x0033', U'\x0029',
+    U'\x0028', U'\x0031', U'\x0034', U'\x0029', U'\x0028', U'\x0031', U'\x0035', U'\x0029',
+    U'\x0028', U'\x0031', U'\x0036', U'\x0029', U'\x0028', U'\x0031', U'\x0037', U'\x0029',
+    U'\x0028', U'\x0031', U'\x0038', U'\x0029', U'\x0028', U'\x0031', U'\x0039', U'\x0029',
+    U'\x0028', U'\x0032', U'\x0030', U'\x0029', U'\x222b', U'\x222b', U'\x222b', U'\x222b',
+    U'\x0028', U'\xc624', U'\xc804', U'\x0029', U'\x0028', U'\xc624', U'\xd6c4', U'\x0029',
+    U'\x30a2', U'\x30d1', U'\x30fc', U'\x30c8', U'\x30a2', U'\x30eb', U'\x30d5', U'\x30a1',
+    U'\x30a2', U'\x30f3', U'\x30da', U'\x30a2', U'\x30a4', U'\x30cb', U'\x30f3', U'\x30b0',
+    U'\x30a8', U'\x30fc', U'\x30ab', U'\x30fc', U'\x30ab', U'\x30e9', U'\x30c3', U'\x30c8',
+    U'\x30ab', U'\x30ed', U'\x30ea', U'\x30fc', U'\x30ad', U'\x30e5', U'\x30ea', U'\x30fc',
+    U'\x30ae', U'\x30eb', U'\x30c0', U'\x30fc', U'\x30af', U'\x30ed', U'\x30fc', U'\x30cd',
+    U'\x30b5', U'\x30a4', U'\x30af', U'\x30eb', U'\x30b7', U'\x30ea', U'\x30f3', U'\x30b0',
+    U'\x30d0', U'\x30fc', U'\x30ec', U'\x30eb', U'\x30d5', U'\x30a3', U'\x30fc', U'\x30c8',
+    U'\x30dd', U'\x30a4', U'\x30f3', U'\x30c8', U'\x30de', U'\x30a4', U'\x30af', U'\x30ed',
+    U'\x30df', U'\x30af', U'\x30ed', U'\x30f3', U'\x30e1', U'\x30ac', U'\x30c8', U'\x30f3',
+    U'\x30ea', U'\x30c3', U'\x30c8', U'\x30eb', U'\x30eb', U'\x30fc', U'\x30d6', U'\x30eb',
+    U'\x682a', U'\x5f0f', U'\x4f1a', U'\x793e', U'\x006b', U'\x0063', U'\x0061', U'\x006c',
+    U'\x006d', U'\x2215', U'\x0073', U'\x0032', U'\x0063', U'\x2215', U'\x006b', U'\x0067',
+    U'\x0627', U'\x0643', U'\x0628', U'\x0631', U'\x0645', U'\x062d', U'\x0645', U'\x062f',
+    U'\x0635', U'\x0644', U'\x0639', U'\x0645', U'\x0631', U'\x0633', U'\x0648', U'\x0644',
+    U'\x0631', U'\x06cc', U'\x0627', U'\x0644', U'\x0031', U'\x2044', U'\x0034', U'\x0031',
+    U'\x2044', U'\x0032', U'\x0033', U'\x2044', U'\x0034', U'\x0020', U'\x0308', U'\x0301',
+    U'\x0fb2', U'\x0f71', U'\x0f80', U'\x0fb3', U'\x0f71', U'\x0f80', U'\x0020', U'\x0308',
+    U'\x0342', U'\x0020', U'\x0313', U'\x0300', U'\x0020', U'\x0313', U'\x0301', U'\x0020',
+    U'\x0313', U'\x0342', U'\x0020', U'\x0314', U'\x0300', U'\x0020', U'\x0314', U'\x0301',
+    U'\x0020', U'\x0314', U'\x0342', U'\x0020', U'\x0308', U'\x0300', U'\x2035', U'\x2035',
+    U'\x2035', U'\x0061', U'\x002f', U'\x0063', U'\x0061', U'\x002f', U'\x0073', U'\x0063',
+    U'\x002f', U'\x006f', U'\x0063', U'\x002f', U'\x0075', U'\x0074', U'\x0065', U'\x006c',
+    U'\x0066', U'\x0061', U'\x0078', U'\x0031', U'\x2044', U'\x0037', U'\x0031', U'\x2044',
+    U'\x0039', U'\x0031', U'\x2044', U'\x0033', U'\x0032', U'\x2044', U'\x0033', U'\x0031',
+    U'\x2044', U'\x0035', U'\x0032', U'\x2044', U'\x0035', U'\x0033', U'\x2044', U'\x0035',
+    U'\x0034', U'\x2044', U'\x0035', U'\x0031', U'\x2044', U'\x0036', U'\x0035', U'\x2044',
+    U'\x0036', U'\x0031', U'\x2044', U'\x0038', U'\x0033', U'\x2044', U'\x0038', U'\x0035',
+    U'\x2044', U'\x0038', U'\x0037', U'\x2044', U'\x0038', U'\x0078', U'\x0069', U'\x0069',
+    U'\x0030', U'\x2044', U'\x0033', U'\x222e', U'\x222e', U'\x222e', U'\x0028', U'\x0031',
+    U'\x0029', U'\x0028', U'\x0032', U'\x0029', U'\x0028', U'\x0033', U'\x0029', U'\x0028',
+    U'\x0034', U'\x0029', U'\x0028', U'\x0035', U'\x0029', U'\x0028', U'\x0036', U'\x0029',
+    U'\x0028', U'\x0037', U'\x0029', U'\x0028', U'\x0038', U'\x0029', U'\x0028', U'\x0039',
+    U'\x0029', U'\x0028', U'\x0061', U'\x0029', U'\x0028', U'\x0062', U'\x0029', U'\x0028',
+    U'\x0063', U'\x0029', U'\x0028', U'\x0064', U'\x0029', U'\x0028', U'\x0065', U'\x0029',
+    U'\x0028', U'\x0066', U'\x0029', U'\x0028', U'\x0067', U'\x0029', U'\x0028', U'\x0068',
+    U'\x0029', U'\x0028', U'\x0069', U'\x0029', U'\x0028', U'\x006a', U'\x0029', U'\x0028',
+    U'\x006b', U'\x0029', U'\x0028', U'\x006c', U'\x0029', U'\x0028', U'\x006d', U'\x0029',
+    U'\x0028', U'\x006e', U'\x0029', U'\x0028', U'\x006f', U'\x0029', U'\x0028', U'\x0070',
+    U'\x0029', U'\x0028', U'\x0071', U'\x0029', U'\x0028', U'\x0072', U'\x0029', U'\x0028',
+    U'\x0073', U'\x0029', U'\x0028', U'\x0074', U'\x0029', U'\x0028', U'\x0075', U'\x0029',
+    U'\x0028', U'\x0076', U'\x0029', U'\x0028', U'\x0077', U'\x0029', U'\x0028', U'\x0078',
+    U'\x0029', U'\x0028', U'\x0079', U'\x0029', U'\x0028', U'\x007a', U'\x0029', U'\x003a',
+    U'\x003a', U'\x003d', U'\x003d', U'\x003d', U'\x003d', U'\x0028', U'\x1100', U'\x0029',
+    U'\x0028', U'\x1102', U'\x0029', U'\x0028', U'\x1103', U'\x0029', U'\x0028', U'\x1105',
+    U'\x0029', U'\x0028', U'\x1106', U'\x0029', U'\x0028', U'\x1107', U'\x0029', U'\x0028',
+    U'\x1109', U'\x0029', U'\x0028', U'\x110b', U'\x0029', U'\x0028', U'\x110c', U'\x0029',
+    U'\x0028', U'\x110e', U'\x0029', U'\x0028', U'\x110f', U'\x0029', U'\x0028', U'\x1110',
+    U'\x0029', U'\x0028', U'\x1111', U'\x0029', U'\x0028', U'\x1112', U'\x0029', U'\x0028',
+    U'\xac00', U'\x0029', U'\x0028', U'\xb098', U'\x0029', U'\x0028', U'\xb2e4', U'\x0029',
+    U'\x0028', U'\xb77c', U'\x0029', U'\x0028', U'\xb9c8', U'\x0029', U'\x0028', U'\xbc14',
+    U'\x0029', U'\x0028', U'\xc0ac', U'\x0029', U'\x0028', U'\xc544', U'\x0029', U'\x0028',
+    U'\xc790', U'\x0029', U'\x0028', U'\xcc28', U'\x0029', U'\x0028', U'\xce74', U'\x0029',
+    U'\x0028', U'\xd0c0', U'\x0029', U'\x0028', U'\xd30c', U'\x0029', U'\x0028', U'\xd558',
+    U'\x0029', U'\x0028', U'\xc8fc', U'\x0029', U'\x0028', U'\x4e00', U'\x0029', U'\x0028',
+    U'\x4e8c', U'\x0029', U'\x0028', U'\x4e09', U'\x0029', U'\x0028', U'\x56db', U'\x0029',
+    U'\x0028', U'\x4e94', U'\x0029', U'\x0028', U'\x516d', U'\x0029', U'\x0028', U'\x4e03',
+    U'\x0029', U'\x0028', U'\x516b', U'\x0029', U'\x0028', U'\x4e5d', U'\x0029', U'\x0028',
+    U'\x5341', U'\x0029', U'\x0028', U'\x6708', U'\x0029', U'\x0028', U'\x706b', U'\x0029',
+    U'\x0028', U'\x6c34', U'\x0029', U'\x0028', U'\x6728', U'\x0029', U'\x0028', U'\x91d1',
+    U'\x0029', U'\x0028', U'\x571f', U'\x0029', U'\x0028', U'\x65e5', U'\x0029', U'\x0028',
+    U'\x682a', U'\x0029', U'\x0028', U'\x6709', U'\x0029', U'\x0028', U'\x793e', U'\x0029',
+    U'\x0028', U'\x540d', U'\x0029', U'\x0028', U'\x7279', U'\x0029', U'\x0028', U'\x8ca1',
+    U'\x0029', U'\x0028', U'\x795d', U'\x0029', U'\x0028', U'\x52b4', U'\x0029', U'\x0028',
+    U'\x4ee3', U'\x0029', U'\x0028', U'\x547c', U'\x0029', U'\x0028', U'\x5b66', U'\x0029',
+    U'\x0028', U'\x76e3', U'\x0029', U'\x0028', U'\x4f01', U'\x0029', U'\x0028', U'\x8cc7',
+    U'\x0029', U'\x0028', U'\x5354', U'\x0029', U'\x0028', U'\x796d', U'\x0029', U'\x0028',
+    U'\x4f11', U'\x0029', U'\x0028', U'\x81ea', U'\x0029', U'\x0028', U'\x81f3', U'\x0029',
+    U'\x0070', U'\x0074', U'\x0065', U'\x0031', U'\x0030', U'\x6708', U'\x0031', U'\x0031',
+    U'\x6708', U'\x0031', U'\x0032', U'\x6708', U'\x0065', U'\x0072', U'\x0067', U'\x006c',
+    U'\x0074', U'\x0064', U'\x30a2', U'\x30fc', U'\x30eb', U'\x30a4', U'\x30f3', U'\x30c1',
+    U'\x30a6', U'\x30a9', U'\x30f3', U'\x30aa', U'\x30f3', U'\x30b9', U'\x30aa', U'\x30fc',
+    U'\x30e0', U'\x30ab', U'\x30a4', U'\x30ea', U'\x30ac', U'\x30ed', U'\x30f3', U'\x30ac',
+    U'\x30f3', U'\x30de', U'\x30ae', U'\x30cb', U'\x30fc', U'\x30b1', U'\x30fc', U'\x30b9',
+    U'\x30b3', U'\x30eb', U'\x30ca', U'\x30b3', U'\x30fc', U'\x30dd', U'\x30bb', U'\x30f3',
+    U'\x30c1', U'\x30c0', U'\x30fc', U'\x30b9', U'\x30ce', U'\x30c3', U'\x30c8', U'\x30cf',
+    U'\x30a4', U'\x30c4', U'\x30d1', U'\x30fc', U'\x30c4', U'\x30d4', U'\x30af', U'\x30eb',
+    U'\x30d5', U'\x30e9', U'\x30f3', U'\x30da', U'\x30cb', U'\x30d2', U'\x30d8', U'\x30eb',
+    U'\x30c4', U'\x30da', U'\x30f3', U'\x30b9', U'\x30da', U'\x30fc', U'\x30b8', U'\x30d9',
+    U'\x30fc', U'\x30bf', U'\x30dc', U'\x30eb', U'\x30c8', U'\x30dd', U'\x30f3', U'\x30c9',
+    U'\x30db', U'\x30fc', U'\x30eb', U'\x30db', U'\x30fc', U'\x30f3', U'\x30de', U'\x30a4',
+    U'\x30eb', U'\x30de', U'\x30c3', U'\x30cf', U'\x30de', U'\x30eb', U'\x30af', U'\x30e4',
+    U'\x30fc', U'\x30c9', U'\x30e4', U'\x30fc', U'\x30eb', U'\x30e6', U'\x30a2', U'\x30f3',
+    U'\x30eb', U'\x30d4', U'\x30fc', U'\x0031', U'\x0030', U'\x70b9', U'\x0031', U'\x0031',
+    U'\x70b9', U'\x0031', U'\x0032', U'\x70b9', U'\x0031', U'\x0033', U'\x70b9', U'\x0031',
+    U'\x0034', U'\x70b9', U'\x0031', U'\x0035', U'\x70b9', U'\x0031', U'\x0036', U'\x70b9',
+    U'\x0031', U'\x0037', U'\x70b9', U'\x0031', U'\x0038', U'\x70b9', U'\x0031', U'\x0039',
+    U'\x70b9', U'\x0032', U'\x0030', U'\x70b9', U'\x0032', U'\x0031', U'\x70b9', U'\x0032',
+    U'\x0032', U'\x70b9', U'\x0032', U'\x0033', U'\x70b9', U'\x0032', U'\x0034', U'\x70b9',
+    U'\x0068', U'\x0070', U'\x0061', U'\x0062', U'\x0061', U'\x0072', U'\x0064', U'\x006d',
+    U'\x0032', U'\x0064', U'\x006d', U'\x0033', U'\x006b', U'\x0068', U'\x007a', U'\x006d',
+    U'\x0068', U'\x007a', U'\x0067', U'\x0068', U'\x007a', U'\x0074', U'\x0068', U'\x007a',
+    U'\x006d', U'\x006d', U'\x0032', U'\x0063', U'\x006d', U'\x0032', U'\x006b', U'\x006d',
+    U'\x0032', U'\x006d', U'\x006d', U'\x0033', U'\x0063', U'\x006d', U'\x0033', U'\x006b',
+    U'\x006d', U'\x0033', U'\x006b', U'\x0070', U'\x0061', U'\x006d', U'\x0070', U'\x0061',
+    U'\x0067', U'\x0070', U'\x0061', U'\x006c', U'\x006f', U'\x0067', U'\x006d', U'\x0069',
+    U'\x006c', U'\x006d', U'\x006f', U'\x006c', U'\x0070', U'\x0070', U'\x006d', U'\x0076',
+    U'\x2215', U'\x006d', U'\x0061', U'\x2215', U'\x006d', U'\x0031', U'\x0030', U'\x65e5',
+    U'\x0031', U'\x0031', U'\x65e5', U'\x0031', U'\x0032', U'\x65e5', U'\x0031', U'\x0033',
+    U'\x65e5', U'\x0031', U'\x0034', U'\x65e5', U'\x0031', U'\x0035', U'\x65e5', U'\x0031',
+    U'\x0036', U'\x65e5', U'\x0031', U'\x0037', U'\x65e5', U'\x0031', U'\x0038', U'\x65e5',
+    U'\x0031', U'\x0039', U'\x65e5', U'\x0032', U'\x0030', U'\x65e5', U'\x0032', U'\x0031',
+    U'\x65e5', U'\x0032', U'\x0032', U'\x65e5', U'\x0032', U'\x0033', U'\x65e5', U'\x0032',
+    U'\x0034', U'\x65e5', U'\x0032', U'\x0035', U'\x65e5', U'\x0032', U'\x0036', U'\x65e5',
+    U'\x0032', U'\x0037', U'\x65e5', U'\x0032', U'\x0038', U'\x65e5', U'\x0032', U'\x0039',
+    U'\x65e5', U'\x0033', U'\x0030', U'\x65e5', U'\x0033', U'\x0031', U'\x65e5', U'\x0067',
+    U'\x0061', U'\x006c', U'\x0066', U'\x0066', U'\x0069', U'\x0066', U'\x0066', U'\x006c',
+    U'\x05e9', U'\x05bc', U'\x05c1', U'\x05e9', U'\x05bc', U'\x05c2', U'\x0020', U'\x064c',
+    U'\x0651', U'\x0020', U'\x064d', U'\x0651', U'\x0020', U'\x064e', U'\x0651', U'\x0020',
+    U'\x064f', U'\x0651', U'\x0020', U'\x0650', U'\x0651', U'\x0020', U'\x0651', U'\x0670',
+    U'\x0640', U'\x064e', U'\x0651', U'\x0640', U'\x064f', U'\x0651', U'\x0640', U'\x0650',
+    U'\x0651', U'\x062a', U'\x062c', U'\x0645', U'\x062a', U'\x062d', U'\x062c', U'\x062a',
+    U'\x062d', U'\x0645', U'\x062a', U'\x062e', U'\x0645', U'\x062a', U'\x0645', U'\x062c',
+    U'\x062a', U'\x0645', U'\x062d', U'\x062a', U'\x0645', U'\x062e', U'\x062c', U'\x0645',
+    U'\x062d', U'\x062d', U'\x0645', U'\x064a', U'\x062d', U'\x0645', U'\x0649', U'\x0633',
+    U'\x062d', U'\x062c', U'\x0633', U'\x062c', U'\x062d', U'\x0633', U'\x062c', U'\x0649',
+    U'\x0633', U'\x0645', U'\x062d', U'\x0633', U'\x0645', U'\x062c', U'\x0633', U'\x0645',
+    U'\x0645', U'\x0635', U'\x062d', U'\x062d', U'\x0635', U'\x0645', U'\x0645', U'\x0634',
+    U'\x062d', U'\x0645', U'\x0634', U'\x062c', U'\x064a', U'\x0634', U'\x0645', U'\x062e',
+    U'\x0634', U'\x0645', U'\x0645', U'\x0636', U'\x062d', U'\x0649', U'\x0636', U'\x062e',
+    U'\x0645', U'\x0637', U'\x0645', U'\x062d', U'\x0637', U'\x0645', U'\x0645', U'\x0637',
+    U'\x0645', U'\x064a', U'\x0639', U'\x062c', U'\x0645', U'\x0639', U'\x0645', U'\x0645',
+    U'\x0639', U'\x0645', U'\x0649', U'\x063a', U'\x0645', U'\x0645', U'\x063a', U'\x0645',
+    U'\x064a', U'\x063a', U'\x0645', U'\x0649', U'\x0641', U'\x062e', U'\x0645', U'\x0642',
+    U'\x0645', U'\x062d', U'\x0642', U'\x0645', U'\x0645', U'\x0644', U'\x062d', U'\x0645',
+    U'\x0644', U'\x062d', U'\x064a', U'\x0644', U'\x062d', U'\x0649', U'\x0644', U'\x062c',
+    U'\x062c', U'\x0644', U'\x062e', U'\x0645', U'\x0644', U'\x0645', U'\x062d', U'\x0645',
+    U'\x062d', U'\x062c', U'\x0645', U'\x062d', U'\x064a', U'\x0645', U'\x062c', U'\x062d',
+    U'\x0645', U'\x062c', U'\x0645', U'\x0645', U'\x062e', U'\x0645', U'\x0645', U'\x062c',
+    U'\x062e', U'\x0647', U'\x0645', U'\x062c', U'\x0647', U'\x0645', U'\x0645', U'\x0646',
+    U'\x062d', U'\x0645', U'\x0646', U'\x062d', U'\x0649', U'\x0646', U'\x062c', U'\x0645',
+    U'\x0646', U'\x062c', U'\x0649', U'\x0646', U'\x0645', U'\x064a', U'\x0646', U'\x0645',
+    U'\x0649', U'\x064a', U'\x0645', U'\x0645', U'\x0628', U'\x062e', U'\x064a', U'\x062a',
+    U'\x062c', U'\x064a', U'\x062a', U'\x062c', U'\x0649', U'\x062a', U'\x062e', U'\x064a',
+    U'\x062a', U'\x062e', U'\x0649', U'\x062a', U'\x0645', U'\x064a', U'\x062a', U'\x0645',
+    U'\x0649', U'\x062c', U'\x0645', U'\x064a', U'\x062c', U'\x062d', U'\x0649', U'\x062c',
+    U'\x0645', U'\x0649', U'\x0633', U'\x062e', U'\x0649', U'\x0635', U'\x062d', U'\x064a',
+    U'\x0634', U'\x062d', U'\x064a', U'\x0636', U'\x062d', U'\x064a', U'\x0644', U'\x062c',
+    U'\x064a', U'\x0644', U'\x0645', U'\x064a', U'\x064a', U'\x062d', U'\x064a', U'\x064a',
+    U'\x062c', U'\x064a', U'\x064a', U'\x0645', U'\x064a', U'\x0645', U'\x0645', U'\x064a',
+    U'\x0642', U'\x0645', U'\x064a', U'\x0646', U'\x062d', U'\x064a', U'\x0639', U'\x0645',
+    U'\x064a', U'\x0643', U'\x0645', U'\x064a', U'\x0646', U'\x062c', U'\x062d', U'\x0645',
+    U'\x062e', U'\x064a', U'\x0644', U'\x062c', U'\x0645', U'\x0643', U'\x0645', U'\x0645',
+    U'\x062c', U'\x062d', U'\x064a', U'\x062d', U'\x062c', U'\x064a', U'\x0645', U'\x062c',
+    U'\x064a', U'\x0641', U'\x0645', U'\x064a', U'\x0628', U'\x062d', U'\x064a', U'\x0633',
+    U'\x062e', U'\x064a', U'\x0646', U'\x062c', U'\x064a', U'\x0635', U'\x0644', U'\x06d2',
+    U'\x0642', U'\x0644', U'\x06d2', U'\x1d158', U'\x1d165', U'\x1d16e', U'\x1d158', U'\x1d165',
+    U'\x1d16f', U'\x1d158', U'\x1d165', U'\x1d170', U'\x1d158', U'\x1d165', U'\x1d171', U'\x1d158',
+    U'\x1d165', U'\x1d172', U'\x1d1b9', U'\x1d165', U'\x1d16e', U'\x1d1ba', U'\x1d165', U'\x1d16e',
+    U'\x1d1b9', U'\x1d165', U'\x1d16f', U'\x1d1ba', U'\x1d165', U'\x1d16f', U'\x3014', U'\x0073',
+    U'\x3015', U'\x0070', U'\x0070', U'\x0076', U'\x3014', U'\x672c', U'\x3015', U'\x3014',
+    U'\x4e09', U'\x3015', U'\x3014', U'\x4e8c', U'\x3015', U'\x3014', U'\x5b89', U'\x3015',
+    U'\x3014', U'\x70b9', U'\x3015', U'\x3014', U'\x6253', U'\x3015', U'\x3014', U'\x76d7',
+    U'\x3015', U'\x3014', U'\x52dd', U'\x3015', U'\x3014', U'\x6557', U'\x3015', U'\x0020',
+    U'\x0304', U'\x0020', U'\x0301', U'\x0020', U'\x0327', U'\x0073', U'\x0073', U'\x0069',
+    U'\x0307', U'\x0069', U'\x006a', U'\x006c', U'\x00b7', U'\x02bc', U'\x006e', U'\x0064',
+    U'\x017e', U'\x006c', U'\x006a', U'\x006e', U'\x006a', U'\x0064', U'\x007a', U'\x0020',
+    U'\x0306', U'\x0020', U'\x0307', U'\x0020', U'\x030a', U'\x0020', U'\x0328', U'\x0020',
+    U'\x0303', U'\x0020', U'\x030b', U'\x0020', U'\x03b9', U'\x0565', U'\x0582', U'\x0627',
+    U'\x0674', U'\x0648', U'\x0674', U'\x06c7', U'\x0674', U'\x064a', U'\x0674', U'\x0915',
+    U'\x093c', U'\x0916', U'\x093c', U'\x0917', U'\x093c', U'\x091c', U'\x093c', U'\x0921',
+    U'\x093c', U'\x0922', U'\x093c', U'\x092b', U'\x093c', U'\x092f', U'\x093c', U'\x09a1',
+    U'\x09bc', U'\x09a2', U'\x09bc', U'\x09af', U'\x09bc', U'\x0a32', U'\x0a3c', U'\x0a38',
+    U'\x0a3c', U'\x0a16', U'\x0a3c', U'\x0a17', U'\x0a3c', U'\x0a1c', U'\x0a3c', U'\x0a2b',
+    U'\x0a3c', U'\x0b21', U'\x0b3c', U'\x0b22', U'\x0b3c', U'\x0e4d', U'\x0e32', U'\x0ecd',
+    U'\x0eb2', U'\x0eab', U'\x0e99', U'\x0eab', U'\x0ea1', U'\x0f42', U'\x0fb7', U'\x0f4c',
+    U'\x0fb7', U'\x0f51', U'\x0fb7', U'\x0f56', U'\x0fb7', U'\x0f5b', U'\x0fb7', U'\x0f40',
+    U'\x0fb5', U'\x0f71', U'\x0f72', U'\x0f71', U'\x0f74', U'\x0fb2', U'\x0f80', U'\x0fb3',
+    U'\x0f80', U'\x0f92', U'\x0fb7', U'\x0f9c', U'\x0fb7', U'\x0fa1', U'\x0fb7', U'\x0fa6',
+    U'\x0fb7', U'\x0fab', U'\x0fb7', U'\x0f90', U'\x0fb5', U'\x0061', U'\x02be', U'\x1f00',
+    U'\x03b9', U'\x1f01', U'\x03b9', U'\x1f02', U'\x03b9', U'\x1f03', U'\x03b9', U'\x1f04',
+    U'\x03b9', U'\x1f05', U'\x03b9', U'\x1f06', U'\x03b9', U'\x1f07', U'\x03b9', U'\x1f20',
+    U'\x03b9', U'\x1f21', U'\x03b9', U'\x1f22', U'\x03b9', U'\x1f23', U'\x03b9', U'\x1f24',
+    U'\x03b9', U'\x1f25', U'\x03b9', U'\x1f26', U'\x03b9', U'\x1f27', U'\x03b9', U'\x1f60',
+    U'\x03b9', U'\x1f61', U'\x03b9', U'\x1f62', U'\x03b9', U'\x1f63', U'\x03b9', U'\x1f64',
+    U'\x03b9', U'\x1f65', U'\x03b9', U'\x1f66', U'\x03b9', U'\x1f67', U'\x03b9', U'\x1f70',
+    U'\x03b9', U'\x03b1', U'\x03b9', U'\x03ac', U'\x03b9', U'\x1fb6', U'\x03b9', U'\x0020',
+    U'\x0342', U'\x1f74', U'\x03b9', U'\x03b7', U'\x03b9', U'\x03ae', U'\x03b9', U'\x1fc6',
+    U'\x03b9', U'\x1f7c', U'\x03b9', U'\x03c9', U'\x03b9', U'\x03ce', U'\x03b9', U'\x1ff6',
+    U'\x03b9', U'\x0020', U'\x0333', U'\x0021', U'\x0021', U'\x0020', U'\x0305', U'\x003f',
+    U'\x003f', U'\x003f', U'\x0021', U'\x0021', U'\x003f', U'\x0072', U'\x0073', U'\x00b0',
+    U'\x0063', U'\x00b0', U'\x0066', U'\x006e', U'\x006f', U'\x0073', U'\x006d', U'\x0074',
+    U'\x006d', U'\x0069', U'\x0076', U'\x0069', U'\x0078', U'\x2add', U'\x0338', U'\x0020',
+    U'\x3099', U'\x0020', U'\x309a', U'\x3088', U'\x308a', U'\x30b3', U'\x30c8', U'\x0033',
+    U'\x0033', U'\x0033', U'\x0034', U'\x0033', U'\x0035', U'\xcc38', U'\xace0', U'\xc8fc',
+    U'\xc758', U'\x0033', U'\x0036', U'\x0033', U'\x0037', U'\x0033', U'\x0038', U'\x0033',
+    U'\x0039', U'\x0034', U'\x0030', U'\x0034', U'\x0032', U'\x0034', U'\x0034', U'\x0034',
+    U'\x0035', U'\x0034', U'\x0036', U'\x0034', U'\x0037', U'\x0034', U'\x0038', U'\x0034',
+    U'\x0039', U'\x0035', U'\x0030', U'\x0033', U'\x6708', U'\x0034', U'\x6708', U'\x0035',
+    U'\x6708', U'\x0036', U'\x6708', U'\x0037', U'\x6708', U'\x0038', U'\x6708', U'\x0039',
+    U'\x6708', U'\x0068', U'\x0067', U'\x0065', U'\x0076', U'\x4ee4', U'\x548c', U'\x30ae',
+    U'\x30ac', U'\x30c7', U'\x30b7', U'\x30c9', U'\x30eb', U'\x30ca', U'\x30ce', U'\x30d4',
+    U'\x30b3', U'\x30d3', U'\x30eb', U'\x30da', U'\x30bd', U'\x30db', U'\x30f3', U'\x30ea',
+    U'\x30e9', U'\x30ec', U'\x30e0', U'\x0064', U'\x0061', U'\x0061', U'\x0075', U'\x006f',
+    U'\x0076', U'\x0070', U'\x0063', U'\x0069', U'\x0075', U'\x5e73', U'\x6210', U'\x662d',
+    U'\x548c', U'\x5927', U'\x6b63', U'\x660e', U'\x6cbb', U'\x006e', U'\x0061', U'\x03bc',
+    U'\x0061', U'\x006b', U'\x0061', U'\x006b', U'\x0062', U'\x006d', U'\x0062', U'\x0067',
+    U'\x0062', U'\x0070', U'\x0066', U'\x006e', U'\x0066', U'\x03bc', U'\x0066', U'\x03bc',
+    U'\x0067', U'\x006d', U'\x0067', U'\x03bc', U'\x006c', U'\x006d', U'\x006c', U'\x0064',
+    U'\x006c', U'\x006b', U'\x006c', U'\x0066', U'\x006d', U'\x006e', U'\x006d', U'\x03bc',
+    U'\x006d', U'\x0070', U'\x0073', U'\x006e', U'\x0073', U'\x03bc', U'\x0073', U'\x006d',
+    U'\x0073', U'\x006e', U'\x0076', U'\x03bc', U'\x0076', U'\x006b', U'\x0076', U'\x0070',
+    U'\x0077', U'\x006e', U'\x0077', U'\x03bc', U'\x0077', U'\x006d', U'\x0077', U'\x006b',
+    U'\x0077', U'\x006b', U'\x03c9', U'\x006d', U'\x03c9', U'\x0062', U'\x0071', U'\x0063',
+    U'\x0063', U'\x0063', U'\x0064', U'\x0064', U'\x0062', U'\x0067', U'\x0079', U'\x0068',
+    U'\x0061', U'\x0069', U'\x006e', U'\x006b', U'\x006b', U'\x006b', U'\x0074', U'\x006c',
+    U'\x006e', U'\x006c', U'\x0078', U'\x0070', U'\x0068', U'\x0070', U'\x0072', U'\x0073',
+    U'\x0072', U'\x0073', U'\x0076', U'\x0077', U'\x0062', U'\x0073', U'\x0074', U'\x0574',
+    U'\x0576', U'\x0574', U'\x0565', U'\x0574', U'\x056b', U'\x057e', U'\x0576', U'\x0574',
+    U'\x056d', U'\x05d9', U'\x05b4', U'\x05f2', U'\x05b7', U'\x05e9', U'\x05c1', U'\x05e9',
+    U'\x05c2', U'\x05d0', U'\x05b7', U'\x05d0', U'\x05b8', U'\x05d0', U'\x05bc', U'\x05d1',
+    U'\x05bc', U'\x05d2', U'\x05bc', U'\x05d3', U'\x05bc', U'\x05d4', U'\x05bc', U'\x05d5',
+    U'\x05bc', U'\x05d6', U'\x05bc', U'\x05d8', U'\x05bc', U'\x05d9', U'\x05bc', U'\x05da',
+    U'\x05bc', U'\x05db', U'\x05bc', U'\x05dc', U'\x05bc', U'\x05de', U'\x05bc', U'\x05e0',
+    U'\x05bc', U'\x05e1', U'\x05bc', U'\x05e3', U'\x05bc', U'\x05e4', U'\x05bc', U'\x05e6',
+    U'\x05bc', U'\x05e7', U'\x05bc', U'\x05e8', U'\x05bc', U'\x05ea', U'\x05bc', U'\x05d5',
+    U'\x05b9', U'\x05d1', U'\x05bf', U'\x05db', U'\x05bf', U'\x05e4', U'\x05bf', U'\x05d0',
+    U'\x05dc', U'\x0626', U'\x0627', U'\x0626', U'\x06d5', U'\x0626', U'\x0648', U'\x0626',
+    U'\x06c7', U'\x0626', U'\x06c6', U'\x0626', U'\x06c8', U'\x0626', U'\x06d0', U'\x0626',
+    U'\x0649', U'\x0626', U'\x062c', U'\x0626', U'\x062d', U'\x0626', U'\x0645', U'\x0626',
+    U'\x064a', U'\x0628', U'\x062c', U'\x0628', U'\x0645', U'\x0628', U'\x0649', U'\x0628',
+    U'\x064a', U'\x062a', U'\x0649', U'\x062a', U'\x064a', U'\x062b', U'\x062c', U'\x062b',
+    U'\x0645', U'\x062b', U'\x0649', U'\x062b', U'\x064a', U'\x062e', U'\x062d', U'\x0636',
+    U'\x062c', U'\x0636', U'\x0645', U'\x0637', U'\x062d', U'\x0638', U'\x0645', U'\x063a',
+    U'\x062c', U'\x0641', U'\x062c', U'\x0641', U'\x062d', U'\x0641', U'\x0649', U'\x0641',
+    U'\x064a', U'\x0642', U'\x062d', U'\x0642', U'\x0649', U'\x0642', U'\x064a', U'\x0643',
+    U'\x0627', U'\x0643', U'\x062c', U'\x0643', U'\x062d', U'\x0643', U'\x062e', U'\x0643',
+    U'\x0644', U'\x0643', U'\x0649', U'\x0643', U'\x064a', U'\x0646', U'\x062e', U'\x0646',
+    U'\x0649', U'\x0646', U'\x064a', U'\x0647', U'\x062c', U'\x0647', U'\x0649', U'\x0647',
+    U'\x064a', U'\x064a', U'\x0649', U'\x0630', U'\x0670', U'\x0631', U'\x0670', U'\x0649',
+    U'\x0670', U'\x0626', U'\x0631', U'\x0626', U'\x0632', U'\x0626', U'\x0646', U'\x0628',
+    U'\x0632', U'\x0628', U'\x0646', U'\x062a', U'\x0631', U'\x062a', U'\x0632', U'\x062a',
+    U'\x0646', U'\x062b', U'\x0631', U'\x062b', U'\x0632', U'\x062b', U'\x0646', U'\x0645',
+    U'\x0627', U'\x0646', U'\x0631', U'\x0646', U'\x0632', U'\x0646', U'\x0646', U'\x064a',
+    U'\x0631', U'\x064a', U'\x0632', U'\x0626', U'\x062e', U'\x0626', U'\x0647', U'\x0628',
+    U'\x0647', U'\x062a', U'\x0647', U'\x0635', U'\x062e', U'\x0646', U'\x0647', U'\x0647',
+    U'\x0670', U'\x062b', U'\x0647', U'\x0633', U'\x0647', U'\x0634', U'\x0647', U'\x0637',
+    U'\x0649', U'\x0637', U'\x064a', U'\x0639', U'\x0649', U'\x0639', U'\x064a', U'\x063a',
+    U'\x0649', U'\x063a', U'\x064a', U'\x0633', U'\x0649', U'\x0633', U'\x064a', U'\x0634',
+    U'\x0649', U'\x0634', U'\x064a', U'\x0635', U'\x0649', U'\x0635', U'\x064a', U'\x0636',
+    U'\x0649', U'\x0636', U'\x064a', U'\x0634', U'\x062e', U'\x0634', U'\x0631', U'\x0633',
+    U'\x0631', U'\x0635', U'\x0631', U'\x0636', U'\x0631', U'\x0627', U'\x064b', U'\x0020',
+    U'\x064b', U'\x0640', U'\x064b', U'\x0640', U'\x0651', U'\x0020', U'\x0652', U'\x0640',
+    U'\x0652', U'\x0644', U'\x0622', U'\x0644', U'\x0623', U'\x0644', U'\x0625', U'\x1d157',
+    U'\x1d165', U'\x0030', U'\x002c', U'\x0031', U'\x002c', U'\x0032', U'\x002c', U'\x0033',
+    U'\x002c', U'\x0034', U'\x002c', U'\x0035', U'\x002c', U'\x0036', U'\x002c', U'\x0037',
+    U'\x002c', U'\x0038', U'\x002c', U'\x0039', U'\x002c', U'\x0077', U'\x007a', U'\x0068',
+    U'\x0076', U'\x0073', U'\x0064', U'\x0077', U'\x0063', U'\x006d', U'\x0063', U'\x006d',
+    U'\x0064', U'\x006d', U'\x0072', U'\x0064', U'\x006a', U'\x307b', U'\x304b', U'\x30b3',
+    U'\x30b3', U'\x00e0', U'\x00e1', U'\x00e2', U'\x00e3', U'\x00e4', U'\x00e5', U'\x00e6',
+    U'\x00e7', U'\x00e8', U'\x00e9', U'\x00ea', U'\x00eb', U'\x00ec', U'\x00ed', U'\x00ee',
+    U'\x00ef', U'\x00f0', U'\x00f1', U'\x00f2', U'\x00f3', U'\x00f4', U'\x00f5', U'\x00f6',
+    U'\x00f8', U'\x00f9', U'\x00fa', U'\x00fb', U'\x00fc', U'\x00fd', U'\x00fe', U'\x0101',
+    U'\x0103', U'\x0105', U'\x0107', U'\x0109', U'\x010b', U'\x010d', U'\x010f', U'\x0111',
+    U'\x0113', U'\x0115', U'\x0117', U'\x0119', U'\x011b', U'\x011d', U'\x011f', U'\x0121',
+    U'\x0123', U'\x0125', U'\x0127', U'\x0129', U'\x012b', U'\x012d', U'\x012f', U'\x0135',
+    U'\x0137', U'\x013a', U'\x013c', U'\x013e', U'\x0142', U'\x0144', U'\x0146', U'\x0148',
+    U'\x014b', U'\x014d', U'\x014f', U'\x0151', U'\x0153', U'\x0155', U'\x0157', U'\x0159',
+    U'\x015b', U'\x015d', U'\x015f', U'\x0161', U'\x0163', U'\x0165', U'\x0167', U'\x0169',
+    U'\x016b', U'\x016d', U'\x016f', U'\x0171', U'\x0173', U'\x0175', U'\x0177', U'\x00ff',
+    U'\x017a', U'\x017c', U'\x0253', U'\x0183', U'\x0185', U'\x0254', U'\x0188', U'\x0256',
+    U'\x0257', U'\x018c', U'\x01dd', U'\x0259', U'\x025b', U'\x0192', U'\x0260', U'\x0263',
+    U'\x0269', U'\x0268', U'\x0199', U'\x026f', U'\x0272', U'\x0275', U'\x01a1', U'\x01a3',
+    U'\x01a5', U'\x0280', U'\x01a8', U'\x0283', U'\x01ad', U'\x0288', U'\x01b0', U'\x028a',
+    U'\x028b', U'\x01b4', U'\x01b6', U'\x0292', U'\x01b9', U'\x01bd', U'\x01ce', U'\x01d0',
+    U'\x01d2', U'\x01d4', U'\x01d6', U'\x01d8', U'\x01da', U'\x01dc', U'\x01df', U'\x01e1',
+    U'\x01e3', U'\x01e5', U'\x01e7', U'\x01e9', U'\x01eb', U'\x01ed', U'\x01ef', U'\x01f5',
+    U'\x0195', U'\x01bf', U'\x01f9', U'\x01fb', U'\x01fd', U'\x01ff', U'\x0201', U'\x0203',
+    U'\x0205', U'\x0207', U'\x0209', U'\x020b', U'\x020d', U'\x020f', U'\x0211', U'\x0213',
+    U'\x0215', U'\x0217', U'\x0219', U'\x021b', U'\x021d', U'\x021f', U'\x019e', U'\x0223',
+    U'\x0225', U'\x0227', U'\x0229', U'\x022b', U'\x022d', U'\x022f', U'\x0231', U'\x0233',
+    U'\x2c65', U'\x023c', U'\x019a', U'\x2c66', U'\x0242', U'\x0180', U'\x0289', U'\x028c',
+    U'\x0247', U'\x0249', U'\x024b', U'\x024d', U'\x024f', U'\x0266', U'\x0279', U'\x027b',
+    U'\x0281', U'\x0295', U'\x0371', U'\x0373', U'\x02b9', U'\x0377', U'\x003b', U'\x03f3',
+    U'\x03ad', U'\x03af', U'\x03cc', U'\x03cd', U'\x03b2', U'\x03b3', U'\x03b4', U'\x03b5',
+    U'\x03b6', U'\x03b8', U'\x03ba', U'\x03bb', U'\x03bd', U'\x03be', U'\x03bf', U'\x03c0',
+    U'\x03c1', U'\x03c3', U'\x03c4', U'\x03c5', U'\x03c6', U'\x03c7', U'\x03c8', U'\x03ca',
+    U'\x03cb', U'\x03d7', U'\x03d9', U'\x03db', U'\x03dd', U'\x03df', U'\x03e1', U'\x03e3',
+    U'\x03e5', U'\x03e7', U'\x03e9', U'\x03eb', U'\x03ed', U'\x03ef', U'\x03f8', U'\x03fb',
+    U'\x037b', U'\x037c', U'\x037d', U'\x0450', U'\x0451', U'\x0452', U'\x0453', U'\x0454',
+    U'\x0455', U'\x0456', U'\x0457', U'\x0458', U'\x0459', U'\x045a', U'\x045b', U'\x045c',
+    U'\x045d', U'\x045e', U'\x045f', U'\x0430', U'\x0431', U'\x0432', U'\x0433', U'\x0434',
+    U'\x0435', U'\x0436', U'\x0437', U'\x0438', U'\x0439', U'\x043a', U'\x043b', U'\x043c',
+    U'\x043d', U'\x043e', U'\x043f', U'\x0440', U'\x0441', U'\x0442', U'\x0443', U'\x0444',
+    U'\x0445', U'\x0446', U'\x0447', U'\x0448', U'\x0449', U'\x044a', U'\x044b', U'\x044c',
+    U'\x044d', U'\x044e', U'\x044f', U'\x0461', U'\x0463', U'\x0465', U'\x0467', U'\x0469',
+    U'\x046b', U'\x046d', U'\x046f', U'\x0471', U'\x0473', U'\x0475', U'\x0477', U'\x0479',
+    U'\x047b', U'\x047d', U'\x047f', U'\x0481', U'\x048b', U'\x048d', U'\x048f', U'\x0491',
+    U'\x0493', U'\x0495', U'\x0497', U'\x0499', U'\x049b', U'\x049d', U'\x049f', U'\x04a1',
+    U'\x04a3', U'\x04a5', U'\x04a7', U'\x04a9', U'\x04ab', U'\x04ad', U'\x04af', U'\x04b1',
+    U'\x04b3', U'\x04b5', U'\x04b7', U'\x04b9', U'\x04bb', U'\x04bd', U'\x04bf', U'\x04c2',
+    U'\x04c4', U'\x04c6', U'\x04c8', U'\x04ca', U'\x04cc', U'\x04ce', U'\x04d1', U'\x04d3',
+    U'\x04d5', U'\x04d7', U'\x04d9', U'\x04db', U'\x04dd', U'\x04df', U'\x04e1', U'\x04e3',
+    U'\x04e5', U'\x04e7', U'\x04e9', U'\x04eb', U'\x04ed', U'\x04ef', U'\x04f1', U'\x04f3',
+    U'\x04f5', U'\x04f7', U'\x04f9', U'\x04fb', U'\x04fd', U'\x04ff', U'\x0501', U'\x0503',
+    U'\x0505', U'\x0507', U'\x0509', U'\x050b', U'\x050d', U'\x050f', U'\x0511', U'\x0513',
+    U'\x0515', U'\x0517', U'\x0519', U'\x051b', U'\x051d', U'\x051f', U'\x0521', U'\x0523',
+    U'\x0525', U'\x0527', U'\x0529', U'\x052b', U'\x052d', U'\x052f', U'\x0561', U'\x0562',
+    U'\x0563', U'\x0564', U'\x0566', U'\x0567', U'\x0568', U'\x0569', U'\x056a', U'\x056c',
+    U'\x056e', U'\x056f', U'\x0570', U'\x0571', U'\x0572', U'\x0573', U'\x0575', U'\x0577',
+    U'\x0578', U'\x0579', U'\x057a', U'\x057b', U'\x057c', U'\x057d', U'\x057f', U'\x0580',
+    U'\x0581', U'\x0583', U'\x0584', U'\x0585', U'\x0586', U'\x0f0b', U'\x2d27', U'\x2d2d',
+    U'\x10dc', U'\x13f0', U'\x13f1', U'\x13f2', U'\x13f3', U'\x13f4', U'\x13f5', U'\xa64b',
+    U'\x10d0', U'\x10d1', U'\x10d2', U'\x10d3', U'\x10d4', U'\x10d5', U'\x10d6', U'\x10d7',
+    U'\x10d8', U'\x10d9', U'\x10da', U'\x10db', U'\x10dd', U'\x10de', U'\x10df', U'\x10e0',
+    U'\x10e1', U'\x10e2', U'\x10e3', U'\x10e4', U'\x10e5', U'\x10e6', U'\x10e7', U'\x10e8',
+    U'\x10e9', U'\x10ea', U'\x10eb', U'\x10ec', U'\x10ed', U'\x10ee', U'\x10ef', U'\x10f0',
+    U'\x10f1', U'\x10f2', U'\x10f3', U'\x10f4', U'\x10f5', U'\x10f6', U'\x10f7', U'\x10f8',
+    U'\x10f9', U'\x10fa', U'\x10fd', U'\x10fe', U'\x10ff', U'\x0250', U'\x0251', U'\x1d02',
+    U'\x025c', U'\x1d16', U'\x1d17', U'\x1d1d', U'\x1d25', U'\x0252', U'\x0255', U'\x025f',
+    U'\x0261', U'\x0265', U'\x026a', U'\x1d7b', U'\x029d', U'\x026d', U'\x1d85', U'\x029f',
+    U'\x0271', U'\x0270', U'\x0273', U'\x0274', U'\x0278', U'\x0282', U'\x01ab', U'\x1d1c',
+    U'\x0290', U'\x0291', U'\x1e01', U'\x1e03', U'\x1e05', U'\x1e07', U'\x1e09', U'\x1e0b',
+    U'\x1e0d', U'\x1e0f', U'\x1e11', U'\x1e13', U'\x1e15', U'\x1e17', U'\x1e19', U'\x1e1b',
+    U'\x1e1d', U'\x1e1f', U'\x1e21', U'\x1e23', U'\x1e25', U'\x1e27', U'\x1e29', U'\x1e2b',
+    U'\x1e2d', U'\x1e2f', U'\x1e31', U'\x1e33', U'\x1e35', U'\x1e37', U'\x1e39', U'\x1e3b',
+    U'\x1e3d', U'\x1e3f', U'\x1e41', U'\x1e43', U'\x1e45', U'\x1e47', U'\x1e49', U'\x1e4b',
+    U'\x1e4d', U'\x1e4f', U'\x1e51', U'\x1e53', U'\x1e55', U'\x1e57', U'\x1e59', U'\x1e5b',
+    U'\x1e5d', U'\x1e5f', U'\x1e61', U'\x1e63', U'\x1e65', U'\x1e67', U'\x1e69', U'\x1e6b',
+    U'\x1e6d', U'\x1e6f', U'\x1e71', U'\x1e73', U'\x1e75', U'\x1e77', U'\x1e79', U'\x1e7b',
+    U'\x1e7d', U'\x1e7f', U'\x1e81', U'\x1e83', U'\x1e85', U'\x1e87', U'\x1e89', U'\x1e8b',
+    U'\x1e8d', U'\x1e8f', U'\x1e91', U'\x1e93', U'\x1e95', U'\x00df', U'\x1ea1', U'\x1ea3',
+    U'\x1ea5', U'\x1ea7', U'\x1ea9', U'\x1eab', U'\x1ead', U'\x1eaf', U'\x1eb1', U'\x1eb3',
+    U'\x1eb5', U'\x1eb7', U'\x1eb9', U'\x1ebb', U'\x1ebd', U'\x1ebf', U'\x1ec1', U'\x1ec3',
+    U'\x1ec5', U'\x1ec7', U'\x1ec9', U'\x1ecb', U'\x1ecd', U'\x1ecf', U'\x1ed1', U'\x1ed3',
+    U'\x1ed5', U'\x1ed7', U'\x1ed9', U'\x1edb', U'\x1edd', U'\x1edf', U'\x1ee1', U'\x1ee3',
+    U'\x1ee5', U'\x1ee7', U'\x1ee9', U'\x1eeb', U'\x1eed', U'\x1eef', U'\x1ef1', U'\x1ef3',
+    U'\x1ef5', U'\x1ef7', U'\x1ef9', U'\x1efb', U'\x1efd', U'\x1eff', U'\x1f10', U'\x1f11',
+    U'\x1f12', U'\x1f13', U'\x1f14', U'\x1f15', U'\x1f30', U'\x1f31', U'\x1f32', U'\x1f33',
+    U'\x1f34', U'\x1f35', U'\x1f36', U'\x1f37', U'\x1f40', U'\x1f41', U'\x1f42', U'\x1f43',
+    U'\x1f44', U'\x1f45', U'\x1f51', U'\x1f53', U'\x1f55', U'\x1f57', U'\x1fb0', U'\x1fb1',
+    U'\x1f72', U'\x0390', U'\x1fd0', U'\x1fd1', U'\x1f76', U'\x03b0', U'\x1fe0', U'\x1fe1',
+    U'\x1f7a', U'\x1fe5', U'\x0060', U'\x1f78', U'\x2010', U'\x002b', U'\x2212', U'\x2211',
+    U'\x3008', U'\x3009', U'\x2c30', U'\x2c31', U'\x2c32', U'\x2c33', U'\x2c34', U'\x2c35',
+    U'\x2c36', U'\x2c37', U'\x2c38', U'\x2c39', U'\x2c3a', U'\x2c3b', U'\x2c3c', U'\x2c3d',
+    U'\x2c3e', U'\x2c3f', U'\x2c40', U'\x2c41', U'\x2c42', U'\x2c43', U'\x2c44', U'\x2c45',
+    U'\x2c46', U'\x2c47', U'\x2c48', U'\x2c49', U'\x2c4a', U'\x2c4b', U'\x2c4c', U'\x2c4d',
+    U'\x2c4e', U'\x2c4f', U'\x2c50', U'\x2c51', U'\x2c52', U'\x2c53', U'\x2c54', U'\x2c55',
+    U'\x2c56', U'\x2c57', U'\x2c58', U'\x2c59', U'\x2c5a', U'\x2c5b', U'\x2c5c', U'\x2c5d',
+    U'\x2c5e', U'\x2c5f', U'\x2c61', U'\x026b', U'\x1d7d', U'\x027d', U'\x2c68', U'\x2c6a',
+    U'\x2c6c', U'\x2c73', U'\x2c76', U'\x023f', U'\x0240', U'\x2c81', U'\x2c83', U'\x2c85',
+    U'\x2c87', U'\x2c89', U'\x2c8b', U'\x2c8d', U'\x2c8f', U'\x2c91', U'\x2c93', U'\x2c95',
+    U'\x2c97', U'\x2c99', U'\x2c9b', U'\x2c9d', U'\x2c9f', U'\x2ca1', U'\x2ca3', U'\x2ca5',
+    U'\x2ca7', U'\x2ca9', U'\x2cab', U'\x2cad', U'\x2caf', U'\x2cb1', U'\x2cb3', U'\x2cb5',
+    U'\x2cb7', U'\x2cb9', U'\x2cbb', U'\x2cbd', U'\x2cbf', U'\x2cc1', U'\x2cc3', U'\x2cc5',
+    U'\x2cc7', U'\x2cc9', U'\x2ccb', U'\x2ccd', U'\x2ccf', U'\x2cd1', U'\x2cd3', U'\x2cd5',
+    U'\x2cd7', U'\x2cd9', U'\x2cdb', U'\x2cdd', U'\x2cdf', U'\x2ce1', U'\x2ce3', U'\x2cec',
+    U'\x2cee', U'\x2cf3', U'\x2d61', U'\x6bcd', U'\x9f9f', U'\x4e28', U'\x4e36', U'\x4e3f',
+    U'\x4e59', U'\x4e85', U'\x4ea0', U'\x4eba', U'\x513f', U'\x5165', U'\x5182', U'\x5196',
+    U'\x51ab', U'\x51e0', U'\x51f5', U'\x5200', U'\x529b', U'\x52f9', U'\x5315', U'\x531a',
+    U'\x5338', U'\x535c', U'\x5369', U'\x5382', U'\x53b6', U'\x53c8', U'\x53e3', U'\x56d7',
+    U'\x58eb', U'\x5902', U'\x590a', U'\x5915', U'\x5973', U'\x5b50', U'\x5b80', U'\x5bf8',
+    U'\x5c0f', U'\x5c22', U'\x5c38', U'\x5c6e', U'\x5c71', U'\x5ddb', U'\x5de5', U'\x5df1',
+    U'\x5dfe', U'\x5e72', U'\x5e7a', U'\x5e7f', U'\x5ef4', U'\x5efe', U'\x5f0b', U'\x5f13',
+    U'\x5f50', U'\x5f61', U'\x5f73', U'\x5fc3', U'\x6208', U'\x6236', U'\x624b', U'\x652f',
+    U'\x6534', U'\x6587', U'\x6597', U'\x65a4', U'\x65b9', U'\x65e0', U'\x66f0', U'\x6b20',
+    U'\x6b62', U'\x6b79', U'\x6bb3', U'\x6bcb', U'\x6bd4', U'\x6bdb', U'\x6c0f', U'\x6c14',
+    U'\x722a', U'\x7236', U'\x723b', U'\x723f', U'\x7247', U'\x7259', U'\x725b', U'\x72ac',
+    U'\x7384', U'\x7389', U'\x74dc', U'\x74e6', U'\x7518', U'\x751f', U'\x7528', U'\x7530',
+    U'\x758b', U'\x7592', U'\x7676', U'\x767d', U'\x76ae', U'\x76bf', U'\x76ee', U'\x77db',
+    U'\x77e2', U'\x77f3', U'\x793a', U'\x79b8', U'\x79be', U'\x7a74', U'\x7acb', U'\x7af9',
+    U'\x7c73', U'\x7cf8', U'\x7f36', U'\x7f51', U'\x7f8a', U'\x7fbd', U'\x8001', U'\x800c',
+    U'\x8012', U'\x8033', U'\x807f', U'\x8089', U'\x81e3', U'\x81fc', U'\x820c', U'\x821b',
+    U'\x821f', U'\x826e', U'\x8272', U'\x8278', U'\x864d', U'\x866b', U'\x8840', U'\x884c',
+    U'\x8863', U'\x897e', U'\x898b', U'\x89d2', U'\x8a00', U'\x8c37', U'\x8c46', U'\x8c55',
+    U'\x8c78', U'\x8c9d', U'\x8d64', U'\x8d70', U'\x8db3', U'\x8eab', U'\x8eca', U'\x8f9b',
+    U'\x8fb0', U'\x8fb5', U'\x9091', U'\x9149', U'\x91c6', U'\x91cc', U'\x9577', U'\x9580',
+    U'\x961c', U'\x96b6', U'\x96b9', U'\x96e8', U'\x9751', U'\x975e', U'\x9762', U'\x9769',
+    U'\x97cb', U'\x97ed', U'\x97f3', U'\x9801', U'\x98a8', U'\x98db', U'\x98df', U'\x9996',
+    U'\x9999', U'\x99ac', U'\x9aa8', U'\x9ad8', U'\x9adf', U'\x9b25', U'\x9b2f', U'\x9b32',
+    U'\x9b3c', U'\x9b5a', U'\x9ce5', U'\x9e75', U'\x9e7f', U'\x9ea5', U'\x9ebb', U'\x9ec3',
+    U'\x9ecd', U'\x9ed1', U'\x9ef9', U'\x9efd', U'\x9f0e', U'\x9f13', U'\x9f20', U'\x9f3b',
+    U'\x9f4a', U'\x9f52', U'\x9f8d', U'\x9f9c', U'\x9fa0', U'\x002e', U'\x3012', U'\x5344',
+    U'\x5345', U'\x1101', U'\x11aa', U'\x11ac', U'\x11ad', U'\x1104', U'\x11b0', U'\x11b1',
+    U'\x11b2', U'\x11b3', U'\x11b4', U'\x11b5', U'\x111a', U'\x1108', U'\x1121', U'\x110a',
+    U'\x110d', U'\x1161', U'\x1162', U'\x1163', U'\x1164', U'\x1165', U'\x1166', U'\x1167',
+    U'\x1168', U'\x1169', U'\x116a', U'\x116b', U'\x116c', U'\x116d', U'\x116e', U'\x116f',
+    U'\x1170', U'\x1171', U'\x1172', U'\x1173', U'\x1174', U'\x1175', U'\x1114', U'\x1115',
+    U'\x11c7', U'\x11c8', U'\x11cc', U'\x11ce', U'\x11d3', U'\x11d7', U'\x11d9', U'\x111c',
+    U'\x11dd', U'\x11df', U'\x111d', U'\x111e', U'\x1120', U'\x1122', U'\x1123', U'\x1127',
+    U'\x1129', U'\x112b', U'\x112c', U'\x112d', U'\x112e', U'\x112f', U'\x1132', U'\x1136',
+    U'\x1140', U'\x1147', U'\x114c', U'\x11f1', U'\x11f2', U'\x1157', U'\x1158', U'\x1159',
+    U'\x1184', U'\x1185', U'\x1188', U'\x1191', U'\x1192', U'\x1194', U'\x119e', U'\x11a1',
+    U'\x4e0a', U'\x4e2d', U'\x4e0b', U'\x7532', U'\x4e19', U'\x4e01', U'\x5929', U'\x5730',
+    U'\x554f', U'\x5e7c', U'\x7b8f', U'\xc6b0', U'\x79d8', U'\x7537', U'\x9069', U'\x512a',
+    U'\x5370', U'\x6ce8', U'\x9805', U'\x5199', U'\x5de6', U'\x53f3', U'\x533b', U'\x5b97',
+    U'\x591c', U'\x30c6', U'\x30cc', U'\x30e2', U'\x30e8', U'\x30f0', U'\x30f1', U'\x30f2',
+    U'\xa641', U'\xa643', U'\xa645', U'\xa647', U'\xa649', U'\xa64d', U'\xa64f', U'\xa651',
+    U'\xa653', U'\xa655', U'\xa657', U'\xa659', U'\xa65b', U'\xa65d', U'\xa65f', U'\xa661',
+    U'\xa663', U'\xa665', U'\xa667', U'\xa669', U'\xa66b', U'\xa66d', U'\xa681', U'\xa683',
+    U'\xa685', U'\xa687', U'\xa689', U'\xa68b', U'\xa68d', U'\xa68f', U'\xa691', U'\xa693',
+    U'\xa695', U'\xa697', U'\xa699', U'\xa69b', U'\xa723', U'\xa725', U'\xa727', U'\xa729',
+    U'\xa72b', U'\xa72d', U'\xa72f', U'\xa733', U'\xa735', U'\xa737', U'\xa739', U'\xa73b',
+    U'\xa73d', U'\xa73f', U'\xa741', U'\xa743', U'\xa745', U'\xa747', U'\xa749', U'\xa74b',
+    U'\xa74d', U'\xa74f', U'\xa751', U'\xa753', U'\xa755', U'\xa757', U'\xa759', U'\xa75b',
+    U'\xa75d', U'\xa75f', U'\xa761', U'\xa763', U'\xa765', U'\xa767', U'\xa769', U'\xa76b',
+    U'\xa76d', U'\xa76f', U'\xa77a', U'\xa77c', U'\x1d79', U'\xa77f', U'\xa781', U'\xa783',
+    U'\xa785', U'\xa787', U'\xa78c', U'\xa791', U'\xa793', U'\xa797', U'\xa799', U'\xa79b',
+    U'\xa79d', U'\xa79f', U'\xa7a1', U'\xa7a3', U'\xa7a5', U'\xa7a7', U'\xa7a9', U'\x026c',
+    U'\x029e', U'\x0287', U'\xab53', U'\xa7b5', U'\xa7b7', U'\xa7b9', U'\xa7bb', U'\xa7bd',
+    U'\xa7bf', U'\xa7c1', U'\xa7c3', U'\xa794', U'\x1d8e', U'\xa7c8', U'\xa7ca', U'\xa7d1',
+    U'\xa7d7', U'\xa7d9', U'\xa7f6', U'\xab37', U'\xab52', U'\x028d', U'\x13a0', U'\x13a1',
+    U'\x13a2', U'\x13a3', U'\x13a4', U'\x13a5', U'\x13a6', U'\x13a7', U'\x13a8', U'\x13a9',
+    U'\x13aa', U'\x13ab', U'\x13ac', U'\x13ad', U'\x13ae', U'\x13af', U'\x13b0', U'\x13b1',
+    U'\x13b2', U'\x13b3', U'\x13b4', U'\x13b5', U'\x13b6', U'\x13b7', U'\x13b8', U'\x13b9',
+    U'\x13ba', U'\x13bb', U'\x13bc', U'\x13bd', U'\x13be', U'\x13bf', U'\x13c0', U'\x13c1',
+    U'\x13c2', U'\x13c3', U'\x13c4', U'\x13c5', U'\x13c6', U'\x13c7', U'\x13c8', U'\x13c9',
+    U'\x13ca', U'\x13cb', U'\x13cc', U'\x13cd', U'\x13ce', U'\x13cf', U'\x13d0', U'\x13d1',
+    U'\x13d2', U'\x13d3', U'\x13d4', U'\x13d5', U'\x13d6', U'\x13d7', U'\x13d8', U'\x13d9',
+    U'\x13da', U'\x13db', U'\x13dc', U'\x13dd', U'\x13de', U'\x13df', U'\x13e0', U'\x13e1',
+    U'\x13e2', U'\x13e3', U'\x13e4', U'\x13e5', U'\x13e6', U'\x13e7', U'\x13e8', U'\x13e9',
+    U'\x13ea', U'\x13eb', U'\x13ec', U'\x13ed', U'\x13ee', U'\x13ef', U'\x8c48', U'\x66f4',
+    U'\x8cc8', U'\x6ed1', U'\x4e32', U'\x53e5', U'\x5951', U'\x5587', U'\x5948', U'\x61f6',
+    U'\x7669', U'\x7f85', U'\x863f', U'\x87ba', U'\x88f8', U'\x908f', U'\x6a02', U'\x6d1b',
+    U'\x70d9', U'\x73de', U'\x843d', U'\x916a', U'\x99f1', U'\x4e82', U'\x5375', U'\x6b04',
+    U'\x721b', U'\x862d', U'\x9e1e', U'\x5d50', U'\x6feb', U'\x85cd', U'\x8964', U'\x62c9',
+    U'\x81d8', U'\x881f', U'\x5eca', U'\x6717', U'\x6d6a', U'\x72fc', U'\x90ce', U'\x4f86',
+    U'\x51b7', U'\x52de', U'\x64c4', U'\x6ad3', U'\x7210', U'\x76e7', U'\x8606', U'\x865c',
+    U'\x8def', U'\x9732', U'\x9b6f', U'\x9dfa', U'\x788c', U'\x797f', U'\x7da0', U'\x83c9',
+    U'\x9304', U'\x8ad6', U'\x58df', U'\x5f04', U'\x7c60', U'\x807e', U'\x7262', U'\x78ca',
+    U'\x8cc2', U'\x96f7', U'\x58d8', U'\x5c62', U'\x6a13', U'\x6dda', U'\x6f0f', U'\x7d2f',
+    U'\x7e37', U'\x964b', U'\x52d2', U'\x808b', U'\x51dc', U'\x51cc', U'\x7a1c', U'\x7dbe',
+    U'\x83f1', U'\x9675', U'\x8b80', U'\x62cf', U'\x8afe', U'\x4e39', U'\x5be7', U'\x6012',
+    U'\x7387', U'\x7570', U'\x5317', U'\x78fb', U'\x4fbf', U'\x5fa9', U'\x4e0d', U'\x6ccc',
+    U'\x6578', U'\x7d22', U'\x53c3', U'\x585e', U'\x7701', U'\x8449', U'\x8aaa', U'\x6bba',
+    U'\x6c88', U'\x62fe', U'\x82e5', U'\x63a0', U'\x7565', U'\x4eae', U'\x5169', U'\x51c9',
+    U'\x6881', U'\x7ce7', U'\x826f', U'\x8ad2', U'\x91cf', U'\x52f5', U'\x5442', U'\x5eec',
+    U'\x65c5', U'\x6ffe', U'\x792a', U'\x95ad', U'\x9a6a', U'\x9e97', U'\x9ece', U'\x66c6',
+    U'\x6b77', U'\x8f62', U'\x5e74', U'\x6190', U'\x6200', U'\x649a', U'\x6f23', U'\x7149',
+    U'\x7489', U'\x79ca', U'\x7df4', U'\x806f', U'\x8f26', U'\x84ee', U'\x9023', U'\x934a',
+    U'\x5217', U'\x52a3', U'\x54bd', U'\x70c8', U'\x88c2', U'\x5ec9', U'\x5ff5', U'\x637b',
+    U'\x6bae', U'\x7c3e', U'\x7375', U'\x56f9', U'\x5dba', U'\x601c', U'\x73b2', U'\x7469',
+    U'\x7f9a', U'\x8046', U'\x9234', U'\x96f6', U'\x9748', U'\x9818', U'\x4f8b', U'\x79ae',
+    U'\x91b4', U'\x96b8', U'\x60e1', U'\x4e86', U'\x50da', U'\x5bee', U'\x5c3f', U'\x6599',
+    U'\x71ce', U'\x7642', U'\x84fc', U'\x907c', U'\x6688', U'\x962e', U'\x5289', U'\x677b',
+    U'\x67f3', U'\x6d41', U'\x6e9c', U'\x7409', U'\x7559', U'\x786b', U'\x7d10', U'\x985e',
+    U'\x622e', U'\x9678', U'\x502b', U'\x5d19', U'\x6dea', U'\x8f2a', U'\x5f8b', U'\x6144',
+    U'\x6817', U'\x9686', U'\x5229', U'\x540f', U'\x5c65', U'\x6613', U'\x674e', U'\x68a8',
+    U'\x6ce5', U'\x7406', U'\x75e2', U'\x7f79', U'\x88cf', U'\x88e1', U'\x96e2', U'\x533f',
+    U'\x6eba', U'\x541d', U'\x71d0', U'\x7498', U'\x85fa', U'\x96a3', U'\x9c57', U'\x9e9f',
+    U'\x6797', U'\x6dcb', U'\x81e8', U'\x7b20', U'\x7c92', U'\x72c0', U'\x7099', U'\x8b58',
+    U'\x4ec0', U'\x8336', U'\x523a', U'\x5207', U'\x5ea6', U'\x62d3', U'\x7cd6', U'\x5b85',
+    U'\x6d1e', U'\x66b4', U'\x8f3b', U'\x964d', U'\x5ed3', U'\x5140', U'\x55c0', U'\x585a',
+    U'\x6674', U'\x51de', U'\x732a', U'\x76ca', U'\x793c', U'\x795e', U'\x7965', U'\x798f',
+    U'\x9756', U'\x7cbe', U'\x8612', U'\x8af8', U'\x9038', U'\x90fd', U'\x98ef', U'\x98fc',
+    U'\x9928', U'\x9db4', U'\x90de', U'\x96b7', U'\x4fae', U'\x50e7', U'\x514d', U'\x52c9',
+    U'\x52e4', U'\x5351', U'\x559d', U'\x5606', U'\x5668', U'\x5840', U'\x58a8', U'\x5c64',
+    U'\x6094', U'\x6168', U'\x618e', U'\x61f2', U'\x654f', U'\x65e2', U'\x6691', U'\x6885',
+    U'\x6d77', U'\x6e1a', U'\x6f22', U'\x716e', U'\x722b', U'\x7422', U'\x7891', U'\x7949',
+    U'\x7948', U'\x7950', U'\x7956', U'\x798d', U'\x798e', U'\x7a40', U'\x7a81', U'\x7bc0',
+    U'\x7e09', U'\x7e41', U'\x7f72', U'\x8005', U'\x81ed', U'\x8279', U'\x8457', U'\x8910',
+    U'\x8996', U'\x8b01', U'\x8b39', U'\x8cd3', U'\x8d08', U'\x8fb6', U'\x96e3', U'\x97ff',
+    U'\x983b', U'\x6075', U'\x242ee', U'\x8218', U'\x4e26', U'\x51b5', U'\x5168', U'\x4f80',
+    U'\x5145', U'\x5180', U'\x52c7', U'\x52fa', U'\x5555', U'\x5599', U'\x55e2', U'\x58b3',
+    U'\x5944', U'\x5954', U'\x5a62', U'\x5b28', U'\x5ed2', U'\x5ed9', U'\x5f69', U'\x5fad',
+    U'\x60d8', U'\x614e', U'\x6108', U'\x6160', U'\x6234', U'\x63c4', U'\x641c', U'\x6452',
+    U'\x6556', U'\x671b', U'\x6756', U'\x6edb', U'\x6ecb', U'\x701e', U'\x77a7', U'\x7235',
+    U'\x72af', U'\x7471', U'\x7506', U'\x753b', U'\x761d', U'\x761f', U'\x76db', U'\x76f4',
+    U'\x774a', U'\x7740', U'\x78cc', U'\x7ab1', U'\x7c7b', U'\x7d5b', U'\x7f3e', U'\x8352',
+    U'\x83ef', U'\x8779', U'\x8941', U'\x8986', U'\x8abf', U'\x8acb', U'\x8aed', U'\x8b8a',
+    U'\x8f38', U'\x9072', U'\x9199', U'\x9276', U'\x967c', U'\x97db', U'\x980b', U'\x9b12',
+    U'\x2284a', U'\x22844', U'\x233d5', U'\x3b9d', U'\x4018', U'\x4039', U'\x25249', U'\x25cd0',
+    U'\x27ed3', U'\x9f43', U'\x9f8e', U'\x05e2', U'\x05dd', U'\x0671', U'\x067b', U'\x067e',
+    U'\x0680', U'\x067a', U'\x067f', U'\x0679', U'\x06a4', U'\x06a6', U'\x0684', U'\x0683',
+    U'\x0686', U'\x0687', U'\x068d', U'\x068c', U'\x068e', U'\x0688', U'\x0698', U'\x0691',
+    U'\x06a9', U'\x06af', U'\x06b3', U'\x06b1', U'\x06ba', U'\x06bb', U'\x06c0', U'\x06c1',
+    U'\x06be', U'\x06d3', U'\x06ad', U'\x06cb', U'\x06c5', U'\x06c9', U'\x3001', U'\x3016',
+    U'\x3017', U'\x2014', U'\x2013', U'\x005f', U'\x007b', U'\x007d', U'\x3010', U'\x3011',
+    U'\x300a', U'\x300b', U'\x300c', U'\x300d', U'\x300e', U'\x300f', U'\x005b', U'\x005d',
+    U'\x0023', U'\x0026', U'\x002a', U'\x002d', U'\x003c', U'\x003e', U'\x005c', U'\x0024',
+    U'\x0025', U'\x0040', U'\x0621', U'\x0624', U'\x0629', U'\x0022', U'\x0027', U'\x005e',
+    U'\x007c', U'\x007e', U'\x2985', U'\x2986', U'\x30fb', U'\x30a5', U'\x30e3', U'\x00a2',
+    U'\x00a3', U'\x00ac', U'\x00a6', U'\x00a5', U'\x20a9', U'\x2502', U'\x2190', U'\x2191',
+    U'\x2192', U'\x2193', U'\x25a0', U'\x25cb', U'\x10428', U'\x10429', U'\x1042a', U'\x1042b',
+    U'\x1042c', U'\x1042d', U'\x1042e', U'\x1042f', U'\x10430', U'\x10431', U'\x10432', U'\x10433',
+    U'\x10434', U'\x10435', U'\x10436', U'\x10437', U'\x10438', U'\x10439', U'\x1043a', U'\x1043b',
+    U'\x1043c', U'\x1043d', U'\x1043e', U'\x1043f', U'\x10440', U'\x10441', U'\x10442', U'\x10443',
+    U'\x10444', U'\x10445', U'\x10446', U'\x10447', U'\x10448', U'\x10449', U'\x1044a', U'\x1044b',
+    U'\x1044c', U'\x1044d', U'\x1044e', U'\x1044f', U'\x104d8', U'\x104d9', U'\x104da', U'\x104db',
+    U'\x104dc', U'\x104dd', U'\x104de', U'\x104df', U'\x104e0', U'\x104e1', U'\x104e2', U'\x104e3',
+    U'\x104e4', U'\x104e5', U'\x104e6', U'\x104e7', U'\x104e8', U'\x104e9', U'\x104ea', U'\x104eb',
+    U'\x104ec', U'\x104ed', U'\x104ee', U'\x104ef', U'\x104f0', U'\x104f1', U'\x104f2', U'\x104f3',
+    U'\x104f4', U'\x104f5', U'\x104f6', U'\x104f7', U'\x104f8', U'\x104f9', U'\x104fa', U'\x104fb',
+    U'\x10597', U'\x10598', U'\x10599', U'\x1059a', U'\x1059b', U'\x1059c', U'\x1059d', U'\x1059e',
+    U'\x1059f', U'\x105a0', U'\x105a1', U'\x105a3', U'\x105a4', U'\x105a5', U'\x105a6', U'\x105a7',
+    U'\x105a8', U'\x105a9', U'\x105aa', U'\x105ab', U'\x105ac', U'\x105ad', U'\x105ae', U'\x105af',
+    U'\x105b0', U'\x105b1', U'\x105b3', U'\x105b4', U'\x105b5', U'\x105b6', U'\x105b7', U'\x105b8',
+    U'\x105b9', U'\x105bb', U'\x105bc', U'\x02d0', U'\x02d1', U'\x0299', U'\x02a3', U'\xab66',
+    U'\x02a5', U'\x02a4', U'\x1d91', U'\x0258', U'\x025e', U'\x02a9', U'\x0264', U'\x0262',
+    U'\x029b', U'\x029c', U'\x0267', U'\x0284', U'\x02aa', U'\x02ab', U'\x1df04', U'\xa78e',
+    U'\x026e', U'\x1df05', U'\x028e', U'\x1df06', U'\x0276', U'\x0277', U'\x027a', U'\x1df08',
+    U'\x027e', U'\x02a8', U'\x02a6', U'\xab67', U'\x02a7', U'\x2c71', U'\x028f', U'\x02a1',
+    U'\x02a2', U'\x0298', U'\x01c0', U'\x01c1', U'\x01c2', U'\x1df0a', U'\x1df1e', U'\x10cc0',
+    U'\x10cc1', U'\x10cc2', U'\x10cc3', U'\x10cc4', U'\x10cc5', U'\x10cc6', U'\x10cc7', U'\x10cc8',
+    U'\x10cc9', U'\x10cca', U'\x10ccb', U'\x10ccc', U'\x10ccd', U'\x10cce', U'\x10ccf', U'\x10cd0',
+    U'\x10cd1', U'\x10cd2', U'\x10cd3', U'\x10cd4', U'\x10cd5', U'\x10cd6', U'\x10cd7', U'\x10cd8',
+    U'\x10cd9', U'\x10cda', U'\x10cdb', U'\x10cdc', U'\x10cdd', U'\x10cde', U'\x10cdf', U'\x10ce0',
+    U'\x10ce1', U'\x10ce2', U'\x10ce3', U'\x10ce4', U'\x10ce5', U'\x10ce6', U'\x10ce7', U'\x10ce8',
+    U'\x10ce9', U'\x10cea', U'\x10ceb', U'\x10cec', U'\x10ced', U'\x10cee', U'\x10cef', U'\x10cf0',
+    U'\x10cf1', U'\x10cf2', U'\x118c0', U'\x118c1', U'\x118c2', U'\x118c3', U'\x118c4', U'\x118c5',
+    U'\x118c6', U'\x118c7', U'\x118c8', U'\x118c9', U'\x118ca', U'\x118cb', U'\x118cc', U'\x118cd',
+    U'\x118ce', U'\x118cf', U'\x118d0', U'\x118d1', U'\x118d2', U'\x118d3', U'\x118d4', U'\x118d5',
+    U'\x118d6', U'\x118d7', U'\x118d8', U'\x118d9', U'\x118da', U'\x118db', U'\x118dc', U'\x118dd',
+    U'\x118de', U'\x118df', U'\x16e60', U'\x16e61', U'\x16e62', U'\x16e63', U'\x16e64', U'\x16e65',
+    U'\x16e66', U'\x16e67', U'\x16e68', U'\x16e69', U'\x16e6a', U'\x16e6b', U'\x16e6c', U'\x16e6d',
+    U'\x16e6e', U'\x16e6f', U'\x16e70', U'\x16e71', U'\x16e72', U'\x16e73', U'\x16e74', U'\x16e75',
+    U'\x16e76', U'\x16e77', U'\x16e78', U'\x16e79', U'\x16e7a', U'\x16e7b', U'\x16e7c', U'\x16e7d',
+    U'\x16e7e', U'\x16e7f', U'\x0131', U'\x0237', U'\x2207', U'\x2202', U'\x04cf', U'\x1e922',
+    U'\x1e923', U'\x1e924', U'\x1e925', U'\x1e926', U'\x1e927', U'\x1e928', U'\x1e929', U'\x1e92a',
+    U'\x1e92b', U'\x1e92c', U'\x1e92d', U'\x1e92e', U'\x1e92f', U'\x1e930', U'\x1e931', U'\x1e932',
+    U'\x1e933', U'\x1e934', U'\x1e935', U'\x1e936', U'\x1e937', U'\x1e938', U'\x1e939', U'\x1e93a',
+    U'\x1e93b', U'\x1e93c', U'\x1e93d', U'\x1e93e', U'\x1e93f', U'\x1e940', U'\x1e941', U'\x1e942',
+    U'\x1e943', U'\x066e', U'\x06a1', U'\x066f', U'\x5b57', U'\x53cc', U'\x591a', U'\x89e3',
+    U'\x4ea4', U'\x6620', U'\x7121', U'\x524d', U'\x5f8c', U'\x518d', U'\x65b0', U'\x521d',
+    U'\x7d42', U'\x8ca9', U'\x58f0', U'\x5439', U'\x6f14', U'\x6295', U'\x6355', U'\x904a',
+    U'\x6307', U'\x7981', U'\x7a7a', U'\x5408', U'\x6e80', U'\x7533', U'\x5272', U'\x55b6',
+    U'\x914d', U'\x5f97', U'\x53ef', U'\x4e3d', U'\x4e38', U'\x4e41', U'\x20122', U'\x4f60',
+    U'\x4fbb', U'\x5002', U'\x507a', U'\x5099', U'\x50cf', U'\x349e', U'\x2063a', U'\x5154',
+    U'\x5164', U'\x5177', U'\x2051c', U'\x34b9', U'\x5167', U'\x2054b', U'\x5197', U'\x51a4',
+    U'\x4ecc', U'\x51ac', U'\x291df', U'\x5203', U'\x34df', U'\x523b', U'\x5246', U'\x5277',
+    U'\x3515', U'\x5305', U'\x5306', U'\x5349', U'\x535a', U'\x5373', U'\x537d', U'\x537f',
+    U'\x20a2c', U'\x7070', U'\x53ca', U'\x53df', U'\x20b63', U'\x53eb', U'\x53f1', U'\x5406',
+    U'\x549e', U'\x5438', U'\x5448', U'\x5468', U'\x54a2', U'\x54f6', U'\x5510', U'\x5553',
+    U'\x5563', U'\x5584', U'\x55ab', U'\x55b3', U'\x55c2', U'\x5716', U'\x5717', U'\x5651',
+    U'\x5674', U'\x58ee', U'\x57ce', U'\x57f4', U'\x580d', U'\x578b', U'\x5832', U'\x5831',
+    U'\x58ac', U'\x214e4', U'\x58f2', U'\x58f7', U'\x5906', U'\x5922', U'\x5962', U'\x216a8',
+    U'\x216ea', U'\x59ec', U'\x5a1b', U'\x5a27', U'\x59d8', U'\x5a66', U'\x36ee', U'\x5b08',
+    U'\x5b3e', U'\x219c8', U'\x5bc3', U'\x5bd8', U'\x5bf3', U'\x21b18', U'\x5bff', U'\x5c06',
+    U'\x3781', U'\x5c60', U'\x5cc0', U'\x5c8d', U'\x21de4', U'\x5d43', U'\x21de6', U'\x5d6e',
+    U'\x5d6b', U'\x5d7c', U'\x5de1', U'\x5de2', U'\x382f', U'\x5dfd', U'\x5e28', U'\x5e3d',
+    U'\x5e69', U'\x3862', U'\x22183', U'\x387c', U'\x5eb0', U'\x5eb3', U'\x5eb6', U'\x2a392',
+    U'\x22331', U'\x8201', U'\x5f22', U'\x38c7', U'\x232b8', U'\x261da', U'\x5f62', U'\x5f6b',
+    U'\x38e3', U'\x5f9a', U'\x5fcd', U'\x5fd7', U'\x5ff9', U'\x6081', U'\x393a', U'\x391c',
+    U'\x226d4', U'\x60c7', U'\x6148', U'\x614c', U'\x617a', U'\x61b2', U'\x61a4', U'\x61af',
+    U'\x61de', U'\x621b', U'\x625d', U'\x62b1', U'\x62d4', U'\x6350', U'\x22b0c', U'\x633d',
+    U'\x62fc', U'\x6368', U'\x6383', U'\x63e4', U'\x22bf1', U'\x6422', U'\x63c5', U'\x63a9',
+    U'\x3a2e', U'\x6469', U'\x647e', U'\x649d', U'\x6477', U'\x3a6c', U'\x656c', U'\x2300a',
+    U'\x65e3', U'\x66f8', U'\x6649', U'\x3b19', U'\x3b08', U'\x3ae4', U'\x5192', U'\x5195',
+    U'\x6700', U'\x669c', U'\x80ad', U'\x43d9', U'\x6721', U'\x675e', U'\x6753', U'\x233c3',
+    U'\x3b49', U'\x67fa', U'\x6785', U'\x6852', U'\x2346d', U'\x688e', U'\x681f', U'\x6914',
+    U'\x6942', U'\x69a3', U'\x69ea', U'\x6aa8', U'\x236a3', U'\x6adb', U'\x3c18', U'\x6b21',
+    U'\x238a7', U'\x6b54', U'\x3c4e', U'\x6b72', U'\x6b9f', U'\x6bbb', U'\x23a8d', U'\x21d0b',
+    U'\x23afa', U'\x6c4e', U'\x23cbc', U'\x6cbf', U'\x6ccd', U'\x6c67', U'\x6d16', U'\x6d3e',
+    U'\x6d69', U'\x6d78', U'\x6d85', U'\x23d1e', U'\x6d34', U'\x6e2f', U'\x6e6e', U'\x3d33',
+    U'\x6ec7', U'\x23ed1', U'\x6df9', U'\x6f6e', U'\x23f5e', U'\x23f8e', U'\x6fc6', U'\x7039',
+    U'\x701b', U'\x3d96', U'\x704a', U'\x707d', U'\x7077', U'\x70ad', U'\x20525', U'\x7145',
+    U'\x24263', U'\x719c', U'\x7228', U'\x7250', U'\x24608', U'\x7280', U'\x7295', U'\x24735',
+    U'\x24814', U'\x737a', U'\x738b', U'\x3eac', U'\x73a5', U'\x3eb8', U'\x7447', U'\x745c',
+    U'\x7485', U'\x74ca', U'\x3f1b', U'\x7524', U'\x24c36', U'\x753e', U'\x24c92', U'\x2219f',
+    U'\x7610', U'\x24fa1', U'\x24fb8', U'\x25044', U'\x3ffc', U'\x4008', U'\x250f3', U'\x250f2',
+    U'\x25119', U'\x25133', U'\x771e', U'\x771f', U'\x778b', U'\x4046', U'\x4096', U'\x2541d',
+    U'\x784e', U'\x40e3', U'\x25626', U'\x2569a', U'\x256c5', U'\x79eb', U'\x412f', U'\x7a4a',
+    U'\x7a4f', U'\x2597c', U'\x25aa7', U'\x4202', U'\x25bab', U'\x7bc6', U'\x7bc9', U'\x4227',
+    U'\x25c80', U'\x7cd2', U'\x42a0', U'\x7ce8', U'\x7ce3', U'\x7d00', U'\x25f86', U'\x7d63',
+    U'\x4301', U'\x7dc7', U'\x7e02', U'\x7e45', U'\x4334', U'\x26228', U'\x26247', U'\x4359',
+    U'\x262d9', U'\x7f7a', U'\x2633e', U'\x7f95', U'\x7ffa', U'\x264da', U'\x26523', U'\x8060',
+    U'\x265a8', U'\x8070', U'\x2335f', U'\x43d5', U'\x80b2', U'\x8103', U'\x440b', U'\x813e',
+    U'\x5ab5', U'\x267a7', U'\x267b5', U'\x23393', U'\x2339c', U'\x8204', U'\x8f9e', U'\x446b',
+    U'\x8291', U'\x828b', U'\x829d', U'\x52b3', U'\x82b1', U'\x82b3', U'\x82bd', U'\x82e6',
+    U'\x26b3c', U'\x831d', U'\x8363', U'\x83ad', U'\x8323', U'\x83bd', U'\x83e7', U'\x8353',
+    U'\x83ca', U'\x83cc', U'\x83dc', U'\x26c36', U'\x26d6b', U'\x26cd5', U'\x452b', U'\x84f1',
+    U'\x84f3', U'\x8516', U'\x273ca', U'\x8564', U'\x26f2c', U'\x455d', U'\x4561', U'\x26fb1',
+    U'\x270d2', U'\x456b', U'\x8650', U'\x8667', U'\x8669', U'\x86a9', U'\x8688', U'\x870e',
+    U'\x86e2', U'\x8728', U'\x876b', U'\x8786', U'\x87e1', U'\x8801', U'\x45f9', U'\x8860',
+    U'\x27667', U'\x88d7', U'\x88de', U'\x4635', U'\x88fa', U'\x34bb', U'\x278ae', U'\x27966',
+    U'\x46be', U'\x46c7', U'\x8aa0', U'\x27ca8', U'\x8cab', U'\x8cc1', U'\x8d1b', U'\x8d77',
+    U'\x27f2f', U'\x20804', U'\x8dcb', U'\x8dbc', U'\x8df0', U'\x208de', U'\x8ed4', U'\x285d2',
+    U'\x285ed', U'\x9094', U'\x90f1', U'\x9111', U'\x2872e', U'\x911b', U'\x9238', U'\x92d7',
+    U'\x92d8', U'\x927c', U'\x93f9', U'\x9415', U'\x28bfa', U'\x958b', U'\x4995', U'\x95b7',
+    U'\x28d77', U'\x49e6', U'\x96c3', U'\x5db2', U'\x9723', U'\x29145', U'\x2921a', U'\x4a6e',
+    U'\x4a76', U'\x97e0', U'\x2940a', U'\x4ab2', U'\x29496', U'\x9829', U'\x295b6', U'\x98e2',
+    U'\x4b33', U'\x9929', U'\x99a7', U'\x99c2', U'\x99fe', U'\x4bce', U'\x29b30', U'\x9c40',
+    U'\x9cfd', U'\x4cce', U'\x4ced', U'\x9d67', U'\x2a0ce', U'\x4cf8', U'\x2a105', U'\x2a20e',
+    U'\x2a291', U'\x4d56', U'\x9efe', U'\x9f05', U'\x9f0f', U'\x9f16', U'\x2a600',
 }};
 }  // namespace skyr::idna::details
 
@@ -6,10 +6,25 @@
 #ifndef SKYR_FILESYSTEM_PATH_HPP
 #define SKYR_FILESYSTEM_PATH_HPP
 
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <expected>
 #include <filesystem>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include <skyr/core/host.hpp>
+#include <skyr/core/url_parser_context.hpp>
+#include <skyr/core/url_record.hpp>
+#include <skyr/percent_encoding/encode_set.hpp>
 #include <skyr/percent_encoding/percent_decode.hpp>
+#include <skyr/percent_encoding/percent_encode.hpp>
 #include <skyr/url.hpp>
 
 namespace skyr {
@@ -25,32 +40,228 @@ enum class path_errc {
   percent_decoding_error,
 };
 
+namespace details {
+/// The bytes that are percent encoded in file path segments. `%` is
+/// encoded, because file names aren't already percent encoded
+inline constexpr auto file_path_set = percent_encoding::encode_sets::path | percent_encoding::byte_set::of("%");
+
+/// Builds the record of a file URL from an absolute generic path without
+/// parsing it. The path can be a POSIX path, such as `/usr/bin/clang`, a
+/// path with a drive letter, such as `C:/Windows`, or a UNC path, such as
+/// `//server/share`, whose server is the URL's host. As in a file URL, `\`
+/// is a separator as well as `/`
+///
+/// \param path A generic path
+/// \returns A URL record, an error if the path isn't valid UTF-8 or the
+///          server isn't a valid host, or an empty optional if the path is
+///          relative
+inline auto make_file_url_record(std::string_view path)
+    -> std::optional<std::expected<url_record, url_parse_errc>> {
+  constexpr auto is_separator = [](char byte) { return (byte == '/') || (byte == '\\'); };
+  constexpr auto is_drive_letter = [](std::string_view segment) {
+    return (segment.size() == 2) && ::skyr::details::is_windows_drive_letter(segment);
+  };
+  auto next_separator = [&path, is_separator]() {
+    return static_cast<std::size_t>(std::ranges::find_if(path, is_separator) - path.begin());
+  };
+
+  auto is_unc = (path.size() > 2) && is_separator(path[0]) && is_separator(path[1]) && !is_separator(path[2]);
+  if (!is_unc && (path.empty() || !is_separator(path.front())) && !is_drive_letter(path.substr(0, next_separator()))) {
+    return std::nullopt;
+  }
+
+  auto validator = percent_encoding::details::utf8_validator{};
+  if (!std::ranges::all_of(path, [&validator](char byte) { return validator.next(static_cast<std::uint8_t>(byte)); }) ||
+      !validator.complete()) {
+    return std::expected<url_record, url_parse_errc>(std::unexpected(url_parse_errc::invalid_unicode_character));
+  }
+
+  auto record = url_record{};
+  record.scheme = "file";
+  record.host = host(empty_host{});
+
+  if (is_unc) {
+    path.remove_prefix(2);
+    auto server = path.substr(0, next_separator());
+    if (!is_drive_letter(server)) {
+      auto server_host = parse_host(server);
+      if (!server_host) {
+        return std::expected<url_record, url_parse_errc>(std::unexpected(server_host.error()));
+      }
+      if (server_host.value().serialize() != "localhost") {
+        record.host = std::move(server_host.value());
+      }
+      path.remove_prefix(server.size());
+    }
+  }
+  if (!path.empty() && is_separator(path.front())) {
+    path.remove_prefix(1);
+  }
+
+  while (true) {
+    auto length = next_separator();
+    auto segment = path.substr(0, length);
+    auto is_last = (length == path.size());
+
+    if (segment == "..") {
+      ::skyr::details::shorten_path(record.scheme, record.path);
+      if (is_last) {
+        record.path.emplace_back();
+      }
+    } else if (segment == ".") {
+      if (is_last) {
+        record.path.emplace_back();
+      }
+    } else if (record.path.empty() && is_drive_letter(segment)) {
+      /// A drive letter is normalized, and can't follow a server
+      record.host = host(empty_host{});
+      record.path.emplace_back(std::string{segment.front(), ':'});
+    } else {
+      auto& encoded = record.path.emplace_back();
+      encoded.reserve(percent_encoding::percent_encoded_size<file_path_set>(segment));
+      percent_encoding::percent_encode_append<file_path_set>(segment, &encoded);
+    }
+
+    if (is_last) {
+      break;
+    }
+    path.remove_prefix(length + 1);
+  }
+
+  /// As the parser does, leading empty segments are removed
+  while ((record.path.size() > 1) && record.path.front().empty()) {
+    record.path.erase(record.path.begin());
+  }
+  return record;
+}
+}  // namespace details
+
 /// Converts a path object to a URL with a file protocol. Handles
 /// some processing, including percent encoding
+///
+/// Absolute paths, such as `/usr/bin/clang`, `C:\Windows` or
+/// `\\server\share`, are converted directly: each component is percent
+/// encoded, including `%`, so that `to_path` gives the same path back, and
+/// the URL record is built without parsing. Relative paths are appended to
+/// `file://` and parsed.
+///
 /// \param path A filesystem path
 /// \returns a url object or an error on failure
 inline auto from_path(const std::filesystem::path& path) -> std::expected<url, url_parse_errc> {
   /// This is weird because not every library implementation has transitioned
   /// from changing the return type of generic_u8string to a std::u8string between C++17 and C++20
+  auto u8string = path.generic_u8string();  // Sometimes a std::string and
+                                            // sometimes a std::u8string (correct, for C++20)
+  auto generic = std::string_view(reinterpret_cast<const char*>(u8string.data()), u8string.size());  // NOLINT
+
+  if (auto record = details::make_file_url_record(generic); record) {
+    if (!record.value()) {
+      return std::unexpected(record.value().error());
+    }
+    return url(std::move(record.value().value()));
+  }
+
   using namespace std::string_view_literals;
   constexpr auto scheme = u8"file://"sv;
   auto input = std::u8string(scheme);
-  auto u8string = path.generic_u8string();  // Sometimes a std::string and
-                                            // sometimes a std::u8string (correct, for C++20)
   input.append(std::cbegin(u8string), std::cend(u8string));
   return make_url(input);
 }
 
+namespace details {
+/// Converts a random access range of paths to file URLs, in contiguous
+/// blocks, one per thread
+template <class Paths>
+inline auto convert_paths(const Paths& paths, unsigned int thread_count)
+    -> std::vector<std::expected<url, url_parse_errc>> {
+  auto size = static_cast<std::size_t>(std::ranges::size(paths));
+  auto results = std::vector<std::expected<url, url_parse_errc>>(size);
+  auto convert = [&paths, &results](std::size_t first, std::size_t last) {
+    for (auto i = first; i < last; ++i) {
+      results[i] = from_path(std::ranges::begin(paths)[static_cast<std::ptrdiff_t>(i)]);
+    }
+  };
+
+  if (thread_count == 0) {
+    thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  auto block_size = (size + thread_count - 1) / thread_count;
+  if (block_size <= 1) {
+    convert(0, size);
+    return results;
+  }
+
+  auto threads = std::vector<std::jthread>{};
+  for (auto first = block_size; first < size; first += block_size) {
+    threads.emplace_back(convert, first, std::min(first + block_size, size));
+  }
+  convert(0, std::min(block_size, size));
+  threads.clear();
+  return results;
+}
+}  // namespace details
+
+/// Converts the paths in a range, such as a `recursive_directory_iterator`,
+/// to file URLs, using several threads.
+///
+/// A range that isn't a random access range of paths, such as a directory
+/// iterator, is walked on the calling thread first, since directory
+/// iterators are single pass. The paths are then converted in parallel, in
+/// contiguous blocks, one per thread.
+///
+/// ```
+/// auto urls = skyr::filesystem::from_paths(std::filesystem::recursive_directory_iterator("/usr/share/doc"));
+/// ```
+///
+/// \param paths An input range of `std::filesystem::path` or
+///        `std::filesystem::directory_entry`
+/// \param thread_count The number of threads; if it's 0, the number of
+///        hardware threads is used
+/// \returns The URLs, or errors, in the order of the range
+template <class Paths>
+  requires std::ranges::input_range<Paths> &&
+           std::convertible_to<std::ranges::range_reference_t<Paths>, const std::filesystem::path&>
+inline auto from_paths(Paths&& paths, unsigned int thread_count = 0)
+    -> std::vector<std::expected<url, url_parse_errc>> {
+  if constexpr (std::ranges::random_access_range<Paths> && std::ranges::sized_range<Paths> &&
+                std::same_as<std::ranges::range_value_t<Paths>, std::filesystem::path>) {
+    return details::convert_paths(paths, thread_count);
+  } else {
+    auto inputs = std::vector<std::filesystem::path>{};
+    for (auto&& path : paths) {
+      inputs.emplace_back(static_cast<const std::filesystem::path&>(path));
+    }
+    return details::convert_paths(inputs, thread_count);
+  }
+}
+
 /// Converts a URL pathname to a filesystem path
+///
+/// The host of a file URL is kept as the server of a UNC path, and where
+/// paths have drive letters, the `/` before a drive letter is removed, so
+/// that `from_path` and `to_path` are inverses
+///
 /// \param input A url object
 /// \returns a path object or an error on failure
 inline auto to_path(const url& input) -> std::expected<std::filesystem::path, path_errc> {
   auto pathname = input.pathname();
-  auto decoded = ::skyr::percent_decode(pathname);
+  auto decoded = ::skyr::percent_decode_in_place(pathname);
   if (!decoded) {
     return std::unexpected(path_errc::percent_decoding_error);
   }
-  return std::filesystem::path(decoded.value());
+  pathname.resize(decoded.value());
+
+  const auto& record = input.record();
+  if ((record.scheme == "file") && record.host && !record.host.value().is_empty()) {
+    pathname.insert(0, "//" + record.host.value().serialize());
+  } else if constexpr (std::filesystem::path::preferred_separator == '\\') {
+    if ((pathname.size() >= 3) && (pathname.front() == '/') &&
+        ((pathname.size() == 3) || (pathname[3] == '/')) &&
+        ::skyr::details::is_windows_drive_letter(std::string_view(pathname).substr(1, 2))) {
+      pathname.erase(0, 1);
+    }
+  }
+  return std::filesystem::path(std::move(pathname));
 }
 }  // namespace filesystem
 }  // namespace skyr
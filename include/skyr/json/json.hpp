@@ -6,10 +6,19 @@
 #ifndef SKYR_JSON_JSON_HPP
 #define SKYR_JSON_JSON_HPP
 
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
 #include <expected>
 #include <format>
+#include <functional>
+#include <iterator>
+#include <numeric>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -17,6 +26,8 @@
 #include <skyr/core/parse_query.hpp>
 #include <skyr/percent_encoding/percent_decode.hpp>
 #include <skyr/percent_encoding/percent_encode.hpp>
+#include <skyr/url.hpp>
+#include <skyr/url_search_parameters.hpp>
 
 namespace skyr {
 namespace json {
@@ -26,57 +37,260 @@ enum class json_errc {
   invalid_query = 1,
 };
 
-inline auto encode_query(const nlohmann::json& json, char separator = '&', char equal = '=')
-    -> std::expected<std::string, json_errc> {
-  using namespace std::string_literals;
+namespace details {
+/// Calls `leaf(key, value)` for each scalar in a JSON value, where `key` is
+/// the percent encoded key, using bracket notation for nested objects
+/// (`a[b]`), and `value` is the scalar as a string, not yet encoded.
+/// Elements of arrays of scalars share the array's key; other elements are
+/// keyed by their index (`a[0][b]`)
+///
+/// \param json The JSON value
+/// \param key The key of the value; it is restored before returning
+/// \param leaf The function to call for each scalar
+template <class Leaf>
+void for_each_scalar(const nlohmann::json& json, std::string* key, Leaf& leaf) {
+  namespace encode_sets = percent_encoding::encode_sets;
 
-  std::string result{};
+  auto nest = [key, &leaf](std::string_view name, const nlohmann::json& value) {
+    auto size = key->size();
+    if (size == 0) {
+      percent_encoding::percent_encode_append<encode_sets::component>(name, key);
+    } else {
+      key->push_back('[');
+      percent_encoding::percent_encode_append<encode_sets::component>(name, key);
+      key->push_back(']');
+    }
+    for_each_scalar(value, key, leaf);
+    key->resize(size);
+  };
+
+  switch (json.type()) {
+    case nlohmann::json::value_t::object:
+      for (const auto& [name, value] : json.items()) {
+        nest(name, value);
+      }
+      break;
+    case nlohmann::json::value_t::array: {
+      auto buffer = std::array<char, 24>{};
+      for (auto i = std::size_t{0}; i < json.size(); ++i) {
+        if (json[i].is_structured()) {
+          auto last = std::to_chars(buffer.data(), buffer.data() + buffer.size(), i).ptr;
+          nest(std::string_view(buffer.data(), last), json[i]);
+        } else {
+          for_each_scalar(json[i], key, leaf);
+        }
+      }
+      break;
+    }
+    case nlohmann::json::value_t::string:
+      leaf(std::string_view(*key), std::string_view(json.get_ref<const nlohmann::json::string_t&>()));
+      break;
+    case nlohmann::json::value_t::boolean:
+      leaf(std::string_view(*key), json.get<bool>() ? std::string_view("true") : std::string_view("false"));
+      break;
+    case nlohmann::json::value_t::number_integer:
+    case nlohmann::json::value_t::number_unsigned: {
+      auto buffer = std::array<char, 24>{};
+      auto last = json.is_number_unsigned()
+                      ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), json.get<std::uint64_t>()).ptr
+                      : std::to_chars(buffer.data(), buffer.data() + buffer.size(), json.get<std::int64_t>()).ptr;
+      leaf(std::string_view(*key), std::string_view(buffer.data(), last));
+      break;
+    }
+    case nlohmann::json::value_t::number_float:
+      leaf(std::string_view(*key), std::string_view(json.dump()));
+      break;
+    default:
+      leaf(std::string_view(*key), std::string_view{});
+      break;
+  }
+}
+}  // namespace details
+
+/// Encodes a JSON object as a query string, and writes it to an output
+/// iterator.
+///
+/// String values are percent encoded, and other scalars are written as
+/// JSON text; `null` is an empty value. Nested objects use bracket notation
+/// (`a[b]=c`). The elements of an array of scalars repeat its key
+/// (`a=1&a=2`), and other elements are keyed by their index (`a[0][b]=c`).
+///
+/// \param json A JSON object
+/// \param out An output iterator of `char`
+/// \param separator The separator between parameters
+/// \param equal The separator between a name and its value
+/// \returns The output iterator, past the bytes written, or an error if
+///          `json` isn't an object
+template <std::output_iterator<char> OutputIterator>
+auto encode_query(const nlohmann::json& json, OutputIterator out, char separator = '&', char equal = '=')
+    -> std::expected<OutputIterator, json_errc> {
+  namespace encode_sets = percent_encoding::encode_sets;
 
   if (!json.is_object()) {
     return std::unexpected(json_errc::invalid_query);
   }
 
-  for (auto& [key, value] : json.items()) {
-    if (value.is_string()) {
-      result +=
-          std::format("{}{}{}{}", percent_encode(key), equal, percent_encode(value.get<std::string>()), separator);
-    } else if (value.is_array()) {
-      for (auto& element : value.items()) {
-        result += std::format("{}{}{}{}", percent_encode(key), equal,
-                              percent_encode(element.value().get<std::string>()), separator);
-      }
-    } else {
-      result += std::format("{}{}{}", percent_encode(key), equal, separator);
+  auto first = true;
+  auto write = [&](std::string_view key, std::string_view value) {
+    if (!first) {
+      *out++ = separator;
     }
+    first = false;
+    out = std::ranges::copy(key, std::move(out)).out;
+    *out++ = equal;
+    out = percent_encoding::percent_encode_copy<encode_sets::component>(value, std::move(out));
+  };
+
+  auto key = std::string{};
+  details::for_each_scalar(json, &key, write);
+  return out;
+}
+
+/// Encodes a JSON object as a query string, as the overload that writes to
+/// an output iterator does. The size of the query is computed first, so
+/// that it is written to a buffer of the right size.
+///
+/// \param json A JSON object
+/// \param separator The separator between parameters
+/// \param equal The separator between a name and its value
+/// \returns The query string, or an error if `json` isn't an object
+inline auto encode_query(const nlohmann::json& json, char separator = '&', char equal = '=')
+    -> std::expected<std::string, json_errc> {
+  namespace encode_sets = percent_encoding::encode_sets;
+
+  if (!json.is_object()) {
+    return std::unexpected(json_errc::invalid_query);
   }
 
-  return result.substr(0, result.size() - 1);
+  auto size = std::size_t{0};
+  auto count = [&size](std::string_view key, std::string_view value) {
+    auto separator_size = (size == 0) ? 0 : 1;
+    size += separator_size + key.size() + 1 + percent_encoding::percent_encoded_size<encode_sets::component>(value);
+  };
+  auto key = std::string{};
+  details::for_each_scalar(json, &key, count);
+
+  auto result = std::string(size, '\0');
+  auto last = encode_query(json, result.data(), separator, equal);
+  result.resize(static_cast<std::size_t>(last.value() - result.data()));
+  return result;
 }
 
-inline auto decode_query(std::string_view query) -> nlohmann::json {
-  nlohmann::json object;
-
-  auto parameters = parse_query(query);
-  if (parameters) {
-    for (auto&& [name, value] : parameters.value()) {
-      const auto name_ = ::skyr::percent_decode(name).value();
-      const auto value_ = value ? ::skyr::percent_decode(value.value()).value() : std::string();
-
-      if (object.contains(name_)) {
-        auto current_value = object[name_];
-        if (current_value.is_string()) {
-          auto prev_value = current_value.get<std::string>();
-          object[name_] = std::vector<std::string>{prev_value, value_};
-        } else if (current_value.is_array()) {
-          auto values = current_value.get<std::vector<std::string>>();
-          values.emplace_back(value_);
-          object[name_] = values;
-        }
-      } else {
-        object[name_] = value_;
+namespace details {
+/// Parses and percent decodes a query, then calls `emit(name, positions)`
+/// for each parameter name, in the order of the names, with the positions
+/// of the parameters that have it, in the order they appear
+template <class Emit>
+auto for_each_name(const url_search_parameters& parameters, Emit&& emit) -> bool {
+  auto positions = std::vector<std::uint32_t>(parameters.size());
+  std::iota(std::begin(positions), std::end(positions), std::uint32_t{0});
+
+  auto first = parameters.begin();
+  auto name = [first](std::uint32_t position) { return first[position].name; };
+  std::ranges::stable_sort(positions, std::less<std::string_view>{}, name);
+
+  for (auto it = std::cbegin(positions); it != std::cend(positions);) {
+    auto last = std::find_if(it, std::cend(positions), [&](auto position) { return name(position) != name(*it); });
+    if (!emit(name(*it), std::span(it, last))) {
+      return false;
+    }
+    it = last;
+  }
+  return true;
+}
+}  // namespace details
+
+/// Decodes a query string as a series of SAX events, without building a
+/// JSON value. The events are those `decode_query` would produce: an object
+/// with a key for each parameter name, in order, whose value is a string, or
+/// an array of strings if the name is repeated, or `null` if the query has
+/// no parameters.
+///
+/// \tparam Sax A type with the member functions of `nlohmann::json_sax`
+///         that are called: `null`, `start_object`, `key`, `string`,
+///         `start_array`, `end_array` and `end_object`
+/// \param query The query string
+/// \param sax The event handler
+/// \returns `false` if the handler returned `false`, `true` otherwise
+template <class Sax>
+auto decode_query_sax(std::string_view query, Sax* sax) -> bool {
+  const auto parameters = url_search_parameters(query);
+  auto first = parameters.begin();
+
+  if (parameters.empty()) {
+    return sax->null();
+  }
+
+  if (!sax->start_object(parameters.size())) {
+    return false;
+  }
+
+  auto buffer = std::string{};
+  auto string = [sax, &buffer](std::string_view value) {
+    buffer.assign(value);
+    return sax->string(buffer);
+  };
+
+  auto emit = [&](std::string_view name, std::span<const std::uint32_t> positions) {
+    buffer.assign(name);
+    if (!sax->key(buffer)) {
+      return false;
+    }
+
+    if (positions.size() == 1) {
+      return string(first[positions[0]].value.value_or(std::string_view{}));
+    }
+
+    if (!sax->start_array(positions.size())) {
+      return false;
+    }
+    for (auto position : positions) {
+      if (!string(first[position].value.value_or(std::string_view{}))) {
+        return false;
       }
     }
+    return sax->end_array();
+  };
+  return details::for_each_name(parameters, emit) && sax->end_object();
+}
+
+/// Decodes a query string as a JSON object, with a key for each parameter
+/// name whose value is a string, or an array of strings if the name is
+/// repeated. Names and values that can't be percent decoded are kept as
+/// they are.
+///
+/// The parameters are sorted by name once, so each key is inserted once, at
+/// the end of the object, and each array is built in place.
+///
+/// \param query The query string
+/// \returns A JSON object, or `null` if the query has no parameters
+inline auto decode_query(std::string_view query) -> nlohmann::json {
+  const auto parameters = url_search_parameters(query);
+  if (parameters.empty()) {
+    return nlohmann::json{};
   }
+
+  auto object = nlohmann::json::object();
+  auto& members = object.get_ref<nlohmann::json::object_t&>();
+  auto first = parameters.begin();
+  details::for_each_name(parameters, [&](std::string_view name, std::span<const std::uint32_t> positions) {
+    auto value = [first](std::uint32_t position) {
+      return nlohmann::json(std::string(first[position].value.value_or(std::string_view{})));
+    };
+
+    if (positions.size() == 1) {
+      members.emplace_hint(std::end(members), name, value(positions[0]));
+      return true;
+    }
+
+    auto array = nlohmann::json::array_t{};
+    array.reserve(positions.size());
+    for (auto position : positions) {
+      array.emplace_back(value(position));
+    }
+    members.emplace_hint(std::end(members), name, std::move(array));
+    return true;
+  });
   return object;
 }
 }  // namespace json
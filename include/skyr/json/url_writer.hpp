@@ -0,0 +1,241 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_JSON_URL_WRITER_HPP
+#define SKYR_JSON_URL_WRITER_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <skyr/core/query_view.hpp>
+#include <skyr/core/url_record.hpp>
+#include <skyr/percent_encoding/encode_set.hpp>
+#include <skyr/percent_encoding/percent_decode.hpp>
+#include <skyr/url.hpp>
+
+namespace skyr {
+namespace json {
+namespace details {
+/// The bytes that can't be copied to a JSON string as they are
+inline constexpr auto json_escaped = percent_encoding::byte_set::range(0x00, 0x1f) |
+                                     percent_encoding::byte_set::of("\"\\") |
+                                     percent_encoding::byte_set::range(0x80, 0xff);
+
+/// Appends a JSON string, with its quotes, escaping `"`, `\` and control
+/// characters. Invalid UTF-8 is replaced with U+FFFD, so the output is
+/// always valid JSON, even for percent decoded query parameters
+///
+/// \param input The string
+/// \param output The output string
+inline void append_json_string(std::string_view input, std::string* output) {
+  constexpr auto hex_digits = std::string_view("0123456789abcdef");
+  constexpr auto replacement = std::string_view("\xef\xbf\xbd");
+
+  output->push_back('"');
+  auto first = input.data(), last = input.data() + input.size();
+  while (first != last) {
+    auto run_last = std::find_if(first, last, [](char byte) { return json_escaped.contains(byte); });
+    output->append(first, run_last);
+    first = run_last;
+    if (first == last) {
+      break;
+    }
+
+    auto byte = static_cast<unsigned char>(*first);
+    if (byte >= 0x80) {
+      /// Copies a whole sequence if it's valid. A byte that ends a sequence
+      /// early is the start of the next one
+      auto validator = percent_encoding::details::utf8_validator{};
+      auto sequence_last = first;
+      while ((sequence_last != last) && validator.next(static_cast<std::uint8_t>(*sequence_last))) {
+        ++sequence_last;
+        if (validator.complete()) {
+          break;
+        }
+      }
+      if (validator.complete() && (sequence_last != first)) {
+        output->append(first, sequence_last);
+      } else {
+        output->append(replacement);
+        sequence_last = std::max(sequence_last, first + 1);
+      }
+      first = sequence_last;
+      continue;
+    }
+
+    output->push_back('\\');
+    switch (byte) {
+      case '"':
+      case '\\':
+        output->push_back(static_cast<char>(byte));
+        break;
+      case '\b':
+        output->push_back('b');
+        break;
+      case '\f':
+        output->push_back('f');
+        break;
+      case '\n':
+        output->push_back('n');
+        break;
+      case '\r':
+        output->push_back('r');
+        break;
+      case '\t':
+        output->push_back('t');
+        break;
+      default:
+        output->append("u00");
+        output->push_back(hex_digits[byte >> 4]);
+        output->push_back(hex_digits[byte & 0x0fu]);
+        break;
+    }
+    ++first;
+  }
+  output->push_back('"');
+}
+
+/// Appends an optional JSON string, or `null`
+inline void append_json_nullable(const std::optional<std::string>& input, std::string* output) {
+  if (input) {
+    append_json_string(input.value(), output);
+  } else {
+    output->append("null");
+  }
+}
+
+/// \returns The name of the kind of host
+inline auto host_type_name(const host& value) noexcept -> std::string_view {
+  if (value.is_domain_name()) {
+    return "domain";
+  } else if (value.is_ipv4_address()) {
+    return "ipv4";
+  } else if (value.is_ipv6_address()) {
+    return "ipv6";
+  } else if (value.is_opaque_host()) {
+    return "opaque";
+  }
+  return "empty";
+}
+}  // namespace details
+
+/// Appends the components of a URL record to `output` as a JSON object, on
+/// one line, without building a `nlohmann::json` value or any temporary
+/// strings. Nothing is written before or after the object, so it can be
+/// followed by a `\n` to write JSON lines, and one string can be reused as
+/// the buffer for many URLs.
+///
+/// ```
+/// {"scheme":"https","username":"","password":"","host_type":"domain",
+///  "host":"example.com","port":8080,"path":["a","b"],"query":"q=%C3%A9",
+///  "parameters":[["q","é"]],"fragment":null}
+/// ```
+///
+/// `host_type` is one of `"domain"`, `"ipv4"`, `"ipv6"`, `"opaque"` or
+/// `"empty"`, and is `null` with `host` if the URL has no host. `path` holds
+/// the path segments as they are in the record, and `query` the query
+/// without the `?`. `parameters` holds the query's name-value pairs, percent
+/// decoded as by `url_search_parameters`, where a parameter without an `=`
+/// has a `null` value.
+///
+/// \param url A URL record
+/// \param output The output string
+inline void write_json(const url_record& url, std::string* output) {
+  output->append(R"({"scheme":)");
+  details::append_json_string(url.scheme, output);
+  output->append(R"(,"username":)");
+  details::append_json_string(url.username, output);
+  output->append(R"(,"password":)");
+  details::append_json_string(url.password, output);
+
+  output->append(R"(,"host_type":)");
+  if (url.host) {
+    output->push_back('"');
+    output->append(details::host_type_name(url.host.value()));
+    output->append(R"(","host":)");
+
+    /// The host is serialized in place, and only copied in the rare case
+    /// that an opaque host needs escaping
+    auto offset = output->size();
+    output->push_back('"');
+    url.host.value().serialize_to(output);
+    auto is_escaped = [](char byte) { return details::json_escaped.contains(byte); };
+    if (std::any_of(output->begin() + static_cast<std::ptrdiff_t>(offset) + 1, output->end(), is_escaped)) {
+      auto serialized = output->substr(offset + 1);
+      output->resize(offset);
+      details::append_json_string(serialized, output);
+    } else {
+      output->push_back('"');
+    }
+  } else {
+    output->append(R"(null,"host":null)");
+  }
+
+  output->append(R"(,"port":)");
+  if (url.port) {
+    auto buffer = std::array<char, 5>{};
+    auto [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), url.port.value());
+    output->append(buffer.data(), last);
+  } else {
+    output->append("null");
+  }
+
+  output->append(R"(,"path":[)");
+  for (auto first = true; const auto& segment : url.path) {
+    if (!first) {
+      output->push_back(',');
+    }
+    first = false;
+    details::append_json_string(segment, output);
+  }
+
+  output->append(R"(],"query":)");
+  details::append_json_nullable(url.query, output);
+  output->append(R"(,"parameters":)");
+  if (url.query) {
+    output->push_back('[');
+    for (auto first = true; auto [name, value] : query_view(url.query.value()).decoded()) {
+      if (!first) {
+        output->push_back(',');
+      }
+      first = false;
+      output->push_back('[');
+      details::append_json_string(name, output);
+      output->push_back(',');
+      if (value) {
+        details::append_json_string(value.value(), output);
+      } else {
+        output->append("null");
+      }
+      output->push_back(']');
+    }
+    output->push_back(']');
+  } else {
+    output->append("null");
+  }
+
+  output->append(R"(,"fragment":)");
+  details::append_json_nullable(url.fragment, output);
+  output->push_back('}');
+}
+
+/// Appends the components of a URL to `output` as a JSON object
+///
+/// \param url A URL
+/// \param output The output string
+/// \sa write_json(const url_record&, std::string*)
+inline void write_json(const url& url, std::string* output) {
+  write_json(url.record(), output);
+}
+}  // namespace json
+}  // namespace skyr
+
+#endif  // SKYR_JSON_URL_WRITER_HPP
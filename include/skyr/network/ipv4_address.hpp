@@ -8,12 +8,11 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <climits>
 #include <cmath>
 #include <cstdint>
 #include <expected>
-#include <format>
-#include <locale>
 #include <optional>
 #include <ranges>
 #include <string>
@@ -21,6 +20,7 @@
 
 #include <skyr/containers/static_vector.hpp>
 #include <skyr/platform/endianness.hpp>
+#include <skyr/platform/swar.hpp>
 
 namespace skyr {
 /// Enumerates IPv4 address parsing errors
@@ -62,20 +62,37 @@ class ipv4_address {
              static_cast<unsigned char>(addr >> 8u), static_cast<unsigned char>(addr)}};
   }
 
-  /// \returns The address as a string
-  [[nodiscard]] auto serialize() const -> std::string {
-    using namespace std::string_literals;
-    using namespace std::string_view_literals;
-
-    constexpr auto separator = [](auto i) { return (i < 4) ? "."sv : ""sv; };
+  /// The maximum length of a serialized IPv4 address, e.g.
+  /// `255.255.255.255`
+  static constexpr auto max_serialized_size = std::size_t{15};
 
-    auto output = ""s;
+  /// Serializes the IPv4 address to a buffer, without allocating
+  /// \param out A buffer of at least `max_serialized_size` characters
+  /// \returns A pointer past the last character written
+  constexpr auto serialize_to(char* out) const noexcept -> char* {
     auto n = address();
-    for (auto i = 1U; i <= 4U; ++i) {
-      output = std::format("{}{}{}", separator(i), n % 256, output);
-      n >>= 8;
+    for (auto shift = 24U;; shift -= 8U) {
+      auto octet = (n >> shift) & 0xffU;
+      if (octet >= 100U) {
+        *out++ = static_cast<char>('0' + (octet / 100U));
+      }
+      if (octet >= 10U) {
+        *out++ = static_cast<char>('0' + ((octet / 10U) % 10U));
+      }
+      *out++ = static_cast<char>('0' + (octet % 10U));
+      if (shift == 0U) {
+        break;
+      }
+      *out++ = '.';
     }
-    return output;
+    return out;
+  }
+
+  /// \returns The address as a string
+  [[nodiscard]] auto serialize() const -> std::string {
+    auto buffer = std::array<char, max_serialized_size>{};
+    auto last = serialize_to(buffer.data());
+    return std::string(buffer.data(), last);
   }
 };
 
@@ -89,7 +106,7 @@ constexpr inline auto parse_ipv4_number(std::string_view input, bool* validation
     -> std::expected<std::uint64_t, ipv4_address_errc> {
   auto base = 10;
 
-  if ((input.size() >= 2) && (input[0] == '0') && (std::tolower(input[1], std::locale::classic()) == 'x')) {
+  if ((input.size() >= 2) && (input[0] == '0') && ((input[1] == 'x') || (input[1] == 'X'))) {
     *validation_error |= true;
     input = input.substr(2);
     base = 16;
@@ -110,6 +127,77 @@ constexpr inline auto parse_ipv4_number(std::string_view input, bool* validation
   }
   return number;
 }
+
+/// Parses the common form of an IPv4 address, four decimal numbers from 0
+/// to 255 without leading zeros (e.g. "192.168.0.1"). The input is
+/// classified 8 bytes at a time, giving a mask of the digits and one of the
+/// dots, and the dot positions are used to convert each number.
+///
+/// \returns The address, or `std::nullopt` if the input isn't in this form,
+///          in which case it needs the full IPv4 parser
+constexpr inline auto parse_dotted_decimal(std::string_view input) noexcept -> std::optional<std::uint32_t> {
+  constexpr auto min_size = std::string_view("0.0.0.0").size();
+  constexpr auto max_size = std::string_view("255.255.255.255").size();
+  if ((input.size() < min_size) || (input.size() > max_size)) {
+    return std::nullopt;
+  }
+
+  /// The input is classified as two words, the first 8 bytes and the last 8
+  /// bytes, which overlap unless the input is 16 bytes long
+  auto size = static_cast<int>(input.size());
+  auto high_offset = std::max(size - 8, 0);
+  auto low = swar::load(input.substr(0, 8)), high = swar::load(input.substr(high_offset));
+  if (((low | high) & swar::high_bits) != 0) {
+    return std::nullopt;
+  }
+
+  constexpr auto dots = swar::ones * '.';
+  auto digit_mask = swar::to_bitmask(swar::digit_bytes(low)) |
+                    (swar::to_bitmask(swar::digit_bytes(high)) << high_offset);
+  auto dot_mask = swar::to_bitmask(swar::zero_bytes(low ^ dots)) |
+                  (swar::to_bitmask(swar::zero_bytes(high ^ dots)) << high_offset);
+
+  /// Every byte must be a digit or a dot, and there must be three dots,
+  /// neither first, last nor next to each other
+  auto input_mask = (std::uint32_t{1} << size) - 1;
+  auto last_bit = std::uint32_t{1} << (size - 1);
+  auto second_dots = dot_mask & (dot_mask - 1);
+  auto third_dot = second_dots & (second_dots - 1);
+  if (((digit_mask | dot_mask) != input_mask) || (third_dot == 0) || ((third_dot & (third_dot - 1)) != 0) ||
+      ((dot_mask & (1 | last_bit)) != 0) || ((dot_mask & (dot_mask >> 1)) != 0)) {
+    return std::nullopt;
+  }
+
+  /// Each number is converted from the 3 bytes that end with it, as a word
+  /// of hundreds, tens and units. The bytes before the start of the number
+  /// are masked out, so there is no branch on its length
+  auto invalid = false;
+  auto to_number = [input, &invalid](int first, int last) -> std::uint32_t {
+    auto length = last - first;
+    auto position = std::max(last - 3, 0);
+    auto word = static_cast<std::uint32_t>(static_cast<unsigned char>(input[position])) |
+                (static_cast<std::uint32_t>(static_cast<unsigned char>(input[position + 1])) << 8) |
+                (static_cast<std::uint32_t>(static_cast<unsigned char>(input[position + 2])) << 16);
+    word <<= 8 * (position - (last - 3));
+
+    auto mask = (std::uint32_t{0xffffff} << (8 * std::max(3 - length, 0))) & std::uint32_t{0xffffff};
+    auto digits = (word & mask) - (std::uint32_t{0x303030} & mask);
+    auto number = (digits & 0xff) * 100 + ((digits >> 8) & 0xff) * 10 + (digits >> 16);
+    invalid |= (length > 3) | ((length > 1) & (input[first] == '0')) | (number > 255);
+    return number;
+  };
+
+  auto first_end = std::countr_zero(dot_mask);
+  auto second_end = std::countr_zero(second_dots);
+  auto third_end = std::countr_zero(third_dot);
+  auto address = (to_number(0, first_end) << 24) | (to_number(first_end + 1, second_end) << 16) |
+                 (to_number(second_end + 1, third_end) << 8) | to_number(third_end + 1, size);
+
+  if (invalid) {
+    return std::nullopt;
+  }
+  return address;
+}
 }  // namespace details
 
 /// Parses an IPv4 address
@@ -119,6 +207,10 @@ constexpr inline auto parse_ipv4_address(std::string_view input, bool* validatio
     -> std::expected<ipv4_address, ipv4_address_errc> {
   using namespace std::string_view_literals;
 
+  if (auto address = details::parse_dotted_decimal(input)) {
+    return ipv4_address(address.value());
+  }
+
   constexpr auto to_string_view = [](auto&& part) {
     return std::string_view(std::addressof(*std::begin(part)), std::ranges::distance(part));
   };
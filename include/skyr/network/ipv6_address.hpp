@@ -8,16 +8,14 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <expected>
-#include <format>
 #include <iterator>
-#include <locale>
 #include <optional>
 #include <string>
 #include <string_view>
 
-#include <skyr/containers/static_vector.hpp>
 #include <skyr/platform/endianness.hpp>
 
 namespace skyr {
@@ -64,10 +62,15 @@ class ipv6_address {
     return bytes;
   }
 
-  /// \returns The IPv6 address as a string
-  [[nodiscard]] auto serialize() const -> std::string {
-    using namespace std::string_literals;
-    using namespace std::string_view_literals;
+  /// The maximum length of a serialized IPv6 address, e.g.
+  /// `ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff`
+  static constexpr auto max_serialized_size = std::size_t{39};
+
+  /// Serializes the IPv6 address to a buffer, without allocating
+  /// \param out A buffer of at least `max_serialized_size` characters
+  /// \returns A pointer past the last character written
+  constexpr auto serialize_to(char* out) const noexcept -> char* {
+    constexpr auto hex_digits = std::string_view("0123456789abcdef");
 
     // Convert address to host byte order for processing
     auto address = std::array<unsigned short, 8>{};
@@ -75,84 +78,84 @@ class ipv6_address {
       address[i] = from_network_byte_order(address_[i]);  // NOLINT
     }
 
-    auto output = ""s;
-    auto compress = std::optional<std::size_t>();
-
-    auto sequences = static_vector<std::pair<std::size_t, std::size_t>, 8>{};
-    auto in_sequence = false;
-
-    auto first = std::cbegin(address), last = std::cend(address);
-    auto it = first;
-    while (true) {
-      if (*it == 0) {
-        auto index = std::ranges::distance(first, it);
-
-        if (!in_sequence) {
-          sequences.emplace_back(index, 1);
-          in_sequence = true;
-        } else {
-          ++sequences.back().second;
-        }
-      } else {
-        if (in_sequence) {
-          if (sequences.back().second == 1) {
-            sequences.pop_back();
-          }
-          in_sequence = false;
-        }
+    // Find the first longest sequence of at least two zero pieces
+    auto compress = address.size();
+    auto compress_length = 1UL;
+    for (auto i = 0UL; i < address.size();) {
+      if (address[i] != 0) {  // NOLINT
+        ++i;
+        continue;
       }
-      ++it;
 
-      if (it == last) {
-        if (!sequences.empty() && (sequences.back().second == 1)) {
-          sequences.pop_back();
-        }
-        in_sequence = false;
-        break;
+      auto j = i + 1;
+      while ((j < address.size()) && (address[j] == 0)) {  // NOLINT
+        ++j;
       }
-    }
-
-    if (!sequences.empty()) {
-      constexpr static auto greater = [](const auto& lhs, const auto& rhs) -> bool { return lhs.second > rhs.second; };
 
-      std::ranges::stable_sort(sequences, greater);
-      compress = sequences.front().first;
+      if ((j - i) > compress_length) {
+        compress = i;
+        compress_length = j - i;
+      }
+      i = j;
     }
 
-    auto ignore0 = false;
-    for (auto i = 0UL; i <= 7UL; ++i) {
-      if (ignore0 && (address[i] == 0)) {  // NOLINT
+    for (auto i = 0UL; i < address.size(); ++i) {
+      if (i == compress) {
+        if (i == 0) {
+          *out++ = ':';
+        }
+        *out++ = ':';
+        i += compress_length - 1;
         continue;
-      } else if (ignore0) {
-        ignore0 = false;
       }
 
-      if (compress && (compress.value() == i)) {
-        auto separator = (i == 0) ? "::"sv : ":"sv;
-        output += separator;
-        ignore0 = true;
-        continue;
+      auto piece = static_cast<unsigned int>(address[i]);  // NOLINT
+      auto shift = static_cast<unsigned int>(std::bit_width(piece | 1u) + 3) / 4 * 4;
+      while (shift > 0) {
+        shift -= 4;
+        *out++ = hex_digits[(piece >> shift) & 0xfu];
       }
 
-      constexpr auto separator = [](auto i) { return (i != 7) ? ":"sv : ""sv; };
-
-      output += std::format("{:x}{}", address[i], separator(i));  // NOLINT
+      if (i != 7) {
+        *out++ = ':';
+      }
     }
 
-    return output;
+    return out;
+  }
+
+  /// \returns The IPv6 address as a string
+  [[nodiscard]] auto serialize() const -> std::string {
+    auto buffer = std::array<char, max_serialized_size>{};
+    auto last = serialize_to(buffer.data());
+    return std::string(buffer.data(), last);
   }
 };
 
 namespace details {
-template <class intT, class charT>
-constexpr inline auto hex_to_dec(charT byte) noexcept {
-  assert(std::isxdigit(byte, std::locale::classic()));
-
-  if (std::isdigit(byte, std::locale::classic())) {
-    return static_cast<intT>(byte - '0');
+/// Maps each byte to its value as a hexadecimal digit, or to 0xff if it is
+/// not a hexadecimal digit
+inline constexpr auto hex_digit_values = [] {
+  auto values = std::array<std::uint8_t, 256>{};
+  values.fill(0xff);
+  for (auto c = 0; c < 10; ++c) {
+    values['0' + c] = static_cast<std::uint8_t>(c);
   }
+  for (auto c = 0; c < 6; ++c) {
+    values['a' + c] = static_cast<std::uint8_t>(10 + c);
+    values['A' + c] = static_cast<std::uint8_t>(10 + c);
+  }
+  return values;
+}();
 
-  return static_cast<intT>(std::tolower(byte, std::locale::classic()) - 'a' + 10);
+/// \returns The value of a hexadecimal digit, or 0xff if `byte` is not a
+///          hexadecimal digit
+constexpr inline auto hex_digit_value(char byte) noexcept -> std::uint8_t {
+  return hex_digit_values[static_cast<unsigned char>(byte)];
+}
+
+constexpr inline auto is_decimal_digit(char byte) noexcept -> bool {
+  return (byte >= '0') && (byte <= '9');
 }
 }  // namespace details
 
@@ -200,8 +203,12 @@ constexpr inline auto parse_ipv6_address(std::string_view input, bool* validatio
     auto value = 0;
     auto length = 0;
 
-    while ((it != last) && ((length < 4) && std::isxdigit(*it, std::locale::classic()))) {
-      value = value * 0x10 + details::hex_to_dec<decltype(value)>(*it);
+    while ((it != last) && (length < 4)) {
+      auto digit = details::hex_digit_value(*it);
+      if (digit > 0xf) {
+        break;
+      }
+      value = value * 0x10 + digit;
       ++it;
       ++length;
     }
@@ -233,12 +240,12 @@ constexpr inline auto parse_ipv6_address(std::string_view input, bool* validatio
           }
         }
 
-        if ((it == last) || !std::isdigit(*it, std::locale::classic())) {
+        if ((it == last) || !details::is_decimal_digit(*it)) {
           *validation_error |= true;
           return std::unexpected(ipv6_address_errc::invalid_ipv4_segment_number);
         }
 
-        while ((it != last) && std::isdigit(*it, std::locale::classic())) {
+        while ((it != last) && details::is_decimal_digit(*it)) {
           auto number = *it - '0';
           if (!ipv4_piece) {
             ipv4_piece = number;
@@ -0,0 +1,245 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_NETWORK_PREFIX_SET_HPP
+#define SKYR_NETWORK_PREFIX_SET_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <expected>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <skyr/network/ipv4_address.hpp>
+#include <skyr/network/ipv6_address.hpp>
+
+/// \namespace skyr::network
+/// Contains algorithms that operate on network addresses
+namespace skyr::network {
+/// \enum prefix_set_errc
+/// Enumerates CIDR prefix parsing errors
+enum class prefix_set_errc {
+  /// The address is not a valid IPv4 or IPv6 address
+  invalid_address = 1,
+  /// The prefix length is not a number, or is too long for the address
+  invalid_prefix_length,
+};
+
+namespace details {
+/// A 128-bit IPv6 address, in host byte order
+struct uint128 {
+  std::uint64_t high;
+  std::uint64_t low;
+
+  constexpr auto operator<=>(const uint128&) const = default;
+};
+
+constexpr auto to_uint128(const std::array<unsigned char, 16>& bytes) noexcept -> uint128 {
+  auto value = uint128{0, 0};
+  for (auto i = 0UL; i < 8UL; ++i) {
+    value.high = (value.high << 8) | bytes[i];    // NOLINT
+    value.low = (value.low << 8) | bytes[i + 8];  // NOLINT
+  }
+  return value;
+}
+
+/// \returns The IPv4 address of an IPv4-mapped IPv6 address
+/// (`::ffff:a.b.c.d`), or `std::nullopt`
+constexpr auto mapped_ipv4_address(uint128 address) noexcept -> std::optional<std::uint32_t> {
+  if ((address.high != 0) || ((address.low >> 32) != 0xffff)) {
+    return std::nullopt;
+  }
+  return static_cast<std::uint32_t>(address.low);
+}
+
+/// \returns A mask of the `length` most significant bits
+template <class intT>
+constexpr auto prefix_mask(unsigned int length) noexcept -> intT {
+  constexpr auto bits = static_cast<unsigned int>(std::numeric_limits<intT>::digits);
+  return (length == 0) ? intT{0} : static_cast<intT>(~intT{0} << (bits - std::min(length, bits)));
+}
+
+/// \returns The first and last addresses of an IPv4 prefix
+constexpr auto prefix_range(std::uint32_t address, unsigned int length) noexcept
+    -> std::pair<std::uint32_t, std::uint32_t> {
+  auto mask = prefix_mask<std::uint32_t>(length);
+  return {address & mask, address | ~mask};
+}
+
+/// \returns The first and last addresses of an IPv6 prefix
+constexpr auto prefix_range(uint128 address, unsigned int length) noexcept -> std::pair<uint128, uint128> {
+  auto high_mask = prefix_mask<std::uint64_t>(length);
+  auto low_mask = prefix_mask<std::uint64_t>((length > 64) ? (length - 64) : 0);
+  return {{address.high & high_mask, address.low & low_mask}, {address.high | ~high_mask, address.low | ~low_mask}};
+}
+
+constexpr auto is_last_address(std::uint32_t value) noexcept -> bool {
+  return value == std::numeric_limits<std::uint32_t>::max();
+}
+
+constexpr auto is_last_address(uint128 value) noexcept -> bool {
+  return (value.high == std::numeric_limits<std::uint64_t>::max()) &&
+         (value.low == std::numeric_limits<std::uint64_t>::max());
+}
+
+constexpr auto next_address(std::uint32_t value) noexcept -> std::uint32_t {
+  return value + 1;
+}
+
+constexpr auto next_address(uint128 value) noexcept -> uint128 {
+  return (value.low == std::numeric_limits<std::uint64_t>::max()) ? uint128{value.high + 1, 0}
+                                                                   : uint128{value.high, value.low + 1};
+}
+
+/// Sorts address ranges and merges those that overlap or are adjacent, so
+/// that lookups only need to find the last range that starts at or before
+/// an address
+template <class intT>
+auto merge_ranges(std::vector<std::pair<intT, intT>>* ranges) -> void {
+  std::ranges::sort(*ranges);
+
+  auto merged = std::vector<std::pair<intT, intT>>{};
+  merged.reserve(ranges->size());
+  for (const auto& range : *ranges) {
+    if (!merged.empty() &&
+        (is_last_address(merged.back().second) || (range.first <= next_address(merged.back().second)))) {
+      merged.back().second = std::max(merged.back().second, range.second);
+    } else {
+      merged.push_back(range);
+    }
+  }
+  merged.shrink_to_fit();
+  ranges->swap(merged);
+}
+
+template <class intT>
+constexpr auto contains(const std::vector<std::pair<intT, intT>>& ranges, intT address) noexcept -> bool {
+  constexpr auto first = [](const auto& range) { return range.first; };
+
+  auto it = std::ranges::upper_bound(ranges, address, std::less<>{}, first);
+  return (it != std::cbegin(ranges)) && (address <= std::prev(it)->second);
+}
+}  // namespace details
+
+/// An immutable set of IPv4 and IPv6 address prefixes, used to test whether
+/// a host address is in an allowlist or a blocklist.
+///
+/// The prefixes are stored as sorted, disjoint address ranges, so a lookup
+/// is a binary search, however many prefixes the set was built from. A set
+/// has no mutating member functions, so once built it can be shared between
+/// threads without synchronization.
+///
+/// An IPv4-mapped IPv6 address (`::ffff:a.b.c.d`) reaches the same host as
+/// its IPv4 address, so it matches the IPv4 prefixes as well as the IPv6
+/// prefixes. Otherwise `http://[::ffff:127.0.0.1]/` would get past a
+/// blocklist that contains `127.0.0.0/8`.
+class prefix_set {
+ public:
+  /// Constructs an empty set
+  prefix_set() = default;
+
+  /// Builds a set from prefixes in CIDR notation, e.g. `10.0.0.0/8` or
+  /// `2001:db8::/32`. An address without a prefix length matches only that
+  /// address, and bits below the prefix length are ignored. IPv4 addresses
+  /// must be four decimal numbers, so that forms the URL parser also
+  /// accepts, such as `0x7f.1`, can't be mistaken for another prefix.
+  /// \param cidrs A range of strings
+  /// \returns The prefix set, or an error if a prefix can't be parsed
+  template <std::ranges::input_range Range>
+  requires std::convertible_to<std::ranges::range_reference_t<Range>, std::string_view>
+  static auto parse(Range&& cidrs) -> std::expected<prefix_set, prefix_set_errc> {
+    auto set = prefix_set{};
+    for (auto&& cidr : cidrs) {
+      if (auto result = set.insert(std::string_view(cidr)); !result) {
+        return std::unexpected(result.error());
+      }
+    }
+    details::merge_ranges(&set.ipv4_ranges_);
+    details::merge_ranges(&set.ipv6_ranges_);
+    return set;
+  }
+
+  /// Builds a set from prefixes in CIDR notation
+  /// \param cidrs A list of strings
+  /// \returns The prefix set, or an error if a prefix can't be parsed
+  static auto parse(std::initializer_list<std::string_view> cidrs) -> std::expected<prefix_set, prefix_set_errc> {
+    return parse(std::views::all(cidrs));
+  }
+
+  /// \param address An IPv4 address
+  /// \returns `true` if the address is in one of the IPv4 prefixes
+  [[nodiscard]] auto contains(const ipv4_address& address) const noexcept -> bool {
+    return details::contains(ipv4_ranges_, static_cast<std::uint32_t>(address.address()));
+  }
+
+  /// \param address An IPv6 address
+  /// \returns `true` if the address is in one of the IPv6 prefixes, or is
+  ///          an IPv4-mapped address in one of the IPv4 prefixes
+  [[nodiscard]] auto contains(const ipv6_address& address) const noexcept -> bool {
+    auto value = details::to_uint128(address.to_bytes());
+    if (auto mapped = details::mapped_ipv4_address(value); mapped && details::contains(ipv4_ranges_, mapped.value())) {
+      return true;
+    }
+    return details::contains(ipv6_ranges_, value);
+  }
+
+  /// \returns `true` if the set contains no prefixes
+  [[nodiscard]] auto empty() const noexcept -> bool {
+    return ipv4_ranges_.empty() && ipv6_ranges_.empty();
+  }
+
+ private:
+  auto insert(std::string_view cidr) -> std::expected<void, prefix_set_errc> {
+    auto slash = cidr.find('/');
+    auto address = cidr.substr(0, slash);
+    if (address.empty()) {
+      return std::unexpected(prefix_set_errc::invalid_address);
+    }
+
+    auto is_ipv6 = (address.find(':') != std::string_view::npos);
+    auto length = is_ipv6 ? 128U : 32U;
+    if (slash != std::string_view::npos) {
+      auto digits = cidr.substr(slash + 1);
+      auto value = 0U;
+      auto [last, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), value);
+      if (digits.empty() || (ec != std::errc{}) || (last != digits.data() + digits.size()) || (value > length)) {
+        return std::unexpected(prefix_set_errc::invalid_prefix_length);
+      }
+      length = value;
+    }
+
+    if (is_ipv6) {
+      auto validation_error = false;
+      auto parsed = parse_ipv6_address(address, &validation_error);
+      if (!parsed || validation_error) {
+        return std::unexpected(prefix_set_errc::invalid_address);
+      }
+      ipv6_ranges_.push_back(details::prefix_range(details::to_uint128(parsed.value().to_bytes()), length));
+    } else {
+      auto parsed = ::skyr::details::parse_dotted_decimal(address);
+      if (!parsed) {
+        return std::unexpected(prefix_set_errc::invalid_address);
+      }
+      ipv4_ranges_.push_back(details::prefix_range(parsed.value(), length));
+    }
+    return {};
+  }
+
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> ipv4_ranges_;
+  std::vector<std::pair<details::uint128, details::uint128>> ipv6_ranges_;
+};
+}  // namespace skyr::network
+
+#endif  // SKYR_NETWORK_PREFIX_SET_HPP
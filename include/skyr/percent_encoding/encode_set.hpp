@@ -0,0 +1,167 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_PERCENT_ENCODING_ENCODE_SET_HPP
+#define SKYR_PERCENT_ENCODING_ENCODE_SET_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace skyr {
+namespace percent_encoding {
+/// A set of bytes, stored as a 256-bit bitmap. Sets are built and combined
+/// at compile time, and are used to define which bytes are percent
+/// encoded, e.g.
+///
+/// \code
+/// constexpr auto unreserved = byte_set::range('a', 'z') | byte_set::range('A', 'Z') |
+///                             byte_set::range('0', '9') | byte_set::of("-._~");
+/// constexpr auto rfc3986 = ~unreserved;
+/// \endcode
+///
+/// A `byte_set` can be used as a template argument, so that encoding
+/// functions are specialized for each set.
+struct byte_set {
+  /// One bit for each byte value; bit `n % 64` of word `n / 64` is set if
+  /// byte `n` is in the set
+  std::array<std::uint64_t, 4> bits = {};
+
+  /// \param bytes The bytes in the set
+  /// \returns A set containing each byte in `bytes`
+  static constexpr auto of(std::string_view bytes) noexcept -> byte_set {
+    auto set = byte_set{};
+    for (auto byte : bytes) {
+      auto value = static_cast<unsigned char>(byte);
+      set.bits[value >> 6] |= std::uint64_t{1} << (value & 0x3fu);  // NOLINT
+    }
+    return set;
+  }
+
+  /// \param first The first byte in the set
+  /// \param last The last byte in the set
+  /// \returns A set containing the bytes from `first` to `last`, inclusive
+  static constexpr auto range(unsigned char first, unsigned char last) noexcept -> byte_set {
+    auto set = byte_set{};
+    for (auto value = static_cast<unsigned int>(first); value <= last; ++value) {
+      set.bits[value >> 6] |= std::uint64_t{1} << (value & 0x3fu);  // NOLINT
+    }
+    return set;
+  }
+
+  /// \param byte A byte value
+  /// \returns `true` if `byte` is in the set
+  [[nodiscard]] constexpr auto contains(unsigned char byte) const noexcept -> bool {
+    return ((bits[byte >> 6] >> (byte & 0x3fu)) & 1u) != 0;  // NOLINT
+  }
+
+  /// \param byte A byte value
+  /// \returns `true` if `byte` is in the set
+  [[nodiscard]] constexpr auto contains(char byte) const noexcept -> bool {
+    return contains(static_cast<unsigned char>(byte));
+  }
+
+  /// \param byte A byte value
+  /// \returns `true` if `byte` is in the set
+  [[nodiscard]] constexpr auto contains(std::byte byte) const noexcept -> bool {
+    return contains(std::to_integer<unsigned char>(byte));
+  }
+
+  /// Allows a set to be used as a predicate
+  /// \param byte A byte value
+  /// \returns `true` if `byte` is in the set
+  constexpr auto operator()(std::byte byte) const noexcept -> bool {
+    return contains(byte);
+  }
+
+  /// \returns The union of two sets
+  constexpr auto operator|(const byte_set& other) const noexcept -> byte_set {
+    return {{bits[0] | other.bits[0], bits[1] | other.bits[1], bits[2] | other.bits[2], bits[3] | other.bits[3]}};
+  }
+
+  /// \returns The intersection of two sets
+  constexpr auto operator&(const byte_set& other) const noexcept -> byte_set {
+    return {{bits[0] & other.bits[0], bits[1] & other.bits[1], bits[2] & other.bits[2], bits[3] & other.bits[3]}};
+  }
+
+  /// \returns The bytes that are not in the set
+  constexpr auto operator~() const noexcept -> byte_set {
+    return {{~bits[0], ~bits[1], ~bits[2], ~bits[3]}};
+  }
+
+  constexpr auto operator==(const byte_set&) const noexcept -> bool = default;
+};
+
+/// \namespace encode_sets
+/// The [percent-encode sets](https://url.spec.whatwg.org/#percent-encoded-bytes)
+/// defined by the WhatWG URL specification, and some other commonly used sets
+namespace encode_sets {
+/// Every byte
+inline constexpr auto any = ~byte_set{};
+
+/// The C0 control percent-encode set
+inline constexpr auto c0_control = byte_set::range(0x00, 0x1f) | byte_set::range(0x7f, 0xff);
+
+/// The fragment percent-encode set
+inline constexpr auto fragment = c0_control | byte_set::of(" \"<>`");
+
+/// The query percent-encode set
+inline constexpr auto query = c0_control | byte_set::of(" \"#<>");
+
+/// The special-query percent-encode set
+inline constexpr auto special_query = query | byte_set::of("'");
+
+/// The path percent-encode set
+inline constexpr auto path = query | byte_set::of("?^`{}");
+
+/// The userinfo percent-encode set
+inline constexpr auto userinfo = path | byte_set::of("/:;=@[\\]^|");
+
+/// The component percent-encode set
+inline constexpr auto component = userinfo | byte_set::of("$%&+,");
+
+/// The application/x-www-form-urlencoded percent-encode set
+inline constexpr auto application_x_www_form_urlencoded = component | byte_set::of("!'()~");
+
+/// Every byte except the unreserved characters of
+/// [RFC 3986](https://www.rfc-editor.org/rfc/rfc3986#section-2.3)
+inline constexpr auto rfc3986 =
+    ~(byte_set::range('a', 'z') | byte_set::range('A', 'Z') | byte_set::range('0', '9') | byte_set::of("-._~"));
+}  // namespace encode_sets
+
+///
+enum class encode_set {
+  ///
+  any = 0,
+  ///
+  c0_control,
+  ///
+  fragment,
+  ///
+  query,
+  ///
+  special_query,
+  ///
+  path,
+  ///
+  userinfo,
+  ///
+  component,
+};
+
+/// \param encodes An encode set
+/// \returns The bytes in the encode set
+constexpr inline auto to_byte_set(encode_set encodes) noexcept -> byte_set {
+  constexpr auto sets = std::array<byte_set, 8>{
+      encode_sets::any,           encode_sets::c0_control, encode_sets::fragment, encode_sets::query,
+      encode_sets::special_query, encode_sets::path,       encode_sets::userinfo, encode_sets::component,
+  };
+  return sets[static_cast<std::size_t>(encodes)];
+}
+}  // namespace percent_encoding
+}  // namespace skyr
+
+#endif  // SKYR_PERCENT_ENCODING_ENCODE_SET_HPP
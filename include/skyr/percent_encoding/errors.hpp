@@ -14,6 +14,8 @@ enum class percent_encode_errc {
   non_hex_input,
   /// Overflow
   overflow,
+  /// The decoded output is not valid UTF-8
+  invalid_utf8,
 };
 }  // namespace percent_encoding
 }  // namespace skyr
@@ -6,26 +6,191 @@
 #ifndef SKYR_PERCENT_DECODING_PERCENT_DECODE_HPP
 #define SKYR_PERCENT_DECODING_PERCENT_DECODE_HPP
 
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <expected>
+#include <span>
+#include <string>
 #include <string_view>
 
 #include <skyr/percent_encoding/errors.hpp>
 #include <skyr/percent_encoding/percent_decode_range.hpp>
+#include <skyr/platform/swar.hpp>
 
 namespace skyr {
+namespace percent_encoding {
+namespace details {
+/// \returns The value of a hexadecimal digit, or a value greater than 0xf
+///          if `byte` is not a hexadecimal digit
+constexpr inline auto hex_value(char byte) noexcept -> unsigned int {
+  auto value = static_cast<unsigned char>(byte);
+  auto digit = static_cast<unsigned int>(value - '0');
+  auto letter = static_cast<unsigned int>((value | 0x20u) - 'a');
+  return (digit < 10) ? digit : ((letter < 6) ? (letter + 10) : 0x10);
+}
+
+/// Validates UTF-8 one byte at a time, so that it can be run on the output
+/// of the decoder as it is written:
+///
+/// https://encoding.spec.whatwg.org/#utf-8-decoder
+///
+class utf8_validator {
+ public:
+  /// \param byte The next byte in the sequence
+  /// \returns `false` if the byte makes the sequence invalid
+  constexpr auto next(std::uint8_t byte) noexcept -> bool {
+    if (remaining_ == 0) {
+      if (byte < 0x80) {
+        return true;
+      } else if ((byte >= 0xc2) && (byte <= 0xdf)) {
+        remaining_ = 1;
+      } else if ((byte >= 0xe0) && (byte <= 0xef)) {
+        remaining_ = 2;
+        lower_ = (byte == 0xe0) ? 0xa0 : 0x80;
+        upper_ = (byte == 0xed) ? 0x9f : 0xbf;
+      } else if ((byte >= 0xf0) && (byte <= 0xf4)) {
+        remaining_ = 3;
+        lower_ = (byte == 0xf0) ? 0x90 : 0x80;
+        upper_ = (byte == 0xf4) ? 0x8f : 0xbf;
+      } else {
+        return false;
+      }
+      return true;
+    }
+
+    if ((byte < lower_) || (byte > upper_)) {
+      return false;
+    }
+    lower_ = 0x80;
+    upper_ = 0xbf;
+    --remaining_;
+    return true;
+  }
+
+  /// \returns `true` if the sequence doesn't end part way through a code point
+  [[nodiscard]] constexpr auto complete() const noexcept -> bool {
+    return remaining_ == 0;
+  }
+
+ private:
+  std::uint8_t remaining_ = 0;
+  std::uint8_t lower_ = 0x80;
+  std::uint8_t upper_ = 0xbf;
+};
+
+/// Percent decodes `input` to `out`, which must have space for
+/// `input.size()` bytes. The output is never longer than the input, so `out`
+/// may point to the start of the input to decode in place.
+///
+/// The input is scanned 8 bytes at a time for the next `%`, and the run of
+/// bytes before it is copied in one go. If `validate_utf8` is `true`, the
+/// output is validated as it is written; runs of ASCII bytes, which can't
+/// change the validity of the output, are skipped.
+///
+/// \returns A pointer past the last byte written, or an error
+inline auto decode(std::string_view input, char* out, bool validate_utf8)
+    -> std::expected<char*, percent_encode_errc> {
+  namespace swar = ::skyr::details::swar;
+
+  constexpr auto percent_signs = swar::ones * '%';
+
+  auto first = input.data(), last = input.data() + input.size();
+  auto validator = utf8_validator{};
+
+  while (first != last) {
+    /// Find the run of bytes before the next `%`, and whether any of them
+    /// isn't ASCII
+    auto run_last = first;
+    auto non_ascii = std::uint64_t{0};
+    while ((last - run_last) >= 8) {
+      auto word = swar::load(std::string_view(run_last, 8));
+      auto percent_mask = swar::zero_bytes(word ^ percent_signs);
+      if (percent_mask != 0) {
+        auto length = std::countr_zero(percent_mask) / 8;
+        non_ascii |= word & swar::high_bits & ((std::uint64_t{1} << (length * 8)) - 1);
+        run_last += length;
+        break;
+      }
+      non_ascii |= word & swar::high_bits;
+      run_last += 8;
+    }
+    if ((last - run_last) < 8) {
+      while ((run_last != last) && (*run_last != '%')) {
+        non_ascii |= static_cast<unsigned char>(*run_last) & 0x80u;
+        ++run_last;
+      }
+    }
+
+    auto length = static_cast<std::size_t>(run_last - first);
+    if (validate_utf8 && ((non_ascii != 0) || !validator.complete())) {
+      for (auto it = first; it != run_last; ++it) {
+        if (!validator.next(static_cast<std::uint8_t>(*it))) {
+          return std::unexpected(percent_encode_errc::invalid_utf8);
+        }
+      }
+    }
+    if (out != first) {
+      std::memmove(out, first, length);
+    }
+    out += length;
+    first = run_last;
+
+    /// Decode consecutive percent encoded bytes
+    while ((first != last) && (*first == '%')) {
+      if ((last - first) < 3) {
+        return std::unexpected(percent_encode_errc::overflow);
+      }
+
+      auto high = hex_value(first[1]), low = hex_value(first[2]);
+      if ((high | low) > 0xf) {
+        return std::unexpected(percent_encode_errc::non_hex_input);
+      }
+
+      auto byte = static_cast<std::uint8_t>((high << 4) | low);
+      if (validate_utf8 && !validator.next(byte)) {
+        return std::unexpected(percent_encode_errc::invalid_utf8);
+      }
+      *out++ = static_cast<char>(byte);
+      first += 3;
+    }
+  }
+
+  if (validate_utf8 && !validator.complete()) {
+    return std::unexpected(percent_encode_errc::invalid_utf8);
+  }
+  return out;
+}
+}  // namespace details
+}  // namespace percent_encoding
+
 /// Percent decodes the input
+/// \param input The input string
+/// \param validate_utf8 If `true`, the output must be valid UTF-8
 /// \returns The percent decoded output when successful, an error otherwise.
-inline auto percent_decode(std::string_view input)
+inline auto percent_decode(std::string_view input, bool validate_utf8 = false)
     -> std::expected<std::string, percent_encoding::percent_encode_errc> {
-  auto result = std::string{};
-  for (auto&& value : percent_encoding::percent_decode_range{input}) {
-    if (!value) {
-      return std::unexpected((value).error());
-    }
-    result.push_back((value).value());
+  auto result = std::string(input.size(), '\0');
+  auto last = percent_encoding::details::decode(input, result.data(), validate_utf8);
+  if (!last) {
+    return std::unexpected(last.error());
   }
+  result.resize(static_cast<std::size_t>(last.value() - result.data()));
   return result;
 }
+
+/// Percent decodes a buffer in place. If decoding fails, the contents of
+/// the buffer are unspecified.
+/// \param buffer The buffer to decode
+/// \param validate_utf8 If `true`, the output must be valid UTF-8
+/// \returns The size of the decoded output at the start of the buffer when
+///          successful, an error otherwise.
+inline auto percent_decode_in_place(std::span<char> buffer, bool validate_utf8 = false)
+    -> std::expected<std::size_t, percent_encoding::percent_encode_errc> {
+  return percent_encoding::details::decode(std::string_view(buffer.data(), buffer.size()), buffer.data(),
+                                           validate_utf8)
+      .transform([&buffer](char* last) { return static_cast<std::size_t>(last - buffer.data()); });
+}
 }  // namespace skyr
 
 #endif  // SKYR_PERCENT_DECODING_PERCENT_DECODE_HPP
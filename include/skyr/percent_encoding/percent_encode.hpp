@@ -6,31 +6,131 @@
 #ifndef SKYR_PERCENT_ENCODING_PERCENT_ENCODE_HPP
 #define SKYR_PERCENT_ENCODING_PERCENT_ENCODE_HPP
 
-#include <ranges>
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <string_view>
 
+#include <skyr/percent_encoding/encode_set.hpp>
 #include <skyr/percent_encoding/percent_encoded_char.hpp>
 
 namespace skyr {
+namespace percent_encoding {
+/// Percent encodes the bytes of the input that are in `Set`, and appends
+/// the result to `output`.
+///
+/// Bytes before the first one that needs encoding are appended in one go.
+/// After that, each byte is written as if it were encoded, and the output
+/// only advances past the hex digits if it is, so the loop doesn't branch on
+/// the set.
+///
+/// \tparam Set The bytes to encode
+/// \param input The input string
+/// \param output The output string
+template <byte_set Set>
+inline auto percent_encode_append(std::string_view input, std::string* output) -> void {
+  constexpr auto hex_digits = std::string_view("0123456789ABCDEF");
+
+  auto first = std::ranges::find_if(input, [](char byte) { return Set.contains(byte); });
+  auto prefix_size = static_cast<std::size_t>(first - std::cbegin(input));
+  output->append(input.substr(0, prefix_size));
+  if (prefix_size == input.size()) {
+    return;
+  }
+
+  auto remainder = input.substr(prefix_size);
+  auto offset = output->size();
+  output->resize(offset + remainder.size() * 3);  // Worst case: each byte becomes "%XX"
+
+  auto out = output->data() + offset;
+  for (auto byte : remainder) {
+    auto value = static_cast<unsigned char>(byte);
+    auto encode = Set.contains(value);
+    out[0] = encode ? '%' : byte;
+    out[1] = hex_digits[value >> 4];
+    out[2] = hex_digits[value & 0x0fu];
+    out += encode ? 3 : 1;
+  }
+  output->resize(static_cast<std::size_t>(out - output->data()));
+}
+
+/// Percent encodes the bytes of the input that are in `Set`, and writes the
+/// result to an output iterator. Runs of bytes that don't need encoding are
+/// copied in one go.
+///
+/// \tparam Set The bytes to encode
+/// \param input The input string
+/// \param out An output iterator of `char`
+/// \returns The output iterator, past the bytes written
+template <byte_set Set, std::output_iterator<char> OutputIterator>
+inline auto percent_encode_copy(std::string_view input, OutputIterator out) -> OutputIterator {
+  constexpr auto hex_digits = std::string_view("0123456789ABCDEF");
+
+  auto first = std::cbegin(input), last = std::cend(input);
+  while (first != last) {
+    auto run_last = std::find_if(first, last, [](char byte) { return Set.contains(byte); });
+    out = std::ranges::copy(first, run_last, std::move(out)).out;
+    for (first = run_last; (first != last) && Set.contains(*first); ++first) {
+      auto value = static_cast<unsigned char>(*first);
+      *out++ = '%';
+      *out++ = hex_digits[value >> 4];
+      *out++ = hex_digits[value & 0x0fu];
+    }
+  }
+  return out;
+}
+
+/// \tparam Set The bytes to encode
+/// \param input The input string
+/// \returns The size of the input once the bytes in `Set` are percent
+///          encoded
+template <byte_set Set>
+constexpr auto percent_encoded_size(std::string_view input) noexcept -> std::size_t {
+  return input.size() + 2 * static_cast<std::size_t>(std::ranges::count_if(input, [](char byte) {
+           return Set.contains(byte);
+         }));
+}
+}  // namespace percent_encoding
+
+/// Percent encodes the bytes of the input that are in `Set`
+/// \tparam Set The bytes to encode
+/// \param input The input string
+/// \returns The percent encoded output
+template <percent_encoding::byte_set Set>
+inline auto percent_encode_bytes(std::string_view input) -> std::string {
+  auto result = std::string{};
+  percent_encoding::percent_encode_append<Set>(input, &result);
+  return result;
+}
+
 /// Percent encodes the input
 /// \returns The percent encoded output when successful, an error otherwise.
 inline auto percent_encode_bytes(std::string_view input, percent_encoding::encode_set encodes) -> std::string {
-  auto encode = [encodes](auto byte) {
-    using percent_encoding::percent_encode_byte;
-    return percent_encode_byte(std::byte(byte), encodes);
-  };
+  namespace encode_sets = percent_encoding::encode_sets;
 
-  auto result = std::string{};
-  result.reserve(input.size() * 3);  // Worst case: each byte becomes "%XX"
-  for (const auto& encoded : input | std::ranges::views::transform(encode)) {
-    result.append(encoded.begin(), encoded.end());
+  switch (encodes) {
+    case percent_encoding::encode_set::any:
+      return percent_encode_bytes<encode_sets::any>(input);
+    case percent_encoding::encode_set::c0_control:
+      return percent_encode_bytes<encode_sets::c0_control>(input);
+    case percent_encoding::encode_set::fragment:
+      return percent_encode_bytes<encode_sets::fragment>(input);
+    case percent_encoding::encode_set::query:
+      return percent_encode_bytes<encode_sets::query>(input);
+    case percent_encoding::encode_set::special_query:
+      return percent_encode_bytes<encode_sets::special_query>(input);
+    case percent_encoding::encode_set::path:
+      return percent_encode_bytes<encode_sets::path>(input);
+    case percent_encoding::encode_set::userinfo:
+      return percent_encode_bytes<encode_sets::userinfo>(input);
+    case percent_encoding::encode_set::component:
+      return percent_encode_bytes<encode_sets::component>(input);
   }
-  return result;
+  return percent_encode_bytes<encode_sets::any>(input);
 }
 
 inline auto percent_encode(std::string_view input) -> std::string {
-  return percent_encode_bytes(input, percent_encoding::encode_set::component);
+  return percent_encode_bytes<percent_encoding::encode_sets::component>(input);
 }
 }  // namespace skyr
 
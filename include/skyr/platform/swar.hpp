@@ -0,0 +1,66 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_PLATFORM_SWAR_HPP
+#define SKYR_PLATFORM_SWAR_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/// Helpers to classify 8 bytes, or 4 16-bit code units, at a time in a 64-bit
+/// word ("SIMD within a register"), which need no platform-specific
+/// instructions
+namespace skyr::details::swar {
+constexpr auto ones = std::uint64_t{0x0101010101010101};
+constexpr auto high_bits = std::uint64_t{0x8080808080808080};
+
+constexpr auto high_bits16 = std::uint64_t{0x8000800080008000};
+
+/// Loads up to 8 bytes in little-endian order, so that byte `i` of the
+/// input is byte `i` of the word
+constexpr inline auto load(std::string_view bytes) noexcept -> std::uint64_t {
+  if (!std::is_constant_evaluated() && (std::endian::native == std::endian::little) && (bytes.size() == 8)) {
+    auto word = std::uint64_t{0};
+    std::memcpy(&word, bytes.data(), sizeof(word));
+    return word;
+  }
+
+  auto word = std::uint64_t{0};
+  for (auto i = 0ul; i < bytes.size(); ++i) {
+    word |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (i * 8);
+  }
+  return word;
+}
+
+/// \returns The high bit of every byte of `word` that is zero. There is no
+///          carry between bytes, so there are no false positives
+constexpr inline auto zero_bytes(std::uint64_t word) noexcept -> std::uint64_t {
+  return ~(((word & ~high_bits) + ~high_bits) | word | ~high_bits);
+}
+
+/// \returns The high bit of every byte of `word` that is a decimal digit. Bytes
+///          must be ASCII, so that there is no carry between bytes
+constexpr inline auto digit_bytes(std::uint64_t word) noexcept -> std::uint64_t {
+  auto at_least_zero = word + ones * (0x80 - '0');
+  auto above_nine = word + ones * (0x80 - '9' - 1);
+  return at_least_zero & ~above_nine & high_bits;
+}
+
+/// \returns The high bit of every 16-bit lane of `word` that isn't zero.
+///          There is no carry between lanes, so there are no false positives
+constexpr inline auto nonzero_lanes16(std::uint64_t word) noexcept -> std::uint64_t {
+  return (((word & ~high_bits16) + ~high_bits16) | word) & high_bits16;
+}
+
+/// Gathers the high bit of each byte into an 8-bit mask
+constexpr inline auto to_bitmask(std::uint64_t high_bits_of_bytes) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>(((high_bits_of_bytes >> 7) * std::uint64_t{0x0102040810204080}) >> 56);
+}
+}  // namespace skyr::details::swar
+
+#endif  // SKYR_PLATFORM_SWAR_HPP
@@ -0,0 +1,92 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_PUBLIC_SUFFIX_DETAILS_MAPPED_FILE_HPP
+#define SKYR_PUBLIC_SUFFIX_DETAILS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace skyr::public_suffix::details {
+/// Maps a file read-only into memory. The bytes stay valid as long as a copy
+/// of the returned pointer is alive
+inline auto map_file(const std::filesystem::path& path) -> std::shared_ptr<const std::span<const std::byte>> {
+#if defined(_WIN32)
+  auto file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  auto size = LARGE_INTEGER{};
+  if (!::GetFileSizeEx(file, &size) || (size.QuadPart == 0)) {
+    ::CloseHandle(file);
+    return nullptr;
+  }
+
+  auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  ::CloseHandle(file);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+
+  auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  ::CloseHandle(mapping);
+  if (view == nullptr) {
+    return nullptr;
+  }
+
+  auto bytes = new std::span<const std::byte>(static_cast<const std::byte*>(view),
+                                              static_cast<std::size_t>(size.QuadPart));
+  return std::shared_ptr<const std::span<const std::byte>>(bytes, [](const std::span<const std::byte>* bytes) {
+    ::UnmapViewOfFile(bytes->data());
+    delete bytes;
+  });
+#else
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    return nullptr;
+  }
+
+  struct stat status {};
+  if ((::fstat(fd, &status) == -1) || (status.st_size == 0)) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  auto size = static_cast<std::size_t>(status.st_size);
+  auto view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return nullptr;
+  }
+
+  auto bytes = new std::span<const std::byte>(static_cast<const std::byte*>(view), size);
+  return std::shared_ptr<const std::span<const std::byte>>(bytes, [](const std::span<const std::byte>* bytes) {
+    ::munmap(const_cast<std::byte*>(bytes->data()), bytes->size());
+    delete bytes;
+  });
+#endif
+}
+}  // namespace skyr::public_suffix::details
+
+#endif  // SKYR_PUBLIC_SUFFIX_DETAILS_MAPPED_FILE_HPP
@@ -0,0 +1,24 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_PUBLIC_SUFFIX_ERRORS_HPP
+#define SKYR_PUBLIC_SUFFIX_ERRORS_HPP
+
+namespace skyr {
+namespace public_suffix {
+/// \enum public_suffix_errc
+/// Enumerates public suffix list errors
+enum class public_suffix_errc {
+  /// A rule in the list could not be processed
+  invalid_rule = 1,
+  /// The compiled list is corrupt, or has an unsupported version
+  invalid_format,
+  /// The file could not be read
+  file_error,
+};
+}  // namespace public_suffix
+}  // namespace skyr
+
+#endif  // SKYR_PUBLIC_SUFFIX_ERRORS_HPP
@@ -0,0 +1,474 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_PUBLIC_SUFFIX_PUBLIC_SUFFIX_LIST_HPP
+#define SKYR_PUBLIC_SUFFIX_PUBLIC_SUFFIX_LIST_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <skyr/domain/domain.hpp>
+#include <skyr/public_suffix/details/mapped_file.hpp>
+#include <skyr/public_suffix/errors.hpp>
+
+/// \namespace skyr::public_suffix
+/// Contains an implementation of the [Public Suffix List](https://publicsuffix.org/)
+/// algorithm, used to find the registrable domain of a host
+namespace skyr::public_suffix {
+namespace details {
+/// The compiled list is a little-endian image with a 16 byte header, followed
+/// by the trie nodes in breadth-first order and the label bytes:
+///
+///   header: magic "SKPS", u32 version, u32 node count, u32 label bytes
+///   node:   u32 label offset, u32 first child, u16 child count,
+///           u8 label length, u8 flags
+///
+/// Node 0 is the root. The children of each node are contiguous and sorted by
+/// label, so they can be binary searched. Labels are stored once, however
+/// many times they appear in the list.
+constexpr auto magic = std::array<std::byte, 4>{std::byte{'S'}, std::byte{'K'}, std::byte{'P'}, std::byte{'S'}};
+constexpr auto format_version = std::uint32_t{1};
+constexpr auto header_size = std::size_t{16};
+constexpr auto node_size = std::size_t{12};
+
+/// The path from the root to the node is a rule
+constexpr auto rule_flag = std::uint8_t{0x01};
+/// The path from the root to the node is an exception rule
+constexpr auto exception_flag = std::uint8_t{0x02};
+/// There is a wildcard rule below the node
+constexpr auto wildcard_flag = std::uint8_t{0x04};
+
+constexpr auto load_u16(const std::byte* bytes) -> std::uint16_t {
+  return static_cast<std::uint16_t>(std::to_integer<unsigned>(bytes[0]) | (std::to_integer<unsigned>(bytes[1]) << 8));
+}
+
+constexpr auto load_u32(const std::byte* bytes) -> std::uint32_t {
+  return static_cast<std::uint32_t>(load_u16(bytes)) | (static_cast<std::uint32_t>(load_u16(bytes + 2)) << 16);
+}
+
+inline auto store_u16(std::uint16_t value, std::vector<std::byte>* bytes) -> void {
+  bytes->push_back(static_cast<std::byte>(value & 0xffu));
+  bytes->push_back(static_cast<std::byte>((value >> 8) & 0xffu));
+}
+
+inline auto store_u32(std::uint32_t value, std::vector<std::byte>* bytes) -> void {
+  store_u16(static_cast<std::uint16_t>(value & 0xffffu), bytes);
+  store_u16(static_cast<std::uint16_t>(value >> 16), bytes);
+}
+
+struct node {
+  std::uint32_t label_offset;
+  std::uint32_t first_child;
+  std::uint16_t child_count;
+  std::uint8_t label_length;
+  std::uint8_t flags;
+};
+
+constexpr auto to_lower(char byte) -> char {
+  return ((byte >= 'A') && (byte <= 'Z')) ? static_cast<char>(byte + ('a' - 'A')) : byte;
+}
+
+/// Compares a label in the list, which is always lower case, with a host
+/// label, ignoring ASCII case
+constexpr auto compare_label(std::string_view rule_label, std::string_view host_label) -> int {
+  auto length = std::min(rule_label.size(), host_label.size());
+  for (auto i = std::size_t{0}; i < length; ++i) {
+    auto lhs = static_cast<unsigned char>(rule_label[i]);
+    auto rhs = static_cast<unsigned char>(to_lower(host_label[i]));
+    if (lhs != rhs) {
+      return (lhs < rhs) ? -1 : 1;
+    }
+  }
+  return (rule_label.size() == host_label.size()) ? 0 : ((rule_label.size() < host_label.size()) ? -1 : 1);
+}
+
+/// The uncompiled trie, built while parsing the list text
+struct rule_node {
+  std::map<std::string, std::unique_ptr<rule_node>, std::less<>> children;
+  std::uint8_t flags = 0;
+};
+
+inline auto add_rule(std::string_view rule, rule_node* root) -> std::expected<void, public_suffix_errc> {
+  auto flags = rule_flag;
+  if (rule.starts_with('!')) {
+    flags = exception_flag;
+    rule.remove_prefix(1);
+  }
+
+  auto wildcard = false;
+  if (rule.starts_with("*.")) {
+    if (flags == exception_flag) {
+      return std::unexpected(public_suffix_errc::invalid_rule);
+    }
+    wildcard = true;
+    rule.remove_prefix(2);
+  }
+
+  auto ascii_rule = std::string{};
+  if (rule.empty() || (rule.find('*') != std::string_view::npos) || !skyr::domain_to_ascii(rule, &ascii_rule)) {
+    return std::unexpected(public_suffix_errc::invalid_rule);
+  }
+
+  auto node = root;
+  auto labels = std::string_view(ascii_rule);
+  while (!labels.empty()) {
+    auto dot = labels.rfind('.');
+    auto label = (dot == std::string_view::npos) ? labels : labels.substr(dot + 1);
+    labels = (dot == std::string_view::npos) ? std::string_view() : labels.substr(0, dot);
+    if (label.empty() || (label.size() > 255)) {
+      return std::unexpected(public_suffix_errc::invalid_rule);
+    }
+
+    auto it = node->children.find(label);
+    if (it == node->children.end()) {
+      it = node->children.emplace(std::string(label), std::make_unique<rule_node>()).first;
+    }
+    node = it->second.get();
+  }
+  node->flags |= wildcard ? wildcard_flag : flags;
+  return {};
+}
+
+inline auto compile(const rule_node& root) -> std::expected<std::vector<std::byte>, public_suffix_errc> {
+  /// Breadth-first order means that the children of each node are
+  /// contiguous, and that a node's index is known before it is written
+  auto queue = std::vector<std::pair<std::string_view, const rule_node*>>{{std::string_view(), &root}};
+  auto nodes = std::vector<node>{};
+  auto labels = std::string{};
+  auto label_offsets = std::map<std::string_view, std::uint32_t, std::less<>>{};
+  for (auto i = std::size_t{0}; i < queue.size(); ++i) {
+    auto [label, rule] = queue[i];
+    if (rule->children.size() > 0xffffu) {
+      return std::unexpected(public_suffix_errc::invalid_rule);
+    }
+
+    auto it = label_offsets.find(label);
+    if (it == label_offsets.end()) {
+      it = label_offsets.emplace(label, static_cast<std::uint32_t>(labels.size())).first;
+      labels.append(label);
+    }
+
+    nodes.push_back(node{it->second, static_cast<std::uint32_t>(queue.size()),
+                         static_cast<std::uint16_t>(rule->children.size()), static_cast<std::uint8_t>(label.size()),
+                         rule->flags});
+    for (const auto& [child_label, child] : rule->children) {
+      queue.emplace_back(child_label, child.get());
+    }
+  }
+
+  auto bytes = std::vector<std::byte>{};
+  bytes.reserve(header_size + nodes.size() * node_size + labels.size());
+  bytes.insert(bytes.end(), magic.begin(), magic.end());
+  store_u32(format_version, &bytes);
+  store_u32(static_cast<std::uint32_t>(nodes.size()), &bytes);
+  store_u32(static_cast<std::uint32_t>(labels.size()), &bytes);
+  for (const auto& node : nodes) {
+    store_u32(node.label_offset, &bytes);
+    store_u32(node.first_child, &bytes);
+    store_u16(node.child_count, &bytes);
+    bytes.push_back(static_cast<std::byte>(node.label_length));
+    bytes.push_back(static_cast<std::byte>(node.flags));
+  }
+  std::transform(labels.begin(), labels.end(), std::back_inserter(bytes),
+                 [](auto byte) { return static_cast<std::byte>(byte); });
+  return bytes;
+}
+}  // namespace details
+
+/// A compiled, immutable Public Suffix List.
+///
+/// The list is either parsed from the text format published at
+/// https://publicsuffix.org/list/public_suffix_list.dat, or loaded from the
+/// compiled form, which can be generated once at build time and memory
+/// mapped. Lookups don't allocate, and return views into the host.
+/// Copies share the same storage, and a list can be used concurrently from
+/// several threads.
+class suffix_list {
+ public:
+  /// Constructs an empty list, in which the default rule `*` applies to
+  /// every host
+  suffix_list() : suffix_list(std::make_shared<const std::vector<std::byte>>(empty_list())) {
+  }
+
+  /// Parses the text format of the Public Suffix List
+  /// \param text The list text
+  /// \returns The compiled list, or an error if a rule is invalid
+  static auto parse(std::string_view text) -> std::expected<suffix_list, public_suffix_errc> {
+    auto root = details::rule_node{};
+    while (!text.empty()) {
+      auto eol = text.find('\n');
+      auto line = text.substr(0, eol);
+      text = (eol == std::string_view::npos) ? std::string_view() : text.substr(eol + 1);
+
+      /// Each rule is the first whitespace delimited token on a line
+      auto first = line.find_first_not_of(" \t\r");
+      if ((first == std::string_view::npos) || line.substr(first).starts_with("//")) {
+        continue;
+      }
+      auto rule = line.substr(first, line.find_first_of(" \t\r", first) - first);
+      if (auto result = details::add_rule(rule, &root); !result) {
+        return std::unexpected(result.error());
+      }
+    }
+
+    return details::compile(root).transform([](auto&& bytes) {
+      return suffix_list(std::make_shared<const std::vector<std::byte>>(std::move(bytes)));
+    });
+  }
+
+  /// Reads and parses the text format of the Public Suffix List
+  /// \param path The path to the list file
+  /// \returns The compiled list, or an error
+  static auto load(const std::filesystem::path& path) -> std::expected<suffix_list, public_suffix_errc> {
+    auto file = std::ifstream(path, std::ios::binary);
+    if (!file) {
+      return std::unexpected(public_suffix_errc::file_error);
+    }
+    auto text = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return parse(text);
+  }
+
+  /// Uses a compiled list without copying it. The bytes must outlive the
+  /// list and all of its copies.
+  /// \param bytes A compiled list, as returned by `compiled()`
+  /// \returns The list, or an error if the bytes aren't a valid compiled list
+  static auto from_compiled(std::span<const std::byte> bytes) -> std::expected<suffix_list, public_suffix_errc> {
+    if (!is_valid(bytes)) {
+      return std::unexpected(public_suffix_errc::invalid_format);
+    }
+    return suffix_list(std::shared_ptr<const void>(), bytes);
+  }
+
+  /// Memory maps a compiled list file
+  /// \param path The path to a file containing a compiled list
+  /// \returns The list, or an error
+  static auto map_compiled(const std::filesystem::path& path) -> std::expected<suffix_list, public_suffix_errc> {
+    auto mapped = details::map_file(path);
+    if (!mapped) {
+      return std::unexpected(public_suffix_errc::file_error);
+    }
+    if (!is_valid(*mapped)) {
+      return std::unexpected(public_suffix_errc::invalid_format);
+    }
+    auto bytes = *mapped;
+    return suffix_list(std::move(mapped), bytes);
+  }
+
+  /// \returns The compiled form of the list, which can be saved and loaded
+  ///          with `from_compiled` or `map_compiled`
+  [[nodiscard]] auto compiled() const noexcept -> std::span<const std::byte> {
+    return bytes_;
+  }
+
+  /// Finds the public suffix of a host, e.g. `co.uk` for `www.example.co.uk`.
+  ///
+  /// Hosts are expected to be ASCII, as returned by `url::hostname`, and
+  /// matched without regard to ASCII case. A trailing dot is ignored.
+  ///
+  /// \param host A domain name
+  /// \returns A view of the public suffix in `host`, or `std::nullopt` if
+  ///          `host` isn't a domain
+  [[nodiscard]] auto public_suffix(std::string_view host) const noexcept -> std::optional<std::string_view> {
+    auto labels = suffix_labels(host);
+    if (!labels) {
+      return std::nullopt;
+    }
+    return tail(trim(host), labels.value());
+  }
+
+  /// Finds the registrable domain of a host, which is the public suffix and
+  /// the label before it, e.g. `example.co.uk` for `www.example.co.uk`
+  ///
+  /// \param host A domain name
+  /// \returns A view of the registrable domain in `host`, or `std::nullopt`
+  ///          if `host` isn't a domain or is itself a public suffix
+  [[nodiscard]] auto registrable_domain(std::string_view host) const noexcept -> std::optional<std::string_view> {
+    auto labels = suffix_labels(host);
+    if (!labels) {
+      return std::nullopt;
+    }
+    return tail(trim(host), labels.value() + 1);
+  }
+
+ private:
+  explicit suffix_list(std::shared_ptr<const std::vector<std::byte>> bytes)
+      : storage_(bytes), bytes_(*bytes) {
+  }
+
+  suffix_list(std::shared_ptr<const void> storage, std::span<const std::byte> bytes)
+      : storage_(std::move(storage)), bytes_(bytes) {
+  }
+
+  static auto empty_list() -> std::vector<std::byte> {
+    return *details::compile(details::rule_node{});
+  }
+
+  static auto is_valid(std::span<const std::byte> bytes) -> bool {
+    using namespace details;
+
+    if ((bytes.size() < header_size) || !std::equal(magic.begin(), magic.end(), bytes.begin()) ||
+        (load_u32(bytes.data() + 4) != format_version)) {
+      return false;
+    }
+
+    auto node_count = std::size_t{load_u32(bytes.data() + 8)};
+    auto labels_size = std::size_t{load_u32(bytes.data() + 12)};
+    if ((node_count == 0) || (bytes.size() != header_size + node_count * node_size + labels_size)) {
+      return false;
+    }
+
+    /// Every child must come after its parent, so that lookups always
+    /// terminate
+    for (auto i = std::size_t{0}; i < node_count; ++i) {
+      auto node = load_node(bytes, i);
+      if ((std::size_t{node.label_offset} + node.label_length > labels_size) ||
+          ((node.child_count != 0) && (node.first_child <= i)) ||
+          (std::size_t{node.first_child} + node.child_count > node_count)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static constexpr auto load_node(std::span<const std::byte> bytes, std::size_t index) -> details::node {
+    auto data = bytes.data() + details::header_size + index * details::node_size;
+    return details::node{details::load_u32(data), details::load_u32(data + 4), details::load_u16(data + 8),
+                         std::to_integer<std::uint8_t>(data[10]), std::to_integer<std::uint8_t>(data[11])};
+  }
+
+  [[nodiscard]] auto node_count() const noexcept -> std::size_t {
+    return details::load_u32(bytes_.data() + 8);
+  }
+
+  [[nodiscard]] auto label(const details::node& node) const noexcept -> std::string_view {
+    auto labels = bytes_.data() + details::header_size + node_count() * details::node_size;
+    return std::string_view(reinterpret_cast<const char*>(labels + node.label_offset), node.label_length);
+  }
+
+  [[nodiscard]] auto find_child(const details::node& parent, std::string_view host_label) const noexcept
+      -> std::optional<details::node> {
+    auto first = std::size_t{parent.first_child}, last = first + parent.child_count;
+    while (first < last) {
+      auto middle = first + (last - first) / 2;
+      auto child = load_node(bytes_, middle);
+      auto order = details::compare_label(label(child), host_label);
+      if (order == 0) {
+        return child;
+      } else if (order < 0) {
+        first = middle + 1;
+      } else {
+        last = middle;
+      }
+    }
+    return std::nullopt;
+  }
+
+  static constexpr auto trim(std::string_view host) noexcept -> std::string_view {
+    if (host.ends_with('.')) {
+      host.remove_suffix(1);
+    }
+    return host;
+  }
+
+  /// \returns The last `count` labels of `host`, or `std::nullopt` if there
+  ///          are fewer labels
+  static constexpr auto tail(std::string_view host, std::size_t count) noexcept -> std::optional<std::string_view> {
+    auto first = host.size();
+    for (; count != 0; --count) {
+      if (first == std::string_view::npos) {
+        return std::nullopt;
+      }
+      auto dot = (first == 0) ? std::string_view::npos : host.rfind('.', first - 1);
+      first = dot;
+    }
+    return (first == std::string_view::npos) ? host : host.substr(first + 1);
+  }
+
+  /// Applies the algorithm at https://publicsuffix.org/list/
+  /// \returns The number of labels in the public suffix of `host`
+  [[nodiscard]] auto suffix_labels(std::string_view host) const noexcept -> std::optional<std::size_t> {
+    host = trim(host);
+    if (host.empty() || host.starts_with('[')) {
+      return std::nullopt;
+    }
+
+    auto label_count = std::size_t{0};
+    auto last_label = std::string_view();
+    auto remaining = host;
+    while (true) {
+      auto dot = remaining.rfind('.');
+      auto label = (dot == std::string_view::npos) ? remaining : remaining.substr(dot + 1);
+      if (label.empty()) {
+        return std::nullopt;
+      }
+      if (label_count++ == 0) {
+        last_label = label;
+      }
+      if (dot == std::string_view::npos) {
+        break;
+      }
+      remaining = remaining.substr(0, dot);
+    }
+
+    /// A numeric last label means that the host is an IPv4 address
+    if (std::all_of(last_label.begin(), last_label.end(), [](auto byte) { return (byte >= '0') && (byte <= '9'); })) {
+      return std::nullopt;
+    }
+
+    /// The default rule is "*"
+    auto suffix = std::size_t{1};
+    auto node = load_node(bytes_, 0);
+    auto depth = std::size_t{0};
+    remaining = host;
+    while (true) {
+      if (((node.flags & details::wildcard_flag) != 0) && (depth < label_count)) {
+        suffix = std::max(suffix, depth + 1);
+      }
+      if (depth == label_count) {
+        break;
+      }
+
+      auto dot = remaining.rfind('.');
+      auto label = (dot == std::string_view::npos) ? remaining : remaining.substr(dot + 1);
+      remaining = (dot == std::string_view::npos) ? std::string_view() : remaining.substr(0, dot);
+
+      auto child = find_child(node, label);
+      if (!child) {
+        break;
+      }
+      node = child.value();
+      ++depth;
+
+      /// Exception rules prevail over every other rule
+      if ((node.flags & details::exception_flag) != 0) {
+        return depth - 1;
+      }
+      if ((node.flags & details::rule_flag) != 0) {
+        suffix = std::max(suffix, depth);
+      }
+    }
+    return suffix;
+  }
+
+  std::shared_ptr<const void> storage_;
+  std::span<const std::byte> bytes_;
+};
+}  // namespace skyr::public_suffix
+
+#endif  // SKYR_PUBLIC_SUFFIX_PUBLIC_SUFFIX_LIST_HPP
@@ -7,35 +7,53 @@
 #define SKYR_UNICODE_DETAILS_TO_U8_HPP
 
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 #include <skyr/concepts/url_concepts.hpp>
 #include <skyr/unicode/errors.hpp>
-#include <skyr/unicode/ranges/transforms/u8_transform.hpp>
-#include <skyr/unicode/ranges/views/u16_view.hpp>
+#include <skyr/unicode/transcode.hpp>
 
 namespace skyr::details {
+/// Views a source string. Arrays are viewed up to their extent, less the
+/// null terminator, so that literals can contain null characters.
+template <class charT, class Source>
+constexpr inline auto as_string_view(const Source& source) noexcept -> std::basic_string_view<charT> {
+  if constexpr (std::is_array_v<Source>) {
+    constexpr auto extent = std::extent_v<Source>;
+    auto size = ((extent > 0) && (source[extent - 1] == charT{})) ? (extent - 1) : extent;
+    return std::basic_string_view<charT>(source, size);
+  } else {
+    return std::basic_string_view<charT>(source);
+  }
+}
+
+/// UTF-8 sources are viewed as they are, without a copy
 template <class Source>
   requires is_string_container<Source, char>
-inline auto to_u8(const Source& source) -> std::expected<std::string, unicode::unicode_errc> {
-  return std::string(source);
+constexpr inline auto to_u8(const Source& source) noexcept -> std::expected<std::string_view, unicode::unicode_errc> {
+  return std::string_view(source);
 }
 
+/// UTF-8 sources are viewed as they are, without a copy
 template <class Source>
   requires is_string_container<Source, char8_t>
-inline auto to_u8(const Source& source) -> std::expected<std::string, unicode::unicode_errc> {
-  return std::string(std::cbegin(source), std::cend(source));
+inline auto to_u8(const Source& source) noexcept -> std::expected<std::string_view, unicode::unicode_errc> {
+  auto bytes = as_string_view<char8_t>(source);
+  return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());  // NOLINT
 }
 
 template <class Source>
   requires is_string_container<Source, char16_t> || is_string_container<Source, wchar_t>
 inline auto to_u8(const Source& source) -> std::expected<std::string, unicode::unicode_errc> {
-  return unicode::as<std::string>(unicode::views::as_u16(source) | unicode::transforms::to_u8);
+  using char_type = std::conditional_t<is_string_container<Source, char16_t>, char16_t, wchar_t>;
+  return unicode::details::to_utf8(as_string_view<char_type>(source));
 }
 
 template <class Source>
   requires is_string_container<Source, char32_t>
 inline auto to_u8(const Source& source) -> std::expected<std::string, unicode::unicode_errc> {
-  return unicode::as<std::string>(source | unicode::transforms::to_u8);
+  return unicode::to_utf8(as_string_view<char32_t>(source));
 }
 }  // namespace skyr::details
 
@@ -0,0 +1,252 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_UNICODE_NORMALIZATION_HPP
+#define SKYR_UNICODE_NORMALIZATION_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <skyr/unicode/normalization_tables.hpp>
+
+namespace skyr::unicode {
+/// \enum quick_check
+/// The result of a normalization quick check:
+///
+/// https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+///
+enum class quick_check {
+  /// The input is normalized
+  yes,
+  /// The input is not normalized
+  no,
+  /// The input may be normalized, and needs to be checked
+  maybe,
+};
+
+namespace details {
+namespace hangul {
+constexpr auto s_base = U'\xac00';
+constexpr auto l_base = U'\x1100';
+constexpr auto v_base = U'\x1161';
+constexpr auto t_base = U'\x11a7';
+constexpr auto l_count = char32_t{19};
+constexpr auto v_count = char32_t{21};
+constexpr auto t_count = char32_t{28};
+constexpr auto n_count = v_count * t_count;
+constexpr auto s_count = l_count * n_count;
+}  // namespace hangul
+
+/// Below this value, every code point is a starter with NFC_QC=Yes and no
+/// canonical decomposition
+constexpr auto first_normalization_code_point = U'\x00c0';
+
+constexpr auto normalization_properties(char32_t code_point) -> std::uint16_t {
+  if (code_point > U'\x10ffff') {
+    return 0;
+  }
+  constexpr auto block_mask = (char32_t{1} << normalization_block_shift) - 1;
+  auto block = static_cast<std::size_t>(normalization_index[code_point >> normalization_block_shift]);
+  return normalization_blocks[(block << normalization_block_shift) | (code_point & block_mask)];
+}
+
+constexpr auto canonical_decomposition(char32_t code_point) -> std::u32string_view {
+  constexpr auto less = [](const auto& lhs, auto rhs) { return lhs.code_point < rhs; };
+
+  if (code_point < first_normalization_code_point) {
+    return {};
+  }
+
+  auto first = std::cbegin(decompositions), last = std::cend(decompositions);
+  auto it = std::lower_bound(first, last, code_point, less);
+  if ((it == last) || (it->code_point != code_point)) {
+    return {};
+  }
+  return std::u32string_view(decomposed_code_points.data() + it->offset, it->length);
+}
+
+/// \returns The primary composite of the pair, or 0 if there is none
+constexpr auto canonical_composition(char32_t first, char32_t second) -> char32_t {
+  if ((first >= hangul::l_base) && (first < hangul::l_base + hangul::l_count) && (second >= hangul::v_base) &&
+      (second < hangul::v_base + hangul::v_count)) {
+    return hangul::s_base + ((first - hangul::l_base) * hangul::v_count + (second - hangul::v_base)) * hangul::t_count;
+  }
+
+  if ((first >= hangul::s_base) && (first < hangul::s_base + hangul::s_count) &&
+      (((first - hangul::s_base) % hangul::t_count) == 0) && (second > hangul::t_base) &&
+      (second < hangul::t_base + hangul::t_count)) {
+    return first + (second - hangul::t_base);
+  }
+
+  constexpr auto less = [](const auto& lhs, const auto& rhs) {
+    return (lhs.first < rhs.first) || ((lhs.first == rhs.first) && (lhs.second < rhs.second));
+  };
+
+  auto value = composition{first, second, 0};
+  auto it = std::lower_bound(std::cbegin(compositions), std::cend(compositions), value, less);
+  return ((it != std::cend(compositions)) && (it->first == first) && (it->second == second)) ? it->composite : 0;
+}
+}  // namespace details
+
+///
+/// \param code_point A code point value
+/// \return The Canonical_Combining_Class of the code point
+constexpr auto canonical_combining_class(char32_t code_point) -> std::uint8_t {
+  return static_cast<std::uint8_t>(details::normalization_properties(code_point) & details::combining_class_mask);
+}
+
+///
+/// \param code_point A code point value
+/// \return The NFC_Quick_Check value of the code point
+constexpr auto nfc_quick_check(char32_t code_point) -> quick_check {
+  return static_cast<quick_check>(details::normalization_properties(code_point) >> details::nfc_quick_check_shift);
+}
+
+/// Tests if a string is in NFC without normalizing it:
+///
+/// https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+///
+/// \param code_points A UTF-32 string
+/// \return `yes` or `no` if the string is known to be normalized or not,
+///         otherwise `maybe`
+constexpr auto nfc_quick_check(std::u32string_view code_points) -> quick_check {
+  auto result = quick_check::yes;
+  auto last_class = std::uint8_t{0};
+  for (auto code_point : code_points) {
+    if (code_point < U'\x0300') {
+      last_class = 0;
+      continue;
+    }
+
+    auto properties = details::normalization_properties(code_point);
+    auto combining_class = static_cast<std::uint8_t>(properties & details::combining_class_mask);
+    if ((combining_class != 0) && (last_class > combining_class)) {
+      return quick_check::no;
+    }
+
+    auto check = static_cast<quick_check>(properties >> details::nfc_quick_check_shift);
+    if (check == quick_check::no) {
+      return quick_check::no;
+    } else if (check == quick_check::maybe) {
+      result = quick_check::maybe;
+    }
+    last_class = combining_class;
+  }
+  return result;
+}
+
+/// Normalizes a string to
+/// [Normalization Form C](https://www.unicode.org/reports/tr15/#Norm_Forms)
+///
+/// \param code_points A UTF-32 string
+/// \param normalized The output buffer, which will contain the normalized string
+inline auto normalize_nfc(std::u32string_view code_points, std::u32string* normalized) -> void {
+  normalized->clear();
+  normalized->reserve(code_points.size());
+
+  /// Canonical decomposition
+  for (auto code_point : code_points) {
+    if ((code_point >= details::hangul::s_base) && (code_point < details::hangul::s_base + details::hangul::s_count)) {
+      auto index = code_point - details::hangul::s_base;
+      normalized->push_back(details::hangul::l_base + index / details::hangul::n_count);
+      normalized->push_back(details::hangul::v_base + (index % details::hangul::n_count) / details::hangul::t_count);
+      if ((index % details::hangul::t_count) != 0) {
+        normalized->push_back(details::hangul::t_base + index % details::hangul::t_count);
+      }
+      continue;
+    }
+
+    auto decomposition = details::canonical_decomposition(code_point);
+    if (decomposition.empty()) {
+      normalized->push_back(code_point);
+    } else {
+      normalized->append(decomposition);
+    }
+  }
+
+  /// Canonical ordering, which sorts each run of non-starters by their
+  /// combining class
+  constexpr auto is_starter = [](auto code_point) { return canonical_combining_class(code_point) == 0; };
+  constexpr auto by_combining_class = [](auto lhs, auto rhs) {
+    return canonical_combining_class(lhs) < canonical_combining_class(rhs);
+  };
+
+  auto first = std::begin(*normalized), last = std::end(*normalized);
+  while (first != last) {
+    auto run_first = std::find_if_not(first, last, is_starter);
+    auto run_last = std::find_if(run_first, last, is_starter);
+    if (std::distance(run_first, run_last) > 1) {
+      std::stable_sort(run_first, run_last, by_combining_class);
+    }
+    first = run_last;
+  }
+
+  /// Canonical composition
+  if (normalized->empty()) {
+    return;
+  }
+
+  auto& buffer = *normalized;
+  auto starter = std::size_t{0};
+  auto last_class = static_cast<unsigned>(canonical_combining_class(buffer[0]));
+  if (last_class != 0) {
+    /// The string starts with a non-starter, which must not be composed
+    last_class = 256;
+  }
+
+  auto size = std::size_t{1};
+  for (auto i = std::size_t{1}; i < buffer.size(); ++i) {
+    auto code_point = buffer[i];
+    auto combining_class = static_cast<unsigned>(canonical_combining_class(code_point));
+    auto composite = (last_class < 256) ? details::canonical_composition(buffer[starter], code_point) : 0;
+    if ((composite != 0) && ((last_class < combining_class) || (last_class == 0))) {
+      buffer[starter] = composite;
+    } else {
+      if (combining_class == 0) {
+        starter = size;
+      }
+      last_class = combining_class;
+      buffer[size++] = code_point;
+    }
+  }
+  buffer.resize(size);
+}
+
+/// Normalizes a string to
+/// [Normalization Form C](https://www.unicode.org/reports/tr15/#Norm_Forms)
+/// in place. Strings that pass the quick check are left untouched.
+///
+/// \param code_points A UTF-32 string
+inline auto normalize_nfc(std::u32string* code_points) -> void {
+  if (nfc_quick_check(*code_points) != quick_check::yes) {
+    auto normalized = std::u32string{};
+    normalize_nfc(*code_points, &normalized);
+    code_points->swap(normalized);
+  }
+}
+
+///
+/// \param code_points A UTF-32 string
+/// \return `true` if the string is in NFC
+inline auto is_nfc(std::u32string_view code_points) -> bool {
+  switch (nfc_quick_check(code_points)) {
+    case quick_check::yes:
+      return true;
+    case quick_check::no:
+      return false;
+    case quick_check::maybe:
+      break;
+  }
+
+  auto normalized = std::u32string{};
+  normalize_nfc(code_points, &normalized);
+  return code_points == normalized;
+}
+}  // namespace skyr::unicode
+
+#endif  // SKYR_UNICODE_NORMALIZATION_HPP
@@ -0,0 +1,5339 @@
+// Auto-generated.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_UNICODE_NORMALIZATION_TABLES_HPP
+#define SKYR_UNICODE_NORMALIZATION_TABLES_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace skyr::unicode::details {
+/// Each code point property is packed in 16 bits: the
+/// Canonical_Combining_Class in the low byte and the NFC_QC value in the high
+/// byte
+inline constexpr auto combining_class_mask = std::uint16_t{0xff};
+inline constexpr auto nfc_quick_check_shift = 8;
+
+/// The properties are stored in a two-stage table, split into blocks of
+/// `1 << normalization_block_shift` code points
+inline constexpr auto normalization_block_shift = 6;
+
+inline constexpr auto normalization_index = std::array<std::uint8_t, 17408>{{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+    0, 0, 4, 0, 0, 0, 5, 6, 7, 8, 0, 9, 10, 11, 0, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 19, 25, 26, 27,
+    23, 28, 23, 29, 30, 27, 0, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 0, 41, 0, 0, 42, 43, 44, 0, 0, 0, 0, 0, 45, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 47,
+    0, 0, 48, 0, 49, 0, 0, 0, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 0, 0, 59, 0, 0, 0, 60, 0, 0, 0, 0, 0, 61, 62, 63,
+    64, 0, 0, 65, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0,
+    0, 0, 0, 69, 0, 70, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+    72, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 75, 76, 0, 0, 0, 0,
+    77, 0, 0, 78, 79, 80, 81, 82, 0, 0, 83, 84, 0, 0, 0, 85,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 86, 86, 86, 86, 87, 88, 86, 89, 90, 91, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 94, 0, 95, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 97, 0, 0, 0, 0,
+    0, 0, 0, 0, 98, 0, 0, 0, 0, 0, 99, 100, 0, 101, 102, 0,
+    0, 103, 104, 0, 105, 81, 0, 106, 107, 0, 0, 108, 109, 110, 0, 0,
+    0, 111, 112, 113, 0, 0, 114, 115, 70, 0, 116, 0, 117, 0, 0, 0,
+    118, 0, 0, 0, 119, 120, 0, 121, 122, 123, 124, 0, 0, 0, 0, 0,
+    70, 0, 0, 0, 0, 125, 126, 0, 0, 0, 0, 0, 0, 127, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 129, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 133, 134, 0, 135, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    136, 0, 137, 0, 129, 0, 0, 0, 0, 0, 138, 139, 0, 0, 0, 0,
+    0, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 141, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    86, 86, 86, 86, 86, 86, 86, 86, 143, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+}};
+
+inline constexpr auto normalization_blocks = std::array<std::uint16_t, 9216>{{
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02e6, 0x02e6, 0x02e6, 0x02e6, 0x02e6, 0x00e6, 0x02e6, 0x02e6,
+    0x02e6, 0x02e6, 0x02e6, 0x02e6, 0x02e6, 0x00e6, 0x00e6, 0x02e6, 0x00e6, 0x02e6, 0x00e6, 0x02e6,
+    0x02e6, 0x00e8, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e8, 0x02d8, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+    0x00dc, 0x00ca, 0x00ca, 0x02dc, 0x02dc, 0x02dc, 0x02dc, 0x02ca, 0x02ca, 0x00dc, 0x00dc, 0x00dc,
+    0x00dc, 0x02dc, 0x02dc, 0x00dc, 0x02dc, 0x02dc, 0x00dc, 0x00dc, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0201, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x01e6, 0x01e6, 0x02e6, 0x01e6,
+    0x01e6, 0x02f0, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e8, 0x00dc, 0x00dc, 0x00e6,
+    0x00e9, 0x00ea, 0x00ea, 0x00e9, 0x00ea, 0x00ea, 0x00e9, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00de, 0x00dc,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+    0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00de, 0x00e4, 0x00e6, 0x000a, 0x000b, 0x000c, 0x000d,
+    0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0013, 0x0014, 0x0015, 0x0016, 0x0000, 0x0017,
+    0x0000, 0x0018, 0x0019, 0x0000, 0x00e6, 0x00dc, 0x0000, 0x0012, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x001e, 0x001f, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
+    0x0020, 0x0021, 0x0022, 0x02e6, 0x02e6, 0x02dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0023, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc,
+    0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0024, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc,
+    0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6,
+    0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6,
+    0x00e6, 0x00dc, 0x00dc, 0x00dc, 0x001b, 0x001c, 0x001d, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6,
+    0x00e6, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0207, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0100, 0x0100, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0200, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0054, 0x025b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+    0x0009, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0209, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0067, 0x0067, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x006b, 0x006b, 0x006b, 0x006b,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0076, 0x0076, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x007a, 0x007a, 0x007a, 0x007a, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x00dc, 0x0000, 0x00d8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0081, 0x0082, 0x0100, 0x0084, 0x0100, 0x0100, 0x0000,
+    0x0100, 0x0000, 0x0082, 0x0082, 0x0082, 0x0082, 0x0000, 0x0000, 0x0082, 0x0100, 0x00e6, 0x00e6,
+    0x0009, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+    0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00de, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x00dc,
+    0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00dc, 0x0000, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00dc,
+    0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+    0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0001, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6,
+    0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6,
+    0x00e6, 0x00ea, 0x00d6, 0x00dc, 0x00ca, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e8, 0x00e4, 0x00e4, 0x00dc, 0x00da, 0x00e6,
+    0x00e9, 0x00dc, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0100, 0x0000, 0x0100, 0x0000, 0x0100,
+    0x0000, 0x0100, 0x0000, 0x0100, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0100,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0100, 0x0100,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0000, 0x0100,
+    0x0000, 0x0100, 0x0000, 0x0000, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x0001, 0x0001, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0001, 0x0001, 0x0001, 0x00e6,
+    0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x00e6,
+    0x00dc, 0x00e6, 0x0001, 0x0001, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0100, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00da, 0x00e4, 0x00e8, 0x00de, 0x00e0, 0x00e0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0208, 0x0208, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc,
+    0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x00e6, 0x00e6,
+    0x00dc, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+    0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0000, 0x0000, 0x0100, 0x0000, 0x0100, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0100, 0x0000, 0x0100, 0x0000,
+    0x0000, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x001a, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0000, 0x0100, 0x0000, 0x0100, 0x0100, 0x0000, 0x0100, 0x0100, 0x0000, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00dc,
+    0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x00dc, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0001, 0x00dc, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00dc, 0x00dc, 0x00e6, 0x00e6, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x00dc, 0x00dc,
+    0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00e6, 0x00dc, 0x00e6, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0207, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0007, 0x0007, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0007,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0009, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0200, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0007, 0x0000,
+    0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x00d8, 0x00d8, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x00e2, 0x00d8, 0x00d8,
+    0x00d8, 0x00d8, 0x00d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00dc,
+    0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00dc, 0x00dc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x00e6, 0x00e6, 0x00e6, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00e8, 0x00e8, 0x00dc, 0x00e6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x00dc, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e6, 0x00e6, 0x00e6, 0x00e6,
+    0x00e6, 0x00e6, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100, 0x0100,
+    0x0100, 0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+}};
+
+/// The full canonical decomposition of a code point is `length` code points
+/// from `offset` in `decomposed_code_points`
+struct decomposition {
+  char32_t code_point;
+  std::uint16_t offset;
+  std::uint16_t length;
+};
+
+inline constexpr auto decompositions = std::array<decomposition, 2061>{{
+    {U'\x00c0', 0, 2},
+    {U'\x00c1', 2, 2},
+    {U'\x00c2', 4, 2},
+    {U'\x00c3', 6, 2},
+    {U'\x00c4', 8, 2},
+    {U'\x00c5', 10, 2},
+    {U'\x00c7', 12, 2},
+    {U'\x00c8', 14, 2},
+    {U'\x00c9', 16, 2},
+    {U'\x00ca', 18, 2},
+    {U'\x00cb', 20, 2},
+    {U'\x00cc', 22, 2},
+    {U'\x00cd', 24, 2},
+    {U'\x00ce', 26, 2},
+    {U'\x00cf', 28, 2},
+    {U'\x00d1', 30, 2},
+    {U'\x00d2', 32, 2},
+    {U'\x00d3', 34, 2},
+    {U'\x00d4', 36, 2},
+    {U'\x00d5', 38, 2},
+    {U'\x00d6', 40, 2},
+    {U'\x00d9', 42, 2},
+    {U'\x00da', 44, 2},
+    {U'\x00db', 46, 2},
+    {U'\x00dc', 48, 2},
+    {U'\x00dd', 50, 2},
+    {U'\x00e0', 52, 2},
+    {U'\x00e1', 54, 2},
+    {U'\x00e2', 56, 2},
+    {U'\x00e3', 58, 2},
+    {U'\x00e4', 60, 2},
+    {U'\x00e5', 62, 2},
+    {U'\x00e7', 64, 2},
+    {U'\x00e8', 66, 2},
+    {U'\x00e9', 68, 2},
+    {U'\x00ea', 70, 2},
+    {U'\x00eb', 72, 2},
+    {U'\x00ec', 74, 2},
+    {U'\x00ed', 76, 2},
+    {U'\x00ee', 78, 2},
+    {U'\x00ef', 80, 2},
+    {U'\x00f1', 82, 2},
+    {U'\x00f2', 84, 2},
+    {U'\x00f3', 86, 2},
+    {U'\x00f4', 88, 2},
+    {U'\x00f5', 90, 2},
+    {U'\x00f6', 92, 2},
+    {U'\x00f9', 94, 2},
+    {U'\x00fa', 96, 2},
+    {U'\x00fb', 98, 2},
+    {U'\x00fc', 100, 2},
+    {U'\x00fd', 102, 2},
+    {U'\x00ff', 104, 2},
+    {U'\x0100', 106, 2},
+    {U'\x0101', 108, 2},
+    {U'\x0102', 110, 2},
+    {U'\x0103', 112, 2},
+    {U'\x0104', 114, 2},
+    {U'\x0105', 116, 2},
+    {U'\x0106', 118, 2},
+    {U'\x0107', 120, 2},
+    {U'\x0108', 122, 2},
+    {U'\x0109', 124, 2},
+    {U'\x010a', 126, 2},
+    {U'\x010b', 128, 2},
+    {U'\x010c', 130, 2},
+    {U'\x010d', 132, 2},
+    {U'\x010e', 134, 2},
+    {U'\x010f', 136, 2},
+    {U'\x0112', 138, 2},
+    {U'\x0113', 140, 2},
+    {U'\x0114', 142, 2},
+    {U'\x0115', 144, 2},
+    {U'\x0116', 146, 2},
+    {U'\x0117', 148, 2},
+    {U'\x0118', 150, 2},
+    {U'\x0119', 152, 2},
+    {U'\x011a', 154, 2},
+    {U'\x011b', 156, 2},
+    {U'\x011c', 158, 2},
+    {U'\x011d', 160, 2},
+    {U'\x011e', 162, 2},
+    {U'\x011f', 164, 2},
+    {U'\x0120', 166, 2},
+    {U'\x0121', 168, 2},
+    {U'\x0122', 170, 2},
+    {U'\x0123', 172, 2},
+    {U'\x0124', 174, 2},
+    {U'\x0125', 176, 2},
+    {U'\x0128', 178, 2},
+    {U'\x0129', 180, 2},
+    {U'\x012a', 182, 2},
+    {U'\x012b', 184, 2},
+    {U'\x012c', 186, 2},
+    {U'\x012d', 188, 2},
+    {U'\x012e', 190, 2},
+    {U'\x012f', 192, 2},
+    {U'\x0130', 194, 2},
+    {U'\x0134', 196, 2},
+    {U'\x0135', 198, 2},
+    {U'\x0136', 200, 2},
+    {U'\x0137', 202, 2},
+    {U'\x0139', 204, 2},
+    {U'\x013a', 206, 2},
+    {U'\x013b', 208, 2},
+    {U'\x013c', 210, 2},
+    {U'\x013d', 212, 2},
+    {U'\x013e', 214, 2},
+    {U'\x0143', 216, 2},
+    {U'\x0144', 218, 2},
+    {U'\x0145', 220, 2},
+    {U'\x0146', 222, 2},
+    {U'\x0147', 224, 2},
+    {U'\x0148', 226, 2},
+    {U'\x014c', 228, 2},
+    {U'\x014d', 230, 2},
+    {U'\x014e', 232, 2},
+    {U'\x014f', 234, 2},
+    {U'\x0150', 236, 2},
+    {U'\x0151', 238, 2},
+    {U'\x0154', 240, 2},
+    {U'\x0155', 242, 2},
+    {U'\x0156', 244, 2},
+    {U'\x0157', 246, 2},
+    {U'\x0158', 248, 2},
+    {U'\x0159', 250, 2},
+    {U'\x015a', 252, 2},
+    {U'\x015b', 254, 2},
+    {U'\x015c', 256, 2},
+    {U'\x015d', 258, 2},
+    {U'\x015e', 260, 2},
+    {U'\x015f', 262, 2},
+    {U'\x0160', 264, 2},
+    {U'\x0161', 266, 2},
+    {U'\x0162', 268, 2},
+    {U'\x0163', 270, 2},
+    {U'\x0164', 272, 2},
+    {U'\x0165', 274, 2},
+    {U'\x0168', 276, 2},
+    {U'\x0169', 278, 2},
+    {U'\x016a', 280, 2},
+    {U'\x016b', 282, 2},
+    {U'\x016c', 284, 2},
+    {U'\x016d', 286, 2},
+    {U'\x016e', 288, 2},
+    {U'\x016f', 290, 2},
+    {U'\x0170', 292, 2},
+    {U'\x0171', 294, 2},
+    {U'\x0172', 296, 2},
+    {U'\x0173', 298, 2},
+    {U'\x0174', 300, 2},
+    {U'\x0175', 302, 2},
+    {U'\x0176', 304, 2},
+    {U'\x0177', 306, 2},
+    {U'\x0178', 308, 2},
+    {U'\x0179', 310, 2},
+    {U'\x017a', 312, 2},
+    {U'\x017b', 314, 2},
+    {U'\x017c', 316, 2},
+    {U'\x017d', 318, 2},
+    {U'\x017e', 320, 2},
+    {U'\x01a0', 322, 2},
+    {U'\x01a1', 324, 2},
+    {U'\x01af', 326, 2},
+    {U'\x01b0', 328, 2},
+    {U'\x01cd', 330, 2},
+    {U'\x01ce', 332, 2},
+    {U'\x01cf', 334, 2},
+    {U'\x01d0', 336, 2},
+    {U'\x01d1', 338, 2},
+    {U'\x01d2', 340, 2},
+    {U'\x01d3', 342, 2},
+    {U'\x01d4', 344, 2},
+    {U'\x01d5', 346, 3},
+    {U'\x01d6', 349, 3},
+    {U'\x01d7', 352, 3},
+    {U'\x01d8', 355, 3},
+    {U'\x01d9', 358, 3},
+    {U'\x01da', 361, 3},
+    {U'\x01db', 364, 3},
+    {U'\x01dc', 367, 3},
+    {U'\x01de', 370, 3},
+    {U'\x01df', 373, 3},
+    {U'\x01e0', 376, 3},
+    {U'\x01e1', 379, 3},
+    {U'\x01e2', 382, 2},
+    {U'\x01e3', 384, 2},
+    {U'\x01e6', 386, 2},
+    {U'\x01e7', 388, 2},
+    {U'\x01e8', 390, 2},
+    {U'\x01e9', 392, 2},
+    {U'\x01ea', 394, 2},
+    {U'\x01eb', 396, 2},
+    {U'\x01ec', 398, 3},
+    {U'\x01ed', 401, 3},
+    {U'\x01ee', 404, 2},
+    {U'\x01ef', 406, 2},
+    {U'\x01f0', 408, 2},
+    {U'\x01f4', 410, 2},
+    {U'\x01f5', 412, 2},
+    {U'\x01f8', 414, 2},
+    {U'\x01f9', 416, 2},
+    {U'\x01fa', 418, 3},
+    {U'\x01fb', 421, 3},
+    {U'\x01fc', 424, 2},
+    {U'\x01fd', 426, 2},
+    {U'\x01fe', 428, 2},
+    {U'\x01ff', 430, 2},
+    {U'\x0200', 432, 2},
+    {U'\x0201', 434, 2},
+    {U'\x0202', 436, 2},
+    {U'\x0203', 438, 2},
+    {U'\x0204', 440, 2},
+    {U'\x0205', 442, 2},
+    {U'\x0206', 444, 2},
+    {U'\x0207', 446, 2},
+    {U'\x0208', 448, 2},
+    {U'\x0209', 450, 2},
+    {U'\x020a', 452, 2},
+    {U'\x020b', 454, 2},
+    {U'\x020c', 456, 2},
+    {U'\x020d', 458, 2},
+    {U'\x020e', 460, 2},
+    {U'\x020f', 462, 2},
+    {U'\x0210', 464, 2},
+    {U'\x0211', 466, 2},
+    {U'\x0212', 468, 2},
+    {U'\x0213', 470, 2},
+    {U'\x0214', 472, 2},
+    {U'\x0215', 474, 2},
+    {U'\x0216', 476, 2},
+    {U'\x0217', 478, 2},
+    {U'\x0218', 480, 2},
+    {U'\x0219', 482, 2},
+    {U'\x021a', 484, 2},
+    {U'\x021b', 486, 2},
+    {U'\x021e', 488, 2},
+    {U'\x021f', 490, 2},
+    {U'\x0226', 492, 2},
+    {U'\x0227', 494, 2},
+    {U'\x0228', 496, 2},
+    {U'\x0229', 498, 2},
+    {U'\x022a', 500, 3},
+    {U'\x022b', 503, 3},
+    {U'\x022c', 506, 3},
+    {U'\x022d', 509, 3},
+    {U'\x022e', 512, 2},
+    {U'\x022f', 514, 2},
+    {U'\x0230', 516, 3},
+    {U'\x0231', 519, 3},
+    {U'\x0232', 522, 2},
+    {U'\x0233', 524, 2},
+    {U'\x0340', 526, 1},
+    {U'\x0341', 527, 1},
+    {U'\x0343', 528, 1},
+    {U'\x0344', 529, 2},
+    {U'\x0374', 531, 1},
+    {U'\x037e', 532, 1},
+    {U'\x0385', 533, 2},
+    {U'\x0386', 535, 2},
+    {U'\x0387', 537, 1},
+    {U'\x0388', 538, 2},
+    {U'\x0389', 540, 2},
+    {U'\x038a', 542, 2},
+    {U'\x038c', 544, 2},
+    {U'\x038e', 546, 2},
+    {U'\x038f', 548, 2},
+    {U'\x0390', 550, 3},
+    {U'\x03aa', 553, 2},
+    {U'\x03ab', 555, 2},
+    {U'\x03ac', 557, 2},
+    {U'\x03ad', 559, 2},
+    {U'\x03ae', 561, 2},
+    {U'\x03af', 563, 2},
+    {U'\x03b0', 565, 3},
+    {U'\x03ca', 568, 2},
+    {U'\x03cb', 570, 2},
+    {U'\x03cc', 572, 2},
+    {U'\x03cd', 574, 2},
+    {U'\x03ce', 576, 2},
+    {U'\x03d3', 578, 2},
+    {U'\x03d4', 580, 2},
+    {U'\x0400', 582, 2},
+    {U'\x0401', 584, 2},
+    {U'\x0403', 586, 2},
+    {U'\x0407', 588, 2},
+    {U'\x040c', 590, 2},
+    {U'\x040d', 592, 2},
+    {U'\x040e', 594, 2},
+    {U'\x0419', 596, 2},
+    {U'\x0439', 598, 2},
+    {U'\x0450', 600, 2},
+    {U'\x0451', 602, 2},
+    {U'\x0453', 604, 2},
+    {U'\x0457', 606, 2},
+    {U'\x045c', 608, 2},
+    {U'\x045d', 610, 2},
+    {U'\x045e', 612, 2},
+    {U'\x0476', 614, 2},
+    {U'\x0477', 616, 2},
+    {U'\x04c1', 618, 2},
+    {U'\x04c2', 620, 2},
+    {U'\x04d0', 622, 2},
+    {U'\x04d1', 624, 2},
+    {U'\x04d2', 626, 2},
+    {U'\x04d3', 628, 2},
+    {U'\x04d6', 630, 2},
+    {U'\x04d7', 632, 2},
+    {U'\x04da', 634, 2},
+    {U'\x04db', 636, 2},
+    {U'\x04dc', 638, 2},
+    {U'\x04dd', 640, 2},
+    {U'\x04de', 642, 2},
+    {U'\x04df', 644, 2},
+    {U'\x04e2', 646, 2},
+    {U'\x04e3', 648, 2},
+    {U'\x04e4', 650, 2},
+    {U'\x04e5', 652, 2},
+    {U'\x04e6', 654, 2},
+    {U'\x04e7', 656, 2},
+    {U'\x04ea', 658, 2},
+    {U'\x04eb', 660, 2},
+    {U'\x04ec', 662, 2},
+    {U'\x04ed', 664, 2},
+    {U'\x04ee', 666, 2},
+    {U'\x04ef', 668, 2},
+    {U'\x04f0', 670, 2},
+    {U'\x04f1', 672, 2},
+    {U'\x04f2', 674, 2},
+    {U'\x04f3', 676, 2},
+    {U'\x04f4', 678, 2},
+    {U'\x04f5', 680, 2},
+    {U'\x04f8', 682, 2},
+    {U'\x04f9', 684, 2},
+    {U'\x0622', 686, 2},
+    {U'\x0623', 688, 2},
+    {U'\x0624', 690, 2},
+    {U'\x0625', 692, 2},
+    {U'\x0626', 694, 2},
+    {U'\x06c0', 696, 2},
+    {U'\x06c2', 698, 2},
+    {U'\x06d3', 700, 2},
+    {U'\x0929', 702, 2},
+    {U'\x0931', 704, 2},
+    {U'\x0934', 706, 2},
+    {U'\x0958', 708, 2},
+    {U'\x0959', 710, 2},
+    {U'\x095a', 712, 2},
+    {U'\x095b', 714, 2},
+    {U'\x095c', 716, 2},
+    {U'\x095d', 718, 2},
+    {U'\x095e', 720, 2},
+    {U'\x095f', 722, 2},
+    {U'\x09cb', 724, 2},
+    {U'\x09cc', 726, 2},
+    {U'\x09dc', 728, 2},
+    {U'\x09dd', 730, 2},
+    {U'\x09df', 732, 2},
+    {U'\x0a33', 734, 2},
+    {U'\x0a36', 736, 2},
+    {U'\x0a59', 738, 2},
+    {U'\x0a5a', 740, 2},
+    {U'\x0a5b', 742, 2},
+    {U'\x0a5e', 744, 2},
+    {U'\x0b48', 746, 2},
+    {U'\x0b4b', 748, 2},
+    {U'\x0b4c', 750, 2},
+    {U'\x0b5c', 752, 2},
+    {U'\x0b5d', 754, 2},
+    {U'\x0b94', 756, 2},
+    {U'\x0bca', 758, 2},
+    {U'\x0bcb', 760, 2},
+    {U'\x0bcc', 762, 2},
+    {U'\x0c48', 764, 2},
+    {U'\x0cc0', 766, 2},
+    {U'\x0cc7', 768, 2},
+    {U'\x0cc8', 770, 2},
+    {U'\x0cca', 772, 2},
+    {U'\x0ccb', 774, 3},
+    {U'\x0d4a', 777, 2},
+    {U'\x0d4b', 779, 2},
+    {U'\x0d4c', 781, 2},
+    {U'\x0dda', 783, 2},
+    {U'\x0ddc', 785, 2},
+    {U'\x0ddd', 787, 3},
+    {U'\x0dde', 790, 2},
+    {U'\x0f43', 792, 2},
+    {U'\x0f4d', 794, 2},
+    {U'\x0f52', 796, 2},
+    {U'\x0f57', 798, 2},
+    {U'\x0f5c', 800, 2},
+    {U'\x0f69', 802, 2},
+    {U'\x0f73', 804, 2},
+    {U'\x0f75', 806, 2},
+    {U'\x0f76', 808, 2},
+    {U'\x0f78', 810, 2},
+    {U'\x0f81', 812, 2},
+    {U'\x0f93', 814, 2},
+    {U'\x0f9d', 816, 2},
+    {U'\x0fa2', 818, 2},
+    {U'\x0fa7', 820, 2},
+    {U'\x0fac', 822, 2},
+    {U'\x0fb9', 824, 2},
+    {U'\x1026', 826, 2},
+    {U'\x1b06', 828, 2},
+    {U'\x1b08', 830, 2},
+    {U'\x1b0a', 832, 2},
+    {U'\x1b0c', 834, 2},
+    {U'\x1b0e', 836, 2},
+    {U'\x1b12', 838, 2},
+    {U'\x1b3b', 840, 2},
+    {U'\x1b3d', 842, 2},
+    {U'\x1b40', 844, 2},
+    {U'\x1b41', 846, 2},
+    {U'\x1b43', 848, 2},
+    {U'\x1e00', 850, 2},
+    {U'\x1e01', 852, 2},
+    {U'\x1e02', 854, 2},
+    {U'\x1e03', 856, 2},
+    {U'\x1e04', 858, 2},
+    {U'\x1e05', 860, 2},
+    {U'\x1e06', 862, 2},
+    {U'\x1e07', 864, 2},
+    {U'\x1e08', 866, 3},
+    {U'\x1e09', 869, 3},
+    {U'\x1e0a', 872, 2},
+    {U'\x1e0b', 874, 2},
+    {U'\x1e0c', 876, 2},
+    {U'\x1e0d', 878, 2},
+    {U'\x1e0e', 880, 2},
+    {U'\x1e0f', 882, 2},
+    {U'\x1e10', 884, 2},
+    {U'\x1e11', 886, 2},
+    {U'\x1e12', 888, 2},
+    {U'\x1e13', 890, 2},
+    {U'\x1e14', 892, 3},
+    {U'\x1e15', 895, 3},
+    {U'\x1e16', 898, 3},
+    {U'\x1e17', 901, 3},
+    {U'\x1e18', 904, 2},
+    {U'\x1e19', 906, 2},
+    {U'\x1e1a', 908, 2},
+    {U'\x1e1b', 910, 2},
+    {U'\x1e1c', 912, 3},
+    {U'\x1e1d', 915, 3},
+    {U'\x1e1e', 918, 2},
+    {U'\x1e1f', 920, 2},
+    {U'\x1e20', 922, 2},
+    {U'\x1e21', 924, 2},
+    {U'\x1e22', 926, 2},
+    {U'\x1e23', 928, 2},
+    {U'\x1e24', 930, 2},
+    {U'\x1e25', 932, 2},
+    {U'\x1e26', 934, 2},
+    {U'\x1e27', 936, 2},
+    {U'\x1e28', 938, 2},
+    {U'\x1e29', 940, 2},
+    {U'\x1e2a', 942, 2},
+    {U'\x1e2b', 944, 2},
+    {U'\x1e2c', 946, 2},
+    {U'\x1e2d', 948, 2},
+    {U'\x1e2e', 950, 3},
+    {U'\x1e2f', 953, 3},
+    {U'\x1e30', 956, 2},
+    {U'\x1e31', 958, 2},
+    {U'\x1e32', 960, 2},
+    {U'\x1e33', 962, 2},
+    {U'\x1e34', 964, 2},
+    {U'\x1e35', 966, 2},
+    {U'\x1e36', 968, 2},
+    {U'\x1e37', 970, 2},
+    {U'\x1e38', 972, 3},
+    {U'\x1e39', 975, 3},
+    {U'\x1e3a', 978, 2},
+    {U'\x1e3b', 980, 2},
+    {U'\x1e3c', 982, 2},
+    {U'\x1e3d', 984, 2},
+    {U'\x1e3e', 986, 2},
+    {U'\x1e3f', 988, 2},
+    {U'\x1e40', 990, 2},
+    {U'\x1e41', 992, 2},
+    {U'\x1e42', 994, 2},
+    {U'\x1e43', 996, 2},
+    {U'\x1e44', 998, 2},
+    {U'\x1e45', 1000, 2},
+    {U'\x1e46', 1002, 2},
+    {U'\x1e47', 1004, 2},
+    {U'\x1e48', 1006, 2},
+    {U'\x1e49', 1008, 2},
+    {U'\x1e4a', 1010, 2},
+    {U'\x1e4b', 1012, 2},
+    {U'\x1e4c', 1014, 3},
+    {U'\x1e4d', 1017, 3},
+    {U'\x1e4e', 1020, 3},
+    {U'\x1e4f', 1023, 3},
+    {U'\x1e50', 1026, 3},
+    {U'\x1e51', 1029, 3},
+    {U'\x1e52', 1032, 3},
+    {U'\x1e53', 1035, 3},
+    {U'\x1e54', 1038, 2},
+    {U'\x1e55', 1040, 2},
+    {U'\x1e56', 1042, 2},
+    {U'\x1e57', 1044, 2},
+    {U'\x1e58', 1046, 2},
+    {U'\x1e59', 1048, 2},
+    {U'\x1e5a', 1050, 2},
+    {U'\x1e5b', 1052, 2},
+    {U'\x1e5c', 1054, 3},
+    {U'\x1e5d', 1057, 3},
+    {U'\x1e5e', 1060, 2},
+    {U'\x1e5f', 1062, 2},
+    {U'\x1e60', 1064, 2},
+    {U'\x1e61', 1066, 2},
+    {U'\x1e62', 1068, 2},
+    {U'\x1e63', 1070, 2},
+    {U'\x1e64', 1072, 3},
+    {U'\x1e65', 1075, 3},
+    {U'\x1e66', 1078, 3},
+    {U'\x1e67', 1081, 3},
+    {U'\x1e68', 1084, 3},
+    {U'\x1e69', 1087, 3},
+    {U'\x1e6a', 1090, 2},
+    {U'\x1e6b', 1092, 2},
+    {U'\x1e6c', 1094, 2},
+    {U'\x1e6d', 1096, 2},
+    {U'\x1e6e', 1098, 2},
+    {U'\x1e6f', 1100, 2},
+    {U'\x1e70', 1102, 2},
+    {U'\x1e71', 1104, 2},
+    {U'\x1e72', 1106, 2},
+    {U'\x1e73', 1108, 2},
+    {U'\x1e74', 1110, 2},
+    {U'\x1e75', 1112, 2},
+    {U'\x1e76', 1114, 2},
+    {U'\x1e77', 1116, 2},
+    {U'\x1e78', 1118, 3},
+    {U'\x1e79', 1121, 3},
+    {U'\x1e7a', 1124, 3},
+    {U'\x1e7b', 1127, 3},
+    {U'\x1e7c', 1130, 2},
+    {U'\x1e7d', 1132, 2},
+    {U'\x1e7e', 1134, 2},
+    {U'\x1e7f', 1136, 2},
+    {U'\x1e80', 1138, 2},
+    {U'\x1e81', 1140, 2},
+    {U'\x1e82', 1142, 2},
+    {U'\x1e83', 1144, 2},
+    {U'\x1e84', 1146, 2},
+    {U'\x1e85', 1148, 2},
+    {U'\x1e86', 1150, 2},
+    {U'\x1e87', 1152, 2},
+    {U'\x1e88', 1154, 2},
+    {U'\x1e89', 1156, 2},
+    {U'\x1e8a', 1158, 2},
+    {U'\x1e8b', 1160, 2},
+    {U'\x1e8c', 1162, 2},
+    {U'\x1e8d', 1164, 2},
+    {U'\x1e8e', 1166, 2},
+    {U'\x1e8f', 1168, 2},
+    {U'\x1e90', 1170, 2},
+    {U'\x1e91', 1172, 2},
+    {U'\x1e92', 1174, 2},
+    {U'\x1e93', 1176, 2},
+    {U'\x1e94', 1178, 2},
+    {U'\x1e95', 1180, 2},
+    {U'\x1e96', 1182, 2},
+    {U'\x1e97', 1184, 2},
+    {U'\x1e98', 1186, 2},
+    {U'\x1e99', 1188, 2},
+    {U'\x1e9b', 1190, 2},
+    {U'\x1ea0', 1192, 2},
+    {U'\x1ea1', 1194, 2},
+    {U'\x1ea2', 1196, 2},
+    {U'\x1ea3', 1198, 2},
+    {U'\x1ea4', 1200, 3},
+    {U'\x1ea5', 1203, 3},
+    {U'\x1ea6', 1206, 3},
+    {U'\x1ea7', 1209, 3},
+    {U'\x1ea8', 1212, 3},
+    {U'\x1ea9', 1215, 3},
+    {U'\x1eaa', 1218, 3},
+    {U'\x1eab', 1221, 3},
+    {U'\x1eac', 1224, 3},
+    {U'\x1ead', 1227, 3},
+    {U'\x1eae', 1230, 3},
+    {U'\x1eaf', 1233, 3},
+    {U'\x1eb0', 1236, 3},
+    {U'\x1eb1', 1239, 3},
+    {U'\x1eb2', 1242, 3},
+    {U'\x1eb3', 1245, 3},
+    {U'\x1eb4', 1248, 3},
+    {U'\x1eb5', 1251, 3},
+    {U'\x1eb6', 1254, 3},
+    {U'\x1eb7', 1257, 3},
+    {U'\x1eb8', 1260, 2},
+    {U'\x1eb9', 1262, 2},
+    {U'\x1eba', 1264, 2},
+    {U'\x1ebb', 1266, 2},
+    {U'\x1ebc', 1268, 2},
+    {U'\x1ebd', 1270, 2},
+    {U'\x1ebe', 1272, 3},
+    {U'\x1ebf', 1275, 3},
+    {U'\x1ec0', 1278, 3},
+    {U'\x1ec1', 1281, 3},
+    {U'\x1ec2', 1284, 3},
+    {U'\x1ec3', 1287, 3},
+    {U'\x1ec4', 1290, 3},
+    {U'\x1ec5', 1293, 3},
+    {U'\x1ec6', 1296, 3},
+    {U'\x1ec7', 1299, 3},
+    {U'\x1ec8', 1302, 2},
+    {U'\x1ec9', 1304, 2},
+    {U'\x1eca', 1306, 2},
+    {U'\x1ecb', 1308, 2},
+    {U'\x1ecc', 1310, 2},
+    {U'\x1ecd', 1312, 2},
+    {U'\x1ece', 1314, 2},
+    {U'\x1ecf', 1316, 2},
+    {U'\x1ed0', 1318, 3},
+    {U'\x1ed1', 1321, 3},
+    {U'\x1ed2', 1324, 3},
+    {U'\x1ed3', 1327, 3},
+    {U'\x1ed4', 1330, 3},
+    {U'\x1ed5', 1333, 3},
+    {U'\x1ed6', 1336, 3},
+    {U'\x1ed7', 1339, 3},
+    {U'\x1ed8', 1342, 3},
+    {U'\x1ed9', 1345, 3},
+    {U'\x1eda', 1348, 3},
+    {U'\x1edb', 1351, 3},
+    {U'\x1edc', 1354, 3},
+    {U'\x1edd', 1357, 3},
+    {U'\x1ede', 1360, 3},
+    {U'\x1edf', 1363, 3},
+    {U'\x1ee0', 1366, 3},
+    {U'\x1ee1', 1369, 3},
+    {U'\x1ee2', 1372, 3},
+    {U'\x1ee3', 1375, 3},
+    {U'\x1ee4', 1378, 2},
+    {U'\x1ee5', 1380, 2},
+    {U'\x1ee6', 1382, 2},
+    {U'\x1ee7', 1384, 2},
+    {U'\x1ee8', 1386, 3},
+    {U'\x1ee9', 1389, 3},
+    {U'\x1eea', 1392, 3},
+    {U'\x1eeb', 1395, 3},
+    {U'\x1eec', 1398, 3},
+    {U'\x1eed', 1401, 3},
+    {U'\x1eee', 1404, 3},
+    {U'\x1eef', 1407, 3},
+    {U'\x1ef0', 1410, 3},
+    {U'\x1ef1', 1413, 3},
+    {U'\x1ef2', 1416, 2},
+    {U'\x1ef3', 1418, 2},
+    {U'\x1ef4', 1420, 2},
+    {U'\x1ef5', 1422, 2},
+    {U'\x1ef6', 1424, 2},
+    {U'\x1ef7', 1426, 2},
+    {U'\x1ef8', 1428, 2},
+    {U'\x1ef9', 1430, 2},
+    {U'\x1f00', 1432, 2},
+    {U'\x1f01', 1434, 2},
+    {U'\x1f02', 1436, 3},
+    {U'\x1f03', 1439, 3},
+    {U'\x1f04', 1442, 3},
+    {U'\x1f05', 1445, 3},
+    {U'\x1f06', 1448, 3},
+    {U'\x1f07', 1451, 3},
+    {U'\x1f08', 1454, 2},
+    {U'\x1f09', 1456, 2},
+    {U'\x1f0a', 1458, 3},
+    {U'\x1f0b', 1461, 3},
+    {U'\x1f0c', 1464, 3},
+    {U'\x1f0d', 1467, 3},
+    {U'\x1f0e', 1470, 3},
+    {U'\x1f0f', 1473, 3},
+    {U'\x1f10', 1476, 2},
+    {U'\x1f11', 1478, 2},
+    {U'\x1f12', 1480, 3},
+    {U'\x1f13', 1483, 3},
+    {U'\x1f14', 1486, 3},
+    {U'\x1f15', 1489, 3},
+    {U'\x1f18', 1492, 2},
+    {U'\x1f19', 1494, 2},
+    {U'\x1f1a', 1496, 3},
+    {U'\x1f1b', 1499, 3},
+    {U'\x1f1c', 1502, 3},
+    {U'\x1f1d', 1505, 3},
+    {U'\x1f20', 1508, 2},
+    {U'\x1f21', 1510, 2},
+    {U'\x1f22', 1512, 3},
+    {U'\x1f23', 1515, 3},
+    {U'\x1f24', 1518, 3},
+    {U'\x1f25', 1521, 3},
+    {U'\x1f26', 1524, 3},
+    {U'\x1f27', 1527, 3},
+    {U'\x1f28', 1530, 2},
+    {U'\x1f29', 1532, 2},
+    {U'\x1f2a', 1534, 3},
+    {U'\x1f2b', 1537, 3},
+    {U'\x1f2c', 1540, 3},
+    {U'\x1f2d', 1543, 3},
+    {U'\x1f2e', 1546, 3},
+    {U'\x1f2f', 1549, 3},
+    {U'\x1f30', 1552, 2},
+    {U'\x1f31', 1554, 2},
+    {U'\x1f32', 1556, 3},
+    {U'\x1f33', 1559, 3},
+    {U'\x1f34', 1562, 3},
+    {U'\x1f35', 1565, 3},
+    {U'\x1f36', 1568, 3},
+    {U'\x1f37', 1571, 3},
+    {U'\x1f38', 1574, 2},
+    {U'\x1f39', 1576, 2},
+    {U'\x1f3a', 1578, 3},
+    {U'\x1f3b', 1581, 3},
+    {U'\x1f3c', 1584, 3},
+    {U'\x1f3d', 1587, 3},
+    {U'\x1f3e', 1590, 3},
+    {U'\x1f3f', 1593, 3},
+    {U'\x1f40', 1596, 2},
+    {U'\x1f41', 1598, 2},
+    {U'\x1f42', 1600, 3},
+    {U'\x1f43', 1603, 3},
+    {U'\x1f44', 1606, 3},
+    {U'\x1f45', 1609, 3},
+    {U'\x1f48', 1612, 2},
+    {U'\x1f49', 1614, 2},
+    {U'\x1f4a', 1616, 3},
+    {U'\x1f4b', 1619, 3},
+    {U'\x1f4c', 1622, 3},
+    {U'\x1f4d', 1625, 3},
+    {U'\x1f50', 1628, 2},
+    {U'\x1f51', 1630, 2},
+    {U'\x1f52', 1632, 3},
+    {U'\x1f53', 1635, 3},
+    {U'\x1f54', 1638, 3},
+    {U'\x1f55', 1641, 3},
+    {U'\x1f56', 1644, 3},
+    {U'\x1f57', 1647, 3},
+    {U'\x1f59', 1650, 2},
+    {U'\x1f5b', 1652, 3},
+    {U'\x1f5d', 1655, 3},
+    {U'\x1f5f', 1658, 3},
+    {U'\x1f60', 1661, 2},
+    {U'\x1f61', 1663, 2},
+    {U'\x1f62', 1665, 3},
+    {U'\x1f63', 1668, 3},
+    {U'\x1f64', 1671, 3},
+    {U'\x1f65', 1674, 3},
+    {U'\x1f66', 1677, 3},
+    {U'\x1f67', 1680, 3},
+    {U'\x1f68', 1683, 2},
+    {U'\x1f69', 1685, 2},
+    {U'\x1f6a', 1687, 3},
+    {U'\x1f6b', 1690, 3},
+    {U'\x1f6c', 1693, 3},
+    {U'\x1f6d', 1696, 3},
+    {U'\x1f6e', 1699, 3},
+    {U'\x1f6f', 1702, 3},
+    {U'\x1f70', 1705, 2},
+    {U'\x1f71', 1707, 2},
+    {U'\x1f72', 1709, 2},
+    {U'\x1f73', 1711, 2},
+    {U'\x1f74', 1713, 2},
+    {U'\x1f75', 1715, 2},
+    {U'\x1f76', 1717, 2},
+    {U'\x1f77', 1719, 2},
+    {U'\x1f78', 1721, 2},
+    {U'\x1f79', 1723, 2},
+    {U'\x1f7a', 1725, 2},
+    {U'\x1f7b', 1727, 2},
+    {U'\x1f7c', 1729, 2},
+    {U'\x1f7d', 1731, 2},
+    {U'\x1f80', 1733, 3},
+    {U'\x1f81', 1736, 3},
+    {U'\x1f82', 1739, 4},
+    {U'\x1f83', 1743, 4},
+    {U'\x1f84', 1747, 4},
+    {U'\x1f85', 1751, 4},
+    {U'\x1f86', 1755, 4},
+    {U'\x1f87', 1759, 4},
+    {U'\x1f88', 1763, 3},
+    {U'\x1f89', 1766, 3},
+    {U'\x1f8a', 1769, 4},
+    {U'\x1f8b', 1773, 4},
+    {U'\x1f8c', 1777, 4},
+    {U'\x1f8d', 1781, 4},
+    {U'\x1f8e', 1785, 4},
+    {U'\x1f8f', 1789, 4},
+    {U'\x1f90', 1793, 3},
+    {U'\x1f91', 1796, 3},
+    {U'\x1f92', 1799, 4},
+    {U'\x1f93', 1803, 4},
+    {U'\x1f94', 1807, 4},
+    {U'\x1f95', 1811, 4},
+    {U'\x1f96', 1815, 4},
+    {U'\x1f97', 1819, 4},
+    {U'\x1f98', 1823, 3},
+    {U'\x1f99', 1826, 3},
+    {U'\x1f9a', 1829, 4},
+    {U'\x1f9b', 1833, 4},
+    {U'\x1f9c', 1837, 4},
+    {U'\x1f9d', 1841, 4},
+    {U'\x1f9e', 1845, 4},
+    {U'\x1f9f', 1849, 4},
+    {U'\x1fa0', 1853, 3},
+    {U'\x1fa1', 1856, 3},
+    {U'\x1fa2', 1859, 4},
+    {U'\x1fa3', 1863, 4},
+    {U'\x1fa4', 1867, 4},
+    {U'\x1fa5', 1871, 4},
+    {U'\x1fa6', 1875, 4},
+    {U'\x1fa7', 1879, 4},
+    {U'\x1fa8', 1883, 3},
+    {U'\x1fa9', 1886, 3},
+    {U'\x1faa', 1889, 4},
+    {U'\x1fab', 1893, 4},
+    {U'\x1fac', 1897, 4},
+    {U'\x1fad', 1901, 4},
+    {U'\x1fae', 1905, 4},
+    {U'\x1faf', 1909, 4},
+    {U'\x1fb0', 1913, 2},
+    {U'\x1fb1', 1915, 2},
+    {U'\x1fb2', 1917, 3},
+    {U'\x1fb3', 1920, 2},
+    {U'\x1fb4', 1922, 3},
+    {U'\x1fb6', 1925, 2},
+    {U'\x1fb7', 1927, 3},
+    {U'\x1fb8', 1930, 2},
+    {U'\x1fb9', 1932, 2},
+    {U'\x1fba', 1934, 2},
+    {U'\x1fbb', 1936, 2},
+    {U'\x1fbc', 1938, 2},
+    {U'\x1fbe', 1940, 1},
+    {U'\x1fc1', 1941, 2},
+    {U'\x1fc2', 1943, 3},
+    {U'\x1fc3', 1946, 2},
+    {U'\x1fc4', 1948, 3},
+    {U'\x1fc6', 1951, 2},
+    {U'\x1fc7', 1953, 3},
+    {U'\x1fc8', 1956, 2},
+    {U'\x1fc9', 1958, 2},
+    {U'\x1fca', 1960, 2},
+    {U'\x1fcb', 1962, 2},
+    {U'\x1fcc', 1964, 2},
+    {U'\x1fcd', 1966, 2},
+    {U'\x1fce', 1968, 2},
+    {U'\x1fcf', 1970, 2},
+    {U'\x1fd0', 1972, 2},
+    {U'\x1fd1', 1974, 2},
+    {U'\x1fd2', 1976, 3},
+    {U'\x1fd3', 1979, 3},
+    {U'\x1fd6', 1982, 2},
+    {U'\x1fd7', 1984, 3},
+    {U'\x1fd8', 1987, 2},
+    {U'\x1fd9', 1989, 2},
+    {U'\x1fda', 1991, 2},
+    {U'\x1fdb', 1993, 2},
+    {U'\x1fdd', 1995, 2},
+    {U'\x1fde', 1997, 2},
+    {U'\x1fdf', 1999, 2},
+    {U'\x1fe0', 2001, 2},
+    {U'\x1fe1', 2003, 2},
+    {U'\x1fe2', 2005, 3},
+    {U'\x1fe3', 2008, 3},
+    {U'\x1fe4', 2011, 2},
+    {U'\x1fe5', 2013, 2},
+    {U'\x1fe6', 2015, 2},
+    {U'\x1fe7', 2017, 3},
+    {U'\x1fe8', 2020, 2},
+    {U'\x1fe9', 2022, 2},
+    {U'\x1fea', 2024, 2},
+    {U'\x1feb', 2026, 2},
+    {U'\x1fec', 2028, 2},
+    {U'\x1fed', 2030, 2},
+    {U'\x1fee', 2032, 2},
+    {U'\x1fef', 2034, 1},
+    {U'\x1ff2', 2035, 3},
+    {U'\x1ff3', 2038, 2},
+    {U'\x1ff4', 2040, 3},
+    {U'\x1ff6', 2043, 2},
+    {U'\x1ff7', 2045, 3},
+    {U'\x1ff8', 2048, 2},
+    {U'\x1ff9', 2050, 2},
+    {U'\x1ffa', 2052, 2},
+    {U'\x1ffb', 2054, 2},
+    {U'\x1ffc', 2056, 2},
+    {U'\x1ffd', 2058, 1},
+    {U'\x2000', 2059, 1},
+    {U'\x2001', 2060, 1},
+    {U'\x2126', 2061, 1},
+    {U'\x212a', 2062, 1},
+    {U'\x212b', 2063, 2},
+    {U'\x219a', 2065, 2},
+    {U'\x219b', 2067, 2},
+    {U'\x21ae', 2069, 2},
+    {U'\x21cd', 2071, 2},
+    {U'\x21ce', 2073, 2},
+    {U'\x21cf', 2075, 2},
+    {U'\x2204', 2077, 2},
+    {U'\x2209', 2079, 2},
+    {U'\x220c', 2081, 2},
+    {U'\x2224', 2083, 2},
+    {U'\x2226', 2085, 2},
+    {U'\x2241', 2087, 2},
+    {U'\x2244', 2089, 2},
+    {U'\x2247', 2091, 2},
+    {U'\x2249', 2093, 2},
+    {U'\x2260', 2095, 2},
+    {U'\x2262', 2097, 2},
+    {U'\x226d', 2099, 2},
+    {U'\x226e', 2101, 2},
+    {U'\x226f', 2103, 2},
+    {U'\x2270', 2105, 2},
+    {U'\x2271', 2107, 2},
+    {U'\x2274', 2109, 2},
+    {U'\x2275', 2111, 2},
+    {U'\x2278', 2113, 2},
+    {U'\x2279', 2115, 2},
+    {U'\x2280', 2117, 2},
+    {U'\x2281', 2119, 2},
+    {U'\x2284', 2121, 2},
+    {U'\x2285', 2123, 2},
+    {U'\x2288', 2125, 2},
+    {U'\x2289', 2127, 2},
+    {U'\x22ac', 2129, 2},
+    {U'\x22ad', 2131, 2},
+    {U'\x22ae', 2133, 2},
+    {U'\x22af', 2135, 2},
+    {U'\x22e0', 2137, 2},
+    {U'\x22e1', 2139, 2},
+    {U'\x22e2', 2141, 2},
+    {U'\x22e3', 2143, 2},
+    {U'\x22ea', 2145, 2},
+    {U'\x22eb', 2147, 2},
+    {U'\x22ec', 2149, 2},
+    {U'\x22ed', 2151, 2},
+    {U'\x2329', 2153, 1},
+    {U'\x232a', 2154, 1},
+    {U'\x2adc', 2155, 2},
+    {U'\x304c', 2157, 2},
+    {U'\x304e', 2159, 2},
+    {U'\x3050', 2161, 2},
+    {U'\x3052', 2163, 2},
+    {U'\x3054', 2165, 2},
+    {U'\x3056', 2167, 2},
+    {U'\x3058', 2169, 2},
+    {U'\x305a', 2171, 2},
+    {U'\x305c', 2173, 2},
+    {U'\x305e', 2175, 2},
+    {U'\x3060', 2177, 2},
+    {U'\x3062', 2179, 2},
+    {U'\x3065', 2181, 2},
+    {U'\x3067', 2183, 2},
+    {U'\x3069', 2185, 2},
+    {U'\x3070', 2187, 2},
+    {U'\x3071', 2189, 2},
+    {U'\x3073', 2191, 2},
+    {U'\x3074', 2193, 2},
+    {U'\x3076', 2195, 2},
+    {U'\x3077', 2197, 2},
+    {U'\x3079', 2199, 2},
+    {U'\x307a', 2201, 2},
+    {U'\x307c', 2203, 2},
+    {U'\x307d', 2205, 2},
+    {U'\x3094', 2207, 2},
+    {U'\x309e', 2209, 2},
+    {U'\x30ac', 2211, 2},
+    {U'\x30ae', 2213, 2},
+    {U'\x30b0', 2215, 2},
+    {U'\x30b2', 2217, 2},
+    {U'\x30b4', 2219, 2},
+    {U'\x30b6', 2221, 2},
+    {U'\x30b8', 2223, 2},
+    {U'\x30ba', 2225, 2},
+    {U'\x30bc', 2227, 2},
+    {U'\x30be', 2229, 2},
+    {U'\x30c0', 2231, 2},
+    {U'\x30c2', 2233, 2},
+    {U'\x30c5', 2235, 2},
+    {U'\x30c7', 2237, 2},
+    {U'\x30c9', 2239, 2},
+    {U'\x30d0', 2241, 2},
+    {U'\x30d1', 2243, 2},
+    {U'\x30d3', 2245, 2},
+    {U'\x30d4', 2247, 2},
+    {U'\x30d6', 2249, 2},
+    {U'\x30d7', 2251, 2},
+    {U'\x30d9', 2253, 2},
+    {U'\x30da', 2255, 2},
+    {U'\x30dc', 2257, 2},
+    {U'\x30dd', 2259, 2},
+    {U'\x30f4', 2261, 2},
+    {U'\x30f7', 2263, 2},
+    {U'\x30f8', 2265, 2},
+    {U'\x30f9', 2267, 2},
+    {U'\x30fa', 2269, 2},
+    {U'\x30fe', 2271, 2},
+    {U'\xf900', 2273, 1},
+    {U'\xf901', 2274, 1},
+    {U'\xf902', 2275, 1},
+    {U'\xf903', 2276, 1},
+    {U'\xf904', 2277, 1},
+    {U'\xf905', 2278, 1},
+    {U'\xf906', 2279, 1},
+    {U'\xf907', 2280, 1},
+    {U'\xf908', 2281, 1},
+    {U'\xf909', 2282, 1},
+    {U'\xf90a', 2283, 1},
+    {U'\xf90b', 2284, 1},
+    {U'\xf90c', 2285, 1},
+    {U'\xf90d', 2286, 1},
+    {U'\xf90e', 2287, 1},
+    {U'\xf90f', 2288, 1},
+    {U'\xf910', 2289, 1},
+    {U'\xf911', 2290, 1},
+    {U'\xf912', 2291, 1},
+    {U'\xf913', 2292, 1},
+    {U'\xf914', 2293, 1},
+    {U'\xf915', 2294, 1},
+    {U'\xf916', 2295, 1},
+    {U'\xf917', 2296, 1},
+    {U'\xf918', 2297, 1},
+    {U'\xf919', 2298, 1},
+    {U'\xf91a', 2299, 1},
+    {U'\xf91b', 2300, 1},
+    {U'\xf91c', 2301, 1},
+    {U'\xf91d', 2302, 1},
+    {U'\xf91e', 2303, 1},
+    {U'\xf91f', 2304, 1},
+    {U'\xf920', 2305, 1},
+    {U'\xf921', 2306, 1},
+    {U'\xf922', 2307, 1},
+    {U'\xf923', 2308, 1},
+    {U'\xf924', 2309, 1},
+    {U'\xf925', 2310, 1},
+    {U'\xf926', 2311, 1},
+    {U'\xf927', 2312, 1},
+    {U'\xf928', 2313, 1},
+    {U'\xf929', 2314, 1},
+    {U'\xf92a', 2315, 1},
+    {U'\xf92b', 2316, 1},
+    {U'\xf92c', 2317, 1},
+    {U'\xf92d', 2318, 1},
+    {U'\xf92e', 2319, 1},
+    {U'\xf92f', 2320, 1},
+    {U'\xf930', 2321, 1},
+    {U'\xf931', 2322, 1},
+    {U'\xf932', 2323, 1},
+    {U'\xf933', 2324, 1},
+    {U'\xf934', 2325, 1},
+    {U'\xf935', 2326, 1},
+    {U'\xf936', 2327, 1},
+    {U'\xf937', 2328, 1},
+    {U'\xf938', 2329, 1},
+    {U'\xf939', 2330, 1},
+    {U'\xf93a', 2331, 1},
+    {U'\xf93b', 2332, 1},
+    {U'\xf93c', 2333, 1},
+    {U'\xf93d', 2334, 1},
+    {U'\xf93e', 2335, 1},
+    {U'\xf93f', 2336, 1},
+    {U'\xf940', 2337, 1},
+    {U'\xf941', 2338, 1},
+    {U'\xf942', 2339, 1},
+    {U'\xf943', 2340, 1},
+    {U'\xf944', 2341, 1},
+    {U'\xf945', 2342, 1},
+    {U'\xf946', 2343, 1},
+    {U'\xf947', 2344, 1},
+    {U'\xf948', 2345, 1},
+    {U'\xf949', 2346, 1},
+    {U'\xf94a', 2347, 1},
+    {U'\xf94b', 2348, 1},
+    {U'\xf94c', 2349, 1},
+    {U'\xf94d', 2350, 1},
+    {U'\xf94e', 2351, 1},
+    {U'\xf94f', 2352, 1},
+    {U'\xf950', 2353, 1},
+    {U'\xf951', 2354, 1},
+    {U'\xf952', 2355, 1},
+    {U'\xf953', 2356, 1},
+    {U'\xf954', 2357, 1},
+    {U'\xf955', 2358, 1},
+    {U'\xf956', 2359, 1},
+    {U'\xf957', 2360, 1},
+    {U'\xf958', 2361, 1},
+    {U'\xf959', 2362, 1},
+    {U'\xf95a', 2363, 1},
+    {U'\xf95b', 2364, 1},
+    {U'\xf95c', 2365, 1},
+    {U'\xf95d', 2366, 1},
+    {U'\xf95e', 2367, 1},
+    {U'\xf95f', 2368, 1},
+    {U'\xf960', 2369, 1},
+    {U'\xf961', 2370, 1},
+    {U'\xf962', 2371, 1},
+    {U'\xf963', 2372, 1},
+    {U'\xf964', 2373, 1},
+    {U'\xf965', 2374, 1},
+    {U'\xf966', 2375, 1},
+    {U'\xf967', 2376, 1},
+    {U'\xf968', 2377, 1},
+    {U'\xf969', 2378, 1},
+    {U'\xf96a', 2379, 1},
+    {U'\xf96b', 2380, 1},
+    {U'\xf96c', 2381, 1},
+    {U'\xf96d', 2382, 1},
+    {U'\xf96e', 2383, 1},
+    {U'\xf96f', 2384, 1},
+    {U'\xf970', 2385, 1},
+    {U'\xf971', 2386, 1},
+    {U'\xf972', 2387, 1},
+    {U'\xf973', 2388, 1},
+    {U'\xf974', 2389, 1},
+    {U'\xf975', 2390, 1},
+    {U'\xf976', 2391, 1},
+    {U'\xf977', 2392, 1},
+    {U'\xf978', 2393, 1},
+    {U'\xf979', 2394, 1},
+    {U'\xf97a', 2395, 1},
+    {U'\xf97b', 2396, 1},
+    {U'\xf97c', 2397, 1},
+    {U'\xf97d', 2398, 1},
+    {U'\xf97e', 2399, 1},
+    {U'\xf97f', 2400, 1},
+    {U'\xf980', 2401, 1},
+    {U'\xf981', 2402, 1},
+    {U'\xf982', 2403, 1},
+    {U'\xf983', 2404, 1},
+    {U'\xf984', 2405, 1},
+    {U'\xf985', 2406, 1},
+    {U'\xf986', 2407, 1},
+    {U'\xf987', 2408, 1},
+    {U'\xf988', 2409, 1},
+    {U'\xf989', 2410, 1},
+    {U'\xf98a', 2411, 1},
+    {U'\xf98b', 2412, 1},
+    {U'\xf98c', 2413, 1},
+    {U'\xf98d', 2414, 1},
+    {U'\xf98e', 2415, 1},
+    {U'\xf98f', 2416, 1},
+    {U'\xf990', 2417, 1},
+    {U'\xf991', 2418, 1},
+    {U'\xf992', 2419, 1},
+    {U'\xf993', 2420, 1},
+    {U'\xf994', 2421, 1},
+    {U'\xf995', 2422, 1},
+    {U'\xf996', 2423, 1},
+    {U'\xf997', 2424, 1},
+    {U'\xf998', 2425, 1},
+    {U'\xf999', 2426, 1},
+    {U'\xf99a', 2427, 1},
+    {U'\xf99b', 2428, 1},
+    {U'\xf99c', 2429, 1},
+    {U'\xf99d', 2430, 1},
+    {U'\xf99e', 2431, 1},
+    {U'\xf99f', 2432, 1},
+    {U'\xf9a0', 2433, 1},
+    {U'\xf9a1', 2434, 1},
+    {U'\xf9a2', 2435, 1},
+    {U'\xf9a3', 2436, 1},
+    {U'\xf9a4', 2437, 1},
+    {U'\xf9a5', 2438, 1},
+    {U'\xf9a6', 2439, 1},
+    {U'\xf9a7', 2440, 1},
+    {U'\xf9a8', 2441, 1},
+    {U'\xf9a9', 2442, 1},
+    {U'\xf9aa', 2443, 1},
+    {U'\xf9ab', 2444, 1},
+    {U'\xf9ac', 2445, 1},
+    {U'\xf9ad', 2446, 1},
+    {U'\xf9ae', 2447, 1},
+    {U'\xf9af', 2448, 1},
+    {U'\xf9b0', 2449, 1},
+    {U'\xf9b1', 2450, 1},
+    {U'\xf9b2', 2451, 1},
+    {U'\xf9b3', 2452, 1},
+    {U'\xf9b4', 2453, 1},
+    {U'\xf9b5', 2454, 1},
+    {U'\xf9b6', 2455, 1},
+    {U'\xf9b7', 2456, 1},
+    {U'\xf9b8', 2457, 1},
+    {U'\xf9b9', 2458, 1},
+    {U'\xf9ba', 2459, 1},
+    {U'\xf9bb', 2460, 1},
+    {U'\xf9bc', 2461, 1},
+    {U'\xf9bd', 2462, 1},
+    {U'\xf9be', 2463, 1},
+    {U'\xf9bf', 2464, 1},
+    {U'\xf9c0', 2465, 1},
+    {U'\xf9c1', 2466, 1},
+    {U'\xf9c2', 2467, 1},
+    {U'\xf9c3', 2468, 1},
+    {U'\xf9c4', 2469, 1},
+    {U'\xf9c5', 2470, 1},
+    {U'\xf9c6', 2471, 1},
+    {U'\xf9c7', 2472, 1},
+    {U'\xf9c8', 2473, 1},
+    {U'\xf9c9', 2474, 1},
+    {U'\xf9ca', 2475, 1},
+    {U'\xf9cb', 2476, 1},
+    {U'\xf9cc', 2477, 1},
+    {U'\xf9cd', 2478, 1},
+    {U'\xf9ce', 2479, 1},
+    {U'\xf9cf', 2480, 1},
+    {U'\xf9d0', 2481, 1},
+    {U'\xf9d1', 2482, 1},
+    {U'\xf9d2', 2483, 1},
+    {U'\xf9d3', 2484, 1},
+    {U'\xf9d4', 2485, 1},
+    {U'\xf9d5', 2486, 1},
+    {U'\xf9d6', 2487, 1},
+    {U'\xf9d7', 2488, 1},
+    {U'\xf9d8', 2489, 1},
+    {U'\xf9d9', 2490, 1},
+    {U'\xf9da', 2491, 1},
+    {U'\xf9db', 2492, 1},
+    {U'\xf9dc', 2493, 1},
+    {U'\xf9dd', 2494, 1},
+    {U'\xf9de', 2495, 1},
+    {U'\xf9df', 2496, 1},
+    {U'\xf9e0', 2497, 1},
+    {U'\xf9e1', 2498, 1},
+    {U'\xf9e2', 2499, 1},
+    {U'\xf9e3', 2500, 1},
+    {U'\xf9e4', 2501, 1},
+    {U'\xf9e5', 2502, 1},
+    {U'\xf9e6', 2503, 1},
+    {U'\xf9e7', 2504, 1},
+    {U'\xf9e8', 2505, 1},
+    {U'\xf9e9', 2506, 1},
+    {U'\xf9ea', 2507, 1},
+    {U'\xf9eb', 2508, 1},
+    {U'\xf9ec', 2509, 1},
+    {U'\xf9ed', 2510, 1},
+    {U'\xf9ee', 2511, 1},
+    {U'\xf9ef', 2512, 1},
+    {U'\xf9f0', 2513, 1},
+    {U'\xf9f1', 2514, 1},
+    {U'\xf9f2', 2515, 1},
+    {U'\xf9f3', 2516, 1},
+    {U'\xf9f4', 2517, 1},
+    {U'\xf9f5', 2518, 1},
+    {U'\xf9f6', 2519, 1},
+    {U'\xf9f7', 2520, 1},
+    {U'\xf9f8', 2521, 1},
+    {U'\xf9f9', 2522, 1},
+    {U'\xf9fa', 2523, 1},
+    {U'\xf9fb', 2524, 1},
+    {U'\xf9fc', 2525, 1},
+    {U'\xf9fd', 2526, 1},
+    {U'\xf9fe', 2527, 1},
+    {U'\xf9ff', 2528, 1},
+    {U'\xfa00', 2529, 1},
+    {U'\xfa01', 2530, 1},
+    {U'\xfa02', 2531, 1},
+    {U'\xfa03', 2532, 1},
+    {U'\xfa04', 2533, 1},
+    {U'\xfa05', 2534, 1},
+    {U'\xfa06', 2535, 1},
+    {U'\xfa07', 2536, 1},
+    {U'\xfa08', 2537, 1},
+    {U'\xfa09', 2538, 1},
+    {U'\xfa0a', 2539, 1},
+    {U'\xfa0b', 2540, 1},
+    {U'\xfa0c', 2541, 1},
+    {U'\xfa0d', 2542, 1},
+    {U'\xfa10', 2543, 1},
+    {U'\xfa12', 2544, 1},
+    {U'\xfa15', 2545, 1},
+    {U'\xfa16', 2546, 1},
+    {U'\xfa17', 2547, 1},
+    {U'\xfa18', 2548, 1},
+    {U'\xfa19', 2549, 1},
+    {U'\xfa1a', 2550, 1},
+    {U'\xfa1b', 2551, 1},
+    {U'\xfa1c', 2552, 1},
+    {U'\xfa1d', 2553, 1},
+    {U'\xfa1e', 2554, 1},
+    {U'\xfa20', 2555, 1},
+    {U'\xfa22', 2556, 1},
+    {U'\xfa25', 2557, 1},
+    {U'\xfa26', 2558, 1},
+    {U'\xfa2a', 2559, 1},
+    {U'\xfa2b', 2560, 1},
+    {U'\xfa2c', 2561, 1},
+    {U'\xfa2d', 2562, 1},
+    {U'\xfa2e', 2563, 1},
+    {U'\xfa2f', 2564, 1},
+    {U'\xfa30', 2565, 1},
+    {U'\xfa31', 2566, 1},
+    {U'\xfa32', 2567, 1},
+    {U'\xfa33', 2568, 1},
+    {U'\xfa34', 2569, 1},
+    {U'\xfa35', 2570, 1},
+    {U'\xfa36', 2571, 1},
+    {U'\xfa37', 2572, 1},
+    {U'\xfa38', 2573, 1},
+    {U'\xfa39', 2574, 1},
+    {U'\xfa3a', 2575, 1},
+    {U'\xfa3b', 2576, 1},
+    {U'\xfa3c', 2577, 1},
+    {U'\xfa3d', 2578, 1},
+    {U'\xfa3e', 2579, 1},
+    {U'\xfa3f', 2580, 1},
+    {U'\xfa40', 2581, 1},
+    {U'\xfa41', 2582, 1},
+    {U'\xfa42', 2583, 1},
+    {U'\xfa43', 2584, 1},
+    {U'\xfa44', 2585, 1},
+    {U'\xfa45', 2586, 1},
+    {U'\xfa46', 2587, 1},
+    {U'\xfa47', 2588, 1},
+    {U'\xfa48', 2589, 1},
+    {U'\xfa49', 2590, 1},
+    {U'\xfa4a', 2591, 1},
+    {U'\xfa4b', 2592, 1},
+    {U'\xfa4c', 2593, 1},
+    {U'\xfa4d', 2594, 1},
+    {U'\xfa4e', 2595, 1},
+    {U'\xfa4f', 2596, 1},
+    {U'\xfa50', 2597, 1},
+    {U'\xfa51', 2598, 1},
+    {U'\xfa52', 2599, 1},
+    {U'\xfa53', 2600, 1},
+    {U'\xfa54', 2601, 1},
+    {U'\xfa55', 2602, 1},
+    {U'\xfa56', 2603, 1},
+    {U'\xfa57', 2604, 1},
+    {U'\xfa58', 2605, 1},
+    {U'\xfa59', 2606, 1},
+    {U'\xfa5a', 2607, 1},
+    {U'\xfa5b', 2608, 1},
+    {U'\xfa5c', 2609, 1},
+    {U'\xfa5d', 2610, 1},
+    {U'\xfa5e', 2611, 1},
+    {U'\xfa5f', 2612, 1},
+    {U'\xfa60', 2613, 1},
+    {U'\xfa61', 2614, 1},
+    {U'\xfa62', 2615, 1},
+    {U'\xfa63', 2616, 1},
+    {U'\xfa64', 2617, 1},
+    {U'\xfa65', 2618, 1},
+    {U'\xfa66', 2619, 1},
+    {U'\xfa67', 2620, 1},
+    {U'\xfa68', 2621, 1},
+    {U'\xfa69', 2622, 1},
+    {U'\xfa6a', 2623, 1},
+    {U'\xfa6b', 2624, 1},
+    {U'\xfa6c', 2625, 1},
+    {U'\xfa6d', 2626, 1},
+    {U'\xfa70', 2627, 1},
+    {U'\xfa71', 2628, 1},
+    {U'\xfa72', 2629, 1},
+    {U'\xfa73', 2630, 1},
+    {U'\xfa74', 2631, 1},
+    {U'\xfa75', 2632, 1},
+    {U'\xfa76', 2633, 1},
+    {U'\xfa77', 2634, 1},
+    {U'\xfa78', 2635, 1},
+    {U'\xfa79', 2636, 1},
+    {U'\xfa7a', 2637, 1},
+    {U'\xfa7b', 2638, 1},
+    {U'\xfa7c', 2639, 1},
+    {U'\xfa7d', 2640, 1},
+    {U'\xfa7e', 2641, 1},
+    {U'\xfa7f', 2642, 1},
+    {U'\xfa80', 2643, 1},
+    {U'\xfa81', 2644, 1},
+    {U'\xfa82', 2645, 1},
+    {U'\xfa83', 2646, 1},
+    {U'\xfa84', 2647, 1},
+    {U'\xfa85', 2648, 1},
+    {U'\xfa86', 2649, 1},
+    {U'\xfa87', 2650, 1},
+    {U'\xfa88', 2651, 1},
+    {U'\xfa89', 2652, 1},
+    {U'\xfa8a', 2653, 1},
+    {U'\xfa8b', 2654, 1},
+    {U'\xfa8c', 2655, 1},
+    {U'\xfa8d', 2656, 1},
+    {U'\xfa8e', 2657, 1},
+    {U'\xfa8f', 2658, 1},
+    {U'\xfa90', 2659, 1},
+    {U'\xfa91', 2660, 1},
+    {U'\xfa92', 2661, 1},
+    {U'\xfa93', 2662, 1},
+    {U'\xfa94', 2663, 1},
+    {U'\xfa95', 2664, 1},
+    {U'\xfa96', 2665, 1},
+    {U'\xfa97', 2666, 1},
+    {U'\xfa98', 2667, 1},
+    {U'\xfa99', 2668, 1},
+    {U'\xfa9a', 2669, 1},
+    {U'\xfa9b', 2670, 1},
+    {U'\xfa9c', 2671, 1},
+    {U'\xfa9d', 2672, 1},
+    {U'\xfa9e', 2673, 1},
+    {U'\xfa9f', 2674, 1},
+    {U'\xfaa0', 2675, 1},
+    {U'\xfaa1', 2676, 1},
+    {U'\xfaa2', 2677, 1},
+    {U'\xfaa3', 2678, 1},
+    {U'\xfaa4', 2679, 1},
+    {U'\xfaa5', 2680, 1},
+    {U'\xfaa6', 2681, 1},
+    {U'\xfaa7', 2682, 1},
+    {U'\xfaa8', 2683, 1},
+    {U'\xfaa9', 2684, 1},
+    {U'\xfaaa', 2685, 1},
+    {U'\xfaab', 2686, 1},
+    {U'\xfaac', 2687, 1},
+    {U'\xfaad', 2688, 1},
+    {U'\xfaae', 2689, 1},
+    {U'\xfaaf', 2690, 1},
+    {U'\xfab0', 2691, 1},
+    {U'\xfab1', 2692, 1},
+    {U'\xfab2', 2693, 1},
+    {U'\xfab3', 2694, 1},
+    {U'\xfab4', 2695, 1},
+    {U'\xfab5', 2696, 1},
+    {U'\xfab6', 2697, 1},
+    {U'\xfab7', 2698, 1},
+    {U'\xfab8', 2699, 1},
+    {U'\xfab9', 2700, 1},
+    {U'\xfaba', 2701, 1},
+    {U'\xfabb', 2702, 1},
+    {U'\xfabc', 2703, 1},
+    {U'\xfabd', 2704, 1},
+    {U'\xfabe', 2705, 1},
+    {U'\xfabf', 2706, 1},
+    {U'\xfac0', 2707, 1},
+    {U'\xfac1', 2708, 1},
+    {U'\xfac2', 2709, 1},
+    {U'\xfac3', 2710, 1},
+    {U'\xfac4', 2711, 1},
+    {U'\xfac5', 2712, 1},
+    {U'\xfac6', 2713, 1},
+    {U'\xfac7', 2714, 1},
+    {U'\xfac8', 2715, 1},
+    {U'\xfac9', 2716, 1},
+    {U'\xfaca', 2717, 1},
+    {U'\xfacb', 2718, 1},
+    {U'\xfacc', 2719, 1},
+    {U'\xfacd', 2720, 1},
+    {U'\xface', 2721, 1},
+    {U'\xfacf', 2722, 1},
+    {U'\xfad0', 2723, 1},
+    {U'\xfad1', 2724, 1},
+    {U'\xfad2', 2725, 1},
+    {U'\xfad3', 2726, 1},
+    {U'\xfad4', 2727, 1},
+    {U'\xfad5', 2728, 1},
+    {U'\xfad6', 2729, 1},
+    {U'\xfad7', 2730, 1},
+    {U'\xfad8', 2731, 1},
+    {U'\xfad9', 2732, 1},
+    {U'\xfb1d', 2733, 2},
+    {U'\xfb1f', 2735, 2},
+    {U'\xfb2a', 2737, 2},
+    {U'\xfb2b', 2739, 2},
+    {U'\xfb2c', 2741, 3},
+    {U'\xfb2d', 2744, 3},
+    {U'\xfb2e', 2747, 2},
+    {U'\xfb2f', 2749, 2},
+    {U'\xfb30', 2751, 2},
+    {U'\xfb31', 2753, 2},
+    {U'\xfb32', 2755, 2},
+    {U'\xfb33', 2757, 2},
+    {U'\xfb34', 2759, 2},
+    {U'\xfb35', 2761, 2},
+    {U'\xfb36', 2763, 2},
+    {U'\xfb38', 2765, 2},
+    {U'\xfb39', 2767, 2},
+    {U'\xfb3a', 2769, 2},
+    {U'\xfb3b', 2771, 2},
+    {U'\xfb3c', 2773, 2},
+    {U'\xfb3e', 2775, 2},
+    {U'\xfb40', 2777, 2},
+    {U'\xfb41', 2779, 2},
+    {U'\xfb43', 2781, 2},
+    {U'\xfb44', 2783, 2},
+    {U'\xfb46', 2785, 2},
+    {U'\xfb47', 2787, 2},
+    {U'\xfb48', 2789, 2},
+    {U'\xfb49', 2791, 2},
+    {U'\xfb4a', 2793, 2},
+    {U'\xfb4b', 2795, 2},
+    {U'\xfb4c', 2797, 2},
+    {U'\xfb4d', 2799, 2},
+    {U'\xfb4e', 2801, 2},
+    {U'\x1109a', 2803, 2},
+    {U'\x1109c', 2805, 2},
+    {U'\x110ab', 2807, 2},
+    {U'\x1112e', 2809, 2},
+    {U'\x1112f', 2811, 2},
+    {U'\x1134b', 2813, 2},
+    {U'\x1134c', 2815, 2},
+    {U'\x114bb', 2817, 2},
+    {U'\x114bc', 2819, 2},
+    {U'\x114be', 2821, 2},
+    {U'\x115ba', 2823, 2},
+    {U'\x115bb', 2825, 2},
+    {U'\x11938', 2827, 2},
+    {U'\x1d15e', 2829, 2},
+    {U'\x1d15f', 2831, 2},
+    {U'\x1d160', 2833, 3},
+    {U'\x1d161', 2836, 3},
+    {U'\x1d162', 2839, 3},
+    {U'\x1d163', 2842, 3},
+    {U'\x1d164', 2845, 3},
+    {U'\x1d1bb', 2848, 2},
+    {U'\x1d1bc', 2850, 2},
+    {U'\x1d1bd', 2852, 3},
+    {U'\x1d1be', 2855, 3},
+    {U'\x1d1bf', 2858, 3},
+    {U'\x1d1c0', 2861, 3},
+    {U'\x2f800', 2864, 1},
+    {U'\x2f801', 2865, 1},
+    {U'\x2f802', 2866, 1},
+    {U'\x2f803', 2867, 1},
+    {U'\x2f804', 2868, 1},
+    {U'\x2f805', 2869, 1},
+    {U'\x2f806', 2870, 1},
+    {U'\x2f807', 2871, 1},
+    {U'\x2f808', 2872, 1},
+    {U'\x2f809', 2873, 1},
+    {U'\x2f80a', 2874, 1},
+    {U'\x2f80b', 2875, 1},
+    {U'\x2f80c', 2876, 1},
+    {U'\x2f80d', 2877, 1},
+    {U'\x2f80e', 2878, 1},
+    {U'\x2f80f', 2879, 1},
+    {U'\x2f810', 2880, 1},
+    {U'\x2f811', 2881, 1},
+    {U'\x2f812', 2882, 1},
+    {U'\x2f813', 2883, 1},
+    {U'\x2f814', 2884, 1},
+    {U'\x2f815', 2885, 1},
+    {U'\x2f816', 2886, 1},
+    {U'\x2f817', 2887, 1},
+    {U'\x2f818', 2888, 1},
+    {U'\x2f819', 2889, 1},
+    {U'\x2f81a', 2890, 1},
+    {U'\x2f81b', 2891, 1},
+    {U'\x2f81c', 2892, 1},
+    {U'\x2f81d', 2893, 1},
+    {U'\x2f81e', 2894, 1},
+    {U'\x2f81f', 2895, 1},
+    {U'\x2f820', 2896, 1},
+    {U'\x2f821', 2897, 1},
+    {U'\x2f822', 2898, 1},
+    {U'\x2f823', 2899, 1},
+    {U'\x2f824', 2900, 1},
+    {U'\x2f825', 2901, 1},
+    {U'\x2f826', 2902, 1},
+    {U'\x2f827', 2903, 1},
+    {U'\x2f828', 2904, 1},
+    {U'\x2f829', 2905, 1},
+    {U'\x2f82a', 2906, 1},
+    {U'\x2f82b', 2907, 1},
+    {U'\x2f82c', 2908, 1},
+    {U'\x2f82d', 2909, 1},
+    {U'\x2f82e', 2910, 1},
+    {U'\x2f82f', 2911, 1},
+    {U'\x2f830', 2912, 1},
+    {U'\x2f831', 2913, 1},
+    {U'\x2f832', 2914, 1},
+    {U'\x2f833', 2915, 1},
+    {U'\x2f834', 2916, 1},
+    {U'\x2f835', 2917, 1},
+    {U'\x2f836', 2918, 1},
+    {U'\x2f837', 2919, 1},
+    {U'\x2f838', 2920, 1},
+    {U'\x2f839', 2921, 1},
+    {U'\x2f83a', 2922, 1},
+    {U'\x2f83b', 2923, 1},
+    {U'\x2f83c', 2924, 1},
+    {U'\x2f83d', 2925, 1},
+    {U'\x2f83e', 2926, 1},
+    {U'\x2f83f', 2927, 1},
+    {U'\x2f840', 2928, 1},
+    {U'\x2f841', 2929, 1},
+    {U'\x2f842', 2930, 1},
+    {U'\x2f843', 2931, 1},
+    {U'\x2f844', 2932, 1},
+    {U'\x2f845', 2933, 1},
+    {U'\x2f846', 2934, 1},
+    {U'\x2f847', 2935, 1},
+    {U'\x2f848', 2936, 1},
+    {U'\x2f849', 2937, 1},
+    {U'\x2f84a', 2938, 1},
+    {U'\x2f84b', 2939, 1},
+    {U'\x2f84c', 2940, 1},
+    {U'\x2f84d', 2941, 1},
+    {U'\x2f84e', 2942, 1},
+    {U'\x2f84f', 2943, 1},
+    {U'\x2f850', 2944, 1},
+    {U'\x2f851', 2945, 1},
+    {U'\x2f852', 2946, 1},
+    {U'\x2f853', 2947, 1},
+    {U'\x2f854', 2948, 1},
+    {U'\x2f855', 2949, 1},
+    {U'\x2f856', 2950, 1},
+    {U'\x2f857', 2951, 1},
+    {U'\x2f858', 2952, 1},
+    {U'\x2f859', 2953, 1},
+    {U'\x2f85a', 2954, 1},
+    {U'\x2f85b', 2955, 1},
+    {U'\x2f85c', 2956, 1},
+    {U'\x2f85d', 2957, 1},
+    {U'\x2f85e', 2958, 1},
+    {U'\x2f85f', 2959, 1},
+    {U'\x2f860', 2960, 1},
+    {U'\x2f861', 2961, 1},
+    {U'\x2f862', 2962, 1},
+    {U'\x2f863', 2963, 1},
+    {U'\x2f864', 2964, 1},
+    {U'\x2f865', 2965, 1},
+    {U'\x2f866', 2966, 1},
+    {U'\x2f867', 2967, 1},
+    {U'\x2f868', 2968, 1},
+    {U'\x2f869', 2969, 1},
+    {U'\x2f86a', 2970, 1},
+    {U'\x2f86b', 2971, 1},
+    {U'\x2f86c', 2972, 1},
+    {U'\x2f86d', 2973, 1},
+    {U'\x2f86e', 2974, 1},
+    {U'\x2f86f', 2975, 1},
+    {U'\x2f870', 2976, 1},
+    {U'\x2f871', 2977, 1},
+    {U'\x2f872', 2978, 1},
+    {U'\x2f873', 2979, 1},
+    {U'\x2f874', 2980, 1},
+    {U'\x2f875', 2981, 1},
+    {U'\x2f876', 2982, 1},
+    {U'\x2f877', 2983, 1},
+    {U'\x2f878', 2984, 1},
+    {U'\x2f879', 2985, 1},
+    {U'\x2f87a', 2986, 1},
+    {U'\x2f87b', 2987, 1},
+    {U'\x2f87c', 2988, 1},
+    {U'\x2f87d', 2989, 1},
+    {U'\x2f87e', 2990, 1},
+    {U'\x2f87f', 2991, 1},
+    {U'\x2f880', 2992, 1},
+    {U'\x2f881', 2993, 1},
+    {U'\x2f882', 2994, 1},
+    {U'\x2f883', 2995, 1},
+    {U'\x2f884', 2996, 1},
+    {U'\x2f885', 2997, 1},
+    {U'\x2f886', 2998, 1},
+    {U'\x2f887', 2999, 1},
+    {U'\x2f888', 3000, 1},
+    {U'\x2f889', 3001, 1},
+    {U'\x2f88a', 3002, 1},
+    {U'\x2f88b', 3003, 1},
+    {U'\x2f88c', 3004, 1},
+    {U'\x2f88d', 3005, 1},
+    {U'\x2f88e', 3006, 1},
+    {U'\x2f88f', 3007, 1},
+    {U'\x2f890', 3008, 1},
+    {U'\x2f891', 3009, 1},
+    {U'\x2f892', 3010, 1},
+    {U'\x2f893', 3011, 1},
+    {U'\x2f894', 3012, 1},
+    {U'\x2f895', 3013, 1},
+    {U'\x2f896', 3014, 1},
+    {U'\x2f897', 3015, 1},
+    {U'\x2f898', 3016, 1},
+    {U'\x2f899', 3017, 1},
+    {U'\x2f89a', 3018, 1},
+    {U'\x2f89b', 3019, 1},
+    {U'\x2f89c', 3020, 1},
+    {U'\x2f89d', 3021, 1},
+    {U'\x2f89e', 3022, 1},
+    {U'\x2f89f', 3023, 1},
+    {U'\x2f8a0', 3024, 1},
+    {U'\x2f8a1', 3025, 1},
+    {U'\x2f8a2', 3026, 1},
+    {U'\x2f8a3', 3027, 1},
+    {U'\x2f8a4', 3028, 1},
+    {U'\x2f8a5', 3029, 1},
+    {U'\x2f8a6', 3030, 1},
+    {U'\x2f8a7', 3031, 1},
+    {U'\x2f8a8', 3032, 1},
+    {U'\x2f8a9', 3033, 1},
+    {U'\x2f8aa', 3034, 1},
+    {U'\x2f8ab', 3035, 1},
+    {U'\x2f8ac', 3036, 1},
+    {U'\x2f8ad', 3037, 1},
+    {U'\x2f8ae', 3038, 1},
+    {U'\x2f8af', 3039, 1},
+    {U'\x2f8b0', 3040, 1},
+    {U'\x2f8b1', 3041, 1},
+    {U'\x2f8b2', 3042, 1},
+    {U'\x2f8b3', 3043, 1},
+    {U'\x2f8b4', 3044, 1},
+    {U'\x2f8b5', 3045, 1},
+    {U'\x2f8b6', 3046, 1},
+    {U'\x2f8b7', 3047, 1},
+    {U'\x2f8b8', 3048, 1},
+    {U'\x2f8b9', 3049, 1},
+    {U'\x2f8ba', 3050, 1},
+    {U'\x2f8bb', 3051, 1},
+    {U'\x2f8bc', 3052, 1},
+    {U'\x2f8bd', 3053, 1},
+    {U'\x2f8be', 3054, 1},
+    {U'\x2f8bf', 3055, 1},
+    {U'\x2f8c0', 3056, 1},
+    {U'\x2f8c1', 3057, 1},
+    {U'\x2f8c2', 3058, 1},
+    {U'\x2f8c3', 3059, 1},
+    {U'\x2f8c4', 3060, 1},
+    {U'\x2f8c5', 3061, 1},
+    {U'\x2f8c6', 3062, 1},
+    {U'\x2f8c7', 3063, 1},
+    {U'\x2f8c8', 3064, 1},
+    {U'\x2f8c9', 3065, 1},
+    {U'\x2f8ca', 3066, 1},
+    {U'\x2f8cb', 3067, 1},
+    {U'\x2f8cc', 3068, 1},
+    {U'\x2f8cd', 3069, 1},
+    {U'\x2f8ce', 3070, 1},
+    {U'\x2f8cf', 3071, 1},
+    {U'\x2f8d0', 3072, 1},
+    {U'\x2f8d1', 3073, 1},
+    {U'\x2f8d2', 3074, 1},
+    {U'\x2f8d3', 3075, 1},
+    {U'\x2f8d4', 3076, 1},
+    {U'\x2f8d5', 3077, 1},
+    {U'\x2f8d6', 3078, 1},
+    {U'\x2f8d7', 3079, 1},
+    {U'\x2f8d8', 3080, 1},
+    {U'\x2f8d9', 3081, 1},
+    {U'\x2f8da', 3082, 1},
+    {U'\x2f8db', 3083, 1},
+    {U'\x2f8dc', 3084, 1},
+    {U'\x2f8dd', 3085, 1},
+    {U'\x2f8de', 3086, 1},
+    {U'\x2f8df', 3087, 1},
+    {U'\x2f8e0', 3088, 1},
+    {U'\x2f8e1', 3089, 1},
+    {U'\x2f8e2', 3090, 1},
+    {U'\x2f8e3', 3091, 1},
+    {U'\x2f8e4', 3092, 1},
+    {U'\x2f8e5', 3093, 1},
+    {U'\x2f8e6', 3094, 1},
+    {U'\x2f8e7', 3095, 1},
+    {U'\x2f8e8', 3096, 1},
+    {U'\x2f8e9', 3097, 1},
+    {U'\x2f8ea', 3098, 1},
+    {U'\x2f8eb', 3099, 1},
+    {U'\x2f8ec', 3100, 1},
+    {U'\x2f8ed', 3101, 1},
+    {U'\x2f8ee', 3102, 1},
+    {U'\x2f8ef', 3103, 1},
+    {U'\x2f8f0', 3104, 1},
+    {U'\x2f8f1', 3105, 1},
+    {U'\x2f8f2', 3106, 1},
+    {U'\x2f8f3', 3107, 1},
+    {U'\x2f8f4', 3108, 1},
+    {U'\x2f8f5', 3109, 1},
+    {U'\x2f8f6', 3110, 1},
+    {U'\x2f8f7', 3111, 1},
+    {U'\x2f8f8', 3112, 1},
+    {U'\x2f8f9', 3113, 1},
+    {U'\x2f8fa', 3114, 1},
+    {U'\x2f8fb', 3115, 1},
+    {U'\x2f8fc', 3116, 1},
+    {U'\x2f8fd', 3117, 1},
+    {U'\x2f8fe', 3118, 1},
+    {U'\x2f8ff', 3119, 1},
+    {U'\x2f900', 3120, 1},
+    {U'\x2f901', 3121, 1},
+    {U'\x2f902', 3122, 1},
+    {U'\x2f903', 3123, 1},
+    {U'\x2f904', 3124, 1},
+    {U'\x2f905', 3125, 1},
+    {U'\x2f906', 3126, 1},
+    {U'\x2f907', 3127, 1},
+    {U'\x2f908', 3128, 1},
+    {U'\x2f909', 3129, 1},
+    {U'\x2f90a', 3130, 1},
+    {U'\x2f90b', 3131, 1},
+    {U'\x2f90c', 3132, 1},
+    {U'\x2f90d', 3133, 1},
+    {U'\x2f90e', 3134, 1},
+    {U'\x2f90f', 3135, 1},
+    {U'\x2f910', 3136, 1},
+    {U'\x2f911', 3137, 1},
+    {U'\x2f912', 3138, 1},
+    {U'\x2f913', 3139, 1},
+    {U'\x2f914', 3140, 1},
+    {U'\x2f915', 3141, 1},
+    {U'\x2f916', 3142, 1},
+    {U'\x2f917', 3143, 1},
+    {U'\x2f918', 3144, 1},
+    {U'\x2f919', 3145, 1},
+    {U'\x2f91a', 3146, 1},
+    {U'\x2f91b', 3147, 1},
+    {U'\x2f91c', 3148, 1},
+    {U'\x2f91d', 3149, 1},
+    {U'\x2f91e', 3150, 1},
+    {U'\x2f91f', 3151, 1},
+    {U'\x2f920', 3152, 1},
+    {U'\x2f921', 3153, 1},
+    {U'\x2f922', 3154, 1},
+    {U'\x2f923', 3155, 1},
+    {U'\x2f924', 3156, 1},
+    {U'\x2f925', 3157, 1},
+    {U'\x2f926', 3158, 1},
+    {U'\x2f927', 3159, 1},
+    {U'\x2f928', 3160, 1},
+    {U'\x2f929', 3161, 1},
+    {U'\x2f92a', 3162, 1},
+    {U'\x2f92b', 3163, 1},
+    {U'\x2f92c', 3164, 1},
+    {U'\x2f92d', 3165, 1},
+    {U'\x2f92e', 3166, 1},
+    {U'\x2f92f', 3167, 1},
+    {U'\x2f930', 3168, 1},
+    {U'\x2f931', 3169, 1},
+    {U'\x2f932', 3170, 1},
+    {U'\x2f933', 3171, 1},
+    {U'\x2f934', 3172, 1},
+    {U'\x2f935', 3173, 1},
+    {U'\x2f936', 3174, 1},
+    {U'\x2f937', 3175, 1},
+    {U'\x2f938', 3176, 1},
+    {U'\x2f939', 3177, 1},
+    {U'\x2f93a', 3178, 1},
+    {U'\x2f93b', 3179, 1},
+    {U'\x2f93c', 3180, 1},
+    {U'\x2f93d', 3181, 1},
+    {U'\x2f93e', 3182, 1},
+    {U'\x2f93f', 3183, 1},
+    {U'\x2f940', 3184, 1},
+    {U'\x2f941', 3185, 1},
+    {U'\x2f942', 3186, 1},
+    {U'\x2f943', 3187, 1},
+    {U'\x2f944', 3188, 1},
+    {U'\x2f945', 3189, 1},
+    {U'\x2f946', 3190, 1},
+    {U'\x2f947', 3191, 1},
+    {U'\x2f948', 3192, 1},
+    {U'\x2f949', 3193, 1},
+    {U'\x2f94a', 3194, 1},
+    {U'\x2f94b', 3195, 1},
+    {U'\x2f94c', 3196, 1},
+    {U'\x2f94d', 3197, 1},
+    {U'\x2f94e', 3198, 1},
+    {U'\x2f94f', 3199, 1},
+    {U'\x2f950', 3200, 1},
+    {U'\x2f951', 3201, 1},
+    {U'\x2f952', 3202, 1},
+    {U'\x2f953', 3203, 1},
+    {U'\x2f954', 3204, 1},
+    {U'\x2f955', 3205, 1},
+    {U'\x2f956', 3206, 1},
+    {U'\x2f957', 3207, 1},
+    {U'\x2f958', 3208, 1},
+    {U'\x2f959', 3209, 1},
+    {U'\x2f95a', 3210, 1},
+    {U'\x2f95b', 3211, 1},
+    {U'\x2f95c', 3212, 1},
+    {U'\x2f95d', 3213, 1},
+    {U'\x2f95e', 3214, 1},
+    {U'\x2f95f', 3215, 1},
+    {U'\x2f960', 3216, 1},
+    {U'\x2f961', 3217, 1},
+    {U'\x2f962', 3218, 1},
+    {U'\x2f963', 3219, 1},
+    {U'\x2f964', 3220, 1},
+    {U'\x2f965', 3221, 1},
+    {U'\x2f966', 3222, 1},
+    {U'\x2f967', 3223, 1},
+    {U'\x2f968', 3224, 1},
+    {U'\x2f969', 3225, 1},
+    {U'\x2f96a', 3226, 1},
+    {U'\x2f96b', 3227, 1},
+    {U'\x2f96c', 3228, 1},
+    {U'\x2f96d', 3229, 1},
+    {U'\x2f96e', 3230, 1},
+    {U'\x2f96f', 3231, 1},
+    {U'\x2f970', 3232, 1},
+    {U'\x2f971', 3233, 1},
+    {U'\x2f972', 3234, 1},
+    {U'\x2f973', 3235, 1},
+    {U'\x2f974', 3236, 1},
+    {U'\x2f975', 3237, 1},
+    {U'\x2f976', 3238, 1},
+    {U'\x2f977', 3239, 1},
+    {U'\x2f978', 3240, 1},
+    {U'\x2f979', 3241, 1},
+    {U'\x2f97a', 3242, 1},
+    {U'\x2f97b', 3243, 1},
+    {U'\x2f97c', 3244, 1},
+    {U'\x2f97d', 3245, 1},
+    {U'\x2f97e', 3246, 1},
+    {U'\x2f97f', 3247, 1},
+    {U'\x2f980', 3248, 1},
+    {U'\x2f981', 3249, 1},
+    {U'\x2f982', 3250, 1},
+    {U'\x2f983', 3251, 1},
+    {U'\x2f984', 3252, 1},
+    {U'\x2f985', 3253, 1},
+    {U'\x2f986', 3254, 1},
+    {U'\x2f987', 3255, 1},
+    {U'\x2f988', 3256, 1},
+    {U'\x2f989', 3257, 1},
+    {U'\x2f98a', 3258, 1},
+    {U'\x2f98b', 3259, 1},
+    {U'\x2f98c', 3260, 1},
+    {U'\x2f98d', 3261, 1},
+    {U'\x2f98e', 3262, 1},
+    {U'\x2f98f', 3263, 1},
+    {U'\x2f990', 3264, 1},
+    {U'\x2f991', 3265, 1},
+    {U'\x2f992', 3266, 1},
+    {U'\x2f993', 3267, 1},
+    {U'\x2f994', 3268, 1},
+    {U'\x2f995', 3269, 1},
+    {U'\x2f996', 3270, 1},
+    {U'\x2f997', 3271, 1},
+    {U'\x2f998', 3272, 1},
+    {U'\x2f999', 3273, 1},
+    {U'\x2f99a', 3274, 1},
+    {U'\x2f99b', 3275, 1},
+    {U'\x2f99c', 3276, 1},
+    {U'\x2f99d', 3277, 1},
+    {U'\x2f99e', 3278, 1},
+    {U'\x2f99f', 3279, 1},
+    {U'\x2f9a0', 3280, 1},
+    {U'\x2f9a1', 3281, 1},
+    {U'\x2f9a2', 3282, 1},
+    {U'\x2f9a3', 3283, 1},
+    {U'\x2f9a4', 3284, 1},
+    {U'\x2f9a5', 3285, 1},
+    {U'\x2f9a6', 3286, 1},
+    {U'\x2f9a7', 3287, 1},
+    {U'\x2f9a8', 3288, 1},
+    {U'\x2f9a9', 3289, 1},
+    {U'\x2f9aa', 3290, 1},
+    {U'\x2f9ab', 3291, 1},
+    {U'\x2f9ac', 3292, 1},
+    {U'\x2f9ad', 3293, 1},
+    {U'\x2f9ae', 3294, 1},
+    {U'\x2f9af', 3295, 1},
+    {U'\x2f9b0', 3296, 1},
+    {U'\x2f9b1', 3297, 1},
+    {U'\x2f9b2', 3298, 1},
+    {U'\x2f9b3', 3299, 1},
+    {U'\x2f9b4', 3300, 1},
+    {U'\x2f9b5', 3301, 1},
+    {U'\x2f9b6', 3302, 1},
+    {U'\x2f9b7', 3303, 1},
+    {U'\x2f9b8', 3304, 1},
+    {U'\x2f9b9', 3305, 1},
+    {U'\x2f9ba', 3306, 1},
+    {U'\x2f9bb', 3307, 1},
+    {U'\x2f9bc', 3308, 1},
+    {U'\x2f9bd', 3309, 1},
+    {U'\x2f9be', 3310, 1},
+    {U'\x2f9bf', 3311, 1},
+    {U'\x2f9c0', 3312, 1},
+    {U'\x2f9c1', 3313, 1},
+    {U'\x2f9c2', 3314, 1},
+    {U'\x2f9c3', 3315, 1},
+    {U'\x2f9c4', 3316, 1},
+    {U'\x2f9c5', 3317, 1},
+    {U'\x2f9c6', 3318, 1},
+    {U'\x2f9c7', 3319, 1},
+    {U'\x2f9c8', 3320, 1},
+    {U'\x2f9c9', 3321, 1},
+    {U'\x2f9ca', 3322, 1},
+    {U'\x2f9cb', 3323, 1},
+    {U'\x2f9cc', 3324, 1},
+    {U'\x2f9cd', 3325, 1},
+    {U'\x2f9ce', 3326, 1},
+    {U'\x2f9cf', 3327, 1},
+    {U'\x2f9d0', 3328, 1},
+    {U'\x2f9d1', 3329, 1},
+    {U'\x2f9d2', 3330, 1},
+    {U'\x2f9d3', 3331, 1},
+    {U'\x2f9d4', 3332, 1},
+    {U'\x2f9d5', 3333, 1},
+    {U'\x2f9d6', 3334, 1},
+    {U'\x2f9d7', 3335, 1},
+    {U'\x2f9d8', 3336, 1},
+    {U'\x2f9d9', 3337, 1},
+    {U'\x2f9da', 3338, 1},
+    {U'\x2f9db', 3339, 1},
+    {U'\x2f9dc', 3340, 1},
+    {U'\x2f9dd', 3341, 1},
+    {U'\x2f9de', 3342, 1},
+    {U'\x2f9df', 3343, 1},
+    {U'\x2f9e0', 3344, 1},
+    {U'\x2f9e1', 3345, 1},
+    {U'\x2f9e2', 3346, 1},
+    {U'\x2f9e3', 3347, 1},
+    {U'\x2f9e4', 3348, 1},
+    {U'\x2f9e5', 3349, 1},
+    {U'\x2f9e6', 3350, 1},
+    {U'\x2f9e7', 3351, 1},
+    {U'\x2f9e8', 3352, 1},
+    {U'\x2f9e9', 3353, 1},
+    {U'\x2f9ea', 3354, 1},
+    {U'\x2f9eb', 3355, 1},
+    {U'\x2f9ec', 3356, 1},
+    {U'\x2f9ed', 3357, 1},
+    {U'\x2f9ee', 3358, 1},
+    {U'\x2f9ef', 3359, 1},
+    {U'\x2f9f0', 3360, 1},
+    {U'\x2f9f1', 3361, 1},
+    {U'\x2f9f2', 3362, 1},
+    {U'\x2f9f3', 3363, 1},
+    {U'\x2f9f4', 3364, 1},
+    {U'\x2f9f5', 3365, 1},
+    {U'\x2f9f6', 3366, 1},
+    {U'\x2f9f7', 3367, 1},
+    {U'\x2f9f8', 3368, 1},
+    {U'\x2f9f9', 3369, 1},
+    {U'\x2f9fa', 3370, 1},
+    {U'\x2f9fb', 3371, 1},
+    {U'\x2f9fc', 3372, 1},
+    {U'\x2f9fd', 3373, 1},
+    {U'\x2f9fe', 3374, 1},
+    {U'\x2f9ff', 3375, 1},
+    {U'\x2fa00', 3376, 1},
+    {U'\x2fa01', 3377, 1},
+    {U'\x2fa02', 3378, 1},
+    {U'\x2fa03', 3379, 1},
+    {U'\x2fa04', 3380, 1},
+    {U'\x2fa05', 3381, 1},
+    {U'\x2fa06', 3382, 1},
+    {U'\x2fa07', 3383, 1},
+    {U'\x2fa08', 3384, 1},
+    {U'\x2fa09', 3385, 1},
+    {U'\x2fa0a', 3386, 1},
+    {U'\x2fa0b', 3387, 1},
+    {U'\x2fa0c', 3388, 1},
+    {U'\x2fa0d', 3389, 1},
+    {U'\x2fa0e', 3390, 1},
+    {U'\x2fa0f', 3391, 1},
+    {U'\x2fa10', 3392, 1},
+    {U'\x2fa11', 3393, 1},
+    {U'\x2fa12', 3394, 1},
+    {U'\x2fa13', 3395, 1},
+    {U'\x2fa14', 3396, 1},
+    {U'\x2fa15', 3397, 1},
+    {U'\x2fa16', 3398, 1},
+    {U'\x2fa17', 3399, 1},
+    {U'\x2fa18', 3400, 1},
+    {U'\x2fa19', 3401, 1},
+    {U'\x2fa1a', 3402, 1},
+    {U'\x2fa1b', 3403, 1},
+    {U'\x2fa1c', 3404, 1},
+    {U'\x2fa1d', 3405, 1},
+}};
+
+inline constexpr auto decomposed_code_points = std::array<char32_t, 3406>{{
+    U'\x0041', U'\x0300', U'\x0041', U'\x0301', U'\x0041', U'\x0302', U'\x0041', U'\x0303',
+    U'\x0041', U'\x0308', U'\x0041', U'\x030a', U'\x0043', U'\x0327', U'\x0045', U'\x0300',
+    U'\x0045', U'\x0301', U'\x0045', U'\x0302', U'\x0045', U'\x0308', U'\x0049', U'\x0300',
+    U'\x0049', U'\x0301', U'\x0049', U'\x0302', U'\x0049', U'\x0308', U'\x004e', U'\x0303',
+    U'\x004f', U'\x0300', U'\x004f', U'\x0301', U'\x004f', U'\x0302', U'\x004f', U'\x0303',
+    U'\x004f', U'\x0308', U'\x0055', U'\x0300', U'\x0055', U'\x0301', U'\x0055', U'\x0302',
+    U'\x0055', U'\x0308', U'\x0059', U'\x0301', U'\x0061', U'\x0300', U'\x0061', U'\x0301',
+    U'\x0061', U'\x0302', U'\x0061', U'\x0303', U'\x0061', U'\x0308', U'\x0061', U'\x030a',
+    U'\x0063', U'\x0327', U'\x0065', U'\x0300', U'\x0065', U'\x0301', U'\x0065', U'\x0302',
+    U'\x0065', U'\x0308', U'\x0069', U'\x0300', U'\x0069', U'\x0301', U'\x0069', U'\x0302',
+    U'\x0069', U'\x0308', U'\x006e', U'\x0303', U'\x006f', U'\x0300', U'\x006f', U'\x0301',
+    U'\x006f', U'\x0302', U'\x006f', U'\x0303', U'\x006f', U'\x0308', U'\x0075', U'\x0300',
+    U'\x0075', U'\x0301', U'\x0075', U'\x0302', U'\x0075', U'\x0308', U'\x0079', U'\x0301',
+    U'\x0079', U'\x0308', U'\x0041', U'\x0304', U'\x0061', U'\x0304', U'\x0041', U'\x0306',
+    U'\x0061', U'\x0306', U'\x0041', U'\x0328', U'\x0061', U'\x0328', U'\x0043', U'\x0301',
+    U'\x0063', U'\x0301', U'\x0043', U'\x0302', U'\x0063', U'\x0302', U'\x0043', U'\x0307',
+    U'\x0063', U'\x0307', U'\x0043', U'\x030c', U'\x0063', U'\x030c', U'\x0044', U'\x030c',
+    U'\x0064', U'\x030c', U'\x0045', U'\x0304', U'\x0065', U'\x0304', U'\x0045', U'\x0306',
+    U'\x0065', U'\x0306', U'\x0045', U'\x0307', U'\x0065', U'\x0307', U'\x0045', U'\x0328',
+    U'\x0065', U'\x0328', U'\x0045', U'\x030c', U'\x0065', U'\x030c', U'\x0047', U'\x0302',
+    U'\x0067', U'\x0302', U'\x0047', U'\x0306', U'\x0067', U'\x0306', U'\x0047', U'\x0307',
+    U'\x0067', U'\x0307', U'\x0047', U'\x0327', U'\x0067', U'\x0327', U'\x0048', U'\x0302',
+    U'\x0068', U'\x0302', U'\x0049', U'\x0303', U'\x0069', U'\x0303', U'\x0049', U'\x0304',
+    U'\x0069', U'\x0304', U'\x0049', U'\x0306', U'\x0069', U'\x0306', U'\x0049', U'\x0328',
+    U'\x0069', U'\x0328', U'\x0049', U'\x0307', U'\x004a', U'\x0302', U'\x006a', U'\x0302',
+    U'\x004b', U'\x0327', U'\x006b', U'\x0327', U'\x004c', U'\x0301', U'\x006c', U'\x0301',
+    U'\x004c', U'\x0327', U'\x006c', U'\x0327', U'\x004c', U'\x030c', U'\x006c', U'\x030c',
+    U'\x004e', U'\x0301', U'\x006e', U'\x0301', U'\x004e', U'\x0327', U'\x006e', U'\x0327',
+    U'\x004e', U'\x030c', U'\x006e', U'\x030c', U'\x004f', U'\x0304', U'\x006f', U'\x0304',
+    U'\x004f', U'\x0306', U'\x006f', U'\x0306', U'\x004f', U'\x030b', U'\x006f', U'\x030b',
+    U'\x0052', U'\x0301', U'\x0072', U'\x0301', U'\x0052', U'\x0327', U'\x0072', U'\x0327',
+    U'\x0052', U'\x030c', U'\x0072', U'\x030c', U'\x0053', U'\x0301', U'\x0073', U'\x0301',
+    U'\x0053', U'\x0302', U'\x0073', U'\x0302', U'\x0053', U'\x0327', U'\x0073', U'\x0327',
+    U'\x0053', U'\x030c', U'\x0073', U'\x030c', U'\x0054', U'\x0327', U'\x0074', U'\x0327',
+    U'\x0054', U'\x030c', U'\x0074', U'\x030c', U'\x0055', U'\x0303', U'\x0075', U'\x0303',
+    U'\x0055', U'\x0304', U'\x0075', U'\x0304', U'\x0055', U'\x0306', U'\x0075', U'\x0306',
+    U'\x0055', U'\x030a', U'\x0075', U'\x030a', U'\x0055', U'\x030b', U'\x0075', U'\x030b',
+    U'\x0055', U'\x0328', U'\x0075', U'\x0328', U'\x0057', U'\x0302', U'\x0077', U'\x0302',
+    U'\x0059', U'\x0302', U'\x0079', U'\x0302', U'\x0059', U'\x0308', U'\x005a', U'\x0301',
+    U'\x007a', U'\x0301', U'\x005a', U'\x0307', U'\x007a', U'\x0307', U'\x005a', U'\x030c',
+    U'\x007a', U'\x030c', U'\x004f', U'\x031b', U'\x006f', U'\x031b', U'\x0055', U'\x031b',
+    U'\x0075', U'\x031b', U'\x0041', U'\x030c', U'\x0061', U'\x030c', U'\x0049', U'\x030c',
+    U'\x0069', U'\x030c', U'\x004f', U'\x030c', U'\x006f', U'\x030c', U'\x0055', U'\x030c',
+    U'\x0075', U'\x030c', U'\x0055', U'\x0308', U'\x0304', U'\x0075', U'\x0308', U'\x0304',
+    U'\x0055', U'\x0308', U'\x0301', U'\x0075', U'\x0308', U'\x0301', U'\x0055', U'\x0308',
+    U'\x030c', U'\x0075', U'\x0308', U'\x030c', U'\x0055', U'\x0308', U'\x0300', U'\x0075',
+    U'\x0308', U'\x0300', U'\x0041', U'\x0308', U'\x0304', U'\x0061', U'\x0308', U'\x0304',
+    U'\x0041', U'\x0307', U'\x0304', U'\x0061', U'\x0307', U'\x0304', U'\x00c6', U'\x0304',
+    U'\x00e6', U'\x0304', U'\x0047', U'\x030c', U'\x0067', U'\x030c', U'\x004b', U'\x030c',
+    U'\x006b', U'\x030c', U'\x004f', U'\x0328', U'\x006f', U'\x0328', U'\x004f', U'\x0328',
+    U'\x0304', U'\x006f', U'\x0328', U'\x0304', U'\x01b7', U'\x030c', U'\x0292', U'\x030c',
+    U'\x006a', U'\x030c', U'\x0047', U'\x0301', U'\x0067', U'\x0301', U'\x004e', U'\x0300',
+    U'\x006e', U'\x0300', U'\x0041', U'\x030a', U'\x0301', U'\x0061', U'\x030a', U'\x0301',
+    U'\x00c6', U'\x0301', U'\x00e6', U'\x0301', U'\x00d8', U'\x0301', U'\x00f8', U'\x0301',
+    U'\x0041', U'\x030f', U'\x0061', U'\x030f', U'\x0041', U'\x0311', U'\x0061', U'\x0311',
+    U'\x0045', U'\x030f', U'\x0065', U'\x030f', U'\x0045', U'\x0311', U'\x0065', U'\x0311',
+    U'\x0049', U'\x030f', U'\x0069', U'\x030f', U'\x0049', U'\x0311', U'\x0069', U'\x0311',
+    U'\x004f', U'\x030f', U'\x006f', U'\x030f', U'\x004f', U'\x0311', U'\x006f', U'\x0311',
+    U'\x0052', U'\x030f', U'\x0072', U'\x030f', U'\x0052', U'\x0311', U'\x0072', U'\x0311',
+    U'\x0055', U'\x030f', U'\x0075', U'\x030f', U'\x0055', U'\x0311', U'\x0075', U'\x0311',
+    U'\x0053', U'\x0326', U'\x0073', U'\x0326', U'\x0054', U'\x0326', U'\x0074', U'\x0326',
+    U'\x0048', U'\x030c', U'\x0068', U'\x030c', U'\x0041', U'\x0307', U'\x0061', U'\x0307',
+    U'\x0045', U'\x0327', U'\x0065', U'\x0327', U'\x004f', U'\x0308', U'\x0304', U'\x006f',
+    U'\x0308', U'\x0304', U'\x004f', U'\x0303', U'\x0304', U'\x006f', U'\x0303', U'\x0304',
+    U'\x004f', U'\x0307', U'\x006f', U'\x0307', U'\x004f', U'\x0307', U'\x0304', U'\x006f',
+    U'\x0307', U'\x0304', U'\x0059', U'\x0304', U'\x0079', U'\x0304', U'\x0300', U'\x0301',
+    U'\x0313', U'\x0308', U'\x0301', U'\x02b9', U'\x003b', U'\x00a8', U'\x0301', U'\x0391',
+    U'\x0301', U'\x00b7', U'\x0395', U'\x0301', U'\x0397', U'\x0301', U'\x0399', U'\x0301',
+    U'\x039f', U'\x0301', U'\x03a5', U'\x0301', U'\x03a9', U'\x0301', U'\x03b9', U'\x0308',
+    U'\x0301', U'\x0399', U'\x0308', U'\x03a5', U'\x0308', U'\x03b1', U'\x0301', U'\x03b5',
+    U'\x0301', U'\x03b7', U'\x0301', U'\x03b9', U'\x0301', U'\x03c5', U'\x0308', U'\x0301',
+    U'\x03b9', U'\x0308', U'\x03c5', U'\x0308', U'\x03bf', U'\x0301', U'\x03c5', U'\x0301',
+    U'\x03c9', U'\x0301', U'\x03d2', U'\x0301', U'\x03d2', U'\x0308', U'\x0415', U'\x0300',
+    U'\x0415', U'\x0308', U'\x0413', U'\x0301', U'\x0406', U'\x0308', U'\x041a', U'\x0301',
+    U'\x0418', U'\x0300', U'\x0423', U'\x0306', U'\x0418', U'\x0306', U'\x0438', U'\x0306',
+    U'\x0435', U'\x0300', U'\x0435', U'\x0308', U'\x0433', U'\x0301', U'\x0456', U'\x0308',
+    U'\x043a', U'\x0301', U'\x0438', U'\x0300', U'\x0443', U'\x0306', U'\x0474', U'\x030f',
+    U'\x0475', U'\x030f', U'\x0416', U'\x0306', U'\x0436', U'\x0306', U'\x0410', U'\x0306',
+    U'\x0430', U'\x0306', U'\x0410', U'\x0308', U'\x0430', U'\x0308', U'\x0415', U'\x0306',
+    U'\x0435', U'\x0306', U'\x04d8', U'\x0308', U'\x04d9', U'\x0308', U'\x0416', U'\x0308',
+    U'\x0436', U'\x0308', U'\x0417', U'\x0308', U'\x0437', U'\x0308', U'\x0418', U'\x0304',
+    U'\x0438', U'\x0304', U'\x0418', U'\x0308', U'\x0438', U'\x0308', U'\x041e', U'\x0308',
+    U'\x043e', U'\x0308', U'\x04e8', U'\x0308', U'\x04e9', U'\x0308', U'\x042d', U'\x0308',
+    U'\x044d', U'\x0308', U'\x0423', U'\x0304', U'\x0443', U'\x0304', U'\x0423', U'\x0308',
+    U'\x0443', U'\x0308', U'\x0423', U'\x030b', U'\x0443', U'\x030b', U'\x0427', U'\x0308',
+    U'\x0447', U'\x0308', U'\x042b', U'\x0308', U'\x044b', U'\x0308', U'\x0627', U'\x0653',
+    U'\x0627', U'\x0654', U'\x0648', U'\x0654', U'\x0627', U'\x0655', U'\x064a', U'\x0654',
+    U'\x06d5', U'\x0654', U'\x06c1', U'\x0654', U'\x06d2', U'\x0654', U'\x0928', U'\x093c',
+    U'\x0930', U'\x093c', U'\x0933', U'\x093c', U'\x0915', U'\x093c', U'\x0916', U'\x093c',
+    U'\x0917', U'\x093c', U'\x091c', U'\x093c', U'\x0921', U'\x093c', U'\x0922', U'\x093c',
+    U'\x092b', U'\x093c', U'\x092f', U'\x093c', U'\x09c7', U'\x09be', U'\x09c7', U'\x09d7',
+    U'\x09a1', U'\x09bc', U'\x09a2', U'\x09bc', U'\x09af', U'\x09bc', U'\x0a32', U'\x0a3c',
+    U'\x0a38', U'\x0a3c', U'\x0a16', U'\x0a3c', U'\x0a17', U'\x0a3c', U'\x0a1c', U'\x0a3c',
+    U'\x0a2b', U'\x0a3c', U'\x0b47', U'\x0b56', U'\x0b47', U'\x0b3e', U'\x0b47', U'\x0b57',
+    U'\x0b21', U'\x0b3c', U'\x0b22', U'\x0b3c', U'\x0b92', U'\x0bd7', U'\x0bc6', U'\x0bbe',
+    U'\x0bc7', U'\x0bbe', U'\x0bc6', U'\x0bd7', U'\x0c46', U'\x0c56', U'\x0cbf', U'\x0cd5',
+    U'\x0cc6', U'\x0cd5', U'\x0cc6', U'\x0cd6', U'\x0cc6', U'\x0cc2', U'\x0cc6', U'\x0cc2',
+    U'\x0cd5', U'\x0d46', U'\x0d3e', U'\x0d47', U'\x0d3e', U'\x0d46', U'\x0d57', U'\x0dd9',
+    U'\x0dca', U'\x0dd9', U'\x0dcf', U'\x0dd9', U'\x0dcf', U'\x0dca', U'\x0dd9', U'\x0ddf',
+    U'\x0f42', U'\x0fb7', U'\x0f4c', U'\x0fb7', U'\x0f51', U'\x0fb7', U'\x0f56', U'\x0fb7',
+    U'\x0f5b', U'\x0fb7', U'\x0f40', U'\x0fb5', U'\x0f71', U'\x0f72', U'\x0f71', U'\x0f74',
+    U'\x0fb2', U'\x0f80', U'\x0fb3', U'\x0f80', U'\x0f71', U'\x0f80', U'\x0f92', U'\x0fb7',
+    U'\x0f9c', U'\x0fb7', U'\x0fa1', U'\x0fb7', U'\x0fa6', U'\x0fb7', U'\x0fab', U'\x0fb7',
+    U'\x0f90', U'\x0fb5', U'\x1025', U'\x102e', U'\x1b05', U'\x1b35', U'\x1b07', U'\x1b35',
+    U'\x1b09', U'\x1b35', U'\x1b0b', U'\x1b35', U'\x1b0d', U'\x1b35', U'\x1b11', U'\x1b35',
+    U'\x1b3a', U'\x1b35', U'\x1b3c', U'\x1b35', U'\x1b3e', U'\x1b35', U'\x1b3f', U'\x1b35',
+    U'\x1b42', U'\x1b35', U'\x0041', U'\x0325', U'\x0061', U'\x0325', U'\x0042', U'\x0307',
+    U'\x0062', U'\x0307', U'\x0042', U'\x0323', U'\x0062', U'\x0323', U'\x0042', U'\x0331',
+    U'\x0062', U'\x0331', U'\x0043', U'\x0327', U'\x0301', U'\x0063', U'\x0327', U'\x0301',
+    U'\x0044', U'\x0307', U'\x0064', U'\x0307', U'\x0044', U'\x0323', U'\x0064', U'\x0323',
+    U'\x0044', U'\x0331', U'\x0064', U'\x0331', U'\x0044', U'\x0327', U'\x0064', U'\x0327',
+    U'\x0044', U'\x032d', U'\x0064', U'\x032d', U'\x0045', U'\x0304', U'\x0300', U'\x0065',
+    U'\x0304', U'\x0300', U'\x0045', U'\x0304', U'\x0301', U'\x0065', U'\x0304', U'\x0301',
+    U'\x0045', U'\x032d', U'\x0065', U'\x032d', U'\x0045', U'\x0330', U'\x0065', U'\x0330',
+    U'\x0045', U'\x0327', U'\x0306', U'\x0065', U'\x0327', U'\x0306', U'\x0046', U'\x0307',
+    U'\x0066', U'\x0307', U'\x0047', U'\x0304', U'\x0067', U'\x0304', U'\x0048', U'\x0307',
+    U'\x0068', U'\x0307', U'\x0048', U'\x0323', U'\x0068', U'\x0323', U'\x0048', U'\x0308',
+    U'\x0068', U'\x0308', U'\x0048', U'\x0327', U'\x0068', U'\x0327', U'\x0048', U'\x032e',
+    U'\x0068', U'\x032e', U'\x0049', U'\x0330', U'\x0069', U'\x0330', U'\x0049', U'\x0308',
+    U'\x0301', U'\x0069', U'\x0308', U'\x0301', U'\x004b', U'\x0301', U'\x006b', U'\x0301',
+    U'\x004b', U'\x0323', U'\x006b', U'\x0323', U'\x004b', U'\x0331', U'\x006b', U'\x0331',
+    U'\x004c', U'\x0323', U'\x006c', U'\x0323', U'\x004c', U'\x0323', U'\x0304', U'\x006c',
+    U'\x0323', U'\x0304', U'\x004c', U'\x0331', U'\x006c', U'\x0331', U'\x004c', U'\x032d',
+    U'\x006c', U'\x032d', U'\x004d', U'\x0301', U'\x006d', U'\x0301', U'\x004d', U'\x0307',
+    U'\x006d', U'\x0307', U'\x004d', U'\x0323', U'\x006d', U'\x0323', U'\x004e', U'\x0307',
+    U'\x006e', U'\x0307', U'\x004e', U'\x0323', U'\x006e', U'\x0323', U'\x004e', U'\x0331',
+    U'\x006e', U'\x0331', U'\x004e', U'\x032d', U'\x006e', U'\x032d', U'\x004f', U'\x0303',
+    U'\x0301', U'\x006f', U'\x0303', U'\x0301', U'\x004f', U'\x0303', U'\x0308', U'\x006f',
+    U'\x0303', U'\x0308', U'\x004f', U'\x0304', U'\x0300', U'\x006f', U'\x0304', U'\x0300',
+    U'\x004f', U'\x0304', U'\x0301', U'\x006f', U'\x0304', U'\x0301', U'\x0050', U'\x0301',
+    U'\x0070', U'\x0301', U'\x0050', U'\x0307', U'\x0070', U'\x0307', U'\x0052', U'\x0307',
+    U'\x0072', U'\x0307', U'\x0052', U'\x0323', U'\x0072', U'\x0323', U'\x0052', U'\x0323',
+    U'\x0304', U'\x0072', U'\x0323', U'\x0304', U'\x0052', U'\x0331', U'\x0072', U'\x0331',
+    U'\x0053', U'\x0307', U'\x0073', U'\x0307', U'\x0053', U'\x0323', U'\x0073', U'\x0323',
+    U'\x0053', U'\x0301', U'\x0307', U'\x0073', U'\x0301', U'\x0307', U'\x0053', U'\x030c',
+    U'\x0307', U'\x0073', U'\x030c', U'\x0307', U'\x0053', U'\x0323', U'\x0307', U'\x0073',
+    U'\x0323', U'\x0307', U'\x0054', U'\x0307', U'\x0074', U'\x0307', U'\x0054', U'\x0323',
+    U'\x0074', U'\x0323', U'\x0054', U'\x0331', U'\x0074', U'\x0331', U'\x0054', U'\x032d',
+    U'\x0074', U'\x032d', U'\x0055', U'\x0324', U'\x0075', U'\x0324', U'\x0055', U'\x0330',
+    U'\x0075', U'\x0330', U'\x0055', U'\x032d', U'\x0075', U'\x032d', U'\x0055', U'\x0303',
+    U'\x0301', U'\x0075', U'\x0303', U'\x0301', U'\x0055', U'\x0304', U'\x0308', U'\x0075',
+    U'\x0304', U'\x0308', U'\x0056', U'\x0303', U'\x0076', U'\x0303', U'\x0056', U'\x0323',
+    U'\x0076', U'\x0323', U'\x0057', U'\x0300', U'\x0077', U'\x0300', U'\x0057', U'\x0301',
+    U'\x0077', U'\x0301', U'\x0057', U'\x0308', U'\x0077', U'\x0308', U'\x0057', U'\x0307',
+    U'\x0077', U'\x0307', U'\x0057', U'\x0323', U'\x0077', U'\x0323', U'\x0058', U'\x0307',
+    U'\x0078', U'\x0307', U'\x0058', U'\x0308', U'\x0078', U'\x0308', U'\x0059', U'\x0307',
+    U'\x0079', U'\x0307', U'\x005a', U'\x0302', U'\x007a', U'\x0302', U'\x005a', U'\x0323',
+    U'\x007a', U'\x0323', U'\x005a', U'\x0331', U'\x007a', U'\x0331', U'\x0068', U'\x0331',
+    U'\x0074', U'\x0308', U'\x0077', U'\x030a', U'\x0079', U'\x030a', U'\x017f', U'\x0307',
+    U'\x0041', U'\x0323', U'\x0061', U'\x0323', U'\x0041', U'\x0309', U'\x0061', U'\x0309',
+    U'\x0041', U'\x0302', U'\x0301', U'\x0061', U'\x0302', U'\x0301', U'\x0041', U'\x0302',
+    U'\x0300', U'\x0061', U'\x0302', U'\x0300', U'\x0041', U'\x0302', U'\x0309', U'\x0061',
+    U'\x0302', U'\x0309', U'\x0041', U'\x0302', U'\x0303', U'\x0061', U'\x0302', U'\x0303',
+    U'\x0041', U'\x0323', U'\x0302', U'\x0061', U'\x0323', U'\x0302', U'\x0041', U'\x0306',
+    U'\x0301', U'\x0061', U'\x0306', U'\x0301', U'\x0041', U'\x0306', U'\x0300', U'\x0061',
+    U'\x0306', U'\x0300', U'\x0041', U'\x0306', U'\x0309', U'\x0061', U'\x0306', U'\x0309',
+    U'\x0041', U'\x0306', U'\x0303', U'\x0061', U'\x0306', U'\x0303', U'\x0041', U'\x0323',
+    U'\x0306', U'\x0061', U'\x0323', U'\x0306', U'\x0045', U'\x0323', U'\x0065', U'\x0323',
+    U'\x0045', U'\x0309', U'\x0065', U'\x0309', U'\x0045', U'\x0303', U'\x0065', U'\x0303',
+    U'\x0045', U'\x0302', U'\x0301', U'\x0065', U'\x0302', U'\x0301', U'\x0045', U'\x0302',
+    U'\x0300', U'\x0065', U'\x0302', U'\x0300', U'\x0045', U'\x0302', U'\x0309', U'\x0065',
+    U'\x0302', U'\x0309', U'\x0045', U'\x0302', U'\x0303', U'\x0065', U'\x0302', U'\x0303',
+    U'\x0045', U'\x0323', U'\x0302', U'\x0065', U'\x0323', U'\x0302', U'\x0049', U'\x0309',
+    U'\x0069', U'\x0309', U'\x0049', U'\x0323', U'\x0069', U'\x0323', U'\x004f', U'\x0323',
+    U'\x006f', U'\x0323', U'\x004f', U'\x0309', U'\x006f', U'\x0309', U'\x004f', U'\x0302',
+    U'\x0301', U'\x006f', U'\x0302', U'\x0301', U'\x004f', U'\x0302', U'\x0300', U'\x006f',
+    U'\x0302', U'\x0300', U'\x004f', U'\x0302', U'\x0309', U'\x006f', U'\x0302', U'\x0309',
+    U'\x004f', U'\x0302', U'\x0303', U'\x006f', U'\x0302', U'\x0303', U'\x004f', U'\x0323',
+    U'\x0302', U'\x006f', U'\x0323', U'\x0302', U'\x004f', U'\x031b', U'\x0301', U'\x006f',
+    U'\x031b', U'\x0301', U'\x004f', U'\x031b', U'\x0300', U'\x006f', U'\x031b', U'\x0300',
+    U'\x004f', U'\x031b', U'\x0309', U'\x006f', U'\x031b', U'\x0309', U'\x004f', U'\x031b',
+    U'\x0303', U'\x006f', U'\x031b', U'\x0303', U'\x004f', U'\x031b', U'\x0323', U'\x006f',
+    U'\x031b', U'\x0323', U'\x0055', U'\x0323', U'\x0075', U'\x0323', U'\x0055', U'\x0309',
+    U'\x0075', U'\x0309', U'\x0055', U'\x031b', U'\x0301', U'\x0075', U'\x031b', U'\x0301',
+    U'\x0055', U'\x031b', U'\x0300', U'\x0075', U'\x031b', U'\x0300', U'\x0055', U'\x031b',
+    U'\x0309', U'\x0075', U'\x031b', U'\x0309', U'\x0055', U'\x031b', U'\x0303', U'\x0075',
+    U'\x031b', U'\x0303', U'\x0055', U'\x031b', U'\x0323', U'\x0075', U'\x031b', U'\x0323',
+    U'\x0059', U'\x0300', U'\x0079', U'\x0300', U'\x0059', U'\x0323', U'\x0079', U'\x0323',
+    U'\x0059', U'\x0309', U'\x0079', U'\x0309', U'\x0059', U'\x0303', U'\x0079', U'\x0303',
+    U'\x03b1', U'\x0313', U'\x03b1', U'\x0314', U'\x03b1', U'\x0313', U'\x0300', U'\x03b1',
+    U'\x0314', U'\x0300', U'\x03b1', U'\x0313', U'\x0301', U'\x03b1', U'\x0314', U'\x0301',
+    U'\x03b1', U'\x0313', U'\x0342', U'\x03b1', U'\x0314', U'\x0342', U'\x0391', U'\x0313',
+    U'\x0391', U'\x0314', U'\x0391', U'\x0313', U'\x0300', U'\x0391', U'\x0314', U'\x0300',
+    U'\x0391', U'\x0313', U'\x0301', U'\x0391', U'\x0314', U'\x0301', U'\x0391', U'\x0313',
+    U'\x0342', U'\x0391', U'\x0314', U'\x0342', U'\x03b5', U'\x0313', U'\x03b5', U'\x0314',
+    U'\x03b5', U'\x0313', U'\x0300', U'\x03b5', U'\x0314', U'\x0300', U'\x03b5', U'\x0313',
+    U'\x0301', U'\x03b5', U'\x0314', U'\x0301', U'\x0395', U'\x0313', U'\x0395', U'\x0314',
+    U'\x0395', U'\x0313', U'\x0300', U'\x0395', U'\x0314', U'\x0300', U'\x0395', U'\x0313',
+    U'\x0301', U'\x0395', U'\x0314', U'\x0301', U'\x03b7', U'\x0313', U'\x03b7', U'\x0314',
+    U'\x03b7', U'\x0313', U'\x0300', U'\x03b7', U'\x0314', U'\x0300', U'\x03b7', U'\x0313',
+    U'\x0301', U'\x03b7', U'\x0314', U'\x0301', U'\x03b7', U'\x0313', U'\x0342', U'\x03b7',
+    U'\x0314', U'\x0342', U'\x0397', U'\x0313', U'\x0397', U'\x0314', U'\x0397', U'\x0313',
+    U'\x0300', U'\x0397', U'\x0314', U'\x0300', U'\x0397', U'\x0313', U'\x0301', U'\x0397',
+    U'\x0314', U'\x0301', U'\x0397', U'\x0313', U'\x0342', U'\x0397', U'\x0314', U'\x0342',
+    U'\x03b9', U'\x0313', U'\x03b9', U'\x0314', U'\x03b9', U'\x0313', U'\x0300', U'\x03b9',
+    U'\x0314', U'\x0300', U'\x03b9', U'\x0313', U'\x0301', U'\x03b9', U'\x0314', U'\x0301',
+    U'\x03b9', U'\x0313', U'\x0342', U'\x03b9', U'\x0314', U'\x0342', U'\x0399', U'\x0313',
+    U'\x0399', U'\x0314', U'\x0399', U'\x0313', U'\x0300', U'\x0399', U'\x0314', U'\x0300',
+    U'\x0399', U'\x0313', U'\x0301', U'\x0399', U'\x0314', U'\x0301', U'\x0399', U'\x0313',
+    U'\x0342', U'\x0399', U'\x0314', U'\x0342', U'\x03bf', U'\x0313', U'\x03bf', U'\x0314',
+    U'\x03bf', U'\x0313', U'\x0300', U'\x03bf', U'\x0314', U'\x0300', U'\x03bf', U'\x0313',
+    U'\x0301', U'\x03bf', U'\x0314', U'\x0301', U'\x039f', U'\x0313', U'\x039f', U'\x0314',
+    U'\x039f', U'\x0313', U'\x0300', U'\x039f', U'\x0314', U'\x0300', U'\x039f', U'\x0313',
+    U'\x0301', U'\x039f', U'\x0314', U'\x0301', U'\x03c5', U'\x0313', U'\x03c5', U'\x0314',
+    U'\x03c5', U'\x0313', U'\x0300', U'\x03c5', U'\x0314', U'\x0300', U'\x03c5', U'\x0313',
+    U'\x0301', U'\x03c5', U'\x0314', U'\x0301', U'\x03c5', U'\x0313', U'\x0342', U'\x03c5',
+    U'\x0314', U'\x0342', U'\x03a5', U'\x0314', U'\x03a5', U'\x0314', U'\x0300', U'\x03a5',
+    U'\x0314', U'\x0301', U'\x03a5', U'\x0314', U'\x0342', U'\x03c9', U'\x0313', U'\x03c9',
+    U'\x0314', U'\x03c9', U'\x0313', U'\x0300', U'\x03c9', U'\x0314', U'\x0300', U'\x03c9',
+    U'\x0313', U'\x0301', U'\x03c9', U'\x0314', U'\x0301', U'\x03c9', U'\x0313', U'\x0342',
+    U'\x03c9', U'\x0314', U'\x0342', U'\x03a9', U'\x0313', U'\x03a9', U'\x0314', U'\x03a9',
+    U'\x0313', U'\x0300', U'\x03a9', U'\x0314', U'\x0300', U'\x03a9', U'\x0313', U'\x0301',
+    U'\x03a9', U'\x0314', U'\x0301', U'\x03a9', U'\x0313', U'\x0342', U'\x03a9', U'\x0314',
+    U'\x0342', U'\x03b1', U'\x0300', U'\x03b1', U'\x0301', U'\x03b5', U'\x0300', U'\x03b5',
+    U'\x0301', U'\x03b7', U'\x0300', U'\x03b7', U'\x0301', U'\x03b9', U'\x0300', U'\x03b9',
+    U'\x0301', U'\x03bf', U'\x0300', U'\x03bf', U'\x0301', U'\x03c5', U'\x0300', U'\x03c5',
+    U'\x0301', U'\x03c9', U'\x0300', U'\x03c9', U'\x0301', U'\x03b1', U'\x0313', U'\x0345',
+    U'\x03b1', U'\x0314', U'\x0345', U'\x03b1', U'\x0313', U'\x0300', U'\x0345', U'\x03b1',
+    U'\x0314', U'\x0300', U'\x0345', U'\x03b1', U'\x0313', U'\x0301', U'\x0345', U'\x03b1',
+    U'\x0314', U'\x0301', U'\x0345', U'\x03b1', U'\x0313', U'\x0342', U'\x0345', U'\x03b1',
+    U'\x0314', U'\x0342', U'\x0345', U'\x0391', U'\x0313', U'\x0345', U'\x0391', U'\x0314',
+    U'\x0345', U'\x0391', U'\x0313', U'\x0300', U'\x0345', U'\x0391', U'\x0314', U'\x0300',
+    U'\x0345', U'\x0391', U'\x0313', U'\x0301', U'\x0345', U'\x0391', U'\x0314', U'\x0301',
+    U'\x0345', U'\x0391', U'\x0313', U'\x0342', U'\x0345', U'\x0391', U'\x0314', U'\x0342',
+    U'\x0345', U'\x03b7', U'\x0313', U'\x0345', U'\x03b7', U'\x0314', U'\x0345', U'\x03b7',
+    U'\x0313', U'\x0300', U'\x0345', U'\x03b7', U'\x0314', U'\x0300', U'\x0345', U'\x03b7',
+    U'\x0313', U'\x0301', U'\x0345', U'\x03b7', U'\x0314', U'\x0301', U'\x0345', U'\x03b7',
+    U'\x0313', U'\x0342', U'\x0345', U'\x03b7', U'\x0314', U'\x0342', U'\x0345', U'\x0397',
+    U'\x0313', U'\x0345', U'\x0397', U'\x0314', U'\x0345', U'\x0397', U'\x0313', U'\x0300',
+    U'\x0345', U'\x0397', U'\x0314', U'\x0300', U'\x0345', U'\x0397', U'\x0313', U'\x0301',
+    U'\x0345', U'\x0397', U'\x0314', U'\x0301', U'\x0345', U'\x0397', U'\x0313', U'\x0342',
+    U'\x0345', U'\x0397', U'\x0314', U'\x0342', U'\x0345', U'\x03c9', U'\x0313', U'\x0345',
+    U'\x03c9', U'\x0314', U'\x0345', U'\x03c9', U'\x0313', U'\x0300', U'\x0345', U'\x03c9',
+    U'\x0314', U'\x0300', U'\x0345', U'\x03c9', U'\x0313', U'\x0301', U'\x0345', U'\x03c9',
+    U'\x0314', U'\x0301', U'\x0345', U'\x03c9', U'\x0313', U'\x0342', U'\x0345', U'\x03c9',
+    U'\x0314', U'\x0342', U'\x0345', U'\x03a9', U'\x0313', U'\x0345', U'\x03a9', U'\x0314',
+    U'\x0345', U'\x03a9', U'\x0313', U'\x0300', U'\x0345', U'\x03a9', U'\x0314', U'\x0300',
+    U'\x0345', U'\x03a9', U'\x0313', U'\x0301', U'\x0345', U'\x03a9', U'\x0314', U'\x0301',
+    U'\x0345', U'\x03a9', U'\x0313', U'\x0342', U'\x0345', U'\x03a9', U'\x0314', U'\x0342',
+    U'\x0345', U'\x03b1', U'\x0306', U'\x03b1', U'\x0304', U'\x03b1', U'\x0300', U'\x0345',
+    U'\x03b1', U'\x0345', U'\x03b1', U'\x0301', U'\x0345', U'\x03b1', U'\x0342', U'\x03b1',
+    U'\x0342', U'\x0345', U'\x0391', U'\x0306', U'\x0391', U'\x0304', U'\x0391', U'\x0300',
+    U'\x0391', U'\x0301', U'\x0391', U'\x0345', U'\x03b9', U'\x00a8', U'\x0342', U'\x03b7',
+    U'\x0300', U'\x0345', U'\x03b7', U'\x0345', U'\x03b7', U'\x0301', U'\x0345', U'\x03b7',
+    U'\x0342', U'\x03b7', U'\x0342', U'\x0345', U'\x0395', U'\x0300', U'\x0395', U'\x0301',
+    U'\x0397', U'\x0300', U'\x0397', U'\x0301', U'\x0397', U'\x0345', U'\x1fbf', U'\x0300',
+    U'\x1fbf', U'\x0301', U'\x1fbf', U'\x0342', U'\x03b9', U'\x0306', U'\x03b9', U'\x0304',
+    U'\x03b9', U'\x0308', U'\x0300', U'\x03b9', U'\x0308', U'\x0301', U'\x03b9', U'\x0342',
+    U'\x03b9', U'\x0308', U'\x0342', U'\x0399', U'\x0306', U'\x0399', U'\x0304', U'\x0399',
+    U'\x0300', U'\x0399', U'\x0301', U'\x1ffe', U'\x0300', U'\x1ffe', U'\x0301', U'\x1ffe',
+    U'\x0342', U'\x03c5', U'\x0306', U'\x03c5', U'\x0304', U'\x03c5', U'\x0308', U'\x0300',
+    U'\x03c5', U'\x0308', U'\x0301', U'\x03c1', U'\x0313', U'\x03c1', U'\x0314', U'\x03c5',
+    U'\x0342', U'\x03c5', U'\x0308', U'\x0342', U'\x03a5', U'\x0306', U'\x03a5', U'\x0304',
+    U'\x03a5', U'\x0300', U'\x03a5', U'\x0301', U'\x03a1', U'\x0314', U'\x00a8', U'\x0300',
+    U'\x00a8', U'\x0301', U'\x0060', U'\x03c9', U'\x0300', U'\x0345', U'\x03c9', U'\x0345',
+    U'\x03c9', U'\x0301', U'\x0345', U'\x03c9', U'\x0342', U'\x03c9', U'\x0342', U'\x0345',
+    U'\x039f', U'\x0300', U'\x039f', U'\x0301', U'\x03a9', U'\x0300', U'\x03a9', U'\x0301',
+    U'\x03a9', U'\x0345', U'\x00b4', U'\x2002', U'\x2003', U'\x03a9', U'\x004b', U'\x0041',
+    U'\x030a', U'\x2190', U'\x0338', U'\x2192', U'\x0338', U'\x2194', U'\x0338', U'\x21d0',
+    U'\x0338', U'\x21d4', U'\x0338', U'\x21d2', U'\x0338', U'\x2203', U'\x0338', U'\x2208',
+    U'\x0338', U'\x220b', U'\x0338', U'\x2223', U'\x0338', U'\x2225', U'\x0338', U'\x223c',
+    U'\x0338', U'\x2243', U'\x0338', U'\x2245', U'\x0338', U'\x2248', U'\x0338', U'\x003d',
+    U'\x0338', U'\x2261', U'\x0338', U'\x224d', U'\x0338', U'\x003c', U'\x0338', U'\x003e',
+    U'\x0338', U'\x2264', U'\x0338', U'\x2265', U'\x0338', U'\x2272', U'\x0338', U'\x2273',
+    U'\x0338', U'\x2276', U'\x0338', U'\x2277', U'\x0338', U'\x227a', U'\x0338', U'\x227b',
+    U'\x0338', U'\x2282', U'\x0338', U'\x2283', U'\x0338', U'\x2286', U'\x0338', U'\x2287',
+    U'\x0338', U'\x22a2', U'\x0338', U'\x22a8', U'\x0338', U'\x22a9', U'\x0338', U'\x22ab',
+    U'\x0338', U'\x227c', U'\x0338', U'\x227d', U'\x0338', U'\x2291', U'\x0338', U'\x2292',
+    U'\x0338', U'\x22b2', U'\x0338', U'\x22b3', U'\x0338', U'\x22b4', U'\x0338', U'\x22b5',
+    U'\x0338', U'\x3008', U'\x3009', U'\x2add', U'\x0338', U'\x304b', U'\x3099', U'\x304d',
+    U'\x3099', U'\x304f', U'\x3099', U'\x3051', U'\x3099', U'\x3053', U'\x3099', U'\x3055',
+    U'\x3099', U'\x3057', U'\x3099', U'\x3059', U'\x3099', U'\x305b', U'\x3099', U'\x305d',
+    U'\x3099', U'\x305f', U'\x3099', U'\x3061', U'\x3099', U'\x3064', U'\x3099', U'\x3066',
+    U'\x3099', U'\x3068', U'\x3099', U'\x306f', U'\x3099', U'\x306f', U'\x309a', U'\x3072',
+    U'\x3099', U'\x3072', U'\x309a', U'\x3075', U'\x3099', U'\x3075', U'\x309a', U'\x3078',
+    U'\x3099', U'\x3078', U'\x309a', U'\x307b', U'\x3099', U'\x307b', U'\x309a', U'\x3046',
+    U'\x3099', U'\x309d', U'\x3099', U'\x30ab', U'\x3099', U'\x30ad', U'\x3099', U'\x30af',
+    U'\x3099', U'\x30b1', U'\x3099', U'\x30b3', U'\x3099', U'\x30b5', U'\x3099', U'\x30b7',
+    U'\x3099', U'\x30b9', U'\x3099', U'\x30bb', U'\x3099', U'\x30bd', U'\x3099', U'\x30bf',
+    U'\x3099', U'\x30c1', U'\x3099', U'\x30c4', U'\x3099', U'\x30c6', U'\x3099', U'\x30c8',
+    U'\x3099', U'\x30cf', U'\x3099', U'\x30cf', U'\x309a', U'\x30d2', U'\x3099', U'\x30d2',
+    U'\x309a', U'\x30d5', U'\x3099', U'\x30d5', U'\x309a', U'\x30d8', U'\x3099', U'\x30d8',
+    U'\x309a', U'\x30db', U'\x3099', U'\x30db', U'\x309a', U'\x30a6', U'\x3099', U'\x30ef',
+    U'\x3099', U'\x30f0', U'\x3099', U'\x30f1', U'\x3099', U'\x30f2', U'\x3099', U'\x30fd',
+    U'\x3099', U'\x8c48', U'\x66f4', U'\x8eca', U'\x8cc8', U'\x6ed1', U'\x4e32', U'\x53e5',
+    U'\x9f9c', U'\x9f9c', U'\x5951', U'\x91d1', U'\x5587', U'\x5948', U'\x61f6', U'\x7669',
+    U'\x7f85', U'\x863f', U'\x87ba', U'\x88f8', U'\x908f', U'\x6a02', U'\x6d1b', U'\x70d9',
+    U'\x73de', U'\x843d', U'\x916a', U'\x99f1', U'\x4e82', U'\x5375', U'\x6b04', U'\x721b',
+    U'\x862d', U'\x9e1e', U'\x5d50', U'\x6feb', U'\x85cd', U'\x8964', U'\x62c9', U'\x81d8',
+    U'\x881f', U'\x5eca', U'\x6717', U'\x6d6a', U'\x72fc', U'\x90ce', U'\x4f86', U'\x51b7',
+    U'\x52de', U'\x64c4', U'\x6ad3', U'\x7210', U'\x76e7', U'\x8001', U'\x8606', U'\x865c',
+    U'\x8def', U'\x9732', U'\x9b6f', U'\x9dfa', U'\x788c', U'\x797f', U'\x7da0', U'\x83c9',
+    U'\x9304', U'\x9e7f', U'\x8ad6', U'\x58df', U'\x5f04', U'\x7c60', U'\x807e', U'\x7262',
+    U'\x78ca', U'\x8cc2', U'\x96f7', U'\x58d8', U'\x5c62', U'\x6a13', U'\x6dda', U'\x6f0f',
+    U'\x7d2f', U'\x7e37', U'\x964b', U'\x52d2', U'\x808b', U'\x51dc', U'\x51cc', U'\x7a1c',
+    U'\x7dbe', U'\x83f1', U'\x9675', U'\x8b80', U'\x62cf', U'\x6a02', U'\x8afe', U'\x4e39',
+    U'\x5be7', U'\x6012', U'\x7387', U'\x7570', U'\x5317', U'\x78fb', U'\x4fbf', U'\x5fa9',
+    U'\x4e0d', U'\x6ccc', U'\x6578', U'\x7d22', U'\x53c3', U'\x585e', U'\x7701', U'\x8449',
+    U'\x8aaa', U'\x6bba', U'\x8fb0', U'\x6c88', U'\x62fe', U'\x82e5', U'\x63a0', U'\x7565',
+    U'\x4eae', U'\x5169', U'\x51c9', U'\x6881', U'\x7ce7', U'\x826f', U'\x8ad2', U'\x91cf',
+    U'\x52f5', U'\x5442', U'\x5973', U'\x5eec', U'\x65c5', U'\x6ffe', U'\x792a', U'\x95ad',
+    U'\x9a6a', U'\x9e97', U'\x9ece', U'\x529b', U'\x66c6', U'\x6b77', U'\x8f62', U'\x5e74',
+    U'\x6190', U'\x6200', U'\x649a', U'\x6f23', U'\x7149', U'\x7489', U'\x79ca', U'\x7df4',
+    U'\x806f', U'\x8f26', U'\x84ee', U'\x9023', U'\x934a', U'\x5217', U'\x52a3', U'\x54bd',
+    U'\x70c8', U'\x88c2', U'\x8aaa', U'\x5ec9', U'\x5ff5', U'\x637b', U'\x6bae', U'\x7c3e',
+    U'\x7375', U'\x4ee4', U'\x56f9', U'\x5be7', U'\x5dba', U'\x601c', U'\x73b2', U'\x7469',
+    U'\x7f9a', U'\x8046', U'\x9234', U'\x96f6', U'\x9748', U'\x9818', U'\x4f8b', U'\x79ae',
+    U'\x91b4', U'\x96b8', U'\x60e1', U'\x4e86', U'\x50da', U'\x5bee', U'\x5c3f', U'\x6599',
+    U'\x6a02', U'\x71ce', U'\x7642', U'\x84fc', U'\x907c', U'\x9f8d', U'\x6688', U'\x962e',
+    U'\x5289', U'\x677b', U'\x67f3', U'\x6d41', U'\x6e9c', U'\x7409', U'\x7559', U'\x786b',
+    U'\x7d10', U'\x985e', U'\x516d', U'\x622e', U'\x9678', U'\x502b', U'\x5d19', U'\x6dea',
+    U'\x8f2a', U'\x5f8b', U'\x6144', U'\x6817', U'\x7387', U'\x9686', U'\x5229', U'\x540f',
+    U'\x5c65', U'\x6613', U'\x674e', U'\x68a8', U'\x6ce5', U'\x7406', U'\x75e2', U'\x7f79',
+    U'\x88cf', U'\x88e1', U'\x91cc', U'\x96e2', U'\x533f', U'\x6eba', U'\x541d', U'\x71d0',
+    U'\x7498', U'\x85fa', U'\x96a3', U'\x9c57', U'\x9e9f', U'\x6797', U'\x6dcb', U'\x81e8',
+    U'\x7acb', U'\x7b20', U'\x7c92', U'\x72c0', U'\x7099', U'\x8b58', U'\x4ec0', U'\x8336',
+    U'\x523a', U'\x5207', U'\x5ea6', U'\x62d3', U'\x7cd6', U'\x5b85', U'\x6d1e', U'\x66b4',
+    U'\x8f3b', U'\x884c', U'\x964d', U'\x898b', U'\x5ed3', U'\x5140', U'\x55c0', U'\x585a',
+    U'\x6674', U'\x51de', U'\x732a', U'\x76ca', U'\x793c', U'\x795e', U'\x7965', U'\x798f',
+    U'\x9756', U'\x7cbe', U'\x7fbd', U'\x8612', U'\x8af8', U'\x9038', U'\x90fd', U'\x98ef',
+    U'\x98fc', U'\x9928', U'\x9db4', U'\x90de', U'\x96b7', U'\x4fae', U'\x50e7', U'\x514d',
+    U'\x52c9', U'\x52e4', U'\x5351', U'\x559d', U'\x5606', U'\x5668', U'\x5840', U'\x58a8',
+    U'\x5c64', U'\x5c6e', U'\x6094', U'\x6168', U'\x618e', U'\x61f2', U'\x654f', U'\x65e2',
+    U'\x6691', U'\x6885', U'\x6d77', U'\x6e1a', U'\x6f22', U'\x716e', U'\x722b', U'\x7422',
+    U'\x7891', U'\x793e', U'\x7949', U'\x7948', U'\x7950', U'\x7956', U'\x795d', U'\x798d',
+    U'\x798e', U'\x7a40', U'\x7a81', U'\x7bc0', U'\x7df4', U'\x7e09', U'\x7e41', U'\x7f72',
+    U'\x8005', U'\x81ed', U'\x8279', U'\x8279', U'\x8457', U'\x8910', U'\x8996', U'\x8b01',
+    U'\x8b39', U'\x8cd3', U'\x8d08', U'\x8fb6', U'\x9038', U'\x96e3', U'\x97ff', U'\x983b',
+    U'\x6075', U'\x242ee', U'\x8218', U'\x4e26', U'\x51b5', U'\x5168', U'\x4f80', U'\x5145',
+    U'\x5180', U'\x52c7', U'\x52fa', U'\x559d', U'\x5555', U'\x5599', U'\x55e2', U'\x585a',
+    U'\x58b3', U'\x5944', U'\x5954', U'\x5a62', U'\x5b28', U'\x5ed2', U'\x5ed9', U'\x5f69',
+    U'\x5fad', U'\x60d8', U'\x614e', U'\x6108', U'\x618e', U'\x6160', U'\x61f2', U'\x6234',
+    U'\x63c4', U'\x641c', U'\x6452', U'\x6556', U'\x6674', U'\x6717', U'\x671b', U'\x6756',
+    U'\x6b79', U'\x6bba', U'\x6d41', U'\x6edb', U'\x6ecb', U'\x6f22', U'\x701e', U'\x716e',
+    U'\x77a7', U'\x7235', U'\x72af', U'\x732a', U'\x7471', U'\x7506', U'\x753b', U'\x761d',
+    U'\x761f', U'\x76ca', U'\x76db', U'\x76f4', U'\x774a', U'\x7740', U'\x78cc', U'\x7ab1',
+    U'\x7bc0', U'\x7c7b', U'\x7d5b', U'\x7df4', U'\x7f3e', U'\x8005', U'\x8352', U'\x83ef',
+    U'\x8779', U'\x8941', U'\x8986', U'\x8996', U'\x8abf', U'\x8af8', U'\x8acb', U'\x8b01',
+    U'\x8afe', U'\x8aed', U'\x8b39', U'\x8b8a', U'\x8d08', U'\x8f38', U'\x9072', U'\x9199',
+    U'\x9276', U'\x967c', U'\x96e3', U'\x9756', U'\x97db', U'\x97ff', U'\x980b', U'\x983b',
+    U'\x9b12', U'\x9f9c', U'\x2284a', U'\x22844', U'\x233d5', U'\x3b9d', U'\x4018', U'\x4039',
+    U'\x25249', U'\x25cd0', U'\x27ed3', U'\x9f43', U'\x9f8e', U'\x05d9', U'\x05b4', U'\x05f2',
+    U'\x05b7', U'\x05e9', U'\x05c1', U'\x05e9', U'\x05c2', U'\x05e9', U'\x05bc', U'\x05c1',
+    U'\x05e9', U'\x05bc', U'\x05c2', U'\x05d0', U'\x05b7', U'\x05d0', U'\x05b8', U'\x05d0',
+    U'\x05bc', U'\x05d1', U'\x05bc', U'\x05d2', U'\x05bc', U'\x05d3', U'\x05bc', U'\x05d4',
+    U'\x05bc', U'\x05d5', U'\x05bc', U'\x05d6', U'\x05bc', U'\x05d8', U'\x05bc', U'\x05d9',
+    U'\x05bc', U'\x05da', U'\x05bc', U'\x05db', U'\x05bc', U'\x05dc', U'\x05bc', U'\x05de',
+    U'\x05bc', U'\x05e0', U'\x05bc', U'\x05e1', U'\x05bc', U'\x05e3', U'\x05bc', U'\x05e4',
+    U'\x05bc', U'\x05e6', U'\x05bc', U'\x05e7', U'\x05bc', U'\x05e8', U'\x05bc', U'\x05e9',
+    U'\x05bc', U'\x05ea', U'\x05bc', U'\x05d5', U'\x05b9', U'\x05d1', U'\x05bf', U'\x05db',
+    U'\x05bf', U'\x05e4', U'\x05bf', U'\x11099', U'\x110ba', U'\x1109b', U'\x110ba', U'\x110a5',
+    U'\x110ba', U'\x11131', U'\x11127', U'\x11132', U'\x11127', U'\x11347', U'\x1133e', U'\x11347',
+    U'\x11357', U'\x114b9', U'\x114ba', U'\x114b9', U'\x114b0', U'\x114b9', U'\x114bd', U'\x115b8',
+    U'\x115af', U'\x115b9', U'\x115af', U'\x11935', U'\x11930', U'\x1d157', U'\x1d165', U'\x1d158',
+    U'\x1d165', U'\x1d158', U'\x1d165', U'\x1d16e', U'\x1d158', U'\x1d165', U'\x1d16f', U'\x1d158',
+    U'\x1d165', U'\x1d170', U'\x1d158', U'\x1d165', U'\x1d171', U'\x1d158', U'\x1d165', U'\x1d172',
+    U'\x1d1b9', U'\x1d165', U'\x1d1ba', U'\x1d165', U'\x1d1b9', U'\x1d165', U'\x1d16e', U'\x1d1ba',
+    U'\x1d165', U'\x1d16e', U'\x1d1b9', U'\x1d165', U'\x1d16f', U'\x1d1ba', U'\x1d165', U'\x1d16f',
+    U'\x4e3d', U'\x4e38', U'\x4e41', U'\x20122', U'\x4f60', U'\x4fae', U'\x4fbb', U'\x5002',
+    U'\x507a', U'\x5099', U'\x50e7', U'\x50cf', U'\x349e', U'\x2063a', U'\x514d', U'\x5154',
+    U'\x5164', U'\x5177', U'\x2051c', U'\x34b9', U'\x5167', U'\x518d', U'\x2054b', U'\x5197',
+    U'\x51a4', U'\x4ecc', U'\x51ac', U'\x51b5', U'\x291df', U'\x51f5', U'\x5203', U'\x34df',
+    U'\x523b', U'\x5246', U'\x5272', U'\x5277', U'\x3515', U'\x52c7', U'\x52c9', U'\x52e4',
+    U'\x52fa', U'\x5305', U'\x5306', U'\x5317', U'\x5349', U'\x5351', U'\x535a', U'\x5373',
+    U'\x537d', U'\x537f', U'\x537f', U'\x537f', U'\x20a2c', U'\x7070', U'\x53ca', U'\x53df',
+    U'\x20b63', U'\x53eb', U'\x53f1', U'\x5406', U'\x549e', U'\x5438', U'\x5448', U'\x5468',
+    U'\x54a2', U'\x54f6', U'\x5510', U'\x5553', U'\x5563', U'\x5584', U'\x5584', U'\x5599',
+    U'\x55ab', U'\x55b3', U'\x55c2', U'\x5716', U'\x5606', U'\x5717', U'\x5651', U'\x5674',
+    U'\x5207', U'\x58ee', U'\x57ce', U'\x57f4', U'\x580d', U'\x578b', U'\x5832', U'\x5831',
+    U'\x58ac', U'\x214e4', U'\x58f2', U'\x58f7', U'\x5906', U'\x591a', U'\x5922', U'\x5962',
+    U'\x216a8', U'\x216ea', U'\x59ec', U'\x5a1b', U'\x5a27', U'\x59d8', U'\x5a66', U'\x36ee',
+    U'\x36fc', U'\x5b08', U'\x5b3e', U'\x5b3e', U'\x219c8', U'\x5bc3', U'\x5bd8', U'\x5be7',
+    U'\x5bf3', U'\x21b18', U'\x5bff', U'\x5c06', U'\x5f53', U'\x5c22', U'\x3781', U'\x5c60',
+    U'\x5c6e', U'\x5cc0', U'\x5c8d', U'\x21de4', U'\x5d43', U'\x21de6', U'\x5d6e', U'\x5d6b',
+    U'\x5d7c', U'\x5de1', U'\x5de2', U'\x382f', U'\x5dfd', U'\x5e28', U'\x5e3d', U'\x5e69',
+    U'\x3862', U'\x22183', U'\x387c', U'\x5eb0', U'\x5eb3', U'\x5eb6', U'\x5eca', U'\x2a392',
+    U'\x5efe', U'\x22331', U'\x22331', U'\x8201', U'\x5f22', U'\x5f22', U'\x38c7', U'\x232b8',
+    U'\x261da', U'\x5f62', U'\x5f6b', U'\x38e3', U'\x5f9a', U'\x5fcd', U'\x5fd7', U'\x5ff9',
+    U'\x6081', U'\x393a', U'\x391c', U'\x6094', U'\x226d4', U'\x60c7', U'\x6148', U'\x614c',
+    U'\x614e', U'\x614c', U'\x617a', U'\x618e', U'\x61b2', U'\x61a4', U'\x61af', U'\x61de',
+    U'\x61f2', U'\x61f6', U'\x6210', U'\x621b', U'\x625d', U'\x62b1', U'\x62d4', U'\x6350',
+    U'\x22b0c', U'\x633d', U'\x62fc', U'\x6368', U'\x6383', U'\x63e4', U'\x22bf1', U'\x6422',
+    U'\x63c5', U'\x63a9', U'\x3a2e', U'\x6469', U'\x647e', U'\x649d', U'\x6477', U'\x3a6c',
+    U'\x654f', U'\x656c', U'\x2300a', U'\x65e3', U'\x66f8', U'\x6649', U'\x3b19', U'\x6691',
+    U'\x3b08', U'\x3ae4', U'\x5192', U'\x5195', U'\x6700', U'\x669c', U'\x80ad', U'\x43d9',
+    U'\x6717', U'\x671b', U'\x6721', U'\x675e', U'\x6753', U'\x233c3', U'\x3b49', U'\x67fa',
+    U'\x6785', U'\x6852', U'\x6885', U'\x2346d', U'\x688e', U'\x681f', U'\x6914', U'\x3b9d',
+    U'\x6942', U'\x69a3', U'\x69ea', U'\x6aa8', U'\x236a3', U'\x6adb', U'\x3c18', U'\x6b21',
+    U'\x238a7', U'\x6b54', U'\x3c4e', U'\x6b72', U'\x6b9f', U'\x6bba', U'\x6bbb', U'\x23a8d',
+    U'\x21d0b', U'\x23afa', U'\x6c4e', U'\x23cbc', U'\x6cbf', U'\x6ccd', U'\x6c67', U'\x6d16',
+    U'\x6d3e', U'\x6d77', U'\x6d41', U'\x6d69', U'\x6d78', U'\x6d85', U'\x23d1e', U'\x6d34',
+    U'\x6e2f', U'\x6e6e', U'\x3d33', U'\x6ecb', U'\x6ec7', U'\x23ed1', U'\x6df9', U'\x6f6e',
+    U'\x23f5e', U'\x23f8e', U'\x6fc6', U'\x7039', U'\x701e', U'\x701b', U'\x3d96', U'\x704a',
+    U'\x707d', U'\x7077', U'\x70ad', U'\x20525', U'\x7145', U'\x24263', U'\x719c', U'\x243ab',
+    U'\x7228', U'\x7235', U'\x7250', U'\x24608', U'\x7280', U'\x7295', U'\x24735', U'\x24814',
+    U'\x737a', U'\x738b', U'\x3eac', U'\x73a5', U'\x3eb8', U'\x3eb8', U'\x7447', U'\x745c',
+    U'\x7471', U'\x7485', U'\x74ca', U'\x3f1b', U'\x7524', U'\x24c36', U'\x753e', U'\x24c92',
+    U'\x7570', U'\x2219f', U'\x7610', U'\x24fa1', U'\x24fb8', U'\x25044', U'\x3ffc', U'\x4008',
+    U'\x76f4', U'\x250f3', U'\x250f2', U'\x25119', U'\x25133', U'\x771e', U'\x771f', U'\x771f',
+    U'\x774a', U'\x4039', U'\x778b', U'\x4046', U'\x4096', U'\x2541d', U'\x784e', U'\x788c',
+    U'\x78cc', U'\x40e3', U'\x25626', U'\x7956', U'\x2569a', U'\x256c5', U'\x798f', U'\x79eb',
+    U'\x412f', U'\x7a40', U'\x7a4a', U'\x7a4f', U'\x2597c', U'\x25aa7', U'\x25aa7', U'\x7aee',
+    U'\x4202', U'\x25bab', U'\x7bc6', U'\x7bc9', U'\x4227', U'\x25c80', U'\x7cd2', U'\x42a0',
+    U'\x7ce8', U'\x7ce3', U'\x7d00', U'\x25f86', U'\x7d63', U'\x4301', U'\x7dc7', U'\x7e02',
+    U'\x7e45', U'\x4334', U'\x26228', U'\x26247', U'\x4359', U'\x262d9', U'\x7f7a', U'\x2633e',
+    U'\x7f95', U'\x7ffa', U'\x8005', U'\x264da', U'\x26523', U'\x8060', U'\x265a8', U'\x8070',
+    U'\x2335f', U'\x43d5', U'\x80b2', U'\x8103', U'\x440b', U'\x813e', U'\x5ab5', U'\x267a7',
+    U'\x267b5', U'\x23393', U'\x2339c', U'\x8201', U'\x8204', U'\x8f9e', U'\x446b', U'\x8291',
+    U'\x828b', U'\x829d', U'\x52b3', U'\x82b1', U'\x82b3', U'\x82bd', U'\x82e6', U'\x26b3c',
+    U'\x82e5', U'\x831d', U'\x8363', U'\x83ad', U'\x8323', U'\x83bd', U'\x83e7', U'\x8457',
+    U'\x8353', U'\x83ca', U'\x83cc', U'\x83dc', U'\x26c36', U'\x26d6b', U'\x26cd5', U'\x452b',
+    U'\x84f1', U'\x84f3', U'\x8516', U'\x273ca', U'\x8564', U'\x26f2c', U'\x455d', U'\x4561',
+    U'\x26fb1', U'\x270d2', U'\x456b', U'\x8650', U'\x865c', U'\x8667', U'\x8669', U'\x86a9',
+    U'\x8688', U'\x870e', U'\x86e2', U'\x8779', U'\x8728', U'\x876b', U'\x8786', U'\x45d7',
+    U'\x87e1', U'\x8801', U'\x45f9', U'\x8860', U'\x8863', U'\x27667', U'\x88d7', U'\x88de',
+    U'\x4635', U'\x88fa', U'\x34bb', U'\x278ae', U'\x27966', U'\x46be', U'\x46c7', U'\x8aa0',
+    U'\x8aed', U'\x8b8a', U'\x8c55', U'\x27ca8', U'\x8cab', U'\x8cc1', U'\x8d1b', U'\x8d77',
+    U'\x27f2f', U'\x20804', U'\x8dcb', U'\x8dbc', U'\x8df0', U'\x208de', U'\x8ed4', U'\x8f38',
+    U'\x285d2', U'\x285ed', U'\x9094', U'\x90f1', U'\x9111', U'\x2872e', U'\x911b', U'\x9238',
+    U'\x92d7', U'\x92d8', U'\x927c', U'\x93f9', U'\x9415', U'\x28bfa', U'\x958b', U'\x4995',
+    U'\x95b7', U'\x28d77', U'\x49e6', U'\x96c3', U'\x5db2', U'\x9723', U'\x29145', U'\x2921a',
+    U'\x4a6e', U'\x4a76', U'\x97e0', U'\x2940a', U'\x4ab2', U'\x29496', U'\x980b', U'\x980b',
+    U'\x9829', U'\x295b6', U'\x98e2', U'\x4b33', U'\x9929', U'\x99a7', U'\x99c2', U'\x99fe',
+    U'\x4bce', U'\x29b30', U'\x9b12', U'\x9c40', U'\x9cfd', U'\x4cce', U'\x4ced', U'\x9d67',
+    U'\x2a0ce', U'\x4cf8', U'\x2a105', U'\x2a20e', U'\x2a291', U'\x9ebb', U'\x4d56', U'\x9ef9',
+    U'\x9efe', U'\x9f05', U'\x9f0f', U'\x9f16', U'\x9f3b', U'\x2a600',
+}};
+
+/// Canonical compositions of primary composites, sorted by the pair of code
+/// points they compose
+struct composition {
+  char32_t first;
+  char32_t second;
+  char32_t composite;
+};
+
+inline constexpr auto compositions = std::array<composition, 941>{{
+    {U'\x003c', U'\x0338', U'\x226e'},
+    {U'\x003d', U'\x0338', U'\x2260'},
+    {U'\x003e', U'\x0338', U'\x226f'},
+    {U'\x0041', U'\x0300', U'\x00c0'},
+    {U'\x0041', U'\x0301', U'\x00c1'},
+    {U'\x0041', U'\x0302', U'\x00c2'},
+    {U'\x0041', U'\x0303', U'\x00c3'},
+    {U'\x0041', U'\x0304', U'\x0100'},
+    {U'\x0041', U'\x0306', U'\x0102'},
+    {U'\x0041', U'\x0307', U'\x0226'},
+    {U'\x0041', U'\x0308', U'\x00c4'},
+    {U'\x0041', U'\x0309', U'\x1ea2'},
+    {U'\x0041', U'\x030a', U'\x00c5'},
+    {U'\x0041', U'\x030c', U'\x01cd'},
+    {U'\x0041', U'\x030f', U'\x0200'},
+    {U'\x0041', U'\x0311', U'\x0202'},
+    {U'\x0041', U'\x0323', U'\x1ea0'},
+    {U'\x0041', U'\x0325', U'\x1e00'},
+    {U'\x0041', U'\x0328', U'\x0104'},
+    {U'\x0042', U'\x0307', U'\x1e02'},
+    {U'\x0042', U'\x0323', U'\x1e04'},
+    {U'\x0042', U'\x0331', U'\x1e06'},
+    {U'\x0043', U'\x0301', U'\x0106'},
+    {U'\x0043', U'\x0302', U'\x0108'},
+    {U'\x0043', U'\x0307', U'\x010a'},
+    {U'\x0043', U'\x030c', U'\x010c'},
+    {U'\x0043', U'\x0327', U'\x00c7'},
+    {U'\x0044', U'\x0307', U'\x1e0a'},
+    {U'\x0044', U'\x030c', U'\x010e'},
+    {U'\x0044', U'\x0323', U'\x1e0c'},
+    {U'\x0044', U'\x0327', U'\x1e10'},
+    {U'\x0044', U'\x032d', U'\x1e12'},
+    {U'\x0044', U'\x0331', U'\x1e0e'},
+    {U'\x0045', U'\x0300', U'\x00c8'},
+    {U'\x0045', U'\x0301', U'\x00c9'},
+    {U'\x0045', U'\x0302', U'\x00ca'},
+    {U'\x0045', U'\x0303', U'\x1ebc'},
+    {U'\x0045', U'\x0304', U'\x0112'},
+    {U'\x0045', U'\x0306', U'\x0114'},
+    {U'\x0045', U'\x0307', U'\x0116'},
+    {U'\x0045', U'\x0308', U'\x00cb'},
+    {U'\x0045', U'\x0309', U'\x1eba'},
+    {U'\x0045', U'\x030c', U'\x011a'},
+    {U'\x0045', U'\x030f', U'\x0204'},
+    {U'\x0045', U'\x0311', U'\x0206'},
+    {U'\x0045', U'\x0323', U'\x1eb8'},
+    {U'\x0045', U'\x0327', U'\x0228'},
+    {U'\x0045', U'\x0328', U'\x0118'},
+    {U'\x0045', U'\x032d', U'\x1e18'},
+    {U'\x0045', U'\x0330', U'\x1e1a'},
+    {U'\x0046', U'\x0307', U'\x1e1e'},
+    {U'\x0047', U'\x0301', U'\x01f4'},
+    {U'\x0047', U'\x0302', U'\x011c'},
+    {U'\x0047', U'\x0304', U'\x1e20'},
+    {U'\x0047', U'\x0306', U'\x011e'},
+    {U'\x0047', U'\x0307', U'\x0120'},
+    {U'\x0047', U'\x030c', U'\x01e6'},
+    {U'\x0047', U'\x0327', U'\x0122'},
+    {U'\x0048', U'\x0302', U'\x0124'},
+    {U'\x0048', U'\x0307', U'\x1e22'},
+    {U'\x0048', U'\x0308', U'\x1e26'},
+    {U'\x0048', U'\x030c', U'\x021e'},
+    {U'\x0048', U'\x0323', U'\x1e24'},
+    {U'\x0048', U'\x0327', U'\x1e28'},
+    {U'\x0048', U'\x032e', U'\x1e2a'},
+    {U'\x0049', U'\x0300', U'\x00cc'},
+    {U'\x0049', U'\x0301', U'\x00cd'},
+    {U'\x0049', U'\x0302', U'\x00ce'},
+    {U'\x0049', U'\x0303', U'\x0128'},
+    {U'\x0049', U'\x0304', U'\x012a'},
+    {U'\x0049', U'\x0306', U'\x012c'},
+    {U'\x0049', U'\x0307', U'\x0130'},
+    {U'\x0049', U'\x0308', U'\x00cf'},
+    {U'\x0049', U'\x0309', U'\x1ec8'},
+    {U'\x0049', U'\x030c', U'\x01cf'},
+    {U'\x0049', U'\x030f', U'\x0208'},
+    {U'\x0049', U'\x0311', U'\x020a'},
+    {U'\x0049', U'\x0323', U'\x1eca'},
+    {U'\x0049', U'\x0328', U'\x012e'},
+    {U'\x0049', U'\x0330', U'\x1e2c'},
+    {U'\x004a', U'\x0302', U'\x0134'},
+    {U'\x004b', U'\x0301', U'\x1e30'},
+    {U'\x004b', U'\x030c', U'\x01e8'},
+    {U'\x004b', U'\x0323', U'\x1e32'},
+    {U'\x004b', U'\x0327', U'\x0136'},
+    {U'\x004b', U'\x0331', U'\x1e34'},
+    {U'\x004c', U'\x0301', U'\x0139'},
+    {U'\x004c', U'\x030c', U'\x013d'},
+    {U'\x004c', U'\x0323', U'\x1e36'},
+    {U'\x004c', U'\x0327', U'\x013b'},
+    {U'\x004c', U'\x032d', U'\x1e3c'},
+    {U'\x004c', U'\x0331', U'\x1e3a'},
+    {U'\x004d', U'\x0301', U'\x1e3e'},
+    {U'\x004d', U'\x0307', U'\x1e40'},
+    {U'\x004d', U'\x0323', U'\x1e42'},
+    {U'\x004e', U'\x0300', U'\x01f8'},
+    {U'\x004e', U'\x0301', U'\x0143'},
+    {U'\x004e', U'\x0303', U'\x00d1'},
+    {U'\x004e', U'\x0307', U'\x1e44'},
+    {U'\x004e', U'\x030c', U'\x0147'},
+    {U'\x004e', U'\x0323', U'\x1e46'},
+    {U'\x004e', U'\x0327', U'\x0145'},
+    {U'\x004e', U'\x032d', U'\x1e4a'},
+    {U'\x004e', U'\x0331', U'\x1e48'},
+    {U'\x004f', U'\x0300', U'\x00d2'},
+    {U'\x004f', U'\x0301', U'\x00d3'},
+    {U'\x004f', U'\x0302', U'\x00d4'},
+    {U'\x004f', U'\x0303', U'\x00d5'},
+    {U'\x004f', U'\x0304', U'\x014c'},
+    {U'\x004f', U'\x0306', U'\x014e'},
+    {U'\x004f', U'\x0307', U'\x022e'},
+    {U'\x004f', U'\x0308', U'\x00d6'},
+    {U'\x004f', U'\x0309', U'\x1ece'},
+    {U'\x004f', U'\x030b', U'\x0150'},
+    {U'\x004f', U'\x030c', U'\x01d1'},
+    {U'\x004f', U'\x030f', U'\x020c'},
+    {U'\x004f', U'\x0311', U'\x020e'},
+    {U'\x004f', U'\x031b', U'\x01a0'},
+    {U'\x004f', U'\x0323', U'\x1ecc'},
+    {U'\x004f', U'\x0328', U'\x01ea'},
+    {U'\x0050', U'\x0301', U'\x1e54'},
+    {U'\x0050', U'\x0307', U'\x1e56'},
+    {U'\x0052', U'\x0301', U'\x0154'},
+    {U'\x0052', U'\x0307', U'\x1e58'},
+    {U'\x0052', U'\x030c', U'\x0158'},
+    {U'\x0052', U'\x030f', U'\x0210'},
+    {U'\x0052', U'\x0311', U'\x0212'},
+    {U'\x0052', U'\x0323', U'\x1e5a'},
+    {U'\x0052', U'\x0327', U'\x0156'},
+    {U'\x0052', U'\x0331', U'\x1e5e'},
+    {U'\x0053', U'\x0301', U'\x015a'},
+    {U'\x0053', U'\x0302', U'\x015c'},
+    {U'\x0053', U'\x0307', U'\x1e60'},
+    {U'\x0053', U'\x030c', U'\x0160'},
+    {U'\x0053', U'\x0323', U'\x1e62'},
+    {U'\x0053', U'\x0326', U'\x0218'},
+    {U'\x0053', U'\x0327', U'\x015e'},
+    {U'\x0054', U'\x0307', U'\x1e6a'},
+    {U'\x0054', U'\x030c', U'\x0164'},
+    {U'\x0054', U'\x0323', U'\x1e6c'},
+    {U'\x0054', U'\x0326', U'\x021a'},
+    {U'\x0054', U'\x0327', U'\x0162'},
+    {U'\x0054', U'\x032d', U'\x1e70'},
+    {U'\x0054', U'\x0331', U'\x1e6e'},
+    {U'\x0055', U'\x0300', U'\x00d9'},
+    {U'\x0055', U'\x0301', U'\x00da'},
+    {U'\x0055', U'\x0302', U'\x00db'},
+    {U'\x0055', U'\x0303', U'\x0168'},
+    {U'\x0055', U'\x0304', U'\x016a'},
+    {U'\x0055', U'\x0306', U'\x016c'},
+    {U'\x0055', U'\x0308', U'\x00dc'},
+    {U'\x0055', U'\x0309', U'\x1ee6'},
+    {U'\x0055', U'\x030a', U'\x016e'},
+    {U'\x0055', U'\x030b', U'\x0170'},
+    {U'\x0055', U'\x030c', U'\x01d3'},
+    {U'\x0055', U'\x030f', U'\x0214'},
+    {U'\x0055', U'\x0311', U'\x0216'},
+    {U'\x0055', U'\x031b', U'\x01af'},
+    {U'\x0055', U'\x0323', U'\x1ee4'},
+    {U'\x0055', U'\x0324', U'\x1e72'},
+    {U'\x0055', U'\x0328', U'\x0172'},
+    {U'\x0055', U'\x032d', U'\x1e76'},
+    {U'\x0055', U'\x0330', U'\x1e74'},
+    {U'\x0056', U'\x0303', U'\x1e7c'},
+    {U'\x0056', U'\x0323', U'\x1e7e'},
+    {U'\x0057', U'\x0300', U'\x1e80'},
+    {U'\x0057', U'\x0301', U'\x1e82'},
+    {U'\x0057', U'\x0302', U'\x0174'},
+    {U'\x0057', U'\x0307', U'\x1e86'},
+    {U'\x0057', U'\x0308', U'\x1e84'},
+    {U'\x0057', U'\x0323', U'\x1e88'},
+    {U'\x0058', U'\x0307', U'\x1e8a'},
+    {U'\x0058', U'\x0308', U'\x1e8c'},
+    {U'\x0059', U'\x0300', U'\x1ef2'},
+    {U'\x0059', U'\x0301', U'\x00dd'},
+    {U'\x0059', U'\x0302', U'\x0176'},
+    {U'\x0059', U'\x0303', U'\x1ef8'},
+    {U'\x0059', U'\x0304', U'\x0232'},
+    {U'\x0059', U'\x0307', U'\x1e8e'},
+    {U'\x0059', U'\x0308', U'\x0178'},
+    {U'\x0059', U'\x0309', U'\x1ef6'},
+    {U'\x0059', U'\x0323', U'\x1ef4'},
+    {U'\x005a', U'\x0301', U'\x0179'},
+    {U'\x005a', U'\x0302', U'\x1e90'},
+    {U'\x005a', U'\x0307', U'\x017b'},
+    {U'\x005a', U'\x030c', U'\x017d'},
+    {U'\x005a', U'\x0323', U'\x1e92'},
+    {U'\x005a', U'\x0331', U'\x1e94'},
+    {U'\x0061', U'\x0300', U'\x00e0'},
+    {U'\x0061', U'\x0301', U'\x00e1'},
+    {U'\x0061', U'\x0302', U'\x00e2'},
+    {U'\x0061', U'\x0303', U'\x00e3'},
+    {U'\x0061', U'\x0304', U'\x0101'},
+    {U'\x0061', U'\x0306', U'\x0103'},
+    {U'\x0061', U'\x0307', U'\x0227'},
+    {U'\x0061', U'\x0308', U'\x00e4'},
+    {U'\x0061', U'\x0309', U'\x1ea3'},
+    {U'\x0061', U'\x030a', U'\x00e5'},
+    {U'\x0061', U'\x030c', U'\x01ce'},
+    {U'\x0061', U'\x030f', U'\x0201'},
+    {U'\x0061', U'\x0311', U'\x0203'},
+    {U'\x0061', U'\x0323', U'\x1ea1'},
+    {U'\x0061', U'\x0325', U'\x1e01'},
+    {U'\x0061', U'\x0328', U'\x0105'},
+    {U'\x0062', U'\x0307', U'\x1e03'},
+    {U'\x0062', U'\x0323', U'\x1e05'},
+    {U'\x0062', U'\x0331', U'\x1e07'},
+    {U'\x0063', U'\x0301', U'\x0107'},
+    {U'\x0063', U'\x0302', U'\x0109'},
+    {U'\x0063', U'\x0307', U'\x010b'},
+    {U'\x0063', U'\x030c', U'\x010d'},
+    {U'\x0063', U'\x0327', U'\x00e7'},
+    {U'\x0064', U'\x0307', U'\x1e0b'},
+    {U'\x0064', U'\x030c', U'\x010f'},
+    {U'\x0064', U'\x0323', U'\x1e0d'},
+    {U'\x0064', U'\x0327', U'\x1e11'},
+    {U'\x0064', U'\x032d', U'\x1e13'},
+    {U'\x0064', U'\x0331', U'\x1e0f'},
+    {U'\x0065', U'\x0300', U'\x00e8'},
+    {U'\x0065', U'\x0301', U'\x00e9'},
+    {U'\x0065', U'\x0302', U'\x00ea'},
+    {U'\x0065', U'\x0303', U'\x1ebd'},
+    {U'\x0065', U'\x0304', U'\x0113'},
+    {U'\x0065', U'\x0306', U'\x0115'},
+    {U'\x0065', U'\x0307', U'\x0117'},
+    {U'\x0065', U'\x0308', U'\x00eb'},
+    {U'\x0065', U'\x0309', U'\x1ebb'},
+    {U'\x0065', U'\x030c', U'\x011b'},
+    {U'\x0065', U'\x030f', U'\x0205'},
+    {U'\x0065', U'\x0311', U'\x0207'},
+    {U'\x0065', U'\x0323', U'\x1eb9'},
+    {U'\x0065', U'\x0327', U'\x0229'},
+    {U'\x0065', U'\x0328', U'\x0119'},
+    {U'\x0065', U'\x032d', U'\x1e19'},
+    {U'\x0065', U'\x0330', U'\x1e1b'},
+    {U'\x0066', U'\x0307', U'\x1e1f'},
+    {U'\x0067', U'\x0301', U'\x01f5'},
+    {U'\x0067', U'\x0302', U'\x011d'},
+    {U'\x0067', U'\x0304', U'\x1e21'},
+    {U'\x0067', U'\x0306', U'\x011f'},
+    {U'\x0067', U'\x0307', U'\x0121'},
+    {U'\x0067', U'\x030c', U'\x01e7'},
+    {U'\x0067', U'\x0327', U'\x0123'},
+    {U'\x0068', U'\x0302', U'\x0125'},
+    {U'\x0068', U'\x0307', U'\x1e23'},
+    {U'\x0068', U'\x0308', U'\x1e27'},
+    {U'\x0068', U'\x030c', U'\x021f'},
+    {U'\x0068', U'\x0323', U'\x1e25'},
+    {U'\x0068', U'\x0327', U'\x1e29'},
+    {U'\x0068', U'\x032e', U'\x1e2b'},
+    {U'\x0068', U'\x0331', U'\x1e96'},
+    {U'\x0069', U'\x0300', U'\x00ec'},
+    {U'\x0069', U'\x0301', U'\x00ed'},
+    {U'\x0069', U'\x0302', U'\x00ee'},
+    {U'\x0069', U'\x0303', U'\x0129'},
+    {U'\x0069', U'\x0304', U'\x012b'},
+    {U'\x0069', U'\x0306', U'\x012d'},
+    {U'\x0069', U'\x0308', U'\x00ef'},
+    {U'\x0069', U'\x0309', U'\x1ec9'},
+    {U'\x0069', U'\x030c', U'\x01d0'},
+    {U'\x0069', U'\x030f', U'\x0209'},
+    {U'\x0069', U'\x0311', U'\x020b'},
+    {U'\x0069', U'\x0323', U'\x1ecb'},
+    {U'\x0069', U'\x0328', U'\x012f'},
+    {U'\x0069', U'\x0330', U'\x1e2d'},
+    {U'\x006a', U'\x0302', U'\x0135'},
+    {U'\x006a', U'\x030c', U'\x01f0'},
+    {U'\x006b', U'\x0301', U'\x1e31'},
+    {U'\x006b', U'\x030c', U'\x01e9'},
+    {U'\x006b', U'\x0323', U'\x1e33'},
+    {U'\x006b', U'\x0327', U'\x0137'},
+    {U'\x006b', U'\x0331', U'\x1e35'},
+    {U'\x006c', U'\x0301', U'\x013a'},
+    {U'\x006c', U'\x030c', U'\x013e'},
+    {U'\x006c', U'\x0323', U'\x1e37'},
+    {U'\x006c', U'\x0327', U'\x013c'},
+    {U'\x006c', U'\x032d', U'\x1e3d'},
+    {U'\x006c', U'\x0331', U'\x1e3b'},
+    {U'\x006d', U'\x0301', U'\x1e3f'},
+    {U'\x006d', U'\x0307', U'\x1e41'},
+    {U'\x006d', U'\x0323', U'\x1e43'},
+    {U'\x006e', U'\x0300', U'\x01f9'},
+    {U'\x006e', U'\x0301', U'\x0144'},
+    {U'\x006e', U'\x0303', U'\x00f1'},
+    {U'\x006e', U'\x0307', U'\x1e45'},
+    {U'\x006e', U'\x030c', U'\x0148'},
+    {U'\x006e', U'\x0323', U'\x1e47'},
+    {U'\x006e', U'\x0327', U'\x0146'},
+    {U'\x006e', U'\x032d', U'\x1e4b'},
+    {U'\x006e', U'\x0331', U'\x1e49'},
+    {U'\x006f', U'\x0300', U'\x00f2'},
+    {U'\x006f', U'\x0301', U'\x00f3'},
+    {U'\x006f', U'\x0302', U'\x00f4'},
+    {U'\x006f', U'\x0303', U'\x00f5'},
+    {U'\x006f', U'\x0304', U'\x014d'},
+    {U'\x006f', U'\x0306', U'\x014f'},
+    {U'\x006f', U'\x0307', U'\x022f'},
+    {U'\x006f', U'\x0308', U'\x00f6'},
+    {U'\x006f', U'\x0309', U'\x1ecf'},
+    {U'\x006f', U'\x030b', U'\x0151'},
+    {U'\x006f', U'\x030c', U'\x01d2'},
+    {U'\x006f', U'\x030f', U'\x020d'},
+    {U'\x006f', U'\x0311', U'\x020f'},
+    {U'\x006f', U'\x031b', U'\x01a1'},
+    {U'\x006f', U'\x0323', U'\x1ecd'},
+    {U'\x006f', U'\x0328', U'\x01eb'},
+    {U'\x0070', U'\x0301', U'\x1e55'},
+    {U'\x0070', U'\x0307', U'\x1e57'},
+    {U'\x0072', U'\x0301', U'\x0155'},
+    {U'\x0072', U'\x0307', U'\x1e59'},
+    {U'\x0072', U'\x030c', U'\x0159'},
+    {U'\x0072', U'\x030f', U'\x0211'},
+    {U'\x0072', U'\x0311', U'\x0213'},
+    {U'\x0072', U'\x0323', U'\x1e5b'},
+    {U'\x0072', U'\x0327', U'\x0157'},
+    {U'\x0072', U'\x0331', U'\x1e5f'},
+    {U'\x0073', U'\x0301', U'\x015b'},
+    {U'\x0073', U'\x0302', U'\x015d'},
+    {U'\x0073', U'\x0307', U'\x1e61'},
+    {U'\x0073', U'\x030c', U'\x0161'},
+    {U'\x0073', U'\x0323', U'\x1e63'},
+    {U'\x0073', U'\x0326', U'\x0219'},
+    {U'\x0073', U'\x0327', U'\x015f'},
+    {U'\x0074', U'\x0307', U'\x1e6b'},
+    {U'\x0074', U'\x0308', U'\x1e97'},
+    {U'\x0074', U'\x030c', U'\x0165'},
+    {U'\x0074', U'\x0323', U'\x1e6d'},
+    {U'\x0074', U'\x0326', U'\x021b'},
+    {U'\x0074', U'\x0327', U'\x0163'},
+    {U'\x0074', U'\x032d', U'\x1e71'},
+    {U'\x0074', U'\x0331', U'\x1e6f'},
+    {U'\x0075', U'\x0300', U'\x00f9'},
+    {U'\x0075', U'\x0301', U'\x00fa'},
+    {U'\x0075', U'\x0302', U'\x00fb'},
+    {U'\x0075', U'\x0303', U'\x0169'},
+    {U'\x0075', U'\x0304', U'\x016b'},
+    {U'\x0075', U'\x0306', U'\x016d'},
+    {U'\x0075', U'\x0308', U'\x00fc'},
+    {U'\x0075', U'\x0309', U'\x1ee7'},
+    {U'\x0075', U'\x030a', U'\x016f'},
+    {U'\x0075', U'\x030b', U'\x0171'},
+    {U'\x0075', U'\x030c', U'\x01d4'},
+    {U'\x0075', U'\x030f', U'\x0215'},
+    {U'\x0075', U'\x0311', U'\x0217'},
+    {U'\x0075', U'\x031b', U'\x01b0'},
+    {U'\x0075', U'\x0323', U'\x1ee5'},
+    {U'\x0075', U'\x0324', U'\x1e73'},
+    {U'\x0075', U'\x0328', U'\x0173'},
+    {U'\x0075', U'\x032d', U'\x1e77'},
+    {U'\x0075', U'\x0330', U'\x1e75'},
+    {U'\x0076', U'\x0303', U'\x1e7d'},
+    {U'\x0076', U'\x0323', U'\x1e7f'},
+    {U'\x0077', U'\x0300', U'\x1e81'},
+    {U'\x0077', U'\x0301', U'\x1e83'},
+    {U'\x0077', U'\x0302', U'\x0175'},
+    {U'\x0077', U'\x0307', U'\x1e87'},
+    {U'\x0077', U'\x0308', U'\x1e85'},
+    {U'\x0077', U'\x030a', U'\x1e98'},
+    {U'\x0077', U'\x0323', U'\x1e89'},
+    {U'\x0078', U'\x0307', U'\x1e8b'},
+    {U'\x0078', U'\x0308', U'\x1e8d'},
+    {U'\x0079', U'\x0300', U'\x1ef3'},
+    {U'\x0079', U'\x0301', U'\x00fd'},
+    {U'\x0079', U'\x0302', U'\x0177'},
+    {U'\x0079', U'\x0303', U'\x1ef9'},
+    {U'\x0079', U'\x0304', U'\x0233'},
+    {U'\x0079', U'\x0307', U'\x1e8f'},
+    {U'\x0079', U'\x0308', U'\x00ff'},
+    {U'\x0079', U'\x0309', U'\x1ef7'},
+    {U'\x0079', U'\x030a', U'\x1e99'},
+    {U'\x0079', U'\x0323', U'\x1ef5'},
+    {U'\x007a', U'\x0301', U'\x017a'},
+    {U'\x007a', U'\x0302', U'\x1e91'},
+    {U'\x007a', U'\x0307', U'\x017c'},
+    {U'\x007a', U'\x030c', U'\x017e'},
+    {U'\x007a', U'\x0323', U'\x1e93'},
+    {U'\x007a', U'\x0331', U'\x1e95'},
+    {U'\x00a8', U'\x0300', U'\x1fed'},
+    {U'\x00a8', U'\x0301', U'\x0385'},
+    {U'\x00a8', U'\x0342', U'\x1fc1'},
+    {U'\x00c2', U'\x0300', U'\x1ea6'},
+    {U'\x00c2', U'\x0301', U'\x1ea4'},
+    {U'\x00c2', U'\x0303', U'\x1eaa'},
+    {U'\x00c2', U'\x0309', U'\x1ea8'},
+    {U'\x00c4', U'\x0304', U'\x01de'},
+    {U'\x00c5', U'\x0301', U'\x01fa'},
+    {U'\x00c6', U'\x0301', U'\x01fc'},
+    {U'\x00c6', U'\x0304', U'\x01e2'},
+    {U'\x00c7', U'\x0301', U'\x1e08'},
+    {U'\x00ca', U'\x0300', U'\x1ec0'},
+    {U'\x00ca', U'\x0301', U'\x1ebe'},
+    {U'\x00ca', U'\x0303', U'\x1ec4'},
+    {U'\x00ca', U'\x0309', U'\x1ec2'},
+    {U'\x00cf', U'\x0301', U'\x1e2e'},
+    {U'\x00d4', U'\x0300', U'\x1ed2'},
+    {U'\x00d4', U'\x0301', U'\x1ed0'},
+    {U'\x00d4', U'\x0303', U'\x1ed6'},
+    {U'\x00d4', U'\x0309', U'\x1ed4'},
+    {U'\x00d5', U'\x0301', U'\x1e4c'},
+    {U'\x00d5', U'\x0304', U'\x022c'},
+    {U'\x00d5', U'\x0308', U'\x1e4e'},
+    {U'\x00d6', U'\x0304', U'\x022a'},
+    {U'\x00d8', U'\x0301', U'\x01fe'},
+    {U'\x00dc', U'\x0300', U'\x01db'},
+    {U'\x00dc', U'\x0301', U'\x01d7'},
+    {U'\x00dc', U'\x0304', U'\x01d5'},
+    {U'\x00dc', U'\x030c', U'\x01d9'},
+    {U'\x00e2', U'\x0300', U'\x1ea7'},
+    {U'\x00e2', U'\x0301', U'\x1ea5'},
+    {U'\x00e2', U'\x0303', U'\x1eab'},
+    {U'\x00e2', U'\x0309', U'\x1ea9'},
+    {U'\x00e4', U'\x0304', U'\x01df'},
+    {U'\x00e5', U'\x0301', U'\x01fb'},
+    {U'\x00e6', U'\x0301', U'\x01fd'},
+    {U'\x00e6', U'\x0304', U'\x01e3'},
+    {U'\x00e7', U'\x0301', U'\x1e09'},
+    {U'\x00ea', U'\x0300', U'\x1ec1'},
+    {U'\x00ea', U'\x0301', U'\x1ebf'},
+    {U'\x00ea', U'\x0303', U'\x1ec5'},
+    {U'\x00ea', U'\x0309', U'\x1ec3'},
+    {U'\x00ef', U'\x0301', U'\x1e2f'},
+    {U'\x00f4', U'\x0300', U'\x1ed3'},
+    {U'\x00f4', U'\x0301', U'\x1ed1'},
+    {U'\x00f4', U'\x0303', U'\x1ed7'},
+    {U'\x00f4', U'\x0309', U'\x1ed5'},
+    {U'\x00f5', U'\x0301', U'\x1e4d'},
+    {U'\x00f5', U'\x0304', U'\x022d'},
+    {U'\x00f5', U'\x0308', U'\x1e4f'},
+    {U'\x00f6', U'\x0304', U'\x022b'},
+    {U'\x00f8', U'\x0301', U'\x01ff'},
+    {U'\x00fc', U'\x0300', U'\x01dc'},
+    {U'\x00fc', U'\x0301', U'\x01d8'},
+    {U'\x00fc', U'\x0304', U'\x01d6'},
+    {U'\x00fc', U'\x030c', U'\x01da'},
+    {U'\x0102', U'\x0300', U'\x1eb0'},
+    {U'\x0102', U'\x0301', U'\x1eae'},
+    {U'\x0102', U'\x0303', U'\x1eb4'},
+    {U'\x0102', U'\x0309', U'\x1eb2'},
+    {U'\x0103', U'\x0300', U'\x1eb1'},
+    {U'\x0103', U'\x0301', U'\x1eaf'},
+    {U'\x0103', U'\x0303', U'\x1eb5'},
+    {U'\x0103', U'\x0309', U'\x1eb3'},
+    {U'\x0112', U'\x0300', U'\x1e14'},
+    {U'\x0112', U'\x0301', U'\x1e16'},
+    {U'\x0113', U'\x0300', U'\x1e15'},
+    {U'\x0113', U'\x0301', U'\x1e17'},
+    {U'\x014c', U'\x0300', U'\x1e50'},
+    {U'\x014c', U'\x0301', U'\x1e52'},
+    {U'\x014d', U'\x0300', U'\x1e51'},
+    {U'\x014d', U'\x0301', U'\x1e53'},
+    {U'\x015a', U'\x0307', U'\x1e64'},
+    {U'\x015b', U'\x0307', U'\x1e65'},
+    {U'\x0160', U'\x0307', U'\x1e66'},
+    {U'\x0161', U'\x0307', U'\x1e67'},
+    {U'\x0168', U'\x0301', U'\x1e78'},
+    {U'\x0169', U'\x0301', U'\x1e79'},
+    {U'\x016a', U'\x0308', U'\x1e7a'},
+    {U'\x016b', U'\x0308', U'\x1e7b'},
+    {U'\x017f', U'\x0307', U'\x1e9b'},
+    {U'\x01a0', U'\x0300', U'\x1edc'},
+    {U'\x01a0', U'\x0301', U'\x1eda'},
+    {U'\x01a0', U'\x0303', U'\x1ee0'},
+    {U'\x01a0', U'\x0309', U'\x1ede'},
+    {U'\x01a0', U'\x0323', U'\x1ee2'},
+    {U'\x01a1', U'\x0300', U'\x1edd'},
+    {U'\x01a1', U'\x0301', U'\x1edb'},
+    {U'\x01a1', U'\x0303', U'\x1ee1'},
+    {U'\x01a1', U'\x0309', U'\x1edf'},
+    {U'\x01a1', U'\x0323', U'\x1ee3'},
+    {U'\x01af', U'\x0300', U'\x1eea'},
+    {U'\x01af', U'\x0301', U'\x1ee8'},
+    {U'\x01af', U'\x0303', U'\x1eee'},
+    {U'\x01af', U'\x0309', U'\x1eec'},
+    {U'\x01af', U'\x0323', U'\x1ef0'},
+    {U'\x01b0', U'\x0300', U'\x1eeb'},
+    {U'\x01b0', U'\x0301', U'\x1ee9'},
+    {U'\x01b0', U'\x0303', U'\x1eef'},
+    {U'\x01b0', U'\x0309', U'\x1eed'},
+    {U'\x01b0', U'\x0323', U'\x1ef1'},
+    {U'\x01b7', U'\x030c', U'\x01ee'},
+    {U'\x01ea', U'\x0304', U'\x01ec'},
+    {U'\x01eb', U'\x0304', U'\x01ed'},
+    {U'\x0226', U'\x0304', U'\x01e0'},
+    {U'\x0227', U'\x0304', U'\x01e1'},
+    {U'\x0228', U'\x0306', U'\x1e1c'},
+    {U'\x0229', U'\x0306', U'\x1e1d'},
+    {U'\x022e', U'\x0304', U'\x0230'},
+    {U'\x022f', U'\x0304', U'\x0231'},
+    {U'\x0292', U'\x030c', U'\x01ef'},
+    {U'\x0391', U'\x0300', U'\x1fba'},
+    {U'\x0391', U'\x0301', U'\x0386'},
+    {U'\x0391', U'\x0304', U'\x1fb9'},
+    {U'\x0391', U'\x0306', U'\x1fb8'},
+    {U'\x0391', U'\x0313', U'\x1f08'},
+    {U'\x0391', U'\x0314', U'\x1f09'},
+    {U'\x0391', U'\x0345', U'\x1fbc'},
+    {U'\x0395', U'\x0300', U'\x1fc8'},
+    {U'\x0395', U'\x0301', U'\x0388'},
+    {U'\x0395', U'\x0313', U'\x1f18'},
+    {U'\x0395', U'\x0314', U'\x1f19'},
+    {U'\x0397', U'\x0300', U'\x1fca'},
+    {U'\x0397', U'\x0301', U'\x0389'},
+    {U'\x0397', U'\x0313', U'\x1f28'},
+    {U'\x0397', U'\x0314', U'\x1f29'},
+    {U'\x0397', U'\x0345', U'\x1fcc'},
+    {U'\x0399', U'\x0300', U'\x1fda'},
+    {U'\x0399', U'\x0301', U'\x038a'},
+    {U'\x0399', U'\x0304', U'\x1fd9'},
+    {U'\x0399', U'\x0306', U'\x1fd8'},
+    {U'\x0399', U'\x0308', U'\x03aa'},
+    {U'\x0399', U'\x0313', U'\x1f38'},
+    {U'\x0399', U'\x0314', U'\x1f39'},
+    {U'\x039f', U'\x0300', U'\x1ff8'},
+    {U'\x039f', U'\x0301', U'\x038c'},
+    {U'\x039f', U'\x0313', U'\x1f48'},
+    {U'\x039f', U'\x0314', U'\x1f49'},
+    {U'\x03a1', U'\x0314', U'\x1fec'},
+    {U'\x03a5', U'\x0300', U'\x1fea'},
+    {U'\x03a5', U'\x0301', U'\x038e'},
+    {U'\x03a5', U'\x0304', U'\x1fe9'},
+    {U'\x03a5', U'\x0306', U'\x1fe8'},
+    {U'\x03a5', U'\x0308', U'\x03ab'},
+    {U'\x03a5', U'\x0314', U'\x1f59'},
+    {U'\x03a9', U'\x0300', U'\x1ffa'},
+    {U'\x03a9', U'\x0301', U'\x038f'},
+    {U'\x03a9', U'\x0313', U'\x1f68'},
+    {U'\x03a9', U'\x0314', U'\x1f69'},
+    {U'\x03a9', U'\x0345', U'\x1ffc'},
+    {U'\x03ac', U'\x0345', U'\x1fb4'},
+    {U'\x03ae', U'\x0345', U'\x1fc4'},
+    {U'\x03b1', U'\x0300', U'\x1f70'},
+    {U'\x03b1', U'\x0301', U'\x03ac'},
+    {U'\x03b1', U'\x0304', U'\x1fb1'},
+    {U'\x03b1', U'\x0306', U'\x1fb0'},
+    {U'\x03b1', U'\x0313', U'\x1f00'},
+    {U'\x03b1', U'\x0314', U'\x1f01'},
+    {U'\x03b1', U'\x0342', U'\x1fb6'},
+    {U'\x03b1', U'\x0345', U'\x1fb3'},
+    {U'\x03b5', U'\x0300', U'\x1f72'},
+    {U'\x03b5', U'\x0301', U'\x03ad'},
+    {U'\x03b5', U'\x0313', U'\x1f10'},
+    {U'\x03b5', U'\x0314', U'\x1f11'},
+    {U'\x03b7', U'\x0300', U'\x1f74'},
+    {U'\x03b7', U'\x0301', U'\x03ae'},
+    {U'\x03b7', U'\x0313', U'\x1f20'},
+    {U'\x03b7', U'\x0314', U'\x1f21'},
+    {U'\x03b7', U'\x0342', U'\x1fc6'},
+    {U'\x03b7', U'\x0345', U'\x1fc3'},
+    {U'\x03b9', U'\x0300', U'\x1f76'},
+    {U'\x03b9', U'\x0301', U'\x03af'},
+    {U'\x03b9', U'\x0304', U'\x1fd1'},
+    {U'\x03b9', U'\x0306', U'\x1fd0'},
+    {U'\x03b9', U'\x0308', U'\x03ca'},
+    {U'\x03b9', U'\x0313', U'\x1f30'},
+    {U'\x03b9', U'\x0314', U'\x1f31'},
+    {U'\x03b9', U'\x0342', U'\x1fd6'},
+    {U'\x03bf', U'\x0300', U'\x1f78'},
+    {U'\x03bf', U'\x0301', U'\x03cc'},
+    {U'\x03bf', U'\x0313', U'\x1f40'},
+    {U'\x03bf', U'\x0314', U'\x1f41'},
+    {U'\x03c1', U'\x0313', U'\x1fe4'},
+    {U'\x03c1', U'\x0314', U'\x1fe5'},
+    {U'\x03c5', U'\x0300', U'\x1f7a'},
+    {U'\x03c5', U'\x0301', U'\x03cd'},
+    {U'\x03c5', U'\x0304', U'\x1fe1'},
+    {U'\x03c5', U'\x0306', U'\x1fe0'},
+    {U'\x03c5', U'\x0308', U'\x03cb'},
+    {U'\x03c5', U'\x0313', U'\x1f50'},
+    {U'\x03c5', U'\x0314', U'\x1f51'},
+    {U'\x03c5', U'\x0342', U'\x1fe6'},
+    {U'\x03c9', U'\x0300', U'\x1f7c'},
+    {U'\x03c9', U'\x0301', U'\x03ce'},
+    {U'\x03c9', U'\x0313', U'\x1f60'},
+    {U'\x03c9', U'\x0314', U'\x1f61'},
+    {U'\x03c9', U'\x0342', U'\x1ff6'},
+    {U'\x03c9', U'\x0345', U'\x1ff3'},
+    {U'\x03ca', U'\x0300', U'\x1fd2'},
+    {U'\x03ca', U'\x0301', U'\x0390'},
+    {U'\x03ca', U'\x0342', U'\x1fd7'},
+    {U'\x03cb', U'\x0300', U'\x1fe2'},
+    {U'\x03cb', U'\x0301', U'\x03b0'},
+    {U'\x03cb', U'\x0342', U'\x1fe7'},
+    {U'\x03ce', U'\x0345', U'\x1ff4'},
+    {U'\x03d2', U'\x0301', U'\x03d3'},
+    {U'\x03d2', U'\x0308', U'\x03d4'},
+    {U'\x0406', U'\x0308', U'\x0407'},
+    {U'\x0410', U'\x0306', U'\x04d0'},
+    {U'\x0410', U'\x0308', U'\x04d2'},
+    {U'\x0413', U'\x0301', U'\x0403'},
+    {U'\x0415', U'\x0300', U'\x0400'},
+    {U'\x0415', U'\x0306', U'\x04d6'},
+    {U'\x0415', U'\x0308', U'\x0401'},
+    {U'\x0416', U'\x0306', U'\x04c1'},
+    {U'\x0416', U'\x0308', U'\x04dc'},
+    {U'\x0417', U'\x0308', U'\x04de'},
+    {U'\x0418', U'\x0300', U'\x040d'},
+    {U'\x0418', U'\x0304', U'\x04e2'},
+    {U'\x0418', U'\x0306', U'\x0419'},
+    {U'\x0418', U'\x0308', U'\x04e4'},
+    {U'\x041a', U'\x0301', U'\x040c'},
+    {U'\x041e', U'\x0308', U'\x04e6'},
+    {U'\x0423', U'\x0304', U'\x04ee'},
+    {U'\x0423', U'\x0306', U'\x040e'},
+    {U'\x0423', U'\x0308', U'\x04f0'},
+    {U'\x0423', U'\x030b', U'\x04f2'},
+    {U'\x0427', U'\x0308', U'\x04f4'},
+    {U'\x042b', U'\x0308', U'\x04f8'},
+    {U'\x042d', U'\x0308', U'\x04ec'},
+    {U'\x0430', U'\x0306', U'\x04d1'},
+    {U'\x0430', U'\x0308', U'\x04d3'},
+    {U'\x0433', U'\x0301', U'\x0453'},
+    {U'\x0435', U'\x0300', U'\x0450'},
+    {U'\x0435', U'\x0306', U'\x04d7'},
+    {U'\x0435', U'\x0308', U'\x0451'},
+    {U'\x0436', U'\x0306', U'\x04c2'},
+    {U'\x0436', U'\x0308', U'\x04dd'},
+    {U'\x0437', U'\x0308', U'\x04df'},
+    {U'\x0438', U'\x0300', U'\x045d'},
+    {U'\x0438', U'\x0304', U'\x04e3'},
+    {U'\x0438', U'\x0306', U'\x0439'},
+    {U'\x0438', U'\x0308', U'\x04e5'},
+    {U'\x043a', U'\x0301', U'\x045c'},
+    {U'\x043e', U'\x0308', U'\x04e7'},
+    {U'\x0443', U'\x0304', U'\x04ef'},
+    {U'\x0443', U'\x0306', U'\x045e'},
+    {U'\x0443', U'\x0308', U'\x04f1'},
+    {U'\x0443', U'\x030b', U'\x04f3'},
+    {U'\x0447', U'\x0308', U'\x04f5'},
+    {U'\x044b', U'\x0308', U'\x04f9'},
+    {U'\x044d', U'\x0308', U'\x04ed'},
+    {U'\x0456', U'\x0308', U'\x0457'},
+    {U'\x0474', U'\x030f', U'\x0476'},
+    {U'\x0475', U'\x030f', U'\x0477'},
+    {U'\x04d8', U'\x0308', U'\x04da'},
+    {U'\x04d9', U'\x0308', U'\x04db'},
+    {U'\x04e8', U'\x0308', U'\x04ea'},
+    {U'\x04e9', U'\x0308', U'\x04eb'},
+    {U'\x0627', U'\x0653', U'\x0622'},
+    {U'\x0627', U'\x0654', U'\x0623'},
+    {U'\x0627', U'\x0655', U'\x0625'},
+    {U'\x0648', U'\x0654', U'\x0624'},
+    {U'\x064a', U'\x0654', U'\x0626'},
+    {U'\x06c1', U'\x0654', U'\x06c2'},
+    {U'\x06d2', U'\x0654', U'\x06d3'},
+    {U'\x06d5', U'\x0654', U'\x06c0'},
+    {U'\x0928', U'\x093c', U'\x0929'},
+    {U'\x0930', U'\x093c', U'\x0931'},
+    {U'\x0933', U'\x093c', U'\x0934'},
+    {U'\x09c7', U'\x09be', U'\x09cb'},
+    {U'\x09c7', U'\x09d7', U'\x09cc'},
+    {U'\x0b47', U'\x0b3e', U'\x0b4b'},
+    {U'\x0b47', U'\x0b56', U'\x0b48'},
+    {U'\x0b47', U'\x0b57', U'\x0b4c'},
+    {U'\x0b92', U'\x0bd7', U'\x0b94'},
+    {U'\x0bc6', U'\x0bbe', U'\x0bca'},
+    {U'\x0bc6', U'\x0bd7', U'\x0bcc'},
+    {U'\x0bc7', U'\x0bbe', U'\x0bcb'},
+    {U'\x0c46', U'\x0c56', U'\x0c48'},
+    {U'\x0cbf', U'\x0cd5', U'\x0cc0'},
+    {U'\x0cc6', U'\x0cc2', U'\x0cca'},
+    {U'\x0cc6', U'\x0cd5', U'\x0cc7'},
+    {U'\x0cc6', U'\x0cd6', U'\x0cc8'},
+    {U'\x0cca', U'\x0cd5', U'\x0ccb'},
+    {U'\x0d46', U'\x0d3e', U'\x0d4a'},
+    {U'\x0d46', U'\x0d57', U'\x0d4c'},
+    {U'\x0d47', U'\x0d3e', U'\x0d4b'},
+    {U'\x0dd9', U'\x0dca', U'\x0dda'},
+    {U'\x0dd9', U'\x0dcf', U'\x0ddc'},
+    {U'\x0dd9', U'\x0ddf', U'\x0dde'},
+    {U'\x0ddc', U'\x0dca', U'\x0ddd'},
+    {U'\x1025', U'\x102e', U'\x1026'},
+    {U'\x1b05', U'\x1b35', U'\x1b06'},
+    {U'\x1b07', U'\x1b35', U'\x1b08'},
+    {U'\x1b09', U'\x1b35', U'\x1b0a'},
+    {U'\x1b0b', U'\x1b35', U'\x1b0c'},
+    {U'\x1b0d', U'\x1b35', U'\x1b0e'},
+    {U'\x1b11', U'\x1b35', U'\x1b12'},
+    {U'\x1b3a', U'\x1b35', U'\x1b3b'},
+    {U'\x1b3c', U'\x1b35', U'\x1b3d'},
+    {U'\x1b3e', U'\x1b35', U'\x1b40'},
+    {U'\x1b3f', U'\x1b35', U'\x1b41'},
+    {U'\x1b42', U'\x1b35', U'\x1b43'},
+    {U'\x1e36', U'\x0304', U'\x1e38'},
+    {U'\x1e37', U'\x0304', U'\x1e39'},
+    {U'\x1e5a', U'\x0304', U'\x1e5c'},
+    {U'\x1e5b', U'\x0304', U'\x1e5d'},
+    {U'\x1e62', U'\x0307', U'\x1e68'},
+    {U'\x1e63', U'\x0307', U'\x1e69'},
+    {U'\x1ea0', U'\x0302', U'\x1eac'},
+    {U'\x1ea0', U'\x0306', U'\x1eb6'},
+    {U'\x1ea1', U'\x0302', U'\x1ead'},
+    {U'\x1ea1', U'\x0306', U'\x1eb7'},
+    {U'\x1eb8', U'\x0302', U'\x1ec6'},
+    {U'\x1eb9', U'\x0302', U'\x1ec7'},
+    {U'\x1ecc', U'\x0302', U'\x1ed8'},
+    {U'\x1ecd', U'\x0302', U'\x1ed9'},
+    {U'\x1f00', U'\x0300', U'\x1f02'},
+    {U'\x1f00', U'\x0301', U'\x1f04'},
+    {U'\x1f00', U'\x0342', U'\x1f06'},
+    {U'\x1f00', U'\x0345', U'\x1f80'},
+    {U'\x1f01', U'\x0300', U'\x1f03'},
+    {U'\x1f01', U'\x0301', U'\x1f05'},
+    {U'\x1f01', U'\x0342', U'\x1f07'},
+    {U'\x1f01', U'\x0345', U'\x1f81'},
+    {U'\x1f02', U'\x0345', U'\x1f82'},
+    {U'\x1f03', U'\x0345', U'\x1f83'},
+    {U'\x1f04', U'\x0345', U'\x1f84'},
+    {U'\x1f05', U'\x0345', U'\x1f85'},
+    {U'\x1f06', U'\x0345', U'\x1f86'},
+    {U'\x1f07', U'\x0345', U'\x1f87'},
+    {U'\x1f08', U'\x0300', U'\x1f0a'},
+    {U'\x1f08', U'\x0301', U'\x1f0c'},
+    {U'\x1f08', U'\x0342', U'\x1f0e'},
+    {U'\x1f08', U'\x0345', U'\x1f88'},
+    {U'\x1f09', U'\x0300', U'\x1f0b'},
+    {U'\x1f09', U'\x0301', U'\x1f0d'},
+    {U'\x1f09', U'\x0342', U'\x1f0f'},
+    {U'\x1f09', U'\x0345', U'\x1f89'},
+    {U'\x1f0a', U'\x0345', U'\x1f8a'},
+    {U'\x1f0b', U'\x0345', U'\x1f8b'},
+    {U'\x1f0c', U'\x0345', U'\x1f8c'},
+    {U'\x1f0d', U'\x0345', U'\x1f8d'},
+    {U'\x1f0e', U'\x0345', U'\x1f8e'},
+    {U'\x1f0f', U'\x0345', U'\x1f8f'},
+    {U'\x1f10', U'\x0300', U'\x1f12'},
+    {U'\x1f10', U'\x0301', U'\x1f14'},
+    {U'\x1f11', U'\x0300', U'\x1f13'},
+    {U'\x1f11', U'\x0301', U'\x1f15'},
+    {U'\x1f18', U'\x0300', U'\x1f1a'},
+    {U'\x1f18', U'\x0301', U'\x1f1c'},
+    {U'\x1f19', U'\x0300', U'\x1f1b'},
+    {U'\x1f19', U'\x0301', U'\x1f1d'},
+    {U'\x1f20', U'\x0300', U'\x1f22'},
+    {U'\x1f20', U'\x0301', U'\x1f24'},
+    {U'\x1f20', U'\x0342', U'\x1f26'},
+    {U'\x1f20', U'\x0345', U'\x1f90'},
+    {U'\x1f21', U'\x0300', U'\x1f23'},
+    {U'\x1f21', U'\x0301', U'\x1f25'},
+    {U'\x1f21', U'\x0342', U'\x1f27'},
+    {U'\x1f21', U'\x0345', U'\x1f91'},
+    {U'\x1f22', U'\x0345', U'\x1f92'},
+    {U'\x1f23', U'\x0345', U'\x1f93'},
+    {U'\x1f24', U'\x0345', U'\x1f94'},
+    {U'\x1f25', U'\x0345', U'\x1f95'},
+    {U'\x1f26', U'\x0345', U'\x1f96'},
+    {U'\x1f27', U'\x0345', U'\x1f97'},
+    {U'\x1f28', U'\x0300', U'\x1f2a'},
+    {U'\x1f28', U'\x0301', U'\x1f2c'},
+    {U'\x1f28', U'\x0342', U'\x1f2e'},
+    {U'\x1f28', U'\x0345', U'\x1f98'},
+    {U'\x1f29', U'\x0300', U'\x1f2b'},
+    {U'\x1f29', U'\x0301', U'\x1f2d'},
+    {U'\x1f29', U'\x0342', U'\x1f2f'},
+    {U'\x1f29', U'\x0345', U'\x1f99'},
+    {U'\x1f2a', U'\x0345', U'\x1f9a'},
+    {U'\x1f2b', U'\x0345', U'\x1f9b'},
+    {U'\x1f2c', U'\x0345', U'\x1f9c'},
+    {U'\x1f2d', U'\x0345', U'\x1f9d'},
+    {U'\x1f2e', U'\x0345', U'\x1f9e'},
+    {U'\x1f2f', U'\x0345', U'\x1f9f'},
+    {U'\x1f30', U'\x0300', U'\x1f32'},
+    {U'\x1f30', U'\x0301', U'\x1f34'},
+    {U'\x1f30', U'\x0342', U'\x1f36'},
+    {U'\x1f31', U'\x0300', U'\x1f33'},
+    {U'\x1f31', U'\x0301', U'\x1f35'},
+    {U'\x1f31', U'\x0342', U'\x1f37'},
+    {U'\x1f38', U'\x0300', U'\x1f3a'},
+    {U'\x1f38', U'\x0301', U'\x1f3c'},
+    {U'\x1f38', U'\x0342', U'\x1f3e'},
+    {U'\x1f39', U'\x0300', U'\x1f3b'},
+    {U'\x1f39', U'\x0301', U'\x1f3d'},
+    {U'\x1f39', U'\x0342', U'\x1f3f'},
+    {U'\x1f40', U'\x0300', U'\x1f42'},
+    {U'\x1f40', U'\x0301', U'\x1f44'},
+    {U'\x1f41', U'\x0300', U'\x1f43'},
+    {U'\x1f41', U'\x0301', U'\x1f45'},
+    {U'\x1f48', U'\x0300', U'\x1f4a'},
+    {U'\x1f48', U'\x0301', U'\x1f4c'},
+    {U'\x1f49', U'\x0300', U'\x1f4b'},
+    {U'\x1f49', U'\x0301', U'\x1f4d'},
+    {U'\x1f50', U'\x0300', U'\x1f52'},
+    {U'\x1f50', U'\x0301', U'\x1f54'},
+    {U'\x1f50', U'\x0342', U'\x1f56'},
+    {U'\x1f51', U'\x0300', U'\x1f53'},
+    {U'\x1f51', U'\x0301', U'\x1f55'},
+    {U'\x1f51', U'\x0342', U'\x1f57'},
+    {U'\x1f59', U'\x0300', U'\x1f5b'},
+    {U'\x1f59', U'\x0301', U'\x1f5d'},
+    {U'\x1f59', U'\x0342', U'\x1f5f'},
+    {U'\x1f60', U'\x0300', U'\x1f62'},
+    {U'\x1f60', U'\x0301', U'\x1f64'},
+    {U'\x1f60', U'\x0342', U'\x1f66'},
+    {U'\x1f60', U'\x0345', U'\x1fa0'},
+    {U'\x1f61', U'\x0300', U'\x1f63'},
+    {U'\x1f61', U'\x0301', U'\x1f65'},
+    {U'\x1f61', U'\x0342', U'\x1f67'},
+    {U'\x1f61', U'\x0345', U'\x1fa1'},
+    {U'\x1f62', U'\x0345', U'\x1fa2'},
+    {U'\x1f63', U'\x0345', U'\x1fa3'},
+    {U'\x1f64', U'\x0345', U'\x1fa4'},
+    {U'\x1f65', U'\x0345', U'\x1fa5'},
+    {U'\x1f66', U'\x0345', U'\x1fa6'},
+    {U'\x1f67', U'\x0345', U'\x1fa7'},
+    {U'\x1f68', U'\x0300', U'\x1f6a'},
+    {U'\x1f68', U'\x0301', U'\x1f6c'},
+    {U'\x1f68', U'\x0342', U'\x1f6e'},
+    {U'\x1f68', U'\x0345', U'\x1fa8'},
+    {U'\x1f69', U'\x0300', U'\x1f6b'},
+    {U'\x1f69', U'\x0301', U'\x1f6d'},
+    {U'\x1f69', U'\x0342', U'\x1f6f'},
+    {U'\x1f69', U'\x0345', U'\x1fa9'},
+    {U'\x1f6a', U'\x0345', U'\x1faa'},
+    {U'\x1f6b', U'\x0345', U'\x1fab'},
+    {U'\x1f6c', U'\x0345', U'\x1fac'},
+    {U'\x1f6d', U'\x0345', U'\x1fad'},
+    {U'\x1f6e', U'\x0345', U'\x1fae'},
+    {U'\x1f6f', U'\x0345', U'\x1faf'},
+    {U'\x1f70', U'\x0345', U'\x1fb2'},
+    {U'\x1f74', U'\x0345', U'\x1fc2'},
+    {U'\x1f7c', U'\x0345', U'\x1ff2'},
+    {U'\x1fb6', U'\x0345', U'\x1fb7'},
+    {U'\x1fbf', U'\x0300', U'\x1fcd'},
+    {U'\x1fbf', U'\x0301', U'\x1fce'},
+    {U'\x1fbf', U'\x0342', U'\x1fcf'},
+    {U'\x1fc6', U'\x0345', U'\x1fc7'},
+    {U'\x1ff6', U'\x0345', U'\x1ff7'},
+    {U'\x1ffe', U'\x0300', U'\x1fdd'},
+    {U'\x1ffe', U'\x0301', U'\x1fde'},
+    {U'\x1ffe', U'\x0342', U'\x1fdf'},
+    {U'\x2190', U'\x0338', U'\x219a'},
+    {U'\x2192', U'\x0338', U'\x219b'},
+    {U'\x2194', U'\x0338', U'\x21ae'},
+    {U'\x21d0', U'\x0338', U'\x21cd'},
+    {U'\x21d2', U'\x0338', U'\x21cf'},
+    {U'\x21d4', U'\x0338', U'\x21ce'},
+    {U'\x2203', U'\x0338', U'\x2204'},
+    {U'\x2208', U'\x0338', U'\x2209'},
+    {U'\x220b', U'\x0338', U'\x220c'},
+    {U'\x2223', U'\x0338', U'\x2224'},
+    {U'\x2225', U'\x0338', U'\x2226'},
+    {U'\x223c', U'\x0338', U'\x2241'},
+    {U'\x2243', U'\x0338', U'\x2244'},
+    {U'\x2245', U'\x0338', U'\x2247'},
+    {U'\x2248', U'\x0338', U'\x2249'},
+    {U'\x224d', U'\x0338', U'\x226d'},
+    {U'\x2261', U'\x0338', U'\x2262'},
+    {U'\x2264', U'\x0338', U'\x2270'},
+    {U'\x2265', U'\x0338', U'\x2271'},
+    {U'\x2272', U'\x0338', U'\x2274'},
+    {U'\x2273', U'\x0338', U'\x2275'},
+    {U'\x2276', U'\x0338', U'\x2278'},
+    {U'\x2277', U'\x0338', U'\x2279'},
+    {U'\x227a', U'\x0338', U'\x2280'},
+    {U'\x227b', U'\x0338', U'\x2281'},
+    {U'\x227c', U'\x0338', U'\x22e0'},
+    {U'\x227d', U'\x0338', U'\x22e1'},
+    {U'\x2282', U'\x0338', U'\x2284'},
+    {U'\x2283', U'\x0338', U'\x2285'},
+    {U'\x2286', U'\x0338', U'\x2288'},
+    {U'\x2287', U'\x0338', U'\x2289'},
+    {U'\x2291', U'\x0338', U'\x22e2'},
+    {U'\x2292', U'\x0338', U'\x22e3'},
+    {U'\x22a2', U'\x0338', U'\x22ac'},
+    {U'\x22a8', U'\x0338', U'\x22ad'},
+    {U'\x22a9', U'\x0338', U'\x22ae'},
+    {U'\x22ab', U'\x0338', U'\x22af'},
+    {U'\x22b2', U'\x0338', U'\x22ea'},
+    {U'\x22b3', U'\x0338', U'\x22eb'},
+    {U'\x22b4', U'\x0338', U'\x22ec'},
+    {U'\x22b5', U'\x0338', U'\x22ed'},
+    {U'\x3046', U'\x3099', U'\x3094'},
+    {U'\x304b', U'\x3099', U'\x304c'},
+    {U'\x304d', U'\x3099', U'\x304e'},
+    {U'\x304f', U'\x3099', U'\x3050'},
+    {U'\x3051', U'\x3099', U'\x3052'},
+    {U'\x3053', U'\x3099', U'\x3054'},
+    {U'\x3055', U'\x3099', U'\x3056'},
+    {U'\x3057', U'\x3099', U'\x3058'},
+    {U'\x3059', U'\x3099', U'\x305a'},
+    {U'\x305b', U'\x3099', U'\x305c'},
+    {U'\x305d', U'\x3099', U'\x305e'},
+    {U'\x305f', U'\x3099', U'\x3060'},
+    {U'\x3061', U'\x3099', U'\x3062'},
+    {U'\x3064', U'\x3099', U'\x3065'},
+    {U'\x3066', U'\x3099', U'\x3067'},
+    {U'\x3068', U'\x3099', U'\x3069'},
+    {U'\x306f', U'\x3099', U'\x3070'},
+    {U'\x306f', U'\x309a', U'\x3071'},
+    {U'\x3072', U'\x3099', U'\x3073'},
+    {U'\x3072', U'\x309a', U'\x3074'},
+    {U'\x3075', U'\x3099', U'\x3076'},
+    {U'\x3075', U'\x309a', U'\x3077'},
+    {U'\x3078', U'\x3099', U'\x3079'},
+    {U'\x3078', U'\x309a', U'\x307a'},
+    {U'\x307b', U'\x3099', U'\x307c'},
+    {U'\x307b', U'\x309a', U'\x307d'},
+    {U'\x309d', U'\x3099', U'\x309e'},
+    {U'\x30a6', U'\x3099', U'\x30f4'},
+    {U'\x30ab', U'\x3099', U'\x30ac'},
+    {U'\x30ad', U'\x3099', U'\x30ae'},
+    {U'\x30af', U'\x3099', U'\x30b0'},
+    {U'\x30b1', U'\x3099', U'\x30b2'},
+    {U'\x30b3', U'\x3099', U'\x30b4'},
+    {U'\x30b5', U'\x3099', U'\x30b6'},
+    {U'\x30b7', U'\x3099', U'\x30b8'},
+    {U'\x30b9', U'\x3099', U'\x30ba'},
+    {U'\x30bb', U'\x3099', U'\x30bc'},
+    {U'\x30bd', U'\x3099', U'\x30be'},
+    {U'\x30bf', U'\x3099', U'\x30c0'},
+    {U'\x30c1', U'\x3099', U'\x30c2'},
+    {U'\x30c4', U'\x3099', U'\x30c5'},
+    {U'\x30c6', U'\x3099', U'\x30c7'},
+    {U'\x30c8', U'\x3099', U'\x30c9'},
+    {U'\x30cf', U'\x3099', U'\x30d0'},
+    {U'\x30cf', U'\x309a', U'\x30d1'},
+    {U'\x30d2', U'\x3099', U'\x30d3'},
+    {U'\x30d2', U'\x309a', U'\x30d4'},
+    {U'\x30d5', U'\x3099', U'\x30d6'},
+    {U'\x30d5', U'\x309a', U'\x30d7'},
+    {U'\x30d8', U'\x3099', U'\x30d9'},
+    {U'\x30d8', U'\x309a', U'\x30da'},
+    {U'\x30db', U'\x3099', U'\x30dc'},
+    {U'\x30db', U'\x309a', U'\x30dd'},
+    {U'\x30ef', U'\x3099', U'\x30f7'},
+    {U'\x30f0', U'\x3099', U'\x30f8'},
+    {U'\x30f1', U'\x3099', U'\x30f9'},
+    {U'\x30f2', U'\x3099', U'\x30fa'},
+    {U'\x30fd', U'\x3099', U'\x30fe'},
+    {U'\x11099', U'\x110ba', U'\x1109a'},
+    {U'\x1109b', U'\x110ba', U'\x1109c'},
+    {U'\x110a5', U'\x110ba', U'\x110ab'},
+    {U'\x11131', U'\x11127', U'\x1112e'},
+    {U'\x11132', U'\x11127', U'\x1112f'},
+    {U'\x11347', U'\x1133e', U'\x1134b'},
+    {U'\x11347', U'\x11357', U'\x1134c'},
+    {U'\x114b9', U'\x114b0', U'\x114bc'},
+    {U'\x114b9', U'\x114ba', U'\x114bb'},
+    {U'\x114b9', U'\x114bd', U'\x114be'},
+    {U'\x115b8', U'\x115af', U'\x115ba'},
+    {U'\x115b9', U'\x115af', U'\x115bb'},
+    {U'\x11935', U'\x11930', U'\x11938'},
+}};
+}  // namespace skyr::unicode::details
+
+#endif  // SKYR_UNICODE_NORMALIZATION_TABLES_HPP
@@ -0,0 +1,465 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_UNICODE_TRANSCODE_HPP
+#define SKYR_UNICODE_TRANSCODE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <skyr/platform/swar.hpp>
+#include <skyr/unicode/errors.hpp>
+
+namespace skyr::unicode {
+namespace details {
+/// Code units are processed in blocks of this size
+inline constexpr auto transcode_block_size = std::size_t{16};
+
+template <class charT>
+constexpr inline auto code_unit_value(charT unit) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<charT>>(unit));
+}
+
+/// Loads 4 UTF-16 code units into the 16-bit lanes of a word. The order of
+/// the lanes depends on the platform, which doesn't matter for classifying
+/// code units.
+template <class charT>
+constexpr inline auto load_utf16_lanes(const charT* first) noexcept -> std::uint64_t {
+  static_assert(sizeof(charT) == 2);
+
+  auto word = std::uint64_t{0};
+  if (!std::is_constant_evaluated()) {
+    std::memcpy(&word, first, sizeof(word));
+    return word;
+  }
+  for (auto i = 0UL; i < 4UL; ++i) {
+    word |= static_cast<std::uint64_t>(code_unit_value(first[i])) << (i * 16);
+  }
+  return word;
+}
+
+/// \returns `true` if every code unit in the block is ASCII
+template <class charT>
+constexpr inline auto is_ascii_block(const charT* first) noexcept -> bool {
+  if constexpr (sizeof(charT) == 2) {
+    constexpr auto non_ascii = std::uint64_t{0xff80ff80ff80ff80};
+
+    auto bits = std::uint64_t{0};
+    for (auto i = 0UL; i < transcode_block_size; i += 4) {
+      bits |= load_utf16_lanes(first + i);
+    }
+    return (bits & non_ascii) == 0;
+  } else {
+    auto bits = std::uint32_t{0};
+    for (auto i = 0UL; i < transcode_block_size; ++i) {
+      bits |= code_unit_value(first[i]);
+    }
+    return bits < 0x80U;
+  }
+}
+
+/// Copies a block of ASCII code units to `out`
+template <class charT>
+constexpr inline auto narrow_ascii_block(const charT* first, char* out) noexcept -> void {
+  if constexpr (sizeof(charT) == 2) {
+    if (!std::is_constant_evaluated() && (std::endian::native == std::endian::little)) {
+      /// Gather the low byte of each 16-bit lane, 4 code units at a time
+      for (auto i = 0UL; i < transcode_block_size; i += 4) {
+        auto word = load_utf16_lanes(first + i) & std::uint64_t{0x00ff00ff00ff00ff};
+        word = (word | (word >> 8U)) & std::uint64_t{0x0000ffff0000ffff};
+        auto bytes = static_cast<std::uint32_t>(word | (word >> 16U));
+        std::memcpy(out + i, &bytes, sizeof(bytes));
+      }
+      return;
+    }
+  }
+
+  for (auto i = 0UL; i < transcode_block_size; ++i) {
+    out[i] = static_cast<char>(first[i]);
+  }
+}
+
+/// Writes a code point as UTF-8. The code point must be valid.
+constexpr inline auto write_utf8(char32_t code_point, char* out) noexcept -> char* {
+  auto value = static_cast<std::uint32_t>(code_point);
+  if (value < 0x80U) {
+    *out++ = static_cast<char>(value);
+  } else if (value < 0x800U) {
+    *out++ = static_cast<char>(0xc0U | (value >> 6U));
+    *out++ = static_cast<char>(0x80U | (value & 0x3fU));
+  } else if (value < 0x10000U) {
+    *out++ = static_cast<char>(0xe0U | (value >> 12U));
+    *out++ = static_cast<char>(0x80U | ((value >> 6U) & 0x3fU));
+    *out++ = static_cast<char>(0x80U | (value & 0x3fU));
+  } else {
+    *out++ = static_cast<char>(0xf0U | (value >> 18U));
+    *out++ = static_cast<char>(0x80U | ((value >> 12U) & 0x3fU));
+    *out++ = static_cast<char>(0x80U | ((value >> 6U) & 0x3fU));
+    *out++ = static_cast<char>(0x80U | (value & 0x3fU));
+  }
+  return out;
+}
+
+/// Validates UTF-16 one code unit at a time, from `first` until at least
+/// `until`, and adds the UTF-8 length to `length`
+/// \returns The position after the last code unit read, or an error
+template <class charT>
+constexpr auto utf16_length_scalar(const charT* first, const charT* until, const charT* last, std::size_t* length)
+    -> std::expected<const charT*, unicode_errc> {
+  while (first < until) {
+    auto unit = code_unit_value(*first++);
+    if (unit < 0x80U) {
+      *length += 1;
+    } else if (unit < 0x800U) {
+      *length += 2;
+    } else if ((unit & 0xfc00U) == 0xd800U) {
+      if ((first == last) || ((code_unit_value(*first) & 0xfc00U) != 0xdc00U)) {
+        return std::unexpected(unicode_errc::invalid_code_point);
+      }
+      ++first;
+      *length += 4;
+    } else if ((unit & 0xfc00U) == 0xdc00U) {
+      return std::unexpected(unicode_errc::invalid_code_point);
+    } else {
+      *length += 3;
+    }
+  }
+  return first;
+}
+
+/// Computes the UTF-8 length of a block of UTF-16 code units, 4 code units
+/// at a time: each adds 1 byte, plus 1 if it is at least U+0080, plus 1 if
+/// it is at least U+0800
+/// \returns The length, or 0 if the block contains a surrogate
+template <class charT>
+constexpr inline auto utf16_block_length(const charT* first) noexcept -> std::uint32_t {
+  namespace swar = ::skyr::details::swar;
+
+  constexpr auto two_bytes = std::uint64_t{0xff80ff80ff80ff80};
+  constexpr auto three_bytes = std::uint64_t{0xf800f800f800f800};
+  constexpr auto surrogate = std::uint64_t{0xd800d800d800d800};
+
+  auto length = static_cast<std::uint32_t>(transcode_block_size);
+  auto surrogates = std::uint64_t{0};
+  for (auto i = 0UL; i < transcode_block_size; i += 4) {
+    auto word = load_utf16_lanes(first + i);
+    auto at_least_three_bytes = swar::nonzero_lanes16(word & three_bytes);
+    length += static_cast<std::uint32_t>(std::popcount(swar::nonzero_lanes16(word & two_bytes)) +
+                                         std::popcount(at_least_three_bytes));
+    surrogates |= ~swar::nonzero_lanes16((word & three_bytes) ^ surrogate) & swar::high_bits16;
+  }
+  return (surrogates == 0) ? length : 0;
+}
+
+template <class charT>
+constexpr auto utf16_length(std::basic_string_view<charT> input) -> std::expected<std::size_t, unicode_errc> {
+  auto length = std::size_t{0};
+  auto first = input.data(), last = input.data() + input.size();
+  while ((last - first) >= static_cast<std::ptrdiff_t>(transcode_block_size)) {
+    if (auto block_length = utf16_block_length(first); block_length != 0) {
+      length += block_length;
+      first += transcode_block_size;
+    } else {
+      auto next = utf16_length_scalar(first, first + transcode_block_size, last, &length);
+      if (!next) {
+        return std::unexpected(next.error());
+      }
+      first = next.value();
+    }
+  }
+
+  auto next = utf16_length_scalar(first, last, last, &length);
+  if (!next) {
+    return std::unexpected(next.error());
+  }
+  return length;
+}
+
+/// Writes valid UTF-16 as UTF-8, from `first` until at least `until`
+/// \returns The position after the last code unit read
+template <class charT>
+constexpr auto utf16_to_utf8_scalar(const charT* first, const charT* until, char** out) noexcept -> const charT* {
+  while (first < until) {
+    auto unit = code_unit_value(*first++);
+    if ((unit & 0xfc00U) == 0xd800U) {
+      unit = 0x10000U + ((unit - 0xd800U) << 10U) + (code_unit_value(*first++) - 0xdc00U);
+    }
+    *out = write_utf8(static_cast<char32_t>(unit), *out);
+  }
+  return first;
+}
+
+/// Writes valid UTF-16 as UTF-8
+/// \returns A pointer past the last byte written
+template <class charT>
+constexpr auto utf16_to_utf8(std::basic_string_view<charT> input, char* out) noexcept -> char* {
+  auto first = input.data(), last = input.data() + input.size();
+  while ((last - first) >= static_cast<std::ptrdiff_t>(transcode_block_size)) {
+    if (is_ascii_block(first)) {
+      narrow_ascii_block(first, out);
+      out += transcode_block_size;
+      first += transcode_block_size;
+    } else {
+      first = utf16_to_utf8_scalar(first, first + transcode_block_size, &out);
+    }
+  }
+  utf16_to_utf8_scalar(first, last, &out);
+  return out;
+}
+
+template <class charT>
+constexpr auto utf32_length(std::basic_string_view<charT> input) -> std::expected<std::size_t, unicode_errc> {
+  auto length = std::size_t{0};
+  auto invalid = false;
+  auto add_length = [&length, &invalid](auto unit) {
+    auto value = code_unit_value(unit);
+    length += 1U + (value >= 0x80U) + (value >= 0x800U) + (value >= 0x10000U);
+    invalid |= (value > 0x10ffffU) || ((value & 0xfffff800U) == 0xd800U);
+  };
+
+  auto first = input.data(), last = input.data() + input.size();
+  for (; (last - first) >= static_cast<std::ptrdiff_t>(transcode_block_size); first += transcode_block_size) {
+    if (is_ascii_block(first)) {
+      length += transcode_block_size;
+    } else {
+      std::for_each(first, first + transcode_block_size, add_length);
+    }
+  }
+  std::for_each(first, last, add_length);
+
+  if (invalid) {
+    return std::unexpected(unicode_errc::invalid_code_point);
+  }
+  return length;
+}
+
+/// Writes valid UTF-32 as UTF-8
+/// \returns A pointer past the last byte written
+template <class charT>
+constexpr auto utf32_to_utf8(std::basic_string_view<charT> input, char* out) noexcept -> char* {
+  auto first = input.data(), last = input.data() + input.size();
+  while ((last - first) >= static_cast<std::ptrdiff_t>(transcode_block_size)) {
+    if (is_ascii_block(first)) {
+      narrow_ascii_block(first, out);
+      out += transcode_block_size;
+    } else {
+      for (auto i = 0UL; i < transcode_block_size; ++i) {
+        out = write_utf8(static_cast<char32_t>(first[i]), out);
+      }
+    }
+    first += transcode_block_size;
+  }
+  for (; first != last; ++first) {
+    out = write_utf8(static_cast<char32_t>(*first), out);
+  }
+  return out;
+}
+
+/// Transcodes UTF-16 or UTF-32 to UTF-8. The input is validated, and the
+/// exact length of the output computed, in a first pass, so the output is
+/// allocated once and written without checks.
+template <class charT>
+auto to_utf8(std::basic_string_view<charT> input) -> std::expected<std::string, unicode_errc> {
+  static_assert((sizeof(charT) == 2) || (sizeof(charT) == 4));
+
+  if constexpr (sizeof(charT) == 2) {
+    return utf16_length(input).transform([input](auto length) {
+      auto output = std::string(length, '\0');
+      utf16_to_utf8(input, output.data());
+      return output;
+    });
+  } else {
+    return utf32_length(input).transform([input](auto length) {
+      auto output = std::string(length, '\0');
+      utf32_to_utf8(input, output.data());
+      return output;
+    });
+  }
+}
+
+/// \returns `true` if every byte in the block is ASCII
+constexpr inline auto is_ascii_block(const char* first) noexcept -> bool {
+  namespace swar = ::skyr::details::swar;
+
+  auto bits = std::uint64_t{0};
+  for (auto i = 0UL; i < transcode_block_size; i += 8) {
+    bits |= swar::load(std::string_view(first + i, 8));
+  }
+  return (bits & swar::high_bits) == 0;
+}
+
+/// Decodes one UTF-8 sequence, rejecting overlong forms, surrogates, values
+/// greater than U+10FFFF and truncated sequences
+/// \returns The position after the sequence, or an error
+constexpr inline auto decode_utf8_sequence(const char* first, const char* last, char32_t* code_point)
+    -> std::expected<const char*, unicode_errc> {
+  auto lead = code_unit_value(*first++);
+  auto length = 0L;
+  auto lower = 0x80U, upper = 0xbfU;
+  if ((lead >= 0xc2U) && (lead <= 0xdfU)) {
+    length = 1;
+    lead &= 0x1fU;
+  } else if ((lead >= 0xe0U) && (lead <= 0xefU)) {
+    length = 2;
+    lower = (lead == 0xe0U) ? 0xa0U : 0x80U;
+    upper = (lead == 0xedU) ? 0x9fU : 0xbfU;
+    lead &= 0x0fU;
+  } else if ((lead >= 0xf0U) && (lead <= 0xf4U)) {
+    length = 3;
+    lower = (lead == 0xf0U) ? 0x90U : 0x80U;
+    upper = (lead == 0xf4U) ? 0x8fU : 0xbfU;
+    lead &= 0x07U;
+  } else {
+    return std::unexpected(unicode_errc::invalid_lead);
+  }
+
+  if ((last - first) < length) {
+    return std::unexpected(unicode_errc::illegal_byte_sequence);
+  }
+
+  auto value = lead;
+  for (auto i = 0L; i < length; ++i) {
+    auto trail = code_unit_value(first[i]);
+    if ((trail < lower) || (trail > upper)) {
+      return std::unexpected(unicode_errc::illegal_byte_sequence);
+    }
+    value = (value << 6U) | (trail & 0x3fU);
+    lower = 0x80U;
+    upper = 0xbfU;
+  }
+  *code_point = static_cast<char32_t>(value);
+  return first + length;
+}
+
+/// Decodes UTF-8 one sequence at a time, from `first` until at least `until`
+/// \returns The position after the last byte read, or an error
+constexpr inline auto utf8_to_utf32_scalar(const char* first, const char* until, const char* last, char32_t** out)
+    -> std::expected<const char*, unicode_errc> {
+  while (first < until) {
+    if (code_unit_value(*first) < 0x80U) {
+      *(*out)++ = static_cast<char32_t>(*first++);
+      continue;
+    }
+
+    auto next = decode_utf8_sequence(first, last, *out);
+    if (!next) {
+      return std::unexpected(next.error());
+    }
+    first = next.value();
+    ++*out;
+  }
+  return first;
+}
+
+/// Decodes and validates UTF-8. The output must have room for a code point
+/// per byte of input.
+/// \returns A pointer past the last code point written, or an error
+constexpr inline auto utf8_to_utf32(std::string_view input, char32_t* out) -> std::expected<char32_t*, unicode_errc> {
+  auto first = input.data(), last = input.data() + input.size();
+  while ((last - first) >= static_cast<std::ptrdiff_t>(transcode_block_size)) {
+    if (is_ascii_block(first)) {
+      std::transform(first, first + transcode_block_size, out,
+                     [](auto byte) { return static_cast<char32_t>(byte); });
+      out += transcode_block_size;
+      first += transcode_block_size;
+    } else {
+      auto next = utf8_to_utf32_scalar(first, first + transcode_block_size, last, &out);
+      if (!next) {
+        return std::unexpected(next.error());
+      }
+      first = next.value();
+    }
+  }
+
+  auto next = utf8_to_utf32_scalar(first, last, last, &out);
+  if (!next) {
+    return std::unexpected(next.error());
+  }
+  return out;
+}
+}  // namespace details
+
+/// Computes the length of a UTF-16 string when it is encoded as UTF-8
+/// \param input A UTF-16 string
+/// \returns The length in bytes, or an error if the input contains an
+///          unpaired surrogate
+constexpr inline auto utf8_length(std::u16string_view input) -> std::expected<std::size_t, unicode_errc> {
+  return details::utf16_length(input);
+}
+
+/// Computes the length of a UTF-32 string when it is encoded as UTF-8
+/// \param input A UTF-32 string
+/// \returns The length in bytes, or an error if the input contains a
+///          surrogate or a value greater than U+10FFFF
+constexpr inline auto utf8_length(std::u32string_view input) -> std::expected<std::size_t, unicode_errc> {
+  return details::utf32_length(input);
+}
+
+/// Transcodes a UTF-16 string to UTF-8.
+///
+/// Blocks of ASCII code units are copied without decoding, and the output
+/// is allocated once, at its exact size.
+///
+/// \param input A UTF-16 string
+/// \returns A UTF-8 string, or an error if the input contains an unpaired
+///          surrogate
+inline auto to_utf8(std::u16string_view input) -> std::expected<std::string, unicode_errc> {
+  return details::to_utf8(input);
+}
+
+/// Transcodes a UTF-32 string to UTF-8.
+///
+/// Blocks of ASCII code units are copied without encoding, and the output
+/// is allocated once, at its exact size.
+///
+/// \param input A UTF-32 string
+/// \returns A UTF-8 string, or an error if the input contains a surrogate
+///          or a value greater than U+10FFFF
+inline auto to_utf8(std::u32string_view input) -> std::expected<std::string, unicode_errc> {
+  return details::to_utf8(input);
+}
+
+/// Decodes a UTF-8 string to code points, into a caller's buffer.
+///
+/// Blocks of ASCII bytes are widened without decoding. A UTF-8 string
+/// never has more code points than bytes, so an output as long as the input
+/// is always large enough.
+///
+/// \param input A UTF-8 string
+/// \param output The output buffer, of at least `input.size()` code points
+/// \returns The number of code points written, or an error if the input
+///          isn't valid UTF-8 or the output is too small
+constexpr inline auto to_utf32(std::string_view input, std::span<char32_t> output)
+    -> std::expected<std::size_t, unicode_errc> {
+  if (output.size() < input.size()) {
+    return std::unexpected(unicode_errc::overflow);
+  }
+  return details::utf8_to_utf32(input, output.data()).transform([&output](auto last) {
+    return static_cast<std::size_t>(last - output.data());
+  });
+}
+
+/// Decodes a UTF-8 string to code points.
+///
+/// \param input A UTF-8 string
+/// \returns A UTF-32 string, or an error if the input isn't valid UTF-8
+inline auto to_utf32(std::string_view input) -> std::expected<std::u32string, unicode_errc> {
+  auto output = std::u32string(input.size(), U'\0');
+  return to_utf32(input, output).transform([&output](auto length) {
+    output.resize(length);
+    return std::move(output);
+  });
+}
+}  // namespace skyr::unicode
+
+#endif  // SKYR_UNICODE_TRANSCODE_HPP
@@ -14,13 +14,16 @@
 
 #include <skyr/config.hpp>
 #include <skyr/core/errors.hpp>
+#include <skyr/core/normalize.hpp>
 #include <skyr/core/parse.hpp>
+#include <skyr/core/query_filter.hpp>
 #include <skyr/core/serialize.hpp>
 #include <skyr/core/url_parse_state.hpp>
 #include <skyr/core/url_record.hpp>
 #include <skyr/domain/domain.hpp>
 #include <skyr/network/ipv4_address.hpp>
 #include <skyr/network/ipv6_address.hpp>
+#include <skyr/percent_encoding/percent_encode.hpp>
 #include <skyr/percent_encoding/percent_encoded_char.hpp>
 #include <skyr/unicode/details/to_u8.hpp>
 #include <skyr/url_search_parameters.hpp>
@@ -140,12 +143,27 @@ class url {
   /// Copy assignment operator
   /// \param other Another `url` object
   /// \return *this
-  url& operator=(const url& other) = default;
+  url& operator=(const url& other) {
+    if (this != &other) {
+      url_ = other.url_;
+      href_ = other.href_;
+      view_ = string_view(href_);
+      parameters_.invalidate();
+    }
+    return *this;
+  }
 
   /// Move assignment operator
   /// \param other Another `url` object
   /// \return *this
-  url& operator=(url&& other) = default;
+  url& operator=(url&& other) noexcept {
+    url_ = std::move(other.url_);
+    href_ = std::move(other.href_);
+    view_ = string_view(href_);
+    other.view_ = string_view(other.href_);
+    parameters_.invalidate();
+    return *this;
+  }
 
   /// Destructor
   ~url() = default;
@@ -159,7 +177,7 @@ class url {
     swap(href_, other.href_);
     view_ = string_view(href_);
     other.view_ = string_view(other.href_);
-    swap(parameters_, other.parameters_);
+    parameters_.swap_state(other.parameters_);
   }
 
   /// Returns the [serialization of the context object’s url](https://url.spec.whatwg.org/#dom-url-href)
@@ -309,10 +327,7 @@ class url {
     auto new_url = url_;
 
     new_url.username.clear();
-    for (auto c : username) {
-      auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-      new_url.username += pct_encoded.to_string();
-    }
+    percent_encoding::percent_encode_append<percent_encoding::encode_sets::userinfo>(username, &new_url.username);
 
     update_record(std::move(new_url));
     return {};
@@ -354,10 +369,7 @@ class url {
     auto new_url = url_;
 
     new_url.password.clear();
-    for (auto c : password) {
-      auto pct_encoded = percent_encode_byte(std::byte(c), percent_encoding::encode_set::userinfo);
-      new_url.password += pct_encoded.to_string();
-    }
+    percent_encoding::percent_encode_append<percent_encoding::encode_sets::userinfo>(password, &new_url.password);
 
     update_record(std::move(new_url));
     return {};
@@ -700,16 +712,54 @@ class url {
     return {};
   }
 
+  /// The search parameters are parsed from the query the first time they
+  /// are accessed after the URL changes, so URLs whose parameters are never
+  /// used don't pay for them
+  ///
   /// \returns A reference to the search parameters
   [[nodiscard]] auto search_parameters() -> url_search_parameters& {
     return parameters_;
   }
 
+  /// The search parameters are parsed from the query the first time they
+  /// are accessed after the URL changes. The parsing is done under a lock,
+  /// so a `const url` can be read from several threads at once
+  ///
   /// \returns A reference to the search parameters
   [[nodiscard]] auto search_parameters() const -> const url_search_parameters& {
     return parameters_;
   }
 
+  /// Removes the query parameters that match a filter, in a single pass over
+  /// the query. The parameters that are kept keep their encoding, and the
+  /// URL isn't serialized again: the query is replaced in `href()`. If every
+  /// parameter is removed, the URL no longer has a query.
+  ///
+  /// \param filter A compiled filter
+  /// \returns `true` if any parameter was removed, `false` if the URL is
+  ///          unchanged
+  auto remove_query_parameters(const query_filter& filter) -> bool {
+    if (!url_.query) {
+      return false;
+    }
+
+    auto query_size = url_.query.value().size();
+    auto fragment_size = url_.fragment ? url_.fragment.value().size() + 1 : 0;
+    if (!filter.apply(&url_)) {
+      return false;
+    }
+
+    auto query_first = href_.size() - fragment_size - query_size;
+    if (url_.query) {
+      href_.replace(query_first, query_size, url_.query.value());
+    } else {
+      href_.erase(query_first - 1, query_size + 1);
+    }
+    view_ = string_view(href_);
+    parameters_.invalidate();
+    return true;
+  }
+
   /// Returns the [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
   ///
   /// \returns The [URL hash string](https://url.spec.whatwg.org/#dom-url-hash)
@@ -885,7 +935,7 @@ class url {
     url_ = std::move(url);
     href_ = serialize(url_);
     view_ = string_view(href_);
-    parameters_.initialize(url_.query ? string_view(url_.query.value()) : string_view{});
+    parameters_.invalidate();
   }
 
   url_record url_;
@@ -945,6 +995,31 @@ inline auto make_url(const Source& input, const url& base) -> std::expected<url,
   return details::make_url(bytes.value(), &base_record);
 }
 
+/// Serializes a URL to `output`, applying the normalizations in `flags`,
+/// e.g. to build a cache key
+///
+/// \code
+/// auto key = std::string{};
+/// skyr::normalize(skyr::url("HTTP://example.com:80/%7euser?b=2&a=1#top"), skyr::normalize_flags::cache_key, &key);
+/// assert(key == "http://example.com/~user?a=1&b=2");
+/// \endcode
+///
+/// \param input A `url` object
+/// \param flags The normalizations to apply
+/// \param output The output buffer, whose contents are replaced
+inline auto normalize(const url& input, normalize_flags flags, url::string_type* output) -> void {
+  normalize(input.record(), flags, output);
+}
+
+/// Serializes a URL, applying the normalizations in `flags`
+///
+/// \param input A `url` object
+/// \param flags The normalizations to apply
+/// \returns The normalized URL string
+inline auto normalize(const url& input, normalize_flags flags = normalize_flags::cache_key) -> url::string_type {
+  return normalize(input.record(), flags);
+}
+
 /// Tests two URLs for equality according to the
 /// [WhatWG specification](https://url.spec.whatwg.org/#url-equivalence)
 ///
@@ -1042,16 +1117,30 @@ inline auto operator"" _url(const char32_t* str, std::size_t length) {
 }
 }  // namespace literals
 
-inline url_search_parameters::url_search_parameters(url* url) : url_(url) {
-  if (url_->record().query) {
-    initialize(url_->record().query.value());
+inline auto url_search_parameters::parameters() const -> details::parameter_list& {
+  auto& state = this->state();
+  if (!state.initialized.load(std::memory_order_acquire)) {
+    auto lock = std::scoped_lock(state.mutex);
+    if (!state.initialized.load(std::memory_order_relaxed)) {
+      state.parameters.clear();
+      reset_index(state);
+      /// The URL's query is already parsed, and parsing it again would only
+      /// percent encode characters that are then decoded
+      if (url_ && url_->record().query) {
+        split(url_->record().query.value(), state.parameters);
+      }
+      state.initialized.store(true, std::memory_order_release);
+    }
   }
+  return state.parameters;
 }
 
 inline void url_search_parameters::update() {
+  auto& state = this->state();
+  reset_index(state);
   if (url_) {
     auto query = to_string();
-    parameters_.clear();
+    state.parameters.clear();
     url_->set_search(std::string_view(query));
   }
 }
@@ -7,15 +7,21 @@
 #define SKYR_URL_SEARCH_PARAMETERS_HPP
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <cstdint>
 #include <format>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include <skyr/core/parse_query.hpp>
+#include <skyr/core/query_view.hpp>
 #include <skyr/percent_encoding/percent_decode.hpp>
 #include <skyr/percent_encoding/percent_encode.hpp>
 
@@ -23,15 +29,408 @@ namespace skyr {
 class url;
 
 namespace details {
-struct is_name {
-  explicit is_name(std::string_view name) : name_(name) {
+/// The position of a parameter's name and value in a `parameter_list`'s pool
+struct parameter_entry {
+  std::uint32_t name_offset;
+  std::uint32_t name_length;
+  /// `npos` if the parameter has no value
+  std::uint32_t value_offset;
+  std::uint32_t value_length;
+};
+
+/// A list of search parameters, with their names and values stored in a
+/// single character pool. Removing a parameter, or replacing a value, leaves
+/// its characters in the pool until they are more than half of it, when the
+/// pool is compacted
+class parameter_list {
+ public:
+  /// Marks a parameter without a value
+  static constexpr auto npos = ~std::uint32_t{0};
+
+  /// A random access iterator through the parameters, which yields views of
+  /// their names and values. As its `reference` isn't a reference, it's only
+  /// an input iterator to code that uses `iterator_category`, like
+  /// `query_view::iterator`; `std::ranges` algorithms and `std::ranges::prev`
+  /// use `iterator_concept`, and treat it as a random access iterator
+  class iterator {
+   public:
+    ///
+    using iterator_concept = std::random_access_iterator_tag;
+    ///
+    using iterator_category = std::input_iterator_tag;
+    ///
+    using value_type = query_parameter_view;
+    ///
+    using reference = value_type;
+    ///
+    using difference_type = std::ptrdiff_t;
+
+    /// Holds the parameter, so that `it->name` can be used
+    struct pointer {
+      query_parameter_view parameter;
+
+      auto operator->() const noexcept -> const query_parameter_view* {
+        return &parameter;
+      }
+    };
+
+    ///
+    iterator() = default;
+
+    ///
+    /// \param list The parameters
+    /// \param position The position of the parameter
+    iterator(const parameter_list* list, difference_type position) : list_(list), position_(position) {
+    }
+
+    ///
+    /// \return
+    [[nodiscard]] auto operator*() const -> reference {
+      return (*list_)[static_cast<std::size_t>(position_)];
+    }
+
+    ///
+    /// \return
+    [[nodiscard]] auto operator->() const -> pointer {
+      return {**this};
+    }
+
+    ///
+    /// \param n
+    /// \return
+    [[nodiscard]] auto operator[](difference_type n) const -> reference {
+      return *(*this + n);
+    }
+
+    ///
+    /// \return
+    auto operator++() noexcept -> iterator& {
+      ++position_;
+      return *this;
+    }
+
+    ///
+    /// \return
+    auto operator++(int) noexcept -> iterator {
+      auto result = *this;
+      ++position_;
+      return result;
+    }
+
+    ///
+    /// \return
+    auto operator--() noexcept -> iterator& {
+      --position_;
+      return *this;
+    }
+
+    ///
+    /// \return
+    auto operator--(int) noexcept -> iterator {
+      auto result = *this;
+      --position_;
+      return result;
+    }
+
+    ///
+    /// \param n
+    /// \return
+    auto operator+=(difference_type n) noexcept -> iterator& {
+      position_ += n;
+      return *this;
+    }
+
+    ///
+    /// \param n
+    /// \return
+    auto operator-=(difference_type n) noexcept -> iterator& {
+      position_ -= n;
+      return *this;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator+(iterator it, difference_type n) noexcept -> iterator {
+      return it += n;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator+(difference_type n, iterator it) noexcept -> iterator {
+      return it += n;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator-(iterator it, difference_type n) noexcept -> iterator {
+      return it -= n;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator-(const iterator& lhs, const iterator& rhs) noexcept -> difference_type {
+      return lhs.position_ - rhs.position_;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept -> bool {
+      return lhs.position_ == rhs.position_;
+    }
+
+    ///
+    [[nodiscard]] friend auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept {
+      return lhs.position_ <=> rhs.position_;
+    }
+
+   private:
+    const parameter_list* list_ = nullptr;
+    difference_type position_ = 0;
+  };
+
+  [[nodiscard]] auto begin() const noexcept -> iterator {
+    return iterator(this, 0);
+  }
+
+  [[nodiscard]] auto end() const noexcept -> iterator {
+    return iterator(this, static_cast<std::ptrdiff_t>(entries_.size()));
+  }
+
+  [[nodiscard]] auto empty() const noexcept {
+    return entries_.empty();
+  }
+
+  [[nodiscard]] auto size() const noexcept {
+    return entries_.size();
+  }
+
+  [[nodiscard]] auto name(std::size_t position) const noexcept -> std::string_view {
+    const auto& entry = entries_[position];
+    return std::string_view(pool_.data() + entry.name_offset, entry.name_length);
+  }
+
+  [[nodiscard]] auto value(std::size_t position) const noexcept -> std::optional<std::string_view> {
+    const auto& entry = entries_[position];
+    if (entry.value_offset == npos) {
+      return std::nullopt;
+    }
+    return std::string_view(pool_.data() + entry.value_offset, entry.value_length);
+  }
+
+  [[nodiscard]] auto operator[](std::size_t position) const noexcept -> query_parameter_view {
+    return {name(position), value(position)};
+  }
+
+  void clear() noexcept {
+    pool_.clear();
+    entries_.clear();
+    garbage_ = 0;
   }
 
-  auto operator()(const query_parameter& parameter) noexcept {
-    return name_ == parameter.name;
+  /// \param parameters The number of parameters
+  /// \param characters The number of characters in their names and values
+  void reserve(std::size_t parameters, std::size_t characters) {
+    entries_.reserve(parameters);
+    pool_.reserve(characters);
+  }
+
+  void append(std::string_view name, std::optional<std::string_view> value) {
+    /// The name or value may be a view of the pool, which is invalidated
+    /// if it grows
+    if (in_pool(name) || (value && in_pool(value.value()))) {
+      auto name_copy = std::string(name);
+      auto value_copy = value ? std::optional<std::string>(value.value()) : std::nullopt;
+      append(name_copy, value_copy);
+      return;
+    }
+
+    auto entry = parameter_entry{store(name), static_cast<std::uint32_t>(name.size()), npos, 0};
+    if (value) {
+      entry.value_offset = store(value.value());
+      entry.value_length = static_cast<std::uint32_t>(value.value().size());
+    }
+    entries_.push_back(entry);
+  }
+
+  /// Appends a parameter from a query, percent decoding its name and value.
+  /// Those that can't be decoded are kept as they are
+  /// \param name The parameter name, percent encoded
+  /// \param value The parameter value, percent encoded
+  void append_decoded(std::string_view name, std::string_view value) {
+    auto name_offset = store(name);
+    auto name_length = decode(name_offset, name);
+    auto value_offset = store(value);
+    auto value_length = decode(value_offset, value);
+    entries_.push_back({name_offset, name_length, value_offset, value_length});
+  }
+
+  void set_value(std::size_t position, std::string_view value) {
+    if (in_pool(value)) {
+      set_value(position, std::string(value));
+      return;
+    }
+
+    auto& entry = entries_[position];
+    garbage_ += (entry.value_offset != npos) ? entry.value_length : 0;
+    entry.value_offset = store(value);
+    entry.value_length = static_cast<std::uint32_t>(value.size());
+    compact_if_needed();
   }
 
-  std::string_view name_;
+  /// Removes the parameters with the given name, starting from a position
+  void remove(std::string_view name, std::size_t first = 0) {
+    auto removed = std::ranges::remove_if(std::ranges::subrange(entries_.begin() + static_cast<std::ptrdiff_t>(first),
+                                                                entries_.end()),
+                                          [this, name](const parameter_entry& entry) {
+                                            if (std::string_view(pool_.data() + entry.name_offset,
+                                                                 entry.name_length) != name) {
+                                              return false;
+                                            }
+                                            garbage_ += entry.name_length;
+                                            garbage_ += (entry.value_offset != npos) ? entry.value_length : 0;
+                                            return true;
+                                          });
+    entries_.erase(removed.begin(), removed.end());
+    compact_if_needed();
+  }
+
+  /// Sorts the parameters by name, keeping the order of those with the same
+  /// name. Only the entries are moved
+  void sort() {
+    std::ranges::stable_sort(entries_, std::less<std::string_view>{}, [this](const parameter_entry& entry) {
+      return std::string_view(pool_.data() + entry.name_offset, entry.name_length);
+    });
+  }
+
+ private:
+  [[nodiscard]] auto in_pool(std::string_view input) const noexcept -> bool {
+    return !input.empty() && std::less_equal<const char*>{}(pool_.data(), input.data()) &&
+           std::less<const char*>{}(input.data(), pool_.data() + pool_.size());
+  }
+
+  auto store(std::string_view input) -> std::uint32_t {
+    auto offset = static_cast<std::uint32_t>(pool_.size());
+    pool_.append(input);
+    return offset;
+  }
+
+  /// Decodes a string stored at the end of the pool in place
+  /// \returns The length of the decoded string
+  auto decode(std::uint32_t offset, std::string_view input) -> std::uint32_t {
+    if (input.find('%') == std::string_view::npos) {
+      return static_cast<std::uint32_t>(input.size());
+    }
+
+    auto length = percent_decode_in_place(std::span<char>(pool_.data() + offset, input.size()));
+    if (!length) {
+      /// The contents are unspecified after a failure
+      std::ranges::copy(input, pool_.data() + offset);
+      return static_cast<std::uint32_t>(input.size());
+    }
+    pool_.resize(offset + length.value());
+    return static_cast<std::uint32_t>(length.value());
+  }
+
+  void compact_if_needed() {
+    if (garbage_ <= (pool_.size() / 2)) {
+      return;
+    }
+
+    auto pool = std::string{};
+    pool.reserve(pool_.size() - garbage_);
+    for (auto& entry : entries_) {
+      auto name_offset = static_cast<std::uint32_t>(pool.size());
+      pool.append(pool_, entry.name_offset, entry.name_length);
+      entry.name_offset = name_offset;
+      if (entry.value_offset != npos) {
+        auto value_offset = static_cast<std::uint32_t>(pool.size());
+        pool.append(pool_, entry.value_offset, entry.value_length);
+        entry.value_offset = value_offset;
+      }
+    }
+    pool_ = std::move(pool);
+    garbage_ = 0;
+  }
+
+  std::string pool_;
+  std::vector<parameter_entry> entries_;
+  /// The number of characters in the pool that no longer belong to a
+  /// parameter
+  std::size_t garbage_ = 0;
+};
+
+/// A hash table from parameter names to the positions of the parameters.
+/// Slots are open addressed, and parameters with the same name are linked in
+/// insertion order
+class parameter_index {
+ public:
+  /// Marks the end of a list of positions
+  static constexpr auto npos = ~std::uint32_t{0};
+
+  [[nodiscard]] auto empty() const noexcept {
+    return slots_.empty();
+  }
+
+  void clear() noexcept {
+    slots_.clear();
+    next_.clear();
+  }
+
+  void build(const parameter_list& parameters) {
+    auto size = std::bit_ceil(2 * parameters.size());
+    slots_.assign(size, npos);
+    next_.assign(parameters.size(), npos);
+
+    /// Parameters are inserted from last to first, each at the head of the
+    /// list for its name, so that the lists are in insertion order
+    for (auto position = static_cast<std::uint32_t>(parameters.size()); position-- > 0;) {
+      auto slot = find_slot(parameters, parameters.name(position));
+      next_[position] = slots_[slot];
+      slots_[slot] = position;
+    }
+  }
+
+  /// \returns The position of the first parameter with the given name, or
+  ///          `npos`
+  [[nodiscard]] auto find(const parameter_list& parameters, std::string_view name) const noexcept
+      -> std::uint32_t {
+    return slots_[find_slot(parameters, name)];
+  }
+
+  /// \returns The position of the next parameter with the same name, or
+  ///          `npos`
+  [[nodiscard]] auto next(std::uint32_t position) const noexcept -> std::uint32_t {
+    return next_[position];
+  }
+
+ private:
+  /// \returns The slot that holds the name, or the empty slot where it
+  ///          would be inserted
+  [[nodiscard]] auto find_slot(const parameter_list& parameters, std::string_view name) const noexcept -> std::size_t {
+    auto mask = slots_.size() - 1;
+    auto slot = std::hash<std::string_view>{}(name) & mask;
+    while ((slots_[slot] != npos) && (parameters.name(slots_[slot]) != name)) {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  std::vector<std::uint32_t> slots_;
+  std::vector<std::uint32_t> next_;
+};
+
+/// The parameters of a `url_search_parameters`, with their index and the
+/// state of their lazy parsing. It's allocated on first access, so a `url`
+/// whose search parameters are never used only holds a pointer
+struct search_parameters_state {
+  parameter_list parameters;
+  /// An index of the names, valid if `indexed` is set
+  parameter_index index;
+  /// Set, with release ordering, once `index` is built
+  std::atomic<bool> indexed = false;
+  /// The number of lookups since the parameters last changed
+  std::atomic<std::uint32_t> lookups = 0;
+  /// Set, with release ordering, once `parameters` is up to date with the
+  /// URL's query
+  std::atomic<bool> initialized = false;
+  /// Held while the parameters are parsed, or the index is built, from a
+  /// `const` member
+  std::mutex mutex;
 };
 }  // namespace details
 
@@ -40,6 +439,17 @@ struct is_name {
 ///
 /// The API closely follows the
 /// [WhatWG IDL specification](https://url.spec.whatwg.org/#interface-urlsearchparams)
+///
+/// As with the standard containers, `const` members can be called from
+/// several threads at once, but a non-`const` member can't be called while
+/// any other member is running on the same object. The parameters of a
+/// `url` are parsed lazily by the first `const` access, under a lock. They
+/// are held, with their index, in a block that is allocated by the first
+/// access, so that a `url` whose search parameters aren't used doesn't pay
+/// for them.
+///
+/// The members that read and write the URL's query are defined after `url`,
+/// in `skyr/url.hpp`, which must be included to use this class.
 class url_search_parameters {
   friend class url;
 
@@ -48,11 +458,22 @@ class url_search_parameters {
   /// \sa url::string_type
   using string_type = std::string;
 
-  /// A key-value pair
+  /// A key-value pair. Parameters are stored in a single character pool,
+  /// so iterators yield a `query_parameter_view`, which can be converted to
+  /// a `value_type`. This isn't the iterators' `value_type`, which is
+  /// `view_type`
   using value_type = query_parameter;
 
+  /// A view of a key-value pair, valid until the parameters change. This is
+  /// the `value_type` of the iterators
+  using view_type = query_parameter_view;
+
+  /// A view of a key-value pair, valid until the parameters change. The
+  /// iterators yield it by value
+  using reference = view_type;
+
   /// An iterator through the search parameters
-  using const_iterator = std::vector<value_type>::const_iterator;
+  using const_iterator = details::parameter_list::iterator;
 
   /// An alias to \c const_iterator
   using iterator = const_iterator;
@@ -63,6 +484,46 @@ class url_search_parameters {
   /// Default constructor
   url_search_parameters() = default;
 
+  /// Copy constructor
+  /// \param other Other search parameters
+  url_search_parameters(const url_search_parameters& other) {
+    assign(other.parameters());
+    url_ = other.url_;
+  }
+
+  /// Move constructor
+  /// \param other Other search parameters
+  url_search_parameters(url_search_parameters&& other) noexcept
+      : url_(other.url_), state_(other.state_.exchange(nullptr, std::memory_order_relaxed)) {
+  }
+
+  /// Copy assignment operator
+  /// \param other Other search parameters
+  /// \returns *this
+  auto operator=(const url_search_parameters& other) -> url_search_parameters& {
+    if (this != &other) {
+      assign(other.parameters());
+      url_ = other.url_;
+    }
+    return *this;
+  }
+
+  /// Move assignment operator
+  /// \param other Other search parameters
+  /// \returns *this
+  auto operator=(url_search_parameters&& other) noexcept -> url_search_parameters& {
+    if (this != &other) {
+      delete state_.exchange(other.state_.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+      url_ = other.url_;
+    }
+    return *this;
+  }
+
+  /// Destructor
+  ~url_search_parameters() {
+    delete state_.load(std::memory_order_relaxed);
+  }
+
   /// Constructor
   /// \param query The search string
   explicit url_search_parameters(std::string_view query) {
@@ -71,18 +532,31 @@ class url_search_parameters {
 
   /// Constructor
   /// \param parameters
-  explicit url_search_parameters(std::vector<query_parameter> parameters) : parameters_(std::move(parameters)) {
+  explicit url_search_parameters(const std::vector<query_parameter>& parameters) {
+    auto& list = this->parameters();
+    for (const auto& [name, value] : parameters) {
+      list.append(name, value);
+    }
   }
 
   /// Constructor
   /// \param parameters
-  url_search_parameters(std::initializer_list<value_type> parameters) : parameters_(parameters) {
+  url_search_parameters(std::initializer_list<value_type> parameters) {
+    auto& list = this->parameters();
+    for (const auto& [name, value] : parameters) {
+      list.append(name, value);
+    }
   }
 
+  /// Swaps the parameters. The parameters of a URL are parsed first, so
+  /// that they aren't lost when they're swapped with parameters that don't
+  /// belong to a URL. Neither URL's query is changed
   ///
   /// \param other
-  void swap(url_search_parameters& other) noexcept {
-    std::swap(parameters_, other.parameters_);
+  void swap(url_search_parameters& other) {
+    parameters();
+    other.parameters();
+    swap_state(other);
   }
 
   /// Appends a name-value pair to the search string
@@ -90,7 +564,7 @@ class url_search_parameters {
   /// \param name The parameter name
   /// \param value The parameter value
   void append(std::string_view name, std::string_view value) {
-    parameters_.emplace_back(std::string(name), std::string(value));
+    parameters().append(name, value);
     update();
   }
 
@@ -98,31 +572,40 @@ class url_search_parameters {
   ///
   /// \param name The name of the parameter to remove
   void remove(std::string_view name) {
-    auto first = std::begin(parameters_), last = std::end(parameters_);
-    auto it = std::remove_if(first, last, details::is_name(name));
-    parameters_.erase(it, last);
+    parameters().remove(name);
     update();
   }
 
   /// \param name The search parameter name
   /// \returns The first search parameter value with the given name
   [[nodiscard]] auto get(std::string_view name) const -> std::optional<string_type> {
-    auto first = std::cbegin(parameters_), last = std::cend(parameters_);
-    auto it = std::find_if(first, last, details::is_name(name));
-    return (it != last) ? it->value : std::nullopt;
+    const auto& parameters = this->parameters();
+    if (use_index()) {
+      auto position = state().index.find(parameters, name);
+      return (position != details::parameter_index::npos) ? to_string_type(parameters.value(position)) : std::nullopt;
+    }
+
+    auto it = std::ranges::find(parameters, name, &query_parameter_view::name);
+    return (it != parameters.end()) ? to_string_type(it->value) : std::nullopt;
   }
 
   /// \param name The search parameter name
   /// \returns All search parameter values with the given name
   [[nodiscard]] auto get_all(std::string_view name) const -> std::vector<string_type> {
-    // Count matching parameters first to reserve exact size
-    auto count = std::count_if(parameters_.begin(), parameters_.end(), details::is_name(name));
-
+    const auto& parameters = this->parameters();
     std::vector<string_type> result;
-    result.reserve(count);
-    for (auto [parameter_name, value] : parameters_) {
+    if (use_index()) {
+      const auto& index = state().index;
+      for (auto position = index.find(parameters, name); position != details::parameter_index::npos;
+           position = index.next(position)) {
+        result.emplace_back(parameters.value(position).value_or(std::string_view{}));
+      }
+      return result;
+    }
+
+    for (auto [parameter_name, value] : parameters) {
       if (parameter_name == name) {
-        result.emplace_back(value.value_or(""));
+        result.emplace_back(value.value_or(std::string_view{}));
       }
     }
     return result;
@@ -133,9 +616,13 @@ class url_search_parameters {
   /// \param name The search parameter name
   /// \returns `true` if the value is in the search parameters,
   /// `false` otherwise.
-  [[nodiscard]] auto contains(std::string_view name) const noexcept -> bool {
-    auto first = std::cbegin(parameters_), last = std::cend(parameters_);
-    return std::find_if(first, last, details::is_name(name)) != last;
+  [[nodiscard]] auto contains(std::string_view name) const -> bool {
+    const auto& parameters = this->parameters();
+    if (use_index()) {
+      return state().index.find(parameters, name) != details::parameter_index::npos;
+    }
+
+    return std::ranges::find(parameters, name, &query_parameter_view::name) != parameters.end();
   }
 
   /// Sets a URL search parameter
@@ -143,16 +630,14 @@ class url_search_parameters {
   /// \param name The search parameter name
   /// \param value The search parameter value
   void set(std::string_view name, std::string_view value) {
-    auto first = std::begin(parameters_), last = std::end(parameters_);
-    auto it = std::find_if(first, last, details::is_name(name));
-    if (it != last) {
-      it->value = value;
-
-      ++it;
-      it = std::remove_if(it, last, details::is_name(name));
-      parameters_.erase(it, last);
+    auto& parameters = this->parameters();
+    auto it = std::ranges::find(parameters, name, &query_parameter_view::name);
+    if (it != parameters.end()) {
+      auto position = static_cast<std::size_t>(it - parameters.begin());
+      parameters.set_value(position, value);
+      parameters.remove(name, position + 1);
     } else {
-      append(name, value);
+      parameters.append(name, value);
     }
     update();
   }
@@ -160,8 +645,8 @@ class url_search_parameters {
   /// Clears the search parameters
   ///
   /// \post `empty() == true`
-  void clear() noexcept {
-    parameters_.clear();
+  void clear() {
+    parameters().clear();
     update();
   }
 
@@ -176,43 +661,40 @@ class url_search_parameters {
   /// assert(url.search() == "?key=e1f7bc78&q=%F0%9F%8F%B3%EF%B8%8F%E2%80%8D%F0%9F%8C%88");
   /// ```
   void sort() {
-    static constexpr auto less_name = [](const auto& lhs, const auto& rhs) { return lhs.name < rhs.name; };
-
-    auto first = std::begin(parameters_), last = std::end(parameters_);
-    std::sort(first, last, less_name);
+    parameters().sort();
     update();
   }
 
   /// \returns An iterator to the first element in the search parameters
-  [[nodiscard]] auto cbegin() const noexcept {
-    return parameters_.cbegin();
+  [[nodiscard]] auto cbegin() const -> const_iterator {
+    return parameters().begin();
   }
 
   /// \returns An iterator to the last element in the search parameters
-  [[nodiscard]] auto cend() const noexcept {
-    return parameters_.cend();
+  [[nodiscard]] auto cend() const -> const_iterator {
+    return parameters().end();
   }
 
   /// \returns An iterator to the first element in the search parameters
-  [[nodiscard]] auto begin() const noexcept {
+  [[nodiscard]] auto begin() const -> const_iterator {
     return cbegin();
   }
 
   /// \returns An iterator to the last element in the search parameters
-  [[nodiscard]] auto end() const noexcept {
+  [[nodiscard]] auto end() const -> const_iterator {
     return cend();
   }
 
   /// \returns `true` if the URL search string is empty, `false`
   ///          otherwise
-  [[nodiscard]] auto empty() const noexcept {
-    return parameters_.empty();
+  [[nodiscard]] auto empty() const {
+    return parameters().empty();
   }
 
   /// \returns The size of the parameters array (i.e. the
   ///          number of parameters)
-  [[nodiscard]] auto size() const noexcept {
-    return parameters_.size();
+  [[nodiscard]] auto size() const {
+    return parameters().size();
   }
 
   /// \returns The serialized URL search parameters
@@ -220,7 +702,7 @@ class url_search_parameters {
     auto result = string_type{};
 
     bool start = true;
-    for (const auto& [name, value] : parameters_) {
+    for (auto [name, value] : parameters()) {
       if (start) {
         result.append(percent_encode(name));
         start = false;
@@ -236,28 +718,152 @@ class url_search_parameters {
   }
 
  private:
-  explicit url_search_parameters(url* url);
-
-  void initialize(std::string_view query) {
-    if (auto parameters = parse_query(query); parameters) {
-      for (auto [name, value] : parameters.value()) {
-        auto name_ = percent_decode(name).value_or(std::string(name));
-        auto value_ = value ? percent_decode(value.value()).value_or(std::string(value.value())) : std::string();
-        parameters_.emplace_back(name_, value_);
+  explicit url_search_parameters(url* url) : url_(url) {
+  }
+
+  /// Marks the parameters as out of date with the URL's query. They are
+  /// parsed again the next time they are accessed
+  void invalidate() noexcept {
+    if (auto state = state_.load(std::memory_order_relaxed); state) {
+      state->initialized.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  /// Swaps the parameters as they are, parsed or not, as `url::swap` does
+  /// when it swaps the queries too
+  void swap_state(url_search_parameters& other) noexcept {
+    other.state_.store(state_.exchange(other.state_.load(std::memory_order_relaxed), std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+  }
+
+  /// \returns The parameters and their index, which are allocated by the
+  ///          first access. If several `const` accesses allocate them at
+  ///          once, all but one are discarded
+  auto state() const -> details::search_parameters_state& {
+    auto state = state_.load(std::memory_order_acquire);
+    if (!state) {
+      auto created = std::make_unique<details::search_parameters_state>();
+      if (state_.compare_exchange_strong(state, created.get(), std::memory_order_acq_rel,
+                                         std::memory_order_acquire)) {
+        state = created.release();
+      }
+    }
+    return *state;
+  }
+
+  /// Replaces the parameters with a copy, which is up to date
+  void assign(const details::parameter_list& parameters) {
+    auto& state = this->state();
+    state.parameters = parameters;
+    reset_index(state);
+    state.initialized.store(true, std::memory_order_relaxed);
+  }
+
+  /// \returns The parameters, parsing the URL's query first if it has
+  ///          changed since they were last accessed. Concurrent `const`
+  ///          accesses wait for the first one to parse them. Defined in
+  ///          `skyr/url.hpp`
+  auto parameters() const -> details::parameter_list&;
+
+  /// Lookups use an index of the names if there are enough parameters, and
+  /// enough lookups since the parameters last changed to pay for building it.
+  /// The parameters are parsed first if they are out of date, and the index
+  /// is built under the same lock, so concurrent lookups wait for the first
+  /// one to build it
+  /// \returns `true` if lookups should use the index
+  auto use_index() const -> bool {
+    if (parameters().size() < index_threshold) {
+      return false;
+    }
+
+    auto& state = this->state();
+    if (!state.indexed.load(std::memory_order_acquire)) {
+      if ((state.lookups.fetch_add(1, std::memory_order_relaxed) + 1) < index_lookups) {
+        return false;
       }
+
+      auto lock = std::scoped_lock(state.mutex);
+      if (!state.indexed.load(std::memory_order_relaxed)) {
+        state.index.build(state.parameters);
+        state.indexed.store(true, std::memory_order_release);
+      }
+    }
+    return true;
+  }
+
+  /// Marks the index as out of date with the parameters
+  static void reset_index(details::search_parameters_state& state) noexcept {
+    state.index.clear();
+    state.indexed.store(false, std::memory_order_relaxed);
+    state.lookups.store(0, std::memory_order_relaxed);
+  }
+
+  /// Parses the query as `parse_query` does, but stores the parameters in
+  /// the pool directly, decoding them in place
+  void initialize(std::string_view query) const {
+    if (!query.empty() && (query.front() == '?')) {
+      query.remove_prefix(1);
+    }
+
+    [[maybe_unused]] auto validation_error = false;
+    auto url = details::basic_parse(query, &validation_error, nullptr, nullptr, url_parse_state::query);
+    if (url && url.value().query) {
+      split(url.value().query.value(), parameters());
+    }
+  }
+
+  /// Splits a query that has already been parsed. An empty query has no
+  /// parameters
+  static void split(std::string_view query, details::parameter_list& parameters) {
+    constexpr auto is_separator = [](char byte) { return (byte == '&') || (byte == ';'); };
+
+    if (query.empty()) {
+      return;
+    }
+
+    parameters.reserve(static_cast<std::size_t>(std::ranges::count_if(query, is_separator)) + 1, query.size());
+    while (true) {
+      auto parameter =
+          query.substr(0, static_cast<std::size_t>(std::ranges::find_if(query, is_separator) - query.begin()));
+      auto delim = parameter.find('=');
+      if (delim != std::string_view::npos) {
+        parameters.append_decoded(parameter.substr(0, delim), parameter.substr(delim + 1));
+      } else {
+        parameters.append_decoded(parameter, std::string_view{});
+      }
+
+      if (parameter.size() == query.size()) {
+        break;
+      }
+      query.remove_prefix(parameter.size() + 1);
     }
   }
 
+  /// \returns A copy of a value
+  static auto to_string_type(std::optional<std::string_view> value) -> std::optional<string_type> {
+    return value ? std::optional<string_type>(value.value()) : std::nullopt;
+  }
+
+  /// Writes the parameters to the URL's query. Defined in `skyr/url.hpp`
   void update();
 
-  std::vector<value_type> parameters_;
+  /// Lookups on at least this many parameters use an index of the names
+  /// instead of a linear search, from this many lookups after the parameters
+  /// change. Building the index costs about as much as 4 to 8 linear
+  /// searches (see `benchmark/search_parameters_bench.cpp`), so a few
+  /// lookups never cost more than twice as much as without it
+  static constexpr auto index_threshold = std::size_t{32};
+  static constexpr auto index_lookups = std::uint32_t{8};
+
   url* url_ = nullptr;
+  /// Allocated, with release ordering, by the first access
+  mutable std::atomic<details::search_parameters_state*> state_ = nullptr;
 };
 
 ///
 /// \param lhs
 /// \param rhs
-inline void swap(url_search_parameters& lhs, url_search_parameters& rhs) noexcept {
+inline void swap(url_search_parameters& lhs, url_search_parameters& rhs) {
   lhs.swap(rhs);
 }
 }  // namespace skyr
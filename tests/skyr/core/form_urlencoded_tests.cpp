@@ -0,0 +1,174 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/core/form_urlencoded.hpp>
+#include <skyr/url.hpp>
+#include <skyr/url_search_parameters.hpp>
+
+namespace {
+using pairs = std::vector<std::pair<std::string, std::string>>;
+
+/// Decodes a body in chunks of the given size
+auto decode(std::string_view body, std::size_t chunk_size = std::string_view::npos) -> pairs {
+  auto result = pairs{};
+  auto append = [&result](std::string_view name, std::string_view value) { result.emplace_back(name, value); };
+
+  auto decoder = skyr::form_decoder{};
+  for (auto first = std::size_t{0}; first < body.size(); first += chunk_size) {
+    REQUIRE(decoder.feed(body.substr(first, chunk_size), append));
+  }
+  decoder.finish(append);
+  return result;
+}
+
+auto encode(const pairs& parameters) -> std::string {
+  auto result = std::string{};
+  skyr::form_encode(parameters, std::back_inserter(result));
+  return result;
+}
+}  // namespace
+
+TEST_CASE("form_decoder", "[form_urlencoded]") {
+  SECTION("empty") {
+    CHECK(decode("").empty());
+    CHECK(decode("&&&").empty());
+  }
+
+  SECTION("names_and_values") {
+    CHECK(decode("a=1&b=2") == pairs{{"a", "1"}, {"b", "2"}});
+    CHECK(decode("a&b=") == pairs{{"a", ""}, {"b", ""}});
+    CHECK(decode("=&=x") == pairs{{"", ""}, {"", "x"}});
+    CHECK(decode("a=b=c") == pairs{{"a", "b=c"}});
+  }
+
+  SECTION("semicolons_are_not_separators") {
+    CHECK(decode("a=1;b=2") == pairs{{"a", "1;b=2"}});
+  }
+
+  SECTION("plus_is_space") {
+    CHECK(decode("first+name=Jane+Q.+Public&q=a%2Bb") == pairs{{"first name", "Jane Q. Public"}, {"q", "a+b"}});
+  }
+
+  SECTION("percent_decoding") {
+    CHECK(decode("%E4%BE%8B=%41%62") == pairs{{"\xe4\xbe\x8b", "Ab"}});
+    CHECK(decode("a=%zz%4&b=%&c=%4G") == pairs{{"a", "%zz%4"}, {"b", "%"}, {"c", "%4G"}});
+    CHECK(decode("a=%26%3D") == pairs{{"a", "&="}});
+    CHECK(decode("a=%") == pairs{{"a", "%"}});
+    CHECK(decode("a=%4") == pairs{{"a", "%4"}});
+  }
+
+  SECTION("invalid_utf8_is_replaced") {
+    CHECK(decode("a=%FF") == pairs{{"a", "\xef\xbf\xbd"}});
+    CHECK(decode("a=%E4%BE") == pairs{{"a", "\xef\xbf\xbd"}});
+    CHECK(decode("a=%E4%BEx") == pairs{{"a", "\xef\xbf\xbdx"}});
+    CHECK(decode("%C3=%E4%C3%A9") == pairs{{"\xef\xbf\xbd", "\xef\xbf\xbd\xc3\xa9"}});
+  }
+
+  SECTION("any_chunk_size") {
+    auto body = std::string_view("first+name=Jane&%E4%BE%8B=%41%62%&x=%4&&y=a%2Bb%E4%BE+%zz=&=");
+    auto expected = decode(body);
+    REQUIRE(expected.size() == 5);
+    for (auto chunk_size = std::size_t{1}; chunk_size <= body.size(); ++chunk_size) {
+      CHECK(decode(body, chunk_size) == expected);
+    }
+  }
+
+  SECTION("same_as_url_search_parameters") {
+    auto body = std::string_view("a=1&b=%41%42&c&d=%E4%BE%8B");
+    auto parameters = skyr::url_search_parameters(body);
+    auto expected = pairs{};
+    for (auto [name, value] : parameters) {
+      expected.emplace_back(name, value.value_or(""));
+    }
+    CHECK(decode(body, 3) == expected);
+  }
+
+  SECTION("max_pair_size") {
+    auto decoder = skyr::form_decoder(8);
+    auto count = 0;
+    auto append = [&count](std::string_view, std::string_view) { ++count; };
+    CHECK(decoder.feed("name=val&", append));
+    CHECK(count == 1);
+    CHECK(decoder.feed("name=", append));
+    auto result = decoder.feed("value", append);
+    REQUIRE(!result);
+    CHECK(result.error() == skyr::percent_encoding::percent_encode_errc::overflow);
+
+    decoder.reset();
+    CHECK(decoder.feed("a=b", append));
+    decoder.finish(append);
+    CHECK(count == 2);
+  }
+
+  SECTION("max_pair_size_with_one_large_chunk") {
+    auto decoder = skyr::form_decoder(1024);
+    auto pairs_found = pairs{};
+    auto append = [&pairs_found](std::string_view name, std::string_view value) {
+      pairs_found.emplace_back(name, value);
+    };
+
+    auto at_limit = "a=" + std::string(1023, 'b');
+    CHECK(decoder.feed(at_limit, append));
+    decoder.finish(append);
+    REQUIRE(pairs_found.size() == 1);
+    CHECK(pairs_found[0].second.size() == 1023);
+
+    auto result = decoder.feed("a=" + std::string(4 << 20, 'b'), append);
+    REQUIRE(!result);
+    CHECK(result.error() == skyr::percent_encoding::percent_encode_errc::overflow);
+
+    decoder.reset();
+    CHECK(decoder.feed("c=d", append));
+    decoder.finish(append);
+    CHECK(pairs_found.back() == std::pair<std::string, std::string>{"c", "d"});
+  }
+}
+
+TEST_CASE("form_encoder", "[form_urlencoded]") {
+  SECTION("empty") {
+    CHECK(encode({}).empty());
+    CHECK(encode({{"", ""}}) == "=");
+  }
+
+  SECTION("encoding") {
+    CHECK(encode({{"first name", "Jane Q. Public"}, {"q", "a+b&c=d"}}) ==
+          "first+name=Jane+Q.+Public&q=a%2Bb%26c%3Dd");
+    CHECK(encode({{"k", "*-._ ~!'()"}}) == "k=*-._+%7E%21%27%28%29");
+    CHECK(encode({{"\xe4\xbe\x8b", "%"}}) == "%E4%BE%8B=%25");
+  }
+
+  SECTION("incremental") {
+    auto result = std::string{};
+    auto encoder = skyr::form_encoder(std::back_inserter(result));
+    encoder.append("a", "1").append("b", "2 3");
+    CHECK(result == "a=1&b=2+3");
+  }
+
+  SECTION("to_a_buffer") {
+    auto buffer = std::array<char, 16>{};
+    auto last = skyr::form_encode(pairs{{"a", "b c"}}, buffer.data());
+    CHECK(std::string_view(buffer.data(), last) == "a=b+c");
+  }
+
+  SECTION("url_search_parameters") {
+    auto parameters = skyr::url_search_parameters{{"a", "b c"}, {"d"}};
+    auto result = std::string{};
+    skyr::form_encode(parameters, std::back_inserter(result));
+    CHECK(result == "a=b+c&d=");
+  }
+
+  SECTION("round_trip") {
+    auto parameters = pairs{{"a b", "c+d"}, {"\xe4\xbe\x8b", "%41"}, {"", "&="}};
+    CHECK(decode(encode(parameters), 2) == parameters);
+  }
+}
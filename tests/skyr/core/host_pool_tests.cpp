@@ -0,0 +1,114 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/core/host_pool.hpp>
+
+TEST_CASE("host_pool_tests", "[host_pool]") {
+  using namespace std::string_view_literals;
+
+  SECTION("intern_a_name") {
+    auto pool = skyr::host_pool{};
+    auto host = pool.intern("example.com");
+    CHECK(host.id == 0);
+    CHECK(host.name == "example.com");
+    CHECK(pool.size() == 1);
+  }
+
+  SECTION("intern_the_same_name") {
+    auto pool = skyr::host_pool{};
+    auto name = std::string("example.com");
+    auto first = pool.intern(name);
+    name = "example.org";
+    auto second = pool.intern("example.com");
+    CHECK(first == second);
+    CHECK(first.name.data() == second.name.data());
+    CHECK(first.name == "example.com");
+    CHECK(pool.size() == 1);
+  }
+
+  SECTION("intern_different_names") {
+    auto pool = skyr::host_pool{};
+    auto first = pool.intern("example.com");
+    auto second = pool.intern("example.org");
+    CHECK(first != second);
+    CHECK(second.id == 1);
+    CHECK(pool.name(0) == "example.com");
+    CHECK(pool.name(1) == "example.org");
+  }
+
+  SECTION("find") {
+    auto pool = skyr::host_pool{};
+    pool.intern("example.com");
+    CHECK(pool.find("example.com").value().id == 0);
+    CHECK_FALSE(pool.find("example.org"));
+    CHECK(pool.size() == 1);
+  }
+
+  SECTION("names_remain_valid") {
+    auto pool = skyr::host_pool{};
+    auto first = pool.intern("example.com");
+    for (auto i = 0; i < 10'000; ++i) {
+      pool.intern("host" + std::to_string(i) + ".example.com");
+    }
+    pool.intern(std::string(100'000, 'a'));
+    pool.intern("after.example.com");
+    CHECK(first.name == "example.com");
+    CHECK(pool.name(10'001).size() == 100'000);
+    CHECK(pool.name(10'002) == "after.example.com");
+  }
+
+  SECTION("intern_parsed_hosts") {
+    auto pool = skyr::host_pool{};
+    auto validation_error = false;
+    auto domain = pool.parse_and_intern("EXAMPLE.com", false, &validation_error);
+    REQUIRE(domain);
+    CHECK(domain.value().name == "example.com");
+    CHECK(domain.value() == pool.intern("example.com"));
+
+    auto ipv6 = pool.parse_and_intern("[::1]", false, &validation_error);
+    REQUIRE(ipv6);
+    CHECK(ipv6.value().name == "[::1]");
+
+    auto invalid = pool.parse_and_intern("exa mple.com", false, &validation_error);
+    CHECK_FALSE(invalid);
+    CHECK(pool.size() == 2);
+  }
+
+  SECTION("intern_hosts") {
+    auto pool = skyr::host_pool{};
+    auto name = pool.intern(skyr::host(skyr::domain_name{"example.com"}));
+    CHECK(name == pool.intern("example.com"));
+    CHECK(pool.intern(skyr::host(skyr::opaque_host{"opaque"})).name == "opaque");
+    CHECK(pool.intern(skyr::host(skyr::ipv4_address(0x7f000001))).name == "127.0.0.1");
+    CHECK(pool.intern(skyr::host(skyr::empty_host{})).name.empty());
+    CHECK(pool.size() == 4);
+  }
+
+  SECTION("intern_concurrently") {
+    auto pool = skyr::host_pool{};
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < 4; ++t) {
+      threads.emplace_back([&pool]() {
+        for (auto i = 0; i < 1'000; ++i) {
+          pool.intern("host" + std::to_string(i) + ".example.com");
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    CHECK(pool.size() == 1'000);
+    for (auto i = 0u; i < 1'000u; ++i) {
+      CHECK(pool.find(pool.name(i)).value().id == i);
+    }
+  }
+}
@@ -0,0 +1,125 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/core/parse.hpp>
+#include <skyr/core/query_filter.hpp>
+#include <skyr/core/serialize.hpp>
+
+namespace {
+auto apply(const skyr::query_filter& filter, std::string query) -> std::string {
+  filter.apply(&query);
+  return query;
+}
+}  // namespace
+
+TEST_CASE("query_filter_matches", "[query_filter]") {
+  const auto filter = skyr::query_filter::compile({"fbclid", "gclid", "utm_source_extra"}, {"utm_", "mc_", "utm_s"});
+
+  SECTION("names") {
+    CHECK(filter.matches("fbclid"));
+    CHECK(filter.matches("gclid"));
+    CHECK(!filter.matches("fbclid2"));
+    CHECK(!filter.matches("clid"));
+    CHECK(!filter.matches(""));
+  }
+
+  SECTION("prefixes") {
+    CHECK(filter.matches("utm_"));
+    CHECK(filter.matches("utm_source"));
+    CHECK(filter.matches("utm_source_extra"));
+    CHECK(filter.matches("mc_cid"));
+    CHECK(!filter.matches("utm"));
+    CHECK(!filter.matches("mc"));
+    CHECK(!filter.matches("lutm_source"));
+  }
+
+  SECTION("empty_filter") {
+    auto empty = skyr::query_filter();
+    CHECK(empty.empty());
+    CHECK(!empty.matches("a"));
+    auto query = std::string("a=b");
+    CHECK(!empty.apply(&query));
+  }
+
+  SECTION("from_ranges") {
+    auto names = std::vector<std::string>{"a", "b", "a"};
+    auto prefixes = std::vector<std::string>{"x", "xy", "z"};
+    auto compiled = skyr::query_filter::compile(names, prefixes);
+    CHECK(compiled.matches("a"));
+    CHECK(compiled.matches("b"));
+    CHECK(compiled.matches("xyz"));
+    CHECK(compiled.matches("zz"));
+    CHECK(!compiled.matches("y"));
+  }
+
+  SECTION("many_names") {
+    auto names = std::vector<std::string>{};
+    for (auto i = 0; i < 200; ++i) {
+      names.push_back("tracker_" + std::to_string(i));
+    }
+    auto compiled = skyr::query_filter::compile(names, std::vector<std::string>{});
+    for (const auto& name : names) {
+      CHECK(compiled.matches(name));
+    }
+    CHECK(!compiled.matches("tracker_200"));
+  }
+}
+
+TEST_CASE("query_filter_apply", "[query_filter]") {
+  const auto filter = skyr::query_filter::compile({"fbclid", "gclid"}, {"utm_"});
+
+  SECTION("nothing_matches") {
+    auto query = std::string("id=42&&q=a%20b;x");
+    CHECK(!filter.apply(&query));
+    CHECK(query == "id=42&&q=a%20b;x");
+  }
+
+  SECTION("first_middle_and_last") {
+    CHECK(apply(filter, "utm_source=a&id=42") == "id=42");
+    CHECK(apply(filter, "id=42&gclid=x&q=1") == "id=42&q=1");
+    CHECK(apply(filter, "id=42&q=1&fbclid=y") == "id=42&q=1");
+    CHECK(apply(filter, "utm_a=1&id=42&utm_b=2&q=1&utm_c=3") == "id=42&q=1");
+  }
+
+  SECTION("everything_matches") {
+    CHECK(apply(filter, "utm_a=1&gclid=2").empty());
+  }
+
+  SECTION("encoding_and_separators_are_kept") {
+    CHECK(apply(filter, "q=caf%C3%A9+x;utm_medium=a;page=%2F2") == "q=caf%C3%A9+x;page=%2F2");
+    CHECK(apply(filter, "a=1&utm_x;b=2") == "a=1;b=2");
+  }
+
+  SECTION("empty_parameters_are_removed") {
+    CHECK(apply(filter, "&&a=1&&gclid=x&&b&") == "a=1&b");
+  }
+
+  SECTION("names_without_values") {
+    CHECK(apply(filter, "gclid&a") == "a");
+  }
+
+  SECTION("encoded_names") {
+    CHECK(apply(filter, "utm%5Fsource=a&%67clid=b&id=1") == "id=1");
+  }
+
+  SECTION("url_record") {
+    auto url = skyr::parse("https://example.com/?utm_source=a&id=42#top").value();
+    CHECK(filter.apply(&url));
+    CHECK(skyr::serialize(url) == "https://example.com/?id=42#top");
+
+    url = skyr::parse("https://example.com/?gclid=a#top").value();
+    CHECK(filter.apply(&url));
+    CHECK(!url.query);
+    CHECK(skyr::serialize(url) == "https://example.com/#top");
+
+    url = skyr::parse("https://example.com/").value();
+    CHECK(!filter.apply(&url));
+  }
+}
@@ -0,0 +1,108 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/core/query_view.hpp>
+
+namespace {
+template <class Range>
+auto to_vector(Range&& parameters) {
+  auto result = std::vector<std::pair<std::string, std::optional<std::string>>>{};
+  for (auto [name, value] : parameters) {
+    result.emplace_back(std::string(name), value ? std::optional<std::string>(value.value()) : std::nullopt);
+  }
+  return result;
+}
+}  // namespace
+
+static_assert(std::ranges::forward_range<skyr::query_view>);
+static_assert(std::ranges::borrowed_range<skyr::query_view>);
+static_assert(std::ranges::input_range<skyr::query_view::decoded_view>);
+
+TEST_CASE("query_view_tests", "[query_view]") {
+  using parameters = std::vector<std::pair<std::string, std::optional<std::string>>>;
+
+  SECTION("empty_query") {
+    CHECK(skyr::query_view().empty());
+    CHECK(skyr::query_view("").empty());
+    CHECK(skyr::query_view("?").empty());
+  }
+
+  SECTION("names_and_values") {
+    auto query = skyr::query_view("?a=b&c=d");
+    CHECK(to_vector(query) == parameters{{"a", "b"}, {"c", "d"}});
+  }
+
+  SECTION("semicolon_separator") {
+    CHECK(to_vector(skyr::query_view("a=b;c=d")) == parameters{{"a", "b"}, {"c", "d"}});
+  }
+
+  SECTION("parameters_without_values") {
+    CHECK(to_vector(skyr::query_view("a&b=&=c")) == parameters{{"a", std::nullopt}, {"b", ""}, {"", "c"}});
+  }
+
+  SECTION("value_with_equals") {
+    CHECK(to_vector(skyr::query_view("a=b=c")) == parameters{{"a", "b=c"}});
+  }
+
+  SECTION("empty_parameters_are_skipped") {
+    CHECK(to_vector(skyr::query_view("&&a=b&;&c=d&")) == parameters{{"a", "b"}, {"c", "d"}});
+    CHECK(skyr::query_view("&;&").empty());
+  }
+
+  SECTION("views_refer_to_the_query") {
+    auto query = std::string("a=b&c=d");
+    auto parameter = skyr::query_view(query).front();
+    CHECK(parameter.name.data() == query.data());
+    CHECK(parameter.value.value().data() == query.data() + 2);
+  }
+
+  SECTION("get") {
+    auto query = skyr::query_view("utm_source=mail&id=42&flag&id=43");
+    CHECK(query.get("id") == "42");
+    CHECK(query.get("flag") == "");
+    CHECK(!query.get("missing"));
+    CHECK(query.contains("utm_source"));
+    CHECK(!query.contains("utm"));
+  }
+
+  SECTION("names_are_not_decoded") {
+    auto query = skyr::query_view("%61=b");
+    CHECK(!query.contains("a"));
+    CHECK(query.contains("%61"));
+  }
+
+  SECTION("range_algorithms") {
+    auto query = skyr::query_view("utm_source=a&id=1&utm_medium=b&x=2");
+    auto is_tracking = [](auto parameter) { return parameter.name.starts_with("utm_"); };
+    CHECK(std::ranges::count_if(query, is_tracking) == 2);
+    CHECK(std::ranges::distance(query) == 4);
+  }
+}
+
+TEST_CASE("query_view_decoded_tests", "[query_view]") {
+  using parameters = std::vector<std::pair<std::string, std::optional<std::string>>>;
+
+  SECTION("decoded") {
+    auto query = skyr::query_view("q=caf%C3%A9&%6Bey=e1f7bc78&flag");
+    CHECK(to_vector(query.decoded()) == parameters{{"q", "caf\xc3\xa9"}, {"key", "e1f7bc78"}, {"flag", std::nullopt}});
+  }
+
+  SECTION("unencoded_parameters_refer_to_the_query") {
+    auto query = std::string("a=b");
+    auto decoded = skyr::query_view(query).decoded();
+    auto parameter = *decoded.begin();
+    CHECK(parameter.name.data() == query.data());
+  }
+
+  SECTION("invalid_percent_encoding_is_kept") {
+    CHECK(to_vector(skyr::query_view("a=%zz&b=%4").decoded()) == parameters{{"a", "%zz"}, {"b", "%4"}});
+  }
+}
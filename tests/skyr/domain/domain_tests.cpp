@@ -18,7 +18,10 @@ TEST_CASE("valid domains to ascii", "[domain]") {
       param{"example.com", "example.com"}, param{"sub.example.com", "sub.example.com"}, param{"⌘.ws", "xn--bih.ws"},
       param{"你好你好", "xn--6qqa088eba"}, param{"你好你好.com", "xn--6qqa088eba.com"},
       param{"उदाहरण.परीक्षा", "xn--p1b6ci4b4b3a.xn--11b5bs3a9aj6g"}, param{"faß.ExAmPlE", "xn--fa-hia.example"},
-      param{"βόλος.com", "xn--nxasmm1c.com"}, param{"Ｇｏ.com", "go.com"});
+      param{"βόλος.com", "xn--nxasmm1c.com"}, param{"Ｇｏ.com", "go.com"}, param{"ﬁle.com", "file.com"},
+      param{"㎒.com", "mhz.com"}, param{"ǆ.com", "xn--d-toa.com"}, param{"ℌello.com", "hello.com"},
+      param{"café.com", "xn--caf-dma.com"}, param{"cafe\xcc\x81.com", "xn--caf-dma.com"},
+      param{"\xe2\x84\xab.com", "xn--5ca.com"});
 
   SECTION("domain_to_ascii_tests") {
     const auto& [input, expected] = domain;
@@ -76,6 +79,13 @@ TEST_CASE("invalid domains", "[domain]") {
     REQUIRE_FALSE(instance);
   }
 
+  SECTION("invalid_domain_punycode_not_nfc") {
+    /// "cafe\u0301"
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("xn--cafe-yvc.com", &output);
+    REQUIRE_FALSE(instance);
+  }
+
   SECTION("invalid_name_long_name") {
     auto domain = std::string(300, 'x') + ".com";
     auto output = std::string{};
@@ -133,9 +143,7 @@ TEST_CASE("web platform tests", "[domain]") {
     auto instance = skyr::domain_to_ascii("xn--zn7c.com", &output);
     REQUIRE_FALSE(instance);
   }
-}
 
-TEST_CASE("web platform tests mayfail", "[domain][!mayfail]") {
   /// CheckJoiners
   SECTION("toascii_04") {
     auto output = std::string{};
@@ -162,3 +170,74 @@ TEST_CASE("web platform tests mayfail", "[domain][!mayfail]") {
     REQUIRE_FALSE(instance);
   }
 }
+
+TEST_CASE("bidi domains", "[domain]") {
+  SECTION("rtl_label") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd7\x90\xd7\x91.com", &output);
+    REQUIRE(instance);
+    CHECK("xn--4dbc.com" == output);
+  }
+
+  SECTION("rtl_label_with_digits") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd7\x90""1", &output);
+    REQUIRE(instance);
+  }
+
+  SECTION("ascii_label_in_bidi_domain_starting_with_a_digit") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("0a.\xd7\x90", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("ascii_label_starting_with_a_digit") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("0a.com", &output);
+    REQUIRE(instance);
+  }
+
+  SECTION("rtl_label_ending_with_ltr") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd7\x90""a", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("rtl_label_with_mixed_numbers") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd8\xa7""1\xd9\xa1", &output);
+    REQUIRE_FALSE(instance);
+  }
+}
+
+TEST_CASE("joiners", "[domain]") {
+  SECTION("zwnj_after_virama") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xe0\xa4\x95\xe0\xa5\x8d\xe2\x80\x8c", &output);
+    REQUIRE(instance);
+  }
+
+  SECTION("zwnj_between_latin") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("a\xe2\x80\x8c""b", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("zwj_without_virama") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("a\xe2\x80\x8d", &output);
+    REQUIRE_FALSE(instance);
+  }
+
+  SECTION("zwnj_between_dual_and_right_joining") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd8\xa8\xe2\x80\x8c\xd8\xa7", &output);
+    REQUIRE(instance);
+  }
+
+  SECTION("zwnj_between_right_and_dual_joining") {
+    auto output = std::string{};
+    auto instance = skyr::domain_to_ascii("\xd8\xa7\xe2\x80\x8c\xd8\xa8", &output);
+    REQUIRE_FALSE(instance);
+  }
+}
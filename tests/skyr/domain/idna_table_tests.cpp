@@ -17,8 +17,13 @@ struct parameter {
 TEST_CASE("IDNA character values", "[idna]") {
   auto code_point = GENERATE(parameter{0x0000, skyr::idna::idna_status::disallowed_std3_valid},
                              parameter{0x002d, skyr::idna::idna_status::valid},
+                             parameter{0x00ad, skyr::idna::idna_status::ignored},
+                             parameter{0x00df, skyr::idna::idna_status::deviation},
+                             parameter{0x0100, skyr::idna::idna_status::mapped},
+                             parameter{0x4e00, skyr::idna::idna_status::valid},
                              parameter{0x10fffd, skyr::idna::idna_status::disallowed},
-                             parameter{0x10ffff, skyr::idna::idna_status::disallowed});
+                             parameter{0x10ffff, skyr::idna::idna_status::disallowed},
+                             parameter{0x110000, skyr::idna::idna_status::disallowed});
 
   SECTION("code_point_set") {
     const auto [value, status] = code_point;
@@ -26,3 +31,53 @@ TEST_CASE("IDNA character values", "[idna]") {
     REQUIRE(status == skyr::idna::code_point_status(value));
   }
 }
+
+TEST_CASE("IDNA mappings", "[idna]") {
+  SECTION("single_code_point") {
+    CHECK(U"a" == skyr::idna::code_point_mapping(U'A'));
+    CHECK(U"\x10428" == skyr::idna::code_point_mapping(U'\x10400'));
+  }
+
+  SECTION("code_point_range") {
+    CHECK(U"h" == skyr::idna::code_point_mapping(U'\x210b'));
+    CHECK(U"h" == skyr::idna::code_point_mapping(U'\x210e'));
+  }
+
+  SECTION("multiple_code_points") {
+    CHECK(U"fi" == skyr::idna::code_point_mapping(U'\xfb01'));
+    CHECK(U"mhz" == skyr::idna::code_point_mapping(U'\x3392'));
+    CHECK(18 == skyr::idna::code_point_mapping(U'\xfdfa').size());
+  }
+
+  SECTION("deviation") {
+    CHECK(U"ss" == skyr::idna::code_point_mapping(U'\x00df'));
+    CHECK(skyr::idna::code_point_mapping(U'\x200d').empty());
+  }
+
+  SECTION("valid") {
+    CHECK(skyr::idna::code_point_mapping(U'a').empty());
+  }
+}
+
+TEST_CASE("IDNA context properties", "[idna]") {
+  SECTION("bidi_class") {
+    CHECK(skyr::idna::bidi_class::l == skyr::idna::code_point_bidi_class(U'a'));
+    CHECK(skyr::idna::bidi_class::en == skyr::idna::code_point_bidi_class(U'0'));
+    CHECK(skyr::idna::bidi_class::r == skyr::idna::code_point_bidi_class(U'\x05d0'));
+    CHECK(skyr::idna::bidi_class::al == skyr::idna::code_point_bidi_class(U'\x0627'));
+    CHECK(skyr::idna::bidi_class::an == skyr::idna::code_point_bidi_class(U'\x0661'));
+    CHECK(skyr::idna::bidi_class::nsm == skyr::idna::code_point_bidi_class(U'\x0300'));
+  }
+
+  SECTION("joining_type") {
+    CHECK(skyr::idna::joining_type::u == skyr::idna::code_point_joining_type(U'a'));
+    CHECK(skyr::idna::joining_type::d == skyr::idna::code_point_joining_type(U'\x0628'));
+    CHECK(skyr::idna::joining_type::r == skyr::idna::code_point_joining_type(U'\x0627'));
+    CHECK(skyr::idna::joining_type::t == skyr::idna::code_point_joining_type(U'\x0300'));
+  }
+
+  SECTION("virama") {
+    CHECK(skyr::idna::is_virama(U'\x094d'));
+    CHECK_FALSE(skyr::idna::is_virama(U'\x0915'));
+  }
+}
@@ -4,6 +4,10 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <exception>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <catch2/catch_all.hpp>
 
@@ -46,6 +50,146 @@ TEST_CASE("filesystem path", "[filesystem_path]") {
     CHECK(url.value().href() == "file:///C:/path/to/file.txt");
   }
 
-  // TODO: add test with percent encoding
-  // TODO: add test with unicode
+  SECTION("percent encoded path") {
+    auto instance = skyr::url{"file:///path/to/a%20file.txt"};
+    auto path = skyr::filesystem::to_path(instance);
+    REQUIRE(path);
+    CHECK(path.value().generic_string() == "/path/to/a file.txt");
+  }
+
+  SECTION("unicode path") {
+    auto instance = skyr::url{"file:///path/to/%E2%82%AC.txt"};
+    auto path = skyr::filesystem::to_path(instance);
+    REQUIRE(path);
+    CHECK(path.value().generic_u8string() == u8"/path/to/\u20ac.txt");
+  }
+
+  SECTION("path that isn't UTF-8") {
+    auto instance = skyr::url{"file:///path/to/%FF.txt"};
+    auto path = skyr::filesystem::to_path(instance);
+    REQUIRE(path);
+    CHECK(path.value().generic_string() == "/path/to/\xff.txt");
+  }
+
+  SECTION("from_path is the same as parsing") {
+    auto input = GENERATE(as<std::string>{}, "/", "/path/to/", "/a b/c;d", "/\xe2\x82\xac.txt",
+                          "/path/./to/../file.txt", "/path/to/..", "/path/to/.", "/..");
+    auto url = skyr::filesystem::from_path(std::filesystem::path(input));
+    REQUIRE(url);
+    CHECK(url.value().href() == skyr::url("file://" + input).href());
+    CHECK(url.value().record().host.value().is_empty());
+  }
+
+  SECTION("from_path encodes percent signs") {
+    auto path = std::filesystem::path("/path/to/100%25.txt");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///path/to/100%2525.txt");
+    CHECK(skyr::filesystem::to_path(url.value()).value() == path);
+  }
+
+  SECTION("from_path encodes query and fragment delimiters") {
+    auto path = std::filesystem::path("/path/to/a?b#c.txt");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///path/to/a%3Fb%23c.txt");
+    CHECK(skyr::filesystem::to_path(url.value()).value() == path);
+  }
+
+  SECTION("from_path keeps control characters and trailing spaces") {
+    auto path = std::filesystem::path("/path/to/a\tb ");
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///path/to/a%09b%20");
+    CHECK(skyr::filesystem::to_path(url.value()).value() == path);
+  }
+
+  SECTION("from_path with a drive letter") {
+    auto url = skyr::filesystem::from_path(std::filesystem::path("/C|/path"));
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///C:/path");
+  }
+
+  SECTION("from_path encodes paths with a drive letter") {
+    auto input = GENERATE(as<std::string>{}, "C:/dir/a%20b#1", R"(C:\dir\a%20b#1)", "/C:/dir/a%20b#1");
+    auto path = std::filesystem::path(input);
+    auto url = skyr::filesystem::from_path(path);
+    REQUIRE(url);
+    CHECK(url.value().href() == "file:///C:/dir/a%2520b%231");
+
+    auto round_trip = skyr::filesystem::to_path(url.value());
+    REQUIRE(round_trip);
+    CHECK(round_trip.value().generic_string().ends_with("C:/dir/a%20b#1"));
+    CHECK(skyr::filesystem::from_path(round_trip.value()).value().href() == url.value().href());
+  }
+
+  SECTION("from_path with a drive letter is the same as parsing") {
+    auto input = GENERATE(as<std::string>{}, "C:/", "C:/path/to/", "C|/a b/c;d", "C:/path/./to/../file.txt",
+                          "C:/..", "C:/../..", "/C:/path", "C:");
+    auto url = skyr::filesystem::from_path(std::filesystem::path(input));
+    REQUIRE(url);
+    CHECK(url.value().href() == skyr::url("file:///" + input).href());
+  }
+
+  /// POSIX generic paths don't keep a leading `//`, so UNC paths are tested
+  /// with the generic path that Windows gives
+  SECTION("UNC path") {
+    auto record = skyr::filesystem::details::make_file_url_record(R"(\\server\share\a%20b#1)");
+    REQUIRE(record.has_value());
+    REQUIRE(record.value().has_value());
+    auto url = skyr::url(std::move(record.value().value()));
+    CHECK(url.href() == "file://server/share/a%2520b%231");
+    CHECK(skyr::filesystem::to_path(url).value() == std::filesystem::path("//server/share/a%20b#1"));
+  }
+
+  SECTION("UNC path to localhost") {
+    auto record = skyr::filesystem::details::make_file_url_record("//localhost/share");
+    REQUIRE(record.has_value());
+    REQUIRE(record.value().has_value());
+    CHECK(skyr::url(std::move(record.value().value())).href() == "file:///share");
+  }
+
+  SECTION("UNC path with an invalid server") {
+    auto record = skyr::filesystem::details::make_file_url_record("//a%zz/share");
+    REQUIRE(record.has_value());
+    CHECK(!record.value().has_value());
+  }
+
+  SECTION("from_path that isn't UTF-8") {
+    auto url = skyr::filesystem::from_path(std::filesystem::path("/path/to/\xff.txt"));
+    REQUIRE(!url);
+    CHECK(url.error() == skyr::url_parse_errc::invalid_unicode_character);
+  }
+
+  SECTION("from_paths") {
+    auto root = std::filesystem::temp_directory_path() / "skyr_from_paths_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "a" / "b c");
+    for (auto name : {"a/1.txt", "a/b c/2.txt", "3 %.txt"}) {
+      std::ofstream(root / name).put('x');
+    }
+
+    auto walk = std::vector<std::filesystem::path>{};
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+      walk.push_back(entry.path());
+    }
+
+    auto thread_count = GENERATE(0U, 1U, 2U, 16U);
+    auto urls = skyr::filesystem::from_paths(std::filesystem::recursive_directory_iterator(root), thread_count);
+    REQUIRE(urls.size() == walk.size());
+    for (auto i = 0UL; i < urls.size(); ++i) {
+      REQUIRE(urls[i]);
+      CHECK(urls[i].value().href() == skyr::filesystem::from_path(walk[i]).value().href());
+      CHECK(skyr::filesystem::to_path(urls[i].value()).value() == walk[i]);
+    }
+
+    std::filesystem::remove_all(root);
+  }
+
+  SECTION("from_paths with a range of paths") {
+    auto paths = std::vector<std::filesystem::path>{"/a", "/b", "/c"};
+    auto urls = skyr::filesystem::from_paths(paths, 2);
+    REQUIRE(urls.size() == 3);
+    CHECK(urls[2].value().href() == "file:///c");
+  }
 }
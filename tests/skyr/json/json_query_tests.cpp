@@ -4,6 +4,9 @@
 // http://www.boost.org/LICENSE_1_0.txt)
 
 #include <exception>
+#include <format>
+#include <iterator>
+#include <string>
 #include <vector>
 
 #include <catch2/catch_all.hpp>
@@ -37,6 +40,76 @@ TEST_CASE("json_tests", "[json.query]") {
     auto query = ""s;
     auto json = skyr::json::decode_query(query);
     CHECK(json.empty());
+    CHECK(json.is_null());
+  }
+
+  SECTION("decode_query_with_many_repeated_names") {
+    auto query = "?"s;
+    for (auto i = 0; i < 1000; ++i) {
+      query += std::format("a={}&b={}&", i, i * 2);
+    }
+    query += "c=d";
+    auto json = skyr::json::decode_query(query);
+    REQUIRE(json["a"].is_array());
+    REQUIRE(json["a"].size() == 1000);
+    CHECK(json["a"][0] == "0");
+    CHECK(json["a"][999] == "999");
+    CHECK(json["b"][500] == "1000");
+    CHECK(json["c"] == "d");
+  }
+
+  SECTION("decode_query_with_invalid_percent_encoding") {
+    auto query = "?a=%zz&%=b"s;
+    auto json = skyr::json::decode_query(query);
+    CHECK(json["a"] == "%zz");
+    CHECK(json["%"] == "b");
+  }
+
+  SECTION("decode_query_sax_builds_the_same_json") {
+    auto query = "?z=1&a=b&c=d&a=e&%CF%80=%CF%80&a&c=f"s;
+    auto json = nlohmann::json{};
+    auto parser = nlohmann::detail::json_sax_dom_parser<nlohmann::json>(json);
+    CHECK(skyr::json::decode_query_sax(query, &parser));
+    CHECK(json == skyr::json::decode_query(query));
+    CHECK(json["a"].get<std::vector<std::string>>() == std::vector<std::string>{"b", "e", ""});
+
+    auto empty = nlohmann::json::object();
+    auto empty_parser = nlohmann::detail::json_sax_dom_parser<nlohmann::json>(empty);
+    CHECK(skyr::json::decode_query_sax("", &empty_parser));
+    CHECK(empty.is_null());
+  }
+
+  SECTION("decode_query_sax_stops_early") {
+    struct handler {
+      auto null() -> bool {
+        return true;
+      }
+      auto start_object(std::size_t) -> bool {
+        return true;
+      }
+      auto key(std::string& key) -> bool {
+        keys.push_back(key);
+        return key != "b";
+      }
+      auto string(std::string&) -> bool {
+        return true;
+      }
+      auto start_array(std::size_t) -> bool {
+        return true;
+      }
+      auto end_array() -> bool {
+        return true;
+      }
+      auto end_object() -> bool {
+        return true;
+      }
+
+      std::vector<std::string> keys;
+    };
+
+    auto sax = handler{};
+    CHECK(!skyr::json::decode_query_sax("a=1&b=2&c=3", &sax));
+    CHECK(sax.keys == std::vector<std::string>{"a", "b"});
   }
 
   SECTION("encode_simple_query") {
@@ -60,6 +133,49 @@ TEST_CASE("json_tests", "[json.query]") {
     CHECK(query.value() == "a=%CF%80");
   }
 
+  SECTION("encode_query_with_nested_objects") {
+    auto json = nlohmann::json{{"filter", {{"status", "open"}, {"owner", {{"name", "a b"}}}}}, {"page", 2}};
+    auto query = skyr::json::encode_query(json);
+    REQUIRE(query);
+    CHECK(query.value() == "filter[owner][name]=a%20b&filter[status]=open&page=2");
+  }
+
+  SECTION("encode_query_with_nested_arrays") {
+    auto json = nlohmann::json{{"ids", {1, 2, 3}}, {"sort", {{{"field", "x"}}, {{"field", "y"}}}}};
+    auto query = skyr::json::encode_query(json);
+    REQUIRE(query);
+    CHECK(query.value() == "ids=1&ids=2&ids=3&sort[0][field]=x&sort[1][field]=y");
+  }
+
+  SECTION("encode_query_with_scalars") {
+    auto json = nlohmann::json{{"a", true}, {"b", nullptr}, {"c", -4}, {"d", 2.5}, {"e", nlohmann::json::array()}};
+    auto query = skyr::json::encode_query(json);
+    REQUIRE(query);
+    CHECK(query.value() == "a=true&b=&c=-4&d=2.5");
+  }
+
+  SECTION("encode_query_with_encoded_keys") {
+    auto json = nlohmann::json{{"a b", {{"[c]", "&"}}}};
+    auto query = skyr::json::encode_query(json, ';', ':');
+    REQUIRE(query);
+    CHECK(query.value() == "a%20b[%5Bc%5D]:%26");
+  }
+
+  SECTION("encode_query_to_an_output_iterator") {
+    auto json = nlohmann::json{{"a", {"b", "e"}}, {"c", {{"d", "f"}}}};
+    auto query = std::string("?");
+    auto out = skyr::json::encode_query(json, std::back_inserter(query));
+    REQUIRE(out);
+    CHECK(query == "?a=b&a=e&c[d]=f");
+    CHECK(skyr::json::encode_query(json).value() == query.substr(1));
+  }
+
+  SECTION("encode_empty_object") {
+    auto query = skyr::json::encode_query(nlohmann::json::object());
+    REQUIRE(query);
+    CHECK(query.value().empty());
+  }
+
   SECTION("invalid_query_json") {
     auto json = nlohmann::json{
         {"I", "am", "not", "a", "valid", "query", "string"},
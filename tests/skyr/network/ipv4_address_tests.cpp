@@ -27,6 +27,17 @@ TEST_CASE("ipv4 addresses", "[ipv4]") {
     CHECK("129.79.245.252" == instance.serialize());
   }
 
+  SECTION("serialize_to_test") {
+    auto buffer = std::array<char, skyr::ipv4_address::max_serialized_size>{};
+    auto instance = skyr::ipv4_address(0xffffffff);
+    auto last = instance.serialize_to(buffer.data());
+    CHECK("255.255.255.255" == std::string_view(buffer.data(), last));
+
+    instance = skyr::ipv4_address(0x0a00640b);
+    last = instance.serialize_to(buffer.data());
+    CHECK("10.0.100.11" == std::string_view(buffer.data(), last));
+  }
+
   SECTION("parse_zero_test") {
     const auto address = "0.0.0.0"s;
     bool validation_error = false;
@@ -94,3 +105,49 @@ TEST_CASE("ipv4 addresses", "[ipv4]") {
     CHECK(bytes == instance.value().to_bytes());
   }
 }
+
+TEST_CASE("ipv4 dotted decimal addresses", "[ipv4]") {
+  using namespace std::string_view_literals;
+  using param = std::pair<std::string_view, std::optional<std::uint32_t>>;
+
+  SECTION("parse_dotted_decimal") {
+    const auto& [input, expected] =
+        GENERATE(param{"0.0.0.0"sv, 0x00000000}, param{"127.0.0.1"sv, 0x7f000001},
+                 param{"255.255.255.255"sv, 0xffffffff}, param{"192.168.100.10"sv, 0xc0a8640a},
+                 param{"1.22.133.4"sv, 0x01168504}, param{"256.0.0.1"sv, std::nullopt},
+                 param{"1.2.3.999"sv, std::nullopt}, param{"01.2.3.4"sv, std::nullopt},
+                 param{"1.2.3.00"sv, std::nullopt}, param{"1.2.3.4."sv, std::nullopt},
+                 param{".1.2.3.4"sv, std::nullopt}, param{"1..2.3"sv, std::nullopt},
+                 param{"1.2.3"sv, std::nullopt}, param{"1.2.3.4.5"sv, std::nullopt},
+                 param{"1.2.3.a"sv, std::nullopt}, param{"0x1.2.3.4"sv, std::nullopt},
+                 param{"1.2.3.4\xff"sv, std::nullopt}, param{"1000.2.3.4"sv, std::nullopt},
+                 param{"255.255.255.2555"sv, std::nullopt});
+
+    INFO(input);
+    CHECK(skyr::details::parse_dotted_decimal(input) == expected);
+  }
+
+  SECTION("fallback_to_octal") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv4_address("010.0.0.1"sv, &validation_error);
+    REQUIRE(instance);
+    CHECK(0x08000001 == instance.value().address());
+    CHECK(validation_error);
+  }
+
+  SECTION("fallback_to_trailing_dot") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv4_address("1.2.3.4."sv, &validation_error);
+    REQUIRE(instance);
+    CHECK(0x01020304 == instance.value().address());
+    CHECK(validation_error);
+  }
+
+  SECTION("fallback_to_overflow") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv4_address("256.0.0.1"sv, &validation_error);
+    REQUIRE_FALSE(instance);
+    CHECK(instance.error() == skyr::ipv4_address_errc::overflow);
+    CHECK(validation_error);
+  }
+}
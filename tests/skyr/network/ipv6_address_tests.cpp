@@ -192,3 +192,51 @@ TEST_CASE("ipv6_address_tests", "[ipv6]") {
     CHECK(bytes == instance.to_bytes());
   }
 }
+
+TEST_CASE("ipv6 address serialize_to", "[ipv6]") {
+  using namespace std::string_view_literals;
+
+  auto [pieces, expected] = GENERATE(table<std::array<unsigned short, 8>, std::string_view>({
+      {{{0, 0, 0, 0, 0, 0, 0, 0}}, "::"sv},
+      {{{1, 0, 0, 0, 0, 0, 0, 0}}, "1::"sv},
+      {{{0, 0, 0, 0, 0, 0, 0, 1}}, "::1"sv},
+      {{{1, 0, 2, 0, 0, 3, 0, 4}}, "1:0:2::3:0:4"sv},
+      {{{1, 0, 0, 2, 0, 0, 3, 4}}, "1::2:0:0:3:4"sv},
+      {{{1, 0, 2, 3, 4, 5, 6, 7}}, "1:0:2:3:4:5:6:7"sv},
+      {{{0x10, 0x100, 0x1000, 0xabcd, 0, 0, 0, 0}}, "10:100:1000:abcd::"sv},
+      {{{0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff}},
+       "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"sv},
+  }));
+
+  auto instance = skyr::ipv6_address(pieces);
+  auto buffer = std::array<char, skyr::ipv6_address::max_serialized_size>{};
+  auto last = instance.serialize_to(buffer.data());
+  CHECK(std::string_view(buffer.data(), last) == expected);
+  CHECK(instance.serialize() == expected);
+}
+
+TEST_CASE("ipv6 address hex digits", "[ipv6]") {
+  using namespace std::string_view_literals;
+
+  SECTION("upper and lower case digits") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv6_address("aBcD:EF01:2345:6789:abcd:ef01:2345:6789"sv, &validation_error);
+    REQUIRE(instance);
+    CHECK(instance.value().serialize() == "abcd:ef01:2345:6789:abcd:ef01:2345:6789");
+    CHECK(!validation_error);
+  }
+
+  SECTION("invalid digit") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv6_address("1:2:3:4:5:6:7:g"sv, &validation_error);
+    CHECK(!instance);
+    CHECK(validation_error);
+  }
+
+  SECTION("too many digits") {
+    bool validation_error = false;
+    auto instance = skyr::parse_ipv6_address("12345::"sv, &validation_error);
+    CHECK(!instance);
+    CHECK(validation_error);
+  }
+}
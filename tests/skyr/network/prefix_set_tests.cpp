@@ -0,0 +1,174 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/network/prefix_set.hpp>
+
+namespace {
+auto ipv4(std::string_view input) -> skyr::ipv4_address {
+  bool validation_error = false;
+  return skyr::parse_ipv4_address(input, &validation_error).value();
+}
+
+auto ipv6(std::string_view input) -> skyr::ipv6_address {
+  bool validation_error = false;
+  return skyr::parse_ipv6_address(input, &validation_error).value();
+}
+}  // namespace
+
+TEST_CASE("prefix set ipv4", "[prefix_set]") {
+  auto set = skyr::network::prefix_set::parse({"10.0.0.0/8", "192.168.0.0/16", "172.16.0.0/12", "127.0.0.1"});
+  REQUIRE(set);
+
+  auto [address, expected] = GENERATE(table<std::string_view, bool>({
+      {"10.0.0.0", true},
+      {"10.255.255.255", true},
+      {"11.0.0.0", false},
+      {"9.255.255.255", false},
+      {"172.16.0.1", true},
+      {"172.31.255.255", true},
+      {"172.32.0.0", false},
+      {"192.168.1.1", true},
+      {"192.169.0.0", false},
+      {"127.0.0.1", true},
+      {"127.0.0.2", false},
+      {"0.0.0.0", false},
+      {"255.255.255.255", false},
+  }));
+
+  CHECK(set.value().contains(ipv4(address)) == expected);
+}
+
+TEST_CASE("prefix set ipv6", "[prefix_set]") {
+  auto set = skyr::network::prefix_set::parse({"fc00::/7", "fe80::/10", "::1", "2001:db8:0:0:8000::/65"});
+  REQUIRE(set);
+
+  auto [address, expected] = GENERATE(table<std::string_view, bool>({
+      {"fc00::", true},
+      {"fdff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", true},
+      {"fe00::", false},
+      {"fe80::1", true},
+      {"febf:ffff::", true},
+      {"fec0::", false},
+      {"::1", true},
+      {"::2", false},
+      {"::", false},
+      {"2001:db8::8000:0:0:0", true},
+      {"2001:db8::ffff:ffff:ffff:ffff", true},
+      {"2001:db8::7fff:ffff:ffff:ffff", false},
+  }));
+
+  CHECK(set.value().contains(ipv6(address)) == expected);
+}
+
+TEST_CASE("prefix set families", "[prefix_set]") {
+  SECTION("ipv4 prefixes only match ipv4-mapped ipv6 addresses") {
+    auto set = skyr::network::prefix_set::parse({"0.0.0.0/0"});
+    REQUIRE(set);
+    CHECK(set.value().contains(ipv4("1.2.3.4")));
+    CHECK(set.value().contains(ipv6("::ffff:1.2.3.4")));
+    CHECK(!set.value().contains(ipv6("::1.2.3.4")));
+    CHECK(!set.value().contains(ipv6("64:ff9b::1.2.3.4")));
+    CHECK(!set.value().contains(ipv6("1::ffff:1.2.3.4")));
+  }
+
+  SECTION("ipv4-mapped addresses don't bypass a blocklist") {
+    auto set = skyr::network::prefix_set::parse({"127.0.0.0/8", "10.0.0.0/8"});
+    REQUIRE(set);
+    CHECK(set.value().contains(ipv6("::ffff:127.0.0.1")));
+    CHECK(set.value().contains(ipv6("::ffff:7f00:1")));
+    CHECK(set.value().contains(ipv6("::ffff:10.1.2.3")));
+    CHECK(!set.value().contains(ipv6("::ffff:11.0.0.0")));
+  }
+
+  SECTION("ipv6 prefixes don't match ipv4 addresses") {
+    auto set = skyr::network::prefix_set::parse({"::/0"});
+    REQUIRE(set);
+    CHECK(set.value().contains(ipv6("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff")));
+    CHECK(!set.value().contains(ipv4("1.2.3.4")));
+  }
+
+  SECTION("empty set") {
+    auto set = skyr::network::prefix_set();
+    CHECK(set.empty());
+    CHECK(!set.contains(ipv4("1.2.3.4")));
+    CHECK(!set.contains(ipv6("::1")));
+  }
+}
+
+TEST_CASE("prefix set merges prefixes", "[prefix_set]") {
+  SECTION("overlapping and adjacent prefixes") {
+    auto cidrs =
+        std::vector<std::string>{"10.1.0.0/16", "10.0.0.0/8", "11.0.0.0/8", "255.255.255.255/32", "255.0.0.0/8"};
+    auto set = skyr::network::prefix_set::parse(cidrs);
+    REQUIRE(set);
+    CHECK(set.value().contains(ipv4("10.1.2.3")));
+    CHECK(set.value().contains(ipv4("11.255.0.0")));
+    CHECK(!set.value().contains(ipv4("12.0.0.0")));
+    CHECK(set.value().contains(ipv4("255.255.255.255")));
+    CHECK(!set.value().contains(ipv4("254.255.255.255")));
+  }
+
+  SECTION("host bits are ignored") {
+    auto set = skyr::network::prefix_set::parse({"10.1.2.3/8", "2001:db8::1/32"});
+    REQUIRE(set);
+    CHECK(set.value().contains(ipv4("10.200.0.0")));
+    CHECK(set.value().contains(ipv6("2001:db8:ffff::")));
+  }
+}
+
+TEST_CASE("prefix set errors", "[prefix_set]") {
+  auto [cidr, error] = GENERATE(table<std::string_view, skyr::network::prefix_set_errc>({
+      {"", skyr::network::prefix_set_errc::invalid_address},
+      {"/8", skyr::network::prefix_set_errc::invalid_address},
+      {"example.com/8", skyr::network::prefix_set_errc::invalid_address},
+      {"1:2/8", skyr::network::prefix_set_errc::invalid_address},
+      {"0x7f.1/8", skyr::network::prefix_set_errc::invalid_address},
+      {"127.1", skyr::network::prefix_set_errc::invalid_address},
+      {"010.0.0.0/8", skyr::network::prefix_set_errc::invalid_address},
+      {"10.0.0.0./8", skyr::network::prefix_set_errc::invalid_address},
+      {"256.0.0.0/8", skyr::network::prefix_set_errc::invalid_address},
+      {"10.0.0.0/", skyr::network::prefix_set_errc::invalid_prefix_length},
+      {"10.0.0.0/33", skyr::network::prefix_set_errc::invalid_prefix_length},
+      {"10.0.0.0/8x", skyr::network::prefix_set_errc::invalid_prefix_length},
+      {"10.0.0.0/-1", skyr::network::prefix_set_errc::invalid_prefix_length},
+      {"::/129", skyr::network::prefix_set_errc::invalid_prefix_length},
+  }));
+
+  auto set = skyr::network::prefix_set::parse({cidr});
+  REQUIRE(!set);
+  CHECK(set.error() == error);
+}
+
+TEST_CASE("prefix set is shareable between threads", "[prefix_set]") {
+  auto cidrs = std::vector<std::string>{};
+  for (auto i = 0; i < 256; ++i) {
+    cidrs.push_back("10." + std::to_string(i) + ".0.0/24");
+  }
+  const auto set = skyr::network::prefix_set::parse(cidrs).value();
+
+  auto matches = std::vector<int>(4, 0);
+  auto threads = std::vector<std::thread>{};
+  for (auto t = 0; t < 4; ++t) {
+    threads.emplace_back([&set, &matches, t] {
+      for (auto i = 0; i < 256; ++i) {
+        bool validation_error = false;
+        auto address = skyr::parse_ipv4_address("10." + std::to_string(i) + ".0.1", &validation_error).value();
+        matches[t] += set.contains(address) ? 1 : 0;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  CHECK(matches == std::vector<int>(4, 256));
+}
@@ -0,0 +1,115 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/percent_encoding/encode_set.hpp>
+#include <skyr/percent_encoding/percent_encode.hpp>
+
+namespace {
+using skyr::percent_encoding::byte_set;
+namespace encode_sets = skyr::percent_encoding::encode_sets;
+
+constexpr auto unreserved =
+    byte_set::range('a', 'z') | byte_set::range('A', 'Z') | byte_set::range('0', '9') | byte_set::of("-._~");
+
+static_assert(unreserved.contains('a') && unreserved.contains('~') && !unreserved.contains('/'));
+static_assert((~unreserved) == encode_sets::rfc3986);
+static_assert((encode_sets::path & encode_sets::c0_control) == encode_sets::c0_control);
+static_assert(byte_set::range(0x00, 0xff) == encode_sets::any);
+static_assert(byte_set::of("") == byte_set{});
+
+/// Tests each byte that isn't in the C0 control set
+auto printable_members(const byte_set& set) -> std::string {
+  auto members = std::string{};
+  for (auto byte = 0x20; byte < 0x7f; ++byte) {
+    if (set.contains(static_cast<unsigned char>(byte))) {
+      members.push_back(static_cast<char>(byte));
+    }
+  }
+  return members;
+}
+}  // namespace
+
+TEST_CASE("encode set members", "[encode_set]") {
+  SECTION("c0 control") {
+    for (auto byte = 0; byte < 0x100; ++byte) {
+      CHECK(encode_sets::c0_control.contains(static_cast<unsigned char>(byte)) == ((byte < 0x20) || (byte > 0x7e)));
+    }
+  }
+
+  SECTION("printable members") {
+    CHECK(printable_members(encode_sets::fragment) == " \"<>`");
+    CHECK(printable_members(encode_sets::query) == " \"#<>");
+    CHECK(printable_members(encode_sets::special_query) == " \"#'<>");
+    CHECK(printable_members(encode_sets::path) == " \"#<>?^`{}");
+    CHECK(printable_members(encode_sets::userinfo) == " \"#/:;<=>?@[\\]^`{|}");
+    CHECK(printable_members(encode_sets::component) == " \"#$%&+,/:;<=>?@[\\]^`{|}");
+    CHECK(printable_members(encode_sets::application_x_www_form_urlencoded) ==
+          " !\"#$%&'()+,/:;<=>?@[\\]^`{|}~");
+  }
+
+  SECTION("enum values") {
+    using skyr::percent_encoding::encode_set;
+    using skyr::percent_encoding::to_byte_set;
+    CHECK(to_byte_set(encode_set::any) == encode_sets::any);
+    CHECK(to_byte_set(encode_set::c0_control) == encode_sets::c0_control);
+    CHECK(to_byte_set(encode_set::fragment) == encode_sets::fragment);
+    CHECK(to_byte_set(encode_set::query) == encode_sets::query);
+    CHECK(to_byte_set(encode_set::special_query) == encode_sets::special_query);
+    CHECK(to_byte_set(encode_set::path) == encode_sets::path);
+    CHECK(to_byte_set(encode_set::userinfo) == encode_sets::userinfo);
+    CHECK(to_byte_set(encode_set::component) == encode_sets::component);
+  }
+}
+
+TEST_CASE("encode with a set", "[encode_set]") {
+  SECTION("custom set") {
+    CHECK(skyr::percent_encode_bytes<encode_sets::rfc3986>("a b/c~d!") == "a%20b%2Fc~d%21");
+    CHECK(skyr::percent_encode_bytes<byte_set::of("/")>("/a/b/") == "%2Fa%2Fb%2F");
+    CHECK(skyr::percent_encode_bytes<byte_set{}>("\x01 /") == "\x01 /");
+  }
+
+  SECTION("non-ASCII bytes") {
+    CHECK(skyr::percent_encode_bytes<encode_sets::path>("/\xe2\x82\xac") == "/%E2%82%AC");
+  }
+
+  SECTION("to an output iterator") {
+    auto input = std::string_view("a b/c?\xe4\xbe\x8b%");
+    auto output = std::string{};
+    skyr::percent_encoding::percent_encode_copy<encode_sets::component>(input, std::back_inserter(output));
+    CHECK(output == "a%20b%2Fc%3F%E4%BE%8B%25");
+    CHECK(output == skyr::percent_encode_bytes<encode_sets::component>(input));
+    CHECK(skyr::percent_encoding::percent_encoded_size<encode_sets::component>(input) == output.size());
+    CHECK(skyr::percent_encoding::percent_encoded_size<encode_sets::component>("abc") == 3);
+  }
+
+  SECTION("matches percent_encode_byte") {
+    auto input = std::string{};
+    for (auto byte = 0; byte < 0x100; ++byte) {
+      input.push_back(static_cast<char>(byte));
+    }
+
+    using skyr::percent_encoding::encode_set;
+    auto encodes = GENERATE(encode_set::any, encode_set::c0_control, encode_set::fragment, encode_set::query,
+                            encode_set::special_query, encode_set::path, encode_set::userinfo, encode_set::component);
+
+    auto encode_bytes = [encodes](std::string_view bytes) {
+      auto encoded = std::string{};
+      for (auto byte : bytes) {
+        encoded += skyr::percent_encoding::percent_encode_byte(std::byte(byte), encodes).to_string();
+      }
+      return encoded;
+    };
+
+    auto offset = GENERATE(0UL, 0x20UL, 0x61UL);
+    auto bytes = std::string_view(input).substr(offset);
+    CHECK(skyr::percent_encode_bytes(bytes, encodes) == encode_bytes(bytes));
+  }
+}
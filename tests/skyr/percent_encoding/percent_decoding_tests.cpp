@@ -11,6 +11,7 @@
 #include <format>
 
 #include <skyr/percent_encoding/percent_decode.hpp>
+#include <skyr/percent_encoding/percent_decode_range.hpp>
 
 TEST_CASE("percent_decode", "[percent_decode]") {
   using namespace std::string_literals;
@@ -34,3 +35,91 @@ TEST_CASE("percent_decode", "[percent_decode]") {
     CHECK(decoded);
   }
 }
+
+TEST_CASE("percent_decode errors", "[percent_decode]") {
+  using skyr::percent_encoding::percent_encode_errc;
+
+  auto [input, error] = GENERATE(table<std::string_view, percent_encode_errc>({
+      {"%", percent_encode_errc::overflow},
+      {"abc%4", percent_encode_errc::overflow},
+      {"abcdefghijklmnop%", percent_encode_errc::overflow},
+      {"%zz", percent_encode_errc::non_hex_input},
+      {"%4g", percent_encode_errc::non_hex_input},
+      {"abcdefghijklmnop%g4", percent_encode_errc::non_hex_input},
+  }));
+
+  auto decoded = skyr::percent_decode(input);
+  REQUIRE(!decoded);
+  CHECK(decoded.error() == error);
+}
+
+TEST_CASE("percent_decode runs", "[percent_decode]") {
+  using namespace std::string_literals;
+
+  auto [input, expected] = GENERATE(table<std::string, std::string>({
+      {"no percent signs at all in this input", "no percent signs at all in this input"},
+      {"%41%42%43", "ABC"},
+      {"a%41b%42c%43d", "aAbBcCd"},
+      {"0123456%41", "0123456A"},
+      {"01234567%41", "01234567A"},
+      {"012345678%41", "012345678A"},
+      {"0123456789abcdef%41%4a%4A0123456789abcdef", "0123456789abcdefAJJ0123456789abcdef"},
+      {"%e2%82%ac and %E2%82%AC", "\xe2\x82\xac and \xe2\x82\xac"},
+  }));
+
+  SECTION("copy") {
+    auto decoded = skyr::percent_decode(input);
+    REQUIRE(decoded);
+    CHECK(decoded.value() == expected);
+  }
+
+  SECTION("in place") {
+    auto buffer = input;
+    auto size = skyr::percent_decode_in_place(buffer);
+    REQUIRE(size);
+    buffer.resize(size.value());
+    CHECK(buffer == expected);
+  }
+}
+
+TEST_CASE("percent_decode matches percent_decode_range", "[percent_decode]") {
+  auto input = std::string{};
+  for (auto i = 0; i < 256; ++i) {
+    input += (i % 3 == 0) ? std::format("%{:02x}", i) : std::string(static_cast<std::size_t>(i % 11), 'a' + i % 26);
+  }
+
+  auto expected = std::string{};
+  for (auto&& value : skyr::percent_encoding::percent_decode_range{input}) {
+    REQUIRE(value);
+    expected.push_back(value.value());
+  }
+
+  for (auto offset = 0UL; offset < 16; ++offset) {
+    auto decoded = skyr::percent_decode(std::string_view(input).substr(offset * 3));
+    auto reference = std::string{};
+    for (auto&& value : skyr::percent_encoding::percent_decode_range{std::string_view(input).substr(offset * 3)}) {
+      reference.push_back(value.value());
+    }
+    REQUIRE(decoded);
+    CHECK(decoded.value() == reference);
+  }
+  CHECK(skyr::percent_decode(input).value() == expected);
+}
+
+TEST_CASE("percent_decode utf8 validation", "[percent_decode]") {
+  SECTION("valid") {
+    auto input = GENERATE(as<std::string_view>{}, "", "ascii only", "%F0%9F%8F%B3%EF%B8%8F%E2%80%8D%F0%9F%8C%88",
+                          "\xe2\x82\xac literal", "%e2\x82%ac mixed", "%ED%9F%BF", "%F4%8F%BF%BF");
+    auto decoded = skyr::percent_decode(input, true);
+    CHECK(decoded);
+  }
+
+  SECTION("invalid") {
+    auto input = GENERATE(as<std::string_view>{}, "%FF", "%C0%80", "%E2%82", "%E2%82 truncated", "%ED%A0%80",
+                          "%F4%90%80%80", "%80", "0123456789\xff", "%E0%80%80");
+    auto decoded = skyr::percent_decode(input, true);
+    REQUIRE(!decoded);
+    CHECK(decoded.error() == skyr::percent_encoding::percent_encode_errc::invalid_utf8);
+    CHECK(skyr::percent_decode(input));
+  }
+}
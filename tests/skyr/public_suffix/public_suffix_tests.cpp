@@ -0,0 +1,191 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt of copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/public_suffix/public_suffix_list.hpp>
+
+using namespace std::string_view_literals;
+
+namespace {
+/// A subset of the list used by the test cases in
+/// https://github.com/publicsuffix/list/blob/master/tests/test_psl.txt
+constexpr auto list_text = R"(// ===BEGIN ICANN DOMAINS===
+com
+biz
+
+// ac : https://en.wikipedia.org/wiki/.ac
+ac
+com.ac
+
+uk
+co.uk
+
+// jp
+jp
+ac.jp
+kyoto.jp
+ide.kyoto.jp
+*.kobe.jp
+!city.kobe.jp
+*.kawasaki.jp
+!city.kawasaki.jp
+
+// ck
+*.ck
+!www.ck
+
+us
+ak.us
+k12.ak.us
+
+// cn
+cn
+com.cn
+公司.cn
+
+// xn--55qx5d.cn
+中国
+// ===END ICANN DOMAINS===
+)"sv;
+
+auto make_list() {
+  auto list = skyr::public_suffix::suffix_list::parse(list_text);
+  REQUIRE(list);
+  return list.value();
+}
+}  // namespace
+
+TEST_CASE("public suffix list", "[public_suffix]") {
+  using param = std::pair<std::string_view, std::optional<std::string_view>>;
+
+  SECTION("registrable domains") {
+    const auto& [host, expected] = GENERATE(
+        param{"COM"sv, std::nullopt}, param{"example.COM"sv, "example.COM"sv},
+        param{"WwW.example.COM"sv, "example.COM"sv}, param{"com"sv, std::nullopt},
+        param{"example.com"sv, "example.com"sv}, param{"a.b.example.com"sv, "example.com"sv},
+        param{"uk.com"sv, "uk.com"sv}, param{"b.example.uk.com"sv, "uk.com"sv},
+        param{"a.b.test.ac"sv, "test.ac"sv}, param{"mm"sv, std::nullopt}, param{"c.mm"sv, "c.mm"sv},
+        param{"b.c.mm"sv, "c.mm"sv}, param{"jp"sv, std::nullopt}, param{"test.jp"sv, "test.jp"sv},
+        param{"www.test.jp"sv, "test.jp"sv}, param{"ac.jp"sv, std::nullopt}, param{"test.ac.jp"sv, "test.ac.jp"sv},
+        param{"kyoto.jp"sv, std::nullopt}, param{"test.kyoto.jp"sv, "test.kyoto.jp"sv},
+        param{"ide.kyoto.jp"sv, std::nullopt}, param{"b.ide.kyoto.jp"sv, "b.ide.kyoto.jp"sv},
+        param{"a.b.ide.kyoto.jp"sv, "b.ide.kyoto.jp"sv}, param{"c.kobe.jp"sv, std::nullopt},
+        param{"b.c.kobe.jp"sv, "b.c.kobe.jp"sv}, param{"a.b.c.kobe.jp"sv, "b.c.kobe.jp"sv},
+        param{"city.kobe.jp"sv, "city.kobe.jp"sv}, param{"www.city.kobe.jp"sv, "city.kobe.jp"sv},
+        param{"ck"sv, std::nullopt}, param{"test.ck"sv, std::nullopt}, param{"b.test.ck"sv, "b.test.ck"sv},
+        param{"a.b.test.ck"sv, "b.test.ck"sv}, param{"www.ck"sv, "www.ck"sv}, param{"www.www.ck"sv, "www.ck"sv},
+        param{"us"sv, std::nullopt}, param{"test.us"sv, "test.us"sv}, param{"www.test.us"sv, "test.us"sv},
+        param{"ak.us"sv, std::nullopt}, param{"test.ak.us"sv, "test.ak.us"sv},
+        param{"www.test.ak.us"sv, "test.ak.us"sv}, param{"k12.ak.us"sv, std::nullopt},
+        param{"test.k12.ak.us"sv, "test.k12.ak.us"sv}, param{"www.test.k12.ak.us"sv, "test.k12.ak.us"sv},
+        param{"xn--85x722f.com.cn"sv, "xn--85x722f.com.cn"sv}, param{"xn--55qx5d.cn"sv, std::nullopt},
+        param{"xn--85x722f.xn--55qx5d.cn"sv, "xn--85x722f.xn--55qx5d.cn"sv},
+        param{"www.xn--85x722f.xn--55qx5d.cn"sv, "xn--85x722f.xn--55qx5d.cn"sv},
+        param{"shishi.xn--55qx5d.cn"sv, "shishi.xn--55qx5d.cn"sv}, param{"xn--fiqs8s"sv, std::nullopt},
+        param{"xn--85x722f.xn--fiqs8s"sv, "xn--85x722f.xn--fiqs8s"sv},
+        param{"www.xn--85x722f.xn--fiqs8s"sv, "xn--85x722f.xn--fiqs8s"sv});
+
+    auto list = make_list();
+    CHECK(list.registrable_domain(host) == expected);
+  }
+
+  SECTION("public suffixes") {
+    auto list = make_list();
+    CHECK(list.public_suffix("www.example.co.uk") == "co.uk");
+    CHECK(list.public_suffix("example.unknown") == "unknown");
+    CHECK(list.public_suffix("a.b.c.kobe.jp") == "c.kobe.jp");
+    CHECK(list.public_suffix("www.city.kobe.jp") == "kobe.jp");
+    CHECK(list.public_suffix("co.uk") == "co.uk");
+  }
+
+  SECTION("results are views of the host") {
+    auto list = make_list();
+    constexpr auto host = "www.example.co.uk"sv;
+    auto domain = list.registrable_domain(host);
+    REQUIRE(domain);
+    CHECK(domain.value().data() == host.data() + 4);
+  }
+
+  SECTION("trailing dot") {
+    auto list = make_list();
+    CHECK(list.public_suffix("www.example.co.uk.") == "co.uk");
+    CHECK(list.registrable_domain("www.example.co.uk.") == "example.co.uk");
+  }
+
+  SECTION("not domains") {
+    auto list = make_list();
+    CHECK_FALSE(list.public_suffix(""));
+    CHECK_FALSE(list.public_suffix("."));
+    CHECK_FALSE(list.public_suffix("a..com"));
+    CHECK_FALSE(list.public_suffix("[::1]"));
+    CHECK_FALSE(list.public_suffix("127.0.0.1"));
+  }
+
+  SECTION("empty list") {
+    auto list = skyr::public_suffix::suffix_list{};
+    CHECK(list.public_suffix("www.example.co.uk") == "uk");
+    CHECK(list.registrable_domain("www.example.co.uk") == "co.uk");
+  }
+
+  SECTION("invalid rules") {
+    const auto& rule = GENERATE("*"sv, "a.*.com"sv, "!*.com"sv, "a..com"sv);
+    auto list = skyr::public_suffix::suffix_list::parse(rule);
+    REQUIRE_FALSE(list);
+    CHECK(list.error() == skyr::public_suffix::public_suffix_errc::invalid_rule);
+  }
+}
+
+TEST_CASE("compiled public suffix list", "[public_suffix]") {
+  SECTION("from compiled") {
+    auto list = make_list();
+    auto compiled = std::vector<std::byte>(list.compiled().begin(), list.compiled().end());
+    auto copy = skyr::public_suffix::suffix_list::from_compiled(compiled);
+    REQUIRE(copy);
+    CHECK(copy.value().compiled().data() == compiled.data());
+    CHECK(copy.value().registrable_domain("a.b.c.kobe.jp") == "b.c.kobe.jp");
+  }
+
+  SECTION("map compiled") {
+    auto list = make_list();
+    auto path = std::filesystem::temp_directory_path() / "skyr_public_suffix_tests.bin";
+    {
+      auto file = std::ofstream(path, std::ios::binary);
+      file.write(reinterpret_cast<const char*>(list.compiled().data()),
+                 static_cast<std::streamsize>(list.compiled().size()));
+    }
+
+    auto mapped = skyr::public_suffix::suffix_list::map_compiled(path);
+    REQUIRE(mapped);
+    CHECK(mapped.value().registrable_domain("www.city.kobe.jp") == "city.kobe.jp");
+    std::filesystem::remove(path);
+  }
+
+  SECTION("missing file") {
+    auto mapped = skyr::public_suffix::suffix_list::map_compiled("does/not/exist.bin");
+    REQUIRE_FALSE(mapped);
+    CHECK(mapped.error() == skyr::public_suffix::public_suffix_errc::file_error);
+  }
+
+  SECTION("corrupt data") {
+    auto list = make_list();
+    auto compiled = std::vector<std::byte>(list.compiled().begin(), list.compiled().end());
+
+    auto truncated = skyr::public_suffix::suffix_list::from_compiled(std::span(compiled).first(compiled.size() - 1));
+    REQUIRE_FALSE(truncated);
+    CHECK(truncated.error() == skyr::public_suffix::public_suffix_errc::invalid_format);
+
+    compiled[0] = std::byte{'X'};
+    auto bad_magic = skyr::public_suffix::suffix_list::from_compiled(compiled);
+    REQUIRE_FALSE(bad_magic);
+    CHECK(bad_magic.error() == skyr::public_suffix::public_suffix_errc::invalid_format);
+  }
+}
@@ -19,3 +19,25 @@ TEST_CASE("weird_02", "byte_conversion_tests") {
   auto bytes = skyr::details::to_u8("/\xf0\x9f\x8d\xa3\xf0\x9f\x8d\xba");
   CHECK(bytes);
 }
+
+TEST_CASE("narrow_strings_are_not_copied", "byte_conversion_tests") {
+  auto input = std::string("http://example.com/a/path/that/is/too/long/for/the/small/string/buffer");
+  auto bytes = skyr::details::to_u8(input);
+  REQUIRE(bytes);
+  CHECK(bytes.value().data() == input.data());
+  CHECK(bytes.value().size() == input.size());
+}
+
+TEST_CASE("u8_strings_are_not_copied", "byte_conversion_tests") {
+  auto input = std::u8string(u8"http://example.com/é");
+  auto bytes = skyr::details::to_u8(input);
+  REQUIRE(bytes);
+  CHECK(static_cast<const void*>(bytes.value().data()) == static_cast<const void*>(input.data()));
+  CHECK(bytes.value() == "http://example.com/\xc3\xa9");
+}
+
+TEST_CASE("u8_literals_keep_null_characters", "byte_conversion_tests") {
+  auto bytes = skyr::details::to_u8(u8"a\0b");
+  REQUIRE(bytes);
+  CHECK(bytes.value() == std::string_view("a\0b", 3));
+}
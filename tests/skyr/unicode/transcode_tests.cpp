@@ -0,0 +1,144 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <array>
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/unicode/details/to_u8.hpp>
+#include <skyr/unicode/ranges/transforms/u32_transform.hpp>
+#include <skyr/unicode/ranges/transforms/u8_transform.hpp>
+#include <skyr/unicode/ranges/views/u16_view.hpp>
+#include <skyr/unicode/ranges/views/u8_view.hpp>
+#include <skyr/unicode/transcode.hpp>
+
+TEST_CASE("utf16 to utf8", "[transcode]") {
+  SECTION("empty") {
+    CHECK(skyr::unicode::to_utf8(std::u16string_view()).value().empty());
+    CHECK(skyr::unicode::utf8_length(std::u16string_view()).value() == 0);
+  }
+
+  SECTION("ascii") {
+    auto input = std::u16string(u"http://example.com/a/long/enough/path/to/fill/several/blocks");
+    CHECK(skyr::unicode::to_utf8(input).value() == "http://example.com/a/long/enough/path/to/fill/several/blocks");
+  }
+
+  SECTION("every_encoded_length") {
+    auto input = std::u16string_view(u"aé例\U0001F363");
+    CHECK(skyr::unicode::utf8_length(input).value() == 10);
+    CHECK(skyr::unicode::to_utf8(input).value() == "a\xc3\xa9\xe4\xbe\x8b\xf0\x9f\x8d\xa3");
+  }
+
+  SECTION("surrogate_pair_across_blocks") {
+    auto input = std::u16string(15, u'a') + u"\U0001F363" + std::u16string(16, u'b');
+    auto expected = std::string(15, 'a') + "\xf0\x9f\x8d\xa3" + std::string(16, 'b');
+    CHECK(skyr::unicode::utf8_length(input).value() == expected.size());
+    CHECK(skyr::unicode::to_utf8(input).value() == expected);
+  }
+
+  SECTION("unpaired_surrogates") {
+    auto input = GENERATE(std::u16string(u"\xd800"), std::u16string(u"a\xdc00"), std::u16string(u"\xd800\xd800"),
+                          std::u16string(u"\xd83c" u"abcdefghijklmnopqrstuvwxyz"),
+                          std::u16string(u"abcdefghijklmnopqrstuvwxyz\xd83c"),
+                          std::u16string(u"abcdefghijklmno\xdf63" u"abcdefghijklmnop"));
+    auto result = skyr::unicode::to_utf8(input);
+    REQUIRE(!result);
+    CHECK(result.error() == skyr::unicode::unicode_errc::invalid_code_point);
+  }
+
+  SECTION("same_as_range_pipeline") {
+    auto input = std::u16string(u"https://例え.テスト/\U0001F363/éè?q=ü#\U0001F37A");
+    for (auto i = 0; i < 3; ++i) {
+      input += input;
+    }
+    auto expected = skyr::unicode::as<std::string>(skyr::unicode::views::as_u16(input) |
+                                                   skyr::unicode::transforms::to_u8);
+    REQUIRE(expected);
+    CHECK(skyr::unicode::to_utf8(input).value() == expected.value());
+  }
+}
+
+TEST_CASE("utf32 to utf8", "[transcode]") {
+  SECTION("every_encoded_length") {
+    auto input = std::u32string(U"aé例\U0001F363") + std::u32string(20, U'z');
+    CHECK(skyr::unicode::utf8_length(input).value() == 30);
+    CHECK(skyr::unicode::to_utf8(input).value() == "a\xc3\xa9\xe4\xbe\x8b\xf0\x9f\x8d\xa3" + std::string(20, 'z'));
+  }
+
+  SECTION("supplementary_code_point_with_surrogate_low_bits") {
+    CHECK(skyr::unicode::to_utf8(std::u32string_view(U"\U0001D800")).value() == "\xf0\x9d\xa0\x80");
+  }
+
+  SECTION("invalid_code_points") {
+    auto value = GENERATE(char32_t{0xd800}, char32_t{0xdfff}, char32_t{0x110000}, char32_t{0xffffffff});
+    auto input = std::u32string(U"abcdefghijklmnopqrstuvwxyz") + value;
+    auto result = skyr::unicode::to_utf8(input);
+    REQUIRE(!result);
+    CHECK(result.error() == skyr::unicode::unicode_errc::invalid_code_point);
+  }
+}
+
+TEST_CASE("wide strings to utf8", "[transcode]") {
+  auto bytes = skyr::details::to_u8(std::wstring(L"http://example.com/é\U0001F363"));
+  REQUIRE(bytes);
+  CHECK(bytes.value() == "http://example.com/\xc3\xa9\xf0\x9f\x8d\xa3");
+}
+
+TEST_CASE("utf8 to utf32", "[transcode]") {
+  SECTION("empty") {
+    CHECK(skyr::unicode::to_utf32(std::string_view()).value().empty());
+  }
+
+  SECTION("ascii") {
+    auto input = std::string_view("http://example.com/a/long/enough/path/to/fill/several/blocks");
+    CHECK(skyr::unicode::to_utf32(input).value() == U"http://example.com/a/long/enough/path/to/fill/several/blocks");
+  }
+
+  SECTION("every_encoded_length") {
+    auto input = std::string("a\xc3\xa9\xe4\xbe\x8b\xf0\x9f\x8d\xa3") + std::string(20, 'z');
+    CHECK(skyr::unicode::to_utf32(input).value() == U"a\u00e9\u4f8b\U0001F363" + std::u32string(20, U'z'));
+  }
+
+  SECTION("sequence_across_blocks") {
+    auto input = std::string(15, 'a') + "\xf0\x9f\x8d\xa3" + std::string(16, 'b');
+    auto expected = std::u32string(15, U'a') + U"\U0001F363" + std::u32string(16, U'b');
+    CHECK(skyr::unicode::to_utf32(input).value() == expected);
+  }
+
+  SECTION("into_a_buffer") {
+    auto buffer = std::array<char32_t, 16>{};
+    auto length = skyr::unicode::to_utf32("b\xc3\xbc" "cher.example", buffer);
+    REQUIRE(length);
+    CHECK(std::u32string_view(buffer.data(), length.value()) == U"b\u00fccher.example");
+  }
+
+  SECTION("buffer_too_small") {
+    auto buffer = std::array<char32_t, 4>{};
+    auto length = skyr::unicode::to_utf32("example", buffer);
+    REQUIRE(!length);
+    CHECK(length.error() == skyr::unicode::unicode_errc::overflow);
+  }
+
+  SECTION("invalid_sequences") {
+    auto input = GENERATE(as<std::string>{}, "\x80", "\xc0\xaf", "\xc3", "\xe0\x80\xaf", "\xed\xa0\x80",
+                          "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "abcdefghijklmno\xe4\xbe",
+                          "abcdefghijklmnopqrstuvwxyz\xf0\x9f\x8d");
+    auto result = skyr::unicode::to_utf32(input);
+    CHECK(!result);
+  }
+
+  SECTION("same_as_range_pipeline") {
+    auto input = std::string("https://\xe4\xbe\x8b\xe3\x81\x88.\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88/"
+                             "\xf0\x9f\x8d\xa3/\xc3\xa9?q=\xc3\xbc#");
+    for (auto i = 0; i < 3; ++i) {
+      input += input;
+    }
+    auto expected = skyr::unicode::as<std::u32string>(skyr::unicode::views::as_u8(input) |
+                                                      skyr::unicode::transforms::to_u32);
+    REQUIRE(expected);
+    CHECK(skyr::unicode::to_utf32(input).value() == expected.value());
+  }
+}
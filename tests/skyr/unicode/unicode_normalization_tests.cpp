@@ -0,0 +1,72 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <utility>
+
+#include <catch2/catch_all.hpp>
+
+#include <skyr/unicode/normalization.hpp>
+
+TEST_CASE("nfc quick check", "[unicode][normalization]") {
+  using skyr::unicode::quick_check;
+
+  SECTION("ascii") {
+    CHECK(quick_check::yes == skyr::unicode::nfc_quick_check(U"example.com"));
+  }
+
+  SECTION("precomposed") {
+    CHECK(quick_check::yes == skyr::unicode::nfc_quick_check(U"caf\x00e9"));
+  }
+
+  SECTION("combining_mark_may_compose") {
+    CHECK(quick_check::maybe == skyr::unicode::nfc_quick_check(U"cafe\x0301"));
+  }
+
+  SECTION("composition_exclusion") {
+    CHECK(quick_check::no == skyr::unicode::nfc_quick_check(U"\x212b"));
+  }
+
+  SECTION("non_canonical_order") {
+    CHECK(quick_check::no == skyr::unicode::nfc_quick_check(U"a\x0301\x0328"));
+  }
+}
+
+TEST_CASE("nfc normalization", "[unicode][normalization]") {
+  using param = std::pair<std::u32string, std::u32string>;
+
+  auto code_points = GENERATE(
+      param{U"example.com", U"example.com"}, param{U"cafe\x0301", U"caf\x00e9"}, param{U"\x212b", U"\x00c5"},
+      param{U"a\x0301\x0328", U"\x0105\x0301"}, param{U"\x0344", U"\x0308\x0301"},
+      param{U"\x1100\x1161\x11a8", U"\xac01"}, param{U"\xac00\x11a8", U"\xac01"},
+      param{U"\x0301" U"a", U"\x0301" U"a"}, param{U"\x1e0b\x0323", U"\x1e0d\x0307"},
+      param{U"\x0041\x030a\x0301", U"\x01fa"});
+
+  SECTION("normalize") {
+    const auto& [input, expected] = code_points;
+    auto normalized = std::u32string{};
+    skyr::unicode::normalize_nfc(input, &normalized);
+    CHECK(expected == normalized);
+  }
+
+  SECTION("normalize_in_place") {
+    auto [input, expected] = code_points;
+    skyr::unicode::normalize_nfc(&input);
+    CHECK(expected == input);
+  }
+
+  SECTION("is_nfc") {
+    const auto& [input, expected] = code_points;
+    CHECK(skyr::unicode::is_nfc(expected));
+    CHECK((input == expected) == skyr::unicode::is_nfc(input));
+  }
+}
+
+TEST_CASE("canonical combining class", "[unicode][normalization]") {
+  CHECK(0 == skyr::unicode::canonical_combining_class(U'a'));
+  CHECK(230 == skyr::unicode::canonical_combining_class(U'\x0301'));
+  CHECK(202 == skyr::unicode::canonical_combining_class(U'\x0328'));
+  CHECK(9 == skyr::unicode::canonical_combining_class(U'\x094d'));
+}
@@ -3,7 +3,13 @@
 // (See accompanying file LICENSE_1_0.txt of copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <concepts>
 #include <exception>
+#include <format>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <catch2/catch_all.hpp>
 
@@ -148,6 +154,137 @@ TEST_CASE("url_search_parameters_test", "[url_search_parameters]") {
   }
 }
 
+TEST_CASE("url_search_parameters_index", "[url_search_parameters]") {
+  auto make_query = [](std::size_t count) {
+    auto query = std::string{};
+    for (auto i = 0UL; i < count; ++i) {
+      query += std::format("{}p{}={}", (i == 0) ? "" : "&", i % 50, i);
+    }
+    return query;
+  };
+
+  SECTION("many_lookups") {
+    auto parameters = skyr::url_search_parameters(make_query(200));
+    for (auto i = 0; i < 100; ++i) {
+      CHECK(parameters.contains("p7"));
+      CHECK(!parameters.contains("p50"));
+      CHECK(parameters.get("p7").value() == "7");
+      CHECK(!parameters.get("p50"));
+    }
+    CHECK(parameters.get_all("p7") == std::vector<std::string>{"7", "57", "107", "157"});
+    CHECK(parameters.get_all("p50").empty());
+  }
+
+  SECTION("index_is_invalidated") {
+    auto parameters = skyr::url_search_parameters(make_query(100));
+    for (auto i = 0; i < 10; ++i) {
+      CHECK(parameters.get("p1").value() == "1");
+    }
+
+    parameters.remove("p1");
+    CHECK(!parameters.contains("p1"));
+    parameters.append("new", "value");
+    CHECK(parameters.get("new").value() == "value");
+    parameters.set("p2", "two");
+    CHECK(parameters.get_all("p2") == std::vector<std::string>{"two"});
+    parameters.sort();
+    CHECK(parameters.get("new").value() == "value");
+    CHECK(parameters.get_all("p3") == std::vector<std::string>{"3", "53"});
+  }
+
+  SECTION("index_follows_the_url") {
+    auto url = skyr::url("https://example.com/?" + make_query(100));
+    for (auto i = 0; i < 10; ++i) {
+      CHECK(url.search_parameters().get("p1").value() == "1");
+    }
+
+    url.set_search("?" + make_query(40));
+    CHECK(url.search_parameters().get_all("p1") == std::vector<std::string>{"1"});
+    url.search_parameters().append("p1", "x");
+    CHECK(url.search_parameters().get_all("p1") == std::vector<std::string>{"1", "x"});
+  }
+
+  SECTION("copies_and_swaps") {
+    auto parameters = skyr::url_search_parameters(make_query(100));
+    for (auto i = 0; i < 10; ++i) {
+      CHECK(parameters.contains("p1"));
+    }
+
+    auto copy = parameters;
+    CHECK(copy.get("p1").value() == "1");
+
+    auto other = skyr::url_search_parameters(make_query(40));
+    other.swap(parameters);
+    CHECK(other.get_all("p1") == std::vector<std::string>{"1", "51"});
+    CHECK(parameters.get_all("p1") == std::vector<std::string>{"1"});
+    CHECK(other.size() == 100);
+    CHECK(parameters.size() == 40);
+  }
+}
+
+TEST_CASE("url_search_parameters_storage", "[url_search_parameters]") {
+  using const_iterator = skyr::url_search_parameters::const_iterator;
+  static_assert(std::random_access_iterator<const_iterator>);
+  static_assert(std::same_as<std::iterator_traits<const_iterator>::iterator_category, std::input_iterator_tag>);
+  static_assert(std::same_as<std::iter_value_t<const_iterator>, skyr::url_search_parameters::view_type>);
+  /// The parameters of a `url` are allocated by their first access
+  static_assert(sizeof(skyr::url_search_parameters) == 2 * sizeof(void*));
+
+  SECTION("iterators_yield_views") {
+    auto parameters = skyr::url_search_parameters{"a=b&c&d=%41%42&e=%zz"};
+    REQUIRE(parameters.size() == 4);
+    auto it = parameters.begin();
+    CHECK(it[1].name == "c");
+    CHECK(it[1].value == "");
+    CHECK(it[2] == skyr::query_parameter_view{"d", "AB"});
+    CHECK((it + 3)->value == "%zz");
+    CHECK(parameters.end() - parameters.begin() == 4);
+  }
+
+  SECTION("views_convert_to_value_type") {
+    auto parameters = skyr::url_search_parameters{{"a", "b"}, {"c"}};
+    auto values = std::vector<skyr::url_search_parameters::value_type>{};
+    for (auto parameter : parameters) {
+      values.emplace_back(parameter);
+    }
+    REQUIRE(values.size() == 2);
+    CHECK(values[0].name == "a");
+    CHECK(values[0].value == "b");
+    CHECK(values[1].name == "c");
+    CHECK(!values[1].value);
+    CHECK("a=b&c" == parameters.to_string());
+  }
+
+  SECTION("append_a_view_of_the_parameters") {
+    auto parameters = skyr::url_search_parameters{"name=value"};
+    for (auto i = 0; i < 20; ++i) {
+      auto last = *std::ranges::prev(parameters.end());
+      parameters.append(last.name, last.value.value());
+    }
+    CHECK(parameters.get_all("name") == std::vector<std::string>(21, "value"));
+    parameters.set("name", parameters.begin()->name);
+    CHECK(parameters.size() == 1);
+    CHECK(parameters.get("name").value() == "name");
+  }
+
+  SECTION("removing_and_setting_many_times") {
+    auto parameters = skyr::url_search_parameters{};
+    for (auto i = 0; i < 100; ++i) {
+      parameters.append(std::format("p{}", i), std::string(i, 'x'));
+      parameters.set("counter", std::to_string(i));
+      if ((i % 2) == 1) {
+        parameters.remove(std::format("p{}", i - 1));
+      }
+    }
+    CHECK(parameters.size() == 51);
+    CHECK(parameters.get("counter").value() == "99");
+    CHECK(parameters.get("p99").value() == std::string(99, 'x'));
+    CHECK(!parameters.contains("p98"));
+    parameters.sort();
+    CHECK(parameters.begin()->name == "counter");
+  }
+}
+
 TEST_CASE("url") {
   SECTION("url_with_no_query_test") {
     auto instance = skyr::url("https://example.com/");
@@ -328,6 +465,16 @@ TEST_CASE("url") {
     CHECK("c=d" == instance.record().query.value());
   }
 
+  SECTION("swap_unparsed_url_parameters_with_standalone_parameters") {
+    auto url = skyr::url("http://example.com/?q=1&r=2");
+    auto standalone = skyr::url_search_parameters{"s=3"};
+    standalone.swap(url.search_parameters());
+
+    REQUIRE(standalone.size() == 2);
+    CHECK("q=1&r=2" == standalone.to_string());
+    CHECK("s=3" == url.search_parameters().to_string());
+  }
+
   SECTION("test_percent_decoding") {
     auto url =
         skyr::url("https://example.org/?q=\xf0\x9f\x8f\xb3\xef\xb8\x8f\xe2\x80\x8d\xf0\x9f\x8c\x88&key=e1f7bc78");
@@ -354,4 +501,88 @@ TEST_CASE("url") {
     CHECK(value.value() == "\xf0\x9f\x8f\xb3\xef\xb8\x8f\xe2\x80\x8d\xf0\x9f\x8c\x88");
     CHECK("?key=e1f7bc78&q=%F0%9F%8F%B3%EF%B8%8F%E2%80%8D%F0%9F%8C%88" == url.search());
   }
+
+  SECTION("parameters_follow_set_search") {
+    auto url = skyr::url("https://example.com/?a=b");
+    const auto& parameters = url.search_parameters();
+    CHECK(parameters.size() == 1);
+    url.set_search("?c=d&e=f");
+    REQUIRE(parameters.size() == 2);
+    CHECK(parameters.get("c").value() == "d");
+    CHECK(!parameters.contains("a"));
+  }
+
+  SECTION("parameters_after_other_setters") {
+    auto url = skyr::url("https://example.com/?a=b&c=d");
+    CHECK(url.search_parameters().size() == 2);
+    url.set_hash("#fragment");
+    url.set_pathname("/path");
+    CHECK(url.search_parameters().size() == 2);
+    CHECK("a=b&c=d" == url.search_parameters().to_string());
+  }
+
+  SECTION("parameters_after_copy_assignment") {
+    auto url = skyr::url("https://example.com/?a=b");
+    {
+      auto other = skyr::url("https://example.org/?c=d&e=f");
+      url = other;
+    }
+    CHECK(url.search_parameters().size() == 2);
+    url.search_parameters().append("g", "h");
+    CHECK("?c=d&e=f&g=h" == url.search());
+  }
+
+  SECTION("parameters_after_move_assignment") {
+    auto url = skyr::url("https://example.com/?a=b");
+    url = skyr::url("https://example.org/?c=d");
+    url.search_parameters().set("c", "e");
+    CHECK("?c=e" == url.search());
+  }
+}
+
+TEST_CASE("url_search_parameters_threads", "[url_search_parameters]") {
+  SECTION("read_a_const_url_concurrently") {
+    const auto url = skyr::url("https://example.com/?a=b&c=d&a=e");
+    auto sizes = std::vector<std::size_t>(4);
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0UL; t < sizes.size(); ++t) {
+      threads.emplace_back([&url, &size = sizes[t]]() { size = url.search_parameters().size(); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    CHECK(sizes == std::vector<std::size_t>(4, 3));
+    CHECK(url.search_parameters().get_all("a") == std::vector<std::string>{"b", "e"});
+  }
+}
+
+TEST_CASE("url_search_parameters_index_threads", "[url_search_parameters]") {
+  SECTION("look_up_a_const_url_concurrently") {
+    auto query = std::string("?");
+    for (auto i = 0UL; i < 64; ++i) {
+      query += std::format("{}p{}={}", (i == 0) ? "" : "&", i, i);
+    }
+    const auto url = skyr::url("https://example.com/" + query);
+
+    /// Each thread makes enough lookups to build the index, and counts those
+    /// that succeed, as Catch2 assertions aren't thread safe
+    auto found = std::vector<int>(8);
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0UL; t < found.size(); ++t) {
+      threads.emplace_back([&url, &count = found[t]]() {
+        for (auto i = 0; i < 100; ++i) {
+          const auto& parameters = url.search_parameters();
+          count += (parameters.get("p5") == "5") ? 1 : 0;
+          count += (parameters.contains("p63") && !parameters.contains("p64")) ? 1 : 0;
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    CHECK(found == std::vector<int>(8, 200));
+    CHECK(url.search_parameters().get_all("p7") == std::vector<std::string>{"7"});
+  }
 }
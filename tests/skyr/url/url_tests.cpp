@@ -700,4 +700,36 @@ TEST_CASE("url_tests", "[url]") {
     CHECK(instance.href() == "file:///C:/");
     CHECK(instance.pathname() == "/C:/");
   }
+
+  SECTION("remove_query_parameters_keeps_others") {
+    const auto filter = skyr::query_filter::compile({"gclid"}, {"utm_"});
+    auto instance = skyr::url("https://example.com/path?id=42&utm_source=mail&gclid=abc&q=a%20b#top");
+    CHECK(instance.remove_query_parameters(filter));
+    CHECK(instance.href() == "https://example.com/path?id=42&q=a%20b#top");
+    CHECK(instance.href() == skyr::serialize(instance.record()));
+    CHECK(instance.search() == "?id=42&q=a%20b");
+    CHECK(instance.hash() == "#top");
+    CHECK(instance.search_parameters().size() == 2);
+  }
+
+  SECTION("remove_query_parameters_removes_query") {
+    const auto filter = skyr::query_filter::compile({"gclid"}, {"utm_"});
+    auto instance = skyr::url("https://example.com/?utm_source=mail&gclid=abc#top");
+    CHECK(instance.remove_query_parameters(filter));
+    CHECK(instance.href() == "https://example.com/#top");
+    CHECK(!instance.record().query);
+    CHECK(instance.search().empty());
+    CHECK(instance.search_parameters().empty());
+  }
+
+  SECTION("remove_query_parameters_no_match") {
+    const auto filter = skyr::query_filter::compile({"gclid"}, {"utm_"});
+    auto instance = skyr::url("https://example.com/?id=42&&utm=1#top");
+    CHECK(!instance.remove_query_parameters(filter));
+    CHECK(instance.href() == "https://example.com/?id=42&&utm=1#top");
+
+    auto no_query = skyr::url("https://example.com/#gclid=abc");
+    CHECK(!no_query.remove_query_parameters(filter));
+    CHECK(no_query.href() == "https://example.com/#gclid=abc");
+  }
 }
@@ -0,0 +1,36 @@
+// Copyright 2026 Glyn Matthews.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compiles the text Public Suffix List to the format loaded by
+// skyr::public_suffix::suffix_list::map_compiled.
+//
+// Usage: skyr-compile-public-suffix-list public_suffix_list.dat output.bin
+
+#include <fstream>
+#include <iostream>
+
+#include <skyr/public_suffix/public_suffix_list.hpp>
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " public_suffix_list.dat output.bin" << std::endl;
+    return 1;
+  }
+
+  auto list = skyr::public_suffix::suffix_list::load(argv[1]);
+  if (!list) {
+    std::cerr << "Unable to compile " << argv[1] << std::endl;
+    return 1;
+  }
+
+  auto compiled = list.value().compiled();
+  auto output = std::ofstream(argv[2], std::ios::binary);
+  output.write(reinterpret_cast<const char*>(compiled.data()), static_cast<std::streamsize>(compiled.size()));
+  if (!output) {
+    std::cerr << "Unable to write " << argv[2] << std::endl;
+    return 1;
+  }
+  return 0;
+}
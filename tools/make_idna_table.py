@@ -4,10 +4,20 @@
 # http://www.boost.org/LICENSE_1_0.txt)
 
 # This script parses the IDNA table from
-# https://unicode.org/Public/idna/11.0.0/IdnaMappingTable.txt,
+# https://www.unicode.org/Public/idna/15.1.0/IdnaMappingTable.txt,
 # and converts it to a C++ table.
-
-
+#
+# Optionally, it also parses the Bidi_Class, Joining_Type and
+# Canonical_Combining_Class properties from the UCD extracted files
+# (https://unicode.org/Public/15.1.0/ucd/extracted/) and converts them to
+# the tables used by the CheckBidi and CheckJoiners validity criteria:
+#
+#   make_idna_table.py IdnaMappingTable.txt idna_tables.hpp \
+#       DerivedBidiClass.txt DerivedJoiningType.txt DerivedCombiningClass.txt \
+#       idna_context_tables.hpp
+
+
+import bisect
 import sys
 import jinja2
 
@@ -15,20 +25,19 @@ import jinja2
 def parse_line(line):
     line = line[0:line.find('#')]
     tokens = [token.strip() for token in line.split(';')] if line else []
-    if len(tokens) == 3:
-        tokens[2] = tokens[2].split(' ')[0]
     return tokens
 
 
-status_keys = [
-    'valid',
-    'mapped',
-    'disallowed',
-    'disallowed_STD3_valid',
-    'disallowed_STD3_mapped',
-    'ignored',
-    'deviation',
-    ]
+# The values of skyr::idna::idna_status
+status_values = {
+    'disallowed': 1,
+    'disallowed_STD3_valid': 2,
+    'disallowed_STD3_mapped': 3,
+    'ignored': 4,
+    'mapped': 5,
+    'deviation': 6,
+    'valid': 7,
+    }
 
 
 class CodePointRange(object):
@@ -40,19 +49,184 @@ class CodePointRange(object):
             range = [int(range[0], 16), int(range[1], 16)]
         self.range = range
         self.status = status
-        self.mapped = int(mapped, 16) if mapped else None
+        self.mapped = [int(code_point, 16) for code_point in mapped.split()] if mapped is not None else None
+        self.mapped_offset = 0
 
     @property
     def is_mapped(self):
-        return self.status in ('mapped', 'disallowed_STD3_mapped')
+        return self.status in ('mapped', 'disallowed_STD3_mapped', 'deviation') and self.mapped is not None
 
     @property
     def is_valid(self):
         return self.status == 'valid'
 
-    @property
-    def can_be_16_bit(self):
-        return self.range[0] <= 0xffff and self.mapped is not None and self.mapped <= 0xffff
+
+def make_mapping_pool(code_points):
+    """Packs every mapping into a single pool of code points, sharing storage between identical mappings, or when a
+    mapping is already contained in the pool"""
+    pool, offsets = [], {}
+    for code_point in sorted(code_points, key=lambda cp: len(cp.mapped), reverse=True):
+        mapped = tuple(code_point.mapped)
+        if mapped not in offsets:
+            offsets[mapped] = find_sequence(pool, mapped)
+            if offsets[mapped] is None:
+                offsets[mapped] = len(pool)
+                pool.extend(mapped)
+        code_point.mapped_offset = offsets[mapped]
+    return pool
+
+
+def find_sequence(pool, sequence):
+    if not sequence:
+        return 0
+    for offset in range(len(pool) - len(sequence) + 1):
+        if tuple(pool[offset:offset + len(sequence)]) == sequence:
+            return offset
+    return None
+
+
+bidi_class_keys = [
+    'L', 'R', 'AL', 'EN', 'ES', 'ET', 'AN', 'CS', 'NSM', 'BN', 'B', 'S',
+    'WS', 'ON', 'LRE', 'LRO', 'RLE', 'RLO', 'PDF', 'LRI', 'RLI', 'FSI', 'PDI',
+    ]
+
+
+joining_type_keys = [
+    'U', 'C', 'D', 'L', 'R', 'T',
+    ]
+
+
+max_code_point = 0x10ffff
+
+
+range_first_shift = 11
+mapped_length_shift = 3
+range_block_shift = 8
+range_block_size = 1 << range_block_shift
+
+
+virama_combining_class = '9'
+
+
+def parse_property_file(input, keys=None):
+    """Parses a UCD property file, returning a dict of code point to value"""
+    values = {}
+    with open(input, 'r') as input_file:
+        for line in input_file.readlines():
+            tokens = parse_line(line)
+            if len(tokens) < 2:
+                continue
+            first, last = CodePointRange(tokens[0], None, None).range
+            if keys is not None and tokens[1] not in keys:
+                continue
+            for code_point in range(first, last + 1):
+                values[code_point] = tokens[1]
+    return values
+
+
+def make_two_stage_table(values):
+    """Splits the values into deduplicated blocks, and picks the block size that gives the smallest tables"""
+    best = None
+    for shift in range(5, 10):
+        block_size = 1 << shift
+        blocks, index = {}, []
+        for first in range(0, max_code_point + 1, block_size):
+            block = tuple(values[first:first + block_size])
+            index.append(blocks.setdefault(block, len(blocks)))
+        index_type = 'std::uint8_t' if len(blocks) <= 0x100 else 'std::uint16_t'
+        size = len(index) * (1 if len(blocks) <= 0x100 else 2) + len(blocks) * block_size
+        if best is None or size < best['size']:
+            best = {
+                'shift': shift,
+                'index': index,
+                'index_type': index_type,
+                'blocks': [value for block in blocks for value in block],
+                'size': size,
+            }
+    return best
+
+
+def chunks(values, size):
+    return [values[i:i + size] for i in range(0, len(values), size)]
+
+
+def generate_context_tables(bidi_input, joining_input, combining_input, output):
+    bidi_classes = parse_property_file(bidi_input, bidi_class_keys)
+    joining_types = parse_property_file(joining_input, joining_type_keys)
+    combining_classes = parse_property_file(combining_input)
+
+    # Pack the Bidi_Class in the low 5 bits, and the Joining_Type in the high 3 bits. Code points
+    # that aren't listed take the default values, L and U.
+    values = [
+        bidi_class_keys.index(bidi_classes.get(code_point, 'L')) |
+        (joining_type_keys.index(joining_types.get(code_point, 'U')) << 5)
+        for code_point in range(max_code_point + 1)]
+    table = make_two_stage_table(values)
+
+    viramas = sorted(code_point for code_point, value in combining_classes.items() if value == virama_combining_class)
+
+    template = jinja2.Template(
+        """// Auto-generated.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_DOMAIN_IDNA_CONTEXT_TABLES_HPP
+#define SKYR_DOMAIN_IDNA_CONTEXT_TABLES_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace skyr::idna {
+/// \enum bidi_class
+/// The Bidi_Class property values, used by the Bidi Rule (RFC 5893)
+enum class bidi_class : std::uint8_t {
+{% for key in bidi_class_keys %}  {{ key.lower() }},
+{% endfor %}};
+
+/// \enum joining_type
+/// The Joining_Type property values, used by the ContextJ rules (RFC 5892)
+enum class joining_type : std::uint8_t {
+{% for key in joining_type_keys %}  {{ key.lower() }},
+{% endfor %}};
+
+namespace details {
+/// Each code point property is packed in a single byte: the Bidi_Class in
+/// the low bits and the Joining_Type in the high bits
+inline constexpr auto bidi_class_mask = std::uint8_t{0x1f};
+inline constexpr auto joining_type_shift = 5;
+
+/// The properties are stored in a two-stage table, split into blocks of
+/// `1 << properties_block_shift` code points
+inline constexpr auto properties_block_shift = {{ table.shift }};
+
+inline constexpr auto properties_index = std::array<{{ table.index_type }}, {{ table.index|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(table.index, 16) %}    {% for value in chunk %}{{ value }},{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+inline constexpr auto properties_blocks = std::array<std::uint8_t, {{ table.blocks|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(table.blocks, 16) %}    {% for value in chunk %}{{ '0x%02x' % value }},{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+/// Code points with Canonical_Combining_Class=Virama
+inline constexpr auto viramas = std::array<char32_t, {{ viramas|length }}>{% raw %}{{{% endraw %}
+{% for code_point in viramas %}    U'\\x{{ '%04x' % code_point }}',
+{% endfor %}{% raw %}}}{% endraw %};
+}  // namespace details
+}  // namespace skyr::idna
+
+#endif  // SKYR_DOMAIN_IDNA_CONTEXT_TABLES_HPP
+
+""")
+
+    with open(output, 'w+') as output_file:
+        template.stream(
+            bidi_class_keys=bidi_class_keys,
+            joining_type_keys=joining_type_keys,
+            table=table,
+            chunks=chunks,
+            viramas=viramas
+        ).dump(output_file)
 
 
 def main():
@@ -66,13 +240,34 @@ def main():
                 code_points.append(CodePointRange(
                     code_point[0], code_point[1], code_point[2] if len(code_point) > 2 else None))
 
-        # Store code point mappings as std::char16_t if they can, otherwise store them as std::char32_t
-        mapped_code_points_16, mapped_code_points_32 = [], []
-        for code_point in filter(lambda cp: cp.is_mapped, code_points):
-            (mapped_code_points_32, mapped_code_points_16)[code_point.can_be_16_bit].append(code_point)
-
-        # Squeeze code points to reduce table size, and remove all valid code points as they will be handled by default
-        code_points = [code_point for code_point in code_points if not code_point.is_valid]
+        # Store the mappings, which can have zero or more code points, in a single pool that is indexed by the
+        # status table
+        mapped_code_points = make_mapping_pool([code_point for code_point in code_points if code_point.is_mapped])
+
+        # Merge neighbouring ranges that have the same status and no mapping, so that the ranges are contiguous
+        # and as few as possible
+        ranges = []
+        for code_point in code_points:
+            if ranges and not code_point.is_mapped and not ranges[-1].is_mapped and \
+                    ranges[-1].status == code_point.status and ranges[-1].range[1] + 1 == code_point.range[0]:
+                ranges[-1].range = [ranges[-1].range[0], code_point.range[1]]
+            else:
+                ranges.append(code_point)
+
+        # Pack each range in 32 bits, with the first code point in the high bits so that the packed values can be
+        # binary searched. The mapping offsets are stored separately.
+        packed_ranges = [
+            (code_point.range[0] << range_first_shift) |
+            ((len(code_point.mapped) if code_point.is_mapped else 0) << mapped_length_shift) |
+            status_values[code_point.status]
+            for code_point in ranges]
+        mapped_offsets = [code_point.mapped_offset for code_point in ranges]
+
+        # The first range of each block of code points, to narrow the binary search
+        firsts = [code_point.range[0] for code_point in ranges]
+        range_index = [
+            bisect.bisect_right(firsts, first) - 1
+            for first in range(0, max_code_point + 1 + range_block_size, range_block_size)]
 
         template = jinja2.Template(
             """// Auto-generated.
@@ -83,38 +278,42 @@ def main():
 #ifndef SKYR_DOMAIN_IDNA_TABLES_HPP
 #define SKYR_DOMAIN_IDNA_TABLES_HPP
 
-#include <algorithm>
 #include <array>
-#include <iterator>
+#include <cstdint>
+
 #include <skyr/domain/idna_status.hpp>
 
 namespace skyr::idna::details {
-struct code_point_range {
-  char32_t first;
-  char32_t last;
-  idna_status status;
-};
-
-constexpr static auto statuses = std::array<code_point_range, {{ entries|length }}>{% raw %}{{{% endraw %}
-{% for code_point in entries %}  { U'\\x{{ '%04x' % code_point.range[0] }}', U'\\x{{ '%04x' % code_point.range[1] }}', idna_status::{{ code_point.status.lower() }} },
+/// Every code point belongs to one range of code points with the same
+/// status. Each range is packed as
+///
+///   first code point << range_first_shift | mapped length << mapped_length_shift | status
+///
+/// If the code points are mapped, the mapping is `mapped length` code points
+/// from `mapped_offsets[i]` in `mapped_code_points`
+inline constexpr auto range_first_shift = {{ range_first_shift }};
+inline constexpr auto mapped_length_shift = {{ mapped_length_shift }};
+inline constexpr auto status_mask = std::uint32_t{0x{{ '%x' % status_mask }}};
+inline constexpr auto mapped_length_mask = std::uint32_t{0x{{ '%x' % mapped_length_mask }}};
+
+inline constexpr auto code_point_ranges = std::array<std::uint32_t, {{ packed_ranges|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(packed_ranges, 8) %}    {% for value in chunk %}{{ '0x%08x' % value }},{% if not loop.last %} {% endif %}{% endfor %}
 {% endfor %}{% raw %}}}{% endraw %};
 
-struct mapped_16_code_point {
-  char16_t code_point;
-  char16_t mapped;
-};
-
-constexpr static auto mapped_16 = std::array<mapped_16_code_point, {{ mapped_entries_16|length }}>{% raw %}{{{% endraw %}
-{% for code_point in mapped_entries_16 %}  { U'\\x{{ '%04x' % code_point.range[0] }}', U'\\x{{ '%04x' % code_point.mapped }}' },
+inline constexpr auto mapped_offsets = std::array<std::uint16_t, {{ mapped_offsets|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(mapped_offsets, 16) %}    {% for value in chunk %}{{ value }},{% if not loop.last %} {% endif %}{% endfor %}
 {% endfor %}{% raw %}}}{% endraw %};
 
-struct mapped_32_code_point {
-  char32_t code_point;
-  char32_t mapped;
-};
+/// The index of the range that contains the first code point of each
+/// block of `1 << range_block_shift` code points
+inline constexpr auto range_block_shift = {{ range_block_shift }};
 
-constexpr static auto mapped_32 = std::array<mapped_32_code_point, {{ mapped_entries_32|length }}>{% raw %}{{{% endraw %}
-{% for code_point in mapped_entries_32 %}  { U'\\x{{ '%04x' % code_point.range[0] }}', U'\\x{{ '%04x' % code_point.mapped }}' },
+inline constexpr auto range_index = std::array<std::uint16_t, {{ range_index|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(range_index, 16) %}    {% for value in chunk %}{{ value }},{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+inline constexpr auto mapped_code_points = std::array<char32_t, {{ mapped_code_points|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(mapped_code_points, 8) %}    {% for code_point in chunk %}U'\\x{{ '%04x' % code_point }}',{% if not loop.last %} {% endif %}{% endfor %}
 {% endfor %}{% raw %}}}{% endraw %};
 }  // namespace skyr::idna::details
 
@@ -123,11 +322,21 @@ constexpr static auto mapped_32 = std::array<mapped_32_code_point, {{ mapped_ent
 """)
 
         template.stream(
-            entries=code_points,
-            mapped_entries_16=mapped_code_points_16,
-            mapped_entries_32=mapped_code_points_32
+            range_first_shift=range_first_shift,
+            mapped_length_shift=mapped_length_shift,
+            status_mask=(1 << mapped_length_shift) - 1,
+            mapped_length_mask=(1 << (range_first_shift - mapped_length_shift)) - 1,
+            packed_ranges=packed_ranges,
+            mapped_offsets=mapped_offsets,
+            range_block_shift=range_block_shift,
+            range_index=range_index,
+            mapped_code_points=mapped_code_points,
+            chunks=chunks
         ).dump(output_file)
 
+    if len(sys.argv) == 7:
+        generate_context_tables(sys.argv[3], sys.argv[4], sys.argv[5], sys.argv[6])
+
 
 if __name__ == '__main__':
     main()
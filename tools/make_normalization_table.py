@@ -0,0 +1,200 @@
+# Copyright 2026 Glyn Matthews.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# This script parses the canonical decompositions and combining classes from
+# https://unicode.org/Public/15.1.0/ucd/UnicodeData.txt, and the NFC_QC and
+# Full_Composition_Exclusion properties from
+# https://unicode.org/Public/15.1.0/ucd/DerivedNormalizationProps.txt,
+# and converts them to the C++ tables used for NFC normalization:
+#
+#   make_normalization_table.py UnicodeData.txt DerivedNormalizationProps.txt normalization_tables.hpp
+
+
+import sys
+import jinja2
+
+
+max_code_point = 0x10ffff
+
+
+quick_check_keys = [
+    'Y',
+    'N',
+    'M',
+    ]
+
+
+def parse_range(range):
+    range = range.split('..') if '..' in range else [range, range]
+    return int(range[0], 16), int(range[1], 16)
+
+
+def parse_unicode_data(input):
+    """Returns the combining classes and canonical decompositions"""
+    combining_classes, decompositions = {}, {}
+    with open(input, 'r') as input_file:
+        for line in input_file.readlines():
+            fields = line.strip().split(';')
+            if len(fields) < 6:
+                continue
+            code_point = int(fields[0], 16)
+            if int(fields[3]):
+                combining_classes[code_point] = int(fields[3])
+            # Compatibility decompositions have a <tag>, and aren't used by NFC
+            if fields[5] and not fields[5].startswith('<'):
+                decompositions[code_point] = [int(value, 16) for value in fields[5].split()]
+    return combining_classes, decompositions
+
+
+def parse_normalization_props(input):
+    """Returns the NFC_QC values and the set of code points with Full_Composition_Exclusion"""
+    quick_check, exclusions = {}, set()
+    with open(input, 'r') as input_file:
+        for line in input_file.readlines():
+            line = line[0:line.find('#')]
+            tokens = [token.strip() for token in line.split(';')] if line else []
+            if len(tokens) < 2:
+                continue
+            first, last = parse_range(tokens[0])
+            for code_point in range(first, last + 1):
+                if tokens[1] == 'NFC_QC':
+                    quick_check[code_point] = tokens[2]
+                elif tokens[1] == 'Full_Composition_Exclusion':
+                    exclusions.add(code_point)
+    return quick_check, exclusions
+
+
+def full_decomposition(code_point, decompositions):
+    if code_point not in decompositions:
+        return [code_point]
+    return [value for mapped in decompositions[code_point] for value in full_decomposition(mapped, decompositions)]
+
+
+def make_two_stage_table(values):
+    """Splits the values into deduplicated blocks, and picks the block size that gives the smallest tables"""
+    best = None
+    for shift in range(5, 10):
+        block_size = 1 << shift
+        blocks, index = {}, []
+        for first in range(0, max_code_point + 1, block_size):
+            block = tuple(values[first:first + block_size])
+            index.append(blocks.setdefault(block, len(blocks)))
+        size = len(index) * (1 if len(blocks) <= 0x100 else 2) + len(blocks) * block_size * 2
+        if best is None or size < best['size']:
+            best = {
+                'shift': shift,
+                'index': index,
+                'index_type': 'std::uint8_t' if len(blocks) <= 0x100 else 'std::uint16_t',
+                'blocks': [value for block in blocks for value in block],
+                'size': size,
+            }
+    return best
+
+
+def chunks(values, size):
+    return [values[i:i + size] for i in range(0, len(values), size)]
+
+
+def main():
+    unicode_data, normalization_props, output = sys.argv[1], sys.argv[2], sys.argv[3]
+
+    combining_classes, decompositions = parse_unicode_data(unicode_data)
+    quick_check, exclusions = parse_normalization_props(normalization_props)
+
+    # Pack the Canonical_Combining_Class in the low 8 bits, and the NFC_QC value in the high bits
+    values = [
+        combining_classes.get(code_point, 0) | (quick_check_keys.index(quick_check.get(code_point, 'Y')) << 8)
+        for code_point in range(max_code_point + 1)]
+    table = make_two_stage_table(values)
+
+    # Store the full canonical decompositions, so that they don't need to be applied recursively
+    decomposition_entries, decomposed_code_points = [], []
+    for code_point in sorted(decompositions):
+        decomposition = full_decomposition(code_point, decompositions)
+        decomposition_entries.append((code_point, len(decomposed_code_points), len(decomposition)))
+        decomposed_code_points.extend(decomposition)
+
+    # The primary composites, sorted by their canonical decomposition pair
+    compositions = sorted(
+        (decomposition[0], decomposition[1], code_point)
+        for code_point, decomposition in decompositions.items()
+        if len(decomposition) == 2 and code_point not in exclusions)
+
+    template = jinja2.Template(
+        """// Auto-generated.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef SKYR_UNICODE_NORMALIZATION_TABLES_HPP
+#define SKYR_UNICODE_NORMALIZATION_TABLES_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace skyr::unicode::details {
+/// Each code point property is packed in 16 bits: the
+/// Canonical_Combining_Class in the low byte and the NFC_QC value in the high
+/// byte
+inline constexpr auto combining_class_mask = std::uint16_t{0xff};
+inline constexpr auto nfc_quick_check_shift = 8;
+
+/// The properties are stored in a two-stage table, split into blocks of
+/// `1 << normalization_block_shift` code points
+inline constexpr auto normalization_block_shift = {{ table.shift }};
+
+inline constexpr auto normalization_index = std::array<{{ table.index_type }}, {{ table.index|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(table.index, 16) %}    {% for value in chunk %}{{ value }},{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+inline constexpr auto normalization_blocks = std::array<std::uint16_t, {{ table.blocks|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(table.blocks, 12) %}    {% for value in chunk %}{{ '0x%04x' % value }},{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+/// The full canonical decomposition of a code point is `length` code points
+/// from `offset` in `decomposed_code_points`
+struct decomposition {
+  char32_t code_point;
+  std::uint16_t offset;
+  std::uint16_t length;
+};
+
+inline constexpr auto decompositions = std::array<decomposition, {{ decompositions|length }}>{% raw %}{{{% endraw %}
+{% for code_point, offset, length in decompositions %}    {U'\\x{{ '%04x' % code_point }}', {{ offset }}, {{ length }}},
+{% endfor %}{% raw %}}}{% endraw %};
+
+inline constexpr auto decomposed_code_points = std::array<char32_t, {{ decomposed_code_points|length }}>{% raw %}{{{% endraw %}
+{% for chunk in chunks(decomposed_code_points, 8) %}    {% for code_point in chunk %}U'\\x{{ '%04x' % code_point }}',{% if not loop.last %} {% endif %}{% endfor %}
+{% endfor %}{% raw %}}}{% endraw %};
+
+/// Canonical compositions of primary composites, sorted by the pair of code
+/// points they compose
+struct composition {
+  char32_t first;
+  char32_t second;
+  char32_t composite;
+};
+
+inline constexpr auto compositions = std::array<composition, {{ compositions|length }}>{% raw %}{{{% endraw %}
+{% for first, second, composite in compositions %}    {U'\\x{{ '%04x' % first }}', U'\\x{{ '%04x' % second }}', U'\\x{{ '%04x' % composite }}'},
+{% endfor %}{% raw %}}}{% endraw %};
+}  // namespace skyr::unicode::details
+
+#endif  // SKYR_UNICODE_NORMALIZATION_TABLES_HPP
+
+""")
+
+    with open(output, 'w+') as output_file:
+        template.stream(
+            table=table,
+            decompositions=decomposition_entries,
+            decomposed_code_points=decomposed_code_points,
+            compositions=compositions,
+            chunks=chunks
+        ).dump(output_file)
+
+
+if __name__ == '__main__':
+    main()